@@ -17,6 +17,7 @@
 #include "cc_hal.h"
 #include "cc_pal_interrupt_ctrl.h"
 #include "cc_pal_perf.h"
+#include "cc_pal_trace.h"
 #include "cc_registers.h"
 
 /******************************************************************************
@@ -117,6 +118,7 @@ void WaitForSequenceCompletionPlat(CCBool isPreempt)
     }
 
     CC_PAL_LOG_INFO("Sequence completed\n");
+    CC_PAL_TRACE0(SEQ_COMPLETED);
 }
 
 /*!
@@ -9,6 +9,7 @@
 #define __HW_QUEUE_DEFS_PLAT_H__
 
 #include "cc_pal_barrier.h"
+#include "cc_pal_trace.h"
 
 /*****************************/
 /* Descriptor packing macros */
@@ -23,6 +24,7 @@
 #define HW_DESC_PUSH_TO_QUEUE(pDesc) do {        				\
 	LOG_HW_DESC(pDesc);							\
 	HW_DESC_DUMP(pDesc);							\
+	CC_PAL_TRACE_HW_DESC(pDesc);						\
 	CC_HAL_WRITE_REGISTER(GET_HW_Q_DESC_WORD_IDX(0), (pDesc)->word[0]); 	\
 	CC_HAL_WRITE_REGISTER(GET_HW_Q_DESC_WORD_IDX(1), (pDesc)->word[1]); 	\
 	CC_HAL_WRITE_REGISTER(GET_HW_Q_DESC_WORD_IDX(2), (pDesc)->word[2]); 	\
@@ -18,6 +18,7 @@
 #include "cc_crypto_ctx.h"
 #include "completion.h"
 #include "cc_pal_perf.h"
+#include "cc_pal_trace.h"
 #include "sym_crypto_driver.h"
 #include "sym_adaptor_driver.h"
 #include "sym_adaptor_util.h"
@@ -254,6 +255,7 @@ int SymDriverAdaptorInit(uint32_t *pCtx, enum drv_crypto_alg alg, int mode)
 
     CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_SYM_DRV_INIT);
     CC_PAL_LOG_INFO("pCtx=%p\n", pCtx);
+    CC_PAL_TRACE3(SYM_DRV_INIT, CC_PAL_TRACE_PTR(pCtx), alg, mode);
     if (pCtx == NULL) {
         CC_PAL_LOG_ERR("NULL pointer was given for ctx\n");
         CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_SYM_DRV_INIT);
@@ -295,6 +297,7 @@ int SymDriverAdaptorInit(uint32_t *pCtx, enum drv_crypto_alg alg, int mode)
 EndWithErr:
 
     CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_SYM_DRV_INIT);
+    CC_PAL_TRACE1(SYM_DRV_DONE, (uint32_t)symRc);
 
     if (CC_PalMutexUnlock(&CCSymCryptoMutex) != CC_SUCCESS) {
         CC_PalAbort("Fail to release mutex\n");
@@ -336,6 +339,8 @@ int SymDriverAdaptorProcess(uint32_t* pCtx,
     CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_SYM_DRV_PROC);
     CC_PAL_LOG_INFO("pCtx=%p\n", pCtx);
     CC_PAL_LOG_INFO("IN addr=%p OUT addr=%p DataSize=%u\n", pDataIn, pDataOut, DataSize);
+    CC_PAL_TRACE5(SYM_DRV_PROCESS, CC_PAL_TRACE_PTR(pCtx), CC_PAL_TRACE_PTR(pDataIn),
+                  CC_PAL_TRACE_PTR(pDataOut), DataSize, alg);
 
     if (pCtx == NULL) {
         CC_PAL_LOG_ERR("NULL pointer was given for ctx\n");
@@ -420,6 +425,7 @@ EndWithErr:
 
 ProcessUnlockMutex:
     CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_SYM_DRV_PROC);
+    CC_PAL_TRACE1(SYM_DRV_DONE, (uint32_t)symRc);
 
     if (CC_PalMutexUnlock(&CCSymCryptoMutex) != CC_SUCCESS) {
         CC_PalAbort("Fail to release mutex\n");
@@ -464,6 +470,8 @@ int SymDriverAdaptorFinalize(uint32_t* pCtx,
 
     CC_PAL_LOG_INFO("pCtx=%p\n", pCtx);
     CC_PAL_LOG_INFO("IN addr=%p OUT addr=%p DataSize=%u\n", pDataIn, pDataOut, DataSize);
+    CC_PAL_TRACE5(SYM_DRV_FINALIZE, CC_PAL_TRACE_PTR(pCtx), CC_PAL_TRACE_PTR(pDataIn),
+                  CC_PAL_TRACE_PTR(pDataOut), DataSize, alg);
 
     /* do not check din pointer since hash/hmac algs has no data input */
     if (pCtx == NULL) {
@@ -564,6 +572,7 @@ EndWithErr:
 finalizeUnlockMutex:
 
     CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_SYM_DRV_FIN);
+    CC_PAL_TRACE1(SYM_DRV_DONE, (uint32_t)symRc);
 
     if (CC_PalMutexUnlock(&CCSymCryptoMutex) != CC_SUCCESS) {
         CC_PalAbort("Fail to release mutex\n");
@@ -10,6 +10,7 @@
 #include "sym_adaptor_driver_int.h"
 #include "cc_pal_log.h"
 #include "cc_hw_queue_defs.h"
+#include "cc_pal_trace.h"
 
 /******************************************************************************
  *                          DEFINITIONS
@@ -591,6 +592,8 @@ uint32_t SymDriverAdaptorBuildDmaFromDataPtr(void* pDataIn,
 {
     uint32_t retCode = 0;
 
+    CC_PAL_TRACE4(BUILD_DMA, CC_PAL_TRACE_PTR(pDataIn), CC_PAL_TRACE_PTR(pDataOut), dataSize, isInPlace);
+
     /* in case of inplace - map only one buffer bi directional */
     if (isInPlace == INPLACE) {
         retCode = buildDmaFromDataPtr((uint8_t *) pDataIn,
@@ -651,9 +654,11 @@ uint32_t SymDriverAdaptorBuildDmaFromDataPtr(void* pDataIn,
         *pDmaBuiltFlag |= DMA_BUILT_FLAG_OUTPUT_BUFF;
     }
 
+    CC_PAL_TRACE4(BUILD_DMA_DONE, pDmaBuffIn->dmaBufType, pDmaBuffOut->dmaBufType, *pDmaBuiltFlag, 0);
     return 0;
 
 EndWithErr:
     *pDmaBuiltFlag = 0;
+    CC_PAL_TRACE4(BUILD_DMA_DONE, pDmaBuffIn->dmaBufType, pDmaBuffOut->dmaBufType, 0, retCode);
     return retCode;
 }
@@ -14,6 +14,11 @@
 #include "cc_common_error.h"
 #include "cc_pal_mem.h"
 #include "cc_bitops.h"
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
 
 /************************ Defines ******************************/
 
@@ -23,7 +28,65 @@
 
 /************************ Global Data **************************/
 
-/************* Private function prototype **********************/
+/************************ Private Functions ********************/
+
+/* Reverses the bytes order of a buffer into the destination buffer, which is either the source
+   buffer itself or a buffer that does not overlap it. The bytes are moved in 16-byte vectors
+   when the CPU has SIMD instructions, and in 64-bit limbs, taken from both ends of the buffer. */
+static void CommonReverseBytes(uint8_t *dst_ptr, const uint8_t *src_ptr, uint32_t size)
+{
+        uint32_t lo = 0, hi = size;
+        uint64_t limbLo, limbHi;
+        uint8_t  temp;
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        uint8x16_t vecLo, vecHi;
+
+        while (hi - lo >= 32) {
+                vecLo = vrev64q_u8(vld1q_u8(&src_ptr[lo]));
+                vecHi = vrev64q_u8(vld1q_u8(&src_ptr[hi - 16]));
+                vst1q_u8(&dst_ptr[lo], vextq_u8(vecHi, vecHi, 8));
+                vst1q_u8(&dst_ptr[hi - 16], vextq_u8(vecLo, vecLo, 8));
+                lo += 16;
+                hi -= 16;
+        }
+#elif defined(__SSSE3__)
+        const __m128i revMask = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        __m128i vecLo, vecHi;
+
+        while (hi - lo >= 32) {
+                vecLo = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&src_ptr[lo]), revMask);
+                vecHi = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&src_ptr[hi - 16]), revMask);
+                _mm_storeu_si128((__m128i *)&dst_ptr[lo], vecHi);
+                _mm_storeu_si128((__m128i *)&dst_ptr[hi - 16], vecLo);
+                lo += 16;
+                hi -= 16;
+        }
+#endif
+
+        while (hi - lo >= 16) {
+                limbLo = CC_COMMON_LOAD_LE64(&src_ptr[lo]);
+                limbHi = CC_COMMON_LOAD_LE64(&src_ptr[hi - 8]);
+                CC_COMMON_STORE_BE64(&dst_ptr[lo], limbHi);
+                CC_COMMON_STORE_BE64(&dst_ptr[hi - 8], limbLo);
+                lo += 8;
+                hi -= 8;
+        }
+
+        /* the middle bytes */
+        while (hi - lo >= 2) {
+                temp = src_ptr[lo];
+                dst_ptr[lo] = src_ptr[hi - 1];
+                dst_ptr[hi - 1] = temp;
+                lo++;
+                hi--;
+        }
+        if (hi > lo) {
+                dst_ptr[lo] = src_ptr[lo];
+        }
+
+        return;
+}
 
 /************************ Public Functions *********************/
 
@@ -48,11 +111,6 @@
  */
 CCError_t CC_CommonReverseMemcpy( uint8_t *dst_ptr , uint8_t *src_ptr , uint32_t size )
 {
-        /* FUNCTION DECLARATIONS */
-
-        /* loop variable */
-        uint32_t i;
-
         /* FUNCTION LOGIC */
 
         /* check overlapping */
@@ -61,23 +119,8 @@ CCError_t CC_CommonReverseMemcpy( uint8_t *dst_ptr , uint8_t *src_ptr , uint32_t
                 return CC_COMMON_DATA_OUT_DATA_IN_OVERLAP_ERROR;
         }
 
-
-        /* execute the reverse copy in case of different buffers */
-        if (dst_ptr != src_ptr) {
-                for (i = 0 ; i < size ; i++)
-                        dst_ptr[i] = src_ptr[size - 1 - i];
-        }
-
-        /* execute the reverse copy in the same place */
-        else {
-                uint8_t  temp;
-
-                for (i = 0; i < size / 2; i++) {
-                        temp = src_ptr[i];
-                        src_ptr[i] = src_ptr[size - 1 - i];
-                        src_ptr[size - 1 - i] = temp;
-                }
-        }
+        /* execute the reverse copy, in case of different buffers or in the same place */
+        CommonReverseBytes(dst_ptr, src_ptr, size);
 
         return CC_OK;
 
@@ -112,31 +155,27 @@ void CC_CommonInPlaceConvertBytesWordsAndArrayEndianness(
 {
         /* FUNCTION DECLARATIONS */
 
+#ifdef BIG__ENDIAN
         uint32_t i, tmp;
+#endif
 
         /* FUNCTION logic */
 
 #ifndef BIG__ENDIAN
-        /* If sizeWords is odd revert middle word */
-        if (sizeWords & 1UL) {
-                buf_ptr[sizeWords/2] = CC_COMMON_REVERSE32(buf_ptr[sizeWords/2]);
-        }
-#endif
-
-                /* Reverse order of words and order of bytes in each word.    *
+        /* Reversing the order of words and the order of bytes in each word *
+        *  is reversing the order of all the bytes                          */
+        CommonReverseBytes((uint8_t *)buf_ptr, (uint8_t *)buf_ptr, sizeWords*CC_32BIT_WORD_SIZE);
+#else
+                /* Reverse order of words.                                    *
                 *  Note: Condition (sizeWords >= 2) inserted inside for() to  *
                 *        prevent wrong false positive warnings.               *
                 *                                                             */
                 for (i = 0; ((i < sizeWords/2) && (sizeWords >= 2)); i++) {
-#ifndef BIG__ENDIAN
-                        tmp = CC_COMMON_REVERSE32(buf_ptr[i]);
-                        buf_ptr[i] = CC_COMMON_REVERSE32(buf_ptr[sizeWords-i-1]);
-#else
                         tmp = buf_ptr[i];
                         buf_ptr[i] = buf_ptr[sizeWords-i-1];
-#endif
                         buf_ptr[sizeWords-i-1] = tmp;
                 }
+#endif
 
         return;
 
@@ -200,6 +239,21 @@ CCError_t CC_CommonConvertMsbLsbBytesToLswMswWords(
         if (roundedInpSizeInBytes > sizeOutBuffBytes)
                 return CC_COMMON_OUTPUT_BUFF_SIZE_ILLEGAL;
 
+#ifndef BIG__ENDIAN
+        /*  On little endian CPU the output is the reversed input followed by zeros:
+            reverse the input straight into the output buffer, if it does not overlap it
+            or the conversion is in place with size aligned to words */
+        if (((CCVirtAddr_t)out32_ptr == (CCVirtAddr_t)in8_ptr) ?
+            ((inpSizeInBytes & 3) == 0) :
+            (((CCVirtAddr_t)out32_ptr + sizeOutBuffBytes <= (CCVirtAddr_t)in8_ptr) ||
+             ((CCVirtAddr_t)in8_ptr + inpSizeInBytes <= (CCVirtAddr_t)out32_ptr))) {
+                CommonReverseBytes((uint8_t*)out32_ptr, in8_ptr, inpSizeInBytes);
+                CC_PalMemSetZero((uint8_t*)out32_ptr + inpSizeInBytes,
+                                 sizeOutBuffBytes - inpSizeInBytes); /*tailing zeros*/
+                return CC_OK;
+        }
+#endif
+
         /*  If the conversion is not "in place" or data size not aligned to
             words, then copy the data into output buffer and zeroe leading bytes */
         if (((CCVirtAddr_t)out32_ptr != (CCVirtAddr_t)in8_ptr) || (inpSizeInBytes & 3)) {
@@ -272,21 +326,29 @@ CCError_t CC_CommonConvertLswMswWordsToMsbLsbBytes(
         if (((CCVirtAddr_t)in32_ptr == (CCVirtAddr_t)out8_ptr) && (sizeInBytes & 3UL))
                 return CC_COMMON_DATA_SIZE_ILLEGAL;
 
-        /* Reverse words order and bytes according to endianness of CPU */
-        CC_CommonInPlaceConvertBytesWordsAndArrayEndianness(in32_ptr, sizeInWords);
-
-        /* Copy output buffer */
+        /* Check overlapping */
         if ((CCVirtAddr_t)out8_ptr != (CCVirtAddr_t)in32_ptr) {
-
-                /* Check overlapping */
                 if (((CCVirtAddr_t)out8_ptr > (CCVirtAddr_t)in32_ptr && (CCVirtAddr_t)out8_ptr < ((CCVirtAddr_t)in32_ptr + sizeInBytes)) ||
                     ((CCVirtAddr_t)out8_ptr < (CCVirtAddr_t)in32_ptr && ((CCVirtAddr_t)out8_ptr + sizeInBytes) > (CCVirtAddr_t)in32_ptr))
                         return CC_COMMON_DATA_OUT_DATA_IN_OVERLAP_ERROR;
+        }
+
+#ifndef BIG__ENDIAN
+        /* On little endian CPU the output is the reversed LS bytes of the input:
+           reverse them straight into the output buffer */
+        CC_UNUSED_PARAM(sizeInWords);
+        CommonReverseBytes(out8_ptr, (uint8_t *)in32_ptr, sizeInBytes);
+#else
+        /* Reverse words order and bytes according to endianness of CPU */
+        CC_CommonInPlaceConvertBytesWordsAndArrayEndianness(in32_ptr, sizeInWords);
 
+        /* Copy output buffer */
+        if ((CCVirtAddr_t)out8_ptr != (CCVirtAddr_t)in32_ptr) {
                 CC_PalMemCopy(out8_ptr, (uint8_t *)in32_ptr + ((4 - (sizeInBytes & 3UL)) & 3UL), sizeInBytes);
                 /* Revert the input buffer to previous state */
                 CC_CommonInPlaceConvertBytesWordsAndArrayEndianness(in32_ptr, sizeInWords);
         }
+#endif
 
         return CC_OK;
 }
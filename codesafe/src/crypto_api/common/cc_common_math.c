@@ -14,13 +14,102 @@
 
 /************************ Defines **************************************/
 
+/* the counters are processed in 64-bit limbs */
+#define CALC_64BIT_LIMBS_FROM_BYTES(sizeBytes)  (((sizeBytes) + 7) / 8)
+#define CALC_64BIT_LIMBS_FROM_WORDS(sizeWords)  (((sizeWords) + 1) / 2)
+
+/* 64-bit limb of a words array from the word i, LS word first */
+#define COMMON_LOAD_LIMB64(ptr, i)  ( ((uint64_t)(ptr)[(i)+1] << 32) | (ptr)[(i)] )
+
+/* 1 if a < b, 0 otherwise, without branches; a and b are uint64_t variables */
+#define COMMON_CT_LT64(a, b)  ((uint32_t)(((~(a) & (b)) | (~((a) ^ (b)) & ((a) - (b)))) >> 63))
+
+/* 1 if a != 0, 0 otherwise, without branches; a is a uint64_t variable */
+#define COMMON_CT_NZ64(a)  ((uint32_t)(((a) | (0 - (a))) >> 63))
+
 /************************ Enums ****************************************/
 
 /************************ Typedefs *************************************/
 
 /************************ Global Data **********************************/
 
-/************* Private function prototype ******************************/
+/************************ Private Functions ****************************/
+
+/* returns the limb i (from the LS limb) of a counter of bytes, the LSB first,
+   extended by zeros beyond its size */
+static uint64_t CommonLoadLimbLsbBytes(const uint8_t *CounterBuff_ptr, size_t CounterSize, size_t i)
+{
+	uint64_t Limb = 0;
+	size_t j;
+
+	if (CounterSize >= 8*(i+1))
+		return CC_COMMON_LOAD_LE64(&CounterBuff_ptr[8*i]);
+
+	for (j = CounterSize; j > 8*i; j--)
+		Limb = (Limb << 8) | CounterBuff_ptr[j - 1];
+
+	return Limb;
+}
+
+/* returns the limb i (from the LS limb) of a counter of words, the LS word first,
+   extended by zeros beyond its size */
+static uint64_t CommonLoadLimbWords(const uint32_t *CounterBuff_ptr, uint32_t CounterSizeWords, uint32_t i)
+{
+	if (CounterSizeWords >= 2*(i+1))
+		return COMMON_LOAD_LIMB64(CounterBuff_ptr, 2*i);
+
+	if (CounterSizeWords == 2*i+1)
+		return CounterBuff_ptr[2*i];
+
+	return 0;
+}
+
+/* folds the comparison of two limbs into the result of the comparison of the lower limbs:
+   the result of different limbs overrides it. Executes in constant time. */
+static uint32_t CommonCmpLimb(uint32_t Result, uint64_t Limb1, uint64_t Limb2)
+{
+	uint32_t Greater = COMMON_CT_LT64(Limb2, Limb1);
+	uint32_t Less = COMMON_CT_LT64(Limb1, Limb2);
+	uint32_t Mask = 0 - (Greater | Less);
+
+	return (Result & ~Mask) |
+	       (((Greater * CC_COMMON_CmpCounter1GreaterThenCounter2) | (Less * CC_COMMON_CmpCounter2GreaterThenCounter1)) & Mask);
+}
+
+/* returns the number of significant bits of a limb. Executes in constant time. */
+static uint32_t CommonLimbSizeInBits(uint64_t Limb)
+{
+	uint32_t SizeInBits = 0;
+	uint32_t Shift, NotZero;
+
+	/* binary search of the MS '1' */
+	for (Shift = 32; Shift > 0; Shift >>= 1) {
+		NotZero = COMMON_CT_NZ64(Limb >> Shift);
+		SizeInBits += NotZero * Shift;
+		Limb >>= NotZero * Shift;
+	}
+
+	/* the limb is now 0 or 1 */
+	return SizeInBits + (uint32_t)Limb;
+}
+
+#ifndef DX_OEM_FW
+/* returns the limb i (from the LS limb) of a counter of bytes, the MSB first,
+   extended by zeros beyond its size */
+static uint64_t CommonLoadLimbMsbBytes(const uint8_t *CounterBuff_ptr, uint32_t CounterSize, uint32_t i)
+{
+	uint64_t Limb = 0;
+	uint32_t j;
+
+	if (CounterSize >= 8*(i+1))
+		return CC_COMMON_LOAD_BE64(&CounterBuff_ptr[CounterSize - 8*(i+1)]);
+
+	for (j = 0; j + 8*i < CounterSize; j++)
+		Limb = (Limb << 8) | CounterBuff_ptr[j];
+
+	return Limb;
+}
+#endif
 
 /************************ Public Functions *****************************/
 
@@ -231,91 +320,22 @@ CCCommonCmpCounter_t CC_CommonCmpMsbUnsignedCounters( const uint8_t  *CounterBuf
 	/* FUNCTION LOCAL DECLERATIONS */
 
 	/* loop variable */
-	int32_t StartInd1,StartInd2;
 	uint32_t i;
 
-	/* the result after comparing the bytes */
-	CCCommonCmpCounter_t Result;
-
-	/* the final result */
-	CCCommonCmpCounter_t FinalResult;
+	/* the result of the compared limbs */
+	uint32_t Result = CC_COMMON_CmpCounter1AndCounter2AreIdentical;
 
 	/* FUNCTION LOGIC */
 
-	/* ........ initialize local variables ............................................ */
-	/* -------------------------------------------------------------------------------- */
-
-	/* the default is that the result is the same */
-	Result = CC_COMMON_CmpCounter1AndCounter2AreIdentical;
-	FinalResult = CC_COMMON_CmpCounter1AndCounter2AreIdentical; /* just to avoid compilers warnings */
-
-	/* ........ calculate the effective size ( decrementing the zeros at the MS bytes ) */
-	/* -------------------------------------------------------------------------------- */
-
-	StartInd1=0,StartInd2=0;
-	/* a loop for adjusting the counter 1 size by neglecting the zeros */
-	while (Counter1Size && (CounterBuff1_ptr[StartInd1] == 0)) {
-		StartInd1++;
-		Counter1Size--;
+	/* compare all the limbs of the longer counter from the LS limb, the shorter counter is
+	   extended by zeros; the first different limb from the MS limb determines the result */
+	for (i = 0; i < CALC_64BIT_LIMBS_FROM_BYTES(CC_MAX(Counter1Size, Counter2Size)); i++) {
+		Result = CommonCmpLimb(Result,
+				       CommonLoadLimbMsbBytes(CounterBuff1_ptr, Counter1Size, i),
+				       CommonLoadLimbMsbBytes(CounterBuff2_ptr, Counter2Size, i));
 	}
-	/* a loop for adjusting the counter 2 size by neglecting the zeros */
-	while (Counter2Size && (CounterBuff2_ptr[StartInd2] == 0)) {
-		StartInd2++;
-		Counter2Size--;
-	}
-
-	/* ....... step 1 : comparing the counters assuming the effective counter size is the same .......... */
-	/* -------------------------------------------------------------------------------------------------- */
 
-	/* for security reasons we shall execute this loop as the minimum between the counter sizes
-	   the result will be neglected in steps 2,3 if the actual size is different */
-
-	/* we shall compare all of the bytes from the MSB , the first one that is different
-	   will determine which counter is larger , if all of the bytes are equal then the counters are equal */
-
-	/* loop for checking all of the bytes */
-	for (i=0 ; i < CC_MIN(Counter1Size, Counter2Size) ; i++) {
-		/* if the counter 1 byte is grater then counter 2 byte - return counter 1 is bigger */
-		if ((CounterBuff1_ptr[StartInd1 + i] > CounterBuff2_ptr[StartInd2 + i]) && Result == CC_COMMON_CmpCounter1AndCounter2AreIdentical)
-
-			Result = CC_COMMON_CmpCounter1GreaterThenCounter2;
-
-		/* if the counter 2 byte is grater then counter 1 byte - return counter 2 is bigger */
-		if ((CounterBuff2_ptr[StartInd2 + i] > CounterBuff1_ptr[StartInd1 + i]) && Result == CC_COMMON_CmpCounter1AndCounter2AreIdentical)
-
-			Result = CC_COMMON_CmpCounter2GreaterThenCounter1;
-
-	}/* end of searching all of the bytes loop */
-
-	/* ....... STEP 2 : the counter 1 effective size is bigger then counter 2 effective size */
-	/* ------------------------------------------------------------------------------------- */
-
-	/* on this case the final result is then counter 1 is larger then counter 2 - neglecting the
-	   result calculated in step 1 */
-	if (Counter1Size > Counter2Size)
-
-		FinalResult = CC_COMMON_CmpCounter1GreaterThenCounter2;
-
-	/* ....... STEP 3 : the counter 2 effective size is bigger then counter 1 effective size */
-	/* ------------------------------------------------------------------------------------- */
-
-	/* on this case the final result is then counter 2 is larger then counter 1 - neglecting the
-	  result calculated in step 1 */
-	if (Counter2Size > Counter1Size)
-
-		FinalResult = CC_COMMON_CmpCounter2GreaterThenCounter1;
-
-	/* ....... STEP 4 : the counter 1 effective size is the same as the counter 2 effective size */
-	/* ----------------------------------------------------------------------------------------- */
-
-	/* on this case the final result is the one calculated in STEP 1 */
-	if (Counter2Size == Counter1Size)
-
-		FinalResult = Result;
-
-	/* return the final result */
-
-	return FinalResult;
+	return (CCCommonCmpCounter_t)Result;
 
 } /* end CC_CommonCmpMsbUnsignedCounters */
 
@@ -342,6 +362,7 @@ CCCommonCmpCounter_t CC_CommonCmpMsbUnsignedCounters( const uint8_t  *CounterBuf
  *                                0 - both counters are identical
  *                                1 - counter 1 is larger.
  *                                2 - counter 2 is larger.
+ * @note This code executes in constant time, regardless of the values of the counters.
  */
 
 CCCommonCmpCounter_t CC_CommonCmpLsbUnsignedCounters( const uint8_t  *CounterBuff1_ptr,
@@ -352,97 +373,22 @@ CCCommonCmpCounter_t CC_CommonCmpLsbUnsignedCounters( const uint8_t  *CounterBuf
 	/* FUNCTION LOCAL DECLERATIONS */
 
 	/* loop variable */
-	int32_t i;
+	size_t i;
 
-	/* the result after comparing the bytes */
-	CCCommonCmpCounter_t Result;
-
-	/* the final result */
-	CCCommonCmpCounter_t FinalResult;
+	/* the result of the compared limbs */
+	uint32_t Result = CC_COMMON_CmpCounter1AndCounter2AreIdentical;
 
 	/* FUNCTION LOGIC */
 
-	/* ........ initialize local variables ............................................ */
-	/* -------------------------------------------------------------------------------- */
-
-	/* the default is that the result is the same */
-	Result = CC_COMMON_CmpCounter1AndCounter2AreIdentical;
-	FinalResult = CC_COMMON_CmpCounter1AndCounter2AreIdentical; /* just to avoid compilers warnings */
-
-	/* STEP 1 : calculate the effective size (decrementing the zeros at the MS bytes) */
-	/* ------------------------------------------------------------------------------ */
-
-	/* a loop for adjusting the counter 1 size by neglecting the zeros */
-	while (Counter1Size != 0) {
-		if (CounterBuff1_ptr[Counter1Size - 1] == 0)
-			Counter1Size--;
-		else
-			break;
-	}
-
-
-	/* a loop for adjusting the counter 2 size by neglecting the zeros */
-	while (Counter2Size != 0) {
-		if (CounterBuff2_ptr[Counter2Size - 1] == 0)
-			Counter2Size--;
-		else
-			break;
+	/* compare all the limbs of the longer counter from the LS limb, the shorter counter is
+	   extended by zeros; the first different limb from the MS limb determines the result */
+	for (i = 0; i < CALC_64BIT_LIMBS_FROM_BYTES(CC_MAX(Counter1Size, Counter2Size)); i++) {
+		Result = CommonCmpLimb(Result,
+				       CommonLoadLimbLsbBytes(CounterBuff1_ptr, Counter1Size, i),
+				       CommonLoadLimbLsbBytes(CounterBuff2_ptr, Counter2Size, i));
 	}
 
-	/* check the sizes */
-	if (Counter1Size == 0 && Counter2Size == 0)
-		return CC_COMMON_CmpCounter1AndCounter2AreIdentical;
-	else if (Counter1Size > Counter2Size)
-		return CC_COMMON_CmpCounter1GreaterThenCounter2;
-	else if (Counter2Size > Counter1Size)
-		return CC_COMMON_CmpCounter2GreaterThenCounter1;
-
-	/* step 2 : comparing the counters assuming the effective counter size is the same */
-	/* ------------------------------------------------------------------------------- */
-
-	/* for security reasons we shall execute this loop as the minimum between the counter sizes
-      the result will be neglected in steps 2,3 if the actual size is different */
-
-	/* we shall compare all of the bytes from the MSB , the first one that is different
-	   will determine which counter is larger , if all of the bytes are equal then the counters are equal */
-
-	/* loop for checking all of the bytes */
-	for (i = CC_MIN(Counter1Size - 1,Counter2Size - 1) ; i >= 0 ; i--) {
-		/* if the counter 1 byte is grater then counter 2 byte - return counter 1 is bigger */
-		if ((CounterBuff1_ptr[i] > CounterBuff2_ptr[i]) && Result == CC_COMMON_CmpCounter1AndCounter2AreIdentical)
-			Result = CC_COMMON_CmpCounter1GreaterThenCounter2;
-
-		/* if the counter 2 byte is grater then counter 1 byte - return counter 2 is bigger */
-		if ((CounterBuff2_ptr[i] > CounterBuff1_ptr[i]) && Result == CC_COMMON_CmpCounter1AndCounter2AreIdentical)
-			Result = CC_COMMON_CmpCounter2GreaterThenCounter1;
-
-	}/* end of searching all of the bytes loop */
-
-	/* STEP 3 : the counter 1 effective size is bigger then counter 2 effective size */
-	/* ----------------------------------------------------------------------------- */
-
-	/* on this case the final result is then counter 1 is larger then counter 2 - neglecting the
-	   result calculated in step 1 */
-	if (Counter1Size > Counter2Size)
-		FinalResult = CC_COMMON_CmpCounter1GreaterThenCounter2;
-
-	/* STEP 4 : the counter 2 effective size is bigger then counter 1 effective size */
-	/* ----------------------------------------------------------------------------- */
-
-	/* on this case the final result is then counter 2 is larger then counter 1 - neglecting the
-	  result calculated in step 1 */
-	if (Counter2Size > Counter1Size)
-		FinalResult = CC_COMMON_CmpCounter2GreaterThenCounter1;
-
-	/* ....... STEP 4 : the counter 1 effective size is the same as the counter 2 effective size */
-	/* ----------------------------------------------------------------------------------------- */
-
-	/* on this case the final result is the one calculated in STEP 1 */
-	if (Counter2Size == Counter1Size)
-		FinalResult = Result;
-
-	/* return the final result */
-	return FinalResult;
+	return (CCCommonCmpCounter_t)Result;
 
 }/* END OF CC_CommonCmpLsbUnsignedCounters */
 
@@ -465,6 +411,7 @@ CCCommonCmpCounter_t CC_CommonCmpLsbUnsignedCounters( const uint8_t  *CounterBuf
  *                                0 - both counters are identical
  *                                1 - counter 1 is larger.
  *                                2 - counter 2 is larger.
+ * @note This code executes in constant time, regardless of the values of the counters.
  */
 CCCommonCmpCounter_t CC_CommonCmpLsWordsUnsignedCounters(const uint32_t  *CounterBuff1_ptr,
 								uint32_t   Counter1SizeWords,
@@ -474,96 +421,22 @@ CCCommonCmpCounter_t CC_CommonCmpLsWordsUnsignedCounters(const uint32_t  *Counte
 	/* FUNCTION LOCAL DECLARATIONS */
 
 	/* loop variable */
-	int32_t i;
-
-	/* the result after comparing the bytes */
-	CCCommonCmpCounter_t Result;
+	uint32_t i;
 
-	/* the final result */
-	CCCommonCmpCounter_t FinalResult;
+	/* the result of the compared limbs */
+	uint32_t Result = CC_COMMON_CmpCounter1AndCounter2AreIdentical;
 
 	/* FUNCTION LOGIC */
 
-	/* ........ initialize local variables ............................................ */
-	/* -------------------------------------------------------------------------------- */
-
-	/* the default is that the result is the same */
-	Result = CC_COMMON_CmpCounter1AndCounter2AreIdentical;
-	FinalResult = CC_COMMON_CmpCounter1AndCounter2AreIdentical; /* just to avoid compilers warnings */
-
-	/* ........ calculate the effective size ( decrementing the zeros at the MS bytes ) */
-	/* -------------------------------------------------------------------------------- */
-
-	/* a loop for adjusting the counter 1 size by neglecting the zeros */
-	while (Counter1SizeWords != 0) {
-		if (CounterBuff1_ptr[Counter1SizeWords - 1] == 0)
-			Counter1SizeWords--;
-		else
-			break;
+	/* compare all the limbs of the longer counter from the LS limb, the shorter counter is
+	   extended by zeros; the first different limb from the MS limb determines the result */
+	for (i = 0; i < CALC_64BIT_LIMBS_FROM_WORDS(CC_MAX(Counter1SizeWords, Counter2SizeWords)); i++) {
+		Result = CommonCmpLimb(Result,
+				       CommonLoadLimbWords(CounterBuff1_ptr, Counter1SizeWords, i),
+				       CommonLoadLimbWords(CounterBuff2_ptr, Counter2SizeWords, i));
 	}
 
-	/* a loop for adjusting the counter 2 size by neglecting the zeros */
-	while (Counter2SizeWords != 0) {
-		if (CounterBuff2_ptr[Counter2SizeWords - 1] == 0)
-			Counter2SizeWords--;
-		else
-			break;
-	}
-
-	/* check the sizes */
-	if (Counter1SizeWords == 0 && Counter2SizeWords == 0)
-		return CC_COMMON_CmpCounter1AndCounter2AreIdentical;
-	else if (Counter1SizeWords > Counter2SizeWords)
-		return CC_COMMON_CmpCounter1GreaterThenCounter2;
-	else if (Counter2SizeWords > Counter1SizeWords)
-		return CC_COMMON_CmpCounter2GreaterThenCounter1;
-
-	/* ....... step 1 : comparing the counters assuming the effective counter size is the same .......... */
-	/* -------------------------------------------------------------------------------------------------- */
-
-	/* for security reasons we shall execute this loop as the minimum between the counter sizes
-	   the result will be neglected in steps 2,3 if the actual size is different */
-
-	/* we shall compare all of the bytes from the MSB , the first one that is different
-	   will determine which counter is larger , if all of the bytes are equal then the counters are equal */
-
-	/* loop for checking all of the bytes */
-	for (i = CC_MIN(Counter1SizeWords - 1, Counter2SizeWords - 1) ; i >= 0 ; i--) {
-		/* if the counter 1 byte is grater then counter 2 byte - return counter 1 is bigger */
-		if ((CounterBuff1_ptr[i] > CounterBuff2_ptr[i]) && (Result == CC_COMMON_CmpCounter1AndCounter2AreIdentical))
-			Result = CC_COMMON_CmpCounter1GreaterThenCounter2;
-
-		/* if the counter 2 byte is grater then counter 1 byte - return counter 2 is bigger */
-		if ((CounterBuff2_ptr[i] > CounterBuff1_ptr[i]) && (Result == CC_COMMON_CmpCounter1AndCounter2AreIdentical))
-			Result = CC_COMMON_CmpCounter2GreaterThenCounter1;
-
-	}/* end of searching all of the bytes loop */
-
-	/* ....... STEP 2 : the counter 1 effective size is bigger then counter 2 effective size */
-	/* ------------------------------------------------------------------------------------- */
-
-	/* on this case the final result is then counter 1 is larger then counter 2 - neglecting the
-	   result calculated in step 1 */
-	if (Counter1SizeWords > Counter2SizeWords)
-		FinalResult = CC_COMMON_CmpCounter1GreaterThenCounter2;
-
-	/* ....... STEP 3 : the counter 2 effective size is bigger then counter 1 effective size */
-	/* ------------------------------------------------------------------------------------- */
-
-	/* on this case the final result is then counter 2 is larger then counter 1 - neglecting the
-	  result calculated in step 1 */
-	if (Counter2SizeWords > Counter1SizeWords)
-		FinalResult = CC_COMMON_CmpCounter2GreaterThenCounter1;
-
-	/* ....... STEP 4 : the counter 1 effective size is the same as the counter 2 effective size */
-	/* ----------------------------------------------------------------------------------------- */
-
-	/* on this case the final result is the one calculated in STEP 1 */
-	if (Counter2SizeWords == Counter1SizeWords)
-		FinalResult = Result;
-
-	/* return the final result */
-	return FinalResult;
+	return (CCCommonCmpCounter_t)Result;
 
 }
 
@@ -587,6 +460,7 @@ CCCommonCmpCounter_t CC_CommonCmpLsWordsUnsignedCounters(const uint32_t  *Counte
  * @param[in] CounterSize     -  the counter size in bytes.
  *
  * @return result - The effective counters size in bits.
+ * @note This code executes in constant time, regardless of the value of the counter.
  */
 
 uint32_t CC_CommonGetBytesCounterEffectiveSizeInBits( const uint8_t  *CounterBuff_ptr,
@@ -595,45 +469,26 @@ uint32_t CC_CommonGetBytesCounterEffectiveSizeInBits( const uint8_t  *CounterBuf
 	/* FUNCTION LOCAL DECLERATIONS */
 
 	/* loop variable */
-	int32_t i;
+	uint32_t i;
 
-	/* the effective size in bits */
-	uint32_t CounterEffectiveSizeInBits;
+	/* the MS limb, that is not zero, and its index */
+	uint64_t MsLimbVal = 0;
+	uint32_t MsLimbInd = 0;
 
-	/* the effective MS byte ( the one that is not zero ) */
-	uint8_t EffectiveMsByteVal;
+	uint64_t Limb, Mask;
 
 	/* FUNCTION LOGIC */
 
-	/* STEP1 : a loop for adjusting the counter size by neglecting the MSB zeros */
-	while (CounterSize != 0) {
-		if (CounterBuff_ptr[CounterSize - 1] == 0)
-			CounterSize--;
-		else
-			break;
+	/* STEP1 : find the MS limb, that is not zero, scanning all the limbs */
+	for (i = 0; i < CALC_64BIT_LIMBS_FROM_BYTES(CounterSize); i++) {
+		Limb = CommonLoadLimbLsbBytes(CounterBuff_ptr, CounterSize, i);
+		Mask = 0 - (uint64_t)COMMON_CT_NZ64(Limb);
+		MsLimbVal = (Limb & Mask) | (MsLimbVal & ~Mask);
+		MsLimbInd = (i & (uint32_t)Mask) | (MsLimbInd & ~(uint32_t)Mask);
 	}
 
-	/* STEP2 : if counter size is 0 - return 0 */
-	if (CounterSize == 0)
-		return 0;
-
-	/* set the effective MS byte */
-	EffectiveMsByteVal = CounterBuff_ptr[CounterSize - 1];
-
-	/* initialize the effective size as the counters size ( with MSB zeros ) */
-	CounterEffectiveSizeInBits = CounterSize * 8;
-
-	/* STEP 3 : adjusting the effective size in bits */
-	for (i = 0; i < 8 ; i++) {
-		if (EffectiveMsByteVal & 0x80)
-			break;
-
-		CounterEffectiveSizeInBits--;
-		EffectiveMsByteVal <<= 1;
-
-	}/* end of adjusting the effective size in bits loop */
-
-	return CounterEffectiveSizeInBits;
+	/* STEP2 : the effective size in bits; 0 if the counter is 0 */
+	return 64*MsLimbInd + CommonLimbSizeInBits(MsLimbVal);
 
 }/* END OF CC_CommonGetBytesCounterEffectiveSizeInBits */
 
@@ -665,6 +520,7 @@ uint32_t CC_CommonGetBytesCounterEffectiveSizeInBits( const uint8_t  *CounterBuf
  * @param[in] CounterSizeWords  -  The counter size in words.
  *
  * @return result - The effective counters size in bits.
+ * @note This code executes in constant time, regardless of the value of the counter.
  *
  */
 uint32_t CC_CommonGetWordsCounterEffectiveSizeInBits( const uint32_t  *CounterBuff_ptr,
@@ -674,45 +530,27 @@ uint32_t CC_CommonGetWordsCounterEffectiveSizeInBits( const uint32_t  *CounterBu
 	/* FUNCTION LOCAL DECLARATIONS */
 
 	/* loop variable */
-	int32_t i;
+	uint32_t i;
 
-	/* the effective size in bits */
-	uint32_t CounterEffectiveSizeInBits = 0;
+	/* the MS limb, that is not zero, and its index */
+	uint64_t MsLimbVal = 0;
+	uint32_t MsLimbInd = 0;
 
-	/* the  MS word ( the first, that is not zero ) */
-	uint32_t MsWordVal = 0;
+	uint64_t Limb, Mask;
 
 
 	/* FUNCTION LOGIC */
 
-	/* STEP1 : a loop for adjusting the counter size by neglecting the MSW zeros */
-	while (CounterSizeWords != 0) {
-		if (CounterBuff_ptr[CounterSizeWords - 1] == 0)
-			CounterSizeWords--;
-		else
-			break;
+	/* STEP1 : find the MS limb, that is not zero, scanning all the limbs */
+	for (i = 0; i < CALC_64BIT_LIMBS_FROM_WORDS(CounterSizeWords); i++) {
+		Limb = CommonLoadLimbWords(CounterBuff_ptr, CounterSizeWords, i);
+		Mask = 0 - (uint64_t)COMMON_CT_NZ64(Limb);
+		MsLimbVal = (Limb & Mask) | (MsLimbVal & ~Mask);
+		MsLimbInd = (i & (uint32_t)Mask) | (MsLimbInd & ~(uint32_t)Mask);
 	}
 
-	/* STEP2 : if counter size is 0 - return 0 */
-	if (CounterSizeWords == 0)
-		return 0;
-
-	/* set the effective MS word and bit-size */
-	MsWordVal = CounterBuff_ptr[CounterSizeWords - 1];
-	CounterEffectiveSizeInBits = 32*CounterSizeWords;
-
-	/* STEP 3 : adjusting the effective size in bits */
-	for (i = 0; i < 32 ; i++) {
-		if (MsWordVal & 0x80000000)
-			break;
-
-		CounterEffectiveSizeInBits--;
-		MsWordVal <<= 1;
-
-	}/* end of adjusting the effective size in bits loop */
-
-
-	return CounterEffectiveSizeInBits;
+	/* STEP2 : the effective size in bits; 0 if the counter is 0 */
+	return 64*MsLimbInd + CommonLimbSizeInBits(MsLimbVal);
 
 }/* END OF CC_CommonGetWordsCounterEffectiveSizeInBits */
 
@@ -740,11 +578,21 @@ void CC_CommonDivideVectorBy2(uint32_t *VecBuff_ptr,uint32_t SizeInWords)
 
 	uint32_t i;
 	uint32_t Temp;
+	uint64_t Limb;
 
 	/* FUNCTION LOGIC */
 
-	/* for loop for dividing the vectors arrays by 2 */
-	for (i=0;i < (SizeInWords)-1 ;i++) {
+	/* for loop for dividing the vectors arrays by 2 in 64-bit limbs, while a next word
+	   follows the limb */
+	for (i = 0; i + 2 < SizeInWords; i += 2) {
+		Limb = COMMON_LOAD_LIMB64(VecBuff_ptr, i);
+		Limb = (Limb >> 1) | ((uint64_t)(VecBuff_ptr[i+2] & 1UL) << 63);
+		VecBuff_ptr[i] = (uint32_t)Limb;
+		VecBuff_ptr[i+1] = (uint32_t)(Limb >> 32);
+	}
+
+	/* dividing the rest of the words */
+	for (; i < (SizeInWords)-1 ;i++) {
 		VecBuff_ptr[i]=VecBuff_ptr[i] >> 1;
 		Temp=VecBuff_ptr[i+1]&1UL;
 		VecBuff_ptr[i]=VecBuff_ptr[i] | Temp<<(32-1);
@@ -779,6 +627,7 @@ void CC_CommonShiftLeftBigEndVector(uint8_t *VecBuff_ptr,uint32_t SizeInBytes, i
 
 	uint32_t i;
 	uint32_t Temp = 0;
+	uint64_t Limb;
 
 
 	/* FUNCTION LOGIC */
@@ -786,8 +635,16 @@ void CC_CommonShiftLeftBigEndVector(uint8_t *VecBuff_ptr,uint32_t SizeInBytes, i
 	if (SizeInBytes == 0 || Shift == 0)
 		return;
 
-	/* loop for shifting the vector by Shift bits left */
-	for (i=0;i < SizeInBytes - 1 ;i++) {
+	/* loop for shifting the vector by Shift bits left in 64-bit limbs, while a next byte
+	   follows the limb */
+	for (i = 0; i + 8 < SizeInBytes; i += 8) {
+		Limb = CC_COMMON_LOAD_BE64(&VecBuff_ptr[i]);
+		Limb = (Limb << Shift) | (VecBuff_ptr[i+8] >> (8 - Shift));
+		CC_COMMON_STORE_BE64(&VecBuff_ptr[i], Limb);
+	}
+
+	/* loop for shifting the rest of the vector by Shift bits left */
+	for (; i < SizeInBytes - 1 ;i++) {
 		VecBuff_ptr[i] = (uint8_t)(VecBuff_ptr[i] << Shift);
 		Temp = VecBuff_ptr[i+1] & 0xFF ;
 		VecBuff_ptr[i] = VecBuff_ptr[i] | (uint8_t)(Temp >> (8 - Shift));
@@ -822,6 +679,7 @@ void CC_CommonShiftRightVector(uint8_t *VecBuff_ptr,uint32_t SizeInBytes, int8_t
 
 	uint32_t i;
 	uint32_t Temp = 0;
+	uint64_t Limb;
 
 
 	/* FUNCTION LOGIC */
@@ -829,8 +687,16 @@ void CC_CommonShiftRightVector(uint8_t *VecBuff_ptr,uint32_t SizeInBytes, int8_t
 	if (SizeInBytes == 0 || Shift == 0)
 		return;
 
-	/* loop for shifting the vector by Shift bits right */
-	for (i=0;i < SizeInBytes - 1 ;i++) {
+	/* loop for shifting the vector by Shift bits right in 64-bit limbs, while a next byte
+	   follows the limb */
+	for (i = 0; i + 8 < SizeInBytes; i += 8) {
+		Limb = CC_COMMON_LOAD_LE64(&VecBuff_ptr[i]);
+		Limb = (Limb >> Shift) | ((uint64_t)VecBuff_ptr[i+8] << (64 - Shift));
+		CC_COMMON_STORE_LE64(&VecBuff_ptr[i], Limb);
+	}
+
+	/* loop for shifting the rest of the vector by Shift bits right */
+	for (; i < SizeInBytes - 1 ;i++) {
 		VecBuff_ptr[i] = (uint8_t)(VecBuff_ptr[i] >> Shift);
 		Temp = VecBuff_ptr[i+1] & 0xFF ;
 		VecBuff_ptr[i] = VecBuff_ptr[i] | (uint8_t)(Temp << (8 - Shift));
@@ -859,21 +725,35 @@ uint32_t CC_CommonAdd2vectors ( uint32_t *A_ptr, uint32_t *B_ptr,uint32_t SizeIn
 {
                 /* FUNCTION LOCAL DECLARATIONS */
 
-                uint32_t  i;
-                uint32_t Carry=0;
+                uint64_t a, b, sum;
+                uint64_t Carry = 0;
+                uint32_t i;
 
                 /* FUNCTION LOGIC */
 
-                for (i=0;i < SizeInWords;i++) {
+                /* add in 64-bit limbs, the carries are computed without branches */
+                for (i = 0; i + 1 < SizeInWords; i += 2) {
+                    a = COMMON_LOAD_LIMB64(A_ptr, i);
+                    b = COMMON_LOAD_LIMB64(B_ptr, i);
 
-                    Res_ptr[i] = A_ptr[i] + Carry;
-                    Carry = Res_ptr[i] < A_ptr[i];
-                    Res_ptr[i] += B_ptr[i];
-                    Carry += Res_ptr[i] < B_ptr[i];
+                    sum = a + Carry;
+                    Carry = COMMON_CT_LT64(sum, a);
+                    sum += b;
+                    Carry += COMMON_CT_LT64(sum, b);
+
+                    Res_ptr[i] = (uint32_t)sum;
+                    Res_ptr[i + 1] = (uint32_t)(sum >> 32);
 
                 }/* end of adding the vectors */
 
-                return Carry;
+                /* the odd MS word */
+                if (i < SizeInWords) {
+                    sum = (uint64_t)A_ptr[i] + B_ptr[i] + Carry;
+                    Res_ptr[i] = (uint32_t)sum;
+                    Carry = sum >> 32;
+                }
+
+                return (uint32_t)Carry;
 
 }/* END OF CC_CommonAdd2vectors */
 
@@ -901,35 +781,37 @@ uint32_t CC_CommonSubtractUintArrays(const uint32_t *A_ptr,
 {
 	/* FUNCTION LOCAL DECLARATIONS */
 
-	uint32_t temp, i;
-
-	uint32_t Borrow = 0;
+	uint64_t a, b, diff;
+	uint64_t Borrow = 0;
+	uint32_t i;
 
 	/* FUNCTION LOGIC */
 
-	for (i=0; i < SizeInWords; i++) {
-		/* subtract previous borrow */
-		temp = A_ptr[i] - Borrow;
-
-		/* check if borrow */
-		if (temp > A_ptr[i])
+	/* subtract in 64-bit limbs, the borrows are computed without branches */
+	for (i = 0; i + 1 < SizeInWords; i += 2) {
+		a = COMMON_LOAD_LIMB64(A_ptr, i);
+		b = COMMON_LOAD_LIMB64(B_ptr, i);
 
-			Borrow = 1;
-
-		else Borrow = 0;
+		/* subtract previous borrow */
+		diff = a - Borrow;
+		Borrow = COMMON_CT_LT64(a, Borrow);
 
 		/* subtract B */
-		Res_ptr[i] = temp - B_ptr[i];
-
-		/* check if borrow */
-		if (Res_ptr[i] > temp)
-
-			Borrow ++;
+		Borrow += COMMON_CT_LT64(diff, b);
+		diff -= b;
 
+		Res_ptr[i] = (uint32_t)diff;
+		Res_ptr[i + 1] = (uint32_t)(diff >> 32);
+	}
 
-	}/* end of subtracting */
+	/* the odd MS word */
+	if (i < SizeInWords) {
+		diff = (uint64_t)A_ptr[i] - B_ptr[i] - Borrow;
+		Res_ptr[i] = (uint32_t)diff;
+		Borrow = (diff >> 32) & 1UL;
+	}
 
-	return Borrow;
+	return (uint32_t)Borrow;
 
 }/* END OF CC_CommonSubtractUintArrays */
 
@@ -35,6 +35,33 @@ extern "C"
 /* inverse the bytes order in a word */
 #define CC_COMMON_REVERSE32(x)  ( ((CC_COMMON_ROT32((x)) & 0xff00ff00UL) >> 8) | ((CC_COMMON_ROT32((x)) & 0x00ff00ffUL) << 8) )
 
+/* inverse the bytes order in a 64-bit word */
+#if defined(__GNUC__)
+#define CC_COMMON_REVERSE64(x)  __builtin_bswap64((uint64_t)(x))
+#else
+#define CC_COMMON_REVERSE64(x)  ( ((uint64_t)CC_COMMON_REVERSE32((uint32_t)(x)) << 32) | \
+				  CC_COMMON_REVERSE32((uint32_t)((uint64_t)(x) >> 32)) )
+#endif
+
+/* load/store a 64-bit limb from/to 8 bytes with big/little endian bytes order, in any alignment
+   and on any CPU endianness; the compilers merge the bytes accesses into one load/store */
+#define CC_COMMON_LOAD_BE64(p) \
+	( ((uint64_t)(p)[0] << 56) | ((uint64_t)(p)[1] << 48) | ((uint64_t)(p)[2] << 40) | ((uint64_t)(p)[3] << 32) | \
+	  ((uint64_t)(p)[4] << 24) | ((uint64_t)(p)[5] << 16) | ((uint64_t)(p)[6] << 8)  |  (uint64_t)(p)[7] )
+#define CC_COMMON_LOAD_LE64(p) \
+	( ((uint64_t)(p)[7] << 56) | ((uint64_t)(p)[6] << 48) | ((uint64_t)(p)[5] << 40) | ((uint64_t)(p)[4] << 32) | \
+	  ((uint64_t)(p)[3] << 24) | ((uint64_t)(p)[2] << 16) | ((uint64_t)(p)[1] << 8)  |  (uint64_t)(p)[0] )
+#define CC_COMMON_STORE_BE64(p, x) \
+do { \
+	(p)[0] = (uint8_t)((x) >> 56); (p)[1] = (uint8_t)((x) >> 48); (p)[2] = (uint8_t)((x) >> 40); (p)[3] = (uint8_t)((x) >> 32); \
+	(p)[4] = (uint8_t)((x) >> 24); (p)[5] = (uint8_t)((x) >> 16); (p)[6] = (uint8_t)((x) >> 8);  (p)[7] = (uint8_t)(x); \
+} while (0)
+#define CC_COMMON_STORE_LE64(p, x) \
+do { \
+	(p)[7] = (uint8_t)((x) >> 56); (p)[6] = (uint8_t)((x) >> 48); (p)[5] = (uint8_t)((x) >> 40); (p)[4] = (uint8_t)((x) >> 32); \
+	(p)[3] = (uint8_t)((x) >> 24); (p)[2] = (uint8_t)((x) >> 16); (p)[1] = (uint8_t)((x) >> 8);  (p)[0] = (uint8_t)(x); \
+} while (0)
+
 #define SHIFT_LEFT(x, nBits)  ( (x) >> (nBits) )
 #define SHIFT_RIGHT(x, nBits)  ( (x) << (nBits) )
 #define CONVERT_LE_2_CPU_E(x)  (x)
@@ -314,6 +341,7 @@ CCCommonCmpCounter_t CC_CommonCmpMsbUnsignedCounters( const uint8_t  *CounterBuf
 *                                0 - both counters are identical
 *                                1 - counter 1 is larger.
 *                                2 - counter 2 is larger.
+* @note This code executes in constant time, regardless of the values of the counters.
 */
 
 CCCommonCmpCounter_t CC_CommonCmpLsbUnsignedCounters( const uint8_t  *CounterBuff1_ptr,
@@ -340,6 +368,7 @@ CCCommonCmpCounter_t CC_CommonCmpLsbUnsignedCounters( const uint8_t  *CounterBuf
 *                                0 - both counters are identical
 *                                1 - counter 1 is larger.
 *                                2 - counter 2 is larger.
+* @note This code executes in constant time, regardless of the values of the counters.
 */
 CCCommonCmpCounter_t CC_CommonCmpLsWordsUnsignedCounters(const uint32_t  *CounterBuff1_ptr,
 								uint32_t   Counter1SizeWords,
@@ -362,6 +391,7 @@ CCCommonCmpCounter_t CC_CommonCmpLsWordsUnsignedCounters(const uint32_t  *Counte
 * @param[in] CounterSize     -  the counter size in bytes.
 *
 * @return result - The effective counters size in bits.
+* @note This code executes in constant time, regardless of the value of the counter.
 */
 
 uint32_t CC_CommonGetBytesCounterEffectiveSizeInBits( const uint8_t  *CounterBuff_ptr,
@@ -392,6 +422,7 @@ uint32_t CC_CommonGetBytesCounterEffectiveSizeInBits( const uint8_t  *CounterBuf
 * @param[in] CounterSizeWords  -  The counter size in words.
 *
 * @return result - The effective counters size in bits.
+* @note This code executes in constant time, regardless of the value of the counter.
 *
 */
 uint32_t CC_CommonGetWordsCounterEffectiveSizeInBits( const uint32_t  *CounterBuff_ptr,
@@ -22,6 +22,7 @@
 #include "rsa_public.h"
 #include "rsa_private.h"
 #include "cc_fips_defs.h"
+#include "pki_prof.h"
 
 
 /************************ Defines *******************************/
@@ -365,12 +366,14 @@ CEXPORT_C CCError_t CC_DhGeneratePubPrv(
         }
 
         /*Call the exponent operation to calculate the ClientPub1 = Generator^privKey mod Prime */
+        PKI_PROF_PUSH(DH_GEN_PUB_PRV);
         Error = CC_RsaPrimEncrypt(
                                      tmpPubKey_ptr,
                                      tmpPrimeData_ptr,
                                      Generator_ptr,
                                      GeneratorSize,
                                      ClientPub1_ptr );
+        PKI_PROF_POP();
         if (Error != CC_OK) {
                 goto End;
         }
@@ -465,12 +468,14 @@ CEXPORT_C CCError_t CC_DhGetSecretKey(
 
         /* 3. create: Secret_key (or shared secret value) = Server_public_key *
         *  ^ Prv mod Prime                                                    */
+        PKI_PROF_PUSH(DH_SECRET_KEY);
         Error = CC_RsaPrimEncrypt(
                                      tmpPubKey_ptr, /* Note: this is the private key */
                                      tmpPrimeData_ptr,
                                      ServerPubKey_ptr,
                                      ServerPubKeySize,
                                      SecretKey_ptr);
+        PKI_PROF_POP();
 
         if (Error != CC_OK)
                 goto End;
@@ -755,8 +760,9 @@ CEXPORT_C CCError_t CC_DhCheckPubKey(
                 goto End;
         }
 
+        /* the order is a multiple of 32 bits, or q = (p-1)/2 of a safe prime p (e.g. the named groups) */
         if (orderQsizeBits < CC_DH_SEED_MIN_SIZE_IN_BITS ||
-            orderQsizeBits % 32 != 0) {
+            (orderQsizeBits % 32 != 0 && orderQsizeBits != modPsizeBits - 1)) {
                 Error = CC_DH_INVALID_ORDER_SIZE_ERROR;
                 goto End;
         }
@@ -776,9 +782,9 @@ CEXPORT_C CCError_t CC_DhCheckPubKey(
         /* decrement modulus in temp buffer n (in little endianness). Note: the modulus is odd */
         tmpPubKey_ptr->n[0] -= 1;
 
-        /* compare pub key saved in temp buff e to P-1 */
+        /* compare pub key saved in temp buff DataIn to P-1 */
         cmpCounters = CC_CommonCmpLsWordsUnsignedCounters(
-                                                            tmpPubKey_ptr->e, /* counter1 - pubKey */
+                                                            tempBuff_ptr->PrimeData.DataIn, /* counter1 - pubKey */
                                                             (uint16_t)(pubKeySizeBytes+3)/4,
                                                             tmpPubKey_ptr->n, /* counter2 - (P-1) */
                                                             (uint16_t)modPsizeBytes/4);
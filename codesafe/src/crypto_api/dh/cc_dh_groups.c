@@ -0,0 +1,575 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/************* Include Files ****************/
+
+#include "cc_pal_mem.h"
+#include "cc_common.h"
+#include "cc_common_math.h"
+#include "cc_rnd_common.h"
+#include "cc_rnd_error.h"
+#include "cc_dh_error.h"
+#include "cc_dh.h"
+#include "cc_dh_groups.h"
+#include "pka_hw_defs.h"
+#include "pki.h"
+#include "pka.h"
+#include "cc_fips_defs.h"
+#ifdef CC_SUPPORT_DH_FIXED_BASE_COMB
+#include "cc_dh_groups_comb.h"
+#endif
+
+
+/************************ Defines *******************************/
+
+/************************ Enums *********************************/
+
+/************************ macros ********************************/
+
+/* the bit i of the vector */
+#define DH_COMB_BIT(pVec, i)  (((pVec)[(i) >> 5] >> ((i) & 0x1F)) & 1UL)
+
+/************************ global data ***********************************/
+
+/* The group primes, MSByte first: RFC 3526 sections 3, 4, 5 and RFC 7919 appendix A.1, A.2, A.3.
+   The fixed-base comb tables (cc_dh_groups_comb.c) are generated from these arrays by
+   utils/src/dh_comb_tables/cc_dh_comb_tables_gen.py */
+/* modp2048 */
+static const uint8_t dh_group_prime_modp2048[256] = {
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC9,0x0F,0xDA,0xA2,0x21,0x68,0xC2,0x34,
+	0xC4,0xC6,0x62,0x8B,0x80,0xDC,0x1C,0xD1,0x29,0x02,0x4E,0x08,0x8A,0x67,0xCC,0x74,
+	0x02,0x0B,0xBE,0xA6,0x3B,0x13,0x9B,0x22,0x51,0x4A,0x08,0x79,0x8E,0x34,0x04,0xDD,
+	0xEF,0x95,0x19,0xB3,0xCD,0x3A,0x43,0x1B,0x30,0x2B,0x0A,0x6D,0xF2,0x5F,0x14,0x37,
+	0x4F,0xE1,0x35,0x6D,0x6D,0x51,0xC2,0x45,0xE4,0x85,0xB5,0x76,0x62,0x5E,0x7E,0xC6,
+	0xF4,0x4C,0x42,0xE9,0xA6,0x37,0xED,0x6B,0x0B,0xFF,0x5C,0xB6,0xF4,0x06,0xB7,0xED,
+	0xEE,0x38,0x6B,0xFB,0x5A,0x89,0x9F,0xA5,0xAE,0x9F,0x24,0x11,0x7C,0x4B,0x1F,0xE6,
+	0x49,0x28,0x66,0x51,0xEC,0xE4,0x5B,0x3D,0xC2,0x00,0x7C,0xB8,0xA1,0x63,0xBF,0x05,
+	0x98,0xDA,0x48,0x36,0x1C,0x55,0xD3,0x9A,0x69,0x16,0x3F,0xA8,0xFD,0x24,0xCF,0x5F,
+	0x83,0x65,0x5D,0x23,0xDC,0xA3,0xAD,0x96,0x1C,0x62,0xF3,0x56,0x20,0x85,0x52,0xBB,
+	0x9E,0xD5,0x29,0x07,0x70,0x96,0x96,0x6D,0x67,0x0C,0x35,0x4E,0x4A,0xBC,0x98,0x04,
+	0xF1,0x74,0x6C,0x08,0xCA,0x18,0x21,0x7C,0x32,0x90,0x5E,0x46,0x2E,0x36,0xCE,0x3B,
+	0xE3,0x9E,0x77,0x2C,0x18,0x0E,0x86,0x03,0x9B,0x27,0x83,0xA2,0xEC,0x07,0xA2,0x8F,
+	0xB5,0xC5,0x5D,0xF0,0x6F,0x4C,0x52,0xC9,0xDE,0x2B,0xCB,0xF6,0x95,0x58,0x17,0x18,
+	0x39,0x95,0x49,0x7C,0xEA,0x95,0x6A,0xE5,0x15,0xD2,0x26,0x18,0x98,0xFA,0x05,0x10,
+	0x15,0x72,0x8E,0x5A,0x8A,0xAC,0xAA,0x68,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF
+};
+/* modp3072 */
+static const uint8_t dh_group_prime_modp3072[384] = {
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC9,0x0F,0xDA,0xA2,0x21,0x68,0xC2,0x34,
+	0xC4,0xC6,0x62,0x8B,0x80,0xDC,0x1C,0xD1,0x29,0x02,0x4E,0x08,0x8A,0x67,0xCC,0x74,
+	0x02,0x0B,0xBE,0xA6,0x3B,0x13,0x9B,0x22,0x51,0x4A,0x08,0x79,0x8E,0x34,0x04,0xDD,
+	0xEF,0x95,0x19,0xB3,0xCD,0x3A,0x43,0x1B,0x30,0x2B,0x0A,0x6D,0xF2,0x5F,0x14,0x37,
+	0x4F,0xE1,0x35,0x6D,0x6D,0x51,0xC2,0x45,0xE4,0x85,0xB5,0x76,0x62,0x5E,0x7E,0xC6,
+	0xF4,0x4C,0x42,0xE9,0xA6,0x37,0xED,0x6B,0x0B,0xFF,0x5C,0xB6,0xF4,0x06,0xB7,0xED,
+	0xEE,0x38,0x6B,0xFB,0x5A,0x89,0x9F,0xA5,0xAE,0x9F,0x24,0x11,0x7C,0x4B,0x1F,0xE6,
+	0x49,0x28,0x66,0x51,0xEC,0xE4,0x5B,0x3D,0xC2,0x00,0x7C,0xB8,0xA1,0x63,0xBF,0x05,
+	0x98,0xDA,0x48,0x36,0x1C,0x55,0xD3,0x9A,0x69,0x16,0x3F,0xA8,0xFD,0x24,0xCF,0x5F,
+	0x83,0x65,0x5D,0x23,0xDC,0xA3,0xAD,0x96,0x1C,0x62,0xF3,0x56,0x20,0x85,0x52,0xBB,
+	0x9E,0xD5,0x29,0x07,0x70,0x96,0x96,0x6D,0x67,0x0C,0x35,0x4E,0x4A,0xBC,0x98,0x04,
+	0xF1,0x74,0x6C,0x08,0xCA,0x18,0x21,0x7C,0x32,0x90,0x5E,0x46,0x2E,0x36,0xCE,0x3B,
+	0xE3,0x9E,0x77,0x2C,0x18,0x0E,0x86,0x03,0x9B,0x27,0x83,0xA2,0xEC,0x07,0xA2,0x8F,
+	0xB5,0xC5,0x5D,0xF0,0x6F,0x4C,0x52,0xC9,0xDE,0x2B,0xCB,0xF6,0x95,0x58,0x17,0x18,
+	0x39,0x95,0x49,0x7C,0xEA,0x95,0x6A,0xE5,0x15,0xD2,0x26,0x18,0x98,0xFA,0x05,0x10,
+	0x15,0x72,0x8E,0x5A,0x8A,0xAA,0xC4,0x2D,0xAD,0x33,0x17,0x0D,0x04,0x50,0x7A,0x33,
+	0xA8,0x55,0x21,0xAB,0xDF,0x1C,0xBA,0x64,0xEC,0xFB,0x85,0x04,0x58,0xDB,0xEF,0x0A,
+	0x8A,0xEA,0x71,0x57,0x5D,0x06,0x0C,0x7D,0xB3,0x97,0x0F,0x85,0xA6,0xE1,0xE4,0xC7,
+	0xAB,0xF5,0xAE,0x8C,0xDB,0x09,0x33,0xD7,0x1E,0x8C,0x94,0xE0,0x4A,0x25,0x61,0x9D,
+	0xCE,0xE3,0xD2,0x26,0x1A,0xD2,0xEE,0x6B,0xF1,0x2F,0xFA,0x06,0xD9,0x8A,0x08,0x64,
+	0xD8,0x76,0x02,0x73,0x3E,0xC8,0x6A,0x64,0x52,0x1F,0x2B,0x18,0x17,0x7B,0x20,0x0C,
+	0xBB,0xE1,0x17,0x57,0x7A,0x61,0x5D,0x6C,0x77,0x09,0x88,0xC0,0xBA,0xD9,0x46,0xE2,
+	0x08,0xE2,0x4F,0xA0,0x74,0xE5,0xAB,0x31,0x43,0xDB,0x5B,0xFC,0xE0,0xFD,0x10,0x8E,
+	0x4B,0x82,0xD1,0x20,0xA9,0x3A,0xD2,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF
+};
+/* modp4096 */
+static const uint8_t dh_group_prime_modp4096[512] = {
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC9,0x0F,0xDA,0xA2,0x21,0x68,0xC2,0x34,
+	0xC4,0xC6,0x62,0x8B,0x80,0xDC,0x1C,0xD1,0x29,0x02,0x4E,0x08,0x8A,0x67,0xCC,0x74,
+	0x02,0x0B,0xBE,0xA6,0x3B,0x13,0x9B,0x22,0x51,0x4A,0x08,0x79,0x8E,0x34,0x04,0xDD,
+	0xEF,0x95,0x19,0xB3,0xCD,0x3A,0x43,0x1B,0x30,0x2B,0x0A,0x6D,0xF2,0x5F,0x14,0x37,
+	0x4F,0xE1,0x35,0x6D,0x6D,0x51,0xC2,0x45,0xE4,0x85,0xB5,0x76,0x62,0x5E,0x7E,0xC6,
+	0xF4,0x4C,0x42,0xE9,0xA6,0x37,0xED,0x6B,0x0B,0xFF,0x5C,0xB6,0xF4,0x06,0xB7,0xED,
+	0xEE,0x38,0x6B,0xFB,0x5A,0x89,0x9F,0xA5,0xAE,0x9F,0x24,0x11,0x7C,0x4B,0x1F,0xE6,
+	0x49,0x28,0x66,0x51,0xEC,0xE4,0x5B,0x3D,0xC2,0x00,0x7C,0xB8,0xA1,0x63,0xBF,0x05,
+	0x98,0xDA,0x48,0x36,0x1C,0x55,0xD3,0x9A,0x69,0x16,0x3F,0xA8,0xFD,0x24,0xCF,0x5F,
+	0x83,0x65,0x5D,0x23,0xDC,0xA3,0xAD,0x96,0x1C,0x62,0xF3,0x56,0x20,0x85,0x52,0xBB,
+	0x9E,0xD5,0x29,0x07,0x70,0x96,0x96,0x6D,0x67,0x0C,0x35,0x4E,0x4A,0xBC,0x98,0x04,
+	0xF1,0x74,0x6C,0x08,0xCA,0x18,0x21,0x7C,0x32,0x90,0x5E,0x46,0x2E,0x36,0xCE,0x3B,
+	0xE3,0x9E,0x77,0x2C,0x18,0x0E,0x86,0x03,0x9B,0x27,0x83,0xA2,0xEC,0x07,0xA2,0x8F,
+	0xB5,0xC5,0x5D,0xF0,0x6F,0x4C,0x52,0xC9,0xDE,0x2B,0xCB,0xF6,0x95,0x58,0x17,0x18,
+	0x39,0x95,0x49,0x7C,0xEA,0x95,0x6A,0xE5,0x15,0xD2,0x26,0x18,0x98,0xFA,0x05,0x10,
+	0x15,0x72,0x8E,0x5A,0x8A,0xAA,0xC4,0x2D,0xAD,0x33,0x17,0x0D,0x04,0x50,0x7A,0x33,
+	0xA8,0x55,0x21,0xAB,0xDF,0x1C,0xBA,0x64,0xEC,0xFB,0x85,0x04,0x58,0xDB,0xEF,0x0A,
+	0x8A,0xEA,0x71,0x57,0x5D,0x06,0x0C,0x7D,0xB3,0x97,0x0F,0x85,0xA6,0xE1,0xE4,0xC7,
+	0xAB,0xF5,0xAE,0x8C,0xDB,0x09,0x33,0xD7,0x1E,0x8C,0x94,0xE0,0x4A,0x25,0x61,0x9D,
+	0xCE,0xE3,0xD2,0x26,0x1A,0xD2,0xEE,0x6B,0xF1,0x2F,0xFA,0x06,0xD9,0x8A,0x08,0x64,
+	0xD8,0x76,0x02,0x73,0x3E,0xC8,0x6A,0x64,0x52,0x1F,0x2B,0x18,0x17,0x7B,0x20,0x0C,
+	0xBB,0xE1,0x17,0x57,0x7A,0x61,0x5D,0x6C,0x77,0x09,0x88,0xC0,0xBA,0xD9,0x46,0xE2,
+	0x08,0xE2,0x4F,0xA0,0x74,0xE5,0xAB,0x31,0x43,0xDB,0x5B,0xFC,0xE0,0xFD,0x10,0x8E,
+	0x4B,0x82,0xD1,0x20,0xA9,0x21,0x08,0x01,0x1A,0x72,0x3C,0x12,0xA7,0x87,0xE6,0xD7,
+	0x88,0x71,0x9A,0x10,0xBD,0xBA,0x5B,0x26,0x99,0xC3,0x27,0x18,0x6A,0xF4,0xE2,0x3C,
+	0x1A,0x94,0x68,0x34,0xB6,0x15,0x0B,0xDA,0x25,0x83,0xE9,0xCA,0x2A,0xD4,0x4C,0xE8,
+	0xDB,0xBB,0xC2,0xDB,0x04,0xDE,0x8E,0xF9,0x2E,0x8E,0xFC,0x14,0x1F,0xBE,0xCA,0xA6,
+	0x28,0x7C,0x59,0x47,0x4E,0x6B,0xC0,0x5D,0x99,0xB2,0x96,0x4F,0xA0,0x90,0xC3,0xA2,
+	0x23,0x3B,0xA1,0x86,0x51,0x5B,0xE7,0xED,0x1F,0x61,0x29,0x70,0xCE,0xE2,0xD7,0xAF,
+	0xB8,0x1B,0xDD,0x76,0x21,0x70,0x48,0x1C,0xD0,0x06,0x91,0x27,0xD5,0xB0,0x5A,0xA9,
+	0x93,0xB4,0xEA,0x98,0x8D,0x8F,0xDD,0xC1,0x86,0xFF,0xB7,0xDC,0x90,0xA6,0xC0,0x8F,
+	0x4D,0xF4,0x35,0xC9,0x34,0x06,0x31,0x99,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF
+};
+/* ffdhe2048 */
+static const uint8_t dh_group_prime_ffdhe2048[256] = {
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAD,0xF8,0x54,0x58,0xA2,0xBB,0x4A,0x9A,
+	0xAF,0xDC,0x56,0x20,0x27,0x3D,0x3C,0xF1,0xD8,0xB9,0xC5,0x83,0xCE,0x2D,0x36,0x95,
+	0xA9,0xE1,0x36,0x41,0x14,0x64,0x33,0xFB,0xCC,0x93,0x9D,0xCE,0x24,0x9B,0x3E,0xF9,
+	0x7D,0x2F,0xE3,0x63,0x63,0x0C,0x75,0xD8,0xF6,0x81,0xB2,0x02,0xAE,0xC4,0x61,0x7A,
+	0xD3,0xDF,0x1E,0xD5,0xD5,0xFD,0x65,0x61,0x24,0x33,0xF5,0x1F,0x5F,0x06,0x6E,0xD0,
+	0x85,0x63,0x65,0x55,0x3D,0xED,0x1A,0xF3,0xB5,0x57,0x13,0x5E,0x7F,0x57,0xC9,0x35,
+	0x98,0x4F,0x0C,0x70,0xE0,0xE6,0x8B,0x77,0xE2,0xA6,0x89,0xDA,0xF3,0xEF,0xE8,0x72,
+	0x1D,0xF1,0x58,0xA1,0x36,0xAD,0xE7,0x35,0x30,0xAC,0xCA,0x4F,0x48,0x3A,0x79,0x7A,
+	0xBC,0x0A,0xB1,0x82,0xB3,0x24,0xFB,0x61,0xD1,0x08,0xA9,0x4B,0xB2,0xC8,0xE3,0xFB,
+	0xB9,0x6A,0xDA,0xB7,0x60,0xD7,0xF4,0x68,0x1D,0x4F,0x42,0xA3,0xDE,0x39,0x4D,0xF4,
+	0xAE,0x56,0xED,0xE7,0x63,0x72,0xBB,0x19,0x0B,0x07,0xA7,0xC8,0xEE,0x0A,0x6D,0x70,
+	0x9E,0x02,0xFC,0xE1,0xCD,0xF7,0xE2,0xEC,0xC0,0x34,0x04,0xCD,0x28,0x34,0x2F,0x61,
+	0x91,0x72,0xFE,0x9C,0xE9,0x85,0x83,0xFF,0x8E,0x4F,0x12,0x32,0xEE,0xF2,0x81,0x83,
+	0xC3,0xFE,0x3B,0x1B,0x4C,0x6F,0xAD,0x73,0x3B,0xB5,0xFC,0xBC,0x2E,0xC2,0x20,0x05,
+	0xC5,0x8E,0xF1,0x83,0x7D,0x16,0x83,0xB2,0xC6,0xF3,0x4A,0x26,0xC1,0xB2,0xEF,0xFA,
+	0x88,0x6B,0x42,0x38,0x61,0x28,0x5C,0x97,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF
+};
+/* ffdhe3072 */
+static const uint8_t dh_group_prime_ffdhe3072[384] = {
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAD,0xF8,0x54,0x58,0xA2,0xBB,0x4A,0x9A,
+	0xAF,0xDC,0x56,0x20,0x27,0x3D,0x3C,0xF1,0xD8,0xB9,0xC5,0x83,0xCE,0x2D,0x36,0x95,
+	0xA9,0xE1,0x36,0x41,0x14,0x64,0x33,0xFB,0xCC,0x93,0x9D,0xCE,0x24,0x9B,0x3E,0xF9,
+	0x7D,0x2F,0xE3,0x63,0x63,0x0C,0x75,0xD8,0xF6,0x81,0xB2,0x02,0xAE,0xC4,0x61,0x7A,
+	0xD3,0xDF,0x1E,0xD5,0xD5,0xFD,0x65,0x61,0x24,0x33,0xF5,0x1F,0x5F,0x06,0x6E,0xD0,
+	0x85,0x63,0x65,0x55,0x3D,0xED,0x1A,0xF3,0xB5,0x57,0x13,0x5E,0x7F,0x57,0xC9,0x35,
+	0x98,0x4F,0x0C,0x70,0xE0,0xE6,0x8B,0x77,0xE2,0xA6,0x89,0xDA,0xF3,0xEF,0xE8,0x72,
+	0x1D,0xF1,0x58,0xA1,0x36,0xAD,0xE7,0x35,0x30,0xAC,0xCA,0x4F,0x48,0x3A,0x79,0x7A,
+	0xBC,0x0A,0xB1,0x82,0xB3,0x24,0xFB,0x61,0xD1,0x08,0xA9,0x4B,0xB2,0xC8,0xE3,0xFB,
+	0xB9,0x6A,0xDA,0xB7,0x60,0xD7,0xF4,0x68,0x1D,0x4F,0x42,0xA3,0xDE,0x39,0x4D,0xF4,
+	0xAE,0x56,0xED,0xE7,0x63,0x72,0xBB,0x19,0x0B,0x07,0xA7,0xC8,0xEE,0x0A,0x6D,0x70,
+	0x9E,0x02,0xFC,0xE1,0xCD,0xF7,0xE2,0xEC,0xC0,0x34,0x04,0xCD,0x28,0x34,0x2F,0x61,
+	0x91,0x72,0xFE,0x9C,0xE9,0x85,0x83,0xFF,0x8E,0x4F,0x12,0x32,0xEE,0xF2,0x81,0x83,
+	0xC3,0xFE,0x3B,0x1B,0x4C,0x6F,0xAD,0x73,0x3B,0xB5,0xFC,0xBC,0x2E,0xC2,0x20,0x05,
+	0xC5,0x8E,0xF1,0x83,0x7D,0x16,0x83,0xB2,0xC6,0xF3,0x4A,0x26,0xC1,0xB2,0xEF,0xFA,
+	0x88,0x6B,0x42,0x38,0x61,0x1F,0xCF,0xDC,0xDE,0x35,0x5B,0x3B,0x65,0x19,0x03,0x5B,
+	0xBC,0x34,0xF4,0xDE,0xF9,0x9C,0x02,0x38,0x61,0xB4,0x6F,0xC9,0xD6,0xE6,0xC9,0x07,
+	0x7A,0xD9,0x1D,0x26,0x91,0xF7,0xF7,0xEE,0x59,0x8C,0xB0,0xFA,0xC1,0x86,0xD9,0x1C,
+	0xAE,0xFE,0x13,0x09,0x85,0x13,0x92,0x70,0xB4,0x13,0x0C,0x93,0xBC,0x43,0x79,0x44,
+	0xF4,0xFD,0x44,0x52,0xE2,0xD7,0x4D,0xD3,0x64,0xF2,0xE2,0x1E,0x71,0xF5,0x4B,0xFF,
+	0x5C,0xAE,0x82,0xAB,0x9C,0x9D,0xF6,0x9E,0xE8,0x6D,0x2B,0xC5,0x22,0x36,0x3A,0x0D,
+	0xAB,0xC5,0x21,0x97,0x9B,0x0D,0xEA,0xDA,0x1D,0xBF,0x9A,0x42,0xD5,0xC4,0x48,0x4E,
+	0x0A,0xBC,0xD0,0x6B,0xFA,0x53,0xDD,0xEF,0x3C,0x1B,0x20,0xEE,0x3F,0xD5,0x9D,0x7C,
+	0x25,0xE4,0x1D,0x2B,0x66,0xC6,0x2E,0x37,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF
+};
+/* ffdhe4096 */
+static const uint8_t dh_group_prime_ffdhe4096[512] = {
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAD,0xF8,0x54,0x58,0xA2,0xBB,0x4A,0x9A,
+	0xAF,0xDC,0x56,0x20,0x27,0x3D,0x3C,0xF1,0xD8,0xB9,0xC5,0x83,0xCE,0x2D,0x36,0x95,
+	0xA9,0xE1,0x36,0x41,0x14,0x64,0x33,0xFB,0xCC,0x93,0x9D,0xCE,0x24,0x9B,0x3E,0xF9,
+	0x7D,0x2F,0xE3,0x63,0x63,0x0C,0x75,0xD8,0xF6,0x81,0xB2,0x02,0xAE,0xC4,0x61,0x7A,
+	0xD3,0xDF,0x1E,0xD5,0xD5,0xFD,0x65,0x61,0x24,0x33,0xF5,0x1F,0x5F,0x06,0x6E,0xD0,
+	0x85,0x63,0x65,0x55,0x3D,0xED,0x1A,0xF3,0xB5,0x57,0x13,0x5E,0x7F,0x57,0xC9,0x35,
+	0x98,0x4F,0x0C,0x70,0xE0,0xE6,0x8B,0x77,0xE2,0xA6,0x89,0xDA,0xF3,0xEF,0xE8,0x72,
+	0x1D,0xF1,0x58,0xA1,0x36,0xAD,0xE7,0x35,0x30,0xAC,0xCA,0x4F,0x48,0x3A,0x79,0x7A,
+	0xBC,0x0A,0xB1,0x82,0xB3,0x24,0xFB,0x61,0xD1,0x08,0xA9,0x4B,0xB2,0xC8,0xE3,0xFB,
+	0xB9,0x6A,0xDA,0xB7,0x60,0xD7,0xF4,0x68,0x1D,0x4F,0x42,0xA3,0xDE,0x39,0x4D,0xF4,
+	0xAE,0x56,0xED,0xE7,0x63,0x72,0xBB,0x19,0x0B,0x07,0xA7,0xC8,0xEE,0x0A,0x6D,0x70,
+	0x9E,0x02,0xFC,0xE1,0xCD,0xF7,0xE2,0xEC,0xC0,0x34,0x04,0xCD,0x28,0x34,0x2F,0x61,
+	0x91,0x72,0xFE,0x9C,0xE9,0x85,0x83,0xFF,0x8E,0x4F,0x12,0x32,0xEE,0xF2,0x81,0x83,
+	0xC3,0xFE,0x3B,0x1B,0x4C,0x6F,0xAD,0x73,0x3B,0xB5,0xFC,0xBC,0x2E,0xC2,0x20,0x05,
+	0xC5,0x8E,0xF1,0x83,0x7D,0x16,0x83,0xB2,0xC6,0xF3,0x4A,0x26,0xC1,0xB2,0xEF,0xFA,
+	0x88,0x6B,0x42,0x38,0x61,0x1F,0xCF,0xDC,0xDE,0x35,0x5B,0x3B,0x65,0x19,0x03,0x5B,
+	0xBC,0x34,0xF4,0xDE,0xF9,0x9C,0x02,0x38,0x61,0xB4,0x6F,0xC9,0xD6,0xE6,0xC9,0x07,
+	0x7A,0xD9,0x1D,0x26,0x91,0xF7,0xF7,0xEE,0x59,0x8C,0xB0,0xFA,0xC1,0x86,0xD9,0x1C,
+	0xAE,0xFE,0x13,0x09,0x85,0x13,0x92,0x70,0xB4,0x13,0x0C,0x93,0xBC,0x43,0x79,0x44,
+	0xF4,0xFD,0x44,0x52,0xE2,0xD7,0x4D,0xD3,0x64,0xF2,0xE2,0x1E,0x71,0xF5,0x4B,0xFF,
+	0x5C,0xAE,0x82,0xAB,0x9C,0x9D,0xF6,0x9E,0xE8,0x6D,0x2B,0xC5,0x22,0x36,0x3A,0x0D,
+	0xAB,0xC5,0x21,0x97,0x9B,0x0D,0xEA,0xDA,0x1D,0xBF,0x9A,0x42,0xD5,0xC4,0x48,0x4E,
+	0x0A,0xBC,0xD0,0x6B,0xFA,0x53,0xDD,0xEF,0x3C,0x1B,0x20,0xEE,0x3F,0xD5,0x9D,0x7C,
+	0x25,0xE4,0x1D,0x2B,0x66,0x9E,0x1E,0xF1,0x6E,0x6F,0x52,0xC3,0x16,0x4D,0xF4,0xFB,
+	0x79,0x30,0xE9,0xE4,0xE5,0x88,0x57,0xB6,0xAC,0x7D,0x5F,0x42,0xD6,0x9F,0x6D,0x18,
+	0x77,0x63,0xCF,0x1D,0x55,0x03,0x40,0x04,0x87,0xF5,0x5B,0xA5,0x7E,0x31,0xCC,0x7A,
+	0x71,0x35,0xC8,0x86,0xEF,0xB4,0x31,0x8A,0xED,0x6A,0x1E,0x01,0x2D,0x9E,0x68,0x32,
+	0xA9,0x07,0x60,0x0A,0x91,0x81,0x30,0xC4,0x6D,0xC7,0x78,0xF9,0x71,0xAD,0x00,0x38,
+	0x09,0x29,0x99,0xA3,0x33,0xCB,0x8B,0x7A,0x1A,0x1D,0xB9,0x3D,0x71,0x40,0x00,0x3C,
+	0x2A,0x4E,0xCE,0xA9,0xF9,0x8D,0x0A,0xCC,0x0A,0x82,0x91,0xCD,0xCE,0xC9,0x7D,0xCF,
+	0x8E,0xC9,0xB5,0x5A,0x7F,0x88,0xA4,0x6B,0x4D,0xB5,0xA8,0x51,0xF4,0x41,0x82,0xE1,
+	0xC6,0x8A,0x00,0x7E,0x5E,0x65,0x5F,0x6A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF
+};
+
+static const CCDhNamedGroup_t dhNamedGroups[CC_DH_NAMED_GROUP_NumOfGroups] = {
+        {CC_DH_NAMED_GROUP_MODP2048,  dh_group_prime_modp2048,  sizeof(dh_group_prime_modp2048),  112},
+        {CC_DH_NAMED_GROUP_MODP3072,  dh_group_prime_modp3072,  sizeof(dh_group_prime_modp3072),  128},
+        {CC_DH_NAMED_GROUP_MODP4096,  dh_group_prime_modp4096,  sizeof(dh_group_prime_modp4096),  152},
+        {CC_DH_NAMED_GROUP_FFDHE2048, dh_group_prime_ffdhe2048, sizeof(dh_group_prime_ffdhe2048), 112},
+        {CC_DH_NAMED_GROUP_FFDHE3072, dh_group_prime_ffdhe3072, sizeof(dh_group_prime_ffdhe3072), 128},
+        {CC_DH_NAMED_GROUP_FFDHE4096, dh_group_prime_ffdhe4096, sizeof(dh_group_prime_ffdhe4096), 152},
+};
+
+/************************ Private Functions ******************************/
+
+/* This function checks that the group is one of the library named groups */
+static CCError_t DhNamedGroupCheck(const CCDhNamedGroup_t *pGroup)
+{
+        if (pGroup == NULL) {
+                return CC_DH_INVALID_ARGUMENT_POINTER_ERROR;
+        }
+        if ((pGroup->groupId >= CC_DH_NAMED_GROUP_NumOfGroups) ||
+            (pGroup != &dhNamedGroups[pGroup->groupId])) {
+                return CC_DH_INVALID_NAMED_GROUP_ERROR;
+        }
+        return CC_OK;
+}
+
+#ifdef CC_SUPPORT_DH_FIXED_BASE_COMB
+
+/* This function returns all-ones mask if the values are equal, otherwise zero, without branches */
+static uint32_t DhCombMaskIfEqual(uint32_t a, uint32_t b)
+{
+        uint32_t x = a ^ b;
+
+        return ((x | (0U - x)) >> 31) - 1U;
+}
+
+/* This function copies the comb table entry into the buffer in constant time: all entries
+   are read, and only the requested one is accumulated. The index 0 gives the value 1 */
+static void DhCombSelectEntry(const CCDhCombTable_t *pTable, /* [in] The comb table. */
+                              uint32_t index,                /* [in] Index of the entry (secret). */
+                              uint32_t *pEntry)              /* [out] Buffer for the entry. */
+{
+        uint32_t i, j, mask;
+        const uint32_t *pTableEntry = pTable->pEntries;
+
+        CC_PalMemSetZero(pEntry, pTable->modSizeInWords*sizeof(uint32_t));
+        pEntry[0] = DhCombMaskIfEqual(0, index) & 1UL;
+        for (i = 1; i <= CC_DH_COMB_ENTRIES_COUNT; i++) {
+                mask = DhCombMaskIfEqual(i, index);
+                for (j = 0; j < pTable->modSizeInWords; j++) {
+                        pEntry[j] |= pTableEntry[j] & mask;
+                }
+                pTableEntry += pTable->modSizeInWords;
+        }
+        return;
+}
+
+/***********     DhCombExp  function      **********************/
+/**
+ * @brief Calculates Out = 2^exp mod p with the fixed-base comb table of the group.
+ *
+ *  Each of the teethSpacing rounds squares the accumulator and multiplies it by the table
+ *  entry indexed by the exponent bits i, i+spacing, ..., i+(teeth-1)*spacing. Every round
+ *  executes the same operations, and the entry is read by a full table scan.
+ *
+ *  Notes: Assumed the exponent is not greater than teeth*spacing bits and its buffer is
+ *         zero-padded to this size.
+ *         PKA registers used: r0,r1,r2,r3,r4, r30,r31.
+ *
+ * @return  CC_OK on success, otherwise an error code of the PKA.
+ */
+static CCError_t DhCombExp(const CCDhCombTable_t *pTable, /* [in] The comb table of the group. */
+                           uint32_t *pMod,                /* [in] The group prime, LS word first. */
+                           uint32_t modSizeInBits,        /* [in] The prime size in bits. */
+                           const uint32_t *pExp,          /* [in] The exponent, LS word first. */
+                           uint32_t *pOut,                /* [out] The result, LS word first, of prime size. */
+                           uint32_t *pEntry)              /* [in] Temp buffer of prime size. */
+{
+        CCError_t err = CC_OK;
+        uint32_t pkaRegsCount = 7;
+        uint32_t index, j;
+        int32_t i;
+        /* define virtual registers pointers  */
+        #define ACC_REG   2
+        #define ENTRY_REG 3
+        #define TMP_REG   4
+
+        err = PkaInitAndMutexLock(modSizeInBits, &pkaRegsCount);
+        if (err != CC_OK) {
+                return err;
+        }
+
+        PkaCopyDataIntoPkaReg(PKA_REG_N/*dstReg*/, LEN_ID_MAX_BITS/*LenID*/, pMod, pTable->modSizeInWords);
+
+        err = PkaCalcNpIntoPkaReg(LEN_ID_N_BITS,
+                                  modSizeInBits,
+                                  PKA_REG_N,
+                                  PKA_REG_NP,
+                                  ENTRY_REG, TMP_REG);
+        if (err != CC_OK) {
+                goto End;
+        }
+
+        PKA_SET_VAL(ACC_REG, 1);
+        for (i = (int32_t)pTable->teethSpacing - 1; i >= 0; i--) {
+                index = 0;
+                for (j = 0; j < CC_DH_COMB_TEETH_COUNT; j++) {
+                        index |= DH_COMB_BIT(pExp, (uint32_t)i + j*pTable->teethSpacing) << j;
+                }
+                DhCombSelectEntry(pTable, index, pEntry);
+                PkaCopyDataIntoPkaReg(ENTRY_REG, LEN_ID_MAX_BITS, pEntry, pTable->modSizeInWords);
+
+                PKA_MOD_MUL(LEN_ID_N_BITS, ACC_REG, ACC_REG, ACC_REG);
+                PKA_MOD_MUL(LEN_ID_N_BITS, ACC_REG, ACC_REG, ENTRY_REG);
+        }
+
+        PkaCopyDataFromPkaReg(pOut, pTable->modSizeInWords, ACC_REG);
+
+End:
+        CC_PalMemSetZero(pEntry, pTable->modSizeInWords*sizeof(uint32_t));
+        PkaFinishAndMutexUnlock(pkaRegsCount);
+
+        /* undef virtual registers pointers  */
+        #undef ACC_REG
+        #undef ENTRY_REG
+        #undef TMP_REG
+
+        return err;
+}
+
+#endif /* CC_SUPPORT_DH_FIXED_BASE_COMB */
+
+/************************ Public Functions ******************************/
+
+CEXPORT_C const CCDhNamedGroup_t *CC_DhGetNamedGroup(CCDhNamedGroupId_t groupId)
+{
+        if (groupId >= CC_DH_NAMED_GROUP_NumOfGroups) {
+                return NULL;
+        }
+        return &dhNamedGroups[groupId];
+}
+
+
+CEXPORT_C CCError_t CC_DhNamedGroupGeneratePubPrv(
+                                           CCRndGenerateVectWorkFunc_t f_rng,
+                                           void *p_rng,
+                                           const CCDhNamedGroup_t *pGroup,
+                                           size_t prvKeySizeInBits,
+                                           CCDhTemp_t *pTempBuff,
+                                           uint8_t *pPrvKey,
+                                           size_t *pPrvKeySize,
+                                           uint8_t *pPubKey,
+                                           size_t *pPubKeySize)
+{
+        CCError_t Error = CC_OK;
+        CCDhPubKey_t *tmpPubKey_ptr;
+        uint32_t modSizeInBits, modSizeInWords, orderSizeInBits;
+        uint32_t generator = CC_DH_NAMED_GROUP_GENERATOR;
+        uint8_t *pMaxVect;
+        size_t prvKeySize;
+        uint32_t i;
+#ifdef CC_SUPPORT_DH_FIXED_BASE_COMB
+        const CCDhCombTable_t *pTable;
+#endif
+
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        /* ............... checking the parameters validity ................... */
+        /* -------------------------------------------------------------------- */
+
+        if (f_rng == NULL)
+                return CC_RND_GEN_VECTOR_FUNC_ERROR;
+
+        Error = DhNamedGroupCheck(pGroup);
+        if (Error != CC_OK)
+                return Error;
+
+        if (pTempBuff == NULL || pPrvKey == NULL || pPrvKeySize == NULL ||
+            pPubKey == NULL || pPubKeySize == NULL)
+                return CC_DH_INVALID_ARGUMENT_POINTER_ERROR;
+
+        /* the group primes are of full bytes size, so len(q) = len(p) - 1 */
+        modSizeInBits = (uint32_t)pGroup->primeSizeInBytes*CC_BITS_IN_BYTE;
+        modSizeInWords = CALC_FULL_32BIT_WORDS(modSizeInBits);
+        orderSizeInBits = modSizeInBits - 1;
+
+        if (prvKeySizeInBits == CC_DH_NAMED_GROUP_FULL_PRV_KEY)
+                prvKeySizeInBits = orderSizeInBits;
+
+        if (prvKeySizeInBits < 2*pGroup->securityStrengthBits ||
+            prvKeySizeInBits > orderSizeInBits)
+                return CC_DH_INVALID_L_ARGUMENT_ERROR;
+
+        prvKeySize = CALC_FULL_BYTES(prvKeySizeInBits);
+        if (*pPrvKeySize < prvKeySize)
+                return CC_DH_ARGUMENT_PRV_SIZE_ERROR;
+
+        if (*pPubKeySize < pGroup->primeSizeInBytes)
+                return CC_DH_INVALID_PUBLIC_KEY_SIZE_ERROR;
+
+        CC_PalMemSetZero(pTempBuff, sizeof(CCDhTemp_t));
+        tmpPubKey_ptr = (CCDhPubKey_t*)((void*)&pTempBuff->UserPubKey.PublicKeyDbBuff);
+        pMaxVect = (uint8_t*)tmpPubKey_ptr->e;
+
+        /* ----------------------------------------------------------- *
+           SP 800-56A 5.6.1.1.4: 1 <= x <= M-1, M = min(2^N, q)
+         * ----------------------------------------------------------- */
+        if (prvKeySizeInBits == orderSizeInBits) {
+                /* M = q = p >> 1, in little endianness */
+                CC_CommonReverseMemcpy(pMaxVect, (uint8_t*)pGroup->pPrime, pGroup->primeSizeInBytes);
+                for (i = 0; i < pGroup->primeSizeInBytes - 1; i++) {
+                        pMaxVect[i] = (uint8_t)((pMaxVect[i] >> 1) | (pMaxVect[i+1] << 7));
+                }
+                pMaxVect[i] >>= 1;
+
+                Error = CC_RndGenerateVectorInRange(f_rng, p_rng,
+                                                    prvKeySizeInBits/*rndSizeInBits*/,
+                                                    pMaxVect/*maxVect*/,
+                                                    (uint8_t*)pTempBuff->PrimeData.DataOut/*out*/);
+                if (Error != CC_OK)
+                        goto End;
+
+                /* reverse privKey to big endianness */
+                CC_CommonReverseMemcpy(pPrvKey, (uint8_t*)pTempBuff->PrimeData.DataOut, prvKeySize);
+        } else {
+                /* M = 2^N: random N bits, zero is rejected */
+                do {
+                        Error = f_rng((void *)p_rng, (unsigned char *)pPrvKey, prvKeySize);
+                        if (Error != CC_OK)
+                                goto End;
+                        pPrvKey[0] &= (uint8_t)(0xFF >> ((CC_BITS_IN_BYTE - (prvKeySizeInBits & 7)) & 7));
+                } while (PkiIsUint8ArrayEqualTo0(pPrvKey, prvKeySize));
+        }
+        *pPrvKeySize = prvKeySize;
+
+        /* ----------------------------------------------------------- */
+        /*           Create the public key  y = 2^x mod p              */
+        /* ----------------------------------------------------------- */
+
+        CC_PalMemSetZero(pTempBuff->PrimeData.DataOut, sizeof(pTempBuff->PrimeData.DataOut));
+        Error = CC_CommonConvertMsbLsbBytesToLswMswWords(tmpPubKey_ptr->n, sizeof(tmpPubKey_ptr->n),
+                                                         pGroup->pPrime, pGroup->primeSizeInBytes);
+        if (Error != CC_OK)
+                goto End;
+        Error = CC_CommonConvertMsbLsbBytesToLswMswWords(pTempBuff->PrimeData.DataIn, sizeof(pTempBuff->PrimeData.DataIn),
+                                                         pPrvKey, prvKeySize);
+        if (Error != CC_OK)
+                goto End;
+
+#ifdef CC_SUPPORT_DH_FIXED_BASE_COMB
+        pTable = CC_DhGetCombTable(pGroup->groupId);
+        if ((pTable != NULL) &&
+            (pTable->modSizeInWords == modSizeInWords) &&
+            (prvKeySizeInBits <= CC_DH_COMB_TEETH_COUNT*pTable->teethSpacing)) {
+                Error = DhCombExp(pTable, tmpPubKey_ptr->n, modSizeInBits,
+                                  pTempBuff->PrimeData.DataIn,
+                                  pTempBuff->PrimeData.DataOut,
+                                  pTempBuff->TempBuff);
+        } else
+#endif
+        {
+                Error = PkiExecModExpLeW(pTempBuff->PrimeData.DataOut,
+                                         &generator, 1,
+                                         tmpPubKey_ptr->n, modSizeInBits,
+                                         pTempBuff->PrimeData.DataIn, CALC_FULL_32BIT_WORDS(prvKeySizeInBits));
+        }
+        if (Error != CC_OK)
+                goto End;
+
+        Error = CC_CommonConvertLswMswWordsToMsbLsbBytes(pPubKey, *pPubKeySize,
+                                                         pTempBuff->PrimeData.DataOut,
+                                                         modSizeInWords*sizeof(uint32_t));
+        if (Error != CC_OK)
+                goto End;
+        *pPubKeySize = pGroup->primeSizeInBytes;
+
+End:
+        if (Error != CC_OK) {
+                CC_PalMemSetZero(pPrvKey, *pPrvKeySize);
+                *pPrvKeySize = 0;
+        }
+        /* delete secure sensitive data */
+        CC_PalMemSetZero(pTempBuff, sizeof(CCDhTemp_t));
+
+        return Error;
+
+}/* END OF CC_DhNamedGroupGeneratePubPrv function */
+
+
+CEXPORT_C CCError_t CC_DhNamedGroupCheckPubKey(
+                                           const CCDhNamedGroup_t *pGroup,
+                                           const uint8_t *pPubKey,
+                                           size_t pubKeySize,
+                                           CCDhTemp_t *pTempBuff)
+{
+        CCError_t Error = CC_OK;
+        CCDhPubKey_t *tmpPubKey_ptr;
+        uint32_t modSizeInBits, modSizeInWords;
+        CCCommonCmpCounter_t cmpCounters;
+        uint32_t i;
+
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        Error = DhNamedGroupCheck(pGroup);
+        if (Error != CC_OK)
+                return Error;
+
+        if (pPubKey == NULL || pTempBuff == NULL)
+                return CC_DH_INVALID_ARGUMENT_POINTER_ERROR;
+
+        if (pubKeySize == 0 || pubKeySize > pGroup->primeSizeInBytes)
+                return CC_DH_INVALID_PUBLIC_KEY_SIZE_ERROR;
+
+        modSizeInBits = (uint32_t)pGroup->primeSizeInBytes*CC_BITS_IN_BYTE;
+        modSizeInWords = CALC_FULL_32BIT_WORDS(modSizeInBits);
+
+        CC_PalMemSetZero(pTempBuff, sizeof(CCDhTemp_t));
+        tmpPubKey_ptr = (CCDhPubKey_t*)((void*)&pTempBuff->UserPubKey.PublicKeyDbBuff);
+
+        /* p into n, q = p >> 1 into e, the public key into DataIn; LS word first */
+        Error = CC_CommonConvertMsbLsbBytesToLswMswWords(tmpPubKey_ptr->n, sizeof(tmpPubKey_ptr->n),
+                                                         pGroup->pPrime, pGroup->primeSizeInBytes);
+        if (Error != CC_OK)
+                goto End;
+        for (i = 0; i < modSizeInWords - 1; i++) {
+                tmpPubKey_ptr->e[i] = (tmpPubKey_ptr->n[i] >> 1) | (tmpPubKey_ptr->n[i+1] << 31);
+        }
+        tmpPubKey_ptr->e[i] = tmpPubKey_ptr->n[i] >> 1;
+
+        Error = CC_CommonConvertMsbLsbBytesToLswMswWords(pTempBuff->PrimeData.DataIn, sizeof(pTempBuff->PrimeData.DataIn),
+                                                         pPubKey, pubKeySize);
+        if (Error != CC_OK) {
+                Error = CC_DH_INVALID_PUBLIC_KEY_SIZE_ERROR;
+                goto End;
+        }
+
+        /* 1 < y < p-1. Note: the prime is odd */
+        if (CC_CommonGetWordsCounterEffectiveSizeInBits(pTempBuff->PrimeData.DataIn, (uint16_t)modSizeInWords) <= 1) {
+                Error = CC_DH_INVALID_PUBLIC_KEY_ERROR;
+                goto End;
+        }
+        tmpPubKey_ptr->n[0] -= 1;
+        cmpCounters = CC_CommonCmpLsWordsUnsignedCounters(pTempBuff->PrimeData.DataIn, (uint16_t)modSizeInWords,
+                                                          tmpPubKey_ptr->n, (uint16_t)modSizeInWords);
+        tmpPubKey_ptr->n[0] += 1;
+        if (cmpCounters != CC_COMMON_CmpCounter2GreaterThenCounter1) {
+                Error = CC_DH_INVALID_PUBLIC_KEY_ERROR;
+                goto End;
+        }
+
+        /* y^q = 1 mod p */
+        Error = PkiExecModExpLeW(pTempBuff->PrimeData.DataOut,
+                                 pTempBuff->PrimeData.DataIn, modSizeInWords,
+                                 tmpPubKey_ptr->n, modSizeInBits,
+                                 tmpPubKey_ptr->e, modSizeInWords);
+        if (Error != CC_OK) {
+                Error = CC_DH_INVALID_PUBLIC_KEY_ERROR;
+                goto End;
+        }
+
+        CC_PalMemSetZero(tmpPubKey_ptr->n, modSizeInWords*sizeof(uint32_t));
+        tmpPubKey_ptr->n[0] = 1;
+        if (CC_CommonCmpLsWordsUnsignedCounters(pTempBuff->PrimeData.DataOut, (uint16_t)modSizeInWords,
+                                                tmpPubKey_ptr->n, (uint16_t)modSizeInWords) !=
+            CC_COMMON_CmpCounter1AndCounter2AreIdentical) {
+                Error = CC_DH_INVALID_PUBLIC_KEY_ERROR;
+        }
+
+End:
+        CC_PalMemSetZero(pTempBuff, sizeof(CCDhTemp_t));
+
+        return Error;
+
+}/* END OF CC_DhNamedGroupCheckPubKey function */
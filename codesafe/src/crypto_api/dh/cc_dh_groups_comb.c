@@ -0,0 +1,1234 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/* This file is generated by utils/src/dh_comb_tables/cc_dh_comb_tables_gen.py - do not edit. */
+
+#include "cc_pal_types.h"
+#include "cc_dh_groups.h"
+#include "cc_dh_groups_comb.h"
+
+/* modp2048: 4 teeth spaced 56 bits apart */
+static const uint32_t dh_comb_entries_modp2048[CC_DH_COMB_ENTRIES_COUNT*64] = {
+	/* T[1] */
+	0x00000002,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	/* T[2] */
+	0xBA05DD53,0xA926FA11,0xFDAFCF32,0x048CFE22,0xE3E2A6ED,0x918B1718,0x9B7362FE,0xB0D1EB00,
+	0xF2A3194C,0x703B7EDA,0x4DCE7F1A,0x9312AF7B,0x192D6B58,0xA1666006,0x1FA53901,0xD648B528,
+	0x1C1608E1,0x7B625CF7,0xFFFB9712,0xC6E87232,0xB8800D73,0x97AE41BD,0x1158D016,0x0D769649,
+	0xC9F1EE72,0x0042FC4E,0x5FCC5A1A,0x145C141C,0xCB4DD535,0x280E4B6C,0x625ED28F,0xC301CEF7,
+	0x65CA3ED3,0x6D9BCF57,0x97F18059,0xF860C7BA,0x2195188F,0x0F23CE37,0x76253F5B,0x26AAD456,
+	0x0E4BDF9A,0xB167A873,0x4814ABC1,0x3AA552E5,0x9806CFA7,0x722BB086,0xE3A698ED,0xE93D1E70,
+	0xB3EF4E25,0x553BC8FF,0xA7EF4351,0x1B9A0EFD,0x0BD547BA,0xF80C3C8D,0xBE132502,0x10ED97CB,
+	0x4009C7E4,0x98D3DDD0,0x92930D2F,0xCD7D3142,0x3D7DA48E,0xC1ECD914,0x6E3FED3F,0x36F69E68,
+	/* T[3] */
+	0x740BBAA6,0x524DF423,0xFB5F9E65,0x0919FC45,0xC7C54DDA,0x23162E31,0x36E6C5FD,0x61A3D601,
+	0xE5463299,0xE076FDB5,0x9B9CFE34,0x26255EF6,0x325AD6B1,0x42CCC00C,0x3F4A7203,0xAC916A50,
+	0x382C11C3,0xF6C4B9EE,0xFFF72E24,0x8DD0E465,0x71001AE7,0x2F5C837B,0x22B1A02D,0x1AED2C92,
+	0x93E3DCE4,0x0085F89D,0xBF98B434,0x28B82838,0x969BAA6A,0x501C96D9,0xC4BDA51E,0x86039DEE,
+	0xCB947DA7,0xDB379EAE,0x2FE300B2,0xF0C18F75,0x432A311F,0x1E479C6E,0xEC4A7EB6,0x4D55A8AC,
+	0x1C97BF34,0x62CF50E6,0x90295783,0x754AA5CA,0x300D9F4E,0xE457610D,0xC74D31DA,0xD27A3CE1,
+	0x67DE9C4B,0xAA7791FF,0x4FDE86A2,0x37341DFB,0x17AA8F74,0xF018791A,0x7C264A05,0x21DB2F97,
+	0x80138FC8,0x31A7BBA0,0x25261A5F,0x9AFA6285,0x7AFB491D,0x83D9B228,0xDC7FDA7F,0x6DED3CD0,
+	/* T[4] */
+	0x89C02609,0x3A0567B3,0x0A2117D9,0x1A4743B1,0xBAD08D19,0x11E43D73,0x7B5F1C79,0xC396DAD9,
+	0xBAA71162,0x19DC7214,0xB82EDBF1,0xA1EDE221,0x7E5A7D0A,0x4168CF05,0xD5B4F924,0x4A4DA457,
+	0x194ECE11,0x66C3574E,0xED76C976,0x412A3FC4,0x522CAF76,0x5DAF94CB,0x54F510BE,0x96950675,
+	0x9948C4E1,0x6BBE70AD,0x3653E646,0x23ED35A7,0x8B0951BA,0xE0D10877,0x12BE6244,0xDFFAC085,
+	0xA916B7AF,0x17FDB3A8,0x6A4C89D0,0x0237C040,0xA805AA31,0x48CD15C6,0x338F9A22,0x6D04CDCF,
+	0x2DBEB800,0xD732EA27,0x84D74D72,0x6125D1A4,0x5AC473E7,0x24174450,0x98E7932F,0x80E2A347,
+	0xBD2558B3,0x530364C3,0x6979549A,0x17DF40EA,0x2A9DCB64,0xB2F4795E,0x3EE0114B,0xAEC7E6E6,
+	0xC97AFA8F,0x87006689,0xD6B1A4A4,0xF0531185,0x5D259B15,0xF6E8B059,0xB5307159,0x7375FCD0,
+	/* T[5] */
+	0x13804C12,0x740ACF67,0x14422FB2,0x348E8762,0x75A11A32,0x23C87AE7,0xF6BE38F2,0x872DB5B2,
+	0x754E22C5,0x33B8E429,0x705DB7E2,0x43DBC443,0xFCB4FA15,0x82D19E0A,0xAB69F248,0x949B48AF,
+	0x329D9C22,0xCD86AE9C,0xDAED92EC,0x82547F89,0xA4595EEC,0xBB5F2996,0xA9EA217C,0x2D2A0CEA,
+	0x329189C3,0xD77CE15B,0x6CA7CC8C,0x47DA6B4E,0x1612A374,0xC1A210EF,0x257CC489,0xBFF5810A,
+	0x522D6F5F,0x2FFB6751,0xD49913A0,0x046F8080,0x500B5462,0x919A2B8D,0x671F3444,0xDA099B9E,
+	0x5B7D7000,0xAE65D44E,0x09AE9AE5,0xC24BA349,0xB588E7CE,0x482E88A0,0x31CF265E,0x01C5468F,
+	0x7A4AB167,0xA606C987,0xD2F2A934,0x2FBE81D4,0x553B96C8,0x65E8F2BC,0x7DC02297,0x5D8FCDCC,
+	0x92F5F51F,0x0E00CD13,0xAD634949,0xE0A6230B,0xBA4B362B,0xEDD160B2,0x6A60E2B3,0xE6EBF9A1,
+	/* T[6] */
+	0x5A9EF586,0x7773DBA5,0x46E7092E,0xA6124F04,0x054EDE82,0x099D9317,0x29F73032,0x7A2491D9,
+	0xE7879AB2,0xE32EBB8C,0xFD036B7D,0xCA01FF5E,0x72FE9D88,0x6BBBCAEF,0xAEBC5F16,0xEC7D8913,
+	0x3B18B28B,0xB68B3F68,0xFC1C7CC1,0xE57B9C53,0x8BCE3469,0x0E4A6DB5,0x3DBF7F15,0x868811A5,
+	0xA189BA2D,0xE68263CE,0xC7DC7DF9,0xB55973E2,0x06EF5960,0x0CEA6CE9,0x289A4E4D,0xDC8B69D7,
+	0x901E03DC,0x69A57855,0x592027C4,0xDFEDA5E1,0xF3255DFA,0x92F9ABB6,0x7416D027,0xCBF58315,
+	0x840527F7,0x0EC75DD7,0xCA3A7D81,0x1BE2B716,0x48727C2E,0x90CB2101,0x212D28B5,0x3FD4266D,
+	0x75285B27,0x138CB7D2,0xAAE30B2C,0x7A986876,0x6ED71117,0x6CF50C57,0xA47BBE42,0x2943B0C5,
+	0x5003F038,0x44060D4B,0x21E04783,0x975D0917,0xCAF4A0E6,0x633FDE8D,0xE157E599,0x5B2FFCB3,
+	/* T[7] */
+	0xB53DEB0C,0xEEE7B74A,0x8DCE125C,0x4C249E08,0x0A9DBD05,0x133B262E,0x53EE6064,0xF44923B2,
+	0xCF0F3564,0xC65D7719,0xFA06D6FB,0x9403FEBD,0xE5FD3B11,0xD77795DE,0x5D78BE2C,0xD8FB1227,
+	0x76316517,0x6D167ED0,0xF838F983,0xCAF738A7,0x179C68D3,0x1C94DB6B,0x7B7EFE2A,0x0D10234A,
+	0x4313745B,0xCD04C79D,0x8FB8FBF3,0x6AB2E7C5,0x0DDEB2C1,0x19D4D9D2,0x51349C9A,0xB916D3AE,
+	0x203C07B9,0xD34AF0AB,0xB2404F88,0xBFDB4BC2,0xE64ABBF5,0x25F3576D,0xE82DA04F,0x97EB062A,
+	0x080A4FEF,0x1D8EBBAF,0x9474FB02,0x37C56E2D,0x90E4F85C,0x21964202,0x425A516B,0x7FA84CDA,
+	0xEA50B64E,0x27196FA4,0x55C61658,0xF530D0ED,0xDDAE222E,0xD9EA18AE,0x48F77C84,0x5287618B,
+	0xA007E070,0x880C1A96,0x43C08F06,0x2EBA122E,0x95E941CD,0xC67FBD1B,0xC2AFCB32,0xB65FF967,
+	/* T[8] */
+	0xA25A10E5,0x018E5F12,0x4128E508,0x300BBE15,0x45F493F6,0x4E92F0F1,0x0EE72315,0x9F468D2C,
+	0x66ACAEEF,0xC70FB57A,0x792A403D,0x10AD6573,0x360D0510,0x78600ABB,0x8F52C8D6,0x851D569A,
+	0x16647686,0xD11471EE,0x2F3A607C,0xCCDE450C,0x7E4A6D7A,0x3D7DD8FC,0x2208B23F,0xEE06D324,
+	0x780A2844,0x7E0D6B75,0x300BA5E5,0x9A95CDCC,0x3835E775,0x8C618A80,0xF9CDE54F,0x2B745445,
+	0x3BB8E5CC,0x22B36E75,0xD4D56D56,0x07489DD9,0xF0885E28,0x808CA642,0x1F2E3D87,0xFCB40336,
+	0xF58B82B8,0xA2315E28,0x43012197,0xC29B123D,0x46FA9732,0xD7A9B94C,0x8B0FF61E,0x5310439E,
+	0x54FED06C,0x0D9C9A39,0xB00387F8,0x2167F8E4,0x9A7D6E61,0xD311D377,0xFAD4A908,0xCC3C94DB,
+	0x08408956,0x7F9B455C,0x16E092B0,0xECD7067D,0xD6A18AE8,0xBF97F1FD,0x9DA65A38,0x261D47A7,
+	/* T[9] */
+	0x44B421CA,0x031CBE25,0x8251CA10,0x60177C2A,0x8BE927EC,0x9D25E1E2,0x1DCE462A,0x3E8D1A58,
+	0xCD595DDF,0x8E1F6AF4,0xF254807B,0x215ACAE6,0x6C1A0A20,0xF0C01576,0x1EA591AC,0x0A3AAD35,
+	0x2CC8ED0D,0xA228E3DC,0x5E74C0F9,0x99BC8A18,0xFC94DAF5,0x7AFBB1F8,0x4411647E,0xDC0DA648,
+	0xF0145089,0xFC1AD6EA,0x60174BCA,0x352B9B98,0x706BCEEB,0x18C31500,0xF39BCA9F,0x56E8A88B,
+	0x7771CB98,0x4566DCEA,0xA9AADAAC,0x0E913BB3,0xE110BC50,0x01194C85,0x3E5C7B0F,0xF968066C,
+	0xEB170571,0x4462BC51,0x8602432F,0x8536247A,0x8DF52E65,0xAF537298,0x161FEC3D,0xA620873D,
+	0xA9FDA0D8,0x1B393472,0x60070FF0,0x42CFF1C9,0x34FADCC2,0xA623A6EF,0xF5A95211,0x987929B7,
+	0x108112AD,0xFF368AB8,0x2DC12560,0xD9AE0CFA,0xAD4315D1,0x7F2FE3FB,0x3B4CB471,0x4C3A8F4F,
+	/* T[10] */
+	0xFEE82F6F,0x01AC6013,0x219C2519,0xF9E3EB5C,0x495A93B6,0x28557FDE,0xA9BB16F5,0x9A56F583,
+	0xB8B0FA73,0x86410516,0x7D0DD901,0x74427886,0x099ACE66,0xEF8473B7,0xA0E2047B,0x9518C1FE,
+	0x4C11B54D,0xBA0117AF,0x27855AE7,0xCFEFAB36,0xA644615E,0xF58DACE7,0x880FFC8A,0x9F8F6580,
+	0x948049FE,0x73C70D16,0x1A8AC40A,0x0C119973,0x2F44C613,0x74025C02,0x16450882,0x97D24C3D,
+	0xBE13D267,0x109B8519,0xDB8A6D70,0x492267D4,0x413A7EC8,0x4AFE0296,0xB9068914,0x7CC6EF9C,
+	0x374D3A55,0xDAB8BDAC,0xD2B01D73,0x41A70485,0x390AAAF9,0x3E1D0FBE,0x594C06C3,0xDDF38412,
+	0x92319A25,0x510FB595,0xF711CB2D,0x187D2086,0x5A460AF7,0x1D14F59B,0xF6E1618D,0xBFFCB894,
+	0xFF6DFAE1,0x6346527B,0x6BB693AF,0x5D600441,0x80B807EE,0x084BCF9F,0xBE432008,0x5119F14C,
+	/* T[11] */
+	0xFDD05EDE,0x0358C027,0x43384A32,0xF3C7D6B8,0x92B5276D,0x50AAFFBC,0x53762DEA,0x34ADEB07,
+	0x7161F4E7,0x0C820A2D,0xFA1BB203,0xE884F10C,0x13359CCC,0xDF08E76E,0x41C408F7,0x2A3183FD,
+	0x98236A9B,0x74022F5E,0x4F0AB5CF,0x9FDF566C,0x4C88C2BD,0xEB1B59CF,0x101FF915,0x3F1ECB01,
+	0x290093FD,0xE78E1A2D,0x35158814,0x182332E6,0x5E898C26,0xE804B804,0x2C8A1104,0x2FA4987A,
+	0x7C27A4CF,0x21370A33,0xB714DAE0,0x9244CFA9,0x8274FD90,0x95FC052C,0x720D1228,0xF98DDF39,
+	0x6E9A74AA,0xB5717B58,0xA5603AE7,0x834E090B,0x721555F2,0x7C3A1F7C,0xB2980D86,0xBBE70824,
+	0x2463344B,0xA21F6B2B,0xEE23965A,0x30FA410D,0xB48C15EE,0x3A29EB36,0xEDC2C31A,0x7FF97129,
+	0xFEDBF5C3,0xC68CA4F7,0xD76D275E,0xBAC00882,0x01700FDC,0x10979F3F,0x7C864010,0xA233E299,
+	/* T[12] */
+	0xE810E6C2,0xD3F893BF,0x85C14D8B,0xD7211A72,0x548E3FFC,0x55687EF2,0x12C472E3,0x95DA5F3B,
+	0x1DEA74F0,0x36609525,0x529CFD17,0x90DFD479,0xCED27B7E,0xDBC1AC31,0x6AB76166,0x733259B2,
+	0x1DDE10AE,0x9355D2D9,0x60B41E6B,0x108632AB,0x9316B44B,0xD289F43F,0xE869979D,0x415AEAAF,
+	0xCE3CA440,0x7447B6EB,0x10E1FDB3,0x061BDC83,0x5B636918,0xB11C3D29,0x8CE3ADFE,0xEE2CFD98,
+	0x43140E7B,0xBBB6324F,0x20F7C04C,0x5E1109A8,0x16168239,0x91174D10,0x0774A535,0xACA68DE4,
+	0x96AD9F5B,0x5BC56BE7,0x10DE33D3,0xCD6563F9,0x68728B8C,0x3D6DC618,0xF3BBFC4F,0x3C2A22DC,
+	0xE8CA699D,0x3B569E2B,0x42907EC1,0xE608019C,0x55FA3137,0x0EC4952D,0x8337133B,0xCE0B736D,
+	0x6ABD0543,0x85D476A0,0xE80BAA58,0xF1C9E5C5,0x68031AF1,0x2A980701,0xA5A85365,0x200BF0F8,
+	/* T[13] */
+	0xD021CD84,0xA7F1277F,0x0B829B17,0xAE4234E5,0xA91C7FF9,0xAAD0FDE4,0x2588E5C6,0x2BB4BE76,
+	0x3BD4E9E1,0x6CC12A4A,0xA539FA2E,0x21BFA8F2,0x9DA4F6FD,0xB7835863,0xD56EC2CD,0xE664B364,
+	0x3BBC215C,0x26ABA5B2,0xC1683CD7,0x210C6556,0x262D6896,0xA513E87F,0xD0D32F3B,0x82B5D55F,
+	0x9C794880,0xE88F6DD7,0x21C3FB66,0x0C37B906,0xB6C6D230,0x62387A52,0x19C75BFD,0xDC59FB31,
+	0x86281CF7,0x776C649E,0x41EF8099,0xBC221350,0x2C2D0472,0x222E9A20,0x0EE94A6B,0x594D1BC8,
+	0x2D5B3EB7,0xB78AD7CF,0x21BC67A6,0x9ACAC7F2,0xD0E51719,0x7ADB8C30,0xE777F89E,0x785445B9,
+	0xD194D33A,0x76AD3C57,0x8520FD82,0xCC100338,0xABF4626F,0x1D892A5A,0x066E2676,0x9C16E6DB,
+	0xD57A0A87,0x0BA8ED40,0xD01754B1,0xE393CB8B,0xD00635E3,0x55300E02,0x4B50A6CA,0x4017E1F1,
+	/* T[14] */
+	0x9542B719,0x6AADE4C2,0x843A58DA,0x34396FD0,0x427753E4,0x487EEBDC,0x98478B2B,0xD29D1527,
+	0x3D66E29C,0x68CB2F24,0xE4CDCB2D,0x05A3E489,0x6E5E6FBA,0xCDE113F1,0x07462E9A,0x4AEA636A,
+	0xCCE2DDCF,0xC078D2EB,0x96A479E1,0x8FCE61FB,0x6EEA62E3,0x69D66900,0x50C9C64D,0x9C3D90F7,
+	0x07D940FE,0xA347F4C0,0xCE0B174E,0x32D2B704,0x46F74928,0x715F2C9D,0x961E7A8F,0xFAC3137B,
+	0x9D861938,0x8C2282C1,0x92A1D170,0x865C260C,0xCFC81B4C,0x018AE41B,0x8FBF1DEF,0xECB29EA5,
+	0x49E69D5F,0xCBEC80C9,0x2CCB4B41,0xFF1E04DF,0x51ED0C28,0xB5333DFD,0x24565FDD,0xE44C394E,
+	0xA8AF3E7B,0xEE62037D,0x2D517E9A,0xD554BC81,0xAD8B3AA2,0x5D089798,0xF18BD2BD,0x352A6027,
+	0x016BDC1F,0x907485D8,0x5E300183,0x8FAA8E42,0x5E36572D,0xEBCE2041,0x9740D534,0x6067F44B,
+	/* T[15] */
+	0x2A856E32,0xD55BC985,0x0874B1B4,0x6872DFA1,0x84EEA7C8,0x90FDD7B8,0x308F1656,0xA53A2A4F,
+	0x7ACDC539,0xD1965E48,0xC99B965A,0x0B47C913,0xDCBCDF74,0x9BC227E2,0x0E8C5D35,0x95D4C6D4,
+	0x99C5BB9E,0x80F1A5D7,0x2D48F3C3,0x1F9CC3F7,0xDDD4C5C7,0xD3ACD200,0xA1938C9A,0x387B21EE,
+	0x0FB281FD,0x468FE980,0x9C162E9D,0x65A56E09,0x8DEE9250,0xE2BE593A,0x2C3CF51E,0xF58626F7,
+	0x3B0C3271,0x18450583,0x2543A2E1,0x0CB84C19,0x9F903699,0x0315C837,0x1F7E3BDE,0xD9653D4B,
+	0x93CD3ABF,0x97D90192,0x59969683,0xFE3C09BE,0xA3DA1851,0x6A667BFA,0x48ACBFBB,0xC898729C,
+	0x515E7CF7,0xDCC406FB,0x5AA2FD35,0xAAA97902,0x5B167545,0xBA112F31,0xE317A57A,0x6A54C04F,
+	0x02D7B83E,0x20E90BB0,0xBC600307,0x1F551C84,0xBC6CAE5B,0xD79C4082,0x2E81AA69,0xC0CFE897,
+};
+
+/* modp3072: 4 teeth spaced 64 bits apart */
+static const uint32_t dh_comb_entries_modp3072[CC_DH_COMB_ENTRIES_COUNT*96] = {
+	/* T[1] */
+	0x00000002,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	/* T[2] */
+	0x5BF63DCA,0xB13060CE,0x1EC7CDEC,0x59C016AF,0x73933272,0xB86635D9,0x167D22F7,0x961ACEB0,
+	0x828CDECC,0x243DC69C,0x3276187A,0xF737F2F4,0xEB4B87F0,0x44922160,0x1257F1C1,0x8DEC9A8C,
+	0x6C10314E,0x26C6303F,0x6657C342,0xD36BCC0D,0xEBFBADE7,0xFA154AE3,0x5AF4F431,0xBE409B30,
+	0x9EB51EFF,0xBBAE44FB,0x716194B3,0xADE29104,0xAA80900B,0x05D67BB6,0x06D3E660,0x04496DE5,
+	0x120762AD,0xC18E3EB8,0xB81891B9,0x2EEB3973,0x566EDC41,0xDCF52BCA,0xBD2FFF95,0xF9C86457,
+	0x26B46F21,0x70D05B4C,0x7FE14987,0xD5682F21,0x8A61319E,0xCAF661A5,0x812C74FE,0xEE4C2511,
+	0xF89AFB1B,0xADD5A47D,0xD88962AC,0x8253A55D,0xC1B5E455,0x5BDADF46,0x8BB1B584,0xB10AD0BD,
+	0xFF01C082,0x9E429F11,0x2BDD8CCB,0x622572B0,0xA3F8D64A,0xDF1A6811,0x71EAD6A3,0x7876CF35,
+	0x6B0185B3,0xEDDEBE7F,0x18A58CD6,0xDA859813,0x6C716093,0x18821846,0xE5618342,0x53081FAD,
+	0xF21D355D,0x9EB5B451,0x0D2E0431,0x7EBC9558,0xF8C052BB,0xC554F6C6,0xD608F8C3,0x48C0CCC8,
+	0x1F696D39,0x02AD6138,0x20E0B851,0x1BDEDEF3,0x5C929B31,0x2DD3ED7C,0x110275C5,0xC88E31BB,
+	0x785C8E40,0x5BE6EB39,0xCA8982EB,0x4543C5F9,0x7D493678,0x568C844B,0x935A7CE5,0x24D45FEC,
+	/* T[3] */
+	0xB7EC7B94,0x6260C19C,0x3D8F9BD9,0xB3802D5E,0xE72664E4,0x70CC6BB2,0x2CFA45EF,0x2C359D60,
+	0x0519BD99,0x487B8D39,0x64EC30F4,0xEE6FE5E8,0xD6970FE1,0x892442C1,0x24AFE382,0x1BD93518,
+	0xD820629D,0x4D8C607E,0xCCAF8684,0xA6D7981A,0xD7F75BCF,0xF42A95C7,0xB5E9E863,0x7C813660,
+	0x3D6A3DFF,0x775C89F7,0xE2C32967,0x5BC52208,0x55012017,0x0BACF76D,0x0DA7CCC0,0x0892DBCA,
+	0x240EC55A,0x831C7D70,0x70312373,0x5DD672E7,0xACDDB882,0xB9EA5794,0x7A5FFF2B,0xF390C8AF,
+	0x4D68DE43,0xE1A0B698,0xFFC2930E,0xAAD05E42,0x14C2633D,0x95ECC34B,0x0258E9FD,0xDC984A23,
+	0xF135F637,0x5BAB48FB,0xB112C559,0x04A74ABB,0x836BC8AB,0xB7B5BE8D,0x17636B08,0x6215A17B,
+	0xFE038105,0x3C853E23,0x57BB1997,0xC44AE560,0x47F1AC94,0xBE34D023,0xE3D5AD47,0xF0ED9E6A,
+	0xD6030B66,0xDBBD7CFE,0x314B19AD,0xB50B3026,0xD8E2C127,0x3104308C,0xCAC30684,0xA6103F5B,
+	0xE43A6ABA,0x3D6B68A3,0x1A5C0863,0xFD792AB0,0xF180A576,0x8AA9ED8D,0xAC11F187,0x91819991,
+	0x3ED2DA72,0x055AC270,0x41C170A2,0x37BDBDE6,0xB9253662,0x5BA7DAF8,0x2204EB8A,0x911C6376,
+	0xF0B91C81,0xB7CDD672,0x951305D6,0x8A878BF3,0xFA926CF0,0xAD190896,0x26B4F9CA,0x49A8BFD9,
+	/* T[4] */
+	0x7806734A,0x4F9088E0,0x3873D768,0x1F2EEA10,0x433C487A,0xE855EFAF,0x8C8F9245,0x2FD83203,
+	0xC0E3771F,0xDB219BD9,0xB2195E10,0x7D737601,0x7526707A,0x7950C984,0x8CFC2181,0x705377C4,
+	0x038F0327,0xE0B94EBC,0x163D3E2A,0x3F2DC7D6,0x09A786F7,0xA0E2ED2E,0x2940A49C,0x52D88492,
+	0xB942473B,0x26DFA867,0xF52160C2,0xCE99C20C,0xFACB8BD3,0xBA5887F8,0xFAF37F31,0x1BBA3874,
+	0x1FA77290,0x0BB17183,0x28E58C0B,0xA1A0B461,0x215B70C8,0x67D61A3F,0x326B1236,0x37FD3B99,
+	0xF1FC49F9,0x2716D511,0x731DEC6F,0xAE84E252,0xFE6C53F2,0x24F6E636,0x6DB6C02A,0x49D4DDE7,
+	0x4AAE221E,0x3488DD38,0x92B6AADD,0x36379DF5,0xD4C0B121,0x0DABC1BC,0x710876DE,0x20C7429D,
+	0x56D51E09,0xF82217C3,0x132CBB3B,0x731C25C7,0xEC493EA1,0x3A3A6937,0xD44D67B9,0xB66A3F6B,
+	0x6C2851EE,0xE11F37A3,0xE9304777,0x7D099337,0xCD07CBBB,0x6C1C5718,0xCF92ADBA,0x8EC26C97,
+	0x35984DED,0x5C156D8E,0xCB532885,0x67DD7A68,0x2E6EFE16,0x2B5BCE7D,0x3A08D0D8,0x3704EE86,
+	0x66B3C2AE,0xCB36C9E3,0xC9FC8FB6,0x7CC80CF6,0xDFDA5D40,0x882DD3D7,0x4FCDBD10,0x3C8886C3,
+	0xC5D315BC,0x1E46EB58,0x509D6355,0x241D642B,0x90488D84,0x6165E3E1,0x24965889,0x8C91AF84,
+	/* T[5] */
+	0xF00CE695,0x9F2111C0,0xC7ACDC05,0xF2DB02FF,0xA57B8065,0x8CD08361,0xA439795A,0x56CE1466,
+	0xC6EDA75C,0x3F39AEF2,0xE9D15EB5,0x3F05D4AB,0xD2D1C0E8,0xA08267F0,0xDB2FD89E,0x0830ED15,
+	0x2D93FDEA,0xD042A371,0x11A78DE9,0xAF77BD86,0xC929AC50,0x2339457B,0x77781562,0xF9BB5A97,
+	0xCBA2A9AE,0x9A284149,0x8D3CB506,0x124912C2,0x9CBB289D,0x87B58AED,0x16CA43FE,0x8F1F4F3E,
+	0x3AFE6AEC,0x6A2FCBF9,0xC72053E8,0x2DCEDA67,0xA9BCDC81,0xB9DA0E65,0x7A40B987,0x36652DB5,
+	0x4EA07CDA,0x7001DE2D,0x76EF8614,0xA74466B4,0x10D10555,0xAEC648CB,0xC35EFA50,0xB00B44A2,
+	0x67257600,0x36815C2A,0x5B55343E,0x7AFACFE2,0x5EC4CA3D,0xB44B4E2B,0x717A574E,0xA2B95C33,
+	0x8D24E956,0xD3E13C30,0x49B5C8E1,0x62D2EE6A,0xDB6DADE3,0x0B5E92C6,0x8C44FBD8,0xD3FA36A1,
+	0x36ECE4D7,0x003DF28E,0xE57C33B2,0xB0EAC01D,0x1DC47790,0x29998A20,0x449BBBCF,0x2F4C6D34,
+	0x7729E3ED,0xAC2B7E65,0xF06E639F,0xDB6EB1E7,0xFA7F7D65,0x7231E783,0x06BFDF6A,0x1E28A79F,
+	0xDB087125,0x66428958,0xC6BEDC52,0x09FB0039,0x3180B5A3,0xBF119F36,0x6487DEFE,0x77054EE0,
+	0x013E5F04,0x138B88A9,0x205EA9D9,0x837465CB,0xFF2858D3,0xF9BBED20,0x492CB112,0x19235F08,
+	/* T[6] */
+	0xD6C8DB7D,0x6EB2FB6B,0xB0219580,0x9B68F6F5,0x00101ADF,0xBB1320B9,0x2AE29DA2,0xF02C635C,
+	0xFE9A3BE4,0xB2584C41,0x77E0AC4E,0x97E047C6,0x5F077865,0x139E640C,0xBA83DF60,0x377408C8,
+	0x868CD02A,0x9E59D799,0x4CA7ED26,0xDBA16B2D,0x154FA9A4,0xCC72DC66,0x403A0699,0xE75A450E,
+	0x6AB7F523,0x2A34E67F,0xEEEC9E09,0x12630038,0xECBA5790,0x95C36BDE,0x5B4074D8,0xB4CEB21C,
+	0xF7D8285A,0x759480C8,0xDE9849CF,0x8A9EC752,0x3DA48E07,0x3CB05D72,0x3572FC11,0x8801A1FA,
+	0x8E1402B8,0x3F5742E1,0x1B543514,0x4CE1967A,0x0D4B82D8,0x6F68C379,0xC2366689,0x517423A1,
+	0xCABCB959,0x2F259D0B,0x26BCB904,0xEABCDAC3,0xAEAEEE82,0x3F77C6EA,0x04E2F718,0x2E25CD1C,
+	0xB9845F9E,0x97E1B02A,0x197397B1,0xE4EEB784,0x5DEFB36E,0x585D074A,0x93952C48,0x0D05AF63,
+	0x2CA2CD51,0x9A7FA0A0,0x079B0E70,0x2B523CE4,0x4417925C,0xABDF2244,0x05ED4C41,0x39A8F0F5,
+	0x92BAD640,0xDDB399EE,0x3724EF5E,0x3C320192,0x6FE64A8D,0x4C8B6DEC,0x8A022027,0xBB6E518B,
+	0xE73A3606,0xF7069060,0xB7B7C237,0x8B014D2C,0xE22AA41E,0x83B148C3,0xAC75C41B,0xCE9C4674,
+	0x95320DB7,0x3C431A32,0x5DB6E301,0x4E60FF7C,0x9BE5F911,0x653089F1,0xE4827105,0xEE1CE5A3,
+	/* T[7] */
+	0xAD91B6FB,0xDD65F6D7,0xB7085835,0xEB4F1CCA,0x1F232530,0x324AE575,0xE0DF9014,0xD7767717,
+	0x425B30E7,0xEDA70FC3,0x755FFB30,0x73DF7835,0xA693D0BE,0xD51D9D00,0x363F545B,0x96720F1E,
+	0x338F97EF,0x4B83B52C,0x7E7CEBE1,0xE85F0434,0xE079F1AB,0x7A5923EB,0xA56AD95C,0x22BEDB8F,
+	0x2E8E0580,0xA0D2BD79,0x80D32F94,0x99DB8F1A,0x8098C015,0x3E8B52B9,0xD7642F4C,0xC148428C,
+	0xEB5FD681,0x3DF5EA84,0x3285CF71,0xFFCB004B,0xE24F16FE,0x638E94CB,0x80508D3D,0xD66DFA77,
+	0x86CFEE58,0xA082B9CC,0xC75C175E,0xE3FDCF03,0x2E8F6320,0x43AA034F,0x6C5E470F,0xBF49D017,
+	0x6742A476,0x2BBADBD1,0x8361508C,0xE405497D,0x12A14500,0x17E35887,0x992F57C3,0xBD767130,
+	0x52836C80,0x13606CFF,0x564381CD,0x467811E4,0xBEBA977E,0x47A3CEEB,0x0AD484F6,0x81311691,
+	0xB7E1DB9C,0x72FEC487,0x2251C1A3,0x0D7C1376,0x0BE404D2,0xA91F2077,0xB150F8DD,0x851975EE,
+	0x316EF492,0xAF67D726,0xC811F152,0x8417C03A,0x7D6E1653,0xB4912662,0xA6B27E08,0x26FB6DA9,
+	0xDC1557D6,0xBDE21653,0xA2354154,0x266D80A5,0x3621435F,0xB618890E,0x1DD7ED14,0x9B2CCE43,
+	0x9FFC4EFB,0x4F83E65C,0x3A91A931,0xD7FB9C6D,0x16632FED,0x01513941,0xC904E20B,0xDC39CB47,
+	/* T[8] */
+	0x4F6AD99F,0xE1841DF2,0xB35B524B,0xB980E56E,0x785C31CD,0x5D2F0643,0xBD475FF0,0xC68D2D82,
+	0x8CFB9FDE,0x4828380E,0x4D3B2009,0x89F2E54E,0x5EDC3AB4,0x3F45015A,0x18FCDFF2,0xBE975EAB,
+	0x410EAC49,0x184E3E79,0xF7CF89F5,0xEC9EE8BC,0x9C7640B5,0xD4E481C6,0xBD13AB52,0xB44D0057,
+	0xC2F1B351,0x7CA68F14,0x494C88AE,0x1EB52ED1,0xA22D912E,0x87DA66A5,0xA67C8570,0xDBA0AF98,
+	0xDE60A8ED,0x1D1AC85A,0x9E80BB08,0x56A30C2C,0x1D38D499,0x0E48E556,0x391EFB93,0xBF2FCA4B,
+	0xA9679220,0x29AC8474,0xB565923A,0x3426D729,0x6F7896D7,0x95159194,0x8EF31C79,0xB6CA8E39,
+	0x387276A2,0xA7259610,0x4FF4B604,0x484DE28E,0x8CF31A24,0xC07A6A59,0x96D75EC1,0x31FDDF59,
+	0xFFBF52D6,0xBF6A4B29,0xE1FA94B0,0x3199937C,0x97C8F22A,0x31203B97,0x712686A3,0x47F6A234,
+	0x4DC56088,0x4601F021,0x7CB2941B,0x23EE2A71,0xEE855E3E,0x5F196008,0x41808DA2,0xC0F58BF9,
+	0x8C9C7653,0x851FB52D,0xC9A52EF3,0xFABBC71A,0xA0EBD08D,0xA97AD9CC,0x7C51B97C,0xB99377D8,
+	0x766EF3E2,0xC61F31DA,0x8ECA1642,0xDA1F2F67,0x95D04DE5,0x9CD5B750,0x0AC3B54D,0x7017933E,
+	0x08FD69CA,0x6A25601D,0x9DF6C34A,0xC0D6E237,0x0A65827F,0xFCB28CE1,0x281E0DB3,0x91938495,
+	/* T[9] */
+	0x9ED5B33F,0xC3083BE4,0xBD7BD1CC,0x277EF9BC,0x0FBB530D,0x7682B08A,0x05A914AF,0x84380B65,
+	0x5F1DF8DB,0x1946E75C,0x2014E2A6,0x5804B345,0xA63D555C,0x2C6AD79C,0xF3315580,0xA4B8BAE2,
+	0xA893502E,0x3F6C82EB,0xD4CC257E,0x0A59FF53,0xEEC71FCE,0x8B3C6EAC,0x9F1E22CE,0xBCA45222,
+	0xDF0181DB,0x45B60EA3,0x359304DF,0xB27FEC4B,0xEB7F3351,0x22B94846,0x6DDC507C,0x0EEC3D85,
+	0xB870D7A8,0x8D0279A8,0xB256B1E2,0x97D389FE,0xA177A422,0x06BFA493,0x87A88C41,0x44CA4B19,
+	0xBD770D29,0x752D3CF2,0xFB7ED1AA,0xB2885062,0xF2E98B1E,0x8F039F85,0x05D7B2EF,0x89F6A547,
+	0x42AE1F09,0x1BBACDDA,0xD5D14A8D,0x9F275913,0xCF299C43,0x19E89F64,0xBD182716,0xC52695AB,
+	0xDEF952F0,0x6271A2FD,0xE7517BCB,0xDFCDC9D5,0x326D14F4,0xF92A3786,0xC5F739AB,0xF712FC32,
+	0xFA27020A,0xCA036389,0x0C80CCF8,0xFEB3EE91,0x60BF9C95,0x0F939C00,0x28777B9F,0x93B2ABF7,
+	0x253234B9,0xFE400DA4,0xED12707B,0x012B4B4B,0xDF792255,0x6E6FFE22,0x8B51B0B3,0x2345BA43,
+	0xFA7ED38E,0x5C135946,0x5059E96A,0xC4A9451B,0x9D6C96ED,0xE8616627,0xDA73CF78,0xDE2367D5,
+	0x87930720,0xAB487231,0xBB1169C3,0xBCE761E3,0xF36242CA,0x30553F1F,0x503C1B68,0x2327092A,
+	/* T[10] */
+	0x8D102906,0xE66339CE,0x75B1A99B,0xAB39F80F,0x80AC6D1B,0x92BEF98B,0x877BE8FB,0x1F42F11D,
+	0x676511DC,0x86718774,0xCB9346E3,0xEFC41CD2,0xF7296E0A,0xA11056B4,0x9284BC09,0xE6881EE1,
+	0x92413E31,0xA3AEFD98,0xF59A9D42,0xDB1D91FD,0x631F4936,0x8949296F,0x9D800BEE,0x2DB85931,
+	0x435A4BEE,0xA4E74315,0x7D6C1808,0x555281B7,0x7B78DF30,0x6C98722A,0xDC5E9844,0xA2D27A62,
+	0x6950C7D1,0x2E64A486,0x0AEF497D,0xCA289D88,0x20BE6933,0x97EA5935,0xEC6BCE89,0x0AB12733,
+	0xA5C8B97E,0x17E4E794,0xF9A61589,0x5009D8D0,0x24EF43CB,0xD6323F5C,0xD52EAB9E,0xFED08E05,
+	0xC2D24794,0xBC6BF97F,0xEF984FC7,0x884A995F,0x2457D37C,0x633B63C1,0xD817AFB8,0xB19E8444,
+	0x83A38464,0xA3C71228,0xE46CC585,0xD54A3ACA,0xD0E4051D,0x82ADE454,0x49D769E9,0x7838D477,
+	0x1450873C,0x3734A9D9,0xFDEA2391,0x1BE4CA57,0x11BAE77A,0x7DFC94EB,0xA7C4A4D5,0x1BE73A47,
+	0x18822B9D,0xD0197E67,0xCE4CB201,0x6BDB92CF,0x11F4387D,0xC3770F52,0xFFDEAA05,0xB0C0FE8B,
+	0x5AB393A7,0x096E35AA,0x59501D2F,0x3B9CF100,0x41C73235,0x0C5E0C9D,0x3B39253C,0x1A85A2D5,
+	0xB38CDEC0,0xFCAAED40,0x95C13E3C,0x856FEEE2,0x15B4A88B,0x7A047783,0xA1F4A828,0x21981519,
+	/* T[11] */
+	0x1A20520C,0xCCC6739D,0xEB635337,0x5673F01E,0x0158DA37,0x257DF317,0x0EF7D1F7,0x3E85E23B,
+	0xCECA23B8,0x0CE30EE8,0x97268DC7,0xDF8839A5,0xEE52DC15,0x4220AD69,0x25097813,0xCD103DC3,
+	0x24827C63,0x475DFB31,0xEB353A85,0xB63B23FB,0xC63E926D,0x129252DE,0x3B0017DD,0x5B70B263,
+	0x86B497DC,0x49CE862A,0xFAD83011,0xAAA5036E,0xF6F1BE60,0xD930E454,0xB8BD3088,0x45A4F4C5,
+	0xD2A18FA3,0x5CC9490C,0x15DE92FA,0x94513B10,0x417CD267,0x2FD4B26A,0xD8D79D13,0x15624E67,
+	0x4B9172FC,0x2FC9CF29,0xF34C2B12,0xA013B1A1,0x49DE8796,0xAC647EB8,0xAA5D573D,0xFDA11C0B,
+	0x85A48F29,0x78D7F2FF,0xDF309F8F,0x109532BF,0x48AFA6F9,0xC676C782,0xB02F5F70,0x633D0889,
+	0x074708C9,0x478E2451,0xC8D98B0B,0xAA947595,0xA1C80A3B,0x055BC8A9,0x93AED3D3,0xF071A8EE,
+	0x28A10E78,0x6E6953B2,0xFBD44722,0x37C994AF,0x2375CEF4,0xFBF929D6,0x4F8949AA,0x37CE748F,
+	0x3104573A,0xA032FCCE,0x9C996403,0xD7B7259F,0x23E870FA,0x86EE1EA4,0xFFBD540B,0x6181FD17,
+	0xB567274F,0x12DC6B54,0xB2A03A5E,0x7739E200,0x838E646A,0x18BC193A,0x76724A78,0x350B45AA,
+	0x6719BD80,0xF955DA81,0x2B827C79,0x0ADFDDC5,0x2B695117,0xF408EF06,0x43E95050,0x43302A33,
+	/* T[12] */
+	0xFEC0273A,0x19779051,0xBC76BDF2,0x1616A89A,0x3A90B604,0x3E8A8DF7,0x6A178B0C,0x58F6E07A,
+	0xFC131E76,0x390E8F43,0x257C5058,0x313CFC68,0x69AF3EB9,0x78A228B6,0xC0D965E4,0x49DFAC51,
+	0xE49AA088,0x70EF1761,0x5BDDFF52,0x82C494E3,0xBF4F4A8C,0x8D1C56A3,0x29A7D369,0xBFB645AD,
+	0x8EECE53E,0xC3797127,0x9D0E5CB4,0x578D9D8F,0x1D3E151C,0xD0497371,0x08D1C74E,0x7E867F77,
+	0x337130DE,0x3A608B69,0x0638827C,0xCE16B6B8,0x16FD3959,0x87B3E27B,0xFD5BD812,0xCBEDBED7,
+	0x7646D555,0xE6B263F8,0xC39F6D29,0xD3871692,0xC67D3F18,0xC9D9ABE9,0x53C523A8,0x7758522A,
+	0xEE7EB9C5,0xBE2F21AD,0x952F2E7B,0xFA5711D8,0x6516CEF0,0xD5B2A471,0x6A6F0362,0xC886C5E4,
+	0xBBFD17CF,0x8155C6C7,0xB07A75F6,0xCA6CFEF1,0x2785B2BD,0x637B78E5,0xE7D9A2DE,0xB25E1DB9,
+	0x32DBF40C,0x90D2E206,0xD4DA90B3,0x79830824,0x969BE35E,0x3EB5D12C,0x91021986,0xEB683230,
+	0x66E0F8FE,0xDFD457CB,0x45980318,0x61223BDC,0xB56C3994,0x30325CA9,0x757FA00C,0x03D87CBD,
+	0x52D9A664,0x7394DB4D,0xA21CB026,0xFA7CDE96,0xDC2C15DF,0x1ADE5439,0xED2A6CAB,0x4003A9D3,
+	0x66F999CF,0x72D2D554,0x8C538048,0x4F5CD71E,0x23FD81FC,0xC9B0BBEB,0xFC72691C,0x934DFB9A,
+	/* T[13] */
+	0xFD804E75,0x32EF20A3,0xCFB2A919,0xE0AA8014,0x94245B79,0x3939BFF1,0x5F496AE7,0xA90B7154,
+	0x3D4CF60A,0xFB1395C7,0xD0974343,0xA698E178,0xBBE35D65,0x9F252654,0x42EA6164,0xBB495630,
+	0xEFAB38AB,0xF0AE34BC,0x9CE91038,0x36A557A0,0x3479337B,0xFBAC1867,0x784672FB,0xD376DCCD,
+	0x76F7E5B5,0xD35BD2C9,0xDD16ACEB,0x2430C9C7,0xE1A03B2E,0xB39761DD,0x3286D438,0x54B7DD42,
+	0x6291E789,0xC78DFFC5,0x81C640CA,0x86BADF15,0x95006DA3,0xF9959EDD,0x1022453F,0x5E463433,
+	0x57359393,0xEF38FBFA,0x17F28789,0xF148CF35,0xA0F2DBA1,0xF88BD430,0x8F7BC14D,0x0B122D28,
+	0xAEC6A54F,0x49CDE515,0x60463B7B,0x0339B7A8,0x7F7105DD,0x44591394,0x64477058,0xF23862C1,
+	0x5774DCE3,0xE6489A39,0x84513E56,0x1174A0BF,0x51E6961C,0x5DE0B221,0xB35D7222,0xCBE1F33D,
+	0xC4542913,0x5FA54753,0xBCD0C629,0xA9DDA9F7,0xB0ECA6D6,0xCECC7E47,0xC77A9366,0xE897F865,
+	0xD9BB3A0F,0xB3A952DF,0xE4F818C6,0xCDF834CE,0x0879F461,0x7BDF03DD,0x7DAD7DD2,0xB7CFC40D,
+	0xB3543890,0xB6FEAC2C,0x76FF1D31,0x0564A379,0x2A2426E2,0xE4729FFA,0x9F413E33,0x7DFB9501,
+	0x438B672A,0xBCA35CA0,0x97CAE3BF,0xD9F34BB1,0x269241C3,0xCA519D34,0xF8E4D239,0x269BF735,
+	/* T[14] */
+	0xCEF7A360,0x16FABF5A,0xECBFF7F1,0x6BC97956,0x7D5BE236,0x05D769B0,0xF37892D5,0x6564FBB5,
+	0x8D54E924,0xB240FF06,0xA1F18EFC,0x95F00E6C,0xA0F67D63,0xB1413368,0xEDF96164,0xE15E2136,
+	0xE16C52DE,0xADA0EB0E,0x54C43F86,0x3C5E3398,0xBC070DE3,0x8FC69DAB,0xD6761BF8,0xDDE96A97,
+	0x144E35B5,0x3ECB275B,0xE7A96F45,0x56D0E041,0xF416A292,0x53845407,0x82A5DCA4,0x31061A34,
+	0x0F0C9DC5,0x77FCEC3A,0x4C695529,0x88F76D2E,0x403EC2AA,0xD9D63097,0xA0C960DA,0x27DA6470,
+	0x07520BC8,0x34D565DF,0xEDADC45F,0x7F4DCFB7,0x772A9D45,0xC4DC3F11,0x5D384F53,0x209C1614,
+	0x9856EBCA,0xED64A9E8,0x97DF3F25,0x4727281F,0x0E6791DD,0xF6F4EC2F,0xB5A58FFC,0x2E4D9D9E,
+	0x0787D23D,0xE8EF3B2A,0x6B088BB2,0x6D83E74E,0xF91DFD7C,0x654BDAF8,0x62D7E602,0xABD2611D,
+	0xD4889AD5,0xECBF1705,0x4A2DABD5,0xD674735D,0xB9B3643B,0xB210A6CC,0xB9A16787,0xFDE6F294,
+	0xB2205334,0xF1E25DD4,0x84384E75,0x1CB9CEA5,0x89F35389,0x317124D0,0xB86E74D9,0x9516F48C,
+	0x88389AD1,0x8BFEB6E0,0x328320DD,0x8DBF5CA1,0x924D829B,0xDA563D8E,0x9B9B997D,0x6ECA3FF5,
+	0x5116D2AC,0xB1F51A59,0x43EF6071,0x91153885,0xE6B557F6,0x7609DF0C,0x8C9C6F84,0x61414D18,
+	/* T[15] */
+	0x9DEF46C0,0x2DF57EB5,0xD97FEFE2,0xD792F2AD,0xFAB7C46C,0x0BAED360,0xE6F125AA,0xCAC9F76B,
+	0x1AA9D248,0x6481FE0D,0x43E31DF9,0x2BE01CD9,0x41ECFAC7,0x628266D1,0xDBF2C2C9,0xC2BC426D,
+	0xC2D8A5BD,0x5B41D61D,0xA9887F0D,0x78BC6730,0x780E1BC6,0x1F8D3B57,0xACEC37F1,0xBBD2D52F,
+	0x289C6B6B,0x7D964EB6,0xCF52DE8A,0xADA1C083,0xE82D4524,0xA708A80F,0x054BB948,0x620C3469,
+	0x1E193B8A,0xEFF9D874,0x98D2AA52,0x11EEDA5C,0x807D8555,0xB3AC612E,0x4192C1B5,0x4FB4C8E1,
+	0x0EA41790,0x69AACBBE,0xDB5B88BE,0xFE9B9F6F,0xEE553A8A,0x89B87E22,0xBA709EA7,0x41382C28,
+	0x30ADD794,0xDAC953D1,0x2FBE7E4B,0x8E4E503F,0x1CCF23BA,0xEDE9D85E,0x6B4B1FF9,0x5C9B3B3D,
+	0x0F0FA47A,0xD1DE7654,0xD6111765,0xDB07CE9C,0xF23BFAF8,0xCA97B5F1,0xC5AFCC04,0x57A4C23A,
+	0xA91135AB,0xD97E2E0B,0x945B57AB,0xACE8E6BA,0x7366C877,0x64214D99,0x7342CF0F,0xFBCDE529,
+	0x6440A669,0xE3C4BBA9,0x08709CEB,0x39739D4B,0x13E6A712,0x62E249A1,0x70DCE9B2,0x2A2DE919,
+	0x107135A3,0x17FD6DC1,0x650641BB,0x1B7EB942,0x249B0537,0xB4AC7B1D,0x373732FB,0xDD947FEB,
+	0xA22DA558,0x63EA34B2,0x87DEC0E3,0x222A710A,0xCD6AAFED,0xEC13BE19,0x1938DF08,0xC2829A31,
+};
+
+/* modp4096: 4 teeth spaced 76 bits apart */
+static const uint32_t dh_comb_entries_modp4096[CC_DH_COMB_ENTRIES_COUNT*128] = {
+	/* T[1] */
+	0x00000002,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	/* T[2] */
+	0x30944B2A,0x13992E7C,0x50CA8FB5,0x05D981BA,0x978BDBE0,0x6D6664F3,0x41928FDA,0x539698D3,
+	0x66A98945,0x75948962,0xD956FD80,0x1E4F49A2,0x8CF77EDD,0xB856D425,0xAC76D078,0x6C673D0A,
+	0x8DF61440,0xCC275066,0xB03A93E2,0xCFCB5898,0x7DE04CFA,0xDCDB4966,0xBA91CE29,0x95FA8811,
+	0x1018A191,0xDA2B3F8A,0xEA39F9AA,0x7084E146,0x527C8C3E,0x4940BE02,0x7134C3B7,0x77C63C07,
+	0xB87A6E29,0x88A1A060,0x7B7A0DF2,0x42251282,0x69777511,0x11066EEF,0x77060BFC,0xFB1DAA0A,
+	0x40DEB0A9,0x5C147305,0x4F191CEB,0x9115ED48,0x7DD8B78E,0x38BE9734,0x85676948,0x1DF1F991,
+	0xA3DF9DA2,0xCF1735E8,0x60C5CF2A,0xDE27CEAC,0xA024F01F,0xE829D6AE,0xED29B3F3,0xCE9EA7C3,
+	0x85E27AB1,0x0327E0D4,0x7CFF8601,0x111F02E7,0xF028F218,0x40C24568,0x86EEF87C,0x3EA5870B,
+	0xEDF74272,0xC89BDABA,0xC9A4C76F,0x41F62283,0xCFA2B548,0x9B84A03B,0x782F378F,0xAFCAEA7B,
+	0xB81EFB50,0xE6241406,0xD300CC5E,0x1E57E663,0x5E442C44,0x33A251B6,0xF160CBC5,0x6C8F59BC,
+	0x64E6F3B6,0x031B54F7,0x7BEB1F01,0x30D78404,0x45B971C8,0xCD68ACE7,0x57DD7C81,0x9DEAC0DC,
+	0x4EEEAB07,0x208BD216,0x0CE9D84E,0x83032E61,0x34E80F26,0xE5B825CD,0xBA2950A2,0xAAE029A7,
+	0x999627BE,0x600C7BFC,0x6CC699B8,0xE1C10293,0x99831E09,0x97947F76,0x9525F558,0x85109CA4,
+	0xFA466915,0x3F8FC7C1,0x7437AAF4,0x4E91E8F0,0xAB9784AB,0x425D47B8,0x181F97C4,0xE38AFD60,
+	0x5739941E,0x8B9E1B2D,0x6D9A0B48,0x4663E2E2,0x51922204,0xCF962C8F,0xC66E5DA5,0xD1CECCEF,
+	0x8D1B0FED,0x6B5C3673,0x785FB9D6,0x009D6688,0x04E9A4E5,0x1A9E70D0,0x05DDEB18,0x048BC759,
+	/* T[3] */
+	0x61289654,0x27325CF8,0xA1951F6A,0x0BB30374,0x2F17B7C0,0xDACCC9E7,0x83251FB4,0xA72D31A6,
+	0xCD53128A,0xEB2912C4,0xB2ADFB00,0x3C9E9345,0x19EEFDBA,0x70ADA84B,0x58EDA0F1,0xD8CE7A15,
+	0x1BEC2880,0x984EA0CD,0x607527C5,0x9F96B131,0xFBC099F5,0xB9B692CC,0x75239C53,0x2BF51023,
+	0x20314323,0xB4567F14,0xD473F355,0xE109C28D,0xA4F9187C,0x92817C04,0xE269876E,0xEF8C780E,
+	0x70F4DC52,0x114340C1,0xF6F41BE5,0x844A2504,0xD2EEEA22,0x220CDDDE,0xEE0C17F8,0xF63B5414,
+	0x81BD6153,0xB828E60A,0x9E3239D6,0x222BDA90,0xFBB16F1D,0x717D2E68,0x0ACED290,0x3BE3F323,
+	0x47BF3B44,0x9E2E6BD1,0xC18B9E55,0xBC4F9D58,0x4049E03F,0xD053AD5D,0xDA5367E7,0x9D3D4F87,
+	0x0BC4F563,0x064FC1A9,0xF9FF0C02,0x223E05CE,0xE051E430,0x81848AD1,0x0DDDF0F8,0x7D4B0E17,
+	0xDBEE84E4,0x9137B575,0x93498EDF,0x83EC4507,0x9F456A90,0x37094077,0xF05E6F1F,0x5F95D4F6,
+	0x703DF6A1,0xCC48280D,0xA60198BD,0x3CAFCCC7,0xBC885888,0x6744A36C,0xE2C1978A,0xD91EB379,
+	0xC9CDE76C,0x0636A9EE,0xF7D63E02,0x61AF0808,0x8B72E390,0x9AD159CE,0xAFBAF903,0x3BD581B8,
+	0x9DDD560F,0x4117A42C,0x19D3B09C,0x06065CC2,0x69D01E4D,0xCB704B9A,0x7452A145,0x55C0534F,
+	0x332C4F7D,0xC018F7F9,0xD98D3370,0xC3820526,0x33063C13,0x2F28FEED,0x2A4BEAB1,0x0A213949,
+	0xF48CD22B,0x7F1F8F83,0xE86F55E8,0x9D23D1E0,0x572F0956,0x84BA8F71,0x303F2F88,0xC715FAC0,
+	0xAE73283D,0x173C365A,0xDB341691,0x8CC7C5C4,0xA3244408,0x9F2C591E,0x8CDCBB4B,0xA39D99DF,
+	0x1A361FDB,0xD6B86CE7,0xF0BF73AC,0x013ACD10,0x09D349CA,0x353CE1A0,0x0BBBD630,0x09178EB2,
+	/* T[4] */
+	0xABB38B2A,0xB4F96A1A,0x991FA5FF,0xEE8B0EEB,0x56C50242,0x32C8E42B,0x621D0A89,0x54327541,
+	0x4E75CF86,0x91950270,0xBEC96A46,0x2620733F,0xC43FB7AD,0x7F1B238B,0x1264D933,0xDED9B5DC,
+	0xCC15B4A9,0x3B3C7A7E,0x176D66CA,0xDFFAFF84,0xBD284216,0xF62ABC80,0x453F1C10,0x74A69FDF,
+	0xEBB5830A,0x9B1C5427,0xB65D1B66,0xD233E586,0x344FC852,0x118290DE,0x1AEC7782,0xC042BC65,
+	0x886FF8A2,0x99B5193A,0x5C5C3517,0x2713DACA,0x4D46FFDB,0x1978DFC5,0xC2254BAC,0x8DB34FB9,
+	0x967C9011,0x417384F0,0x5AD6CF9E,0x8ADBF77D,0x2BFE56C3,0xEE79107A,0xC95DBFC5,0x4EC03069,
+	0x0E8074DB,0x1C703D1A,0x7AB4B32C,0xE31CA081,0xED9BF381,0x65055D2D,0x61CE7BCF,0x4B22211F,
+	0x0F317168,0xA41D4BEF,0xC9885159,0x188ACCB0,0x1CA9CEFD,0x94CF4D52,0xE9C70FE9,0xE4F5D34C,
+	0x6CEC02EE,0x5D92176D,0xD08122DE,0x8DEA28AB,0xCB5DF85B,0x7372D679,0x37F45A4C,0xA84EF046,
+	0xBB07142F,0x57ED8B67,0x0B4A8AF1,0x500D5559,0x0DFB52FC,0x25316EB6,0x55FF5354,0x8511A4D0,
+	0x17987571,0xEAC3B96C,0xE45F1EF5,0x86311F8E,0xB3548B81,0x7E8632F9,0xC2C211C7,0x0A1B15CA,
+	0xF283D036,0xADE34EDE,0xA3D33CCE,0xD7F4E51B,0x81D52339,0x0AE6D6E6,0xD16D5276,0xBDD09F3F,
+	0x54DD9796,0x416F705D,0x298E5C95,0x555F0E75,0x5E793498,0xC2EE8050,0x1FC80A90,0xB5187147,
+	0x197E9739,0xE1BCF436,0xF3E73344,0x7C8DCA52,0x40124398,0x3114811C,0xB1DE5417,0x6C6383BA,
+	0x0DECD757,0xED00BC96,0xB4976BD4,0xA74A505B,0x2A00DC0C,0x2374300A,0xA80DADCE,0xE29AF1CD,
+	0x543F9718,0x1FFB3FA4,0x51FA9E1A,0xA2E4EBBA,0xF157ECD3,0xA8281A44,0x341A8F2C,0x770E9936,
+	/* T[5] */
+	0x57671654,0x69F2D435,0x323F4BFF,0xDD161DD7,0xAD8A0485,0x6591C856,0xC43A1512,0xA864EA82,
+	0x9CEB9F0C,0x232A04E0,0x7D92D48D,0x4C40E67F,0x887F6F5A,0xFE364717,0x24C9B266,0xBDB36BB8,
+	0x982B6953,0x7678F4FD,0x2EDACD94,0xBFF5FF08,0x7A50842D,0xEC557901,0x8A7E3821,0xE94D3FBE,
+	0xD76B0614,0x3638A84F,0x6CBA36CD,0xA467CB0D,0x689F90A5,0x230521BC,0x35D8EF04,0x808578CA,
+	0x10DFF145,0x336A3275,0xB8B86A2F,0x4E27B594,0x9A8DFFB6,0x32F1BF8A,0x844A9758,0x1B669F73,
+	0x2CF92023,0x82E709E1,0xB5AD9F3C,0x15B7EEFA,0x57FCAD87,0xDCF220F4,0x92BB7F8B,0x9D8060D3,
+	0x1D00E9B6,0x38E07A34,0xF5696658,0xC6394102,0xDB37E703,0xCA0ABA5B,0xC39CF79E,0x9644423E,
+	0x1E62E2D0,0x483A97DE,0x9310A2B3,0x31159961,0x39539DFA,0x299E9AA4,0xD38E1FD3,0xC9EBA699,
+	0xD9D805DD,0xBB242EDA,0xA10245BC,0x1BD45157,0x96BBF0B7,0xE6E5ACF3,0x6FE8B498,0x509DE08C,
+	0x760E285F,0xAFDB16CF,0x169515E2,0xA01AAAB2,0x1BF6A5F8,0x4A62DD6C,0xABFEA6A8,0x0A2349A0,
+	0x2F30EAE3,0xD58772D8,0xC8BE3DEB,0x0C623F1D,0x66A91703,0xFD0C65F3,0x8584238E,0x14362B95,
+	0xE507A06C,0x5BC69DBD,0x47A6799D,0xAFE9CA37,0x03AA4673,0x15CDADCD,0xA2DAA4EC,0x7BA13E7F,
+	0xA9BB2F2D,0x82DEE0BA,0x531CB92A,0xAABE1CEA,0xBCF26930,0x85DD00A0,0x3F901521,0x6A30E28E,
+	0x32FD2E73,0xC379E86C,0xE7CE6689,0xF91B94A5,0x80248730,0x62290238,0x63BCA82E,0xD8C70775,
+	0x1BD9AEAE,0xDA01792C,0x692ED7A9,0x4E94A0B7,0x5401B819,0x46E86014,0x501B5B9C,0xC535E39B,
+	0xA87F2E31,0x3FF67F48,0xA3F53C34,0x45C9D774,0xE2AFD9A7,0x50503489,0x68351E59,0xEE1D326C,
+	/* T[6] */
+	0x221925A9,0x2172F2EB,0xB53C5513,0x8AE53F72,0x014B18A8,0xE4C149A0,0xB8040AEC,0x1388041F,
+	0xF5D404D4,0x9A41A4B7,0x16C5B460,0x000BAC20,0x4ABEA838,0x7A8A5A29,0x0921ADEF,0x8C214273,
+	0x0B0114C1,0x8BD29D60,0x309C4D9F,0x9CE5812B,0xE616E66C,0xC49755D8,0xEBA8F18E,0xEBAA3FC6,
+	0x0758D225,0x638D3362,0x3D5BBF0F,0xD072DBC6,0x74F31444,0x88320835,0xF6207D3F,0x8E3ADBA7,
+	0x941EEC30,0x1748600B,0x85D3B1C1,0x38D9B661,0xAC140F12,0x4FB680B1,0x91668378,0x72A9BDAB,
+	0x4D321867,0x2C01C360,0x11D49012,0xE36C9BED,0x3907AA51,0x711AC125,0x8E2A4867,0x0111A74A,
+	0xD13D4569,0x5E9232BA,0xD806C398,0x0A8216D4,0x7C649C18,0xB5F57ECE,0xE033F96B,0x40EF9476,
+	0xF5EA1EF0,0x1C562C4D,0x70646CE8,0x5428EA97,0xC1424287,0x709256A9,0x84AC08B6,0x517053A9,
+	0xF1B0EFBE,0x5BE9C8DF,0x34724A9B,0xEA791972,0x54EEE433,0x2DC40950,0x9937D5BA,0xA1161BAE,
+	0xDCF7FF46,0xE557CA18,0x5AE38D19,0xF39CF2D1,0x852BA08F,0x7305A988,0x3191F466,0xEF339C51,
+	0x87A2A9CD,0x183B6F0D,0xBCFDC885,0xAA753989,0x87E168F4,0xF38E9CE9,0xB84E4191,0x818B371E,
+	0x86DE3893,0xBDEB5D3B,0x77909612,0xA2445D8D,0x315F27C5,0xDA495694,0x027F9ED2,0x0F68BC28,
+	0x16FD91F1,0x8D58509C,0x8A838712,0x5EACE5F8,0xFF172890,0x14BEC3A0,0x88D7058A,0xB367F2B8,
+	0xD46AE3EB,0xF2ED1461,0x383C194B,0x12E10424,0xDD0DE023,0xAA105DB1,0x0F35DA9E,0x375A2F0E,
+	0xC3C75536,0x7494BD5B,0x72EF80F6,0xCF482114,0x404280A3,0xFEF2BBDF,0x48C2BADA,0xA3B9FA50,
+	0x31028547,0x9D4279EA,0x7B6F0788,0xBE1649EA,0x07662D1F,0xAA64CFE5,0x9CE2E71D,0x71B32CB5,
+	/* T[7] */
+	0x44324B52,0x42E5E5D6,0x6A78AA26,0x15CA7EE5,0x02963151,0xC9829340,0x700815D9,0x2710083F,
+	0xEBA809A8,0x3483496F,0x2D8B68C1,0x00175840,0x957D5070,0xF514B452,0x12435BDE,0x184284E6,
+	0x16022983,0x17A53AC0,0x61389B3F,0x39CB0256,0xCC2DCCD9,0x892EABB1,0xD751E31D,0xD7547F8D,
+	0x0EB1A44B,0xC71A66C4,0x7AB77E1E,0xA0E5B78C,0xE9E62889,0x1064106A,0xEC40FA7F,0x1C75B74F,
+	0x283DD861,0x2E90C017,0x0BA76382,0x71B36CC3,0x58281E24,0x9F6D0163,0x22CD06F0,0xE5537B57,
+	0x9A6430CE,0x580386C0,0x23A92024,0xC6D937DA,0x720F54A3,0xE235824A,0x1C5490CE,0x02234E95,
+	0xA27A8AD2,0xBD246575,0xB00D8730,0x15042DA9,0xF8C93830,0x6BEAFD9C,0xC067F2D7,0x81DF28ED,
+	0xEBD43DE0,0x38AC589B,0xE0C8D9D0,0xA851D52E,0x8284850E,0xE124AD53,0x0958116C,0xA2E0A753,
+	0xE361DF7C,0xB7D391BF,0x68E49536,0xD4F232E4,0xA9DDC867,0x5B8812A0,0x326FAB74,0x422C375D,
+	0xB9EFFE8D,0xCAAF9431,0xB5C71A33,0xE739E5A2,0x0A57411F,0xE60B5311,0x6323E8CC,0xDE6738A2,
+	0x0F45539B,0x3076DE1B,0x79FB910A,0x54EA7313,0x0FC2D1E9,0xE71D39D3,0x709C8323,0x03166E3D,
+	0x0DBC7127,0x7BD6BA77,0xEF212C25,0x4488BB1A,0x62BE4F8B,0xB492AD28,0x04FF3DA5,0x1ED17850,
+	0x2DFB23E2,0x1AB0A138,0x15070E25,0xBD59CBF1,0xFE2E5120,0x297D8741,0x11AE0B14,0x66CFE571,
+	0xA8D5C7D7,0xE5DA28C3,0x70783297,0x25C20848,0xBA1BC046,0x5420BB63,0x1E6BB53D,0x6EB45E1C,
+	0x878EAA6C,0xE9297AB7,0xE5DF01EC,0x9E904228,0x80850147,0xFDE577BE,0x918575B5,0x4773F4A0,
+	0x62050A8F,0x3A84F3D4,0xF6DE0F11,0x7C2C93D4,0x0ECC5A3F,0x54C99FCA,0x39C5CE3B,0xE366596B,
+	/* T[8] */
+	0xF0BB4C17,0x97BD8A93,0x17839292,0xF20F5CB0,0xB7E35868,0xC725608E,0x51ED4C32,0xB20E21DE,
+	0x92D263F2,0x4F18276E,0x83EADBB0,0x45F36D2B,0xBF9D9A31,0x15E65A3C,0x47FF7606,0x339DEE07,
+	0x691B4441,0x6D8B7DCD,0x170A1E18,0xF82E92BD,0x0AA25612,0xDA0DB407,0xAE57F85C,0xD33AF65A,
+	0x67ED04E1,0x5A7F038F,0x9F883AFF,0x4780DA7C,0xAAB5BFA0,0xDFDE976F,0x7DBC0B34,0xC55ED48B,
+	0x0C4CFC74,0x14215DFB,0x95407F0F,0x6AC99F6D,0x24D553E6,0x5C59F303,0xF0FC5820,0xF0E361BD,
+	0x7F4B9536,0x41E91F15,0x08ACF93B,0xC5A6ED22,0xB998E823,0xAB6210C4,0xDCF6C488,0xACFA1689,
+	0xA9A1CE15,0xB91A7AD4,0xADAABB2F,0xF7DF70F5,0x33F4D8C3,0x176A015F,0x2CA9DA9F,0x8EA4BE06,
+	0x534F093D,0xA5739B29,0x80C46712,0x8F8A6011,0x4C827106,0x9560985E,0x87E35E47,0xD017D713,
+	0x0E6C156D,0xA41ABA28,0xCFBA4CE6,0x3D951F4D,0x03CE51E6,0xE5F69DDA,0x55AFABB4,0xCDB6380F,
+	0x9734F631,0x9F22ED4D,0xE48490A0,0xE5F68B92,0x6D322AD4,0x0B9F152E,0x9687D6BA,0x14B6C9AA,
+	0xC5925B65,0x127FE7E7,0x8E3F7337,0xD9338224,0xEF35A80F,0x6780697B,0xEAD6E069,0xED9AFFE2,
+	0xB81331F3,0x364A4267,0x3B6824E2,0x9703C79C,0xF99BD2D9,0x95D95791,0x0CF18CC7,0x3967E78E,
+	0x1EDE6BED,0x5900E3F5,0x2F053812,0x17814BFC,0xB3B0AA78,0xE83E7818,0x36AD2EE6,0x0DF89D3F,
+	0xDB433E00,0xF1594815,0xD1A2A34B,0x9E68B51A,0x506B2C62,0x2132979A,0x48540624,0xC42DC2A0,
+	0x5160A88B,0x67B09C5A,0x9F3D2C86,0x61EF5B8F,0x299A2DF5,0x502FAA8F,0xC0425CC3,0xD78219C3,
+	0x781FE6C6,0x192A8FAC,0x3F4DB4D6,0x8304051B,0x39013399,0x09394A37,0x065BB0C5,0x8BF062EA,
+	/* T[9] */
+	0xE176982F,0x2F7B1527,0xFB00F38B,0x962A8396,0xDF1FF042,0x074B0940,0x164ABAA4,0xD0675924,
+	0x4FF46D3B,0xCE29BDB5,0xE6656F43,0xD3CAFCE0,0xB0585CB2,0x0C6B8B08,0x3EA3041F,0x44003A88,
+	0x31A5C4E0,0x4164654B,0xDFA87BD3,0xC7E0CC32,0xF585E17F,0x858C6BF9,0x57D161C0,0xCABA29DA,
+	0xA505BCDA,0x8F7A1D54,0x88FB6A24,0x746D4CC4,0xEA769D04,0x25FA07C6,0x3DBDBB43,0x024C0F06,
+	0x71121212,0x0DD07FE3,0x815FF61D,0x8A106DBA,0x68AD973E,0x74D88A09,0x6D13050F,0xD8E473DB,
+	0x43BDE38B,0x0CC8B56A,0x96F8950A,0xCF6CC2EC,0x5BB6B03A,0x04A4F671,0x7B251EAD,0x817E2AA0,
+	0x79B993C6,0x8104FBA2,0x408287F3,0x20DB0FC5,0x1DC44FEA,0x10476DDE,0x7E4A8167,0x7153CD7F,
+	0xFFBC2DB3,0x975026CC,0xA482C1A7,0x942A4ECB,0x4028F302,0x3DC5ABB8,0x30AA022A,0xF7DA8C7B,
+	0x1887B0A7,0x9B025D43,0x14C9D59F,0x65B7B041,0x6EA29EBC,0xB61B159B,0xC0C9EC84,0x61D726A1,
+	0x9911D54B,0x601A0EA4,0x59BCCE77,0x1627B935,0xEE5CB31A,0x7C16A6B9,0x15012770,0x45CF1C29,
+	0x5CEDE88E,0xF26F7189,0x5266C4F1,0xC0F29840,0x93AEB81A,0x67F49DA9,0x65172A65,0x3C60D6BE,
+	0x4FA1112C,0x50319179,0x9A2C9C2E,0xAAA23214,0xF612D653,0xC29C6F7A,0xFD8D45F4,0xD9F586E5,
+	0x9C5918D4,0xF0014B31,0x712614E6,0xE5DA31A6,0xEB163509,0x21DDCC1F,0x12D0BE28,0x2DB8CE83,
+	0xC27FC412,0xD6B33374,0xFD0D592C,0x4885274B,0x3E77D9FE,0x5DDF79BE,0x23564A02,0x387A4FD3,
+	0xB0623CE0,0x9F362E46,0x714015F1,0xD4499D6B,0xC500570C,0x4F154CA4,0x45711E64,0xACF874E1,
+	0x65D80119,0x0952D150,0xFDBF4CDB,0x4141A7AA,0x5099A4FE,0x4962B9CC,0x0CB7618A,0x17E0C5D4,
+	/* T[10] */
+	0x0D4CB171,0x8F2E223E,0x3B54A315,0xCF639646,0xA780FCEE,0xB42725CA,0x8FBD71D7,0x8F269C5F,
+	0x484D572A,0xAE02E19A,0x973A500B,0x61E5A137,0x8F09879D,0xDC5F1F33,0x23479D97,0x1B2D97AF,
+	0xC91688A3,0x33E40D2F,0x6C90C077,0xD1CCA6FC,0xF4B071DC,0xD6B0812E,0x330033B6,0x17B51B80,
+	0xDE81F9FF,0xB3DC55B1,0x9415CEF5,0x367C1FC5,0x93EF9E2C,0x3D6B0C6C,0xC40C0C97,0x286DA570,
+	0x2299E32B,0xEA1A786D,0x9A935913,0x2671CD5C,0xAF8D1A1E,0xBF170BE9,0x5083A645,0x7C65956F,
+	0x06CEA9C5,0xC73F4253,0x676605AB,0x6A5C3B63,0x6BE136BE,0x4D4A023D,0x8069F675,0x2FE9C85A,
+	0x44AA43A9,0x34F0CBC6,0xF6F5B44C,0x6AFC5D12,0xAC7D97A2,0xAAFDF261,0x48FD7F1C,0x6D3716F3,
+	0x0E3A7C4C,0xE330723C,0x6D4A68EF,0x7E20EB82,0xC47D726E,0xF61906F3,0xB54DED94,0xE3A93D9B,
+	0x45659394,0xBFDD71A9,0xF972BBAF,0x01A8D81F,0xE4232DB5,0xD70AF02A,0xCE020EA4,0xF25B8F50,
+	0x6D1E9794,0x1D1079AB,0x8B5C7D2E,0xF0065E20,0x15FA5D1B,0x5B52A97B,0x2E2533A6,0x2C43E95D,
+	0xB2FD84D4,0x63AAB314,0x7A6A4E77,0x88A7C476,0xD0CCDDE1,0xA172901A,0x831C55C8,0x68D74742,
+	0x614CBB5C,0xA39A1BB3,0xB607FD73,0x90CADEA9,0xBDEC4F79,0x65B375C0,0x2BF28E0B,0x5A52E82C,
+	0x7DB95915,0xEBE1DD8A,0xC74EA43D,0x6C106CCD,0xC8DA958B,0xCAE7CEF3,0x997CF96C,0xE2B2B8E9,
+	0xE894849F,0xC96887EB,0x29E07FDA,0x38B3338D,0x8601A173,0xBBF84612,0x750A6EBB,0x759BCC59,
+	0xDCB9D6E1,0xBC8B0CB7,0x59DE6B81,0xFD271C77,0x6F151BA6,0xC49156E2,0xF16A7A83,0x3135649C,
+	0x60B9120C,0xBEA5B8A6,0xC1CC1AF8,0x39AAD2B8,0x3C511B4A,0x9B2BCB5A,0x3259FB7E,0x2C7367EC,
+	/* T[11] */
+	0x1A9962E2,0x1E5C447C,0x76A9462B,0x9EC72C8C,0x4F01F9DD,0x684E4B95,0x1F7AE3AF,0x1E4D38BF,
+	0x909AAE55,0x5C05C334,0x2E74A017,0xC3CB426F,0x1E130F3A,0xB8BE3E67,0x468F3B2F,0x365B2F5E,
+	0x922D1146,0x67C81A5F,0xD92180EE,0xA3994DF8,0xE960E3B9,0xAD61025D,0x6600676D,0x2F6A3700,
+	0xBD03F3FE,0x67B8AB63,0x282B9DEB,0x6CF83F8B,0x27DF3C58,0x7AD618D9,0x8818192E,0x50DB4AE1,
+	0x4533C656,0xD434F0DA,0x3526B227,0x4CE39AB9,0x5F1A343C,0x7E2E17D3,0xA1074C8B,0xF8CB2ADE,
+	0x0D9D538A,0x8E7E84A6,0xCECC0B57,0xD4B876C6,0xD7C26D7C,0x9A94047A,0x00D3ECEA,0x5FD390B5,
+	0x89548752,0x69E1978C,0xEDEB6898,0xD5F8BA25,0x58FB2F44,0x55FBE4C3,0x91FAFE39,0xDA6E2DE6,
+	0x1C74F898,0xC660E478,0xDA94D1DF,0xFC41D704,0x88FAE4DC,0xEC320DE7,0x6A9BDB29,0xC7527B37,
+	0x8ACB2729,0x7FBAE352,0xF2E5775F,0x0351B03F,0xC8465B6A,0xAE15E055,0x9C041D49,0xE4B71EA1,
+	0xDA3D2F29,0x3A20F356,0x16B8FA5C,0xE00CBC41,0x2BF4BA37,0xB6A552F6,0x5C4A674C,0x5887D2BA,
+	0x65FB09A8,0xC7556629,0xF4D49CEE,0x114F88EC,0xA199BBC3,0x42E52035,0x0638AB91,0xD1AE8E85,
+	0xC29976B8,0x47343766,0x6C0FFAE7,0x2195BD53,0x7BD89EF3,0xCB66EB81,0x57E51C16,0xB4A5D058,
+	0xFB72B22A,0xD7C3BB14,0x8E9D487B,0xD820D99B,0x91B52B16,0x95CF9DE7,0x32F9F2D9,0xC56571D3,
+	0xD129093F,0x92D10FD7,0x53C0FFB5,0x7166671A,0x0C0342E6,0x77F08C25,0xEA14DD77,0xEB3798B2,
+	0xB973ADC2,0x7916196F,0xB3BCD703,0xFA4E38EE,0xDE2A374D,0x8922ADC4,0xE2D4F507,0x626AC939,
+	0xC1722418,0x7D4B714C,0x839835F1,0x7355A571,0x78A23694,0x365796B4,0x64B3F6FD,0x58E6CFD8,
+	/* T[12] */
+	0x2DB24503,0xDE910E4F,0xBCE38B91,0x719D68F4,0xF42A980C,0x73729D80,0x814D3A0F,0x7985D1F7,
+	0xCDF8EE8F,0xF72CC1B6,0xC28147D7,0x8A114D5B,0xF93AAC5D,0xEEB30C29,0x399F3CA0,0x9DB24E1C,
+	0x3FEAF6E5,0xD9CD98F1,0x28176EF9,0x91F59320,0xAD917945,0xC408163C,0xCB5FF766,0xA486F298,
+	0xE18A2713,0x13FB8FA1,0x42861605,0x6092F1E9,0x837967ED,0xF23BEBA1,0xF8B57DA6,0xDB354C09,
+	0x1C48E2B3,0xAC1694F2,0x13317529,0x7EBDED93,0x242450ED,0xD447F8E4,0x2EA835EB,0x876624DA,
+	0xA59ACF75,0x57A426AA,0x745DA676,0xA1AE557A,0xC63C1337,0x722C322D,0xD50C9662,0x32FA78D8,
+	0x520E276A,0x0D3713E9,0x25569240,0x54761850,0xF5894C85,0x3468A705,0x31669613,0x2CFA4C8D,
+	0x5FE89CA4,0xC34CF515,0x5AB0DD15,0x749261D4,0x96368080,0xAD383E88,0x495A6EF2,0x3E4EF689,
+	0xE2267E32,0x054B59E3,0xCCC2E095,0x08996386,0x06FED1A1,0xB5CC1D9D,0x0B2C689B,0x8043AF0F,
+	0xDB8D9146,0x8C77AB69,0x330911CA,0xA39D0404,0x205A530F,0x84A91C9A,0xE13E3AE5,0x2B063614,
+	0x082BA746,0x3F5EBE44,0x26341F7C,0x6609B1DD,0x55D6B95A,0x2773BFD2,0xB1CC0799,0x074132D2,
+	0xBE4BD46B,0xCF5C43E7,0xAFAA6E6A,0x2B44CA27,0xDA10FBD0,0x5B7939C9,0x6669F080,0x933A5661,
+	0x90D1EF35,0xC8996BD7,0x268F4A46,0x778DA439,0x9E1E589B,0x944343C2,0x2057F017,0x19B246A1,
+	0x65EB5EE7,0x33E4316E,0xBF73272B,0xEAC2657F,0x5BCCF26E,0x1AE2D26E,0x0049A901,0x1D5B6D0D,
+	0x55BC3A5E,0x5AF67650,0xBA8F3928,0xCB29485C,0x67D5881B,0xDB3D6EDC,0x87E29526,0x3F412BB6,
+	0x2C1BF348,0x38C8E312,0x18E2A1E3,0x8A3B9110,0x0A7411D7,0x9D18D099,0x29DFBE7C,0xE3375EDF,
+	/* T[13] */
+	0x5B648A07,0xBD221C9E,0x45C0E589,0x95469C20,0x57AE6F89,0x5FE58325,0x750A965D,0x5F56B956,
+	0xC6418275,0x1E52F245,0x63924793,0x5C06BD41,0x2392810B,0xBE04EEE3,0x21E29154,0x1828FAB2,
+	0xDF452A29,0x19E89B92,0x01C31D96,0xFB6ECCF9,0x3B6427E4,0x59813065,0x91E15FD4,0x6D522256,
+	0x9840013E,0x02733579,0xCEF72030,0xA6917B9D,0x9BFDED9E,0x4AB4B02A,0x33B0A027,0x2DF8FE03,
+	0x9109DE90,0x3DBAEDD1,0x7D41E252,0xB1F90A05,0x674B914C,0x64B495CB,0xE86AC0A6,0x05E9FA13,
+	0x905C5809,0x383EC494,0x6E59EF80,0x877B939D,0x74FD0662,0x92393943,0x6B50C260,0x8D7EEF3E,
+	0xCA92466F,0x293E2DCB,0x2FDA3614,0xDA085E7A,0xA0ED376C,0x4A44B92B,0x87C3F84F,0xADFEEA8D,
+	0x18EF5480,0xD302DAA5,0x585BADAD,0x5E3A5251,0xD39111F6,0x6D74F80C,0xB3982380,0xD448CB66,
+	0xBFFC8230,0x5D639CBA,0x0EDAFCFC,0xFBC038B3,0x75039E31,0x55C61521,0x2BC36652,0xC6F214A1,
+	0x21C30B74,0x3AC38ADD,0xF6C5D0CB,0x9174AA17,0x54AD038F,0x6E2AB591,0xAA6DEFC7,0x726DF4FD,
+	0xE2208050,0x4C2D1E41,0x82501D7C,0xDA9EF7B1,0x60F0DAAF,0xE7DB4A56,0xF30178C4,0x6FAD3C9D,
+	0x5C12561A,0x82559479,0x82B12F3F,0xD324372B,0xB6FD2840,0x4DDC33EA,0xB07E0D66,0x8D9A648C,
+	0x80401F65,0xCF325AF6,0x603A394F,0xA5F2E220,0xBFF19150,0x79E76373,0xE6264089,0x452C2146,
+	0xD7D005E0,0x5BC90625,0xD8AE60EB,0xE1388815,0x553B6616,0x513FEF66,0x93418FBC,0xEAD5A4AC,
+	0xB9196084,0x85C1E232,0xA7E42F35,0xA6BD7705,0x41770B59,0x6530D53F,0xD4B18F2B,0x7C7698C6,
+	0xCDD01A1C,0x488F781B,0xB0E926F5,0x4FB0BF94,0xF37F617A,0x7121C68F,0x53BF7CF9,0xC66EBDBE,
+	/* T[14] */
+	0xF256EE73,0xC95E0A42,0x0727C4D9,0xB446CF62,0xB7D3B812,0xB33F9D13,0x11E83C88,0x5915B41B,
+	0x97570897,0x39C283A5,0x87FB8FAB,0x3E9562B7,0x1D8845B2,0x12374CF1,0x47A8D79A,0x62F9D35D,
+	0x8EC1759A,0x407B2032,0x3BE37D40,0xE4E3EE10,0x8066E14D,0x040CADFA,0x38ADA40F,0xD54A36C2,
+	0x86CE1A5B,0x735F559D,0x80521CAF,0xDEC17047,0x79AEDB86,0x1AF1EC79,0x86CE5AC8,0x12EAFB6C,
+	0xBACD4176,0x81CAD658,0x67A1E2AB,0xC84851AB,0x04BFA22A,0x53D9D853,0xE89100EA,0xE1EB2B21,
+	0x69FA7705,0x1C9C1D61,0x61C49CDC,0xB4C874D7,0xB22A8433,0x999FACF3,0x1535243D,0xEDFF9F87,
+	0xA2F3BB3C,0xC75E2743,0xEE8DD8EC,0x4B0DDD1D,0x337A386A,0x3A8CC358,0x240F4F39,0x9B4DAD86,
+	0xD7470D8C,0x08173C21,0x648E1B0B,0x23E471B9,0x12532E90,0x2A3DCFDA,0x74AE18FD,0xC96D8565,
+	0x607B69D2,0xFC83FB5D,0xD8CF4AC0,0x22D91670,0x2CFC22AB,0x2AA40346,0x51E4CE57,0xC8D0642F,
+	0x14CCCFDC,0x6AD2B991,0x1F9A486C,0xF207D4F0,0xA94B55C6,0x14C269AD,0x94786B39,0x5DF0BF69,
+	0xC1690641,0x5C7163D5,0xCC3A82C2,0xD1D75763,0x5A00CBFB,0xBD7DE8C0,0x4104B792,0x655F1916,
+	0xCB68C4CA,0x8D7A63D1,0x3B27D50E,0xAD1755E8,0xB1D5C9FF,0xBB5CC64F,0xD8AC90D8,0x19B1D062,
+	0x8EE1AAD2,0xBE8CBFFA,0x78F5D0BE,0xF7E6BB1B,0xAE445104,0x30CEA8BA,0x4BFA15CD,0x35377469,
+	0xC8B8C4D7,0x59A13475,0x19D457E0,0xA32A0601,0x09F4A68F,0xF1ED20EC,0x90EBAEC0,0x61F6C907,
+	0xDEEDAF70,0xC32015E4,0xEF8AD218,0xF8B25591,0x0759946A,0xAAE73172,0xD9DC6DB1,0x9F25B473,
+	0x37F936B5,0x366AD150,0xF043F1CB,0x91C9DEF1,0x2FF7259E,0xB971CC18,0xB62184A0,0x5CB85EA3,
+	/* T[15] */
+	0xE4ADDCE6,0x92BC1485,0x0E4F89B3,0x688D9EC4,0x6FA77025,0x667F3A27,0x23D07911,0xB22B6836,
+	0x2EAE112E,0x7385074B,0x0FF71F56,0x7D2AC56F,0x3B108B64,0x246E99E2,0x8F51AF34,0xC5F3A6BA,
+	0x1D82EB34,0x80F64065,0x77C6FA80,0xC9C7DC20,0x00CDC29B,0x08195BF5,0x715B481E,0xAA946D84,
+	0x0D9C34B7,0xE6BEAB3B,0x00A4395E,0xBD82E08F,0xF35DB70D,0x35E3D8F2,0x0D9CB590,0x25D5F6D9,
+	0x759A82EC,0x0395ACB1,0xCF43C557,0x9090A356,0x097F4455,0xA7B3B0A6,0xD12201D4,0xC3D65643,
+	0xD3F4EE0B,0x39383AC2,0xC38939B8,0x6990E9AE,0x64550867,0x333F59E7,0x2A6A487B,0xDBFF3F0E,
+	0x45E77679,0x8EBC4E87,0xDD1BB1D9,0x961BBA3B,0x66F470D4,0x751986B0,0x481E9E72,0x369B5B0C,
+	0xAE8E1B19,0x102E7843,0xC91C3616,0x47C8E372,0x24A65D20,0x547B9FB4,0xE95C31FA,0x92DB0ACA,
+	0xC0F6D3A5,0xF907F6BA,0xB19E9581,0x45B22CE1,0x59F84556,0x5548068C,0xA3C99CAE,0x91A0C85E,
+	0x29999FB9,0xD5A57322,0x3F3490D8,0xE40FA9E0,0x5296AB8D,0x2984D35B,0x28F0D672,0xBBE17ED3,
+	0x82D20C82,0xB8E2C7AB,0x98750584,0xA3AEAEC7,0xB40197F7,0x7AFBD180,0x82096F25,0xCABE322C,
+	0x96D18994,0x1AF4C7A3,0x764FAA1D,0x5A2EABD0,0x63AB93FF,0x76B98C9F,0xB15921B1,0x3363A0C5,
+	0x1DC355A4,0x7D197FF5,0xF1EBA17D,0xEFCD7636,0x5C88A209,0x619D5175,0x97F42B9A,0x6A6EE8D2,
+	0x917189AE,0xB34268EB,0x33A8AFC0,0x46540C02,0x13E94D1F,0xE3DA41D8,0x21D75D81,0xC3ED920F,
+	0xBDDB5EE0,0x86402BC9,0xDF15A431,0xF164AB23,0x0EB328D5,0x55CE62E4,0xB3B8DB63,0x3E4B68E7,
+	0x6FF26D6B,0x6CD5A2A0,0xE087E396,0x2393BDE3,0x5FEE4B3D,0x72E39830,0x6C430941,0xB970BD47,
+};
+
+/* ffdhe2048: 4 teeth spaced 56 bits apart */
+static const uint32_t dh_comb_entries_ffdhe2048[CC_DH_COMB_ENTRIES_COUNT*64] = {
+	/* T[1] */
+	0x00000002,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	/* T[2] */
+	0xBC7686D0,0x076B49DF,0x72508568,0x4277D5A1,0x67EE24B3,0x121876EC,0xDCDDD2C4,0x6DE0F390,
+	0x5847ABDF,0xD5249355,0x26AB7E4E,0x2F524496,0x2F06AE86,0x8C5EA44A,0x849F7B3B,0x001C10FA,
+	0x941E1A09,0x111DE278,0x691C2E09,0x84803727,0x21E367CA,0x5B7BDEFB,0x0D98F107,0x5AF34FC8,
+	0x365ED82D,0x060243F1,0xF31539F0,0x43C88A16,0x6A4C1B35,0x0E626AF7,0x53F03D9A,0x49A83CCA,
+	0x945291E3,0x28B6FA31,0xC85F34C5,0x8C94CF58,0xAEE7E0FD,0x13A7AE5A,0x7E8C060D,0x23C7BBC6,
+	0x8E169DEC,0xF7612FE1,0x1F967785,0x9C48EEA7,0xD9CF415D,0x8CEE4568,0xA6A19394,0x61718EED,
+	0x2219D224,0xA23A8E3E,0x2D727FA3,0x1AC12553,0xC31444DD,0xB96CA503,0xD8689E1A,0xD6355034,
+	0x64B0A9E1,0xD09622D0,0x56AD46EF,0x7849923D,0x48C4B764,0x344C3425,0xD475EC51,0x98F15054,
+	/* T[3] */
+	0x78ED0DA1,0x0ED693BF,0x8378AE38,0xFC84690A,0x0E29596B,0x5D3DA3B2,0x3CA521D5,0x1632F59E,
+	0x81CD37B9,0x6E9329EE,0x00E74F2A,0x9AA64E11,0x6F1ADB88,0x8A6E3661,0x1FB97277,0x6EC52358,
+	0x000804B0,0x6207C024,0x04407925,0x6AFD716D,0x55BC6224,0xABF0162D,0xB7BF26F5,0x078FB1A8,
+	0x8E846266,0xEEB5453E,0x85527F77,0xCE263976,0x21CF526E,0x4BBC2CA3,0xF4BB7FD2,0xD745C811,
+	0xE06AAA4B,0x20C12A13,0x5A108255,0xFB384610,0x69DFD988,0x44A8D2DA,0x1C3180A2,0xAF406B1C,
+	0x9CD572A2,0x396B4C64,0x013FD418,0xB32E77F9,0x549813EA,0xF5A895B2,0x7745C1C7,0xEF03FF05,
+	0x956F42CD,0x4DF36A79,0xF7D8896E,0xB8526742,0x618D4AC0,0xA645AC39,0x9C6D0839,0x02896A28,
+	0xFB341D2E,0xC872801C,0x861D50ED,0x40B6CE5A,0xEECE242E,0xBAA013F1,0xA8EBD8A2,0x31E2A0A9,
+	/* T[4] */
+	0x18E23B97,0x259E9602,0xC8406F1B,0x158FA464,0xB350F2F2,0x30DF822C,0x1E640C68,0x0E176F40,
+	0x8D869931,0x7C307DE5,0x5AF1C167,0xF3DA5E8C,0x224B1CA5,0x44A3A663,0x7A2CA0A0,0x6319C278,
+	0x95C76747,0x1218C07F,0xCEE92A52,0xC2D00173,0x59A78C79,0xD6AC2B31,0x5CBE9421,0x9698DA23,
+	0x891A67C0,0xB4BDE5C7,0xD0C4F5A4,0x38B4FEEB,0x50DD8EB5,0x69813F70,0xC11F54BD,0x1DDF21F8,
+	0xC76ADDF5,0x382430D5,0xD7E419CA,0xD51F6B2F,0xCF71F1A9,0x1A35B604,0xC60E5891,0xC46CF26C,
+	0x66CD4ADD,0x384CC8F5,0x6C8A3295,0x92744816,0xCBECEA6F,0xEE00A185,0x267CC951,0x165E8062,
+	0x1E016B84,0xE0395C8B,0xC48DECA1,0x5EDB0E33,0x23F3274D,0x73C158B2,0xC670D2EB,0x0A8012A5,
+	0x51EE8621,0xD1C61CBD,0xA79554DC,0xB10355BF,0xDFE93737,0x370267B4,0x57858B85,0xBE292C37,
+	/* T[5] */
+	0x31C4772F,0x4B3D2C04,0x2F58819E,0xA2B40691,0xA4EEF5E9,0x9ACBBA32,0xBFB1951D,0x569FECFC,
+	0xEC4B125C,0xBCAAFF0E,0x6973D55B,0x23B681FD,0x55A3B7C8,0xFAF83A93,0x0AD3BD40,0x34C08654,
+	0x035A9F2D,0x63FD7C32,0xCFDA71B7,0xE79D0605,0xC544AB82,0xA250AE99,0x560A6D2A,0x7EDAC65F,
+	0x33FB818C,0x4C2C88EB,0x40B1F6E1,0xB7FF2320,0xEEF2396E,0x01F9D594,0xCF19AE19,0x7FB3926E,
+	0x469B426F,0x3F9B975C,0x791A4C5F,0x8C4D7DBE,0xAAF3FAE1,0x51C4E22E,0xAB3625AA,0xF08AD868,
+	0x4E42CC85,0xBB427E8C,0x9B274A36,0x9F852AD7,0x38D3660E,0xB7CD4DEC,0x76FC2D42,0x58DDE1EE,
+	0x8D3E758D,0xC9F10713,0x260F636A,0x40863904,0x234B0FA1,0x1AEF1396,0x787D71DB,0x6B1EEF0A,
+	0xD5AFD5AC,0xCAD273F6,0x27ED6CC7,0xB22A555F,0x1D1723D4,0xC00C7B11,0xAF0B170A,0x7C52586E,
+	/* T[6] */
+	0x1B886520,0x2087B6D5,0x16365CCC,0x8E2400FF,0x2703AA43,0x390F6792,0x99468CB8,0xB7A24630,
+	0xAA23A162,0x530EB7C3,0xD37185E5,0x29ED871E,0x68339EE8,0x93A802F3,0xE436C650,0x45E7D561,
+	0xA5D08D9C,0xA923F104,0xE91476E3,0x6A6E7C13,0xECBA452C,0xB3E4F62A,0x93A656B5,0x42ED8C6A,
+	0x5D5AAA1C,0x9C592293,0xC8513550,0x14FA7D40,0xEB36913D,0xA2F42EA3,0x3C4D6018,0xCFBE886C,
+	0x3861049D,0x432021CC,0xEEC96D5F,0x1A1970C5,0x2497CD89,0x92DCC849,0xF60D7ECC,0xD0F157C8,
+	0x1E3A0F87,0x4C3BF915,0x1EE90D34,0xD66AF0AA,0xBA472025,0x8F64AE8E,0x24579033,0xA3793BBC,
+	0xD58A5278,0x84D6921A,0x4805DCA9,0x1D3CCF8C,0x22B62C77,0x85056055,0xBED929A5,0xFFC533CB,
+	0x2D57982F,0x7880416E,0xFD68EA29,0xD2AD0852,0xF3E79AEB,0x5DB0BC16,0x48449F94,0x09DE183A,
+	/* T[7] */
+	0x3710CA40,0x410F6DAA,0x2C6CB998,0x1C4801FE,0x4E075487,0x721ECF24,0x328D1970,0x6F448C61,
+	0x544742C5,0xA61D6F87,0xA6E30BCA,0x53DB0E3D,0xD0673DD0,0x275005E6,0xC86D8CA1,0x8BCFAAC3,
+	0x4BA11B38,0x5247E209,0xD228EDC7,0xD4DCF827,0xD9748A58,0x67C9EC55,0x274CAD6B,0x85DB18D5,
+	0xBAB55438,0x38B24526,0x90A26AA1,0x29F4FA81,0xD66D227A,0x45E85D47,0x789AC031,0x9F7D10D8,
+	0x70C2093B,0x86404398,0xDD92DABE,0x3432E18B,0x492F9B12,0x25B99092,0xEC1AFD99,0xA1E2AF91,
+	0x3C741F0F,0x9877F22A,0x3DD21A68,0xACD5E154,0x748E404B,0x1EC95D1D,0x48AF2067,0x46F27778,
+	0xAB14A4F1,0x09AD2435,0x900BB953,0x3A799F18,0x456C58EE,0x0A0AC0AA,0x7DB2534B,0xFF8A6797,
+	0x5AAF305F,0xF10082DC,0xFAD1D452,0xA55A10A5,0xE7CF35D7,0xBB61782D,0x90893F28,0x13BC3074,
+	/* T[8] */
+	0xB546736B,0xA76921F3,0xBC77DC54,0x8D6998B8,0x05454C6B,0x3CFF2E4E,0x33725E98,0xA2602E97,
+	0x4F489775,0xFA7BD641,0xBF5D8AB0,0xE6DA0124,0x343CC7E7,0x2B78114D,0x424EEB68,0x94BE9911,
+	0xB0E32F2A,0x6A876F01,0xB235877E,0x365698EA,0x0EE06AB8,0x7DFD2DE3,0xCBDC867C,0x7CE96AAB,
+	0x309639CB,0x40A8E723,0xFC007DE6,0x1C510E63,0x38485DBA,0xB347C75C,0x73E9ABF5,0x7B782245,
+	0x51F6D200,0x90D398A4,0xF52B8D1A,0x909774EC,0xE52BDBAF,0x463EF421,0xE55E7675,0x9924D7C7,
+	0x0DC91DCF,0x78224D6F,0x84182C77,0x6C2F00D0,0x8A1A951D,0x0765FAFF,0xFB7CD541,0x20451F4B,
+	0x2C60D342,0x4D8B0C56,0xF649F345,0x9ED86EBC,0x4EC4B574,0x59617EDD,0xF92EB0A3,0xA3F8C358,
+	0x99297310,0xA52569D5,0x8F827FA7,0x1508CD00,0xBD4BDC63,0xCBEE4086,0x9DCF92A1,0x89B0DAEF,
+	/* T[9] */
+	0x6A8CE6D7,0x4ED243E7,0x17C75C11,0x9267EF39,0x48D7A8DC,0xB30B1275,0xE9CE397D,0x7F316BAA,
+	0x6FCF0EE5,0xB941AFC6,0x324B67EE,0x09B5C72E,0x79870E4C,0xC8A11067,0x9B1852D0,0x980A3385,
+	0x39922EF3,0x14DAD936,0x96732C10,0xCEAA34F3,0x2FB667FF,0xF0F2B3FD,0x344651DF,0x4B7BE770,
+	0x82F325A2,0x64028BA2,0x97290764,0x7F374210,0xBDC7D778,0x9586E56C,0x34AE5C89,0x3AE59308,
+	0x5BB32A86,0xF0FA66F9,0xB3A932FF,0x033D9138,0xD667CEED,0xA9D75E68,0xE9D66172,0x99FAA31E,
+	0x9C3A7269,0x3AED877F,0xCA433DFB,0x52FA9C4B,0xB52EBB6A,0xEA9800DF,0x20FC4520,0x6CAB1FC2,
+	0xA9FD4509,0xA49466A9,0x898770B1,0xC080FA16,0x78EE2BEF,0xE62F5FEC,0xDDF92D4A,0x9E105070,
+	0x6425AF8B,0x71910E27,0xF7C7C25D,0x7A3543E0,0xD7DC6E2B,0xE9E42CB4,0x3B9F2543,0x1361B5DF,
+	/* T[10] */
+	0x90C88056,0xA94EBE40,0x7B8D890E,0xFA09A83E,0x94245400,0xF2A851C3,0x935BAB2C,0xBEBA45E6,
+	0x3B19F9F2,0x5C9AA88E,0xD513AEC4,0xFDE0C92F,0x1E18B5C8,0x00C2C170,0xE8FBFEC0,0x31479A33,
+	0xC700DF56,0x27F3E2A9,0x933820D5,0x2B54229B,0xB2D88DBA,0xD059D9A6,0xB5EFC345,0x46EF376B,
+	0x68C59ED5,0x132CE756,0x12D3E438,0x170DB4EC,0x69ED118B,0xF8F71F6F,0x7F7401B3,0xBD6DE0F7,
+	0x9BC92E6A,0xA5B40BC6,0xC4045897,0x75F0A2EF,0xFB70A683,0x7DCC426D,0x1669C90E,0x6A516CDE,
+	0xEEBA97BF,0xBA435B8A,0x70BFAF72,0x6A95D0F6,0xA72FAAA2,0xF59F96E7,0xB60347B7,0x78F8600C,
+	0xA99AE5A8,0xF5DA505C,0x8F9E6C4E,0x0C16687E,0xD08F7184,0x51E12A88,0xA2CE4909,0xFDA9F935,
+	0x448431B4,0xCF23556D,0xF0BAE8E7,0x79E23AC8,0xC0389D84,0x183CEC97,0x5C8A2289,0x395CFF12,
+	/* T[11] */
+	0x219100AC,0x529D7C81,0xF71B121D,0xF413507C,0x2848A801,0xE550A387,0x26B75659,0x7D748BCD,
+	0x7633F3E5,0xB935511C,0xAA275D88,0xFBC1925F,0x3C316B91,0x018582E0,0xD1F7FD80,0x628F3467,
+	0x8E01BEAC,0x4FE7C553,0x267041AA,0x56A84537,0x65B11B74,0xA0B3B34D,0x6BDF868B,0x8DDE6ED7,
+	0xD18B3DAA,0x2659CEAC,0x25A7C870,0x2E1B69D8,0xD3DA2316,0xF1EE3EDE,0xFEE80367,0x7ADBC1EE,
+	0x37925CD5,0x4B68178D,0x8808B12F,0xEBE145DF,0xF6E14D06,0xFB9884DB,0x2CD3921C,0xD4A2D9BC,
+	0xDD752F7E,0x7486B715,0xE17F5EE5,0xD52BA1EC,0x4E5F5544,0xEB3F2DCF,0x6C068F6F,0xF1F0C019,
+	0x5335CB50,0xEBB4A0B9,0x1F3CD89D,0x182CD0FD,0xA11EE308,0xA3C25511,0x459C9212,0xFB53F26B,
+	0x89086369,0x9E46AADA,0xE175D1CF,0xF3C47591,0x80713B08,0x3079D92F,0xB9144512,0x72B9FE24,
+	/* T[12] */
+	0x8CCC1218,0x0A140C27,0x85CA1097,0xE4A19F3A,0xE2158923,0x45C98271,0x9D05C5A1,0xE4879D19,
+	0xD612FA5A,0x46C7C886,0x6FFC2E29,0xA5945A3D,0xCF931945,0x88BAE4A7,0x6D11C554,0xA292742F,
+	0x7A9CE807,0x207E2726,0x240D3CE4,0xE72D6DE6,0xB0526936,0x7BE77E3D,0x31766ECA,0xEC7119EF,
+	0x6872CD5D,0x5A0355E8,0xD96129E5,0xBC406A76,0x85803948,0x7636FF74,0x257182FE,0x4970DD6D,
+	0x0FE036E3,0x833145DA,0x72DCB666,0xAD14EF1C,0x89E24D9A,0x52A21BC9,0x1AEDF287,0x92716B2B,
+	0x3D410E97,0xF301189A,0x9AABE809,0x22A3EFBD,0xA9F363A7,0x4C161CE1,0xBBD5A0F2,0xB0052F71,
+	0x3130359C,0xD72059CF,0x015DD8BC,0xEE5227B3,0x2E8E1FBC,0x3BF59276,0x16998371,0xF9F4A881,
+	0xC62E0F8E,0x71869317,0x4D101172,0x02D658B1,0x21E6655B,0xFE4158C5,0xB9FBF00E,0x10A7E0D2,
+	/* T[13] */
+	0x19982430,0x1428184F,0x0B94212E,0xC9433E75,0xC42B1247,0x8B9304E3,0x3A0B8B42,0xC90F3A33,
+	0xAC25F4B5,0x8D8F910D,0xDFF85C52,0x4B28B47A,0x9F26328B,0x1175C94F,0xDA238AA9,0x4524E85E,
+	0xF539D00F,0x40FC4E4C,0x481A79C8,0xCE5ADBCC,0x60A4D26D,0xF7CEFC7B,0x62ECDD94,0xD8E233DE,
+	0xD0E59ABB,0xB406ABD0,0xB2C253CA,0x7880D4ED,0x0B007291,0xEC6DFEE9,0x4AE305FC,0x92E1BADA,
+	0x1FC06DC6,0x06628BB4,0xE5B96CCD,0x5A29DE38,0x13C49B35,0xA5443793,0x35DBE50E,0x24E2D656,
+	0x7A821D2F,0xE6023134,0x3557D013,0x4547DF7B,0x53E6C74E,0x982C39C3,0x77AB41E4,0x600A5EE3,
+	0x62606B39,0xAE40B39E,0x02BBB179,0xDCA44F66,0x5D1C3F79,0x77EB24EC,0x2D3306E2,0xF3E95102,
+	0x8C5C1F1D,0xE30D262F,0x9A2022E4,0x05ACB162,0x43CCCAB6,0xFC82B18A,0x73F7E01D,0x214FC1A5,
+	/* T[14] */
+	0x4021952C,0x579C827C,0xD44E00E3,0xEE3C3DBB,0x236B036D,0xF387613E,0xEF4C153C,0x9B801FCA,
+	0x1E031EBD,0xA36820FB,0xC1A24E07,0xC3337D98,0x95413EA7,0xE4DD98B7,0x98927AF4,0x9E88930A,
+	0xC7F15D57,0xCAD50F24,0x09C5E503,0x6A64DEBE,0xF5218F99,0x94385A03,0xA6E1A288,0x5F78A516,
+	0xF5B98149,0xA197E165,0xF7A0437E,0x639E05E6,0xCC126D67,0xFA3ADBA9,0x5406B50E,0x0328B6C8,
+	0x98441DCD,0xA9FB9CBC,0x22C79345,0x498C778D,0x805F36E3,0xEB87B671,0x8BF39FB9,0xB6B7EB1B,
+	0x5845D27C,0x00EC9454,0x6715D08E,0xF049BC94,0xE22ACB31,0x55201975,0xC0157511,0x0F49ECDD,
+	0x91AB46FE,0xE863E3B8,0x07A01D8D,0x2CF2280C,0xB9DA968B,0xB1857F4A,0xD5A53353,0x5B128C95,
+	0xE5A3E0FD,0x8811236C,0x2A6465FA,0x960D82B9,0x10ADF25E,0x75CEF8B3,0x80275C48,0xC4E63F48,
+	/* T[15] */
+	0x80432A59,0xAF3904F8,0x4773A52E,0x540D393F,0x852316E1,0x201B7855,0x6181A6C7,0x71714E12,
+	0x0D441D75,0x0B1A453A,0x36D4EE9C,0xC268C016,0x3B8FFBCB,0x3B6C1F3C,0x479F71EA,0xAB9E2778,
+	0x67AE8B4D,0xD576197C,0x4593E71A,0x36C6C09A,0xFC38B1C2,0x1D690C3E,0xEA5089F8,0x109A5C45,
+	0x0D39B49E,0x25E08028,0x8E689295,0x0DD13116,0xE55BF6D3,0x236D0E07,0xF4E86EBC,0x4A46BC0D,
+	0xE84DC21F,0x234A6F29,0x0EE13F56,0x75279679,0x0CCE8554,0xF468E308,0x3700B3FB,0xD520C9C6,
+	0x3133DBC3,0x4C82154A,0x903E8628,0x5B3013D3,0x654F2793,0x860C3DCC,0xAA2D84C1,0x4AB4BAE5,
+	0x74922C81,0xDA46156E,0xAC33C542,0xDCB46CB4,0x4F19EE1C,0x967760C7,0x96E632AB,0x0C43E2EA,
+	0xFD1A8B65,0x37688155,0x2D8B8F03,0x7C3EAF52,0x7EA09A22,0x3DA59D0D,0x004EB891,0x89CC7E91,
+};
+
+/* ffdhe3072: 4 teeth spaced 64 bits apart */
+static const uint32_t dh_comb_entries_ffdhe3072[CC_DH_COMB_ENTRIES_COUNT*96] = {
+	/* T[1] */
+	0x00000002,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	/* T[2] */
+	0x98EBF497,0x81D3A2A1,0x0CD1EE6A,0x5AAB235B,0xDDC57A1E,0x0D0D4213,0x04675EFE,0xB36832C2,
+	0x98533B63,0x37DFA607,0x89F8AE99,0x40A3AF56,0xBEDFCBA8,0xD7CA2423,0x7A2C6BC0,0x4103E54B,
+	0x2BB7AC3A,0x53C348B2,0x88E22C74,0x933B5C38,0x1F794CAB,0x4553F00A,0x9BF889F6,0x23D31860,
+	0xAB8D76F2,0xDEC591B0,0x3B6AA224,0x5B54D865,0xEBACDA3F,0xFCB894FC,0x46047947,0x1D9220CC,
+	0x319CED92,0x67CC37B0,0x20A74891,0xBDC5FCB8,0x779F1A15,0xCAB9B215,0x8A0F6481,0xC3F0A36E,
+	0x44189F17,0x1B64DBF4,0xBC3DF59B,0xEEF5F33F,0xC4430834,0x5B7183C4,0x45084F58,0x7CFB70DC,
+	0x4440932A,0x77C6C596,0x4255BA85,0x2087D0D5,0xD6282288,0x103833D1,0xA942EA3F,0x2FAE67F9,
+	0xC30B1256,0x08F5F073,0xAAC35F37,0x3142162F,0xEC2667BC,0xAC956630,0xD8EBC497,0x1EF3B159,
+	0x1B3918E8,0x0C6329CF,0xDAE2B054,0x224C2466,0x03523E84,0xD2562E3D,0x39D6BD50,0x7210CEDD,
+	0xDF5C4416,0xCE8D17D9,0x377590AC,0x8F41A0FE,0x9B46789A,0xA8CDD90D,0x2CE12565,0xCA010063,
+	0x09572DCC,0x5C073E7E,0x68C8CFD2,0x6BBC7579,0x900AACF6,0xC642E6BE,0x1F2FC50F,0x7635CC34,
+	0x8AFA2373,0x1711164D,0x2214AC5E,0x6E4C599A,0x2A986B7D,0xF1132F9B,0x6C87D4E3,0xD73D216E,
+	/* T[3] */
+	0x31D7E92F,0x03A74543,0xB2DDAE9D,0x8F72298A,0x7BB556C0,0xDDFF6339,0x0E7AE00C,0x5C139518,
+	0x5AE22E79,0x51FFB1CC,0x78E37258,0xD5823D15,0x5B895D42,0xC7271C82,0x57BAE0E2,0x255947EB,
+	0xE57A0C75,0x4293AF45,0x2EED0B15,0x3179741E,0x82AF2012,0xD694D380,0xB2DD817B,0x98A81DB7,
+	0x959414C7,0x63FE7266,0xE4DD4C5B,0x3BD093A3,0x0072EB77,0x97BCBA30,0x926CF057,0x7EEF4CB9,
+	0xFE20D7C8,0xF1631424,0xE02EC145,0xF320B737,0x2D8B4430,0xCE801A04,0x97084550,0xC2525559,
+	0x596F1E29,0xFB13BB2C,0x2C0C3DC2,0x19EDAB64,0x99938EE6,0x2893F556,0xA08B1AB1,0x6883E31B,
+	0x604CF6F3,0x2F59865F,0xB6B3921E,0xA30CA4C8,0xBE45D79F,0x1568BFDA,0xEF131965,0xB105E20B,
+	0xA7DCD6B7,0xF49C9E43,0xF4AECA05,0xA91951A7,0x2583EB7C,0x88222316,0xFEB28DCD,0x81DCB130,
+	0xEE37B855,0xE819894E,0x7F177972,0x26A6F02C,0x12B49496,0xC205D29F,0x92C6EF29,0x4BD29149,
+	0x3F60BEF7,0xE7C31C55,0x30FE0665,0x991FDCA7,0xD7868264,0x2D67BCFB,0x83C4E56A,0xC022E1F0,
+	0x63E9FA1E,0xC18CCAF9,0x6E8529CB,0x5A49078F,0xFB7A1AF3,0xBFF22FAE,0x29FB5623,0x428A6227,
+	0x47C71051,0x55686717,0x1CEC1BCA,0x2CBC5D14,0xB2758C60,0x342E0ADD,0xD90FA9C8,0xAE7A42DC,
+	/* T[4] */
+	0xACE9A0BC,0xC9429903,0xE7B3421B,0x938CB3BF,0xBEBDEBC5,0x80B67F16,0x588D11F4,0xED5F8C2C,
+	0x52C7A8BB,0x2580615F,0x7F786F84,0xC1D9C875,0x3DE006FC,0x027A548B,0xD6E1B43E,0x70528AEA,
+	0xE658D391,0x5B96E693,0x3967B011,0x802F592B,0x7FC6A498,0x3B74BFDB,0x3558CE80,0x4E4B9C96,
+	0x9CC315ED,0x93264FA1,0xAE754F34,0x7BEC19CA,0x8F3388EE,0x3C7E9596,0x837B734E,0xBB50967A,
+	0x7125C927,0xD0E4E8B7,0x79660BD2,0xDFE9BC86,0x113356C9,0xC9547C4B,0xC1842534,0xABD4D29B,
+	0xB39BB00C,0x4CDF990E,0xAADAE544,0x2C8E673D,0x1B30968E,0xD030FE7B,0x87694025,0x4F8A5215,
+	0x99FC42B5,0x85B21363,0xA64C0E29,0x7EF02739,0x67A91CB8,0xF8459665,0x51E42972,0xE9159A9B,
+	0x01E2FAD6,0xC1C4D67E,0x8C9DC430,0x32EA7E57,0xE5042DFE,0x57FD5F6D,0x047E1C9B,0x0DD8F8EA,
+	0x4151E08C,0x4B603365,0xD83B1C62,0x49582F24,0x6090CB04,0x9F4B9DBF,0x9AAE95E8,0x0338F6C2,
+	0xA7BD38EE,0xD1CCF831,0x5A63EC10,0xA2625A25,0xF586DDD1,0xD3185683,0x4A829F5B,0xC3BAF8D8,
+	0x9058855C,0x8ECE4736,0x42C6F72D,0xFBCE1949,0x37BCA794,0x861F2A15,0xB354B6B6,0x85893A28,
+	0x4C3AD252,0x86AC91DB,0xFD9B9EC4,0x4EBC4A51,0x45586B35,0x259B7CE3,0xCC7E8D45,0xA1AE0887,
+	/* T[5] */
+	0x59D34179,0x92853207,0x68A055FF,0x01354A54,0x3DA63A0F,0xC551DD3F,0xB6C645F9,0xD00247EC,
+	0xCFCB0929,0x2D41287B,0x63E2F42E,0xD7EE6F53,0x5989D3EB,0x1C877D51,0x112571DD,0x83F6932A,
+	0x5ABC5B23,0x523AEB09,0x8FF8124F,0x0B616E03,0x4349CFEC,0xC2D67323,0xE59E0A8F,0xED992622,
+	0x77FF52BD,0xCCBFEE48,0xCAF2A67A,0x7CFF166E,0x478048D5,0x1748BB63,0x0D5AE464,0xBA6C3816,
+	0x7D328EF3,0xC3947633,0x91AC47C8,0x376836D4,0x60B3BD99,0xCBB5AE6F,0x05F1C6B6,0x921AB3B4,
+	0x38754013,0x5E093561,0x09461D15,0x951E9360,0x476EAB98,0x1212EAC3,0x254CFC4C,0x0DA1A58E,
+	0x0BC45609,0x4B3021FA,0x7EA03966,0x5FDD5191,0xE147CC00,0xE5838501,0x405597CC,0x23D4474F,
+	0x258CA7B9,0x663A6A58,0xB86393F9,0xAC6A21F7,0x173F7800,0xDEF21590,0x55D73DD4,0x5FA74051,
+	0x3A69479D,0x66139C7B,0x79C8518F,0x74BF05A8,0xCD31AD96,0x5BF0B1A3,0x5476A059,0x6E22E114,
+	0xD022A8A6,0xEE42DD04,0x76DABD2D,0xBF614EF5,0x8C074CD2,0x81FCB7E8,0xBF07D956,0xB396D2DA,
+	0x71ECA93E,0x271ADC6A,0x22817882,0x7A6C4F2F,0x4ADE1030,0x3FAAB65C,0x52453971,0x61313E10,
+	0xCA486E0F,0x349F5E32,0xD3FA0097,0xED9C3E83,0xE7F58BCF,0x9D3EA56D,0x98FD1A8A,0x435C110F,
+	/* T[6] */
+	0x09F0C338,0x6B246A6C,0x6C3C0671,0x613D0E67,0xB5AF10EE,0xFBC4D202,0xB6B57D06,0xE7E07008,
+	0xE0FDA9C4,0x77AF049F,0xB3143C7A,0x55BFF8BD,0xC8B5CAAE,0x1DBB6CA4,0x6E5101CD,0xE7378E83,
+	0x569DBDF3,0xC4EB12F2,0xBB552093,0x5C1C4FD5,0x6B432F6B,0xD500EC34,0x76C3E7E7,0x768EE3E5,
+	0x15DE68B5,0x1B2C8382,0x5C088264,0x047B5747,0xA9A024CA,0x8B92BD54,0xFBD0A6CB,0x10639616,
+	0xA1D012C1,0x874EDBA5,0x95912BF1,0x130E967B,0xE5215740,0xC0BA458F,0xE08D7451,0xB95E4510,
+	0xFD8B2892,0xCD564948,0x862380ED,0x5BAEA2B7,0x7A8A2934,0xC73512DB,0x784289E7,0x31C658E6,
+	0xC7014EB7,0xA63D121C,0x9EF3025A,0x75D3C887,0xE2B3F586,0xB8ABA056,0x5F8BE29A,0x7DDE5731,
+	0x5412952A,0xFD4FC165,0x83885D3F,0x5603B9E6,0xD2712CB8,0x2E3AB743,0x38A19912,0x23D3BA95,
+	0x8C6C668F,0xB7B5D192,0x03E62006,0x88459FE9,0xE6D1AC41,0x77F0FBE3,0x1B7798A5,0x3A0B707E,
+	0xA39A865E,0x77452FC2,0x89E09D04,0xB4B92275,0x107369A7,0xFA489AB5,0x7FEB73A7,0xE9B058EF,
+	0x33033989,0x60CE0A80,0x28E8476F,0xD254DC74,0x64B3C490,0x67E34E21,0x79E26736,0xF42DB2CC,
+	0x91BAABA5,0xEBBFA426,0xBD1B9AAE,0x723F966F,0x569EE539,0x1C786001,0x8BA99E82,0x1A383DF7,
+	/* T[7] */
+	0x13E18670,0xD648D4D8,0xD8780CE2,0xC27A1CCE,0x6B5E21DC,0xF789A405,0x6D6AFA0D,0xCFC0E011,
+	0xC1FB5389,0xEF5E093F,0x662878F4,0xAB7FF17B,0x916B955C,0x3B76D949,0xDCA2039A,0xCE6F1D06,
+	0xAD3B7BE7,0x89D625E4,0x76AA4127,0xB8389FAB,0xD6865ED6,0xAA01D868,0xED87CFCF,0xED1DC7CA,
+	0x2BBCD16A,0x36590704,0xB81104C8,0x08F6AE8E,0x53404994,0x17257AA9,0xF7A14D97,0x20C72C2D,
+	0x43A02582,0x0E9DB74B,0x2B2257E3,0x261D2CF7,0xCA42AE80,0x81748B1F,0xC11AE8A3,0x72BC8A21,
+	0xFB165125,0x9AAC9291,0x0C4701DB,0xB75D456F,0xF5145268,0x8E6A25B6,0xF08513CF,0x638CB1CC,
+	0x8E029D6E,0x4C7A2439,0x3DE604B5,0xEBA7910F,0xC567EB0C,0x715740AD,0xBF17C535,0xFBBCAE62,
+	0xA8252A54,0xFA9F82CA,0x0710BA7F,0xAC0773CD,0xA4E25970,0x5C756E87,0x71433224,0x47A7752A,
+	0x18D8CD1E,0x6F6BA325,0x07CC400D,0x108B3FD2,0xCDA35883,0xEFE1F7C7,0x36EF314A,0x7416E0FC,
+	0x47350CBC,0xEE8A5F85,0x13C13A08,0x697244EB,0x20E6D34F,0xF491356A,0xFFD6E74F,0xD360B1DE,
+	0x66067313,0xC19C1500,0x51D08EDE,0xA4A9B8E8,0xC9678921,0xCFC69C42,0xF3C4CE6C,0xE85B6598,
+	0x2375574B,0xD77F484D,0x7A37355D,0xE47F2CDF,0xAD3DCA72,0x38F0C002,0x17533D04,0x34707BEF,
+	/* T[8] */
+	0x4C6CF1DF,0x467F38F7,0x72304A10,0x6312F8E8,0xDBB28952,0x3B6C8F78,0x4B291E16,0xA78EF9A4,
+	0x541171B4,0xE0FDEBDB,0x0538AE95,0xDF2E36C3,0x217D9CD0,0x250E7279,0x66D838AB,0x6BC13385,
+	0x00DA6E4C,0x40C7904F,0x84379B37,0x9FF5C1A1,0x2FE3D7E8,0x7E927A3C,0xAA2C3DDF,0x41F0BC91,
+	0x2DECEE9A,0xC270907D,0xDB84EC9B,0xFCA8D84A,0x051456E1,0x01E13F46,0xA79F34F5,0x5C3BB58C,
+	0xFD6E9A57,0x5BC34E73,0xA73C0652,0x075E4841,0xC9A71698,0x7411492A,0x99940E24,0xAA5D8A44,
+	0x6576E8BE,0x235675C9,0x22E06F84,0x12C133CC,0xA8B7F589,0x4E9A412D,0x01F56EC4,0x3AB1C969,
+	0x32AE56F9,0x7BDF032C,0xB992EA47,0xF0C38C09,0x7167E99A,0x9A51F1D7,0x0CAB4AFF,0x6D99F31A,
+	0x32FA350E,0x449D1381,0x9FA1E0F4,0x2C2AADC8,0x93510889,0xC8770FA5,0xE6B02A5E,0x9A3A3208,
+	0x639F2557,0xC3FD3C84,0x86A88E18,0x96DD4204,0x1B1A23D9,0xD509281C,0x849036FA,0x257839C0,
+	0x585E4D51,0x6B9EA741,0xD1E33E4D,0x6541F4AB,0x90714B6A,0xC570E6AD,0x341DC3D1,0x356823E9,
+	0x8740E49C,0xAC54783A,0x79031C6E,0x89F63E3D,0x337F3F41,0xBEDF59A7,0xF5602AAC,0xF4FE49E2,
+	0xA3993CAE,0xB678C1D9,0x2C12FFE9,0x00FE335A,0x9B755426,0x578889E3,0x501995DA,0x4B767383,
+	/* T[9] */
+	0x98D9E3BE,0x8CFE71EE,0xE4609420,0xC625F1D0,0xB76512A4,0x76D91EF1,0x96523C2C,0x4F1DF348,
+	0xA822E369,0xC1FBD7B6,0x0A715D2B,0xBE5C6D86,0x42FB39A1,0x4A1CE4F2,0xCDB07156,0xD782670A,
+	0x01B4DC98,0x818F209E,0x086F366E,0x3FEB8343,0x5FC7AFD1,0xFD24F478,0x54587BBE,0x83E17923,
+	0x5BD9DD34,0x84E120FA,0xB709D937,0xF951B095,0x0A28ADC3,0x03C27E8C,0x4F3E69EA,0xB8776B19,
+	0xFADD34AE,0xB7869CE7,0x4E780CA4,0x0EBC9083,0x934E2D30,0xE8229255,0x33281C48,0x54BB1489,
+	0xCAEDD17D,0x46ACEB92,0x45C0DF08,0x25826798,0x516FEB12,0x9D34825B,0x03EADD88,0x756392D2,
+	0x655CADF2,0xF7BE0658,0x7325D48E,0xE1871813,0xE2CFD335,0x34A3E3AE,0x195695FF,0xDB33E634,
+	0x65F46A1C,0x893A2702,0x3F43C1E8,0x58555B91,0x26A21112,0x90EE1F4B,0xCD6054BD,0x34746411,
+	0xC73E4AAF,0x87FA7908,0x0D511C31,0x2DBA8409,0x363447B3,0xAA125038,0x09206DF5,0x4AF07381,
+	0xB0BC9AA2,0xD73D4E82,0xA3C67C9A,0xCA83E957,0x20E296D4,0x8AE1CD5B,0x683B87A3,0x6AD047D2,
+	0x0E81C938,0x58A8F075,0xF20638DD,0x13EC7C7A,0x66FE7E83,0x7DBEB34E,0xEAC05559,0xE9FC93C5,
+	0x4732795D,0x6CF183B3,0x5825FFD3,0x01FC66B4,0x36EAA84C,0xAF1113C7,0xA0332BB4,0x96ECE706,
+	/* T[10] */
+	0x89D1DF77,0x06607903,0x7C63055D,0x8CA87DA8,0x7F7FA259,0xC2BC68E2,0xB03E9BD2,0x079D31A8,
+	0x511D0326,0xE19EC87E,0xD9F5083A,0xE9786660,0x2F04784D,0x8426289F,0x0AD22516,0x1D9BA661,
+	0xDE67B314,0x1B009A6B,0x5D70927F,0xE974BC99,0x45EB9AEF,0xBB36779A,0x9587F2B0,0x0489D21D,
+	0x0A8555F8,0x8563EBBB,0xB66B1D49,0x6649068F,0xE94EBBD8,0x32050C2F,0xC07711BB,0x5F30DC42,
+	0x0A789123,0xAB56E4A2,0xBFCEB6D1,0x849E87C5,0x405C716B,0x398A5B5F,0x3208A868,0x2195E088,
+	0xA728C131,0x9407F799,0xF5C878AF,0xFA90531F,0x59C3846B,0x8CFBF049,0x57644865,0x5AE60A17,
+	0x431E61C8,0x640456A6,0x0A44EA5B,0x7E19B8D4,0x33C1836E,0xB4D23BFD,0x455C3B0B,0xE71B937E,
+	0xD4C2CFA0,0x44A841EE,0x8D473BE0,0xF4AB047F,0x035C61D2,0x4E03531D,0xD4C7669C,0x81D784AC,
+	0x4A226489,0xB7FBAA78,0x88BBBB86,0x0D04B1C7,0x10E2131E,0xF6A0F22C,0x0AC9D66C,0xB5BA47FC,
+	0xF2B07E39,0x25C47BC6,0xFEA382A5,0x987B79C3,0x65431F0A,0xBE896CA1,0x1B1CBDA5,0xFB5A1B39,
+	0xAADD9124,0x6B9FA786,0x57899C49,0x503A1675,0x35E0D806,0x2AEB0795,0xAA9E46DD,0x56BD0986,
+	0xA3B1087A,0x901D67C0,0x926609A5,0x70B232CA,0x1DB03D4E,0xF489866E,0x70D9B1C2,0xA3201E20,
+	/* T[11] */
+	0x13A3BEEF,0x0CC0F207,0x91FFDC82,0xF36CDE25,0xBF29A736,0x495DB0D6,0x662959B6,0x047D92E5,
+	0xCC75BDFE,0xA57DF6B9,0x18DC259B,0x272BAB2A,0x3BD2B68E,0x1FDF2579,0x7906538E,0xDE88CA16,
+	0x4ADA1A28,0xD10E52B9,0xD809D72A,0xDDEC34DF,0xCF93BC9A,0xC259E2A0,0xA5FC52F0,0x5A159131,
+	0x5383D2D3,0xB13B267B,0xDADE42A4,0x51B8EFF8,0xFBB6AEA9,0x0255A895,0x8752213E,0x022CC3A6,
+	0xAFD81EEB,0x78786E08,0x1E7D9DC6,0x80D1CD53,0xBF05F2DC,0xAC216C97,0xE6FACD1D,0x7D9CCF8C,
+	0x1F8F625C,0xEC59F277,0x9F2143EB,0x31226B24,0xC4948754,0x8BA8CE5F,0xC5430CCB,0x24591591,
+	0x5E08942F,0x07D4A87F,0x4691F1CA,0x5E3074C6,0x7978996C,0x5E9CD031,0x2745BAFE,0x1FE03915,
+	0xCB4C514D,0x6C014139,0xB9B68358,0x2FEB2E47,0x53EFDFAA,0xCAFDFCEE,0xF669D1D6,0x47A457D6,
+	0x4C0A4F98,0x3F4A8AA1,0xDAC98FD8,0xFC180AED,0x2DD43DC9,0x0A9B5A7D,0x34AD2162,0xD3258387,
+	0x6609333D,0x9631E42F,0xBF59EA56,0xAB938E32,0x6B7FCF44,0x58DEE423,0x603C15EA,0x22D5179C,
+	0xA6F6C0CF,0xE0BD9D0A,0x4C06C2B9,0x23444987,0x47267113,0x8942715C,0x40D859BE,0x0398DCCC,
+	0x7934DA5F,0x478109FD,0xFD8ED659,0x31880F74,0x98A53002,0x3B1AB883,0xE1B36386,0x46403C40,
+	/* T[12] */
+	0x4E5FF938,0x0449755C,0x18DDDD72,0x5E9C298C,0x9548ED2B,0x382C3821,0x7977245C,0x4AA00604,
+	0x3BD61B8C,0x01255C10,0xD3095E61,0x37CCD40E,0x774B4873,0x7AD31FED,0x887455D3,0x4F955345,
+	0xD85CDB97,0xCC3D271D,0xF35FC3D9,0xEA719C4F,0xA2B64A9C,0xFF6DE9A0,0x36CE03B8,0x8C6E439F,
+	0x79DA922E,0xA9BB31BF,0xE0A96E68,0x53FC4223,0xB0247CEA,0x82321988,0xD2D3B31C,0x8EB3AE1B,
+	0x39D9CBC5,0x2993B74C,0x903CEBC2,0xB4572FB6,0x1FC1B9CB,0x25E3CE7D,0x7DD11D5E,0x4B136017,
+	0x86404136,0x2BB0856F,0x8972303F,0x46CB0BB9,0x51CAEC50,0x58A1E15B,0xE6D558B0,0xFCD82E39,
+	0x6E67FD72,0x3D1469A1,0xE3CFB739,0x7A7F2631,0xB5A34491,0xC5E4FB04,0x3C9A8AD0,0x0855934B,
+	0xF6EA78EA,0x5256C39B,0xDD2CB358,0x874CA7D5,0x85D1A7D5,0xCD45F7C3,0x7AE56637,0x906CF4AB,
+	0x2B9F0B52,0x973D7BB8,0xE5951981,0x9B5672E6,0xA508DF60,0xAFAA673F,0x206E63CC,0x1F0BB1ED,
+	0x6AEE7695,0x947496DB,0xE53CA616,0x34D477B4,0xF75D364E,0x25941CE5,0x40517130,0x56983B9B,
+	0xA7EF8D0B,0x255CC72D,0x0F23FCBB,0x7777E334,0x0D5C969F,0xB0DF283B,0xA17E5960,0xAFB2081A,
+	0xB3FDD822,0x22A42E8E,0x12177E44,0x20AC6FF1,0x6C31AE7A,0x9FA2E4FB,0x3E1A6F86,0xA4BD9640,
+	/* T[13] */
+	0x9CBFF271,0x0892EAB8,0xCAF58CAC,0x975435EC,0xEABC3CDA,0x343D4F54,0xF89A6AC9,0x8A833B9C,
+	0xA1E7EECA,0xE48B1DDD,0x0B04D1E7,0xC3D48686,0xCC6056D8,0x0D391415,0x744AB508,0x427C23DF,
+	0x3EC46B2F,0x33876C1D,0x03E839E0,0xDFE5F44D,0x89291BF4,0x4AC8C6AD,0xE8887501,0x69DE7434,
+	0x322E4B40,0xF9E9B284,0x2F5AE4E2,0x2D1F6721,0x896230CD,0xA2AFC347,0xAC0B6400,0x61326758,
+	0x0E9A942F,0x74F2135D,0xBF5A07A7,0xE0431D34,0x7DD0839C,0x84D452D3,0x7E8BB709,0xD097CEAB,
+	0xDDBE6266,0x1BAB0E22,0xC674B30B,0xC997DC57,0xB4A3571C,0x22F4B083,0xE4252D61,0x683D5DD6,
+	0xB49BCB84,0xB9F4CE75,0xF9A78B85,0x56FB4F81,0x7D3C1BB2,0x80C24E40,0x15C25A88,0x625438AF,
+	0x0F9BA3DF,0x875E4494,0x59817248,0x552E74F4,0x58DA6BAF,0xC983463B,0x42A5D10D,0x64CF37D4,
+	0x0F039D2A,0xFDCE2D21,0x947C4BCD,0x18BB8D2C,0x5621D64F,0x7CAE44A4,0x5FF63C21,0xA5C85769,
+	0x568523F4,0x73921A58,0x8C8C3139,0xE4458A14,0x8FB3FDCB,0x26F444AC,0xAAA57CFF,0xD9515860,
+	0xA11AB89B,0x5437DC58,0xBB3B839D,0x71BFE304,0xF61DEE45,0x952AB2A7,0x2E987EC5,0xB582D9F4,
+	0x99CE79AF,0x6C8E9799,0xFCF1BF96,0x917C89C1,0x35A81259,0x914D759E,0x7C34DF0D,0x497B2C80,
+	/* T[14] */
+	0x81F6F178,0xC09AAED9,0x0EA1DECD,0x986F919D,0xE7C9600B,0xBBBAF901,0x5DB58AA2,0x37C91CFF,
+	0x2F838FDF,0x4F489E2B,0x26985287,0x613B7C1D,0x38F196EE,0x13F96A9C,0x629C6B64,0x5ED82A11,
+	0x575C4F56,0x5E219FAA,0xB5EDE1FD,0x0A5452C7,0xC143FBDB,0x2CC204C3,0x706CA808,0x7893E657,
+	0xF0E80686,0x762BE078,0xCF052B33,0x381307C9,0xA68265B7,0xAB040195,0xB8C0FC48,0x576011A9,
+	0x730638CA,0x7C4C5C75,0x276B4043,0x2EDCD9B4,0xB8398C23,0x8AFE6308,0x56D4BE8B,0x3D7B8641,
+	0x583EDCF8,0x345F0F87,0xB18FDD3D,0x45373E3F,0x1A9AF714,0xA12E3B7C,0xC3C1A671,0xE3CDCB8D,
+	0x3BA2540D,0x37C8B96B,0x8C9CAE50,0xB7FF5BB7,0xBF786B0D,0x4C6B669C,0x348E6FD7,0x4F3AE864,
+	0x269A1C31,0x3D645B72,0xE0066D87,0x58134758,0x5135445F,0x5E45D686,0xF95F7C88,0x7E5D8A35,
+	0x20C8B45E,0x46D53D3F,0xC99AA894,0x620E7572,0x5A673A89,0x84395759,0x783D0E7F,0x34ACF820,
+	0x22626DA9,0x5FC1B413,0x3E868600,0x9B2738B7,0x66418E67,0xD583BFB1,0x0B75A13A,0x7EC4A650,
+	0x8633A6A2,0x8BAE645C,0x3737CF30,0x7A15CE2E,0x2197A788,0x3FC6F013,0xF533B1B6,0x53A36DFA,
+	0xDD9F9929,0x6006F627,0xDB5AD4DE,0x77DF2AD3,0xFA6BB0F2,0x4C82607F,0x8DE470F9,0x51BAD592,
+	/* T[15] */
+	0x03EDE2F0,0x81355DB3,0x1D43BD9B,0x30DF233A,0xCF92C017,0x7775F203,0xBB6B1545,0x6F9239FE,
+	0x5F071FBE,0x9E913C56,0x4D30A50E,0xC276F83A,0x71E32DDC,0x27F2D538,0xC538D6C8,0xBDB05422,
+	0xAEB89EAC,0xBC433F54,0x6BDBC3FA,0x14A8A58F,0x8287F7B6,0x59840987,0xE0D95010,0xF127CCAE,
+	0xE1D00D0C,0xEC57C0F1,0x9E0A5666,0x70260F93,0x4D04CB6E,0x5608032B,0x7181F891,0xAEC02353,
+	0xE60C7194,0xF898B8EA,0x4ED68086,0x5DB9B368,0x70731846,0x15FCC611,0xADA97D17,0x7AF70C82,
+	0xB07DB9F0,0x68BE1F0E,0x631FBA7A,0x8A6E7C7F,0x3535EE28,0x425C76F8,0x87834CE3,0xC79B971B,
+	0x7744A81B,0x6F9172D6,0x19395CA0,0x6FFEB76F,0x7EF0D61B,0x98D6CD39,0x691CDFAE,0x9E75D0C8,
+	0x4D343862,0x7AC8B6E4,0xC00CDB0E,0xB0268EB1,0xA26A88BE,0xBC8BAD0C,0xF2BEF910,0xFCBB146B,
+	0x419168BC,0x8DAA7A7E,0x93355128,0xC41CEAE5,0xB4CE7512,0x0872AEB2,0xF07A1CFF,0x6959F040,
+	0x44C4DB52,0xBF836826,0x7D0D0C00,0x364E716E,0xCC831CCF,0xAB077F62,0x16EB4275,0xFD894CA0,
+	0x0C674D44,0x175CC8B9,0x6E6F9E61,0xF42B9C5C,0x432F4F10,0x7F8DE026,0xEA67636C,0xA746DBF5,
+	0xBB3F3252,0xC00DEC4F,0xB6B5A9BC,0xEFBE55A7,0xF4D761E4,0x9904C0FF,0x1BC8E1F2,0xA375AB25,
+};
+
+/* ffdhe4096: 4 teeth spaced 76 bits apart */
+static const uint32_t dh_comb_entries_ffdhe4096[CC_DH_COMB_ENTRIES_COUNT*128] = {
+	/* T[1] */
+	0x00000002,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	/* T[2] */
+	0x67DB89D8,0xDD3B5EB4,0x3BC7C28B,0x4174B006,0xA4D37FBC,0xF35DE5D2,0x5166F97B,0x39F5E1D6,
+	0xA5CF685C,0xC6385EC5,0xCCF6603A,0x149E6343,0xDE9BB7F9,0x59E6C24B,0xF929A740,0xCF5C8B59,
+	0xB5B142C2,0xDF175DAD,0xA629E550,0x23CD8554,0xA6B7DFCA,0x683DCAE5,0xA28A7CC9,0xE9560735,
+	0x8FB5B6F8,0xDF31FA59,0x4D681CC0,0x69C84197,0x97A52E40,0x17E5EE45,0x92F7E307,0xAB8DC599,
+	0xFF2C130C,0x835D2A5E,0x582A3BF3,0x25013CC9,0xC73EF0ED,0x7C7617DB,0xBD2C6B86,0xCCA7DB3D,
+	0x7FB667AD,0x7BAF443D,0xCAEE3BE8,0x77439A90,0x11E55795,0x45FD4755,0x69193049,0x2742C7FF,
+	0x91030324,0x3B656CCD,0x282AF6D5,0x8C9C261B,0xE49E489F,0xB2B1E9E9,0x266117F5,0xF718539B,
+	0x0826A36E,0x669987B1,0xE051C050,0xEE323359,0xA195B5BC,0x33DB34BF,0xFFEAC052,0xF6B80A78,
+	0xBBBAE7EF,0x3538B3F3,0x8EC6C6A3,0x9E5D0A13,0xB7F4DE2B,0x9DF7B1D2,0x78BFC97A,0x965FF9DD,
+	0x79EDEAED,0xF8F6E48C,0x45FAB3CD,0xB872E5ED,0xF7EE43DA,0x2CF31DB2,0xEB90FAC4,0x4E5C734C,
+	0x87332E6F,0xDD54756B,0x0DDF3783,0xF7EA3917,0x603777E7,0xDE58859D,0xDD8DA7F0,0xF0E59926,
+	0x219A7765,0x3B044400,0x0FDAC90D,0xBB566A09,0xB38CAB7F,0xE610CBC9,0xB8B61766,0x5A2D2DFE,
+	0xF4C16C5C,0x88046166,0x455FF775,0x4DB5462D,0xF4A212E1,0xCE5D97CE,0x2B7AD756,0xA435755F,
+	0x03C78652,0x8932EB11,0x431F2D99,0x5737084B,0x5581EA7A,0x0BFC4203,0x570C4361,0x786CD571,
+	0xBDD2A972,0xA7840113,0xDD5FC9CE,0x591AA70C,0x16234C6A,0x7E86B36E,0xB5B5F384,0x8CF5656E,
+	0xC4A032FA,0xD92AE2F0,0x9B12E9D5,0x28D22567,0x5CB284BC,0x331E407F,0xF170B4FD,0xB46915B7,
+	/* T[3] */
+	0xCFB713B1,0xBA76BD68,0x192A25AC,0xBC5F5F8E,0x55657C96,0x99062353,0x23454E8C,0xE5220E52,
+	0x7CD552E8,0x81EE2BBD,0xA05FB5A9,0xFEEDF7DD,0x4BF76FB5,0x99AFCB5A,0xBE87C306,0x958F7D10,
+	0xF9B5854D,0x50674261,0xBAD299DD,0x9E93AA9E,0x1FD15761,0xE31177CA,0x5560C807,0x617645E4,
+	0xA139A177,0x366E990D,0x45CCF97D,0x5C2CB411,0x58AAEF68,0x834E7D48,0x40676E57,0xDDEAA14E,
+	0xE80A311D,0x984B01FA,0x49B658F5,0x241E5C67,0x4EA8445E,0xBCD10EC9,0x8004F91D,0x8E92E60F,
+	0x29A8870D,0xD99EEE38,0xFACE8CF6,0x42C21389,0x0194751D,0xA38D62E5,0x359469F3,0xF1D70D53,
+	0xB010BA48,0x11D7F77C,0x6D7E9FD7,0x243B07E3,0x0CF917FA,0xB150C740,0xC7AE9D7A,0x3F32942C,
+	0x4EC66DC1,0x73A65E67,0x2EAB88B2,0x618B498D,0x6C44A272,0x0601F9B5,0x06397E6C,0x313B2013,
+	0x125CCC84,0x8C3C0CAC,0xBC6DBD69,0xB44ED1EE,0xAE36CC5C,0x74FC197E,0x74690F42,0x67310237,
+	0xC519B5D5,0xB637CC5C,0x3F85BA28,0xACE790BF,0x00EA0631,0xCB972933,0xED9C7188,0x0B45E7FC,
+	0xE6322D7D,0xFA74E609,0x4DC68C1A,0x51D1754C,0xD264825F,0xB1A96371,0x57A894C8,0x33744466,
+	0x64FBA0D7,0x58B9455C,0xBEDD9DB2,0xBD41F95A,0xB4507303,0xFB18EE47,0xBE47336B,0xF84FAA7A,
+	0xA1485F3D,0xDF5BF87E,0x541207B5,0x7D7933B9,0xF5543D50,0xBA14A5C2,0x760F2335,0xB01BDE4D,
+	0x8837436F,0x5D0EC2C3,0x4851403F,0x290AAB41,0x4BFD6624,0xF3C48EE7,0xD81B2160,0x1CFA8C0C,
+	0xCCE0F16A,0x58865024,0x57B31DC4,0x35056AB6,0x07AB59DB,0x3079C90E,0x5707B30D,0x7009949C,
+	0xBB132F5F,0xD99C005D,0x0EE896B9,0xA1C7F4AF,0x16A9BEDD,0xB8442CA6,0xE2E169FA,0x68D22B6F,
+	/* T[4] */
+	0x30E0FB45,0x0BA6FB9D,0x23716E31,0xACAD23D8,0x0162179F,0xE49C5C6E,0x1AC80957,0x108578CF,
+	0x99E0D917,0x3228CAC9,0x95479555,0x747010D5,0xF72E4070,0x3746DB4C,0x78FCFAAF,0xBA0EDBC9,
+	0x12E5ED8B,0x0C81E877,0x3200CB7E,0x87E7E477,0x3F46CE74,0x7966FD6F,0xB5A54065,0x5052E645,
+	0xECE23242,0x9E28D646,0xC09EBA19,0x24F74A9A,0x5A3FE902,0xF4F8720D,0x4B03C59D,0x8B23612E,
+	0xCD8C6736,0x6CEE1146,0x2B4B6A32,0xC0C33662,0x00AE6F05,0x56F516D9,0x056EFD8D,0x15D31596,
+	0x9B820593,0x3505DD4C,0xB3B303CD,0x22D52862,0x16EDA6B2,0x2D7C042B,0x14DE2A31,0x164D4AFB,
+	0x79BCFC1D,0xF8FFE1DB,0x755D9B5C,0x80D5F166,0x8DA51FF5,0x1ADC0577,0x69C5E067,0x3C8738A0,
+	0x0C85D7C2,0xCF21BB53,0x1518284C,0xF3ACDC78,0x94DB9FC5,0xEA2B6884,0x4DFF8D81,0xF57ECD47,
+	0x4AFD3329,0x21DAC417,0x8F546F4E,0x15E08FB0,0xE01D2981,0x1F14E502,0x09335E8B,0x8FEA721E,
+	0xAF4D169D,0x54367F8D,0x04715A11,0x417EA380,0x58C2737A,0x9038FF2F,0x9A67D89C,0xD6832934,
+	0x2BF0538B,0xCF57CA48,0xFCFB5F2F,0xA809E8C6,0x1578F6BB,0xC71E9949,0xAFE7FB2D,0xDA1874D8,
+	0x79C3E5C1,0x31F3DAD2,0x71FF3299,0x0C498CD2,0xD1B1048B,0x62696E4C,0x79096CD5,0xE8AEDD35,
+	0x4B83BD3D,0xBD081202,0x9DCDF3A2,0x49D0DF7C,0xE1AC0166,0x806A35CE,0x230DF3ED,0xA01860DE,
+	0xDD5D79FF,0x914F04B8,0x6F04B922,0x11208371,0x205148CB,0xA98E9476,0x6E3A949D,0x3735F7D8,
+	0x4289BCD3,0xB42CE47C,0x4834214E,0xA1517BC1,0x5B1EC172,0x5260FDB4,0x2A534FCE,0x58CF2664,
+	0x9D3869EA,0xFF72C168,0xB4930EAB,0x857FC441,0x24914B80,0xABFA5A88,0xF4EED270,0x225916DD,
+	/* T[5] */
+	0x61C1F68A,0x174DF73A,0x46E2DC62,0x595A47B0,0x02C42F3F,0xC938B8DC,0x359012AF,0x210AF19E,
+	0x33C1B22E,0x64519593,0x2A8F2AAA,0xE8E021AB,0xEE5C80E0,0x6E8DB699,0xF1F9F55E,0x741DB792,
+	0x25CBDB17,0x1903D0EE,0x640196FC,0x0FCFC8EE,0x7E8D9CE9,0xF2CDFADE,0x6B4A80CA,0xA0A5CC8B,
+	0xD9C46484,0x3C51AC8D,0x813D7433,0x49EE9535,0xB47FD204,0xE9F0E41A,0x96078B3B,0x1646C25C,
+	0x9B18CE6D,0xD9DC228D,0x5696D464,0x81866CC4,0x015CDE0B,0xADEA2DB2,0x0ADDFB1A,0x2BA62B2C,
+	0x37040B26,0x6A0BBA99,0x6766079A,0x45AA50C5,0x2DDB4D64,0x5AF80856,0x29BC5462,0x2C9A95F6,
+	0xF379F83A,0xF1FFC3B6,0xEABB36B9,0x01ABE2CC,0x1B4A3FEB,0x35B80AEF,0xD38BC0CE,0x790E7140,
+	0x190BAF84,0x9E4376A6,0x2A305099,0xE759B8F0,0x29B73F8B,0xD456D109,0x9BFF1B03,0xEAFD9A8E,
+	0x95FA6653,0x43B5882E,0x1EA8DE9C,0x2BC11F61,0xC03A5302,0x3E29CA05,0x1266BD16,0x1FD4E43C,
+	0x5E9A2D3B,0xA86CFF1B,0x08E2B422,0x82FD4700,0xB184E6F4,0x2071FE5E,0x34CFB139,0xAD065269,
+	0x57E0A717,0x9EAF9490,0xF9F6BE5F,0x5013D18D,0x2AF1ED77,0x8E3D3292,0x5FCFF65B,0xB430E9B1,
+	0xF387CB83,0x63E7B5A4,0xE3FE6532,0x189319A4,0xA3620916,0xC4D2DC99,0xF212D9AA,0xD15DBA6A,
+	0x97077A7B,0x7A102404,0x3B9BE745,0x93A1BEF9,0xC35802CC,0x00D46B9D,0x461BE7DB,0x4030C1BC,
+	0xBABAF3FF,0x229E0971,0xDE097245,0x224106E2,0x40A29196,0x531D28EC,0xDC75293B,0x6E6BEFB0,
+	0x851379A6,0x6859C8F8,0x9068429D,0x42A2F782,0xB63D82E5,0xA4C1FB68,0x54A69F9C,0xB19E4CC8,
+	0x3A70D3D4,0xFEE582D1,0x69261D57,0x0AFF8883,0x49229701,0x57F4B510,0xE9DDA4E1,0x44B22DBB,
+	/* T[6] */
+	0x2A6C28A0,0xCD388CCE,0x1890492A,0x9D49B97C,0x3A1BBE0D,0x0AE0242E,0x94E39FAB,0xE3F02146,
+	0x49439159,0x8DFB4245,0xFA5CCB93,0xE053BF4F,0xD6353AF5,0x98F9619B,0xE4475C93,0x06EADE2A,
+	0xA1B0B42F,0x32363767,0xCCED72BA,0xC36E7C7D,0x62642FFC,0x3F4A5434,0xA24ADAF5,0x4534D26A,
+	0x95BCF44E,0xBD86F6C7,0x404C4315,0x7CAD8891,0x9789E56E,0xE9A34F86,0xD4E3FD15,0x202C747C,
+	0xBF92DB27,0xCA80C531,0x13D11D94,0xA28D49A1,0xD9767502,0xDD2834C8,0xC07DE723,0x695FD6DC,
+	0x9CE448AB,0xCF8B68EE,0xF1A45366,0x7CDC04BD,0x0E07FDB6,0x0C8775ED,0x4CC1DDD7,0x18AF0F99,
+	0xA00A6FEE,0xBD2FA4E0,0x4482FD6E,0xE71E78DE,0xA562DAAB,0xE8B993B2,0xAAA573C7,0x3D14068A,
+	0xA7A57791,0xAC6FC8BB,0xD6AA0C50,0xB02A02F8,0xA4097271,0xFBF52B8F,0xCB212CDA,0x0FDED4E8,
+	0xF813F3BE,0xA6C75715,0x8ACFA37F,0xA2B0B98A,0x26348252,0x64136531,0x4F93E8B7,0x716CE2CD,
+	0x37FF24AE,0x2FD673AB,0x561EFF8B,0xC5F58B02,0xBB78BB31,0xB9CB5532,0x70A6B1C9,0x9C6D2143,
+	0x3BCE2E90,0xE931BA1D,0xBD0C399B,0xB6884203,0xA7A1E521,0xC677B138,0xB887BFC7,0x83F1E0AC,
+	0xCFCFC38D,0xD0DE7A77,0x3FEF585A,0x090E935E,0x1DE28D72,0x9E3D036D,0x769610C5,0x68F57650,
+	0x228D14B1,0x437C8A3A,0xD7917033,0xE6A464F3,0xDC6B2D6A,0xDB22619F,0xE7A93E14,0x14957E0C,
+	0xA59613DA,0x3DE839ED,0x94BFF8EA,0x0960C2EE,0x53FC525B,0x02EEB70C,0x48DC0D83,0x4AD03447,
+	0xD40999DD,0x8CB82939,0x55B5A605,0xB19507BC,0x94474BC3,0xAD0AE531,0x091535A6,0xDE8E1DC4,
+	0xAF2FB075,0xA8E2886A,0x59937532,0x1FBA78BE,0x7A8F1E06,0x7847D4AB,0xCCE68062,0x08AC7C91,
+	/* T[7] */
+	0x54D85140,0x9A71199C,0x31209255,0x3A9372F8,0x74377C1B,0x15C0485C,0x29C73F56,0xC7E0428D,
+	0x928722B3,0x1BF6848A,0xF4B99727,0xC0A77E9F,0xAC6A75EB,0x31F2C337,0xC88EB927,0x0DD5BC55,
+	0x4361685E,0x646C6ECF,0x99DAE574,0x86DCF8FB,0xC4C85FF9,0x7E94A868,0x4495B5EA,0x8A69A4D5,
+	0x2B79E89C,0x7B0DED8F,0x8098862B,0xF95B1122,0x2F13CADC,0xD3469F0D,0xA9C7FA2B,0x4058E8F9,
+	0x7F25B64E,0x95018A63,0x27A23B29,0x451A9342,0xB2ECEA05,0xBA506991,0x80FBCE47,0xD2BFADB9,
+	0x39C89156,0x9F16D1DD,0xE348A6CD,0xF9B8097B,0x1C0FFB6C,0x190EEBDA,0x9983BBAE,0x315E1F32,
+	0x4014DFDC,0x7A5F49C1,0x8905FADD,0xCE3CF1BC,0x4AC5B557,0xD1732765,0x554AE78F,0x7A280D15,
+	0x4F4AEF22,0x58DF9177,0xAD5418A1,0x605405F1,0x4812E4E3,0xF7EA571F,0x964259B5,0x1FBDA9D1,
+	0xF027E77C,0x4D8EAE2B,0x159F46FF,0x45617315,0x4C6904A5,0xC826CA62,0x9F27D16E,0xE2D9C59A,
+	0x6FFE495C,0x5FACE756,0xAC3DFF16,0x8BEB1604,0x76F17663,0x7396AA65,0xE14D6393,0x38DA4286,
+	0x779C5D21,0xD263743A,0x7A187337,0x6D108407,0x4F43CA43,0x8CEF6271,0x710F7F8F,0x07E3C159,
+	0x9F9F871B,0xA1BCF4EF,0x7FDEB0B5,0x121D26BC,0x3BC51AE4,0x3C7A06DA,0xED2C218B,0xD1EAECA0,
+	0x451A2962,0x86F91474,0xAF22E066,0xCD48C9E7,0xB8D65AD5,0xB644C33F,0xCF527C29,0x292AFC19,
+	0x4B2C27B4,0x7BD073DB,0x297FF1D4,0x12C185DD,0xA7F8A4B6,0x05DD6E18,0x91B81B06,0x95A0688E,
+	0xA81333BA,0x19705273,0xAB6B4C0B,0x632A0F78,0x288E9787,0x5A15CA63,0x122A6B4D,0xBD1C3B88,
+	0x5E5F60EB,0x51C510D5,0xB326EA65,0x3F74F17C,0xF51E3C0C,0xF08FA956,0x99CD00C4,0x1158F923,
+	/* T[8] */
+	0x4C15E934,0xC104D733,0x1F3C56F1,0xA83F6D2A,0x7608FA70,0x60A6BA7D,0x2BE048E8,0xAD5E47BE,
+	0x705FE8B6,0x1CA6D24E,0x54E1BC6C,0xCD137D67,0xBF2A333C,0x73BE2FD2,0x0DC384C0,0x528CCB77,
+	0xE3178044,0x96D6970B,0x5A431C69,0xE5274412,0x008F0A99,0x4945C290,0x2849ED44,0x86B9503B,
+	0x918F77DD,0x2FB1BD3E,0x48B82C59,0x92DC414D,0x77E1E5B1,0x555F7E6B,0x36845CC7,0x2D85ECEA,
+	0x8AA2CBFC,0xBBA291A4,0x53B52AC6,0x7F62E64C,0xD4B991CF,0xD2E51815,0x25957472,0xFAEAE5C9,
+	0x54BE731C,0xC4A12AAB,0xE5D3C70D,0xF9785AE6,0x501BB7FB,0xC223C24E,0xCCFFDDA8,0x386FFB49,
+	0xCEFF7C3E,0x811F56BF,0xA447465A,0x993E39B5,0x173307A7,0x2DB306FD,0x75A6D7EA,0xB1E02881,
+	0x8476C0B6,0x3B2DBC61,0x427BB676,0x0118B3E4,0x5C1D9005,0xE2258A87,0x7865A732,0xFC736C00,
+	0x3BB9C5F5,0x1791B9C5,0xB971BA5F,0x2B6305F0,0xBA2B5BFD,0x0A520E19,0x22A10C0D,0xC47838FB,
+	0xF50D8B8B,0x2EE259BF,0x7157B067,0xBC8DA03B,0xAD2C7F94,0x70439757,0x30661718,0xEF93A362,
+	0xE05B162A,0xC1D01D8C,0x04724866,0xDFB176F4,0x271B125C,0xA42A55ED,0xBB9EAC14,0xDAB5690C,
+	0x45A94E5A,0xF1BD8181,0x6EF3D53C,0xDA32D8CD,0x5A4EF480,0x69E553FE,0x9C405894,0xB31C7BA7,
+	0xC93FAAFD,0xF701EDFA,0x82401A86,0x44C76441,0x46A9C32B,0x371F56F1,0xBD95D347,0x864A9BA2,
+	0x7F9696BA,0x6F33A3D0,0x22BEB490,0x93144704,0x55131163,0xB9F4417A,0x5D21B789,0x7725AA09,
+	0x9138A1DA,0x84ADD88D,0x0988AAEB,0x0969A944,0xB8327318,0xDA577482,0xF4B0C235,0x4BBDE6EA,
+	0x9A383103,0x83A1C33A,0x9E5C54F1,0xE2EC8F36,0x53DA4D30,0x7CF3905E,0x44C33CFA,0x8D295743,
+	/* T[9] */
+	0x982BD269,0x8209AE66,0xE0134E78,0x89F4D9D5,0xF7D071FF,0x7397CCA8,0xD837ED65,0xCBF2DA21,
+	0x11F6539D,0x2ECB12CF,0xB0366E0C,0x6FD82C24,0x0D14663D,0xCD5EA668,0xE7BB7E06,0x9BEFFD4A,
+	0x54820050,0xBFE5B51E,0x2305080E,0x2147281A,0xD37FAD01,0xA521671E,0x60DFA8FD,0x9C3CD7EF,
+	0xA4ED2340,0xD76E1ED7,0x3C6D18AD,0xAE54B37D,0x19245E4A,0xFE419D94,0x878061D7,0xE1DAEFEF,
+	0xFEF7A2FC,0x08D5D085,0x40CC369C,0xD8E1AF6D,0x699D8622,0x69AF0F3D,0x50D70AF6,0xEB18FB26,
+	0xD3B89DEB,0x6B82BB13,0x3099A341,0x472B9436,0x7E0135EA,0x9BDA58D7,0xFD61C4B2,0x143173E7,
+	0x2C09AC7D,0x9D4BCB61,0x65B73EE1,0x3D7F2F18,0x7222960A,0xA7530166,0x663A1D63,0xB4C23DF9,
+	0x4766A850,0x1CCEC7C8,0xF2FF74FE,0x87584AA1,0xE1545702,0x6296A544,0xF72F4C2D,0x3CB1E321,
+	0x125A8890,0x50EE184F,0x11C3A4E1,0xCE5AC9A9,0xB2A3C7FF,0x4DB0D20C,0xC82B9467,0xC3618072,
+	0xBB58F711,0x220EB6C3,0x963FB35B,0xB51D055B,0x6B667DA5,0x52381C7C,0x7746AA31,0x4DB44827,
+	0x9881FCF4,0xC36C364C,0x3AECADE0,0x215FF106,0x602BB749,0x3D4D0411,0x13CA9D10,0x0713E432,
+	0xAD194EC1,0xC62BC05E,0x7D0FB611,0xFAFAD6E3,0x01D50505,0x02C1FEB1,0x855BB5C7,0xAA2E45CC,
+	0x4A44DC80,0xBD5711A6,0xCDD24DD8,0x6B9D6FE1,0x99639DE4,0x8B982407,0x9A451B16,0x74462AD4,
+	0x7FD5643F,0x29103442,0x07904E2D,0xA0C528B3,0x4B1FB3F6,0x4FB48DD5,0xE44609B2,0x1A6C353C,
+	0x73ACE23A,0x12D9FF18,0xB004DFFE,0x95A36F24,0x4BC9A736,0xE81B4B37,0xD4FD506F,0xED9A9794,
+	0x66432B70,0x2E89C0F1,0x157B6CF1,0x15FCC84D,0x04F94FC7,0x4BEECC64,0x898679F5,0x1A52AE86,
+	/* T[10] */
+	0x0A65C20B,0x216CDF0E,0x5D0825DA,0xFB895234,0x745A7200,0xE95A51E7,0x2BC82497,0x4F79F2D9,
+	0x7D287078,0x4E66AB58,0xF4A60898,0x1FAC3B2C,0xA3ADE0BD,0xD7B3E733,0xB7A27220,0x49F0F954,
+	0x21A8613E,0xAD556778,0xEAC6C5CF,0x7B033775,0x896EBD0D,0xFE7AF0CF,0x6E72E093,0xE17707A3,
+	0xC285646F,0xE111D62A,0x6D386836,0x46AFEC72,0xA2D8DF12,0xA50C7C2D,0x6380C922,0x4BD37518,
+	0xD20FEC14,0x6DDF6315,0x50A82778,0xE2C01DC4,0xAC383A03,0x15B5C040,0xAE1612F5,0x6699F27E,
+	0xA4300469,0x40B53E72,0x6FD36FDB,0x3800B202,0x42A63E4E,0x1CECA7A3,0xD3C95FE5,0x9230DEB7,
+	0x8B78E170,0xAD8917C5,0x453F807E,0x633BDF24,0x3BBE8218,0x66FC6241,0xFEB3CDFC,0xCFAE8B81,
+	0xC59E69A5,0xD0C555F1,0xF7311412,0xDAAD93C6,0x0463CBC5,0x2A5BE7F6,0x218B1544,0x9626C8F9,
+	0xC09BBCC7,0x4061FB45,0xD54B35B6,0x22AF74E6,0x62357A36,0xC3E2B87D,0x115C88F4,0x6AC8AA3A,
+	0x5098F33B,0x8A504F6C,0x952CA9BA,0x288EE351,0x7BAC025A,0x6DF1FE59,0x43235CB8,0x8ACD37C3,
+	0x3EA24B15,0x6DAE6D32,0x84A18D17,0x030A156D,0x52D89B79,0xE2E2DCD7,0xA7629B33,0x3F9BFBDD,
+	0x0109281F,0x0CCAB3E8,0x17327870,0xB28452D6,0xA5487117,0xD6AB949D,0x524F65BD,0x2285F81F,
+	0x9EE8DCA1,0x9722B593,0x727381AA,0x32A5BFAD,0xC1191C3A,0x10F8507B,0x4A18EC4F,0x90916F98,
+	0x18C1192E,0x2C50A8CE,0xA9AE61FC,0x032DCE62,0x0B2CE7D5,0xBB259DF3,0xF34C9F58,0xCEB7CE37,
+	0x0A33D9A0,0xA533CEB3,0x886D59CA,0xBFBE54CB,0xD000A9A2,0xF4A7F1A8,0x6EA4E94C,0x20E27AE1,
+	0x3723D076,0x702467AE,0x6165F214,0xA6797416,0x57E7D84E,0xA4E52FC2,0x1D47BF2B,0x73B54608,
+	/* T[11] */
+	0x14CB8416,0x42D9BE1C,0xBA104BB4,0xF712A468,0xE8B4E401,0xD2B4A3CE,0x5790492F,0x9EF3E5B2,
+	0xFA50E0F0,0x9CCD56B0,0xE94C1130,0x3F587659,0x475BC17A,0xAF67CE67,0x6F44E441,0x93E1F2A9,
+	0x4350C27C,0x5AAACEF0,0xD58D8B9F,0xF6066EEB,0x12DD7A1A,0xFCF5E19F,0xDCE5C127,0xC2EE0F46,
+	0x850AC8DF,0xC223AC55,0xDA70D06D,0x8D5FD8E4,0x45B1BE24,0x4A18F85B,0xC7019245,0x97A6EA30,
+	0xA41FD828,0xDBBEC62B,0xA1504EF0,0xC5803B88,0x58707407,0x2B6B8081,0x5C2C25EA,0xCD33E4FD,
+	0x486008D2,0x816A7CE5,0xDFA6DFB6,0x70016404,0x854C7C9C,0x39D94F46,0xA792BFCA,0x2461BD6F,
+	0x16F1C2E1,0x5B122F8B,0x8A7F00FD,0xC677BE48,0x777D0430,0xCDF8C482,0xFD679BF8,0x9F5D1703,
+	0x8B3CD34B,0xA18AABE3,0xEE622825,0xB55B278D,0x08C7978B,0x54B7CFEC,0x43162A88,0x2C4D91F2,
+	0x8137798F,0x80C3F68B,0xAA966B6C,0x455EE9CD,0xC46AF46C,0x87C570FA,0x22B911E9,0xD5915474,
+	0xA131E676,0x14A09ED8,0x2A595375,0x511DC6A3,0xF75804B4,0xDBE3FCB2,0x8646B970,0x159A6F86,
+	0x7D44962B,0xDB5CDA64,0x09431A2E,0x06142ADB,0xA5B136F2,0xC5C5B9AE,0x4EC53667,0x7F37F7BB,
+	0x0212503E,0x199567D0,0x2E64F0E0,0x6508A5AC,0x4A90E22F,0xAD57293B,0xA49ECB7B,0x450BF03E,
+	0x3DD1B942,0x2E456B27,0xE4E70355,0x654B7F5A,0x82323874,0x21F0A0F7,0x9431D89E,0x2122DF30,
+	0x3182325D,0x58A1519C,0x535CC3F8,0x065B9CC5,0x1659CFAA,0x764B3BE6,0xE6993EB1,0x9D6F9C6F,
+	0x1467B341,0x4A679D66,0x10DAB395,0x7F7CA997,0xA0015345,0xE94FE351,0xDD49D299,0x41C4F5C2,
+	0x6E47A0EC,0xE048CF5C,0xC2CBE428,0x4CF2E82C,0xAFCFB09D,0x49CA5F84,0x3A8F7E57,0xE76A8C10,
+	/* T[12] */
+	0x2EC9C901,0xC8691F13,0x1D5BAB8F,0x50E389A7,0x569926C0,0xD931EEF5,0x9FB61D8F,0xB27CD7AC,
+	0xDF11C677,0x430137AB,0xA722955C,0x19E5BC93,0xCEA3D329,0xC9BBAF3C,0xA93451EC,0xFB9C1B6D,
+	0x4DD386D9,0x2DEF3F22,0x2D933D0C,0x6AF270D9,0x63518E5F,0xBDFF8CEA,0xED55C1E7,0x33494FAC,
+	0x95F5BD65,0x0AC56063,0x6650FEA9,0xD8186A64,0xFA63062D,0x7D7374CA,0xDFC82D23,0xEA3D4460,
+	0x43FBC5D3,0xB4BE134B,0xE7DDAD94,0xC40C8788,0x6FFE7DC6,0xF131E11C,0xBD5F4120,0xA5489FD9,
+	0x7B83E1A8,0xB04E9FAC,0x61B59488,0x1D872CA2,0x8EB31DFC,0xB9F9A667,0x88752494,0x45370E1B,
+	0x0DFAB921,0xB724273C,0xF5BFD631,0x2FB4E780,0x0B845A30,0xB7AB733F,0xB9CF5BF0,0xBE4A7642,
+	0x4EB22645,0x071E1A59,0x0DF96626,0xAC959995,0xEC0326FE,0xBCAB797F,0x77C499D9,0x99C89C64,
+	0x848E9434,0x3063E565,0xDA509257,0x637D6788,0xC5F30B96,0x084F373A,0x028CEB01,0x462A0AA1,
+	0x9B8DFC41,0xBFFE29F6,0xE68BF3A9,0xEC5B00F5,0x43E7E8C5,0xE680315D,0x3653F146,0xDD134235,
+	0xD0B49004,0x53184062,0xC7F29700,0xD840D378,0x6D723E86,0x33083324,0xD7E27226,0x328E5B48,
+	0xEAC3F684,0xD9014A8A,0x94C93685,0xAC10A977,0xFECAB1F3,0x8B0521F7,0x2DB7BBF3,0x2EA5C211,
+	0x9499F02D,0x13F32067,0xAF0C40AD,0x0E8F2055,0x928217A4,0xC14486F0,0xDC060D91,0x61B7509B,
+	0x9E9B6F2C,0x7406C5F5,0x57BD6CD8,0xF24ECB43,0x214EB2FF,0x6ED01A73,0xD2C423D8,0xABF829D6,
+	0xF49099B9,0x5EC04DA8,0x7C5D9317,0xEC13B580,0xE80CFC66,0x1BB6C06F,0x7091FA0E,0x2C6A94D3,
+	0x8129335C,0x94378D2E,0xFCDDB032,0xA049B4D2,0xC3D556A0,0xD86BD401,0x4067CAC8,0xA58D8C30,
+	/* T[13] */
+	0x5D939203,0x90D23E26,0xDC51F7B4,0xDB3D12CF,0xB8F0CA9E,0x64AE3598,0xBFE396B4,0xD62FF9FE,
+	0xEF5A0F1F,0x7B7FDD89,0x54B81FEC,0x097CAA7D,0x2C07A616,0x7959A53C,0x1E9D185F,0xEE0E9D38,
+	0x29FA0D7B,0xEE17054B,0xC9A54953,0x2CDD81A7,0x9904B48C,0x8E94FBD3,0xEAF75244,0xF55CD6D2,
+	0xADB9AE4F,0x8D956521,0x779EBD4D,0x38CD05AB,0x1E269F43,0x4E698A53,0xDA080290,0x5B499EDC,
+	0x71A996AC,0xFB0CD3D3,0x691D3C37,0x6234F1E6,0xA0275E11,0xA648A14A,0x806AA452,0x3FD46F47,
+	0x21437B03,0x42DDA516,0x285D3E37,0x8F4937AD,0xFB3001EA,0x8B862109,0x744C528A,0x2DBF998B,
+	0xAA002643,0x09556C59,0x08A85E90,0x6A6C8AAF,0x5AC53B1B,0xBB43D9EA,0xEE8B2570,0xCD96D97B,
+	0xDBDD736E,0xB4AF83B7,0x89FAD45D,0xDE521603,0x011F84F5,0x17A28336,0xF5ED317B,0x775C43E9,
+	0xA404250D,0x82926F8F,0x538154D1,0x3E8F8CD9,0xCA332732,0x49AB244E,0x8803524F,0xC6C523BE,
+	0x0859D87C,0x44465731,0x80A839E0,0x14B7C6D0,0x98DD5008,0x3EB15087,0x83225E8E,0x28B385CD,
+	0x7934F0A8,0xE5FC7BF8,0xC1ED4B13,0x127EAA0F,0xECDA0F9D,0x5B08BE7F,0x4C522933,0xB6C5C8AA,
+	0xF74E9F13,0x94B35271,0xC8BA78A3,0x9EB67837,0x4ACC7FEB,0x45019AA4,0xA84A7C85,0xA140D29F,
+	0xE0F966DF,0xF739767F,0x276A9A24,0xFF2CE80A,0x311446D5,0x9FE28406,0xD7258FAB,0x2B1F94C6,
+	0xBDDF1523,0x32B6788C,0x718DBEBD,0x5F3A3131,0xE396F72F,0xB96C3FC6,0xCF8AE24F,0x841134D7,
+	0x3A5CD1F8,0xC6FEE94F,0x95AEB055,0x5AF7879D,0xAB7EB9D4,0x6AD9E311,0xCCBFC020,0xAEF3F365,
+	0x34253022,0x4FB554D9,0xD27E2373,0x90B71385,0xE4EF62A6,0x02DF53AA,0x80CF9592,0x4B1B1860,
+	/* T[14] */
+	0x3A3E43FA,0x8CBFFECA,0x118D40B2,0x41A3FC72,0x979A9A1F,0x5C51F939,0x92315EDE,0xF7E47AFC,
+	0xE14D9106,0x83D79D1E,0x5DF225F7,0x69B1889C,0x9427B42D,0x3E440BA1,0x73E2463B,0x370E5327,
+	0xF947F129,0x825EBE06,0x4A4DA7FC,0x48CCD082,0x5293E62D,0xB478B905,0x592CE51B,0xFCFABEE6,
+	0xC7BF0B26,0x2AA17E47,0x2FA6175A,0xFD0CCAB5,0x95F9E4FE,0x66B5B20C,0xEB655760,0xB853DACE,
+	0x3BA802CD,0xFE848F22,0xDF1D2031,0xF90DF7BD,0xFA87B98A,0x9490F575,0x6F8C1164,0x33DBEB08,
+	0x1CFDB379,0x90EA5A79,0x9E5106C0,0xB015D79F,0xF41BE9B0,0x45496254,0x5C8F515C,0x1B37A4B2,
+	0xE54B1E6F,0xDAC6A2F7,0x48B5BEDD,0xE1BA2F07,0xD11F4F8A,0x9172C024,0x403BDC65,0x551EE9F5,
+	0xC2F1B173,0x0FA9CA31,0x1C8FCC41,0x58C6B419,0x477BF48D,0xCCFDA7AD,0xA5CF0172,0x3C8E73EF,
+	0xCF866A85,0xC06DCA08,0xBFA1233D,0xCE7FE84E,0x33CC9D86,0x8DC692A1,0xF66B8DF6,0x4B361E25,
+	0xE14B63B2,0xF683A8BE,0xC5AB83E1,0xCA70BAE6,0x9EC2AB02,0x75A0C15F,0x5A595590,0x70DE2CF7,
+	0x185AED8D,0x40AF3982,0xBE5AE989,0x161ABECD,0x1F9A38B1,0x99D733BA,0x527378D9,0x588F9CB0,
+	0x29A4D6D5,0x563F56B4,0x9B279315,0xBFE2BD2D,0x3127929F,0x9FB030C8,0x44647D75,0x699F6A0A,
+	0x2884E989,0xE1F65DA7,0xF683B222,0x41DD9ED4,0xAF163765,0xE134B830,0xFB768E6A,0x8386D21C,
+	0x03888D8C,0xB9E17A44,0x47FBD949,0xF7D80FAC,0x3BFE7794,0xB34FA2CC,0xB04BF7AF,0x61BF9994,
+	0x099FD389,0xBFE8D2E5,0x90727B46,0x52A354DE,0xE7DC9B04,0x8E6C9769,0xC3B69D31,0x82E69C7C,
+	0x36B77C23,0xB4E2598C,0xF082C7DB,0xFC59F8FB,0x97113271,0x9DA3D2ED,0x8749C94D,0x749611DD,
+	/* T[15] */
+	0x747C87F4,0x197FFD94,0x231A8165,0x8347F8E4,0x2F35343E,0xB8A3F273,0x2462BDBC,0xEFC8F5F9,
+	0xC29B220D,0x07AF3A3D,0xBBE44BEF,0xD3631138,0x284F685A,0x7C881743,0xE7C48C76,0x6E1CA64E,
+	0xF28FE252,0x04BD7C0D,0x949B4FF9,0x9199A104,0xA527CC5A,0x68F1720A,0xB259CA37,0xF9F57DCC,
+	0x8F7E164D,0x5542FC8F,0x5F4C2EB4,0xFA19956A,0x2BF3C9FD,0xCD6B6419,0xD6CAAEC0,0x70A7B59D,
+	0x7750059B,0xFD091E44,0xBE3A4063,0xF21BEF7B,0xF50F7315,0x2921EAEB,0xDF1822C9,0x67B7D610,
+	0x39FB66F2,0x21D4B4F2,0x3CA20D81,0x602BAF3F,0xE837D361,0x8A92C4A9,0xB91EA2B8,0x366F4964,
+	0xCA963CDE,0xB58D45EF,0x916B7DBB,0xC3745E0E,0xA23E9F15,0x22E58049,0x8077B8CB,0xAA3DD3EA,
+	0x85E362E6,0x1F539463,0x391F9882,0xB18D6832,0x8EF7E91A,0x99FB4F5A,0x4B9E02E5,0x791CE7DF,
+	0x9F0CD50A,0x80DB9411,0x7F42467B,0x9CFFD09D,0x67993B0D,0x1B8D2542,0xECD71BED,0x966C3C4B,
+	0xC296C764,0xED07517D,0x8B5707C3,0x94E175CD,0x3D855605,0xEB4182BF,0xB4B2AB20,0xE1BC59EE,
+	0x30B5DB1A,0x815E7304,0x7CB5D312,0x2C357D9B,0x3F347162,0x33AE6774,0xA4E6F1B3,0xB11F3960,
+	0x5349ADAA,0xAC7EAD68,0x364F262A,0x7FC57A5B,0x624F253F,0x3F606190,0x88C8FAEB,0xD33ED414,
+	0x5109D312,0xC3ECBB4E,0xED076445,0x83BB3DA9,0x5E2C6ECA,0xC2697061,0xF6ED1CD5,0x070DA439,
+	0x07111B19,0x73C2F488,0x8FF7B293,0xEFB01F58,0x77FCEF29,0x669F4598,0x6097EF5F,0xC37F3329,
+	0x133FA712,0x7FD1A5CA,0x20E4F68D,0xA546A9BD,0xCFB93608,0x1CD92ED3,0x876D3A63,0x05CD38F9,
+	0x6D6EF847,0x69C4B318,0xE1058FB7,0xF8B3F1F7,0x2E2264E3,0x3B47A5DB,0x0E93929B,0xE92C23BB,
+};
+
+static const CCDhCombTable_t dh_comb_tables[] = {
+	{CC_DH_NAMED_GROUP_MODP2048, 64, 56, dh_comb_entries_modp2048},
+	{CC_DH_NAMED_GROUP_MODP3072, 96, 64, dh_comb_entries_modp3072},
+	{CC_DH_NAMED_GROUP_MODP4096, 128, 76, dh_comb_entries_modp4096},
+	{CC_DH_NAMED_GROUP_FFDHE2048, 64, 56, dh_comb_entries_ffdhe2048},
+	{CC_DH_NAMED_GROUP_FFDHE3072, 96, 64, dh_comb_entries_ffdhe3072},
+	{CC_DH_NAMED_GROUP_FFDHE4096, 128, 76, dh_comb_entries_ffdhe4096},
+};
+
+
+/**
+ @brief    the function returns the comb table of the generator of the named group,
+		or NULL if the group has no table
+ @return   return comb table pointer or NULL
+
+*/
+const CCDhCombTable_t *CC_DhGetCombTable(CCDhNamedGroupId_t groupId)
+{
+	uint32_t i;
+
+	for (i = 0; i < sizeof(dh_comb_tables)/sizeof(dh_comb_tables[0]); i++) {
+		if (dh_comb_tables[i].groupId == groupId) {
+			return &dh_comb_tables[i];
+		}
+	}
+	return NULL;
+}
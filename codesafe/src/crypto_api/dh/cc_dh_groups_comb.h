@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef CC_DH_GROUPS_COMB_H
+#define CC_DH_GROUPS_COMB_H
+
+/*
+ * All the includes that are needed for code using this module to
+ * compile correctly should be #included here.
+ */
+#include "cc_pal_types.h"
+#include "cc_dh_groups.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* count of comb teeth, i.e. of exponent bits combined into one table index */
+#define CC_DH_COMB_TEETH_COUNT      4
+/* count of entries in the comb table: the entry of index 0 (the value 1) is not stored */
+#define CC_DH_COMB_ENTRIES_COUNT    ((1UL << CC_DH_COMB_TEETH_COUNT) - 1)
+
+/* Fixed-base comb table of the generator of a DH named group.
+   Entry u-1 holds 2^(sum_{j=0..teeth-1} u_j * 2^(j*spacing)) mod p, where u_j is bit j of u;
+   the entries are in little endian order of words */
+typedef struct {
+	CCDhNamedGroupId_t	groupId;
+	/* size of each entry in words */
+	uint32_t		modSizeInWords;
+	/* distance in bits between the comb teeth; exponents up to teeth*spacing bits are covered */
+	uint32_t		teethSpacing;
+	/* CC_DH_COMB_ENTRIES_COUNT entries */
+	const uint32_t		*pEntries;
+} CCDhCombTable_t;
+
+/**
+ @brief    the function returns the comb table of the generator of the named group,
+		or NULL if the group has no table
+ @return   return comb table pointer or NULL
+
+*/
+const CCDhCombTable_t *CC_DhGetCombTable(CCDhNamedGroupId_t groupId);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/************* Include Files ****************/
+
+#include "cc_pal_mem.h"
+#include "cc_pal_types.h"
+#include "cc_pal_compiler.h"
+#include "cc_common.h"
+#include "cc_common_math.h"
+#include "cc_fips_defs.h"
+#include "cc_rnd_common.h"
+#include "cc_hash.h"
+#include "cc_hash_defs.h"
+#include "cc_ec_edw_api.h"
+#include "cc_ec_mont_edw_error.h"
+#include "ec_mont_edw_domain.h"
+#include "pka_ec_mont_edw.h"
+
+/************************ Typedefs  ****************************/
+
+/* the layout of the temporary buffer: the hash context is not used during the double
+   scalar multiplication, so it shares the memory with the buffer of the PKA layer */
+typedef struct {
+        union {
+                struct {
+                        CCHashUserContext_t     hashCtx;
+                        uint8_t                 block[CC_HASH_SHA512_BLOCK_SIZE_IN_BYTES];
+                } hash;
+                uint32_t pkaBuff[EC_EDW_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS];
+        } u;
+        CCHashResultBuf_t       digest;
+        uint32_t                wide[2*EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+        uint32_t                s[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+        uint32_t                r[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+        uint32_t                k[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+        uint32_t                point[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+} EcEdwTemp_t;
+
+CC_PAL_COMPILER_ASSERT(sizeof(EcEdwTemp_t) <= sizeof(CCEcEdwTempBuff_t), "CCEcEdwTempBuff_t is too small");
+
+/************************ Private Functions ***************************/
+
+/* SHA-512 of head1||head2||M: the heads and the start of the message are hashed as one block,
+   since only the last update may be of a size that is not a multiple of the block size */
+static CCError_t EcEdwHash(EcEdwTemp_t *pTemp,
+                           const uint8_t *pHead1, size_t head1Size,
+                           const uint8_t *pHead2, size_t head2Size,
+                           const uint8_t *pMsg, size_t msgSize)
+{
+        CCError_t err;
+        size_t size = head1Size + head2Size;
+        size_t msgPart = CC_MIN(msgSize, sizeof(pTemp->u.hash.block) - size);
+
+        CC_PalMemCopy(pTemp->u.hash.block, pHead1, head1Size);
+        if (head2Size > 0) {
+                CC_PalMemCopy(pTemp->u.hash.block + head1Size, pHead2, head2Size);
+        }
+        if (msgPart > 0) {
+                CC_PalMemCopy(pTemp->u.hash.block + size, pMsg, msgPart);
+        }
+
+        err = CC_HashInit(&pTemp->u.hash.hashCtx, CC_HASH_SHA512_mode);
+        if (err != CC_OK) {
+                return err;
+        }
+        err = CC_HashUpdate(&pTemp->u.hash.hashCtx, pTemp->u.hash.block, size + msgPart);
+        if (err != CC_OK) {
+                return err;
+        }
+        if (msgSize > msgPart) {
+                err = CC_HashUpdate(&pTemp->u.hash.hashCtx, (uint8_t *)pMsg + msgPart, msgSize - msgPart);
+                if (err != CC_OK) {
+                        return err;
+                }
+        }
+        return CC_HashFinish(&pTemp->u.hash.hashCtx, pTemp->digest);
+}
+
+/* reduces the 64 bytes digest modulo L */
+static CCError_t EcEdwDigestReduce(EcEdwTemp_t *pTemp, uint32_t *pRes)
+{
+        CC_CommonConvertLsbMsbBytesToLswMswWords(pTemp->wide, (uint8_t *)pTemp->digest,
+                                                 CC_HASH_SHA512_DIGEST_SIZE_IN_BYTES);
+        return PkaEcEdwScalarReduce(EcMontEdwGetDomain25519(), pRes, pTemp->wide,
+                                    2*EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+}
+
+/* expands the seed (RFC 8032 5.1.5): the clamped scalar s from the first half of SHA-512(seed),
+   the second half (the prefix) is left in the digest */
+static CCError_t EcEdwExpandSeed(EcEdwTemp_t *pTemp, const uint8_t *pSeed)
+{
+        CCError_t err;
+        uint8_t *pDigest = (uint8_t *)pTemp->digest;
+
+        err = EcEdwHash(pTemp, pSeed, CC_EC_EDW_SEED_BYTES, NULL, 0, NULL, 0);
+        if (err != CC_OK) {
+                return err;
+        }
+        pDigest[0] &= 0xF8;
+        pDigest[CC_EC_EDW_MOD_SIZE_IN_BYTES - 1] &= 0x7F;
+        pDigest[CC_EC_EDW_MOD_SIZE_IN_BYTES - 1] |= 0x40;
+        CC_CommonConvertLsbMsbBytesToLswMswWords(pTemp->s, pDigest, CC_EC_EDW_MOD_SIZE_IN_BYTES);
+        return CC_OK;
+}
+
+/************************ Public Functions ***************************/
+
+CEXPORT_C CCError_t CC_EcEdwSeedKeyPair(
+                    const uint8_t               *pSeed,
+                    size_t                      seedSize,
+                    uint8_t                     *pSecrKey,
+                    size_t                      *pSecrKeySize,
+                    uint8_t                     *pPublKey,
+                    size_t                      *pPublKeySize,
+                    CCEcEdwTempBuff_t           *pTempBuff)
+{
+        CCError_t err;
+        EcEdwTemp_t *pTemp = (EcEdwTemp_t *)pTempBuff;
+
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        if ((pSeed == NULL) || (pSecrKey == NULL) || (pSecrKeySize == NULL) ||
+            (pPublKey == NULL) || (pPublKeySize == NULL) || (pTempBuff == NULL)) {
+                return CC_EC_EDW_INVALID_INPUT_POINTER_ERROR;
+        }
+        if (seedSize != CC_EC_EDW_SEED_BYTES) {
+                return CC_EC_EDW_INVALID_INPUT_SIZE_ERROR;
+        }
+        if ((*pSecrKeySize < CC_EC_EDW_SECR_KEY_BYTES) || (*pPublKeySize < CC_EC_EDW_PUBL_KEY_BYTES)) {
+                return CC_EC_EDW_INVALID_OUTPUT_SIZE_ERROR;
+        }
+
+        /* A = s*B, with s reduced modulo L for the comb */
+        err = EcEdwExpandSeed(pTemp, pSeed);
+        if (err != CC_OK) {
+                goto End;
+        }
+        err = PkaEcEdwScalarReduce(EcMontEdwGetDomain25519(), pTemp->s, pTemp->s, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        if (err != CC_OK) {
+                goto End;
+        }
+        err = PkaEcEdwScalarMultBase(EcMontEdwGetDomain25519(), pTemp->point, pTemp->s);
+        if (err != CC_OK) {
+                goto End;
+        }
+
+        CC_CommonConvertLswMswWordsToLsbMsbBytes(pPublKey, pTemp->point, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        *pPublKeySize = CC_EC_EDW_PUBL_KEY_BYTES;
+        /* the seed is copied after the public key, since the buffers may overlap */
+        CC_PalMemMove(pSecrKey, pSeed, CC_EC_EDW_SEED_BYTES);
+        CC_PalMemCopy(pSecrKey + CC_EC_EDW_SEED_BYTES, pPublKey, CC_EC_EDW_PUBL_KEY_BYTES);
+        *pSecrKeySize = CC_EC_EDW_SECR_KEY_BYTES;
+End:
+        CC_PalMemSetZero(pTemp, sizeof(EcEdwTemp_t));
+        return err;
+}
+
+
+CEXPORT_C CCError_t CC_EcEdwKeyPair(
+                    uint8_t                     *pSecrKey,
+                    size_t                      *pSecrKeySize,
+                    uint8_t                     *pPublKey,
+                    size_t                      *pPublKeySize,
+                    CCRndGenerateVectWorkFunc_t f_rng,
+                    void                        *p_rng,
+                    CCEcEdwTempBuff_t           *pTempBuff)
+{
+        CCError_t err;
+
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        if ((pSecrKey == NULL) || (pSecrKeySize == NULL) ||
+            (pPublKey == NULL) || (pPublKeySize == NULL) || (pTempBuff == NULL)) {
+                return CC_EC_EDW_INVALID_INPUT_POINTER_ERROR;
+        }
+        if (f_rng == NULL) {
+                return CC_EC_EDW_INVALID_RND_FUNC_PTR_ERROR;
+        }
+        if ((*pSecrKeySize < CC_EC_EDW_SECR_KEY_BYTES) || (*pPublKeySize < CC_EC_EDW_PUBL_KEY_BYTES)) {
+                return CC_EC_EDW_INVALID_OUTPUT_SIZE_ERROR;
+        }
+
+        /* the random seed is generated into the secret key buffer */
+        err = f_rng(p_rng, pSecrKey, CC_EC_EDW_SEED_BYTES);
+        if (err == CC_OK) {
+                err = CC_EcEdwSeedKeyPair(pSecrKey, CC_EC_EDW_SEED_BYTES, pSecrKey, pSecrKeySize,
+                                          pPublKey, pPublKeySize, pTempBuff);
+        }
+        if (err != CC_OK) {
+                CC_PalMemSetZero(pSecrKey, CC_EC_EDW_SECR_KEY_BYTES);
+        }
+        return err;
+}
+
+
+CEXPORT_C CCError_t CC_EcEdwSign(
+                    uint8_t                     *pSign,
+                    size_t                      *pSignSize,
+                    const uint8_t               *pMsg,
+                    size_t                      msgSize,
+                    const uint8_t               *pSecrKey,
+                    size_t                      secrKeySize,
+                    CCEcEdwTempBuff_t           *pTempBuff)
+{
+        CCError_t err;
+        EcEdwTemp_t *pTemp = (EcEdwTemp_t *)pTempBuff;
+        const EcMontEdwDomain_t *pDomain = EcMontEdwGetDomain25519();
+        const uint8_t *pPublKey;
+        uint8_t prefix[CC_EC_EDW_MOD_SIZE_IN_BYTES];
+
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        if ((pSign == NULL) || (pSignSize == NULL) || (pSecrKey == NULL) ||
+            (pTempBuff == NULL) || ((pMsg == NULL) && (msgSize != 0))) {
+                return CC_EC_EDW_INVALID_INPUT_POINTER_ERROR;
+        }
+        if (secrKeySize != CC_EC_EDW_SECR_KEY_BYTES) {
+                return CC_EC_EDW_INVALID_INPUT_SIZE_ERROR;
+        }
+        if (*pSignSize < CC_EC_EDW_SIGNATURE_BYTES) {
+                return CC_EC_EDW_INVALID_OUTPUT_SIZE_ERROR;
+        }
+        pPublKey = pSecrKey + CC_EC_EDW_SEED_BYTES;
+
+        /* s and prefix from the seed */
+        err = EcEdwExpandSeed(pTemp, pSecrKey);
+        if (err != CC_OK) {
+                goto End;
+        }
+        CC_PalMemCopy(prefix, (uint8_t *)pTemp->digest + CC_EC_EDW_MOD_SIZE_IN_BYTES, sizeof(prefix));
+
+        /* r = SHA-512(prefix||M) mod L, R = r*B */
+        err = EcEdwHash(pTemp, prefix, sizeof(prefix), NULL, 0, pMsg, msgSize);
+        if (err != CC_OK) {
+                goto End;
+        }
+        err = EcEdwDigestReduce(pTemp, pTemp->r);
+        if (err != CC_OK) {
+                goto End;
+        }
+        err = PkaEcEdwScalarMultBase(pDomain, pTemp->point, pTemp->r);
+        if (err != CC_OK) {
+                goto End;
+        }
+        CC_CommonConvertLswMswWordsToLsbMsbBytes(pSign, pTemp->point, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+
+        /* k = SHA-512(R||A||M) mod L, S = r + k*s mod L */
+        err = EcEdwHash(pTemp, pSign, CC_EC_EDW_MOD_SIZE_IN_BYTES, pPublKey, CC_EC_EDW_PUBL_KEY_BYTES,
+                        pMsg, msgSize);
+        if (err != CC_OK) {
+                goto End;
+        }
+        err = EcEdwDigestReduce(pTemp, pTemp->k);
+        if (err != CC_OK) {
+                goto End;
+        }
+        err = PkaEcEdwScalarMulAdd(pDomain, pTemp->point, pTemp->k, pTemp->s, pTemp->r);
+        if (err != CC_OK) {
+                goto End;
+        }
+        CC_CommonConvertLswMswWordsToLsbMsbBytes(pSign + CC_EC_EDW_MOD_SIZE_IN_BYTES, pTemp->point,
+                                                 EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        *pSignSize = CC_EC_EDW_SIGNATURE_BYTES;
+End:
+        if (err != CC_OK) {
+                CC_PalMemSetZero(pSign, CC_EC_EDW_SIGNATURE_BYTES);
+        }
+        CC_PalMemSetZero(prefix, sizeof(prefix));
+        CC_PalMemSetZero(pTemp, sizeof(EcEdwTemp_t));
+        return err;
+}
+
+
+CEXPORT_C CCError_t CC_EcEdwVerify(
+                    const uint8_t               *pSign,
+                    size_t                      signSize,
+                    const uint8_t               *pPublKey,
+                    size_t                      publKeySize,
+                    const uint8_t               *pMsg,
+                    size_t                      msgSize,
+                    CCEcEdwTempBuff_t           *pTempBuff)
+{
+        CCError_t err;
+        EcEdwTemp_t *pTemp = (EcEdwTemp_t *)pTempBuff;
+        const EcMontEdwDomain_t *pDomain = EcMontEdwGetDomain25519();
+        CCCommonCmpCounter_t cmp;
+
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        if ((pSign == NULL) || (pPublKey == NULL) || (pTempBuff == NULL) ||
+            ((pMsg == NULL) && (msgSize != 0))) {
+                return CC_EC_EDW_INVALID_INPUT_POINTER_ERROR;
+        }
+        if ((signSize != CC_EC_EDW_SIGNATURE_BYTES) || (publKeySize != CC_EC_EDW_PUBL_KEY_BYTES)) {
+                return CC_EC_EDW_INVALID_INPUT_SIZE_ERROR;
+        }
+
+        /* S must be less than L (RFC 8032 5.1.7) */
+        CC_CommonConvertLsbMsbBytesToLswMswWords(pTemp->s, pSign + CC_EC_EDW_MOD_SIZE_IN_BYTES,
+                                                 CC_EC_EDW_MOD_SIZE_IN_BYTES);
+        cmp = CC_CommonCmpLsWordsUnsignedCounters(pTemp->s, EC_MONT_EDW_MOD_SIZE_IN_WORDS,
+                                                  pDomain->ecOrd, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        if (cmp != CC_COMMON_CmpCounter2GreaterThenCounter1) {
+                err = CC_EC_EDW_SIGN_VERIFY_FAILED_ERROR;
+                goto End;
+        }
+
+        /* k = SHA-512(R||A||M) mod L */
+        err = EcEdwHash(pTemp, pSign, CC_EC_EDW_MOD_SIZE_IN_BYTES, pPublKey, CC_EC_EDW_PUBL_KEY_BYTES,
+                        pMsg, msgSize);
+        if (err != CC_OK) {
+                goto End;
+        }
+        err = EcEdwDigestReduce(pTemp, pTemp->k);
+        if (err != CC_OK) {
+                goto End;
+        }
+
+        /* the encoding of S*B - k*A must be R */
+        CC_CommonConvertLsbMsbBytesToLswMswWords(pTemp->r, pPublKey, CC_EC_EDW_PUBL_KEY_BYTES);
+        err = PkaEcEdwDoubleScalarMult(pDomain, pTemp->point, pTemp->s, pTemp->k, pTemp->r, pTemp->u.pkaBuff);
+        if (err != CC_OK) {
+                goto End;
+        }
+        CC_CommonConvertLsbMsbBytesToLswMswWords(pTemp->r, pSign, CC_EC_EDW_MOD_SIZE_IN_BYTES);
+        if (CC_PalMemCmp(pTemp->point, pTemp->r, CC_EC_EDW_MOD_SIZE_IN_BYTES) != 0) {
+                err = CC_EC_EDW_SIGN_VERIFY_FAILED_ERROR;
+        }
+End:
+        CC_PalMemSetZero(pTemp, sizeof(EcEdwTemp_t));
+        return err;
+}
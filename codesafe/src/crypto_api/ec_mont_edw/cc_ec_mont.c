@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/************* Include Files ****************/
+
+#include "cc_pal_mem.h"
+#include "cc_pal_types.h"
+#include "cc_common.h"
+#include "cc_fips_defs.h"
+#include "cc_rnd_common.h"
+#include "cc_ec_mont_api.h"
+#include "cc_ec_mont_edw_error.h"
+#include "ec_mont_edw_domain.h"
+#include "pka_ec_mont_edw.h"
+
+/************************ Private Functions ***************************/
+
+/* clamps the X25519 scalar (RFC 7748 5) and converts it to words */
+static void EcMontClampScalar(uint32_t *pScalarWords, const uint8_t *pScalar)
+{
+        uint8_t k[CC_EC_MONT_SCALAR_SIZE_IN_BYTES];
+
+        CC_PalMemCopy(k, pScalar, sizeof(k));
+        k[0] &= 0xF8;
+        k[CC_EC_MONT_SCALAR_SIZE_IN_BYTES - 1] &= 0x7F;
+        k[CC_EC_MONT_SCALAR_SIZE_IN_BYTES - 1] |= 0x40;
+        CC_CommonConvertLsbMsbBytesToLswMswWords(pScalarWords, k, sizeof(k));
+        CC_PalMemSetZero(k, sizeof(k));
+}
+
+/************************ Public Functions ***************************/
+
+CEXPORT_C CCError_t CC_EcMontScalarmult(
+                    uint8_t                     *pResPoint,
+                    size_t                      *pResPointSize,
+                    const uint8_t               *pScalar,
+                    size_t                      scalarSize,
+                    const uint8_t               *pInPoint,
+                    size_t                      inPointSize)
+{
+        CCError_t err;
+        uint32_t k[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+        uint32_t u[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+        uint32_t isZero = 0, i;
+
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        if ((pResPoint == NULL) || (pResPointSize == NULL) ||
+            (pScalar == NULL) || (pInPoint == NULL)) {
+                return CC_EC_MONT_INVALID_INPUT_POINTER_ERROR;
+        }
+        if ((scalarSize != CC_EC_MONT_SCALAR_SIZE_IN_BYTES) ||
+            (inPointSize != CC_EC_MONT_MOD_SIZE_IN_BYTES)) {
+                return CC_EC_MONT_INVALID_INPUT_SIZE_ERROR;
+        }
+        if (*pResPointSize < CC_EC_MONT_MOD_SIZE_IN_BYTES) {
+                return CC_EC_MONT_INVALID_OUTPUT_SIZE_ERROR;
+        }
+
+        /* the most significant bit of the u-coordinate is masked */
+        CC_CommonConvertLsbMsbBytesToLswMswWords(u, pInPoint, CC_EC_MONT_MOD_SIZE_IN_BYTES);
+        u[EC_MONT_EDW_MOD_SIZE_IN_WORDS - 1] &= 0x7FFFFFFFUL;
+        EcMontClampScalar(k, pScalar);
+
+        err = PkaEcMontScalarMult(EcMontEdwGetDomain25519(), u, k, u);
+        if (err != CC_OK) {
+                goto End;
+        }
+
+        /* the all-zero result means the input point is of small order */
+        for (i = 0; i < EC_MONT_EDW_MOD_SIZE_IN_WORDS; i++) {
+                isZero |= u[i];
+        }
+        if (isZero == 0) {
+                err = CC_EC_MONT_SHARED_SECRET_IS_ZERO_ERROR;
+                goto End;
+        }
+
+        CC_CommonConvertLswMswWordsToLsbMsbBytes(pResPoint, u, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        *pResPointSize = CC_EC_MONT_MOD_SIZE_IN_BYTES;
+End:
+        CC_PalMemSetZero(k, sizeof(k));
+        CC_PalMemSetZero(u, sizeof(u));
+        return err;
+}
+
+
+CEXPORT_C CCError_t CC_EcMontScalarmultBase(
+                    uint8_t                     *pResPoint,
+                    size_t                      *pResPointSize,
+                    const uint8_t               *pScalar,
+                    size_t                      scalarSize)
+{
+        CCError_t err;
+        uint32_t k[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+        uint32_t u[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        if ((pResPoint == NULL) || (pResPointSize == NULL) || (pScalar == NULL)) {
+                return CC_EC_MONT_INVALID_INPUT_POINTER_ERROR;
+        }
+        if (scalarSize != CC_EC_MONT_SCALAR_SIZE_IN_BYTES) {
+                return CC_EC_MONT_INVALID_INPUT_SIZE_ERROR;
+        }
+        if (*pResPointSize < CC_EC_MONT_MOD_SIZE_IN_BYTES) {
+                return CC_EC_MONT_INVALID_OUTPUT_SIZE_ERROR;
+        }
+
+        EcMontClampScalar(k, pScalar);
+        err = PkaEcMontScalarMultBase(EcMontEdwGetDomain25519(), u, k);
+        if (err == CC_OK) {
+                CC_CommonConvertLswMswWordsToLsbMsbBytes(pResPoint, u, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+                *pResPointSize = CC_EC_MONT_MOD_SIZE_IN_BYTES;
+        }
+
+        CC_PalMemSetZero(k, sizeof(k));
+        return err;
+}
+
+
+CEXPORT_C CCError_t CC_EcMontKeyPair(
+                    uint8_t                     *pPublKey,
+                    size_t                      *pPublKeySize,
+                    uint8_t                     *pSecrKey,
+                    size_t                      *pSecrKeySize,
+                    CCRndGenerateVectWorkFunc_t f_rng,
+                    void                        *p_rng)
+{
+        CCError_t err;
+
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        if ((pPublKey == NULL) || (pPublKeySize == NULL) ||
+            (pSecrKey == NULL) || (pSecrKeySize == NULL)) {
+                return CC_EC_MONT_INVALID_INPUT_POINTER_ERROR;
+        }
+        if (f_rng == NULL) {
+                return CC_EC_MONT_INVALID_RND_FUNC_PTR_ERROR;
+        }
+        if ((*pPublKeySize < CC_EC_MONT_MOD_SIZE_IN_BYTES) ||
+            (*pSecrKeySize < CC_EC_MONT_SCALAR_SIZE_IN_BYTES)) {
+                return CC_EC_MONT_INVALID_OUTPUT_SIZE_ERROR;
+        }
+
+        err = f_rng(p_rng, pSecrKey, CC_EC_MONT_SCALAR_SIZE_IN_BYTES);
+        if (err != CC_OK) {
+                goto End;
+        }
+        err = CC_EcMontScalarmultBase(pPublKey, pPublKeySize, pSecrKey, CC_EC_MONT_SCALAR_SIZE_IN_BYTES);
+        if (err != CC_OK) {
+                goto End;
+        }
+        *pSecrKeySize = CC_EC_MONT_SCALAR_SIZE_IN_BYTES;
+End:
+        if (err != CC_OK) {
+                CC_PalMemSetZero(pSecrKey, CC_EC_MONT_SCALAR_SIZE_IN_BYTES);
+        }
+        return err;
+}
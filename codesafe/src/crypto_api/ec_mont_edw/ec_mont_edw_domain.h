@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef EC_MONT_EDW_DOMAIN_H
+#define EC_MONT_EDW_DOMAIN_H
+
+/*
+ * All the includes that are needed for code using this module to
+ * compile correctly should be #included here.
+ */
+#include "cc_pal_types.h"
+#include "cc_pka_defs_hw.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* size of the field modulus p = 2^255 - 19 */
+#define EC_MONT_EDW_MOD_SIZE_IN_BITS            255
+#define EC_MONT_EDW_MOD_SIZE_IN_WORDS           8
+#define EC_MONT_EDW_MOD_SIZE_IN_BYTES           32
+/* size of the order L of the Ed25519 base point */
+#define EC_MONT_EDW_ORD_SIZE_IN_BITS            253
+
+/* count of comb teeth of the fixed-base table of the Ed25519 base point */
+#define EC_EDW_COMB_TEETH_COUNT                 6
+/* count of points in the comb table */
+#define EC_EDW_COMB_POINTS_COUNT                (1UL << (EC_EDW_COMB_TEETH_COUNT - 1))
+/* width of the NAF of the verification scalars */
+#define EC_EDW_WNAF_WIDTH                       5
+/* count of the odd multiples P, 3P, .., (2^(w-1) - 1)P used by the NAF */
+#define EC_EDW_WNAF_POINTS_COUNT                (1UL << (EC_EDW_WNAF_WIDTH - 2))
+/* size of a table point in the niels form (y+x, y-x, 2*d*x*y) in words */
+#define EC_EDW_NIELS_POINT_SIZE_IN_WORDS        (3*EC_MONT_EDW_MOD_SIZE_IN_WORDS)
+
+/* The domain of Curve25519 (RFC 7748) and of Ed25519 (RFC 8032), the twisted Edwards curve
+   -x^2 + y^2 = 1 + d*x^2*y^2 that is birationally equivalent to it.
+   All data is given in little endian order of words in arrays */
+typedef struct {
+	/* field modulus p and its Barrett tag */
+	uint32_t	ecP[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+	uint32_t	ecPTag[CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS];
+	/* order L of the base point and its Barrett tag */
+	uint32_t	ecOrd[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+	uint32_t	ecOrdTag[CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS];
+	/* Montgomery curve constant (A - 2)/4 of the ladder */
+	uint32_t	ecMontA24;
+	/* Edwards curve: d, 2*d and sqrt(-1) mod p */
+	uint32_t	ecEdwD[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+	uint32_t	ecEdwD2[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+	uint32_t	ecSqrtM1[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+	/* distance in bits between the comb teeth */
+	uint32_t	combSpacing;
+	/* EC_EDW_COMB_POINTS_COUNT comb points of the base point, in the niels form */
+	const uint32_t	*pCombPoints;
+	/* EC_EDW_WNAF_POINTS_COUNT odd multiples of the base point, in the niels form */
+	const uint32_t	*pWnafPoints;
+} EcMontEdwDomain_t;
+
+/**
+ @brief    the function returns the domain of Curve25519 and Ed25519
+ @return   return domain pointer
+
+*/
+const EcMontEdwDomain_t *EcMontEdwGetDomain25519(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
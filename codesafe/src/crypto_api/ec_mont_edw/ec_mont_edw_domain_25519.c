@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/* This file is generated by utils/src/ecc_comb_tables/cc_ec_mont_edw_domain_gen.py - do not edit. */
+
+#include "cc_pal_types.h"
+#include "cc_pka_defs_hw.h"
+#include "ec_mont_edw_domain.h"
+
+/* Ed25519 base point: 6 teeth spaced 43 bits apart */
+static const uint32_t ec_edw_comb_points_25519[EC_EDW_COMB_POINTS_COUNT*EC_EDW_NIELS_POINT_SIZE_IN_WORDS] = {
+	/* T[0] */
+	0x7625D484,0x14E73B13,0xD80EAAD0,0x7A652B75,0x41A18DF7,0x161887BC,0x28F089BC,0x6A47D4A9,
+	0x5A28E796,0x87B57316,0xBEFC49B4,0xFFF3D140,0xED9023A1,0x1F53A4C9,0x5B57198C,0x57CFFE4F,
+	0x4F84154F,0x185B0117,0xFFC9F805,0xC24FF786,0xCFF0855C,0xE4774983,0x73E29AE1,0x616C64C8,
+	/* T[1] */
+	0x65B9E7BD,0x2AA28F23,0x8F0DD51E,0x20ED6EA1,0x020D5C42,0x702384BC,0xCCAF1228,0x4FBBAD53,
+	0x72B82A23,0x72740A25,0x3D9CB040,0x0729A7F0,0x529D6557,0x3CBB7A30,0xCCE16E52,0x38431C6A,
+	0xD8BA470E,0x88DF2C0E,0x9F547797,0xF837BAAB,0x0E8A236E,0x04C2BDD1,0xC3EAF44C,0x380A2FFC,
+	/* T[2] */
+	0xA0271034,0x5126346F,0x75C4CDD6,0xB0A1620E,0xBF60A562,0x83B04A2C,0xF2954990,0x701B7B3D,
+	0x3035C471,0x6A4EA80C,0xE8FDA451,0xD0ED3C00,0xC89A707E,0x1C89DB86,0x87F431C1,0x02B54AFB,
+	0x750DDAB8,0xAD3C621C,0x1443E94C,0x39374B10,0x45CEA70D,0xC573C594,0xEAED653F,0x4286C49E,
+	/* T[3] */
+	0x47607376,0xE4CD9258,0x7A61D795,0xFB38998B,0x2D9B7CEA,0x65861244,0x0D1CE664,0x61A5C1C6,
+	0x8A23FE06,0x23FB5069,0xE81D46A0,0x28172F1E,0xC3D6C7CB,0x51ED4105,0xEC3FBE13,0x1D5DDA8C,
+	0xAC7D8C7C,0xD183B108,0x70588D5D,0xD06EE55C,0x09B485E8,0xD060F38F,0x5485AEAF,0x4947F0A5,
+	/* T[4] */
+	0xAE24D909,0x15652146,0x359D04FF,0x8EFCB8DB,0x5B3ED7D5,0xF851DF40,0xCBB15D4D,0x5D666F67,
+	0x45D2F187,0xD1A75D38,0x57AA8763,0xC9841C2F,0xF3F39C47,0x0F8B3B7D,0x5354362D,0x64DAD614,
+	0x821DB302,0x2CABA485,0x0820E899,0x8F0EFA95,0x5326B1B2,0x6DB21B73,0x8C531279,0x7FCD9589,
+	/* T[5] */
+	0xE7C67F78,0x14A2CEDD,0x788B9A11,0xA3F8088E,0xBF30CCA6,0xAF8D50BD,0x90B046AA,0x2B52F072,
+	0x77EAFD40,0x9D49F310,0xA2728856,0x3F254199,0xC0681C83,0x7DE409D4,0x2A7D8B25,0x0B8C8ED9,
+	0xE43B68CA,0x2464E7A8,0x788C0DB4,0x4EEF4072,0xFA7E15F9,0xEB3E7D05,0x00949841,0x2BD6D54D,
+	/* T[6] */
+	0x6EB45B0B,0x50B52769,0x263F6A5A,0xAEA9BB6A,0x9E77721E,0xC892B533,0x99767C95,0x56882FC4,
+	0xEC1CE962,0xB390936A,0x0CF45ABC,0x097C9F58,0x9564C996,0xA1323182,0xC4E91F01,0x6BD2CC05,
+	0x59C4AE90,0xE11517FE,0x77B350C1,0xA12E53F5,0xF62A72F0,0x5131F1E7,0x44664C89,0x685D6D8D,
+	/* T[7] */
+	0x51415FE5,0xE3585F80,0xC18160BC,0x942B73FF,0xFD4005D4,0x705962CA,0x917DF48C,0x661AE7A8,
+	0x4730D0FB,0xE7A563FF,0x0094482B,0xFABEB40E,0xE95EE0DF,0xD766EC2C,0x432B28FA,0x7F068DF4,
+	0xDE7808A5,0x6973E5FA,0x94C92C93,0x7784197C,0xCD414DE7,0xCA7C2397,0xAF5DAEF2,0x3D75C7EC,
+	/* T[8] */
+	0xF65EDAC8,0x0686C9DF,0x96EA46B2,0xEBF61F52,0x3A700C7E,0x49F2A9D2,0x0412EEE4,0x6D2AE3DB,
+	0x385D9F04,0x5B334E43,0x70BB5E7B,0x30381AD6,0x5E62F989,0x4552CEEA,0x2E373797,0x5193BF37,
+	0x3A93BBE9,0x3CA2E979,0xE247E3CD,0x143803F4,0x0DF3A8B2,0xD704082B,0x79BDE097,0x10174A64,
+	/* T[9] */
+	0x7700416C,0x3F1281CB,0x3DC7F0FA,0xACC30A6C,0x9B39955C,0x3B8BD8B5,0xE1BDD234,0x733F49A0,
+	0x9C21EA3D,0x352DD405,0x4A8C8D1E,0xF1D20DF8,0x66C16160,0xAFD7D918,0x3FFC7C23,0x3CA4F962,
+	0xB31500A8,0xF1DC0C17,0xB5CB80E6,0x2F154607,0xD9E55718,0xB5A1E77C,0x2447360C,0x139401D2,
+	/* T[10] */
+	0x5C92BDB0,0xA8679CAC,0xA5E3677A,0x78F655A0,0x0F5173C0,0x75E03F0D,0xF5E23774,0x388AEA7D,
+	0xCBEF829E,0x85F76BC5,0x8C18B228,0xFECD78EA,0x5FAC1F84,0x250AAE0A,0x0CEC5B08,0x45F2BAB0,
+	0x090F4ADD,0x1A3EAC11,0x179BBCF7,0xE06F3381,0x45790EDD,0xA19BF034,0xED5846B6,0x26D7210C,
+	/* T[11] */
+	0x86626C8E,0xA067DE41,0xEF1D214C,0x6BF13C12,0x3839E332,0x0A3085F1,0xA43643FF,0x75EA0510,
+	0x1E2C51A8,0x85BE2B1B,0x52823E25,0x313F74F0,0xA85E5B5B,0xDBE24891,0x83FD7287,0x4430533C,
+	0xD6F70350,0xF41CAC38,0x49A9109C,0x6F952598,0xC6CA851E,0xAF918A6C,0xC256C255,0x4F8E53C6,
+	/* T[12] */
+	0x54FDE072,0xC02B02DD,0x60FBBD82,0xEF873482,0xADB70314,0xEC880377,0x7E3B2CF8,0x5322B38D,
+	0x959415A6,0xD40A2D3B,0x47FF8630,0x7A07584F,0x63B808E5,0x69CDE638,0x0F110B01,0x1FE0371F,
+	0x55605904,0xB406EC1F,0x9F213220,0x0FC908CC,0xE2410111,0xF0DB6C78,0x7EB70130,0x27E79C99,
+	/* T[13] */
+	0xE523465B,0x7CF78445,0xEEB4B2C2,0xC6AD2D4D,0x062278E2,0x2E74FE6B,0x37A89744,0x48C4358E,
+	0x3E5F6B4A,0xDF7781C4,0xA34A77ED,0xA2AFDC9E,0x5D633048,0xAA33A48D,0x5B7AF13D,0x29688A6C,
+	0xEE6B6A33,0x75145B3A,0xC096B33F,0xBD50F01D,0x06F7E5CF,0x7331C27E,0x0C9579DE,0x4CA3A054,
+	/* T[14] */
+	0x82FB13AA,0x6AE92D5E,0x28AD6926,0xE77D9404,0x984832C7,0x1CC6173E,0x6EF32760,0x7B7CE9D0,
+	0x5A1C069F,0xA5B97A64,0x70D82B78,0x25133F2F,0x44F57D8F,0x7E4FF15F,0x11F2A1B1,0x226FE15C,
+	0xABC43226,0x442A6B83,0xB4D0F7EE,0x2C0A7776,0xE429EFB9,0xE4DF9CE1,0x1469AB45,0x22E0C22F,
+	/* T[15] */
+	0xAADA6F9F,0xD4D7F299,0xCAF03652,0x80DC1621,0x761EFE18,0xFC22FCE6,0xA56DF1B9,0x70EB7DAA,
+	0x637D7C8E,0x70D63982,0x906D8901,0x78323C8E,0xFF61AA5F,0xEE1FE0BC,0x73D11355,0x6FCB0053,
+	0x35F4A8D6,0x870BB2C7,0x486B6C91,0xC0853DD1,0x55BA0C33,0x95FDC557,0xC78B497F,0x2DF7804F,
+	/* T[16] */
+	0xE5345EF4,0x73A3EF10,0x3E2967D2,0xD1760FBA,0x75B26B18,0x4C2E0950,0x5D113255,0x318CD0EF,
+	0xD9AE2C44,0x834783A0,0x71B9B90F,0x8F7E80F8,0x3F3BEDEB,0x4AB04628,0xBB853FD7,0x44127330,
+	0x1DDFBFD3,0x05F460E3,0x5CB68941,0x2624A4A1,0x17911FFC,0x269D8FD8,0xE3D60C8D,0x77969A5D,
+	/* T[17] */
+	0x11B23CA1,0xF15F3019,0x6E44471F,0x79CF3108,0x5E1E1362,0x55F30F4E,0x6E8BD300,0x6C967226,
+	0xB2B8CB4E,0x881F63FB,0x5BDB8822,0x2505E08A,0x715DE5ED,0x75AE1515,0xED5D03E5,0x74976910,
+	0x3476E4F5,0xBD88C83A,0x3DEB12B6,0x76293717,0x36ABED93,0x1D57F16C,0x0D93BE4E,0x030AB895,
+	/* T[18] */
+	0x5449F640,0xD696B8B1,0xE788ED5E,0x1294CD3F,0xE340757F,0x57CCDAFA,0x4ED8B454,0x49A34388,
+	0xD981B29B,0x69A0AA43,0x4B2F3123,0x5CA77835,0x444F7C2B,0xE09A8220,0x7242C253,0x6AF3243B,
+	0x44BE48A0,0x62246128,0x16821E31,0xF1C4C8AA,0x4951B4FF,0x31329FFA,0x03B648DA,0x350FFA7A,
+	/* T[19] */
+	0x3E4F90A5,0x4724AE74,0xE3FF35D9,0x3CB22B87,0xB9142A59,0xE8653468,0x17299388,0x4733AFC8,
+	0xE5151883,0xE51A2527,0x8A14F328,0x3DEA8DEF,0x29FB6553,0x0441C0A8,0x97217E42,0x69D02055,
+	0xF0463202,0x37E4E95F,0x7DB0C7E8,0x71A4A1F0,0xA5C38F88,0xFC3BC01C,0xCF89FD26,0x66D4A465,
+	/* T[20] */
+	0x4BBA05DB,0x09BD1545,0x7AF54888,0xF2706BF0,0x65882A9D,0x622ED649,0x43F3CD15,0x4DAC752E,
+	0x941B4707,0x0AA58A8F,0x6EF34E73,0x2867AC5B,0xBA44BC82,0x0A78701C,0x5EAA4E07,0x6E4AE412,
+	0xE1780714,0x15541CA0,0xFE58604B,0xDFB76D21,0xB0CF2D9D,0x5A2CE05A,0xBAEF5FB2,0x07C4F18E,
+	/* T[21] */
+	0x5E5437FD,0xD5D61534,0x1462B40F,0xE6E0D77C,0x8080285F,0xD6CE7A0E,0xF92146CC,0x4DCE0DA6,
+	0xA957212F,0x19D58E12,0xA8AD2944,0x1344C6A4,0x84351525,0xCD146F36,0x7971DBAB,0x7844A544,
+	0x5B8BEDEC,0x1C4698B1,0xD6252F6F,0x7FC40D4A,0x20710E29,0x7720A228,0xF8E3CCBB,0x4C493E3C,
+	/* T[22] */
+	0x48AC1118,0x761A0C6A,0xADD7D035,0xCE3C985E,0x3E0D9B2D,0x726F91D2,0x7403F86E,0x28DFA5B7,
+	0x9D2956AA,0x4C3B94BC,0x43731E9B,0x7E86821E,0xAE5EC8C1,0x3CAB7C07,0x92725FA1,0x70283239,
+	0xF07A8972,0x4662FC05,0xD27A4CD1,0x2222B819,0x3797AAF5,0x49B724A4,0x3551CBF0,0x0BCB685F,
+	/* T[23] */
+	0x31527C00,0xC444A06E,0x852A1815,0xABDF3322,0xE20E3D09,0x71EFC9A6,0x017351CB,0x1A219B9F,
+	0x060E958B,0x9C443D1F,0xFA34FE18,0x67BB0CB5,0x12D60F84,0x4C751E5B,0x8C46D0F0,0x24023E67,
+	0xE7565D71,0x7009D1D6,0x820419C2,0x6FC1B74A,0xDD2DD7AA,0x9F27EAE8,0x41CEA20A,0x6AE93C00,
+	/* T[24] */
+	0x9164A620,0x6F112FC7,0xEEDF4B65,0x9A73AA63,0x9B928603,0x5CB8E63F,0x5450EF50,0x4EE49BBD,
+	0x90DEC84D,0x7410CDE6,0x3AB9A22C,0xF98766AF,0x558B7F24,0xEA842E47,0xDF174A18,0x1BF85139,
+	0x738605E6,0xA0972EA3,0xD4200226,0x8E036CBE,0x1440768A,0x2D2657AD,0x9445C01C,0x14A50B29,
+	/* T[25] */
+	0xDE25218E,0x3CFCF58B,0x30A4E1B2,0x702AD020,0x48835C53,0x1871C92B,0xE785D1A5,0x6FBDB4D6,
+	0x95C4E283,0x365213AD,0x79BFFED5,0x12801311,0x523D6146,0xB6260859,0x91E48DBD,0x50B4A3AC,
+	0x2F3BDEDF,0xDA8F4B94,0x90B32DC3,0xC2EE25A2,0x17288D8C,0x466EE95A,0xE12A44C5,0x360DA2F6,
+	/* T[26] */
+	0x1DD79A04,0x385BF853,0xA95E8904,0x222F5326,0x52B99550,0x64179B14,0x40AA701F,0x7B7E0CAF,
+	0x494804EA,0xF52E4794,0x66EF7317,0x78FEC705,0xC768E16F,0x119B1DAA,0x81E377E3,0x0DBE14D8,
+	0xEB562245,0x1551BB49,0x344147C7,0xB696A375,0x1A3BAA3B,0x735012CE,0xECC2C1B7,0x1154DAE5,
+	/* T[27] */
+	0xDA65FFBA,0x8CEBA7DD,0x2DC0F599,0xA44DD19F,0xAE50378E,0xBF87197F,0xCD7CACF2,0x0E1C4627,
+	0xAD470DC4,0xE9569E2D,0xAE170D99,0xA8B0FB0E,0xC69DBC0D,0xF8E4DF2A,0x5314A534,0x55F076E6,
+	0xFF43ADE0,0x9F06E123,0x48ED7288,0x465E91E7,0x5D4CF69D,0xD01919F3,0x9CFCC70B,0x11FC268A,
+	/* T[28] */
+	0x4D087809,0xB7DBC578,0x0F6A43E0,0x17D747C8,0x458EC731,0x6B46A01F,0x077C479A,0x7DCABC96,
+	0xBB7C9B83,0xCE0A4951,0x5FFCEF1B,0x749E0BF9,0xABC069F7,0x9D02ECED,0x1E143B80,0x251441DA,
+	0x5C8D95BB,0x76A79E21,0x110E335F,0x666C3C92,0x38E37569,0x1B37D02C,0xADE8764D,0x2E236F93,
+	/* T[29] */
+	0x4F70F5B7,0x7F7F1011,0xB556C54A,0x56892F77,0x5140E0BB,0xBBE23612,0xF4347D68,0x2C8D89A0,
+	0x9F569E37,0xFE76CFA4,0xF677D670,0x4942B5B7,0x64EAA78C,0x22828363,0x605D5B95,0x258D0C6D,
+	0x4ED5E7C3,0x63A6769E,0xE1F7E19C,0x730E509E,0x4B6C7016,0xDAB9C415,0x98EF72AB,0x6EDD7FB3,
+	/* T[30] */
+	0xB085DE6E,0x2AE7B595,0x1E8915DD,0x329F9CA7,0x6C77EDE2,0x2E3DE8CD,0xEB4737C0,0x6332FACE,
+	0x9CB2FC8B,0x5F0E2C99,0x3AE140D0,0x3680D4BF,0x321A8E01,0x8FC68F43,0x38AA45C5,0x558098E9,
+	0xB5FD8A12,0x3D95FDD7,0x01585153,0x4529F908,0x931BE119,0x39BFF198,0x0A0ED3E0,0x60B202D5,
+	/* T[31] */
+	0x080BC5BD,0x5687D564,0xDB67F9A1,0x5A7D1DE7,0x201326B8,0x1796C514,0xE6CE27BE,0x7D6E15A0,
+	0x347EE87B,0xD4DC828E,0x5F58040F,0x208C6FA2,0x652783F9,0x963BD759,0xB3AC5E90,0x4DB882C3,
+	0x9C57ACFE,0x2BDEF4AF,0x737774FA,0x925DBB92,0x9C53183F,0x792B73AA,0x8CBD504F,0x53B6110D,
+};
+
+/* Ed25519 base point: odd multiples for the width-5 NAF */
+static const uint32_t ec_edw_wnaf_points_25519[EC_EDW_WNAF_POINTS_COUNT*EC_EDW_NIELS_POINT_SIZE_IN_WORDS] = {
+	/* 1B */
+	0xF58C3B85,0x2FBC93C6,0xFB8C0E19,0xCF932DC6,0x643D42C2,0x270B4898,0x33D4BA65,0x07CF9D3A,
+	0xD740913E,0x9D103905,0xD140BEB3,0xFD399F05,0x688F8A09,0xA5C18434,0x98F81267,0x44FD2F92,
+	0x877AAA68,0xABC91205,0xCCAAC49E,0x26D9E823,0xDD43598C,0x5A1B7DCB,0x9F0C65A8,0x6F117B68,
+	/* 3B */
+	0x4CEE9730,0xAF25B0A8,0xE8864B8A,0x025A8430,0x9F016732,0xC11B5002,0x9A80F8F4,0x7A164E1B,
+	0xA4FCD265,0x56611FE8,0xE5C1BA7D,0x3BD353FD,0x214BD6BD,0x8131F31A,0x555BDA62,0x2AB91587,
+	0x0DD0D889,0x14AE933F,0x1C35DA62,0x58942322,0x8CF2DB4C,0xD170E545,0x12B9B4C6,0x5A2826AF,
+	/* 5B */
+	0x08A5BB33,0xA212BC44,0xC75EED02,0x8D5048C3,0x5ABFEC44,0xDD1BEB0C,0x46E206EB,0x2945CCF1,
+	0xA447D6BA,0x7F9182C3,0x4B2729B7,0xD50014D1,0xB864A087,0xE33CF11C,0xEB1B55F3,0x154A7E73,
+	0x812A8285,0xBCBBDBF1,0xD0BDD1FC,0x270E0807,0x1BBDA72D,0xB41B670B,0x6B3BB69A,0x43AABE69,
+	/* 7B */
+	0x944EA3BF,0x6B1A5CD0,0xB39DC0D2,0x7470353A,0x28542E49,0x71B25282,0x283C927E,0x461BEA69,
+	0xAA3221B1,0xBA6F2C9A,0x3BBA23A7,0x6CA02153,0x92192C3A,0x9DEA764F,0x2E5317E0,0x1D6EDD5D,
+	0x01B8B3A2,0xF1836DC8,0x053EA49A,0xB3035F47,0x5877ADF3,0x529C41BA,0x6A0F90A7,0x7A9FBB1C,
+	/* 9B */
+	0xA6A8632F,0x9B2E678A,0x51BC46C5,0xA6509E6F,0xC686F5B5,0xCEB233C9,0x8ADD7F59,0x34B9ED33,
+	0x039D8064,0xF36E217E,0xF520419B,0x98A081B6,0xE75EB044,0x96CBC608,0xFADC9C8F,0x49C05A51,
+	0x9045AF1B,0x06B4E8BF,0xA719D22F,0xE2FF83E8,0x93D4CF16,0xAAF6FC29,0x1B008B06,0x73C17202,
+	/* 11B */
+	0x8A802ADE,0x2FBF0084,0x02302E27,0xE5D9FECF,0x17703406,0x113E8471,0x546D8FAF,0x4275AAE2,
+	0x49864348,0x315F5B02,0x77088381,0x3ED6B369,0x6A8DEB95,0xA3A07555,0x29D5C77F,0x18AB5980,
+	0xFD6089E9,0xD82B2CC5,0x3282E4A4,0x031EB4A1,0xB51A8622,0x44311199,0xB53DF948,0x3DC65522,
+	/* 13B */
+	0xA2007F6D,0xBF70C222,0xB5BCDEDB,0xBF84B39A,0xFB07BA07,0x537A0E12,0xC346F241,0x234FD7EE,
+	0x327FBF93,0x506F013B,0x9B776F6B,0xAEFCEBC9,0xAAAD5968,0x9D12B232,0x176024A7,0x0267882D,
+	0x732EA378,0x5360A119,0xDF8DD471,0x2437E6B1,0x91A7E533,0xA2EF37F8,0xAA097863,0x497BA6FD,
+	/* 15B */
+	0x13CFEAA0,0x24CECC03,0x189C246D,0x8648C28D,0xC1F2D4D0,0x2DBDBDFA,0xF12DE72B,0x61E22917,
+	0x468CCF0B,0x040BCD86,0x2A9910D6,0xD3829BA4,0x07B25192,0x75083008,0x18D05EBF,0x43B5CD42,
+	0x9BD0B516,0x5D9A762F,0x373FDEEE,0xEB38AF4E,0x93D64270,0x032E5A7D,0x0AE4D842,0x511D6121,
+};
+
+/***********************************************************************************
+ *   Data base of Curve25519 and Ed25519: structure of type  EcMontEdwDomain_t      *
+ *       All data is given in little endian order of words in arrays               *
+ ***********************************************************************************/
+static const EcMontEdwDomain_t ec_mont_edw_domain_25519 = {
+	/* Field modulus :  p = 2^255 - 19 */
+	{0xFFFFFFED,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0x7FFFFFFF},
+	/* Barrett tag of p */
+	#ifdef CC_SUPPORT_PKA_128_32
+	{0x00000000,0x00000000,0x00000000,0x00000000,0x00000080},
+	#else  // CC_SUPPORT_PKA_64_16
+	{0x00000000,0x00000000,0x00000080,0x00000000,0x00000000},
+	#endif
+	/* Order of the base point:  L = 2^252 + 27742317777372353535851937790883648493 */
+	{0x5CF5D3ED,0x5812631A,0xA2F79CD6,0x14DEF9DE,0x00000000,0x00000000,0x00000000,0x10000000},
+	/* Barrett tag of L */
+	#ifdef CC_SUPPORT_PKA_128_32
+	{0xFFFFFEB2,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0x000000FF},
+	#else  // CC_SUPPORT_PKA_64_16
+	{0xFFFFFFFF,0xFFFFFFFF,0x000000FF,0x00000000,0x00000000},
+	#endif
+	/* Montgomery curve:  (A - 2)/4 = 121665 */
+	121665,
+	/* Edwards curve:  d = -121665/121666, 2*d and sqrt(-1) mod p */
+	{0x135978A3,0x75EB4DCA,0x4141D8AB,0x00700A4D,0x7779E898,0x8CC74079,0x2B6FFE73,0x52036CEE},
+	{0x26B2F159,0xEBD69B94,0x8283B156,0x00E0149A,0xEEF3D130,0x198E80F2,0x56DFFCE7,0x2406D9DC},
+	{0x4A0EA0B0,0xC4EE1B27,0xAD2FE478,0x2F431806,0x3DFBD7A7,0x2B4D0099,0x4FC1DF0B,0x2B832480},
+	/* Tables of the base point */
+	43,
+	ec_edw_comb_points_25519,
+	ec_edw_wnaf_points_25519
+};
+
+
+/**
+ @brief    the function returns the domain of Curve25519 and Ed25519
+ @return   return domain pointer
+
+*/
+const EcMontEdwDomain_t *EcMontEdwGetDomain25519(void)
+{
+	return &ec_mont_edw_domain_25519;
+}
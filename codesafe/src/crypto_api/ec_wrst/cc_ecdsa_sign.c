@@ -26,6 +26,8 @@
 #include "cc_general_defs.h"
 #include "md.h"
 #endif
+#include "pki_prof.h"
+#include "cc_pal_perf.h"
 
 /************************ Defines *****************************************/
 #if ( CC_HASH_USER_CTX_SIZE_IN_WORDS > CC_PKA_RSA_HASH_CTX_SIZE_IN_WORDS )
@@ -364,6 +366,7 @@ CEXPORT_C  CCError_t EcdsaSignFinishInt(
         uint32_t regVal;
         /* The return error identifier */
         CCError_t err = CC_OK;
+        CCPalPerfData_t perfIdx = 0;
 
         /* pointer to the active context  */
         EcdsaSignContext_t  *pWorkingContext;
@@ -489,11 +492,15 @@ CEXPORT_C  CCError_t EcdsaSignFinishInt(
 
 
         /* ********  Call LLF ECDSA Signature function  ************ */
+        PKI_PROF_PUSH(ECDSA_SIGN);
+        CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_CALC_SIGNATURE);
         err =  EcWrstDsaSign(
                                      f_rng, p_rng, pPrivKey,
                                      pMessRepres,
                                      isEphemerKeyInternal, pEphemerKeyData,
                                      pSignC, pSignD, pTempBuff);
+        CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_CALC_SIGNATURE);
+        PKI_PROF_POP();
 
         if (err != CC_OK) {
                 err = CC_ECDSA_SIGN_SIGNING_ERROR;
@@ -21,6 +21,8 @@
 #include "cc_general_defs.h"
 #include "md.h"
 #endif
+#include "pki_prof.h"
+#include "cc_pal_perf.h"
 
 /************************ Defines *****************************************/
 #if ( CC_HASH_USER_CTX_SIZE_IN_WORDS > CC_PKA_RSA_HASH_CTX_SIZE_IN_WORDS )
@@ -299,40 +301,25 @@ CEXPORT_C CCError_t EcdsaVerifyUpdate(
 
 
 /**************************************************************************
- *	              EcdsaVerifyFinish function
+ *	              EcdsaVerifyFinishInSession function
  **************************************************************************/
 /**
-   @brief  Performs initialization of variables and structures,
-           calls the hash function for the last block of data (if necessary),
-           than calls EcWrstDsaVerify function for verifying signature
-           according to EC DSA algorithm.
-
-       NOTE: Using of HASH functions with HASH size greater, than EC modulus size,
-             is not recommended!
-             Algorithm according ANS X9.62 standard
-
-   @param[in] pVerifyUserContext - A pointer to the user buffer for verifying the database.
-   @param[in] pSignatureIn       - A pointer to a buffer for the signature to be compared
-   @param[in] SignatureSizeBytes    - The size of a user passed signature (must be 2*orderSizeInBytes).
+   @brief  Finishes the verification as EcdsaVerifyFinish, within the given PKA
+           session, or in its own session if pSession is NULL.
 
-   @return <b>CCError_t</b>: <br>
-              CC_OK <br>
-                          CC_ECDSA_VERIFY_INVALID_USER_CONTEXT_PTR_ERROR <br>
-                          CC_ECDSA_VERIFY_USER_CONTEXT_VALIDATION_TAG_ERROR <br>
-                          CC_ECDSA_VERIFY_INVALID_SIGNATURE_IN_PTR_ERROR <br>
-                          CC_ECDSA_VERIFY_ILLEGAL_HASH_OP_MODE_ERROR <br>
-                          CC_ECDSA_VERIFY_INVALID_SIGNATURE_SIZE_ERROR <br>
-                          CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR <br>
+   @return <b>CCError_t</b>: as EcdsaVerifyFinish
 **/
-CEXPORT_C CCError_t EcdsaVerifyFinish(
+static CCError_t EcdsaVerifyFinishInSession(
                                              CCEcdsaVerifyUserContext_t *pVerifyUserContext,  /*in*/
                                              uint8_t                        *pSignatureIn,        /*in*/
-                                             size_t                         SignatureSizeBytes  /*in*/)
+                                             size_t                         SignatureSizeBytes,  /*in*/
+                                             PkaSession_t                   *pSession            /*in/out*/)
 {
         /* FUNCTION DECLARATIONS */
         uint32_t regVal;
         /* The return error identifier */
         CCError_t err = CC_OK;
+        CCPalPerfData_t perfIdx = 0;
 
         /* pointer to the active context  */
         EcdsaVerifyContext_t *pWorkingContext;
@@ -342,7 +329,7 @@ CEXPORT_C CCError_t EcdsaVerifyFinish(
         /*  pointer to the current domain */
         CCEcpkiDomain_t   *pDomain;
 
-        uint32_t  *pMessRepres, *pSignatureC, *pSignatureD;
+        uint32_t  *pMessRepres, *pSignatureC, *pSignatureD, *pTempBuff;
         uint32_t   hashSizeWords;
         uint32_t   orderSizeInBytes, orderSizeInWords;
 
@@ -422,6 +409,8 @@ CEXPORT_C CCError_t EcdsaVerifyFinish(
         pSignatureC       = ((EcWrstDsaVerifyDb_t*)(pWorkingContext->ccEcdsaVerIntBuff))->tempBuff;
         pSignatureD       = pSignatureC + orderSizeInWords; /* Max lengths of C in whole words */
         pMessRepres = pSignatureD + orderSizeInWords;
+        /* the buffer of the double scalar multiplication follows the maximal sizes of C, D and the message */
+        pTempBuff = pSignatureC + 3*CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS;
 
         // Check shortened cleaning
         /* Clean memory  */
@@ -449,7 +438,17 @@ CEXPORT_C CCError_t EcdsaVerifyFinish(
         /*------------------------------*/
         /* Verifying operation  	*/
         /*------------------------------*/
-        err =  EcWrstDsaVerify(PublKey_ptr, pMessRepres, orderSizeInWords, pSignatureC, pSignatureD);
+        PKI_PROF_PUSH(ECDSA_VERIFY);
+        CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_ECDSA_VERIFY);
+        if (pSession == NULL) {
+                err =  EcWrstDsaVerify(PublKey_ptr, pMessRepres, orderSizeInWords, pSignatureC, pSignatureD,
+                                       pTempBuff);
+        } else {
+                err =  EcWrstDsaVerifyInSession(pSession, PublKey_ptr, pMessRepres, orderSizeInWords,
+                                                pSignatureC, pSignatureD, pTempBuff);
+        }
+        CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_ECDSA_VERIFY);
+        PKI_PROF_POP();
         if (err != CC_OK) {
                 err = CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR;
         }
@@ -465,9 +464,145 @@ CEXPORT_C CCError_t EcdsaVerifyFinish(
         return err;
 
 
+}/* End EcdsaVerifyFinishInSession */
+
+
+/**************************************************************************
+ *	              EcdsaVerifyFinish function
+ **************************************************************************/
+/**
+   @brief  Performs initialization of variables and structures,
+           calls the hash function for the last block of data (if necessary),
+           than calls EcWrstDsaVerify function for verifying signature
+           according to EC DSA algorithm.
+
+       NOTE: Using of HASH functions with HASH size greater, than EC modulus size,
+             is not recommended!
+             Algorithm according ANS X9.62 standard
+
+   @param[in] pVerifyUserContext - A pointer to the user buffer for verifying the database.
+   @param[in] pSignatureIn       - A pointer to a buffer for the signature to be compared
+   @param[in] SignatureSizeBytes    - The size of a user passed signature (must be 2*orderSizeInBytes).
+
+   @return <b>CCError_t</b>: <br>
+              CC_OK <br>
+                          CC_ECDSA_VERIFY_INVALID_USER_CONTEXT_PTR_ERROR <br>
+                          CC_ECDSA_VERIFY_USER_CONTEXT_VALIDATION_TAG_ERROR <br>
+                          CC_ECDSA_VERIFY_INVALID_SIGNATURE_IN_PTR_ERROR <br>
+                          CC_ECDSA_VERIFY_ILLEGAL_HASH_OP_MODE_ERROR <br>
+                          CC_ECDSA_VERIFY_INVALID_SIGNATURE_SIZE_ERROR <br>
+                          CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR <br>
+**/
+CEXPORT_C CCError_t EcdsaVerifyFinish(
+                                             CCEcdsaVerifyUserContext_t *pVerifyUserContext,  /*in*/
+                                             uint8_t                        *pSignatureIn,        /*in*/
+                                             size_t                         SignatureSizeBytes  /*in*/)
+{
+        return EcdsaVerifyFinishInSession(pVerifyUserContext, pSignatureIn, SignatureSizeBytes, NULL);
+
 }/* End EcdsaVerifyFinish */
 
 
+/**************************************************************************
+ *	              CC_EcdsaVerifyBatch function
+ **************************************************************************/
+/**
+   @brief  Verifies a batch of ECDSA signatures on one EC domain.
+
+           Every item is hashed and verified as by CC_EcdsaVerify, but all the items share
+           one PKA session, so the PKA is initialized and the domain constants are loaded
+           once for the whole batch. The result of each item is returned in the item.
+           Items with a public key on another domain than the first valid key are rejected
+           with CC_ECDSA_VERIFY_INVALID_DOMAIN_ID_ERROR.
+
+   @param[in]  pVerifyUserContext - A pointer to the user buffer for verifying database,
+                                    reused for every item.
+   @param[in]  hashMode           - The hash function to be used for all the items.
+   @param[in,out] pItems          - The array of the items.
+   @param[in]  itemsCount         - The count of the items.
+
+   @return <b>CCError_t</b>: <br>
+                        CC_OK if all the signatures are valid<br>
+                        CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR if at least one item failed<br>
+                        CC_ECDSA_VERIFY_INVALID_USER_CONTEXT_PTR_ERROR <br>
+                        CC_ECDSA_VERIFY_INVALID_BATCH_ERROR <br>
+                        or a PKA error of opening the session <br>
+**/
+CEXPORT_C CCError_t CC_EcdsaVerifyBatch(
+                                        CCEcdsaVerifyUserContext_t *pVerifyUserContext,  /*in/out*/
+                                        CCEcpkiHashOpMode_t        hashMode,            /*in*/
+                                        CCEcdsaVerifyBatchItem_t   *pItems,              /*in/out*/
+                                        size_t                     itemsCount          /*in*/)
+{
+        /* FUNCTION DECLERATIONS */
+        CCError_t err = CC_OK;
+        CCError_t itemErr;
+        CCEcdsaVerifyBatchItem_t *pItem;
+        const CCEcpkiDomain_t *pDomain;
+        const CCEcpkiDomain_t *pBatchDomain = NULL;
+        PkaSession_t session;
+        uint32_t pkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+        size_t i;
+
+        /* FUNCTION LOGIC */
+        CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+        if (pVerifyUserContext == NULL) {
+                return CC_ECDSA_VERIFY_INVALID_USER_CONTEXT_PTR_ERROR;
+        }
+        if ((pItems == NULL) || (itemsCount == 0)) {
+                return CC_ECDSA_VERIFY_INVALID_BATCH_ERROR;
+        }
+
+        session.isOpen = 0;
+        for (i = 0; i < itemsCount; i++) {
+                pItem = &pItems[i];
+
+                /* the key is checked here for its domain, the rest is checked by Init */
+                if ((pItem->pUserPublKey != NULL) &&
+                    (pItem->pUserPublKey->valid_tag == CC_ECPKI_PUBL_KEY_VALIDATION_TAG)) {
+                        pDomain = &((CCEcpkiPublKey_t *)&pItem->pUserPublKey->PublKeyDbBuff)->domain;
+                        if (pBatchDomain == NULL) {
+                                /* the session is opened for the domain of the first valid key */
+                                err = PkaSessionOpen(&session, CC_MAX(pDomain->ordSizeInBits, pDomain->modSizeInBits),
+                                                     &pkaReqRegs);
+                                if (err != CC_OK) {
+                                        return err;
+                                }
+                                pBatchDomain = pDomain;
+                        }
+                        if ((pDomain->DomainID != pBatchDomain->DomainID) ||
+                            (pDomain->modSizeInBits != pBatchDomain->modSizeInBits) ||
+                            (pDomain->ordSizeInBits != pBatchDomain->ordSizeInBits)) {
+                                pItem->result = CC_ECDSA_VERIFY_INVALID_DOMAIN_ID_ERROR;
+                                err = CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR;
+                                continue;
+                        }
+                }
+
+                itemErr = EcdsaVerifyInit(pVerifyUserContext, pItem->pUserPublKey, hashMode);
+                if (itemErr == CC_OK) {
+                        itemErr = EcdsaVerifyUpdate(pVerifyUserContext, pItem->pMessageDataIn,
+                                                    pItem->messageSizeInBytes);
+                }
+                if (itemErr == CC_OK) {
+                        itemErr = EcdsaVerifyFinishInSession(pVerifyUserContext, pItem->pSignatureIn,
+                                                             pItem->signatureSizeBytes, &session);
+                }
+                pItem->result = itemErr;
+                if (itemErr != CC_OK) {
+                        err = CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR;
+                }
+        }
+
+        PkaSessionClose(&session);
+
+        return err;
+
+}/* END OF CC_EcdsaVerifyBatch */
+
+
+
 /**************************************************************************
  *	              CC_EcdsaVerify integrated function
  **************************************************************************/
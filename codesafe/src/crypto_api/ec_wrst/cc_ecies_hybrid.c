@@ -0,0 +1,583 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/************* Include Files ****************/
+
+#include "cc_pal_mem.h"
+#include "cc_crypto_ctx.h"
+#include "cc_ecpki_types.h"
+#include "cc_ecpki_error.h"
+#include "cc_fips_defs.h"
+#include "cc_kdf.h"
+#include "cc_hash_defs.h"
+#include "cc_aes.h"
+#include "cc_aesgcm.h"
+#include "cc_aesgcm_error.h"
+#include "cc_hmac.h"
+#include "cc_ecpki_ecies.h"
+#include "cc_ecpki_ecies_hybrid.h"
+
+/************************ Defines *************************************/
+
+/* the hybrid ECIES context validity TAG */
+#define CC_ECIES_HYBRID_VALIDATION_TAG          0x45434859
+
+/* the maximal size of the keying data: the AES key followed by an HMAC key (or the AES-GCM IV) */
+#define ECIES_HYBRID_MAX_KEYING_DATA_SIZE       (CC_AES_KEY_MAX_SIZE_IN_BYTES + CC_HASH_SHA512_DIGEST_SIZE_IN_BYTES)
+
+/* the tag size of the AES-GCM mode */
+#define ECIES_HYBRID_GCM_TAG_SIZE               CC_AESGCM_TAG_SIZE_16_BYTES
+
+/************************ Private Functions ***************************/
+
+/* returns the HMAC hash mode and digest size of a KDF hash mode */
+static CCError_t EciesHybridHashParamsGet(CCKdfHashOpMode_t kdfHashMode,
+                                          CCHashOperationMode_t *pHashMode,
+                                          uint32_t *pDigestSize)
+{
+    switch (kdfHashMode) {
+    case CC_KDF_HASH_SHA1_mode:
+        *pHashMode = CC_HASH_SHA1_mode;
+        *pDigestSize = CC_HASH_SHA1_DIGEST_SIZE_IN_BYTES;
+        break;
+    case CC_KDF_HASH_SHA224_mode:
+        *pHashMode = CC_HASH_SHA224_mode;
+        *pDigestSize = CC_HASH_SHA224_DIGEST_SIZE_IN_BYTES;
+        break;
+    case CC_KDF_HASH_SHA256_mode:
+        *pHashMode = CC_HASH_SHA256_mode;
+        *pDigestSize = CC_HASH_SHA256_DIGEST_SIZE_IN_BYTES;
+        break;
+    case CC_KDF_HASH_SHA384_mode:
+        *pHashMode = CC_HASH_SHA384_mode;
+        *pDigestSize = CC_HASH_SHA384_DIGEST_SIZE_IN_BYTES;
+        break;
+    case CC_KDF_HASH_SHA512_mode:
+        *pHashMode = CC_HASH_SHA512_mode;
+        *pDigestSize = CC_HASH_SHA512_DIGEST_SIZE_IN_BYTES;
+        break;
+    default:
+        return CC_ECIES_INVALID_KDF_HASH_MODE_ERROR;
+    }
+
+    return CC_OK;
+}
+
+/* checks the DEM parameters and returns the size of the keying data to derive by the KEM */
+static CCError_t EciesHybridParamsCheck(CCEciesHybridContext_t *pContext,
+                                        CCEciesDemMode_t demMode,
+                                        size_t demKeySize,
+                                        CCKdfHashOpMode_t kdfHashMode,
+                                        size_t *pKeyingDataSize)
+{
+    CCError_t error;
+    CCHashOperationMode_t hashMode;
+    uint32_t digestSize;
+
+    if (pContext == NULL) {
+        return CC_ECIES_INVALID_CONTEXT_PTR_ERROR;
+    }
+
+    if (demMode >= CC_ECIES_DEM_NumOfModes) {
+        return CC_ECIES_INVALID_DEM_MODE_ERROR;
+    }
+
+    if ((demKeySize != CC_AES_128_BIT_KEY_SIZE) &&
+        (demKeySize != CC_AES_192_BIT_KEY_SIZE) &&
+        (demKeySize != CC_AES_256_BIT_KEY_SIZE)) {
+        return CC_ECIES_INVALID_DEM_KEY_SIZE_ERROR;
+    }
+
+    error = EciesHybridHashParamsGet(kdfHashMode, &hashMode, &digestSize);
+    if (error != CC_OK) {
+        return error;
+    }
+
+    if (demMode == CC_ECIES_DEM_AES_GCM) {
+        *pKeyingDataSize = demKeySize + CC_ECIES_DEM_GCM_IV_SIZE_IN_BYTES;
+    } else {
+        *pKeyingDataSize = demKeySize + digestSize;
+    }
+
+    return CC_OK;
+}
+
+/* keys the DEM with the keying data derived by the KEM */
+static CCError_t EciesHybridDemInit(CCEciesHybridContext_t *pContext,
+                                    CCAesEncryptMode_t encryptDecryptFlag,
+                                    CCEciesDemMode_t demMode,
+                                    CCKdfHashOpMode_t kdfHashMode,
+                                    uint8_t *pKeyingData,
+                                    size_t demKeySize,
+                                    size_t textSize)
+{
+    CCError_t error;
+    CCHashOperationMode_t hashMode;
+    uint32_t digestSize;
+    CCAesUserKeyData_t keyData;
+    CCAesIv_t iv;
+    CCAesGcmKey_t gcmKey;
+    CCAesGcmKeySize_t gcmKeySizeId;
+
+    CC_PalMemSetZero(pContext, sizeof(CCEciesHybridContext_t));
+    pContext->encryptDecryptFlag = encryptDecryptFlag;
+    pContext->demMode = demMode;
+    pContext->textSize = textSize;
+
+    if (demMode == CC_ECIES_DEM_AES_GCM) {
+        switch (demKeySize) {
+        case CC_AES_128_BIT_KEY_SIZE:
+            gcmKeySizeId = CC_AESGCM_Key128BitSize;
+            break;
+        case CC_AES_192_BIT_KEY_SIZE:
+            gcmKeySizeId = CC_AESGCM_Key192BitSize;
+            break;
+        default:
+            gcmKeySizeId = CC_AESGCM_Key256BitSize;
+            break;
+        }
+        CC_PalMemSetZero(gcmKey, sizeof(gcmKey));
+        CC_PalMemCopy(gcmKey, pKeyingData, demKeySize);
+
+        /* the IV follows the key in the keying data */
+        error = CC_AesGcmInit(&pContext->cipherCtx.gcm,
+                              encryptDecryptFlag,
+                              gcmKey,
+                              gcmKeySizeId,
+                              0,
+                              textSize,
+                              pKeyingData + demKeySize,
+                              CC_ECIES_DEM_GCM_IV_SIZE_IN_BYTES,
+                              ECIES_HYBRID_GCM_TAG_SIZE);
+        CC_PalMemSetZero(gcmKey, sizeof(gcmKey));
+        if (error != CC_OK) {
+            return error;
+        }
+        pContext->tagSize = ECIES_HYBRID_GCM_TAG_SIZE;
+    } else {
+        error = CC_AesInit(&pContext->cipherCtx.aes,
+                           encryptDecryptFlag,
+                           (demMode == CC_ECIES_DEM_AES_CTR_HMAC) ? CC_AES_MODE_CTR : CC_AES_MODE_CBC,
+                           (demMode == CC_ECIES_DEM_AES_CTR_HMAC) ? CC_AES_PADDING_NONE : CC_AES_PADDING_PKCS7);
+        if (error != CC_OK) {
+            return error;
+        }
+
+        keyData.pKey = pKeyingData;
+        keyData.keySize = demKeySize;
+        error = CC_AesSetKey(&pContext->cipherCtx.aes, CC_AES_USER_KEY, &keyData, sizeof(keyData));
+        if (error != CC_OK) {
+            return error;
+        }
+
+        /* the key is fresh for every message, so a zero IV (or initial counter) is never reused */
+        CC_PalMemSetZero(iv, sizeof(iv));
+        error = CC_AesSetIv(&pContext->cipherCtx.aes, iv);
+        if (error != CC_OK) {
+            return error;
+        }
+
+        /* the HMAC key follows the AES key in the keying data */
+        error = EciesHybridHashParamsGet(kdfHashMode, &hashMode, &digestSize);
+        if (error != CC_OK) {
+            return error;
+        }
+        error = CC_HmacInit(&pContext->hmacCtx, hashMode, pKeyingData + demKeySize, digestSize);
+        if (error != CC_OK) {
+            return error;
+        }
+        pContext->tagSize = digestSize;
+    }
+
+    pContext->validTag = CC_ECIES_HYBRID_VALIDATION_TAG;
+
+    return CC_OK;
+}
+
+/* encrypts or decrypts full AES blocks; the HMAC is computed over the ciphertext */
+static CCError_t EciesHybridBlocksProcess(CCEciesHybridContext_t *pContext,
+                                          uint8_t *pDataIn,
+                                          size_t dataInSize,
+                                          uint8_t *pDataOut)
+{
+    CCError_t error;
+
+    if (pContext->demMode == CC_ECIES_DEM_AES_GCM) {
+        return CC_AesGcmBlockTextData(&pContext->cipherCtx.gcm, pDataIn, dataInSize, pDataOut);
+    }
+
+    if (pContext->encryptDecryptFlag == CC_AES_DECRYPT) {
+        error = CC_HmacUpdate(&pContext->hmacCtx, pDataIn, dataInSize);
+        if (error != CC_OK) {
+            return error;
+        }
+    }
+
+    error = CC_AesBlock(&pContext->cipherCtx.aes, pDataIn, dataInSize, pDataOut);
+    if (error != CC_OK) {
+        return error;
+    }
+
+    if (pContext->encryptDecryptFlag == CC_AES_ENCRYPT) {
+        error = CC_HmacUpdate(&pContext->hmacCtx, pDataOut, dataInSize);
+    }
+
+    return error;
+}
+
+/* compares the tags in a time that does not depend on their contents */
+static uint32_t EciesHybridTagCompare(const uint8_t *pTag1, const uint8_t *pTag2, size_t tagSize)
+{
+    uint8_t diff = 0;
+    size_t i;
+
+    for (i = 0; i < tagSize; i++) {
+        diff |= pTag1[i] ^ pTag2[i];
+    }
+
+    return diff;
+}
+
+/************************ Public Functions ****************************/
+
+CEXPORT_C CCError_t CC_EciesHybridEncryptInit(
+                    CCEciesHybridContext_t      *pContext,
+                    CCEcpkiUserPublKey_t        *pRecipUzPublKey,
+                    CCKdfDerivFuncMode_t        kdfDerivMode,
+                    CCKdfHashOpMode_t           kdfHashMode,
+                    uint32_t                    isSingleHashMode,
+                    CCEciesDemMode_t            demMode,
+                    size_t                      demKeySize,
+                    size_t                      textSize,
+                    uint8_t                     *pCipherData,
+                    size_t                      *pCipherDataSize,
+                    CCEciesTempData_t           *pTempBuff,
+                    CCRndGenerateVectWorkFunc_t f_rng,
+                    void                        *p_rng,
+                    CCEcpkiKgCertContext_t      *pFipsCtx)
+{
+    CCError_t error;
+    uint8_t keyingData[ECIES_HYBRID_MAX_KEYING_DATA_SIZE];
+    size_t keyingDataSize = 0;
+
+    CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+    error = EciesHybridParamsCheck(pContext, demMode, demKeySize, kdfHashMode, &keyingDataSize);
+    if (error != CC_OK) {
+        return error;
+    }
+    CC_PalMemSetZero(pContext, sizeof(CCEciesHybridContext_t));
+
+    /* the KEM derives the DEM keys directly */
+    error = EciesKemEncrypt(pRecipUzPublKey,
+                            kdfDerivMode,
+                            kdfHashMode,
+                            isSingleHashMode,
+                            NULL,
+                            NULL,
+                            keyingData,
+                            keyingDataSize,
+                            pCipherData,
+                            pCipherDataSize,
+                            pTempBuff,
+                            f_rng,
+                            p_rng,
+                            pFipsCtx);
+    if (error != CC_OK) {
+        goto End;
+    }
+
+    error = EciesHybridDemInit(pContext, CC_AES_ENCRYPT, demMode, kdfHashMode,
+                               keyingData, demKeySize, textSize);
+
+End:
+    if (error != CC_OK) {
+        CC_PalMemSetZero(pContext, sizeof(CCEciesHybridContext_t));
+    }
+    CC_PalMemSetZero(keyingData, sizeof(keyingData));
+    return error;
+}
+
+CEXPORT_C CCError_t CC_EciesHybridDecryptInit(
+                    CCEciesHybridContext_t      *pContext,
+                    CCEcpkiUserPrivKey_t        *pRecipUzPrivKey,
+                    CCKdfDerivFuncMode_t        kdfDerivMode,
+                    CCKdfHashOpMode_t           kdfHashMode,
+                    uint32_t                    isSingleHashMode,
+                    CCEciesDemMode_t            demMode,
+                    size_t                      demKeySize,
+                    size_t                      textSize,
+                    uint8_t                     *pCipherData,
+                    size_t                      cipherDataSize,
+                    CCEciesTempData_t           *pTempBuff)
+{
+    CCError_t error;
+    uint8_t keyingData[ECIES_HYBRID_MAX_KEYING_DATA_SIZE];
+    size_t keyingDataSize = 0;
+
+    CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+    error = EciesHybridParamsCheck(pContext, demMode, demKeySize, kdfHashMode, &keyingDataSize);
+    if (error != CC_OK) {
+        return error;
+    }
+    CC_PalMemSetZero(pContext, sizeof(CCEciesHybridContext_t));
+
+    error = CC_EciesKemDecrypt(pRecipUzPrivKey,
+                               kdfDerivMode,
+                               kdfHashMode,
+                               isSingleHashMode,
+                               pCipherData,
+                               cipherDataSize,
+                               keyingData,
+                               keyingDataSize,
+                               pTempBuff);
+    if (error != CC_OK) {
+        goto End;
+    }
+
+    error = EciesHybridDemInit(pContext, CC_AES_DECRYPT, demMode, kdfHashMode,
+                               keyingData, demKeySize, textSize);
+
+End:
+    if (error != CC_OK) {
+        CC_PalMemSetZero(pContext, sizeof(CCEciesHybridContext_t));
+    }
+    CC_PalMemSetZero(keyingData, sizeof(keyingData));
+    return error;
+}
+
+CEXPORT_C CCError_t CC_EciesHybridUpdate(
+                    CCEciesHybridContext_t      *pContext,
+                    uint8_t                     *pDataIn,
+                    size_t                      dataInSize,
+                    uint8_t                     *pDataOut,
+                    size_t                      *pDataOutSize)
+{
+    CCError_t error = CC_OK;
+    size_t totalSize;
+    size_t holdBackSize;
+    size_t blocksSize;
+    size_t consumedSize = 0;
+    size_t outSize = 0;
+
+    CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+    if (pContext == NULL) {
+        return CC_ECIES_INVALID_CONTEXT_PTR_ERROR;
+    }
+    if (pContext->validTag != CC_ECIES_HYBRID_VALIDATION_TAG) {
+        return CC_ECIES_INVALID_CONTEXT_ERROR;
+    }
+    if ((pDataIn == NULL && dataInSize != 0) || pDataOutSize == NULL) {
+        return CC_ECIES_INVALID_DATA_PTR_ERROR;
+    }
+
+    /* on AES-CBC decryption the last block holds the padding, and is processed on finish */
+    holdBackSize = ((pContext->demMode == CC_ECIES_DEM_AES_CBC_HMAC) &&
+                    (pContext->encryptDecryptFlag == CC_AES_DECRYPT)) ? 1 : 0;
+
+    totalSize = pContext->remainingSize + dataInSize;
+    if (totalSize < CC_AES_BLOCK_SIZE_IN_BYTES + holdBackSize) {
+        CC_PalMemCopy(&pContext->remainingBuff[pContext->remainingSize], pDataIn, dataInSize);
+        pContext->remainingSize = totalSize;
+        pContext->processedSize += dataInSize;
+        *pDataOutSize = 0;
+        return CC_OK;
+    }
+
+    blocksSize = ((totalSize - holdBackSize) / CC_AES_BLOCK_SIZE_IN_BYTES) * CC_AES_BLOCK_SIZE_IN_BYTES;
+    if (pDataOut == NULL) {
+        return CC_ECIES_INVALID_DATA_PTR_ERROR;
+    }
+    if (*pDataOutSize < blocksSize) {
+        return CC_ECIES_INVALID_DATA_SIZE_ERROR;
+    }
+
+    /* complete the remaining input to a block */
+    if (pContext->remainingSize != 0) {
+        consumedSize = CC_AES_BLOCK_SIZE_IN_BYTES - pContext->remainingSize;
+        CC_PalMemCopy(&pContext->remainingBuff[pContext->remainingSize], pDataIn, consumedSize);
+        error = EciesHybridBlocksProcess(pContext, pContext->remainingBuff, CC_AES_BLOCK_SIZE_IN_BYTES, pDataOut);
+        if (error != CC_OK) {
+            goto End;
+        }
+        outSize = CC_AES_BLOCK_SIZE_IN_BYTES;
+        pContext->remainingSize = 0;
+    }
+
+    /* the full blocks of the input are processed in place of the caller buffers */
+    if (blocksSize > outSize) {
+        error = EciesHybridBlocksProcess(pContext, pDataIn + consumedSize, blocksSize - outSize, pDataOut + outSize);
+        if (error != CC_OK) {
+            goto End;
+        }
+        consumedSize += blocksSize - outSize;
+        outSize = blocksSize;
+    }
+
+    pContext->remainingSize = dataInSize - consumedSize;
+    CC_PalMemCopy(pContext->remainingBuff, pDataIn + consumedSize, pContext->remainingSize);
+    pContext->processedSize += dataInSize;
+    *pDataOutSize = outSize;
+
+End:
+    if (error != CC_OK) {
+        CC_PalMemSetZero(pContext, sizeof(CCEciesHybridContext_t));
+        *pDataOutSize = 0;
+    }
+    return error;
+}
+
+CEXPORT_C CCError_t CC_EciesHybridFinish(
+                    CCEciesHybridContext_t      *pContext,
+                    uint8_t                     *pDataOut,
+                    size_t                      *pDataOutSize,
+                    uint8_t                     *pTag,
+                    size_t                      *pTagSize)
+{
+    CCError_t error = CC_OK;
+    uint8_t lastIn[2 * CC_AES_BLOCK_SIZE_IN_BYTES];
+    uint8_t lastOut[2 * CC_AES_BLOCK_SIZE_IN_BYTES];
+    size_t lastOutSize = 0;
+    CCHashResultBuf_t hmacResult;
+    CCAesGcmTagRes_t gcmTag;
+    uint8_t gcmTagSize = 0;
+
+    CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+    if (pContext == NULL) {
+        return CC_ECIES_INVALID_CONTEXT_PTR_ERROR;
+    }
+    if (pContext->validTag != CC_ECIES_HYBRID_VALIDATION_TAG) {
+        return CC_ECIES_INVALID_CONTEXT_ERROR;
+    }
+    if (pDataOut == NULL || pDataOutSize == NULL) {
+        return CC_ECIES_INVALID_DATA_PTR_ERROR;
+    }
+    if (*pDataOutSize < CC_AES_BLOCK_SIZE_IN_BYTES) {
+        return CC_ECIES_INVALID_DATA_SIZE_ERROR;
+    }
+    if (pTag == NULL || pTagSize == NULL) {
+        return CC_ECIES_INVALID_TAG_PTR_ERROR;
+    }
+    if ((*pTagSize < pContext->tagSize) ||
+        ((pContext->encryptDecryptFlag == CC_AES_DECRYPT) && (*pTagSize != pContext->tagSize))) {
+        return CC_ECIES_INVALID_TAG_SIZE_ERROR;
+    }
+
+    CC_PalMemSetZero(lastIn, sizeof(lastIn));
+    CC_PalMemCopy(lastIn, pContext->remainingBuff, pContext->remainingSize);
+
+    switch (pContext->demMode) {
+    case CC_ECIES_DEM_AES_GCM:
+        /* the AES-GCM size is declared on init */
+        if (pContext->processedSize != pContext->textSize) {
+            error = CC_ECIES_INVALID_DATA_SIZE_ERROR;
+            goto End;
+        }
+        if (pContext->encryptDecryptFlag == CC_AES_DECRYPT) {
+            CC_PalMemCopy(gcmTag, pTag, pContext->tagSize);
+        }
+        error = CC_AesGcmFinish(&pContext->cipherCtx.gcm, lastIn, pContext->remainingSize,
+                                lastOut, &gcmTagSize, gcmTag);
+        if (error == CC_AESGCM_GCM_TAG_INVALID_ERROR) {
+            error = CC_ECIES_TAG_VERIFY_FAILED_ERROR;
+        }
+        if (error != CC_OK) {
+            goto End;
+        }
+        lastOutSize = pContext->remainingSize;
+        if (pContext->encryptDecryptFlag == CC_AES_ENCRYPT) {
+            CC_PalMemCopy(pTag, gcmTag, pContext->tagSize);
+        }
+        break;
+
+    case CC_ECIES_DEM_AES_CTR_HMAC:
+    case CC_ECIES_DEM_AES_CBC_HMAC:
+        if (pContext->encryptDecryptFlag == CC_AES_DECRYPT) {
+            /* the AES-CBC ciphertext is a multiple of the block size */
+            if ((pContext->demMode == CC_ECIES_DEM_AES_CBC_HMAC) &&
+                (pContext->remainingSize != CC_AES_BLOCK_SIZE_IN_BYTES)) {
+                error = CC_ECIES_INVALID_DATA_SIZE_ERROR;
+                goto End;
+            }
+            /* the tag is verified before the padding is checked, so the padding is not an oracle */
+            error = CC_HmacUpdate(&pContext->hmacCtx, lastIn, pContext->remainingSize);
+            if (error != CC_OK) {
+                goto End;
+            }
+            error = CC_HmacFinish(&pContext->hmacCtx, hmacResult);
+            if (error != CC_OK) {
+                goto End;
+            }
+            if (EciesHybridTagCompare(pTag, (uint8_t *)hmacResult, pContext->tagSize) != 0) {
+                error = CC_ECIES_TAG_VERIFY_FAILED_ERROR;
+                goto End;
+            }
+        }
+
+        /* the PKCS7 padding of the AES-CBC encryption may extend the data by a block */
+        lastOutSize = sizeof(lastOut);
+        error = CC_AesFinish(&pContext->cipherCtx.aes,
+                             pContext->remainingSize,
+                             lastIn,
+                             (pContext->demMode == CC_ECIES_DEM_AES_CBC_HMAC) ? sizeof(lastIn) : pContext->remainingSize,
+                             lastOut,
+                             &lastOutSize);
+        if (error != CC_OK) {
+            goto End;
+        }
+
+        if (pContext->encryptDecryptFlag == CC_AES_ENCRYPT) {
+            error = CC_HmacUpdate(&pContext->hmacCtx, lastOut, lastOutSize);
+            if (error != CC_OK) {
+                goto End;
+            }
+            error = CC_HmacFinish(&pContext->hmacCtx, hmacResult);
+            if (error != CC_OK) {
+                goto End;
+            }
+            CC_PalMemCopy(pTag, (uint8_t *)hmacResult, pContext->tagSize);
+        }
+        break;
+
+    default:
+        error = CC_ECIES_INVALID_CONTEXT_ERROR;
+        goto End;
+    }
+
+    if (lastOutSize > *pDataOutSize) {
+        error = CC_ECIES_INVALID_DATA_SIZE_ERROR;
+        goto End;
+    }
+    CC_PalMemCopy(pDataOut, lastOut, lastOutSize);
+    *pDataOutSize = lastOutSize;
+    *pTagSize = pContext->tagSize;
+
+End:
+    if (error != CC_OK) {
+        *pDataOutSize = 0;
+    }
+    CC_PalMemSetZero(lastIn, sizeof(lastIn));
+    CC_PalMemSetZero(lastOut, sizeof(lastOut));
+    CC_PalMemSetZero(hmacResult, sizeof(hmacResult));
+    CC_PalMemSetZero(gcmTag, sizeof(gcmTag));
+    CC_PalMemSetZero(pContext, sizeof(CCEciesHybridContext_t));
+    return error;
+}
+
+CEXPORT_C CCError_t CC_EciesHybridFree(CCEciesHybridContext_t *pContext)
+{
+    if (pContext == NULL) {
+        return CC_ECIES_INVALID_CONTEXT_PTR_ERROR;
+    }
+
+    CC_PalMemSetZero(pContext, sizeof(CCEciesHybridContext_t));
+
+    return CC_OK;
+}
@@ -0,0 +1,613 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/* This file is generated by utils/src/ecc_comb_tables/cc_ecc_comb_tables_gen.py - do not edit. */
+
+#include "cc_pal_types.h"
+#include "cc_pal_mem.h"
+#include "cc_ecpki_types.h"
+#include "cc_ecpki_domain_comb.h"
+
+/* secp192k1: 5 teeth spaced 39 bits apart */
+static const uint32_t ecpki_comb_points_secp192k1[CC_ECPKI_COMB_POINTS_COUNT*2*6] = {
+	/* T[0] */
+	0x26A9BBA0,0x81BD9441,0xA9A7CA18,0x7C8C076A,0xBDF1159A,0xA3CE9464,
+	0x98B676CD,0x52FD62D0,0x1FA66714,0xC3E5BFBE,0xC2CA42D9,0x52D35AA8,
+	/* T[1] */
+	0x38D03501,0x20605DEC,0xBAE99253,0x475BB3BD,0x08957B73,0x646FFF16,
+	0x633CD97C,0x29E60C75,0x99C7F5A6,0xF7D0A8F6,0x15B5DD23,0x0399794E,
+	/* T[2] */
+	0xCDD925FA,0xA789D5B2,0x8FDE0BC8,0x5410EFF1,0xD3479240,0x4C3DBFD8,
+	0xE7D322B5,0xDE739AF7,0x465C5C8B,0x277D6147,0x95D44CF2,0xE093ACAA,
+	/* T[3] */
+	0x9A5C0756,0x6CF03943,0x1D26369C,0x551F33D5,0x656D1DE6,0x73FFE5D6,
+	0xE40EACD6,0x662EB810,0xFD6CEB40,0x532D3A5D,0x33AD7F0F,0x5F280FFA,
+	/* T[4] */
+	0x7EE83BCC,0x8F3D8AC1,0xD639E1CE,0x71AFFCEF,0x0A7EB15D,0x9FBEDAF8,
+	0x4B01B5E3,0xB66FDC9C,0x633606ED,0x425ECEDD,0x4CB43C79,0x119E1AA7,
+	/* T[5] */
+	0x4EDE3463,0xF12EC867,0xA2F16A81,0xFE8EBA94,0x2E38E375,0x3239A681,
+	0x394DC0E2,0x1C1F3C38,0xF91E8F4B,0x1B424626,0x0D201600,0xDD7509F2,
+	/* T[6] */
+	0x71F45C06,0x90BB738F,0x317DB760,0xF866B30B,0x2C48B1D0,0x2FEAD1A7,
+	0x7F9F1AF7,0x456181E1,0xE927A842,0x19B7F525,0x8981D09D,0xF4202996,
+	/* T[7] */
+	0x10A4D76F,0x2B2430CD,0x11812436,0x7A5EC13E,0xD4B2B506,0x1ECC31CD,
+	0xA5D73015,0xD9504345,0xB493BE5B,0x7B6D8F35,0xE512C70D,0xB9A41BAD,
+	/* T[8] */
+	0x3EC3F6F3,0xDD945644,0xCA9B937C,0xBBCDEAD2,0xFD478D71,0x8F15FCA2,
+	0x67831DFC,0xC7091CFB,0x633C6E67,0x1D5346F2,0xB4717222,0xA908D092,
+	/* T[9] */
+	0x68FAF49D,0xCF397413,0xB1133E24,0x4AE4F30B,0x4198CE4C,0x139F4E9F,
+	0x8E2D208A,0xB39DAA04,0x51E53BDF,0x5C004B3A,0xD3390563,0xBE19C2DC,
+	/* T[10] */
+	0x388D6DEF,0x554CF9CD,0x74D83D85,0x893753A1,0x9F1EF78C,0x2EE3E8FB,
+	0x9E09154E,0xD0A71DE3,0x1BDDDB38,0x569BC6BE,0xE0750A7B,0x2BABEABF,
+	/* T[11] */
+	0xC0F39F63,0x09EE03EA,0xEF0A1CBE,0x98D89F19,0xE5B9E7F8,0xA6AEA3E0,
+	0x03CE3EE0,0x3551724A,0x4DF656F4,0x2BC7A3ED,0xF4A62F6B,0xA4A1116B,
+	/* T[12] */
+	0x7ED0DB32,0x78E8BFB0,0x60752804,0x98B354F2,0xA0E233F8,0xB3684B00,
+	0xAEE25B88,0x92461585,0xD43E8DE8,0x954A7CF9,0x428EC841,0xB0F3695B,
+	/* T[13] */
+	0xB59D87A3,0x25246356,0x3CFC13C3,0x80E61F4D,0x12B2FFBB,0xD5E35543,
+	0xA75EB9E2,0x6B6B7E05,0x28508FFF,0x6A1CEFFC,0x239642BA,0xD16B5997,
+	/* T[14] */
+	0x29242FC4,0x4D837104,0x866557D1,0x25C31330,0x357905B8,0xBDEEC2E2,
+	0xB0094D26,0x1D04F64D,0x3F9EC06D,0xD1250BD5,0xF3CA2557,0x71B254CD,
+	/* T[15] */
+	0xDDD1AE57,0xF0D31431,0x130614E8,0xF5811C12,0x910CF9A6,0x635967F7,
+	0xF4E291AB,0x8788EB9D,0x9C3082DB,0xB74D18AE,0x17CF793C,0xC8E81EA5,
+};
+static const uint32_t ecpki_comb_base_secp192k1[2*6] = {
+	0xEAE06C7D,0x1DA5D1B1,0x80B7F434,0x26B07D02,0xC057E9AE,0xDB4FF10E,
+	0xD95E2F9D,0x4082AA88,0x15BE8634,0x844163D0,0x9C5628A7,0x9B2F2F6D
+};
+
+/* secp192r1: 5 teeth spaced 39 bits apart */
+static const uint32_t ecpki_comb_points_secp192r1[CC_ECPKI_COMB_POINTS_COUNT*2*6] = {
+	/* T[0] */
+	0x9809EE95,0x580EB707,0x1C98050F,0x278B30AE,0xFA61E887,0xF6D439BF,
+	0x7A84A7AD,0xDD4082B0,0xF220CB68,0x2F17819D,0xD4649B1D,0x4E5A9C66,
+	/* T[1] */
+	0xD03D4841,0xEFD25B3D,0x2E442E0B,0x7CDB2299,0x4708E639,0x0B2BA129,
+	0x97F16A6F,0x9B81CFF2,0x47572877,0xC16D7E4F,0xBC9F0181,0x9F2AC085,
+	/* T[2] */
+	0xDFBFA995,0x415D82C9,0xF31CB1A5,0x91B514C3,0x0F22B5DF,0x9A9F63E6,
+	0xA4941FDB,0x92422589,0xC558B388,0x45DAC601,0xB77D92EC,0x8CDA47DB,
+	/* T[3] */
+	0x0CB1D04E,0x9CAFB570,0x47E46F32,0xA3559487,0x20C15F2F,0xC27C1F03,
+	0x065762D0,0xE8E5CE36,0x04E504D9,0xBFEE343C,0xFDB8EBA5,0x631A4877,
+	/* T[4] */
+	0xBF39130B,0x3C810E9C,0x041C93CC,0xE7C0E521,0xD414F2EB,0xD80E6F8F,
+	0x814B5F29,0x2EC8E188,0x11A3A185,0x22E569E4,0xB45CEE5B,0x2A07B9C3,
+	/* T[5] */
+	0x1708C7DB,0x94DC90A9,0x31FB6D0D,0x8FC92710,0xF16171B9,0xAF7D1CBA,
+	0xE0D1B7D1,0x9C187D84,0xC5838941,0x01724DEF,0xD13CA75A,0xF6175CC8,
+	/* T[6] */
+	0x8F99255C,0x469B4372,0xE480216B,0x6A847A7D,0x45896523,0x365BEA4B,
+	0x9CA4B016,0xCD779426,0x6B2F8EE0,0x5FAE6D1E,0x66116E0F,0xF10831B4,
+	/* T[7] */
+	0xEF4B07B2,0x81A67725,0x15334605,0xC40DEB90,0x9AFAED46,0x9B6D1B3C,
+	0xB163D740,0xD18D55BF,0xDAC91D27,0x6990E06A,0x907E0304,0x243DF71B,
+	/* T[8] */
+	0x4C81A10F,0x0F9996BC,0x8D23DDC5,0x2BB285F8,0xC775C1F2,0xCB06E192,
+	0xA04DF45D,0x289FF7ED,0xA601F87A,0xB41F8860,0x2D1D18A7,0x0F4193C2,
+	/* T[9] */
+	0x9E7C571F,0x52A58F6B,0xC97DC6E1,0x204DD2B5,0xB01E2E37,0xFA1AA3DC,
+	0x8BB30E4D,0x7F3654AD,0x7E1E6FD1,0x76DD5589,0x4885455C,0x08641C79,
+	/* T[10] */
+	0x9D89AB31,0x782D345A,0x139D88DC,0xE6D017E6,0x12E08096,0x1BF7A4B7,
+	0x00659F6B,0xBF3FD32B,0x7A913E78,0x79F41D4F,0xF67F0B12,0x3DE92CD5,
+	/* T[11] */
+	0x9C4CBC93,0x73F43D41,0xDB1A68C6,0x428D7227,0x757B8BDC,0x9D6C1FEB,
+	0x2B551BAC,0xAA4CB160,0x1E24915C,0x22050F51,0x8CA002C8,0x52BDD227,
+	/* T[12] */
+	0x33C52289,0xDC04D456,0xA9E448E5,0xABEEA655,0xAC30C541,0xE124B207,
+	0x084E2327,0xBCDCCE22,0x8D066DF8,0x415337EE,0x0926392C,0x7553435B,
+	/* T[13] */
+	0x3E0F0933,0x9CC7AF4E,0x27534220,0xBE7E4C19,0x2FCCE4AD,0x75403D94,
+	0x1F4314E6,0xA8A6A3A6,0x8D6BEB4E,0x41DC48EA,0xCE968BA8,0xA0E9AF67,
+	/* T[14] */
+	0x84BCFF20,0x6BECD060,0xB66BA7BE,0x663AE85F,0x3502AF2F,0x1E89BACA,
+	0x74DA63C9,0xAE2B4384,0x9E82247B,0xEB7C4C7B,0x08EAAAF7,0xAC4A7618,
+	/* T[15] */
+	0x60EF7FE5,0xD4D78050,0xFEC9AC31,0x9F1A0AEC,0x91BE2F6B,0x4838B7D7,
+	0x9885AEB1,0x9F7F05FE,0x11FDBE91,0x13143D31,0x30E87559,0x1C9BCB01,
+};
+static const uint32_t ecpki_comb_base_secp192r1[2*6] = {
+	0x82FF1012,0xF4FF0AFD,0x43A18800,0x7CBF20EB,0xB03090F6,0x188DA80E,
+	0x1E794811,0x73F977A1,0x6B24CDD5,0x631011ED,0xFFC8DA78,0x07192B95
+};
+
+/* secp224k1: 5 teeth spaced 45 bits apart */
+static const uint32_t ecpki_comb_points_secp224k1[CC_ECPKI_COMB_POINTS_COUNT*2*7] = {
+	/* T[0] */
+	0xC3716BC5,0x30123F6B,0xE8D19F6E,0x2517C0DE,0xB6F20BBA,0x3C987D82,0x7803D4FB,
+	0xF99D25AD,0x7B79F778,0xF23C0EB6,0xE89DEDB2,0xE45AEE01,0x5B9119B9,0x74E103A9,
+	/* T[1] */
+	0x6A88BFD9,0x51561AE9,0xDF9A8D5F,0xE083F2F3,0x40CBAC8C,0x6F9E8F38,0xF5EF0E0A,
+	0x2B132AAF,0x83175534,0x92449662,0x6DA3E6E3,0xE4AA9303,0x3DAA36F0,0x8752CB2C,
+	/* T[2] */
+	0xAE2CEDFF,0x5AD06671,0xB2F26D0B,0x4911EF5E,0x6453107E,0x18B32580,0x08C60FAB,
+	0xA799EDAE,0x263F3548,0x7EB51493,0x58E1536C,0x0DFDFE35,0xF248A2E9,0x826932BD,
+	/* T[3] */
+	0x3F7684E3,0x4AE3BA9F,0x1EF9415C,0xB3C74254,0x201293F3,0x77A0DB87,0x794F0073,
+	0x429DAABE,0xE58EF351,0x4A6652ED,0x491E0DC8,0xFA4DE83E,0xE2DA1B66,0x2ECF35BB,
+	/* T[4] */
+	0x46BD3A89,0x74D389D6,0x1DDC6C23,0xBE1BE632,0xF0C29AF1,0xE10BBCBD,0xC4C31753,
+	0x546F3FC0,0x56EBEF7A,0x06DD8C6F,0xB1A01DCD,0x109F7911,0x83702921,0x63F4B159,
+	/* T[5] */
+	0xBE1EB58C,0x11373452,0xE3DCFEF0,0xAA9BD630,0x06E2EC04,0xA92713A7,0x20940DB7,
+	0xC8C90FD3,0xE62EAAFE,0xE471BD5C,0x676C95AD,0x73C77065,0xD41D6EA5,0x4166D879,
+	/* T[6] */
+	0x14A60F57,0x157FD135,0xEA248FB8,0xAD3DF783,0xE1F907E5,0x589740F1,0x9E5D8FFE,
+	0x3FFB1E4D,0xF5AF9E56,0xABDF141C,0xF38A4B41,0xF7BF056D,0x3F0D29E9,0x87E72E4A,
+	/* T[7] */
+	0x1DF85693,0x0A986099,0x07894B08,0x3B8CDA3D,0xF4BC381F,0x56610F46,0xECF56E94,
+	0x26AD719A,0x28D0688D,0xCD8318FB,0x6221DA47,0xEBAC2743,0x0F1444DE,0x7BFF8D39,
+	/* T[8] */
+	0x01798387,0x3BE267E5,0x2FC2D412,0x79E20E36,0x08EEBC7B,0x30B80D52,0x3EB8D46B,
+	0x56EC018D,0xA07DD4A1,0x878A6660,0x0456F2D0,0x753DDDA9,0x1512EDD2,0xC652F645,
+	/* T[9] */
+	0x5F14C83A,0xAAE531A4,0x1F33AC54,0x0E06A9EA,0xCB66DF75,0x933ABD13,0xE70E6025,
+	0x0B8E27CE,0x21EBBA77,0x215E2A6E,0x57ACA80E,0x5EA800FC,0x30A46BF2,0x8AFDA0CA,
+	/* T[10] */
+	0x77846213,0x4D744826,0x2B64BD2E,0x0886BDD3,0xA8436032,0x1A81FDB1,0x8D878DF3,
+	0xE743AE69,0x07A01C59,0xCAB86218,0xE763DA20,0x4FCBBB4D,0xA40DD032,0x5C05600B,
+	/* T[11] */
+	0x3E970E61,0x32642166,0x756E09DB,0xEF9E976D,0x04432232,0x46178732,0xF44A902A,
+	0x9A19F84B,0x8F17EBC3,0xC5F084DB,0x3B295EBC,0x0ACBFC5A,0x82178F8C,0x545FB0C2,
+	/* T[12] */
+	0x073EC760,0xF82D6C34,0x4FAEE98E,0xE7434735,0x965585E7,0xDE9ECD84,0x2DC74A9D,
+	0x2EC1037B,0x46FF96B4,0xEC61CF03,0xD92AD321,0xB5FE9808,0x59465AC7,0xDDC12590,
+	/* T[13] */
+	0x2E698D76,0xF6AA5134,0x7D0D2907,0x22DA4C59,0xBBA8A1E4,0xB009DFC4,0x77274F6D,
+	0x0B10AE5E,0xCEC07BC3,0x8A5C8F99,0xCBD8F4CE,0x017E3134,0x9110B313,0x93388163,
+	/* T[14] */
+	0x89981D52,0xB2608164,0x77ACEE46,0x5ED64E0D,0x8A90D0E2,0x08D52F86,0x54079894,
+	0x131A0907,0x07E0E2FC,0x6F537761,0x948EE668,0x80974CA3,0x4A1FFDE6,0x1A8C6AC9,
+	/* T[15] */
+	0xD3BFE21A,0x039C95EC,0xD5FC7BC2,0x0F5E25D3,0xA2095539,0xFFC96A58,0xD93BCC80,
+	0x5E65088F,0xC848ABCB,0xC08B79EE,0x3869C011,0x4C8CE8E6,0xAEE428C5,0x5C341FA5,
+};
+static const uint32_t ecpki_comb_base_secp224k1[2*7] = {
+	0xB6B7A45C,0x0F7E650E,0xE47075A9,0x69A467E9,0x30FC28A1,0x4DF099DF,0xA1455B33,
+	0x556D61A5,0xE2CA4BDB,0xC0B0BD59,0xF7E319F7,0x82CAFBD6,0x7FBA3442,0x7E089FED
+};
+
+/* secp224r1: 5 teeth spaced 45 bits apart */
+static const uint32_t ecpki_comb_points_secp224r1[CC_ECPKI_COMB_POINTS_COUNT*2*7] = {
+	/* T[0] */
+	0x1E3F5557,0x6A1F458D,0x4A8CA5B5,0x1BD56A47,0x7D07E167,0xE26CC265,0x7BED5948,
+	0xB8BA35E3,0xA5B7D73F,0xC72FE70A,0x071CCC54,0x814EDC6D,0x9BA6F54B,0x9A92368C,
+	/* T[1] */
+	0xB38824D6,0x300D33C9,0x5CE1B84B,0xF1AC13D8,0x6D2B77B4,0x77DC72F0,0x1E933FD2,
+	0x6D2849A4,0xD9325587,0x07D4B2BA,0x28C3168C,0xB6D9489F,0x00D0FF1C,0x91B68C1A,
+	/* T[2] */
+	0x413A5799,0xA3E4DF43,0xC6A3DBB8,0x1A226102,0x0A75C3B9,0x7FAC4F09,0x153AA782,
+	0xFAE3390C,0x91AE7180,0x0DB15E98,0x68372BF5,0x50877E22,0x68130A76,0x297627BB,
+	/* T[3] */
+	0x99D1F5C0,0x661FEE6B,0x87FB3A46,0x8EBB5E55,0x30E6BCDF,0xADF53455,0x53EAA8DE,
+	0x4B32BA0E,0xD93489B5,0x0DD94100,0x3EC570FB,0x64B08130,0x8890692C,0xB05CA070,
+	/* T[4] */
+	0x72BA511B,0x35E33C99,0x34AFA8FF,0x76D36BC5,0xBA000261,0x84AADDB6,0x51DD6C0C,
+	0x5973757F,0x0E594A8B,0xB0120CCD,0xAB7158C3,0x0105662B,0x3EE8BEB5,0x65680CF8,
+	/* T[5] */
+	0x245CFBE6,0x2D489D85,0x8D5E868B,0x0ABF496F,0x01A61609,0xAE53D809,0xABDB83A3,
+	0xDF424561,0x5EC52859,0x44017A8D,0xE604B2CE,0x680F7276,0x225B9E81,0xCCBE2A58,
+	/* T[6] */
+	0xFAC6BD10,0x22A0DBDB,0x3280EA98,0x30C51471,0xC4D2D8A0,0x2DEBAEC4,0x2050F0BE,
+	0xABF66894,0x21F58C1A,0xD3196C38,0x38D4D014,0x1A1BA51E,0x095CE353,0x461D241E,
+	/* T[7] */
+	0xEBB4D0EF,0xB4698617,0x9B5497C8,0x4FA2E6DA,0x3F9A9D60,0xE982D3D2,0x751C78F4,
+	0x66ECDA5D,0x4385F043,0x28595FB8,0x72F3DB8C,0x386811BE,0x06064761,0xE7386BF6,
+	/* T[8] */
+	0x49F1BE49,0x9F298AB2,0x27FABF11,0xB82E680E,0x91B1B59D,0x68C6A0A5,0x801DBEF4,
+	0xA3EE8C97,0xCCA68B0D,0x584AA814,0xC35333A8,0x9829C8EB,0xF656F95B,0xA88020EF,
+	/* T[9] */
+	0x6A3CA39D,0x82EEED5B,0x2CE59404,0x27D7C2B4,0x4BBCA6CE,0x8D6D1760,0x7122FD0E,
+	0xC844F4F3,0xB71B5508,0xDC559E20,0x258332E3,0x6032ADAC,0xD1044A7F,0x4D12817A,
+	/* T[10] */
+	0x91F12A2B,0x37CA81D6,0xF6BD8249,0x0C48D3AC,0x0839E51C,0xE2FC13FC,0xB0C8DD37,
+	0xEE0F913F,0x6264D47A,0xCCA5A58E,0xF3945AD9,0x045D3A42,0xA97EFE98,0x87555FE9,
+	/* T[11] */
+	0x823B8697,0x529A92C5,0x00AEAC58,0x4C40A18C,0x4F9A64F2,0xD7FCA2C9,0x48DC325B,
+	0x7EDF00C5,0xC2B9D225,0x1D096B9C,0xFA008D1D,0xEA9C5BF1,0x870840F6,0x785122C4,
+	/* T[12] */
+	0x6FD42AAC,0xD973AE57,0x5A8DE035,0x5ED80597,0xE14FCF60,0xF70ACD29,0x6A8B056D,
+	0x6BB4F3CE,0xB19E35A9,0xE14E116E,0x369458CB,0x1A540386,0xE7E6DD4D,0xA491BDD0,
+	/* T[13] */
+	0xC11B9ED1,0xB91E7945,0xD17D703B,0xB735EF3A,0x89A02038,0xA4FC4A30,0x377972FB,
+	0x2DBE6991,0x56CA8761,0xDC4C2ACA,0x9AE43DCD,0x45A263D3,0xC67618E3,0x99F2B3AF,
+	/* T[14] */
+	0xDFD57283,0x32EC3CA7,0x50980A51,0x556102C9,0xD5BE72A6,0x71066DB4,0x84715223,
+	0x74709EE9,0x9D4F7CE0,0x08361673,0x736B979D,0x8061582D,0x8A1EAC85,0xFD1DCAA3,
+	/* T[15] */
+	0x9177DD2B,0xD3FDEA60,0xD6B5D37D,0x1A0E1790,0xC128F400,0x63F653F2,0x61DC5849,
+	0xFB0120A8,0x455FBDF1,0xDA067FD0,0xA6BACB11,0xA40041A7,0x7933301B,0xCA27FFF4,
+};
+static const uint32_t ecpki_comb_base_secp224r1[2*7] = {
+	0x115C1D21,0x343280D6,0x56C21122,0x4A03C1D3,0x321390B9,0x6BB4BF7F,0xB70E0CBD,
+	0x85007E34,0x44D58199,0x5A074764,0xCD4375A0,0x4C22DFE6,0xB5F723FB,0xBD376388
+};
+
+/* secp256k1: 5 teeth spaced 52 bits apart */
+static const uint32_t ecpki_comb_points_secp256k1[CC_ECPKI_COMB_POINTS_COUNT*2*8] = {
+	/* T[0] */
+	0xF6E0AE00,0xAF15176E,0x043FBEFB,0xD7547EBC,0xB1DC8EBD,0xEBC9AC4A,0x259E8DA7,0x0392FEBF,
+	0x8081135D,0xF212ED28,0x1D07A4C5,0x3E3705AC,0x1C06ACBD,0xB47AE01C,0xD942CA4A,0xB7542A1F,
+	/* T[1] */
+	0x321C4287,0xBDE81EB0,0x802FB121,0x0719C14F,0xBF7EB9B6,0xB133B8C2,0x05CD1880,0x8413EF72,
+	0x32A44A02,0x361DE694,0x9BB6642E,0xBC1C1CB0,0xA9F7A375,0x07678F45,0xFE9B2725,0x6C2C3390,
+	/* T[2] */
+	0xC26EAD14,0x09DB6E7F,0x66BF5D17,0x909354D2,0xC4676457,0x6111C23E,0xA0527359,0x16ED632E,
+	0xB437400D,0xDA388905,0x6752AE83,0x0CF34309,0x575CCB0C,0x8ADAE786,0x2EBCE94F,0xB088D988,
+	/* T[3] */
+	0x5164386A,0x689F4BF0,0x71C07944,0x927CA540,0x4C0E830A,0x195DB69A,0xB3E3D6D6,0x662FAADE,
+	0x7574001D,0xB2967962,0xF1589D2B,0x4442B689,0x62ADB69D,0x271D447D,0xB265DBEC,0x9190AB7A,
+	/* T[4] */
+	0x684B7834,0x799CBB01,0x6E16CD3A,0xE28175D5,0x4CEE0EF0,0x94BA471D,0xEE2A785B,0x6AB63434,
+	0xE726263B,0xAF77A49B,0xBAC2AD64,0x559481FF,0x84A309F9,0x0978CBF3,0xE546223F,0x3452A9A6,
+	/* T[5] */
+	0x33A7F07F,0x928983F4,0xF4EC0249,0xB3A30360,0xD6C41887,0xC70AC327,0x5B362124,0x80388F3C,
+	0x242427D9,0x5FD1F9F8,0x0D7CBFC2,0xC5D1D717,0x325AA8A1,0x314598EA,0x96A40658,0x0669F9AA,
+	/* T[6] */
+	0x7F62F55B,0xEAF0D8C0,0xBA1696A7,0x97DAE364,0x9AA887F4,0x62E5E9C2,0x25CF66D0,0x4EC2B236,
+	0xECDD2AA1,0xFB14237F,0xDBB30FAF,0x38F10098,0xFE1C0BD1,0x1CCCD7CC,0xAB2D4AA0,0x80277EED,
+	/* T[7] */
+	0x5AFC6849,0x8C2D7B56,0x3342A97B,0x2B419E40,0xA4792E89,0xB85B94CE,0x73EE8AB7,0xFA794FA5,
+	0x2877A137,0x5F2C8FF6,0xA09474A3,0x9B8CF281,0x8BDB138D,0x875141BC,0xA9740629,0x42335431,
+	/* T[8] */
+	0x13AC0A71,0x671CD2A0,0x5EFE221D,0x9C61216F,0xBF26DE01,0xBFBF05CF,0x9AF58119,0xA2F3332E,
+	0x17FB4155,0x1030D359,0xFB85E4E1,0x68411DC1,0x75F059A5,0x004F1CBC,0x0C85FDC0,0x487460A9,
+	/* T[9] */
+	0xBCAD8875,0xAACB8746,0x681142C1,0x5E809655,0x36167D5C,0x4AD3654E,0x2048E224,0x121C5F8D,
+	0xF260CD35,0x895FB41E,0xDCB2D826,0x04D4D94C,0xE50A90FE,0x44C57462,0x23AF1A62,0xDDDCDCFC,
+	/* T[10] */
+	0xC835CE36,0xB7D30CBA,0x31D4D1A8,0x63B1B569,0xD5C86717,0xBBF115AE,0x6479D4E2,0xF2583EAB,
+	0x95397327,0x900760F4,0x837D291B,0xD396443D,0x6601717E,0xE95EC388,0x3C77B320,0xA1AA6096,
+	/* T[11] */
+	0xD515E754,0xFF20D28F,0x038BBEA8,0x055F3B24,0xBDDAAEBE,0xCD41982D,0x42ACFDBC,0x20BD1304,
+	0x68D3BAAD,0xCA17F837,0x85DDE2DF,0x04797EEC,0x1E09FC10,0x2F27D165,0x5B380642,0x5B95253B,
+	/* T[12] */
+	0x8F478001,0x89953D5D,0xD8B2089D,0xC16DB8FD,0xCC0B2A80,0xFE548D00,0xEDC81A15,0x11D802B7,
+	0xDC194646,0xC36DCC44,0xC73C2A1F,0xE849CCA1,0x797E4992,0x88681FBA,0x2D9F9370,0x25CF8D66,
+	/* T[13] */
+	0xBBA98774,0x7FE61079,0xFBBEEBA1,0xE5AEBD98,0x67932504,0x28D528AE,0x49CAA666,0xF419A3B9,
+	0x2B326353,0x81C20C01,0x6B8651DC,0xD8D504A0,0x0708387F,0xDFD03CAF,0x7BB1E410,0x8488BE5A,
+	/* T[14] */
+	0xA2512F02,0x7AB3822B,0x8DBA6881,0x8C188CBF,0xB06D6CF9,0x7C2CAED4,0x7AC2C581,0x94CBA2CF,
+	0xD569ECE5,0x18EF3ECC,0x2AAD4596,0x9773D988,0x1BAD8DE1,0xE803A974,0x8A9F6E8B,0x208ECB1D,
+	/* T[15] */
+	0xFD32E1CC,0x11F8813E,0x1D4BF2CD,0xCC0FC919,0x228AB159,0x566B058B,0x30EF2135,0x892A09EC,
+	0x464A8415,0x4C3C6C07,0xF43A18DD,0xF2B2F5CC,0x0ACD8F4F,0x95BDF49C,0x8A7F8937,0xAB3A52B1,
+};
+static const uint32_t ecpki_comb_base_secp256k1[2*8] = {
+	0x16F81798,0x59F2815B,0x2DCE28D9,0x029BFCDB,0xCE870B07,0x55A06295,0xF9DCBBAC,0x79BE667E,
+	0xFB10D4B8,0x9C47D08F,0xA6855419,0xFD17B448,0x0E1108A8,0x5DA4FBFC,0x26A3C465,0x483ADA77
+};
+
+/* secp256r1: 5 teeth spaced 52 bits apart */
+static const uint32_t ecpki_comb_points_secp256r1[CC_ECPKI_COMB_POINTS_COUNT*2*8] = {
+	/* T[0] */
+	0x2C2603D7,0xF1B2FB60,0xD0746191,0x1C28A636,0x69DDABE5,0xAB7D9007,0xB6323654,0xAD7F1B10,
+	0xE9431482,0xF6462E69,0x41E7E415,0xB5889A5F,0x021B87C0,0xC0534176,0xF8421DAB,0xED8064A1,
+	/* T[1] */
+	0x798F316D,0x8C3D5202,0xCAEDDB83,0xDC8F13BF,0xE79E07DD,0x89616CB1,0x96C4FF9C,0x52788440,
+	0x56CB4996,0x5DF66609,0x93AF5E10,0x7F479902,0x40D227CB,0x212F2EA4,0x59E51E4C,0xB2C2A6DB,
+	/* T[2] */
+	0x8545438A,0x0ABB926B,0xC00157B9,0xAE1600AB,0xC3F5ECEC,0xD331BCDC,0x24373A17,0xEB34F080,
+	0x4E1071EB,0xA8EFFF8A,0x30F26E32,0x0FD35EF6,0x552486D1,0xA01DB45C,0x5706CFAB,0x8A701DA5,
+	/* T[3] */
+	0x9C6DE2F0,0x0968AAA0,0x4D6E1737,0xA8EA7589,0x90E7F7F9,0x5924F7F0,0xD86D9BC0,0x01E0DE74,
+	0x9750AAD4,0x64F9406D,0xB5F5B510,0xAEDD9853,0xF55BB1A2,0x244B3569,0xB774D0F6,0x244276DF,
+	/* T[4] */
+	0x10326611,0x0A3E3494,0x9B4AD9FD,0xC5D15A99,0x8E9E8BF3,0x41FBA49E,0x72B22479,0xAF21E49C,
+	0xEC5B4AD5,0x06BEB69D,0xC15EEE95,0x2EBC2A63,0x30E2BEFA,0x2DFF2900,0x0351AC94,0x4FEEF019,
+	/* T[5] */
+	0x338E58DA,0xBA9314D9,0x22BD6911,0x89AE788C,0x646DB607,0x4CFB0E28,0xCFEF2213,0x3F0C96E6,
+	0x0CAFEF7C,0x06992D4F,0x0299A805,0x21D1DC86,0xDE78903B,0xEA0C0FD4,0x6D333CA4,0x24048E6D,
+	/* T[6] */
+	0x1674DCAB,0x0E645AC3,0x36E65EB5,0x3B086F1F,0x7DA81DCA,0xEB662CF0,0x2AC9CE9F,0x572D607B,
+	0xDA225A9F,0x253A0B3E,0x1EBAE0B1,0xA09FDF27,0x22BF31B8,0xEAD714D2,0xE4336BAB,0xEDA14B54,
+	/* T[7] */
+	0xC7E54BEE,0xF95276D2,0x3A22AAD4,0xF88C60C8,0x4ACDA0CB,0xC70C60AD,0x7FD081C5,0x8429DFDD,
+	0xAC78CFDF,0x491FF6B6,0xECEC77CD,0xD927D395,0xDF0600A6,0x7451F8E1,0x7AE7681A,0x3FA91ABA,
+	/* T[8] */
+	0xEA4B564A,0xAA44314C,0x2A566FC8,0xBD569274,0x92D81B88,0x74A95E72,0xDF5AD6E9,0x2E8F84BA,
+	0x935C5DAD,0xD3F6BBE9,0xB15843F8,0x411F1CCD,0xCD482ECA,0x45DA9165,0x5438FBAD,0xD44AC55D,
+	/* T[9] */
+	0xBCB70552,0x41618305,0xC3DA30BB,0x7B6D234E,0x250A6932,0xBE4FA309,0x2C06E4EA,0xA4F9F367,
+	0xF68D981B,0xB8EBEA26,0x052A14AE,0x90097CB6,0xA5D98E06,0x5AF9501F,0x25C442E4,0xF76F5348,
+	/* T[10] */
+	0xB258FBBA,0x3E955641,0xCC8EA358,0x1065AE57,0x643966B8,0xD9FD0DA1,0xDE55C5ED,0x7918B03B,
+	0xB6870E88,0xBC3BAEE5,0x8E46E993,0x543B7DD0,0xCDDB9309,0xFB2B863E,0x51EA048B,0x614AF453,
+	/* T[11] */
+	0x994A5B6E,0xCF042714,0x86FB8797,0x0F091A2F,0xF47BF8EA,0x98465DD3,0xC948561B,0xD5588A0D,
+	0x9BC74903,0xDE5B9A41,0x42DDC496,0x47F5CB7D,0xC7F7A92F,0xE9F649DA,0xA35C551A,0xDAA94E8F,
+	/* T[12] */
+	0x3EF6F4C1,0xE7DA7A30,0x98056827,0xA07EDEC9,0x79C1A3AB,0xDB3CD8F0,0x3BD73679,0x2B51F09A,
+	0xA45F02E8,0x6B4BA19F,0xDFD9FE28,0x61A524F3,0x09315057,0x966B6BD4,0x332AB912,0xAD9CE7AB,
+	/* T[13] */
+	0x320304D1,0x3B9E5A25,0x8B3843D5,0x0C0BF613,0xDD9EBE66,0x1AEBF43C,0x24DA6438,0xDAB8DDDC,
+	0x08BA5B92,0xF6541C56,0x48CA9837,0x647797C6,0x8D315EF7,0x7650EC55,0x9E4E370C,0x9EB0EFBF,
+	/* T[14] */
+	0x9BF174BF,0xF317D32C,0xBF0AB911,0xC29520B8,0x791551AB,0x4F5239D9,0x676984A9,0x792F29F8,
+	0xA6FB036B,0x08F267F2,0x39B96D8B,0x9AB2FAF2,0xC9D4B1C1,0x356FDD6D,0x3B28E94A,0xF0D8CE8B,
+	/* T[15] */
+	0x5B696527,0x2E75A266,0x5A00169C,0x1A2530B0,0x4286FB42,0x76C4C180,0x8E831D5B,0x825F0194,
+	0xEF703739,0xDBF0A11F,0xCE5B106A,0x106F9BC4,0x24111150,0x61794C4F,0xBC723A17,0x435872FE,
+};
+static const uint32_t ecpki_comb_base_secp256r1[2*8] = {
+	0xD898C296,0xF4A13945,0x2DEB33A0,0x77037D81,0x63A440F2,0xF8BCE6E5,0xE12C4247,0x6B17D1F2,
+	0x37BF51F5,0xCBB64068,0x6B315ECE,0x2BCE3357,0x7C0F9E16,0x8EE7EB4A,0xFE1A7F9B,0x4FE342E2
+};
+
+/* secp384r1: 5 teeth spaced 77 bits apart */
+static const uint32_t ecpki_comb_points_secp384r1[CC_ECPKI_COMB_POINTS_COUNT*2*12] = {
+	/* T[0] */
+	0xF25AD62D,0x29F63E66,0x258928E4,0x85842993,0x09C1084A,0x881CB3DA,0xBA6E760B,0x0885C336,0xF0786FD2,0x3B207D50,0x8183B90E,0x68E734B4,
+	0x3677D52C,0x5513C21F,0xA1A416D4,0x5167A2BA,0xD87A2FF1,0xB62AB582,0xD3D0BD42,0x731CFA96,0x9D1DC2CC,0xFB05B922,0x939C77CF,0x4E46302D,
+	/* T[1] */
+	0xEA497174,0x595C086D,0xA0362669,0x0111F8F6,0xF26BFC86,0x6B9AAC6B,0x6B07A52C,0x7723AE4A,0x9B4AFE2D,0xCFC067E4,0xD86C6EA6,0x93DFD4D7,
+	0xF88E42C8,0x9A1E1C52,0x71BEC74C,0xCE11A341,0xCCD5CAF1,0xF6EFA2B5,0xB7A735C1,0x0C24C03E,0x9ECE8F62,0x6CAF8495,0x2B6926B7,0xCF5F842A,
+	/* T[2] */
+	0x94F297AB,0x0E35036D,0xADE78C80,0x8EC5E699,0x098C6769,0xFFC2F073,0x99E5ADC2,0xF14FAFF4,0xB7878984,0x1A7457CB,0x41057B31,0x721AF76A,
+	0xC0054434,0x99701A09,0xB466F33D,0xA625F684,0x95247C1E,0x1301DACA,0x945AF410,0x4D052779,0x7E271EF8,0x7E91AB55,0xCBF9441B,0xA6E68F64,
+	/* T[3] */
+	0x71C174A0,0x722D6ED6,0x1851209C,0x60423EF9,0xDFD6A0F8,0xFBFAE011,0x1A399EFD,0xCEC430A8,0xB08D223E,0xA405ECE9,0xB4FCEC5E,0x3040D554,
+	0x58C2ECE8,0x9A625809,0x46BC6604,0x0FFCE75A,0x548481A6,0x19B7209C,0xCAB6F1F2,0x45075EA0,0x8055CA57,0x8908DDE0,0x1340BDDD,0x04D9739A,
+	/* T[4] */
+	0xD852FEED,0xB06E2B57,0x211527E8,0xF317F58A,0x6EB276FF,0xF1BF9665,0xF0E750A3,0x9F52F5C1,0x1DEF22A8,0x8C2B9BE0,0x0B19CE3D,0xCB5A08DE,
+	0x4A7D2719,0x797F1317,0x00BF99B8,0x70BD1FA0,0x46CFC56C,0x240D8461,0xF622E5C1,0x48208A69,0x18C5657E,0xE65951EA,0x4229B362,0x9F1A32AC,
+	/* T[5] */
+	0x1B7A42C2,0xF875AA79,0xDE8C94D8,0xE0CEE4BC,0xE7CD55D7,0x34EAEC4D,0x7930210A,0x651B26B0,0x34406B6D,0xDF5E8041,0x06D55C11,0x90832EB2,
+	0x38F4F199,0x66BB3C14,0x52980C0C,0x037273DE,0x68A43D03,0x5B15F367,0xC50B7FED,0x3E342C61,0xE17656FC,0x32BB2081,0x4BD7057C,0x8447F25D,
+	/* T[6] */
+	0xC8FF92B3,0x1E059208,0xE82CEF62,0x17C4195B,0xBA9A452B,0x8258C9F0,0x260A63B5,0x6B591AFB,0xF8067E9A,0x0515B353,0x80437F9B,0xDECA9CE7,
+	0x7AB60453,0xA5EE3485,0x57FCD650,0x0F543CC8,0x59C04A8A,0x941A8D6E,0x92669805,0xDD4CD5FC,0x15AE6ACE,0x84031183,0x2BDC0A46,0x5759F1A8,
+	/* T[7] */
+	0xA0451C3C,0x4C3D5811,0xB6691519,0xCEA94ADD,0x79460E15,0x382C10C8,0x95F1C2A9,0xDE7EC4F6,0x6E772271,0x998A97E0,0x2DBC97B6,0x844D1E18,
+	0x543D0EE6,0x92BDCACD,0xD3E2404E,0xFD95B86F,0xC1B4E9A8,0xAA250A56,0x7019461F,0xE46FFED7,0xB86D626D,0xCDB961E7,0x6D26D0E7,0xE6BFD96A,
+	/* T[8] */
+	0xC2442724,0x139DC5E5,0x0358266A,0x7F59D901,0x6BBD1DA4,0xBF14C90B,0xFA67F40F,0x0842B990,0xA0DEF4FB,0xF7C34387,0xD1903DEF,0x2B736319,
+	0x01176C16,0xF0B2A2A3,0xDD892363,0xF7B54E04,0x7EC86A6C,0x8B050132,0xC0FADCE3,0xA4939F16,0x7EA852F4,0x0A5FD84B,0xD5EA67B2,0xC5EF58E6,
+	/* T[9] */
+	0xC0C5642F,0xC49C93F7,0x1E33C978,0xEDA5DC70,0x9FB3DAFC,0xE5EA31CD,0xCDBA2858,0xF7B00FA9,0x49406E48,0xFB0C8028,0xCBEC7EF0,0xC187A763,
+	0xFCF6E76A,0x750B15FD,0x3FE8C2D4,0xCAFD8BD2,0xD092C552,0x496E8882,0x4A3D4E99,0xC855887D,0xA7454FE7,0xD8B1021C,0xC26E7C2E,0xB20C5C85,
+	/* T[10] */
+	0xF9738BE3,0x022DF57E,0x79C46289,0x0B83933E,0x59AE964C,0x25D4586F,0x79FFE70C,0xC2906F35,0xD47FEED0,0xFAB581D6,0x5DDD8B13,0x1853A728,
+	0xDC94C2B5,0x6CC9C20D,0xD868D25B,0x0E0668B1,0x076445C4,0x19F75E6F,0xC86E4CB7,0xEEBEA313,0xF92CD5FB,0x48E5AFDB,0x8B1F9726,0x3B231DAC,
+	/* T[11] */
+	0x671C5641,0x94558001,0x03F2C1D0,0x3C67AFD2,0x9D922DCC,0x414BD2CC,0x88A9515E,0xC3445355,0x75606F48,0x03843E08,0x698E3260,0xADE52A01,
+	0x9794D121,0x609CDF32,0x4F94F809,0x9CDEB7DF,0xE9356253,0x86A365D3,0x526E19CF,0xF4143760,0xAECFDF9A,0xB5AD2C1A,0x64BF06B2,0x63E17D2A,
+	/* T[12] */
+	0x42BC5244,0xFA8BF95B,0xECE46446,0xF9E5373C,0xAD4F7A45,0x9C16BCD1,0x8761EC44,0xC3763E48,0xF59E2211,0x6E3C1F6F,0xE727EFB7,0xCFB08731,
+	0x5D486045,0xB6A50F58,0xB26A46C3,0x2C8D34EC,0xE4488DC7,0xC14ED326,0x89633088,0xD41D260B,0xE61DC57B,0x5EBEA851,0x5DE2C494,0x6AA5AAEF,
+	/* T[13] */
+	0x05BF5603,0x5C102C92,0x2824FA5E,0x4E9A7DF0,0x4199B583,0x0A7CF153,0x748D7279,0xD99C9465,0xB5E6AD5C,0x256F2997,0x857E01E4,0x5A86153A,
+	0xD99B8EC6,0x4E865022,0xA7F7DD1F,0xBCA3AE17,0x3E7B9C04,0x734EC7F6,0x84E0256C,0x2F0AF553,0xA33ABB66,0x2A0141B0,0x81AEB014,0xBC024671,
+	/* T[14] */
+	0x77C0679E,0xF374108E,0xAB3B494B,0x2E378F2B,0xC4F7ED22,0xFFF73012,0x70AB9D71,0x6CD7EAAE,0x8F3BC77F,0x3A45A026,0xDCE29D2C,0xB996DB7A,
+	0x9E7F7CC3,0x8D2F92B1,0xDB3C7709,0x74342E29,0x97F7ACAE,0xEF8D341C,0x40E3077C,0xAFA6E71A,0x24D4C6BF,0xB3D7F8B0,0x5B489A2C,0x5978170D,
+	/* T[15] */
+	0x679A2ABA,0x96EDF50F,0x7FA01880,0x31B92B91,0x72495766,0xFDA047EB,0xCB1299C9,0xE8C663C5,0x91DBE668,0x15798146,0x9DA9121C,0x25E209C5,
+	0xF69B64DA,0x9AD033A2,0xD82ADB97,0x6366E8F3,0xE9103189,0x96052F28,0x6E6CE744,0x6C279054,0xFE5D6697,0xDA53B069,0xDA09FB6A,0x553200B9,
+};
+static const uint32_t ecpki_comb_base_secp384r1[2*12] = {
+	0x72760AB7,0x3A545E38,0xBF55296C,0x5502F25D,0x82542A38,0x59F741E0,0x8BA79B98,0x6E1D3B62,0xF320AD74,0x8EB1C71E,0xBE8B0537,0xAA87CA22,
+	0x90EA0E5F,0x7A431D7C,0x1D7E819D,0x0A60B1CE,0xB5F0B8C0,0xE9DA3113,0x289A147C,0xF8F41DBD,0x9292DC29,0x5D9E98BF,0x96262C6F,0x3617DE4A
+};
+
+/* secp521r1: 5 teeth spaced 105 bits apart */
+static const uint32_t ecpki_comb_points_secp521r1[CC_ECPKI_COMB_POINTS_COUNT*2*17] = {
+	/* T[0] */
+	0xB3F2054A,0x31F69BD0,0x4C3DEB4A,0x1F5A7813,0x584288C6,0x2A93DBCF,0x632F5B4A,0x08A72B97,0xF7D12FE4,0xFD2A635F,0x1F999163,0x0EFF123A,0x3E8CC03D,0xE5A31839,0x6DEE3705,0x676A587A,0x00000059,
+	0xE9734E5A,0xB8A8AC9A,0xCAFD6D5B,0xEC24E6C5,0xF14C59D2,0x4FA6647D,0xB9BDD9F0,0x1CDEA7C7,0x714C0E69,0x0CE2D440,0x3A92FBEA,0x5EBDF5DF,0x36CB0941,0x71336EE9,0xDF36C73E,0x3363E1E5,0x0000008E,
+	/* T[1] */
+	0xD830D8A8,0xD2035EEA,0x001621BF,0x7D54229C,0x78B63CC1,0xFA65F4D2,0x92220497,0x08229F04,0x4557601B,0x43ECF98F,0x1C67A3E4,0x7EC4A71B,0x6FE77497,0x3F64A74F,0xE1165558,0xAD2A0BD7,0x0000019A,
+	0xE3BF312C,0xA9AC61AF,0xE5B983AF,0xFFD8382A,0x978562BF,0xBF3AAF55,0x8ABDC9E2,0x7E027FFF,0x6E4E5D9D,0xD51A67B9,0x4ADBCF98,0xBAF70DA8,0xDF828AD6,0x7A2E1ABE,0x33D015B0,0x0BBEB7F8,0x00000088,
+	/* T[2] */
+	0x0039C6DC,0x0A1FCD4C,0xF4CA0288,0x9C6D6388,0x44ADA5A7,0xE7E3E825,0xF3C97A6C,0xEB0AC357,0x88D38F9D,0x2427FF60,0xE2BE7BE1,0x91E5E659,0x6D2C41E1,0xF382A70D,0x2760FF4D,0x45F98CCE,0x0000003B,
+	0xD4EFDF86,0xB6C89432,0x76FD0EEF,0xE0315DC8,0x1591DFD4,0x5C7C1889,0x7EE8FE02,0x9B17B80A,0xB380A161,0x477A0A22,0xC67408A2,0x8D108DB1,0x90DBECDA,0x7F3C65DB,0x22DD7DE6,0x7047C7E7,0x000000EB,
+	/* T[3] */
+	0x5C983F8A,0xD532D4DD,0x1FDA452D,0x7BAA37CA,0xBBE566EF,0xC9CC2AF8,0x14FC6DD8,0x74E537DA,0x3FC3CD47,0xF4AEDD59,0x95D5FE38,0x25D69328,0xC0FFDFD3,0xEE46A972,0xDE97FA0B,0x9D4DDDC0,0x00000174,
+	0x31DFCA70,0x6A56C9F8,0x315AA9D9,0x085CB4B7,0x21DDE760,0x5A6EC52E,0xB6DB2DC4,0x0BD2893E,0xE3A4F203,0x79738558,0xE18178C1,0x29C6560B,0x273982FD,0x99EBF283,0xF4ED64B8,0x874B5FDF,0x00000193,
+	/* T[4] */
+	0x8A5C7061,0x32E0FB18,0x92B7AB2E,0xF7ED4ED9,0x183081D4,0xA8DEC756,0xD66E691C,0x61619C88,0x44E4021C,0xC1811A9C,0xC58A57C6,0xAFA1BE4B,0x561EBF09,0xE5721CAB,0x8A6BFCAC,0x0A87391E,0x00000005,
+	0xF51B5D29,0x48822B8A,0x2AA086A8,0xB73A5DEB,0xD8C98229,0x44FBE23E,0x705F1753,0x4F346939,0xC73380B4,0x21598522,0x2DB0DBB2,0xDBCFB868,0xE6F7543F,0x2B7D3452,0x296D1AB4,0x7A9252D6,0x0000015C,
+	/* T[5] */
+	0x91C180B2,0x7483BCE8,0x353F4C9A,0x1271D0B6,0x076CBAAA,0x677D6948,0x127E8356,0x78C57E20,0xDD419DCB,0x64D74122,0x0D648286,0xAFD672FE,0xB036C1AB,0x646B4AAF,0x8F3EFAD5,0x57109512,0x0000008A,
+	0xB6BC06C1,0x10F78990,0x30261A47,0x0529895E,0xF006A94A,0x5B2A90DD,0xA0A0B1E6,0x66C8F20B,0x5EAAA02B,0xD2D33343,0xD6A793B9,0xF1D09150,0x70DB66E4,0x073BA880,0xF4D7C8A6,0xBE12BA19,0x00000017,
+	/* T[6] */
+	0xEE10E7C3,0x60C707F6,0x32741507,0xF8ED1568,0xDA5F1C73,0x4972A8B9,0xD89C4D02,0x066DAAFF,0x539F26AE,0x6A925F82,0x0335EA29,0x43D367FA,0xDA24D94C,0x0230E95A,0xACBE83D1,0xAA7C9049,0x00000184,
+	0xFB8AC7C3,0xE8EB9760,0xCF86A94B,0x8FD71AD7,0x939F1DAD,0x217F3B3C,0x0C580C1B,0xB50F697B,0x8022C3AC,0x7C6B15CE,0x26D608B8,0x5DDD0E69,0x6996D544,0xE87F53EF,0x59BEB7EC,0xB9F32770,0x000001B3,
+	/* T[7] */
+	0x697E3255,0x5593C5CB,0x317A2DAA,0x6FB49854,0xAECC9F21,0x2E0956AF,0x01840F0D,0x44E2A79E,0xD15345B5,0x23CF4F9D,0xF1B49CB2,0x7DA3EC33,0xD79654CE,0x87F81C91,0x0C0152A8,0xF8AE61F4,0x0000009E,
+	0x3169B245,0xF4735D4D,0x27FF871C,0x3B4250B5,0x3115EB93,0x512DA18F,0x643077B8,0xD325F95F,0x1655E704,0x777C88DC,0x4B8DBED9,0x5DEF74F6,0xF27C415B,0x03799022,0x5BAFDB30,0x4D594D5B,0x000001D1,
+	/* T[8] */
+	0x3EE54469,0xBE544D1D,0xFB9C1AB2,0x54A82707,0x1CB0AC20,0xE5D4047B,0x5CBB9D01,0x2B3C4434,0xE3769B1A,0x1C2EACD1,0xA48C6A28,0x9FBD5278,0x1EB771F2,0x7179A11A,0xF16E77BA,0xDB1A5526,0x0000009F,
+	0x5B0F6A17,0x047174E5,0x07EF4D80,0x38A1B43B,0xF06691D8,0xA62B0EB0,0x37729DF3,0x6D4A2032,0x9BFFC134,0x1C0852E9,0xE9BBA885,0x11608E5E,0x82AEBFA5,0x81DDDDD1,0x37C2ED8D,0xA350F587,0x00000121,
+	/* T[9] */
+	0xFA302FC7,0x648C54F0,0xB29C21A6,0xA1196E18,0xA19460BB,0xEE656871,0x1046282F,0x3E39976D,0x13F2EFC3,0x7BFA63AE,0x3860A726,0xD8091185,0x63C6EDAF,0xB8A47E4B,0x44B10F84,0x7A44AE20,0x00000189,
+	0xFDD692D6,0xCB532B8D,0x611F777C,0xDE95E26C,0x562D10A7,0x8AFD9536,0x08B4A75A,0xDBFC2B7C,0x812528B2,0xB2C85A2B,0x5537461E,0x2A285245,0x6278CABD,0x139D87E8,0x9DE33FA1,0xFE6A388F,0x00000010,
+	/* T[10] */
+	0x5478C78B,0xF8D079D6,0x1919A177,0xB986DD2A,0x65DF62F8,0xA4DBF884,0x8DFD44F4,0x6F733BCA,0x8F47B6EB,0x4054ECC6,0x55560FD3,0x3F2F09DA,0xC8281E7E,0x06C589F2,0x14832156,0x666E8FDB,0x00000173,
+	0x69D2C544,0xE5F658CA,0x40209DE8,0xED8D2F33,0x751840B5,0xB66F87D7,0x17B7D4B7,0x717D3CD7,0xBDE01662,0x462F7979,0x09B11A7E,0xBEE61A70,0x341C4E41,0x0ECEE4EA,0x68A3228A,0x98F23B04,0x000001FA,
+	/* T[11] */
+	0xEA860DF5,0xAD85AFFE,0x919B588D,0x9EFA0F85,0xEADC718C,0xEC6F52AC,0x8E1CDBEB,0x51C8C343,0x1D71FC27,0xDDFE1150,0x303071A5,0xDA30FAAF,0x699350CC,0x35B712C4,0x52BA2779,0xB908EA92,0x000000FA,
+	0xBB1806E6,0x466F575C,0x942BA153,0xACEDB51A,0x5AED1DB6,0x897960AB,0xAF65AF82,0x5D2779A1,0xBA4D7A5A,0xFD63500F,0xB14CB026,0xE8F40264,0x498E7957,0xF19D0D9F,0x0E60A0B3,0x6AFC9F16,0x00000177,
+	/* T[12] */
+	0x9D732731,0x9DF8D8AA,0x9226FA10,0x3F9E7FF1,0x9A43C160,0xBE1AD733,0xA7FCEDA2,0x165709A0,0xC7E53605,0x82EAF534,0x1A7291F6,0x605BD375,0x6CB8A1E2,0xCD90FF3A,0xBFFDF045,0x7880A718,0x000000EF,
+	0xBF336F92,0x702D0152,0x28B1B627,0x11A3A7A9,0xE5A3DA38,0x404FB5A7,0xCA6B3F5A,0x90A87156,0xCF03B5B4,0xC4179BC9,0x2E5F0E82,0x8A202AE1,0x70C224F5,0x7EF27283,0xBA028C13,0x1641DA92,0x00000149,
+	/* T[13] */
+	0x1EA25F04,0xD3DC0DE7,0x8AC8C23B,0x7435EEDE,0x649BA16D,0xF34CC386,0xB9A2FD1F,0x94762F40,0x4ACAAF10,0xF368204A,0xB074ED31,0x5752472C,0xB333A7A7,0xC0B1D4DC,0x25DA7DD2,0x3A263965,0x000000F4,
+	0x982EB684,0xCD75FD2C,0xBAAD0851,0xA20CD331,0xF0B71A61,0x744A501F,0xFBC98149,0x8CABDB6C,0x092B4891,0xD4744CEF,0x0C04EA33,0xB3831558,0x8BC44EB7,0xDAA9891A,0xA6780D1B,0xD592FE66,0x000001C7,
+	/* T[14] */
+	0x49EB2C42,0x2290E166,0x601BD2EB,0x2C2CEE03,0x062E0632,0x75A4BCFF,0x15185F1B,0x7F9B2ED1,0xD8CC7DC7,0xBEF6F633,0x82288131,0xD6B08CAB,0x190DCBC2,0x7B1535FC,0x70041D98,0xCC555C76,0x0000012D,
+	0x64A4EACC,0x91BFD70D,0xF953C376,0x664F834E,0x17E7F8CD,0xD2B03C56,0xEDF23177,0xA02EC6BD,0x95E3C78E,0x84EE5843,0x9617F490,0x9F1A7E90,0xEB156BBC,0x21404E23,0x3F5752DB,0x83F344BD,0x0000002C,
+	/* T[15] */
+	0x0886FCE5,0x0932A85E,0x539E0749,0xF22990FC,0x9622B480,0x0900525D,0x2322A79E,0xF8159FB8,0x52225E4A,0x16BC8FBA,0x3A8B6083,0x80AED84F,0x7C8B52D4,0x0EC2EA9E,0x8C474025,0x88586280,0x00000122,
+	0x1FA537FC,0x7E82B98A,0xB07AEE91,0x06814D94,0x39BBF49E,0x2ACE89A4,0x572F35DE,0x4272B632,0xA6132D49,0x4AA5EC9C,0x0AC0CC3E,0x6DA8505B,0xF0B72ACE,0xE50B950F,0xEB7A6DCB,0x38D4E07D,0x000000BB,
+};
+static const uint32_t ecpki_comb_base_secp521r1[2*17] = {
+	0xC2E5BD66,0xF97E7E31,0x856A429B,0x3348B3C1,0xA2FFA8DE,0xFE1DC127,0xEFE75928,0xA14B5E77,0x6B4D3DBA,0xF828AF60,0x053FB521,0x9C648139,0x2395B442,0x9E3ECB66,0x0404E9CD,0x858E06B7,0x000000C6,
+	0x9FD16650,0x88BE9476,0xA272C240,0x353C7086,0x3FAD0761,0xC550B901,0x5EF42640,0x97EE7299,0x273E662C,0x17AFBD17,0x579B4468,0x98F54449,0x2C7D1BD9,0x5C8A5FB4,0x9A3BC004,0x39296A78,0x00000118
+};
+
+/* bp256r1: 5 teeth spaced 52 bits apart */
+static const uint32_t ecpki_comb_points_bp256r1[CC_ECPKI_COMB_POINTS_COUNT*2*8] = {
+	/* T[0] */
+	0xA76DD84B,0xD9E091DE,0x87D4A119,0x1D4BA960,0x1EBE3DAA,0xEF6F116F,0xA54B49A0,0x52AC755D,
+	0x3F7AF569,0xA497F1D4,0xBDD41086,0x63C6602F,0x62657AE8,0xBFAE6775,0xCC38FD0B,0x96943618,
+	/* T[1] */
+	0x9123D2D0,0x2987D3D6,0xA75A4927,0xBF1899AA,0x7A65302F,0x66C47699,0x1A783AD6,0x3BD7F6F4,
+	0xEA462807,0x991D8320,0xB1F08769,0xDA8AD9D3,0x00B4DCD8,0x62508C5A,0xCE7ADC4C,0x65B3AB98,
+	/* T[2] */
+	0xE69358A2,0xCA6A5080,0xDD4FDB7B,0x3B506291,0x6D1DE6A2,0xB0A61313,0x844C3D7A,0x74CD760D,
+	0xBE4768C8,0xE8803ABE,0x25D98C8C,0x9206E39D,0xD5E9B3E1,0x0BCA0755,0x776BB7D8,0x3608E473,
+	/* T[3] */
+	0xB12523F5,0xB44C2400,0x517A4DC0,0x4A2517EA,0x953C746A,0xA68115A1,0x0517B15A,0x6334B397,
+	0xADC32777,0xA351B2AB,0x5C2EF9F1,0xB3D379F2,0xDF11642A,0xE409C625,0xBEB10450,0x80BAFCC5,
+	/* T[4] */
+	0xE351E0DF,0xC33787E2,0x6E406914,0x56B86783,0x4438FE74,0x5A005B10,0x1C3B42EB,0x01A47B2D,
+	0xEC33C5FB,0x0A7BB7C0,0xDD7D2C52,0x84596099,0x42FAC326,0x3CB80CE9,0x101A047F,0x916CBF80,
+	/* T[5] */
+	0x3889E35D,0xD02F3511,0x4B595D66,0xB5FF2CC1,0xDFD2DBF4,0xB47E4542,0x4BF35184,0x74791A4D,
+	0x971A44A8,0x92D2456E,0xFCFBE779,0x28184781,0x9B54E1D8,0x6C012AD1,0xC1A4FB96,0x37234B94,
+	/* T[6] */
+	0x63D910CD,0x59DD7F95,0x493ABA90,0xA571FD5F,0xD4A6A35D,0xBFF03987,0x70A07EB2,0x2718A05D,
+	0xF27F88E7,0x72955356,0x492B9322,0x5C8B0FE1,0xF7A851BC,0x947D1B18,0xAC49F4E6,0x1EEB86DD,
+	/* T[7] */
+	0x29A4A2C1,0xFE863977,0xE216E8AE,0x5358BCA9,0xE5C956BE,0x8DD65B08,0x76274963,0x519732D4,
+	0x2F30E907,0x1B083EC3,0xB9567472,0x34E07333,0x80667C9E,0xC5DC12C3,0xB91544BE,0x5F153996,
+	/* T[8] */
+	0xF33C86CA,0x743A9BE4,0x5C84A524,0x1EC9E495,0xB413EBFE,0xED9D87EC,0x36604DDE,0x187AA737,
+	0x07855C7B,0xFC360E08,0xD45245CB,0xA99BE4F5,0x1334805B,0x6D26ADD5,0x03D8E4C2,0x09AB8D78,
+	/* T[9] */
+	0xC05A6DD4,0x44648578,0xBA20937E,0xC193EA91,0xC8B88423,0x597F497F,0x0C301BE9,0x317D8587,
+	0x9D24BBB8,0xE3F00F22,0x66264B2B,0x004687FE,0x8BBF232D,0x76AC4C87,0xE8CE10B3,0xA9AEDB50,
+	/* T[10] */
+	0x464D860B,0x7FA7226D,0x51C90FB6,0xA9869B10,0xC69B0C1B,0xD6484723,0x1B6CE7C5,0x40844D7D,
+	0x2633B8B4,0x0DAA9F59,0xC1716B7A,0x27B5A551,0x921CC78C,0xF7270397,0xA7288D2E,0x634E3129,
+	/* T[11] */
+	0xDAE16835,0xC41AF9B7,0xF7AF1AE7,0x0106E60A,0xC0425B7E,0x4D5E75C1,0x873DA322,0x4E57827E,
+	0xD05EAE24,0x1FD4C6E7,0xFFBB0413,0xFFFDBAE8,0xCC7DB4D9,0xE942CFB0,0xA19B1831,0x66656771,
+	/* T[12] */
+	0x5D036581,0x29FDA7B8,0x8AD6FF4B,0xF3C0A003,0x60A9BCC5,0x5889A331,0x7BA3B0E0,0x570A7115,
+	0x70C2D3B3,0xE1BFDA39,0xF32CFEEB,0x59785976,0x65426AE5,0x4292FCC6,0x1B6AD98E,0x5C328335,
+	/* T[13] */
+	0x6A349618,0xFEEBBE97,0xE675F590,0xBF9B2E63,0xBA4931CB,0xEBCF34A5,0x7530A4B3,0x36B9B92B,
+	0xF0C7E93D,0xDECBE798,0x9084B15B,0x1909941A,0xEAC14762,0x5621B86D,0xFAEEACDC,0x2CDB3D84,
+	/* T[14] */
+	0x7B5014A0,0x4E3DD133,0x503AB89B,0x1C420E29,0x824439D5,0x87F00ADA,0x76758A63,0x4457745C,
+	0xEC17C8F4,0xB1C3DE96,0x5F11A401,0xA99497B0,0x6E19BAEB,0x6F708F15,0x6E3916CD,0x4647C193,
+	/* T[15] */
+	0xEBBD84F5,0x9DBB64D5,0x28E29BDB,0x4072C250,0xD174F239,0x6832BF26,0x72AFCB36,0x98306DDB,
+	0xF48550B3,0xADC1482B,0x11BB28C0,0x6C225BBA,0x5CE5A1AD,0x45441DC9,0x6FE6E8D4,0x7F81C1BB,
+};
+static const uint32_t ecpki_comb_base_bp256r1[2*8] = {
+	0x9ACE3262,0x3A4453BD,0xE3BD23C2,0xB9DE27E1,0xFC81B7AF,0x2C4B482F,0xCB7E57CB,0x8BD2AEB9,
+	0x2F046997,0x5C1D54C7,0x2DED8E54,0xC2774513,0x14611DC9,0x97F8461A,0xC3DAC4FD,0x547EF835
+};
+
+/* sm2: 5 teeth spaced 52 bits apart */
+static const uint32_t ecpki_comb_points_sm2[CC_ECPKI_COMB_POINTS_COUNT*2*8] = {
+	/* T[0] */
+	0xEB623871,0xACA0D99F,0x9AA7063F,0xBC4E56F5,0xF320E951,0xAFAAC90A,0x43C97E3E,0xFE4B90A4,
+	0x702BD116,0x204AF78E,0xE09D29BC,0x2200CAA5,0xCEFAFA65,0x06B582F1,0xF1A8C14C,0x7D1867B3,
+	/* T[1] */
+	0xA1976750,0x58B4630E,0x93241B3E,0xAC88CC7C,0x50531C93,0x748E0A5E,0xB635B714,0x17FFDFFD,
+	0x5F039AEC,0x0A4A30FA,0x47BC241D,0x21066C42,0x1B921201,0xBCBC7CB1,0x4BE96D94,0xD675D8D5,
+	/* T[2] */
+	0x91DE2BAD,0x4A8C6801,0xA5D2A333,0x08513285,0x4A41B739,0x9315FFD1,0x72E382BC,0x442C6B17,
+	0x79E7B6DF,0xDFB5BD01,0xCD7BF244,0xACA2C64D,0xDE69F0B1,0x94B6C043,0xE3547DC6,0xC2B5E6A3,
+	/* T[3] */
+	0xF80FBB02,0xBB00072F,0xB47C59AD,0x1E6FED56,0x848F80C4,0x5C9BF3B8,0x5DB7702B,0x32636216,
+	0x43BD984F,0xCB799A9A,0x179C58AB,0xD87C7869,0x8EE06132,0xEC6BD689,0x27FBBB4A,0xF4009287,
+	/* T[4] */
+	0xFA41F329,0x01412C92,0xE410939F,0x8591C35D,0xFC2E39F6,0x4B066765,0xC5F16B07,0x47B25383,
+	0x1DAC4FEC,0x571CBBF0,0x07DC2B3F,0x4DB84A12,0x4A76FC96,0xEF28B437,0x8AA0F6D7,0xC2FEF25F,
+	/* T[5] */
+	0x1E4691BC,0x1DC18A03,0xCCEFE559,0x8AF2301C,0x1C83C12F,0x4002E0A3,0xF7D45116,0xFBA97286,
+	0x776B5D50,0x21D44906,0x71CF1D4B,0xC2CED841,0xE1CC4F2F,0x39A1EF29,0x5BBC15DE,0xA32DC788,
+	/* T[6] */
+	0x5F56A372,0x75648C3B,0x295F44A9,0xCFD8F652,0x4B59B985,0x4A4AB09A,0x18C12CA9,0xEE2A368E,
+	0x904E248D,0xCFC1D08A,0x5AAD9B07,0x37D6BBEA,0x99655D5A,0x07C1A7C5,0x9F576099,0xAB25E597,
+	/* T[7] */
+	0xF36D9A75,0x4E4098C5,0x57090C57,0xB2BB1056,0xEA914B11,0x6108AA5F,0x637F597F,0x19209E3D,
+	0x5B0A3699,0x0676D780,0x4B14DEF7,0x61A24DB1,0xB8BB1A86,0x6F60AD86,0xE393B038,0x7CCF0C18,
+	/* T[8] */
+	0x29F78068,0x3AE9C028,0x81AAE352,0x449D8EDB,0x2B9324EE,0x2899EBB8,0x306DB5E1,0xF4256196,
+	0x8C77B61D,0x12160814,0x45B203C3,0xC8AFE6C6,0xF3384D1D,0x1B449A26,0x9BA8839F,0x01444E3D,
+	/* T[9] */
+	0x5359FFE4,0x4C19A43A,0x6D7A66B6,0x0C800638,0x7B83DA34,0x6BC94F95,0x3BD2AE38,0x38DE1E9C,
+	0x94DF142B,0x2A7C7945,0x453CD14F,0x803DB1EE,0x8B80B0B0,0x483B5ACD,0xF1DAF330,0x4FCA3BE7,
+	/* T[10] */
+	0x62E807FC,0xE926A032,0x3F82250C,0x09D32624,0xEA931715,0x47AC23AA,0x3BD57075,0x3A6C4571,
+	0x083343F4,0x89F1773D,0x2F15B864,0xB7FAC9AC,0xDD2EDA6D,0x55FF2670,0x1EDBB0E9,0xEF4D1469,
+	/* T[11] */
+	0x79071BB0,0x2EAB7080,0x151AC025,0x13F2BDE1,0x6405BB92,0xD1EB5D95,0xAEE2528E,0xA6067FE8,
+	0x636AF02F,0x14168D0F,0x2B1074BE,0x9815A6A5,0xE16C5907,0x23D32982,0xE993094F,0x3A189525,
+	/* T[12] */
+	0x9CB8A636,0x7ABC5AC2,0x49E49263,0xDF668B55,0x15CD6596,0x9FF8D119,0x86441DE2,0x57DC60E2,
+	0x5F62BA37,0x4F0CD686,0xFFD0800C,0x263DE536,0x728042BF,0x57C6B554,0xDD111103,0x4254CC3C,
+	/* T[13] */
+	0x37CC4400,0x186BF0CC,0x474BDFF0,0x1CEFA9DC,0xA6A01933,0xE43417E5,0x9EEFBC38,0x29988B09,
+	0xB72997F9,0xC4B286F4,0x96E4454A,0xD06451A7,0xFD7019E2,0xF8966855,0x005D524A,0x227C1D24,
+	/* T[14] */
+	0xD0B2DE15,0x8770A7DD,0x18D90AE0,0x3577EEA3,0x5E8626F6,0xB92C3779,0x2CAD3F4B,0x7D29C0AA,
+	0x1F6B77FF,0x540B9487,0x0D371CD9,0xEC51277F,0x1741153A,0xC7FDBFAE,0xDA76F799,0xC8BC3B7B,
+	/* T[15] */
+	0xDF1CF2D5,0x406F5B44,0x82E646C8,0x8E4B0C42,0xEF7B16EC,0x893221E5,0xAE76E93F,0x282389BE,
+	0x1D0CA406,0xCC23FDBC,0x0ADFB4A8,0x1CC7E935,0x3C09EAC9,0xE14F2481,0x710E14B7,0xC9032EEA,
+};
+static const uint32_t ecpki_comb_base_sm2[2*8] = {
+	0x334C74C7,0x715A4589,0xF2660BE1,0x8FE30BBF,0x6A39C994,0x5F990446,0x1F198119,0x32C4AE2C,
+	0x2139F0A0,0x02DF32E5,0xC62A4740,0xD0A9877C,0x6B692153,0x59BDCEE3,0xF4F6779C,0xBC3736A2
+};
+
+static const CCEcpkiCombTable_t ecpki_comb_tables[] = {
+	{CC_ECPKI_DomainID_secp192k1, 6, 39, ecpki_comb_base_secp192k1, ecpki_comb_points_secp192k1},
+	{CC_ECPKI_DomainID_secp192r1, 6, 39, ecpki_comb_base_secp192r1, ecpki_comb_points_secp192r1},
+	{CC_ECPKI_DomainID_secp224k1, 7, 45, ecpki_comb_base_secp224k1, ecpki_comb_points_secp224k1},
+	{CC_ECPKI_DomainID_secp224r1, 7, 45, ecpki_comb_base_secp224r1, ecpki_comb_points_secp224r1},
+	{CC_ECPKI_DomainID_secp256k1, 8, 52, ecpki_comb_base_secp256k1, ecpki_comb_points_secp256k1},
+	{CC_ECPKI_DomainID_secp256r1, 8, 52, ecpki_comb_base_secp256r1, ecpki_comb_points_secp256r1},
+	{CC_ECPKI_DomainID_secp384r1, 12, 77, ecpki_comb_base_secp384r1, ecpki_comb_points_secp384r1},
+	{CC_ECPKI_DomainID_secp521r1, 17, 105, ecpki_comb_base_secp521r1, ecpki_comb_points_secp521r1},
+	{CC_ECPKI_DomainID_bp256r1, 8, 52, ecpki_comb_base_bp256r1, ecpki_comb_points_bp256r1},
+	{CC_ECPKI_DomainID_sm2, 8, 52, ecpki_comb_base_sm2, ecpki_comb_points_sm2},
+};
+
+
+/**
+ @brief    the function returns the comb table of the domain generator, if the domain is a
+		library domain with an unmodified generator; otherwise returns NULL
+ @return   return comb table pointer or NULL
+
+*/
+const CCEcpkiCombTable_t *CC_EcpkiGetCombTable(const CCEcpkiDomain_t *pDomain)
+{
+	uint32_t i;
+	const CCEcpkiCombTable_t *pTable;
+
+	for (i = 0; i < sizeof(ecpki_comb_tables)/sizeof(ecpki_comb_tables[0]); i++) {
+		pTable = &ecpki_comb_tables[i];
+		if (pTable->domainId != pDomain->DomainID) {
+			continue;
+		}
+		if ((CC_PalMemCmp(pTable->pBase, pDomain->ecGx, pTable->modSizeInWords*sizeof(uint32_t)) != 0) ||
+		    (CC_PalMemCmp(pTable->pBase + pTable->modSizeInWords, pDomain->ecGy,
+				  pTable->modSizeInWords*sizeof(uint32_t)) != 0)) {
+			return NULL;
+		}
+		return pTable;
+	}
+	return NULL;
+}
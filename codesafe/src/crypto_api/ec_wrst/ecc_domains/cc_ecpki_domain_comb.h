@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef CC_ECPKI_DOMAIN_COMB_H
+#define CC_ECPKI_DOMAIN_COMB_H
+
+/*
+ * All the includes that are needed for code using this module to
+ * compile correctly should be #included here.
+ */
+#include "cc_pal_types.h"
+#include "cc_ecpki_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* count of comb teeth, i.e. of scalar bits combined into one table index */
+#define CC_ECPKI_COMB_TEETH_COUNT   5
+/* count of points in the comb table */
+#define CC_ECPKI_COMB_POINTS_COUNT  (1UL << (CC_ECPKI_COMB_TEETH_COUNT - 1))
+
+/* Fixed-base comb table of the generator of a library EC domain.
+   Entry u holds the affine point (1 + sum_{j=1..teeth-1} (2*u_j - 1) * 2^(j*spacing)) * G,
+   where u_j is bit (j-1) of u; coordinates are in little endian order of words */
+typedef struct {
+	CCEcpkiDomainID_t	domainId;
+	/* size of each point coordinate in words */
+	uint32_t		modSizeInWords;
+	/* distance in bits between the comb teeth */
+	uint32_t		teethSpacing;
+	/* generator the table is built for: Gx, Gy */
+	const uint32_t		*pBase;
+	/* CC_ECPKI_COMB_POINTS_COUNT points: x, y */
+	const uint32_t		*pPoints;
+} CCEcpkiCombTable_t;
+
+/**
+ @brief    the function returns the comb table of the domain generator, if the domain is a
+		library domain with an unmodified generator; otherwise returns NULL
+ @return   return comb table pointer or NULL
+
+*/
+const CCEcpkiCombTable_t *CC_EcpkiGetCombTable(const CCEcpkiDomain_t *pDomain);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -62,6 +62,8 @@ CEXPORT_C CCError_t SbEcdsaVerify(uint32_t *pPublX, uint32_t *pPublY,
     EcWrstDomain_t *llfBuff = 0;
     int32_t modSizeInBits, modSizeInWords, ordSizeInBits, ordSizeInWords;
     uint32_t pkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+    /* the API has no caller buffer */
+    uint32_t tempBuff[EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS];
 
     /* The function should refuse to operate if the secure disable bit is set */
     CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
@@ -123,7 +125,7 @@ CEXPORT_C CCError_t SbEcdsaVerify(uint32_t *pPublX, uint32_t *pPublY,
     PkaCopyDataIntoPkaReg(ECC_REG_EC_A, 1, domain->ecA, modSizeInWords);
 
     /* Verify */
-    err = PkaEcdsaVerify();
+    err = PkaEcdsaVerify(domain, tempBuff);
 
     PkaFinishAndMutexUnlock(pkaReqRegs);
 
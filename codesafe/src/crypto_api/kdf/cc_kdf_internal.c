@@ -109,6 +109,9 @@ ISO/IEC 18033-2 standard.</li></ul>
 The purpose of this function is to derive a keying data from the shared secret value and some
 other optional shared information, included in OtherInfo (SharedInfo).
 
+Except for the NIST 56A mode, the data hashed before the counter is the same for all output blocks:
+it is hashed once, and the hash state is copied for each block.
+
 \note All buffers arguments are represented in Big-Endian format.
 
 @return CC_OK on success.
@@ -160,9 +163,13 @@ CCError_t  kdfKeyDerivFunc(
 #ifdef USE_MBEDTLS_CRYPTOCELL
     const mbedtls_md_info_t *md_info = NULL;
     mbedtls_md_context_t ctx;
+    mbedtls_md_context_t prefixCtx;
 #else
     CCHashUserContext_t  ctx;
+    CCHashUserContext_t  prefixCtx;
 #endif
+    /* On NIST 56A mode the counter is hashed first, and there is no common prefix to the blocks */
+    CCBool_t isCounterFirst;
 
     CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
 
@@ -198,6 +205,15 @@ CCError_t  kdfKeyDerivFunc(
         pOtherInfo = NULL;
     }
 
+    isCounterFirst = (derivMode == CC_KDF_NIST56A_ConcatDerivMode) ? CC_TRUE : CC_FALSE;
+
+    /* On ASN1 mode the AlgorithmID is a part of the prefix */
+    if (derivMode == CC_KDF_ASN1_DerivMode) {
+        fromKdfMode = CC_KDF_PARTY_U_INFO;
+    } else {
+        fromKdfMode = CC_KDF_ALGORITHM_ID;
+    }
+
     /* Get HASH parameters according to current operation modes */
     /*----------------------------------------------------------*/
     if (((error = KdfGetHashParameters(kdfHashMode, &hashMode, &hashBlockSize, &hashOutputSize)) != CC_OK)) {
@@ -215,11 +231,45 @@ CCError_t  kdfKeyDerivFunc(
         goto End;
     }
     mbedtls_md_init(&ctx);
+    mbedtls_md_init(&prefixCtx);
     if (((error = mbedtls_md_setup(&ctx, md_info, 0)) != CC_OK)) {
         goto End;
     }
+    if (((error = mbedtls_md_setup(&prefixCtx, md_info, 0)) != CC_OK)) {
+        goto End;
+    }
+#endif
+
+    /* ********  Hashing of the prefix, common to all blocks ********* */
+    /* The data preceding the counter (ZZ, and the AlgorithmID on ASN1 mode) is the same
+       in all blocks: it is hashed once, and each block continues from a copy of the
+       intermediate hash state. */
+    if (isCounterFirst == CC_FALSE) {
+#ifdef USE_MBEDTLS_CRYPTOCELL
+        if (((error = mbedtls_md_starts(&prefixCtx)) != CC_OK)) {
+            goto End;
+        }
+#else
+        if (((error = CC_HashInit(&prefixCtx, hashMode)) != CC_OK)) {
+            goto End;
+        }
 #endif
 
+        /*.... Hashing of the shared secret value ....*/
+        if (((error = HASH_UPDATE_FUNC(&prefixCtx, pZzSecret, zzSecretSize)) != CC_OK)) {
+            goto End;
+        }
+
+        /*.... Hashing of the AlgorithmID (on ASN1 Derivation Mode only) ....*/
+        if (derivMode == CC_KDF_ASN1_DerivMode) {
+            if (((error = HASH_UPDATE_FUNC(&prefixCtx,
+                                           pOtherInfo->dataPointers[CC_KDF_ALGORITHM_ID],
+                                           pOtherInfo->dataSizes[CC_KDF_ALGORITHM_ID])) != CC_OK)) {
+                goto End;
+            }
+        }
+    }
+
     /* **********  Keying data derivation loop ************ */
 
     for (i = 0; i < countOfHashBlocks; i++) {
@@ -234,46 +284,38 @@ CCError_t  kdfKeyDerivFunc(
         counter = CC_COMMON_REVERSE32(counter);
 #endif
 
-        /*.... HASH Init function .....*/
+        if (isCounterFirst == CC_TRUE) {
+            /*.... HASH Init function .....*/
 #ifdef USE_MBEDTLS_CRYPTOCELL
-        if (((error = mbedtls_md_starts(&ctx)) != CC_OK)) {
-            goto End;
-        }
+            if (((error = mbedtls_md_starts(&ctx)) != CC_OK)) {
+                goto End;
+            }
 #else
-        if (((error = CC_HashInit(&ctx, hashMode)) != CC_OK)) {
-            goto End;
-        }
+            if (((error = CC_HashInit(&ctx, hashMode)) != CC_OK)) {
+                goto End;
+            }
 #endif
 
-        /*....... Hashing input data by calling HASH_Update function .......*/
-        /*------------------------------------------------------------------*/
-
-        /*  On CC_KDF_NIST56A_ConcatDerivMode: first Hash of the counter    */
-        if(derivMode == CC_KDF_NIST56A_ConcatDerivMode) {
+            /*  On CC_KDF_NIST56A_ConcatDerivMode: first Hash of the counter    */
             if (((error = HASH_UPDATE_FUNC(&ctx, (uint8_t * )&counter, sizeof(uint32_t))) != CC_OK)) {
                 goto End;
             }
-        }
 
-        /*.... Hashing of the shared secret value ....*/
-        if (((error = HASH_UPDATE_FUNC(&ctx, pZzSecret, zzSecretSize)) != CC_OK)) {
-            goto End;
-        }
-
-        /*.... Hashing of the AlgorithmID (on ASN1 Derivation Mode only) ....*/
-        if (derivMode == CC_KDF_ASN1_DerivMode) {
-            if (((error = HASH_UPDATE_FUNC(&ctx,
-                                           pOtherInfo->dataPointers[CC_KDF_ALGORITHM_ID],
-                                           pOtherInfo->dataSizes[CC_KDF_ALGORITHM_ID])) != CC_OK)) {
+            /*.... Hashing of the shared secret value ....*/
+            if (((error = HASH_UPDATE_FUNC(&ctx, pZzSecret, zzSecretSize)) != CC_OK)) {
                 goto End;
             }
-            fromKdfMode = CC_KDF_PARTY_U_INFO;
         } else {
-            fromKdfMode = CC_KDF_ALGORITHM_ID;
-        }
+            /*.... Continue from the hashed prefix ....*/
+#ifdef USE_MBEDTLS_CRYPTOCELL
+            if (((error = mbedtls_md_clone(&ctx, &prefixCtx)) != CC_OK)) {
+                goto End;
+            }
+#else
+            CC_PalMemCopy(&ctx, &prefixCtx, sizeof(CCHashUserContext_t));
+#endif
 
-        /*.... Hashing of the blocks counter ....*/
-        if(derivMode != CC_KDF_NIST56A_ConcatDerivMode) {
+            /*.... Hashing of the blocks counter ....*/
             if (((error = HASH_UPDATE_FUNC(&ctx, (uint8_t * )&counter, sizeof(uint32_t))) != CC_OK)) {
                 goto End;
             }
@@ -320,9 +362,11 @@ End:
 #ifdef USE_MBEDTLS_CRYPTOCELL
         if(md_info != NULL){
                 mbedtls_md_free(&ctx);
+                mbedtls_md_free(&prefixCtx);
         }
 #endif
         CC_PalMemSetZero(&ctx, sizeof(ctx));
+        CC_PalMemSetZero(&prefixCtx, sizeof(prefixCtx));
 
     return error;
 
@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/************* Include Files ****************/
+#include "cc_pal_types.h"
+#include "cc_pal_mem.h"
+#include "cc_pal_mutex.h"
+#include "cc_pal_abort.h"
+#include "cc_rsa_kg.h"
+#include "cc_ecpki_kg.h"
+#include "cc_keypool.h"
+#include "cc_keypool_error.h"
+#include "cc_keypool_local.h"
+
+
+/************************ Defines *******************************/
+
+/************************ macros ********************************/
+
+#define KEYPOOL_LOCK()                                                  \
+    do {                                                                \
+        if (CC_PalMutexLock(&CCKeyPoolMutex, CC_INFINITE) != CC_SUCCESS) { \
+            CC_PalAbort("Fail to acquire mutex\n");                     \
+        }                                                               \
+    } while (0)
+
+#define KEYPOOL_UNLOCK()                                                \
+    do {                                                                \
+        if (CC_PalMutexUnlock(&CCKeyPoolMutex) != CC_SUCCESS) {         \
+            CC_PalAbort("Fail to release mutex\n");                     \
+        }                                                               \
+    } while (0)
+
+/*********************** Global data  ***************************/
+
+extern CC_PalMutex CCKeyPoolMutex;
+extern CC_PalMutex CCAsymCryptoMutex;
+
+/* the registered pools, protected by CCKeyPoolMutex */
+static CCKeyPool_t *g_pKeyPoolList = NULL;
+/* count of the running refills, protected by CCKeyPoolMutex */
+static uint32_t g_keyPoolRefillsCount = 0;
+
+/******************************************************************************************/
+/************************         Private Functions          ******************************/
+/******************************************************************************************/
+
+/* checks the pool pointer and validation tag; called with CCKeyPoolMutex held */
+static CCError_t KeyPoolCheck(CCKeyPool_t *pPool)
+{
+    if (pPool == NULL) {
+        return CC_KEYPOOL_INVALID_POOL_POINTER_ERROR;
+    }
+    if (pPool->validTag != CC_KEYPOOL_VALIDATION_TAG) {
+        return CC_KEYPOOL_INVALID_POOL_ERROR;
+    }
+    return CC_OK;
+}
+
+/* removes the pool from the registered pools; called with CCKeyPoolMutex held */
+static void KeyPoolUnregister(CCKeyPool_t *pPool)
+{
+    CCKeyPool_t **ppLink = &g_pKeyPoolList;
+
+    while (*ppLink != NULL) {
+        if (*ppLink == pPool) {
+            *ppLink = pPool->pNext;
+            break;
+        }
+        ppLink = &(*ppLink)->pNext;
+    }
+}
+
+/* zeroizes the slots and the pool structure; called with CCKeyPoolMutex held.
+   The slot reserved by a running refill is still used by the key generation,
+   the refill zeroizes it when it finds the pool terminated. */
+static void KeyPoolZeroize(CCKeyPool_t *pPool)
+{
+    uint32_t i;
+    uint32_t reservedIdx = (pPool->readIdx + pPool->keysCount) % pPool->slotsCount;
+
+    for (i = 0; i < pPool->slotsCount; i++) {
+        if ((pPool->isRefilling) && (i == reservedIdx)) {
+            continue;
+        }
+        CC_PalMemSetZero(&pPool->pSlots[i], sizeof(CCKeyPoolSlot_t));
+    }
+    CC_PalMemSetZero(pPool, sizeof(CCKeyPool_t));
+}
+
+/* generates one key pair of the pool algorithm into the slot */
+static CCError_t KeyPoolGenerate(CCKeyPool_t *pPool,
+                                 CCKeyPoolSlot_t *pSlot,
+                                 CCRndGenerateVectWorkFunc_t f_rng,
+                                 void *p_rng,
+                                 CCKeyPoolTempData_t *pTempData)
+{
+    switch (pPool->alg) {
+#ifndef _INTERNAL_CC_NO_RSA_KG_SUPPORT
+    case CC_KEYPOOL_ALG_RSA:
+        return CC_RsaKgKeyPairGenerate(f_rng, p_rng,
+                                       pPool->pubExp, pPool->pubExpSizeInBytes,
+                                       pPool->keySizeInBits,
+                                       &pSlot->rsa.privKey, &pSlot->rsa.pubKey,
+                                       &pTempData->rsaKgData, NULL);
+    case CC_KEYPOOL_ALG_RSA_CRT:
+        return CC_RsaKgKeyPairCrtGenerate(f_rng, p_rng,
+                                          pPool->pubExp, pPool->pubExpSizeInBytes,
+                                          pPool->keySizeInBits,
+                                          &pSlot->rsa.privKey, &pSlot->rsa.pubKey,
+                                          &pTempData->rsaKgData, NULL);
+#endif
+    case CC_KEYPOOL_ALG_ECPKI:
+        return CC_EcpkiKeyPairGenerate(f_rng, p_rng, pPool->pDomain,
+                                       &pSlot->ecpki.privKey, &pSlot->ecpki.pubKey,
+                                       &pTempData->ecpkiKgData, NULL);
+    default:
+        return CC_KEYPOOL_IS_NOT_SUPPORTED;
+    }
+}
+
+/* takes the oldest key out of the pool: the copy and the slot zeroization
+   have a fixed size, so the time does not depend on the pool state */
+static CCError_t KeyPoolGet(CCKeyPool_t *pPool, uint32_t isEcpki, void *pPrivKey, void *pPubKey)
+{
+    CCError_t err;
+    CCKeyPoolSlot_t *pSlot;
+
+    if (pPool == NULL) {
+        return CC_KEYPOOL_INVALID_POOL_POINTER_ERROR;
+    }
+
+    KEYPOOL_LOCK();
+
+    err = KeyPoolCheck(pPool);
+    if (err != CC_OK) {
+        goto End;
+    }
+    if ((pPool->alg == CC_KEYPOOL_ALG_ECPKI) != isEcpki) {
+        err = CC_KEYPOOL_ALGORITHM_MISMATCH_ERROR;
+        goto End;
+    }
+    if (pPool->keysCount == 0) {
+        err = CC_KEYPOOL_EMPTY_ERROR;
+        goto End;
+    }
+
+    pSlot = &pPool->pSlots[pPool->readIdx];
+    if (isEcpki) {
+        CC_PalMemCopy(pPrivKey, &pSlot->ecpki.privKey, sizeof(CCEcpkiUserPrivKey_t));
+        CC_PalMemCopy(pPubKey, &pSlot->ecpki.pubKey, sizeof(CCEcpkiUserPublKey_t));
+    } else {
+        CC_PalMemCopy(pPrivKey, &pSlot->rsa.privKey, sizeof(CCRsaUserPrivKey_t));
+        CC_PalMemCopy(pPubKey, &pSlot->rsa.pubKey, sizeof(CCRsaUserPubKey_t));
+    }
+    CC_PalMemSetZero(pSlot, sizeof(CCKeyPoolSlot_t));
+
+    pPool->readIdx = (pPool->readIdx + 1) % pPool->slotsCount;
+    pPool->keysCount--;
+
+End:
+    KEYPOOL_UNLOCK();
+    return err;
+}
+
+/******************************************************************************************/
+/************************         Public Functions           ******************************/
+/******************************************************************************************/
+
+/**
+   @brief CC_KeyPoolInit initializes an empty key pool and registers it, so that
+          its keys are zeroized by CC_LibFini.
+
+   @param [out] pPool - Pointer to the pool.
+   @param [in] alg - The key algorithm.
+   @param [in] pPubExp - RSA only: pointer to the public exponent.
+   @param [in] pubExpSizeInBytes - RSA only: the public exponent size in bytes.
+   @param [in] keySizeInBits - RSA only: the key size in bits.
+   @param [in] pDomain - EC only: pointer to the EC domain.
+   @param [in] pSlots - Pointer to the key slots.
+   @param [in] slotsCount - The count of slots.
+
+   @return CCError_t - CC_OK, or error code as defined in cc_keypool_error.h
+*/
+CEXPORT_C CCError_t CC_KeyPoolInit(CCKeyPool_t *pPool,
+                                   CCKeyPoolAlg_t alg,
+                                   const uint8_t *pPubExp,
+                                   size_t pubExpSizeInBytes,
+                                   size_t keySizeInBits,
+                                   const CCEcpkiDomain_t *pDomain,
+                                   CCKeyPoolSlot_t *pSlots,
+                                   uint32_t slotsCount)
+{
+    CCError_t err = CC_OK;
+    CCKeyPool_t *pItem;
+
+    if (pPool == NULL) {
+        return CC_KEYPOOL_INVALID_POOL_POINTER_ERROR;
+    }
+    if (pSlots == NULL) {
+        return CC_KEYPOOL_INVALID_ARGUMENT_POINTER_ERROR;
+    }
+    if (slotsCount == 0) {
+        return CC_KEYPOOL_INVALID_SLOTS_COUNT_ERROR;
+    }
+
+    switch (alg) {
+    case CC_KEYPOOL_ALG_RSA:
+    case CC_KEYPOOL_ALG_RSA_CRT:
+        if (pPubExp == NULL) {
+            return CC_KEYPOOL_INVALID_ARGUMENT_POINTER_ERROR;
+        }
+        if ((pubExpSizeInBytes == 0) ||
+            (pubExpSizeInBytes > CC_KEYPOOL_PUB_EXP_MAX_SIZE_IN_BYTES) ||
+            (keySizeInBits < CC_RSA_MIN_VALID_KEY_SIZE_VALUE_IN_BITS) ||
+            (keySizeInBits > CC_RSA_MAX_KEY_GENERATION_SIZE_BITS) ||
+            (keySizeInBits % CC_RSA_VALID_KEY_SIZE_MULTIPLE_VALUE_IN_BITS)) {
+            return CC_KEYPOOL_INVALID_ARGUMENT_SIZE_ERROR;
+        }
+        break;
+    case CC_KEYPOOL_ALG_ECPKI:
+        if (pDomain == NULL) {
+            return CC_KEYPOOL_INVALID_ARGUMENT_POINTER_ERROR;
+        }
+        break;
+    default:
+        return CC_KEYPOOL_INVALID_ALGORITHM_ERROR;
+    }
+
+    KEYPOOL_LOCK();
+
+    /* the pool must not be registered yet */
+    for (pItem = g_pKeyPoolList; pItem != NULL; pItem = pItem->pNext) {
+        if (pItem == pPool) {
+            err = CC_KEYPOOL_INVALID_POOL_ERROR;
+            goto End;
+        }
+    }
+
+    CC_PalMemSetZero(pPool, sizeof(CCKeyPool_t));
+    CC_PalMemSetZero(pSlots, slotsCount*sizeof(CCKeyPoolSlot_t));
+    pPool->alg = alg;
+    if (alg == CC_KEYPOOL_ALG_ECPKI) {
+        pPool->pDomain = pDomain;
+    } else {
+        CC_PalMemCopy(pPool->pubExp, pPubExp, pubExpSizeInBytes);
+        pPool->pubExpSizeInBytes = pubExpSizeInBytes;
+        pPool->keySizeInBits = keySizeInBits;
+    }
+    pPool->pSlots = pSlots;
+    pPool->slotsCount = slotsCount;
+    pPool->validTag = CC_KEYPOOL_VALIDATION_TAG;
+
+    pPool->pNext = g_pKeyPoolList;
+    g_pKeyPoolList = pPool;
+
+End:
+    KEYPOOL_UNLOCK();
+    return err;
+}
+
+/**
+   @brief CC_KeyPoolRefill generates keys into the free slots of the pool, while the PKA
+          is idle.
+
+   The next free slot is reserved under the pool mutex, the key is generated into it
+   without the mutex, and is published by incrementing the keys count. Keys taken by
+   CC_KeyPoolGet meanwhile do not move the reserved slot: it follows the last key.
+   A key is started only if the PKA mutex is free when probed, otherwise the refill stops.
+   The probe is not a reservation: a foreground PKA operation that starts after it waits
+   for the PKA session of the key generation in progress (e.g. a whole prime search).
+   If the pool is terminated by CC_LibFini meanwhile, the key generated into the reserved
+   slot is zeroized and the refill stops with CC_KEYPOOL_INVALID_POOL_ERROR; CC_LibFini
+   waits for the refill to return before it releases the pool mutex.
+
+   @param [in/out] pPool - Pointer to the pool.
+   @param [in] f_rng - Pointer to DRBG function.
+   @param [in/out] p_rng - Pointer to the random context - the input to f_rng.
+   @param [in] pTempData - Temporary buffers for internal use.
+   @param [in] maxKeysCount - Maximal count of keys to generate.
+   @param [out] pGeneratedCount - The count of generated keys, may be NULL.
+
+   @return CCError_t - CC_OK, or error code as defined in cc_keypool_error.h,
+                       cc_rsa_error.h or cc_ecpki_error.h
+*/
+CEXPORT_C CCError_t CC_KeyPoolRefill(CCKeyPool_t *pPool,
+                                     CCRndGenerateVectWorkFunc_t f_rng,
+                                     void *p_rng,
+                                     CCKeyPoolTempData_t *pTempData,
+                                     uint32_t maxKeysCount,
+                                     uint32_t *pGeneratedCount)
+{
+    CCError_t err;
+    CCKeyPoolSlot_t *pSlot;
+    CCKeyPool_t params;
+    uint32_t generated = 0;
+
+    if (pGeneratedCount != NULL) {
+        *pGeneratedCount = 0;
+    }
+    if (pPool == NULL) {
+        return CC_KEYPOOL_INVALID_POOL_POINTER_ERROR;
+    }
+    if ((f_rng == NULL) || (pTempData == NULL)) {
+        return CC_KEYPOOL_INVALID_ARGUMENT_POINTER_ERROR;
+    }
+
+    KEYPOOL_LOCK();
+    err = KeyPoolCheck(pPool);
+    if ((err == CC_OK) && (pPool->isRefilling)) {
+        err = CC_KEYPOOL_BUSY_ERROR;
+    }
+    if (err == CC_OK) {
+        pPool->isRefilling = 1;
+        g_keyPoolRefillsCount++;
+        /* the key parameters are used without the mutex, while the pool may be zeroized */
+        CC_PalMemCopy(&params, pPool, sizeof(CCKeyPool_t));
+    }
+    KEYPOOL_UNLOCK();
+    if (err != CC_OK) {
+        return err;
+    }
+
+    while (generated < maxKeysCount) {
+        KEYPOOL_LOCK();
+        err = KeyPoolCheck(pPool);
+        if ((err != CC_OK) || (pPool->keysCount == pPool->slotsCount)) {
+            KEYPOOL_UNLOCK();
+            break;
+        }
+        pSlot = &pPool->pSlots[(pPool->readIdx + pPool->keysCount) % pPool->slotsCount];
+        KEYPOOL_UNLOCK();
+
+        /* start a key only while no other operation uses the PKA */
+        if (CC_PalMutexLock(&CCAsymCryptoMutex, 0) != CC_SUCCESS) {
+            break;
+        }
+        if (CC_PalMutexUnlock(&CCAsymCryptoMutex) != CC_SUCCESS) {
+            CC_PalAbort("Fail to release mutex\n");
+        }
+
+        err = KeyPoolGenerate(&params, pSlot, f_rng, p_rng, pTempData);
+
+        KEYPOOL_LOCK();
+        /* the pool may have been terminated while the key was generated */
+        if ((err == CC_OK) && (KeyPoolCheck(pPool) != CC_OK)) {
+            err = CC_KEYPOOL_INVALID_POOL_ERROR;
+        }
+        if (err == CC_OK) {
+            pPool->keysCount++;
+        } else {
+            CC_PalMemSetZero(pSlot, sizeof(CCKeyPoolSlot_t));
+        }
+        KEYPOOL_UNLOCK();
+        if (err != CC_OK) {
+            break;
+        }
+        generated++;
+    }
+
+    CC_PalMemSetZero(pTempData, sizeof(CCKeyPoolTempData_t));
+    CC_PalMemSetZero(&params, sizeof(CCKeyPool_t));
+
+    KEYPOOL_LOCK();
+    if (KeyPoolCheck(pPool) == CC_OK) {
+        pPool->isRefilling = 0;
+    }
+    /* the last access to the pool mutex: KeyPoolTerminateAll waits for it */
+    g_keyPoolRefillsCount--;
+    KEYPOOL_UNLOCK();
+
+    if (pGeneratedCount != NULL) {
+        *pGeneratedCount = generated;
+    }
+    return err;
+}
+
+/**
+   @brief CC_KeyPoolGetRsa takes the oldest RSA key pair out of the pool.
+
+   @param [in/out] pPool - Pointer to an RSA pool.
+   @param [out] pUserPrivKey - Pointer to the private key structure.
+   @param [out] pUserPubKey - Pointer to the public key structure.
+
+   @return CCError_t - CC_OK, or error code as defined in cc_keypool_error.h
+*/
+CEXPORT_C CCError_t CC_KeyPoolGetRsa(CCKeyPool_t *pPool,
+                                     CCRsaUserPrivKey_t *pUserPrivKey,
+                                     CCRsaUserPubKey_t *pUserPubKey)
+{
+    if ((pUserPrivKey == NULL) || (pUserPubKey == NULL)) {
+        return CC_KEYPOOL_INVALID_ARGUMENT_POINTER_ERROR;
+    }
+
+    return KeyPoolGet(pPool, CC_FALSE, pUserPrivKey, pUserPubKey);
+}
+
+/**
+   @brief CC_KeyPoolGetEcpki takes the oldest EC key pair out of the pool.
+
+   @param [in/out] pPool - Pointer to an EC pool.
+   @param [out] pUserPrivKey - Pointer to the private key structure.
+   @param [out] pUserPublKey - Pointer to the public key structure.
+
+   @return CCError_t - CC_OK, or error code as defined in cc_keypool_error.h
+*/
+CEXPORT_C CCError_t CC_KeyPoolGetEcpki(CCKeyPool_t *pPool,
+                                       CCEcpkiUserPrivKey_t *pUserPrivKey,
+                                       CCEcpkiUserPublKey_t *pUserPublKey)
+{
+    if ((pUserPrivKey == NULL) || (pUserPublKey == NULL)) {
+        return CC_KEYPOOL_INVALID_ARGUMENT_POINTER_ERROR;
+    }
+
+    return KeyPoolGet(pPool, CC_TRUE, pUserPrivKey, pUserPublKey);
+}
+
+/**
+   @brief CC_KeyPoolLevelGet returns the count of keys held by the pool.
+
+   @param [in] pPool - Pointer to the pool.
+   @param [out] pKeysCount - The count of keys.
+
+   @return CCError_t - CC_OK, or error code as defined in cc_keypool_error.h
+*/
+CEXPORT_C CCError_t CC_KeyPoolLevelGet(CCKeyPool_t *pPool, uint32_t *pKeysCount)
+{
+    CCError_t err;
+
+    if (pPool == NULL) {
+        return CC_KEYPOOL_INVALID_POOL_POINTER_ERROR;
+    }
+    if (pKeysCount == NULL) {
+        return CC_KEYPOOL_INVALID_ARGUMENT_POINTER_ERROR;
+    }
+
+    KEYPOOL_LOCK();
+    err = KeyPoolCheck(pPool);
+    if (err == CC_OK) {
+        *pKeysCount = pPool->keysCount;
+    }
+    KEYPOOL_UNLOCK();
+    return err;
+}
+
+/**
+   @brief CC_KeyPoolFree zeroizes the keys of the pool and unregisters it.
+
+   @param [in/out] pPool - Pointer to the pool.
+
+   @return CCError_t - CC_OK, or error code as defined in cc_keypool_error.h
+*/
+CEXPORT_C CCError_t CC_KeyPoolFree(CCKeyPool_t *pPool)
+{
+    CCError_t err;
+
+    if (pPool == NULL) {
+        return CC_KEYPOOL_INVALID_POOL_POINTER_ERROR;
+    }
+
+    KEYPOOL_LOCK();
+    err = KeyPoolCheck(pPool);
+    if ((err == CC_OK) && (pPool->isRefilling)) {
+        err = CC_KEYPOOL_BUSY_ERROR;
+    }
+    if (err == CC_OK) {
+        KeyPoolUnregister(pPool);
+        KeyPoolZeroize(pPool);
+    }
+    KEYPOOL_UNLOCK();
+    return err;
+}
+
+void KeyPoolTerminateAll(void)
+{
+    CCKeyPool_t *pPool;
+
+    KEYPOOL_LOCK();
+    while (g_pKeyPoolList != NULL) {
+        pPool = g_pKeyPoolList;
+        g_pKeyPoolList = pPool->pNext;
+        KeyPoolZeroize(pPool);
+    }
+
+    /* the running refills stop on the zeroized pools at their next check; a key
+       generation holds the PKA mutex for each PKA session, so wait on it between checks */
+    while (g_keyPoolRefillsCount != 0) {
+        KEYPOOL_UNLOCK();
+        if (CC_PalMutexLock(&CCAsymCryptoMutex, CC_INFINITE) != CC_SUCCESS) {
+            CC_PalAbort("Fail to acquire mutex\n");
+        }
+        if (CC_PalMutexUnlock(&CCAsymCryptoMutex) != CC_SUCCESS) {
+            CC_PalAbort("Fail to release mutex\n");
+        }
+        KEYPOOL_LOCK();
+    }
+    KEYPOOL_UNLOCK();
+}
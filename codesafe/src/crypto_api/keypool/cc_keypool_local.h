@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_KEYPOOL_LOCAL_H
+#define _CC_KEYPOOL_LOCAL_H
+
+#include "cc_keypool.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/************************ Defines ******************************/
+
+/* the key pool validity TAG */
+#define CC_KEYPOOL_VALIDATION_TAG       0x4B504F4C
+
+
+/************************ Public Functions **********************/
+
+/**
+ @brief This function zeroizes the keys of all the registered pools and unregisters them.
+        It is called by CC_LibFini before the pool mutex is destroyed. Running refills
+        stop on the zeroized pools, and the function returns only after all of them
+        returned, so no refill accesses the pool mutex afterwards.
+
+ @return None
+*/
+void KeyPoolTerminateAll(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -20,6 +20,7 @@
 #include "cc_common_math.h"
 #include "cc_hal.h"
 #include "cc_int_general_defs.h"
+#include "cc_pal_perf.h"
 
 extern CC_PalMutex CCAsymCryptoMutex;
 
@@ -32,6 +33,10 @@ const int8_t regTemps[PKA_MAX_COUNT_OF_PHYS_MEM_REGS] = {PKA_REG_N, PKA_REG_NP,
         0x0C,0x0D,0x0E,0x0F,0x10,0x11,0x12,0x13,0x14,0x15,
         0x16,0x17,0x18,0x19,0x1A,0x1B,0x1C,0x1D,PKA_REG_T0,PKA_REG_T1};
 
+/* size in words of the staging buffer of the byte buffer copies: the words are byte-swapped
+   into it, and then moved into/from the PKA SRAM in one burst */
+#define PKA_SRAM_BURST_SIZE_IN_WORDS    16
+
 #if defined PKA_DEBUG && defined DEBUG
 uint32_t tempRes[PKA_MAX_REGISTER_SIZE_IN_32BIT_WORDS];
 uint32_t tempRes1[PKA_MAX_REGISTER_SIZE_IN_32BIT_WORDS];
@@ -428,6 +433,107 @@ void PkaFinishAndMutexUnlock(uint32_t pkaRegCount) /*!< [in] Number of registers
 }
 
 
+/***********     PkaSessionOpen  function     **********************/
+/**
+ * @brief This function opens a PKA session: locks the Asymmetric mutex and initializes
+ *        the PKA engine once for a run of operations of the same size.
+ *
+ *        The mutex is held until ::PkaSessionClose, so the session must be closed by the
+ *        same caller, and the run of operations should be short.
+ *
+ * @return  CC_OK On success, otherwise indicates failure
+ */
+CCError_t PkaSessionOpen(PkaSession_t *pSession,    /*!< [out] The session object. */
+			 uint32_t      sizeInBits,  /*!< [in] Operation (modulus) exact size in bits. */
+			 uint32_t     *pkaRegCount) /*!< [in/out] As input - required registers for operation.
+								 As output - actual available regs. */
+{
+        CCError_t err;
+
+        if ((pSession == NULL) || (pkaRegCount == NULL)) {
+                return PKA_ILLEGAL_PTR_ERROR;
+        }
+
+        pSession->isOpen = 0;
+        err = PkaInitAndMutexLock(sizeInBits, pkaRegCount);
+        if (err != CC_OK) {
+                return err;
+        }
+
+        pSession->isOpen = 1;
+        pSession->sizeInBits = sizeInBits;
+        pSession->regsCount = *pkaRegCount;
+        pSession->isDirty = 0;
+        pSession->pResident = NULL;
+
+        return CC_OK;
+}
+
+
+/***********     PkaSessionSelectKey  function     **********************/
+/**
+ * @brief This function selects the key of the next operation of the session.
+ *
+ *        If the constants of the key are already resident in the PKA registers the caller
+ *        may skip loading them. Otherwise the registers used by the previous operations are
+ *        cleared for security goals, and the caller must load the constants of the key.
+ *        The key is identified by its address, so the key object must not change while it is
+ *        selected. A NULL identifier is never resident.
+ *
+ * @return  CC_TRUE if the constants of the key are resident, CC_FALSE otherwise.
+ */
+CCBool_t PkaSessionSelectKey(PkaSession_t *pSession, /*!< [in/out] The session object. */
+			     const void   *pKeyId)   /*!< [in] The key identifier, or NULL. */
+{
+        if ((pKeyId != NULL) && (pKeyId == pSession->pResident)) {
+                return CC_TRUE;
+        }
+
+        if (pSession->isDirty != 0) {
+                PkaClearBlockOfRegs(PKA_REG_N/*FirstReg*/,
+                                    CC_MIN(PKA_MAX_COUNT_OF_PHYS_MEM_REGS, pSession->regsCount),
+                                    LEN_ID_MAX_BITS/*LenID*/);
+        }
+        pSession->isDirty = 1;
+        pSession->pResident = pKeyId;
+
+        return CC_FALSE;
+}
+
+
+/***********     PkaSessionInvalidate  function     **********************/
+/**
+ * @brief This function marks the resident key constants as not valid, e.g. after an
+ *        operation failed in a state that left them modified. The next selection
+ *        clears the registers and reloads the key.
+ *
+ * @return  None
+ */
+void PkaSessionInvalidate(PkaSession_t *pSession) /*!< [in/out] The session object. */
+{
+        pSession->pResident = NULL;
+}
+
+
+/***********     PkaSessionClose  function     **********************/
+/**
+ * @brief This function closes a PKA session: clears the used registers, disables the
+ *        PKA clocks and unlocks the Asymmetric mutex.
+ *
+ * @return  None
+ */
+void PkaSessionClose(PkaSession_t *pSession) /*!< [in/out] The session object. */
+{
+        if ((pSession == NULL) || (pSession->isOpen == 0)) {
+                return;
+        }
+
+        pSession->isOpen = 0;
+        pSession->pResident = NULL;
+        PkaFinishAndMutexUnlock(pSession->regsCount);
+}
+
+
 /***********      PkaSetRegsSizesTab function      **********************/
 /**
  * @brief This function initializes the PKA registers sizes table.
@@ -715,24 +821,29 @@ void PkaCopyPkaRegIntoBeByteBuff(uint8_t *dst_ptr,	 /*!< [out] Virtual address (
                             uint32_t  srcReg)    /*!< [in] Source register. */
 {
         uint32_t  currAddr;
-        uint32_t  tempWord;
-        int32_t  ii;
+        uint32_t  burstBuff[PKA_SRAM_BURST_SIZE_IN_WORDS];
+        uint32_t  burstSize;
+        uint32_t  ii, jj;
+        CCPalPerfData_t perfIdx = 0;
 
-        /* copy data from src buffer into PKA register with 0-padding  *
-        *  in the last PKA-word 				      */
+        CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_READ);
         PKA_GET_REG_ADDRESS(srcReg, currAddr);
 
         PKA_MUTEX_LOCK;
         PKA_WAIT_ON_PKA_DONE();
         CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_RADDR), currAddr);
-        for(ii = sizeWords-1; ii >= 0; ii--) {
-                WAIT_SRAM_DATA_READY;
-                tempWord = CC_HAL_READ_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_RDATA));
-                tempWord = CC_COMMON_REVERSE32(tempWord);
-                CC_PalMemCopy(&dst_ptr[ii*CC_32BIT_WORD_SIZE], (uint8_t *)&tempWord, CC_32BIT_WORD_SIZE);
+        /* read the LE words of the register in bursts, and reverse them into the BE buffer */
+        for(ii = 0; ii < sizeWords; ii += burstSize) {
+                burstSize = CC_MIN(sizeWords - ii, PKA_SRAM_BURST_SIZE_IN_WORDS);
+                PKA_HW_READ_SRAM_BLOCK(burstBuff, burstSize);
+                for(jj = 0; jj < burstSize; jj++) {
+                        burstBuff[jj] = CC_COMMON_REVERSE32(burstBuff[jj]);
+                        CC_PalMemCopy(&dst_ptr[(sizeWords-1-ii-jj)*CC_32BIT_WORD_SIZE], (uint8_t *)&burstBuff[jj], CC_32BIT_WORD_SIZE);
+                }
         }
         WAIT_SRAM_DATA_READY;
         PKA_MUTEX_UNLOCK;
+        CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_READ);
         return;
 
 }
@@ -756,9 +867,14 @@ void PkaCopyDataFromPkaReg(uint32_t *dst_ptr,	 /*!< [out] Pointer to destination
                             uint32_t  srcReg)    /*!< [in]  Virtual address (number) of source PKA register. */
 {
         uint32_t  currAddr;
+        CCPalPerfData_t perfIdx = 0;
 
+        PKI_PROF_PUSH(COPY_OUT);
+        CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_READ);
         PKA_GET_REG_ADDRESS(srcReg, currAddr/*PhysAddr*/);
         PKA_HW_READ_BLOCK_FROM_PKA_MEM(currAddr, dst_ptr, sizeWords );
+        CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_READ);
+        PKI_PROF_POP();
 
         return;
 
@@ -772,44 +888,35 @@ void PkaCopyByteBuffIntoPkaReg(uint32_t dstReg,     /*!< [out] Virtual address (
 {
         uint32_t  currAddr;
         uint32_t  regSize;
-        uint32_t  sizeWords;
-        uint32_t  tempWord;
-        uint32_t  remainBytes = size % CC_32BIT_WORD_SIZE;
-        uint32_t ii;
+        uint32_t  sizeWords = CALC_32BIT_WORDS_FROM_BYTES(size);
+        uint32_t  burstBuff[PKA_SRAM_BURST_SIZE_IN_WORDS];
+        uint32_t  burstBytes;
+        uint32_t  ii;
+        CCPalPerfData_t perfIdx = 0;
 
+        CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_LOAD);
         /* copy data from src buffer into PKA register with 0-padding  *
         *  in the last PKA-word 				      */
         PKA_GET_REG_ADDRESS(dstReg, currAddr);
-	size -= remainBytes;
+
+        /* register size in words */
+        PKA_GET_REG_SIZE(regSize, lenId);
+        regSize = CALC_FULL_32BIT_WORDS(regSize);
 
         PKA_MUTEX_LOCK;
         PKA_WAIT_ON_PKA_DONE();
         CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_ADDR), currAddr);
-        for(ii = 0; ii< size; ii+=CC_32BIT_WORD_SIZE) {
-                CC_PalMemCopy((uint8_t *)&tempWord, &src_ptr[ii], CC_32BIT_WORD_SIZE);
-                CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), tempWord);
-                WAIT_SRAM_DATA_READY;
+        for(ii = 0; ii < size; ii += burstBytes) {
+                burstBytes = CC_MIN(size - ii, PKA_SRAM_BURST_SIZE_IN_WORDS*CC_32BIT_WORD_SIZE);
+                /* 0-padding of the last partial word */
+                burstBuff[(burstBytes-1)/CC_32BIT_WORD_SIZE] = 0;
+                CC_PalMemCopy((uint8_t *)burstBuff, &src_ptr[ii], burstBytes);
+                PKA_HW_WRITE_SRAM_BLOCK(burstBuff, CALC_32BIT_WORDS_FROM_BYTES(burstBytes));
         }
-	if (remainBytes > 0) {
-		tempWord = 0;
-                CC_PalMemCopy((uint8_t *)&tempWord, &src_ptr[ii], remainBytes);
-                CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), tempWord);
-                WAIT_SRAM_DATA_READY;
-	}
+        /* zeroe the rest of the last PKA-word and not significant high words of the register */
+        PKA_HW_WRITE_SRAM_ZEROS(CC_MAX(PKA_ALIGN_TO_PKA_WORD(sizeWords), regSize) - sizeWords);
         PKA_MUTEX_UNLOCK;
-        /* data size aligned to full PKA-word */
-        sizeWords =  ((CALC_32BIT_WORDS_FROM_BYTES(size+remainBytes)+PKA_WORD_SIZE_IN_32BIT_WORDS-1)/PKA_WORD_SIZE_IN_32BIT_WORDS) * \
-                     PKA_WORD_SIZE_IN_32BIT_WORDS;
-        currAddr = currAddr + sizeWords;
-
-        /* register size in bits */
-        PKA_GET_REG_SIZE(regSize, lenId);
-        regSize = CALC_FULL_32BIT_WORDS(regSize);
-
-        /* zeroe not significant high words of the register */
-        if (regSize > sizeWords) {
-                PKA_HW_CLEAR_PKA_MEM(currAddr, regSize - sizeWords);
-        }
+        CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_LOAD);
 
         return;
 }
@@ -834,37 +941,36 @@ void PkaCopyBeByteBuffIntoPkaReg(uint32_t dstReg,      /*!< [out] Virtual addres
 {
         uint32_t  currAddr;
         uint32_t  regSize;
-        uint32_t  tempWord;
-        uint32_t  size = sizeWords*CC_32BIT_WORD_SIZE;
-        int32_t ii;
+        uint32_t  burstBuff[PKA_SRAM_BURST_SIZE_IN_WORDS];
+        uint32_t  burstSize;
+        uint32_t  ii, jj;
+        CCPalPerfData_t perfIdx = 0;
 
+        CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_LOAD);
         /* copy data from src buffer into PKA register with 0-padding  *
         *  in the last PKA-word 				      */
         PKA_GET_REG_ADDRESS(dstReg, currAddr);
 
+        /* register size in words */
+        PKA_GET_REG_SIZE(regSize, lenId);
+        regSize = CALC_FULL_32BIT_WORDS(regSize);
+
         PKA_MUTEX_LOCK;
         PKA_WAIT_ON_PKA_DONE();
         CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_ADDR), currAddr);
-        for(ii = size-CC_32BIT_WORD_SIZE; ii >= 0; ii-=CC_32BIT_WORD_SIZE) {
-                CC_PalMemCopy((uint8_t *)&tempWord, &src_ptr[ii], CC_32BIT_WORD_SIZE);
-                tempWord = CC_COMMON_REVERSE32(tempWord);
-                CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), tempWord);
-                WAIT_SRAM_DATA_READY;
+        /* reverse the BE buffer into LE words in bursts, starting from its last word */
+        for(ii = 0; ii < sizeWords; ii += burstSize) {
+                burstSize = CC_MIN(sizeWords - ii, PKA_SRAM_BURST_SIZE_IN_WORDS);
+                for(jj = 0; jj < burstSize; jj++) {
+                        CC_PalMemCopy((uint8_t *)&burstBuff[jj], &src_ptr[(sizeWords-1-ii-jj)*CC_32BIT_WORD_SIZE], CC_32BIT_WORD_SIZE);
+                        burstBuff[jj] = CC_COMMON_REVERSE32(burstBuff[jj]);
+                }
+                PKA_HW_WRITE_SRAM_BLOCK(burstBuff, burstSize);
         }
+        /* zeroe the rest of the last PKA-word and not significant high words of the register */
+        PKA_HW_WRITE_SRAM_ZEROS(CC_MAX(PKA_ALIGN_TO_PKA_WORD(sizeWords), regSize) - sizeWords);
         PKA_MUTEX_UNLOCK;
-        /* data size aligned to full PKA-word */
-        sizeWords =  ((sizeWords+PKA_WORD_SIZE_IN_32BIT_WORDS-1)/PKA_WORD_SIZE_IN_32BIT_WORDS) * \
-                     PKA_WORD_SIZE_IN_32BIT_WORDS;
-        currAddr = currAddr + sizeWords;
-
-        /* register size in bits */
-        PKA_GET_REG_SIZE(regSize, lenId);
-        regSize = CALC_FULL_32BIT_WORDS(regSize);
-
-        /* zeroe not significant high words of the register */
-        if (regSize > sizeWords) {
-                PKA_HW_CLEAR_PKA_MEM(currAddr, regSize - sizeWords);
-        }
+        CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_LOAD);
 
 #if defined PKA_DEBUG && defined DEBUG
         /*! PKA_DEBUG */
@@ -894,30 +1000,26 @@ void PkaCopyDataIntoPkaReg(uint32_t    dstReg,		/*!< [out] Virtual address (numb
 {
         uint32_t  currAddr;
         uint32_t  regSize;
+        CCPalPerfData_t perfIdx = 0;
 
-        /* copy data from src buffer into PKA register with 0-padding  *
-        *  in the last PKA-word 				      */
+        PKI_PROF_PUSH(COPY_IN);
+        CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_LOAD);
         PKA_GET_REG_ADDRESS(dstReg, currAddr);
-        PKA_HW_LOAD_BLOCK_TO_PKA_MEM(currAddr, src_ptr, sizeWords);
-
-        /* data size aligned to full PKA-word */
-        sizeWords =  ((sizeWords+PKA_WORD_SIZE_IN_32BIT_WORDS-1)/PKA_WORD_SIZE_IN_32BIT_WORDS) * \
-                     PKA_WORD_SIZE_IN_32BIT_WORDS;
-        currAddr = currAddr + sizeWords;
 
         /* register size in words */
         PKA_GET_REG_SIZE(regSize, lenId);
         regSize = CALC_FULL_32BIT_WORDS(regSize);
 
-        /* zeroe not significant high words of the register */
-        if (regSize > sizeWords) {
-                PKA_HW_CLEAR_PKA_MEM(currAddr, regSize - sizeWords);
-        }
+        /* copy data from src buffer into PKA register with 0-padding in the last PKA-word *
+        *  and in the not significant high words of the register, under one lock          */
+        PKA_HW_LOAD_BLOCK_TO_PKA_REG(currAddr, src_ptr, sizeWords, regSize);
+        CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_REG_LOAD);
 
 #if defined PKA_DEBUG && defined DEBUG
         /*! PKA_DEBUG */
         PkaCopyDataFromPkaReg(tempRes, regSize, dstReg);
 #endif
+        PKI_PROF_POP();
         return;
 }
 
@@ -959,6 +1061,14 @@ void PkaClearPkaRegWords(uint32_t    pkaReg, 		/*!< [in/out] Virtual address (nu
         PKA_GET_REG_SIZE(regSize, LEN_ID_MAX_BITS);
         regSize = CALC_FULL_32BIT_WORDS(regSize);
 
+        /* the block clearing is done by whole PKA words: clear the words up to *
+        *  the PKA word boundary one by one, so not to overrun the register     */
+        while ((regSize > addrWordOffset) && (addrWordOffset % PKA_WORD_SIZE_IN_32BIT_WORDS)) {
+                PKA_HW_LOAD_VALUE_TO_PKA_MEM(currAddr, 0);
+                currAddr++;
+                addrWordOffset++;
+        }
+
         /* zeroe not significant high words of the register */
         if (regSize > addrWordOffset) {
                 PKA_HW_CLEAR_PKA_MEM(currAddr, regSize - addrWordOffset);
@@ -1082,6 +1192,8 @@ CCError_t PkaExecFullModInv(int8_t         OpB,  /*!< [in] Operand B: virtual re
         /* virtual pointer to modulus register, by default: N=0 */
         uint8_t  N = PKA_REG_N;
 
+        PKI_PROF_PUSH(FULL_MOD_INV);
+
         /* get modulus size */
         PKA_GET_REG_SIZE(ModSizeBits, LEN_ID_N_BITS);
         ModSizeWords = CALC_FULL_32BIT_WORDS(ModSizeBits);
@@ -1099,7 +1211,8 @@ CCError_t PkaExecFullModInv(int8_t         OpB,  /*!< [in] Operand B: virtual re
                 /* check, is the operand B odd or even */
                 PKA_READ_BIT0(LEN_ID_N_PKA_REG_BITS, OpB, bitVal);
                 if (bitVal == 0) {
-                        return PKA_INVERSION_NOT_EXISTS_ERROR;
+                        error = PKA_INVERSION_NOT_EXISTS_ERROR;
+                        goto End;
                 }
 
                 /* in case of odd B: calculate modular inverse and GCD        */
@@ -1137,7 +1250,7 @@ CCError_t PkaExecFullModInv(int8_t         OpB,  /*!< [in] Operand B: virtual re
                                        rT3);
 
                 if (error != CC_OK) {
-                        return error;
+                        goto End;
                 }
 
                 /* 3.7. Subtract 1 from low part and divide it by B */
@@ -1156,6 +1269,8 @@ CCError_t PkaExecFullModInv(int8_t         OpB,  /*!< [in] Operand B: virtual re
                 PKA_SUB(LEN_ID_N_PKA_REG_BITS, Res, N, Res);
         }
 
+End:
+        PKI_PROF_POP();
         return error;
 }
 
@@ -14,6 +14,8 @@
 #include "pka_hw_defs.h"
 #include "cc_pka_defs_hw.h"
 #include "pki_dbg.h"
+#include "pki_prof.h"
+#include "cc_pal_trace.h"
 
 
 #ifdef __cplusplus
@@ -35,18 +37,43 @@ extern "C"
    temp = (x); x = (y); y = temp; \
 }
 
+/* PKA session: the engine stays initialized and the Asymmetric mutex locked across a run
+   of operations of the same size. The constants of the last selected key (modulus, Barrett
+   tag, EC domain) stay resident in the PKA registers until another key is selected. */
+typedef struct {
+	uint32_t     isOpen;      /* the session holds the PKA engine */
+	uint32_t     sizeInBits;  /* operation size the engine is initialized for */
+	uint32_t     regsCount;   /* count of registers, cleared on key change and on close */
+	uint32_t     isDirty;     /* registers hold data of a previous operation */
+	const void  *pResident;   /* key whose constants are resident; NULL - none */
+} PkaSession_t;
 
 
+
+/* opcode trace: the immediate and discard flags are set in bit 8 of the operands */
+#define PKA_TRACE_OPERATION(Opcode,lenId,isAImmed,OpA,isBImmed,OpB,ResDiscard,Res,Tag) \
+	CC_PAL_TRACE6(PKA_OP, (Opcode), (lenId), ((isAImmed) << 8) | (OpA), ((isBImmed) << 8) | (OpB), \
+		      ((ResDiscard) << 8) | (Res), (Tag))
+
 /* if you want to execute operation using function defined in pki_dbg.c,
  then change the define of PKA_EXEC_OP_DEBUG to 1, else define it as empty.
  Make sure the library is compiled with flag DEBUG=1, so pki_dbg.c exists in library */
 #define PKA_EXEC_OP_DEBUG 0
 #if (PKA_EXEC_OP_DEBUG  && defined PKA_DEBUG && defined DEBUG)
 	#define PKA_EXEC_OPERATION PkiDbgExecOperation
+#elif defined PKA_PROFILE
+	/* the operation is executed to its completion, and timed by the PKA profiler */
+	#define PKA_EXEC_OPERATION(Opcode,lenId,isAImmed,OpA,isBImmed,OpB,ResDiscard,Res,Tag) { \
+		uint32_t fullOpCode; \
+		fullOpCode = PKA_SET_FULL_OPCODE((Opcode),(lenId),(isAImmed),(OpA),(isBImmed),(OpB),(ResDiscard),(Res),(Tag)); \
+		PKA_TRACE_OPERATION((Opcode),(lenId),(isAImmed),(OpA),(isBImmed),(OpB),(ResDiscard),(Res),(Tag)); \
+		PkiProfExecOperation((Opcode), fullOpCode); \
+	}
 #else   // not debug mode
 	#define PKA_EXEC_OPERATION(Opcode,lenId,isAImmed,OpA,isBImmed,OpB,ResDiscard,Res,Tag) { \
 		uint32_t fullOpCode; \
 		fullOpCode = PKA_SET_FULL_OPCODE((Opcode),(lenId),(isAImmed),(OpA),(isBImmed),(OpB),(ResDiscard),(Res),(Tag)); \
+		PKA_TRACE_OPERATION((Opcode),(lenId),(isAImmed),(OpA),(isBImmed),(OpB),(ResDiscard),(Res),(Tag)); \
 		PKA_WAIT_ON_PKA_PIPE_READY(); \
 		CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, OPCODE), fullOpCode); \
 	}
@@ -288,6 +315,17 @@ CCError_t PkaInitAndMutexLock(uint32_t  sizeInBits,
 
 void PkaFinishAndMutexUnlock(uint32_t pkaRegCount);
 
+CCError_t PkaSessionOpen(PkaSession_t *pSession,
+			 uint32_t      sizeInBits,
+			 uint32_t     *pkaRegCount);
+
+CCBool_t PkaSessionSelectKey(PkaSession_t *pSession,
+			     const void   *pKeyId);
+
+void PkaSessionInvalidate(PkaSession_t *pSession);
+
+void PkaSessionClose(PkaSession_t *pSession);
+
 void PkaSetLenIds(uint32_t  sizeInBits,
 		uint32_t lenId);
 
@@ -60,6 +60,8 @@ extern "C"
 #define PKA_REGS_COUNT_ERROR                        (PKA_MODULE_ERROR_BASE + 0x38UL)
 #define PKA_INTERNAL_ERROR                          (PKA_MODULE_ERROR_BASE + 0x39UL)
 #define PKA_FATAL_ERR_STATE_ERROR                   (PKA_MODULE_ERROR_BASE + 0x3AUL)
+#define PKA_SESSION_STATE_ERROR                     (PKA_MODULE_ERROR_BASE + 0x3BUL)
+#define PKA_SESSION_SIZE_ERROR                      (PKA_MODULE_ERROR_BASE + 0x3CUL)
 
 /* modular functions errors */
 #define PKA_MOD_SQUARE_ROOT_NOT_EXIST_ERROR         (PKA_MODULE_ERROR_BASE + 0x40UL)
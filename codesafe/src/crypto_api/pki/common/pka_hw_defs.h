@@ -24,6 +24,7 @@ extern "C"
 #include "cc_bitops.h"
 #include "pka_defs.h"
 #include "cc_util_pm.h"
+#include "pki_prof.h"
 
 
 /* PKA OPCODE register fields positions (low bit position) */
@@ -109,7 +110,7 @@ do { \
 }while(0)
 
 /* defining a macro for waiting to the PKA_OP_DONE */
-#define PKA_WAIT_ON_PKA_DONE() \
+#define PKA_WAIT_ON_PKA_DONE_NO_PROF() \
 do { \
    uint32_t output_reg_val; \
    do \
@@ -118,6 +119,18 @@ do { \
    }while( (output_reg_val & 0x01) != PKA_OP_DONE ); \
 }while(0)
 
+#ifdef PKA_PROFILE
+/* the waits are counted by the PKA profiler */
+#define PKA_WAIT_ON_PKA_DONE() \
+do { \
+   PKI_PROF_PUSH(WAIT_DONE); \
+   PKA_WAIT_ON_PKA_DONE_NO_PROF(); \
+   PKI_PROF_POP(); \
+}while(0)
+#else
+#define PKA_WAIT_ON_PKA_DONE()  PKA_WAIT_ON_PKA_DONE_NO_PROF()
+#endif
+
 
 /**************************************************************/
 /*  Macros for controlling PKA machine and changing           */
@@ -231,15 +244,6 @@ do { \
 /* ******************************************************************* */
 /* MACRO DEFINITIONS FOR WORKING WITH INDIRECT ACCESS TO PKA SRAM DATA */
 /* ******************************************************************* */
-/* defining a macro to clear the not-completed part of PKA big word*
-*  ii value was set in macro calling  PKA_SRAM_WRITE_CLR()         */
-#define PKA_SRAM_WRITE_CLR(SizeWords) \
-   for(; ii < (((SizeWords+(PKA_WORD_SIZE_IN_32BIT_WORDS-1))/PKA_WORD_SIZE_IN_32BIT_WORDS)*PKA_WORD_SIZE_IN_32BIT_WORDS) ; ii++) { \
-	   CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), 0); \
-	   WAIT_SRAM_DATA_READY; \
-   }
-
-
 /* defining a macro to wait on SRAM ready;
 	   currently waiting is not needed   */
 // #define DO_WAIT_SRAM_DATA_READY
@@ -260,19 +264,68 @@ do { \
 	}
 #endif
 
-/* macro to load block to SRAM memory */
+/* macros to move a block of words through the PKA SRAM data registers, from/to the
+   address set in PKA_SRAM_ADDR/PKA_SRAM_RADDR. When no wait is needed between the
+   accesses, the block is moved in one burst of register accesses */
+#ifndef DO_WAIT_SRAM_DATA_READY
+	#define PKA_HW_WRITE_SRAM_BLOCK(ptr, SizeWords) \
+		CC_HAL_WRITE_REGISTER_BLOCK(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), (const uint32_t *)(ptr), (SizeWords))
+	#define PKA_HW_WRITE_SRAM_ZEROS(SizeWords) \
+		CC_HAL_WRITE_REGISTER_ZEROS(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), (SizeWords))
+	#define PKA_HW_READ_SRAM_BLOCK(ptr, SizeWords) \
+		CC_HAL_READ_REGISTER_BLOCK(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_RDATA), (uint32_t *)(ptr), (SizeWords))
+#else
+	#define PKA_HW_WRITE_SRAM_BLOCK(ptr, SizeWords) \
+	do { \
+	   uint32_t jj; \
+	   for(jj = 0; jj < (uint32_t)(SizeWords); jj++) { \
+		   CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), ((const uint32_t *)(ptr))[jj]); \
+		   WAIT_SRAM_DATA_READY; \
+	   } \
+	}while(0)
+	#define PKA_HW_WRITE_SRAM_ZEROS(SizeWords) \
+	do { \
+	   uint32_t jj; \
+	   for(jj = 0; jj < (uint32_t)(SizeWords); jj++) { \
+		   CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), 0x0UL); \
+		   WAIT_SRAM_DATA_READY; \
+	   } \
+	}while(0)
+	#define PKA_HW_READ_SRAM_BLOCK(ptr, SizeWords) \
+	do { \
+	   uint32_t jj; \
+	   for(jj = 0; jj < (uint32_t)(SizeWords); jj++) { \
+		   WAIT_SRAM_DATA_READY; \
+		   ((uint32_t *)(ptr))[jj] = CC_HAL_READ_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_RDATA)); \
+	   } \
+	}while(0)
+#endif
+
+/* size in words of a block, rounded up to full PKA-words */
+#define PKA_ALIGN_TO_PKA_WORD(SizeWords) \
+	((((SizeWords)+(PKA_WORD_SIZE_IN_32BIT_WORDS-1))/PKA_WORD_SIZE_IN_32BIT_WORDS)*PKA_WORD_SIZE_IN_32BIT_WORDS)
+
+/* macro to load block to SRAM memory, 0-padded to full PKA-word */
 #define PKA_HW_LOAD_BLOCK_TO_PKA_MEM(Addr, ptr, SizeWords) \
 do { \
-   uint32_t ii; \
    PKA_MUTEX_LOCK; \
    PKA_WAIT_ON_PKA_DONE();\
    CC_HAL_WRITE_REGISTER(CC_REG_OFFSET (CRY_KERNEL, PKA_SRAM_ADDR), (Addr)); \
-   for(ii = 0; ii < (SizeWords); ii++) \
-   { \
-	   CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), ((uint32_t*)(ptr))[ii]); \
-	   WAIT_SRAM_DATA_READY; \
-   } \
-   PKA_SRAM_WRITE_CLR(SizeWords) \
+   PKA_HW_WRITE_SRAM_BLOCK((ptr), (SizeWords)); \
+   PKA_HW_WRITE_SRAM_ZEROS(PKA_ALIGN_TO_PKA_WORD(SizeWords) - (SizeWords)); \
+   PKA_MUTEX_UNLOCK; \
+}while(0)
+
+/* macro to load block to a PKA register of RegSizeWords words: the block is 0-padded to full
+   PKA-word and to the register size in the same burst */
+#define PKA_HW_LOAD_BLOCK_TO_PKA_REG(Addr, ptr, SizeWords, RegSizeWords) \
+do { \
+   uint32_t padSize = CC_MAX(PKA_ALIGN_TO_PKA_WORD(SizeWords), (RegSizeWords)) - (SizeWords); \
+   PKA_MUTEX_LOCK; \
+   PKA_WAIT_ON_PKA_DONE();\
+   CC_HAL_WRITE_REGISTER(CC_REG_OFFSET (CRY_KERNEL, PKA_SRAM_ADDR), (Addr)); \
+   PKA_HW_WRITE_SRAM_BLOCK((ptr), (SizeWords)); \
+   PKA_HW_WRITE_SRAM_ZEROS(padSize); \
    PKA_MUTEX_UNLOCK; \
 }while(0)
 
@@ -291,16 +344,10 @@ do { \
 /* macro to clear PKA memory: Addr must be alighned to PKA_WORD_SIZE */
 #define PKA_HW_CLEAR_PKA_MEM(Addr, SizeWords) \
 do { \
-   uint32_t ii; \
    PKA_MUTEX_LOCK; \
    PKA_WAIT_ON_PKA_DONE();\
    CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_ADDR), (Addr)); \
-   for( ii = 0; ii < (uint32_t)(SizeWords); ii++ ) \
-   { \
-      CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA), 0x0UL ); \
-      WAIT_SRAM_DATA_READY; \
-   }\
-   PKA_SRAM_WRITE_CLR((SizeWords)); \
+   PKA_HW_WRITE_SRAM_ZEROS(PKA_ALIGN_TO_PKA_WORD(SizeWords)); \
    PKA_MUTEX_UNLOCK; \
 }while(0)
 
@@ -321,17 +368,10 @@ do { \
 /* macro to read a block from the PKA data memory */
 #define PKA_HW_READ_BLOCK_FROM_PKA_MEM(Addr, ptr, SizeWords) \
 do { \
-   uint32_t ii; \
-   uint32_t dummy; \
    PKA_MUTEX_LOCK; \
    PKA_WAIT_ON_PKA_DONE();\
    CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_RADDR), (Addr)); \
-   for(ii = 0; ii < (SizeWords); ii++) \
-   { \
-      WAIT_SRAM_DATA_READY; \
-      dummy = CC_HAL_READ_REGISTER(CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_RDATA));\
-      ((uint32_t*)(ptr))[ii] = (dummy); \
-   } \
+   PKA_HW_READ_SRAM_BLOCK((ptr), (SizeWords)); \
    WAIT_SRAM_DATA_READY; \
    PKA_MUTEX_UNLOCK; \
 }while(0)
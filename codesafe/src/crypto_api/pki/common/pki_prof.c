@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/************* Include Files ****************/
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include "cc_pal_types.h"
+#include "cc_pal_mem.h"
+#include "cc_pal_log.h"
+#include "cc_pal_perf.h"
+#include "cc_pka_prof.h"
+#include "pka_hw_defs.h"
+#include "pki_prof.h"
+
+/************************ Defines ******************************/
+
+/* maximal depth of a recorded stack; deeper frames are counted as lost */
+#define PKI_PROF_MAX_DEPTH      8
+/* number of stacks of the profile, must be a power of 2 */
+#define PKI_PROF_MAX_STACKS     512
+
+/************************ Typedefs  ****************************/
+
+/* one stack of the profile */
+typedef struct {
+	uint8_t          frameId[PKI_PROF_MAX_DEPTH];
+	uint32_t         depth;     /* 0 - the entry is free */
+	uint64_t         count;
+	CCPalPerfData_t  selfTicks;
+} PkiProfStack_t;
+
+/* one open frame */
+typedef struct {
+	uint32_t         frameId;
+	CCPalPerfData_t  startTicks;
+	CCPalPerfData_t  childTicks;  /* time of the children frames and of their profiling */
+} PkiProfFrame_t;
+
+/************************ Global Data **************************/
+
+static PkiProfStack_t gPkiProfStacks[PKI_PROF_MAX_STACKS];
+static PkiProfFrame_t gPkiProfFrames[PKI_PROF_MAX_DEPTH];
+/* count of open frames, may exceed PKI_PROF_MAX_DEPTH */
+static uint32_t gPkiProfDepth = 0;
+/* count of frames that did not fit in the profile */
+static uint64_t gPkiProfLost = 0;
+
+static const char *gPkiProfOpNames[PKI_PROF_OPCODES_COUNT] = {
+	"TERMINATE", NULL, NULL, NULL, "ADD", "SUB", "MODADD", "MODSUB",
+	"AND", "OR", "XOR", NULL, "SHR0", "SHR1", "SHL0", "SHL1",
+	"MULLOW", "MODMUL", "MODMULN", "MODEXP", "DIVISION", "MODINV", NULL, "MULHIGH",
+	"MODMLAC", "MODMLACNR", "SEPINT", "REDUCTION", NULL, NULL, NULL, NULL
+};
+
+static const char *gPkiProfFrameNames[PKI_PROF_ID_MAX - PKI_PROF_OPCODES_COUNT] = {
+	"PkaExecFullModInv",
+	"PkaCopyDataIntoPkaReg",
+	"PkaCopyDataFromPkaReg",
+	"PKA_WAIT_ON_PKA_DONE",
+	"EcdsaSignFinish",
+	"EcdsaVerifyFinish",
+	"RsaExecPrivKeyExpCrt",
+	"RsaExecPrivKeyExpNonCrt",
+	"RsaExecPubKeyExp",
+	"CC_DhGeneratePubPrv",
+	"CC_DhGetSecretKey"
+};
+
+/************************ Private Functions ******************************/
+
+static CCPalPerfData_t PkiProfElapsed(CCPalPerfData_t startTicks, CCPalPerfData_t endTicks)
+{
+	return (endTicks >= startTicks) ? (endTicks - startTicks) : ((UINT64_MAX - startTicks) + endTicks);
+}
+
+/* adds the self time of the stack of the open frames [0..depth-1] */
+static void PkiProfAccum(uint32_t depth, CCPalPerfData_t selfTicks)
+{
+	uint32_t hash = 2166136261UL;
+	uint32_t i, probe;
+	PkiProfStack_t *pStack;
+
+	for (i = 0; i < depth; i++) {
+		hash = (hash ^ gPkiProfFrames[i].frameId) * 16777619UL;
+	}
+
+	for (probe = 0; probe < PKI_PROF_MAX_STACKS; probe++) {
+		pStack = &gPkiProfStacks[(hash + probe) & (PKI_PROF_MAX_STACKS - 1)];
+		if (pStack->depth == 0) {
+			for (i = 0; i < depth; i++) {
+				pStack->frameId[i] = (uint8_t)gPkiProfFrames[i].frameId;
+			}
+			pStack->depth = depth;
+		} else if (pStack->depth == depth) {
+			for (i = 0; i < depth; i++) {
+				if (pStack->frameId[i] != gPkiProfFrames[i].frameId) {
+					break;
+				}
+			}
+			if (i < depth) {
+				continue;
+			}
+		} else {
+			continue;
+		}
+		pStack->count++;
+		pStack->selfTicks += selfTicks;
+		return;
+	}
+	gPkiProfLost++;
+}
+
+static const char *PkiProfFrameName(uint32_t frameId, char *pBuff, size_t buffSize)
+{
+	if (frameId < PKI_PROF_OPCODES_COUNT) {
+		if (gPkiProfOpNames[frameId] != NULL) {
+			return gPkiProfOpNames[frameId];
+		}
+		snprintf(pBuff, buffSize, "OPCODE_0x%02x", (unsigned int)frameId);
+		return pBuff;
+	}
+	return gPkiProfFrameNames[frameId - PKI_PROF_OPCODES_COUNT];
+}
+
+/************************ Public Functions ******************************/
+
+/**
+ * @brief Opens a frame of the PKA profile. The time of the frame runs from this call to the
+ *        matching PkiProfPop(); the time spent in the profiler itself is excluded.
+ *
+ * @return - None.
+ */
+void PkiProfPush(uint32_t frameId) /*!< [in] PkiProfId_t or a PKA opcode. */
+{
+	CCPalPerfData_t enterTicks = CC_PalPerfGetTimestamp();
+	PkiProfFrame_t *pFrame;
+
+	if (gPkiProfDepth >= PKI_PROF_MAX_DEPTH) {
+		gPkiProfDepth++;
+		gPkiProfLost++;
+		return;
+	}
+	pFrame = &gPkiProfFrames[gPkiProfDepth];
+	pFrame->frameId = frameId;
+	pFrame->childTicks = 0;
+	gPkiProfDepth++;
+	pFrame->startTicks = CC_PalPerfGetTimestamp();
+	if (gPkiProfDepth > 1) {
+		pFrame[-1].childTicks += PkiProfElapsed(enterTicks, pFrame->startTicks);
+	}
+	return;
+}
+
+
+/**
+ * @brief Closes the last opened frame of the PKA profile, and adds its self time, which is
+ *        its time less the time of its children, to its stack.
+ *
+ * @return - None.
+ */
+void PkiProfPop(void)
+{
+	CCPalPerfData_t endTicks = CC_PalPerfGetTimestamp();
+	CCPalPerfData_t ticks, selfTicks;
+	PkiProfFrame_t *pFrame;
+
+	if (gPkiProfDepth == 0) {
+		return;
+	}
+	gPkiProfDepth--;
+	if (gPkiProfDepth >= PKI_PROF_MAX_DEPTH) {
+		return;
+	}
+	pFrame = &gPkiProfFrames[gPkiProfDepth];
+	ticks = PkiProfElapsed(pFrame->startTicks, endTicks);
+	selfTicks = (ticks > pFrame->childTicks) ? (ticks - pFrame->childTicks) : 0;
+	PkiProfAccum(gPkiProfDepth + 1, selfTicks);
+	if (gPkiProfDepth > 0) {
+		pFrame[-1].childTicks += PkiProfElapsed(pFrame->startTicks, CC_PalPerfGetTimestamp());
+	}
+	return;
+}
+
+
+/**
+ * @brief Executes one PKA operation in a frame of its opcode. The function waits for the
+ *        completion of the operation, so the frame holds its execution time.
+ *
+ * @return - None.
+ */
+void PkiProfExecOperation(uint32_t opcode,     /*!< [in] The PKA opcode (PKA_OPCODE_ID_*). */
+			  uint32_t fullOpCode) /*!< [in] The value of the OPCODE register. */
+{
+	PkiProfPush(opcode & (PKI_PROF_OPCODES_COUNT - 1));
+	PKA_WAIT_ON_PKA_PIPE_READY();
+	CC_HAL_WRITE_REGISTER(CC_REG_OFFSET(CRY_KERNEL, OPCODE), fullOpCode);
+	PKA_WAIT_ON_PKA_DONE_NO_PROF();
+	PkiProfPop();
+	return;
+}
+
+
+void CC_PkaProfReset(void)
+{
+	CC_PalMemSetZero(gPkiProfStacks, sizeof(gPkiProfStacks));
+	gPkiProfLost = 0;
+	return;
+}
+
+
+int CC_PkaProfDumpToFile(CCPkaProfValue_t value, const char *pFileName)
+{
+	FILE *pFile = stdout;
+	PkiProfStack_t *pStack;
+	char nameBuff[16];
+	uint32_t i, j;
+	uint64_t val;
+
+	if (pFileName != NULL) {
+		pFile = fopen(pFileName, "w");
+		if (pFile == NULL) {
+			CC_PAL_LOG_ERR("unable to open %s [%s]\n", pFileName, strerror(errno));
+			return 1;
+		}
+	}
+
+	for (i = 0; i < PKI_PROF_MAX_STACKS; i++) {
+		pStack = &gPkiProfStacks[i];
+		if (pStack->depth == 0) {
+			continue;
+		}
+		val = (value == CC_PKA_PROF_VALUE_COUNT) ? pStack->count : CC_PalPerfTicksToUnits(pStack->selfTicks);
+		for (j = 0; j < pStack->depth; j++) {
+			fprintf(pFile, "%s%s", (j == 0) ? "" : ";",
+				PkiProfFrameName(pStack->frameId[j], nameBuff, sizeof(nameBuff)));
+		}
+		fprintf(pFile, " %llu\n", (unsigned long long)val);
+	}
+	if (gPkiProfLost != 0) {
+		fprintf(pFile, "[lost] %llu\n", (unsigned long long)gPkiProfLost);
+	}
+
+	if (pFile != stdout) {
+		fclose(pFile);
+	} else {
+		fflush(pFile);
+	}
+	return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+
+#ifndef PKI_PROF_H
+#define PKI_PROF_H
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "cc_pal_types.h"
+
+/* Frames of the PKA profile. The PKA operations are identified by their opcode
+   (PKA_OPCODE_ID_*), so the other frames are numbered above the opcodes. */
+#define PKI_PROF_OPCODES_COUNT    0x20U
+
+typedef enum {
+	/* PKA driver functions */
+	PKI_PROF_ID_FULL_MOD_INV = PKI_PROF_OPCODES_COUNT,
+	PKI_PROF_ID_COPY_IN,
+	PKI_PROF_ID_COPY_OUT,
+	PKI_PROF_ID_WAIT_DONE,
+	/* asymmetric APIs */
+	PKI_PROF_ID_ECDSA_SIGN,
+	PKI_PROF_ID_ECDSA_VERIFY,
+	PKI_PROF_ID_RSA_PRIV_CRT,
+	PKI_PROF_ID_RSA_PRIV_NON_CRT,
+	PKI_PROF_ID_RSA_PUB,
+	PKI_PROF_ID_DH_GEN_PUB_PRV,
+	PKI_PROF_ID_DH_SECRET_KEY,
+	PKI_PROF_ID_MAX,
+	PKI_PROF_ID_RESERVE32 = 0x7FFFFFFF
+} PkiProfId_t;
+
+#ifdef PKA_PROFILE
+
+/* Opens a frame of the profile: frameId is PkiProfId_t or a PKA opcode */
+void PkiProfPush(uint32_t frameId);
+
+/* Closes the last opened frame and adds its self time to its stack */
+void PkiProfPop(void);
+
+/* Executes one PKA operation and waits for its completion, in a frame of the opcode */
+void PkiProfExecOperation(uint32_t opcode, uint32_t fullOpCode);
+
+#define PKI_PROF_PUSH(id)       PkiProfPush(PKI_PROF_ID_ ## id)
+#define PKI_PROF_POP()          PkiProfPop()
+
+#else  /* PKA_PROFILE */
+
+#define PKI_PROF_PUSH(id)       do {} while (0)
+#define PKI_PROF_POP()          do {} while (0)
+
+#endif /* PKA_PROFILE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,694 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#include "cc_pal_mem.h"
+#include "cc_pal_types.h"
+#include "cc_common_math.h"
+#include "cc_ec_mont_edw_error.h"
+#include "pka_hw_defs.h"
+#include "pka.h"
+#include "pka_error.h"
+#include "ec_mont_edw_domain.h"
+#include "pka_ec_mont_edw.h"
+#include "pka_ec_mont_edw_regs.h"
+
+/* the bit i of the vector */
+#define EC_EDW_BIT(pVec, i)  (((pVec)[(i) >> 5] >> ((i) & 0x1F)) & 1UL)
+
+/* size of the recoded comb scalar in words: the comb covers up to 2 bits more than L */
+#define EC_EDW_COMB_SCALAR_SIZE_IN_WORDS    (EC_MONT_EDW_MOD_SIZE_IN_WORDS + 1)
+
+
+/***********    EcEdwMaskIfEqual   function      **********************/
+/**
+ * @brief Returns all-ones mask if the values are equal, otherwise zero, without branches.
+ *
+ * @return  - the mask.
+ */
+static uint32_t EcEdwMaskIfEqual(uint32_t a, /*!< [in] First value. */
+				 uint32_t b) /*!< [in] Second value. */
+{
+        uint32_t x = a ^ b;
+
+        return ((x | (0U - x)) >> 31) - 1U;
+}
+
+
+/***********    EcEdwInitPka   function      **********************/
+/**
+ * @brief Initializes the PKA with the field modulus p or with the order L of the domain.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ */
+static CCError_t EcEdwInitPka(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+			      uint32_t isOrder,                 /*!< [in] Modulus L if not zero, otherwise p. */
+			      uint32_t *pPkaReqRegs)            /*!< [in/out] Count of PKA registers. */
+{
+        CCError_t err;
+
+        *pPkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+        err = PkaInitAndMutexLock(isOrder ? EC_MONT_EDW_ORD_SIZE_IN_BITS : EC_MONT_EDW_MOD_SIZE_IN_BITS,
+                                  pPkaReqRegs);
+        if (err != CC_OK) {
+                return err;
+        }
+
+        PkaCopyDataIntoPkaReg(EC_MONT_EDW_REG_N, 1, isOrder ? pDomain->ecOrd : pDomain->ecP,
+                              EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_MONT_EDW_REG_NP, 1, isOrder ? pDomain->ecOrdTag : pDomain->ecPTag,
+                              CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+        return CC_OK;
+}
+
+
+/***********    EcEdwDouble   function      **********************/
+/**
+ * @brief EC Edwards doubling of the accumulated point in extended coordinates:
+ *        (X,Y,Z,T) = 2*(X,Y,Z); dbl-2008-hwcd with a = -1, signs of E, F, G, H are flipped.
+ *        The coordinate T is calculated only if it is needed by the next addition.
+ *
+ * @return  - no return value.
+ */
+static void EcEdwDouble(uint32_t calcT) /*!< [in] Calculate T if not zero. */
+{
+        /* A = X^2, B = Y^2, C = 2*Z^2, H = A + B */
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T0, EC_EDW_REG_X, EC_EDW_REG_X);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T1, EC_EDW_REG_Y, EC_EDW_REG_Y);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T2, EC_EDW_REG_Z, EC_EDW_REG_Z);
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T2, EC_EDW_REG_T2, EC_EDW_REG_T2);
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T3, EC_EDW_REG_T0, EC_EDW_REG_T1);
+        /* E = H - (X + Y)^2, G = A - B, F = C + G */
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T4, EC_EDW_REG_X, EC_EDW_REG_Y);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T4, EC_EDW_REG_T4, EC_EDW_REG_T4);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T4, EC_EDW_REG_T3, EC_EDW_REG_T4);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T5, EC_EDW_REG_T0, EC_EDW_REG_T1);
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T6, EC_EDW_REG_T2, EC_EDW_REG_T5);
+        /* X = E*F, Y = G*H, Z = F*G, T = E*H */
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_X, EC_EDW_REG_T4, EC_EDW_REG_T6);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_Y, EC_EDW_REG_T5, EC_EDW_REG_T3);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_Z, EC_EDW_REG_T6, EC_EDW_REG_T5);
+        if (calcT) {
+                PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T, EC_EDW_REG_T4, EC_EDW_REG_T3);
+        }
+        return;
+}
+
+
+/***********    EcEdwAdd   function      **********************/
+/**
+ * @brief EC Edwards addition of a point to the accumulated point in extended coordinates:
+ *        (X,Y,Z,T) = (X,Y,Z,T) + P; add-2008-hwcd-3 with a = -1 and k = 2*d.
+ *        The added point P is given in the cached form (Y+X, Y-X, 2*d*T, 2*Z), or in the
+ *        niels form (y+x, y-x, 2*d*x*y) of an affine point (madd-2008-hwcd-3).
+ *        The point -P is added by passing the registers of Y-X and Y+X swapped and the negated 2*d*T.
+ *
+ * @return  - no return value.
+ */
+static void EcEdwAdd(uint32_t rYpX,  /*!< [in] Register of Y+X of the point. */
+		     uint32_t rYmX,  /*!< [in] Register of Y-X of the point. */
+		     uint32_t rT2d,  /*!< [in] Register of 2*d*T of the point. */
+		     uint32_t isCached) /*!< [in] The cached form with 2*Z in EC_EDW_REG_PZ2 if not zero,
+					       otherwise the niels form. */
+{
+        /* A = (Y - X)*(Y2 - X2), B = (Y + X)*(Y2 + X2), C = T*2*d*T2, D = 2*Z*Z2 */
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T0, EC_EDW_REG_Y, EC_EDW_REG_X);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T0, EC_EDW_REG_T0, rYmX);
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T1, EC_EDW_REG_Y, EC_EDW_REG_X);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T1, EC_EDW_REG_T1, rYpX);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T2, EC_EDW_REG_T, rT2d);
+        if (isCached) {
+                PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T3, EC_EDW_REG_Z, EC_EDW_REG_PZ2);
+        } else {
+                PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T3, EC_EDW_REG_Z, EC_EDW_REG_Z);
+        }
+        /* E = B - A, F = D - C, G = D + C, H = B + A */
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T4, EC_EDW_REG_T1, EC_EDW_REG_T0);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T5, EC_EDW_REG_T3, EC_EDW_REG_T2);
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T6, EC_EDW_REG_T3, EC_EDW_REG_T2);
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T7, EC_EDW_REG_T1, EC_EDW_REG_T0);
+        /* X = E*F, Y = G*H, Z = F*G, T = E*H */
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_X, EC_EDW_REG_T4, EC_EDW_REG_T5);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_Y, EC_EDW_REG_T6, EC_EDW_REG_T7);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_Z, EC_EDW_REG_T5, EC_EDW_REG_T6);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T, EC_EDW_REG_T4, EC_EDW_REG_T7);
+        return;
+}
+
+
+/***********    EcEdwSetNeutral   function      **********************/
+/**
+ * @brief Sets the accumulated point to the neutral point (0, 1, 1, 0).
+ *
+ * @return  - no return value.
+ */
+static void EcEdwSetNeutral(void)
+{
+        PKA_CLEAR(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_X);
+        PKA_SET_VAL(EC_EDW_REG_Y, 1);
+        PKA_SET_VAL(EC_EDW_REG_Z, 1);
+        PKA_CLEAR(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T);
+        return;
+}
+
+
+/***********    EcEdwNegT2d   function      **********************/
+/**
+ * @brief Calculates the negated 2*d*T of the added point: EC_EDW_REG_PT2DN = -EC_EDW_REG_PT2D mod p.
+ *
+ * @return  - no return value.
+ */
+static void EcEdwNegT2d(void)
+{
+        PKA_CLEAR(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T0);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_PT2DN, EC_EDW_REG_T0, EC_EDW_REG_PT2D);
+        return;
+}
+
+
+/***********    EcEdwEncode   function      **********************/
+/**
+ * @brief Encodes the accumulated point: the affine y in little endian order of words,
+ *        with the least significant bit of the affine x in the most significant bit.
+ *
+ * @return  - no return value.
+ */
+static void EcEdwEncode(uint32_t *pEncPoint) /*!< [out] Pointer to the encoded point. */
+{
+        uint32_t w = 0;
+
+        /* x = X/Z, y = Y/Z */
+        PKA_MOD_INV_W_EXP(EC_EDW_REG_T0, EC_EDW_REG_Z, EC_EDW_REG_T1);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T2, EC_EDW_REG_X, EC_EDW_REG_T0);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T3, EC_EDW_REG_Y, EC_EDW_REG_T0);
+
+        PkaCopyDataFromPkaReg(pEncPoint, EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_EDW_REG_T3);
+        PKA_READ_WORD_FROM_REG(w, 0, EC_EDW_REG_T2);
+        pEncPoint[EC_MONT_EDW_MOD_SIZE_IN_WORDS - 1] |= (w & 1UL) << 31;
+        return;
+}
+
+
+/***********    EcEdwDecode   function      **********************/
+/**
+ * @brief Decodes the point as RFC 8032 5.1.3 into the registers EC_EDW_REG_AX, EC_EDW_REG_AY:
+ *        x = u*v^3*(u*v^7)^((p-5)/8), u = y^2 - 1, v = d*y^2 + 1, multiplied by sqrt(-1)
+ *        if v*x^2 = -u, and negated to the sign bit.
+ *
+ * @return  - CC_OK, or CC_EC_EDW_INVALID_PUBL_KEY_ERROR if the point is not valid.
+ */
+static CCError_t EcEdwDecode(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+			     const uint32_t *pEncPoint)        /*!< [in] Pointer to the encoded point. */
+{
+        uint32_t y[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+        uint32_t sign, stat, w = 0;
+
+        /* the y coordinate must be less than p */
+        CC_PalMemCopy(y, pEncPoint, sizeof(y));
+        sign = y[EC_MONT_EDW_MOD_SIZE_IN_WORDS - 1] >> 31;
+        y[EC_MONT_EDW_MOD_SIZE_IN_WORDS - 1] &= 0x7FFFFFFFUL;
+        if (CC_CommonCmpLsWordsUnsignedCounters(y, EC_MONT_EDW_MOD_SIZE_IN_WORDS,
+                                                pDomain->ecP, EC_MONT_EDW_MOD_SIZE_IN_WORDS) !=
+            CC_COMMON_CmpCounter2GreaterThenCounter1) {
+                return CC_EC_EDW_INVALID_PUBL_KEY_ERROR;
+        }
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_AY, 1, y, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_T7, 1, pDomain->ecEdwD, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+
+        /* u = y^2 - 1 (T1), v = d*y^2 + 1 (T2) */
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T0, EC_EDW_REG_AY, EC_EDW_REG_AY);
+        PKA_MOD_SUB_IM(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T1, EC_EDW_REG_T0, 1);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T2, EC_EDW_REG_T0, EC_EDW_REG_T7);
+        PKA_MOD_ADD_IM(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T2, EC_EDW_REG_T2, 1);
+        /* v^3 (T3), u*v^7 (T4) */
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T3, EC_EDW_REG_T2, EC_EDW_REG_T2);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T3, EC_EDW_REG_T3, EC_EDW_REG_T2);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T4, EC_EDW_REG_T3, EC_EDW_REG_T3);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T4, EC_EDW_REG_T4, EC_EDW_REG_T2);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T4, EC_EDW_REG_T4, EC_EDW_REG_T1);
+        /* x = u*v^3*(u*v^7)^((p-5)/8) */
+        PKA_SUB_IM(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T5, EC_MONT_EDW_REG_N, 5);
+        PKA_SHR_FILL0(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T5, EC_EDW_REG_T5, 3-1);
+        PKA_MOD_EXP(LEN_ID_N_BITS, EC_EDW_REG_AX, EC_EDW_REG_T4, EC_EDW_REG_T5);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_AX, EC_EDW_REG_AX, EC_EDW_REG_T3);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_AX, EC_EDW_REG_AX, EC_EDW_REG_T1);
+
+        /* check v*x^2 = u, or v*x^2 = -u and then x = x*sqrt(-1) */
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T6, EC_EDW_REG_AX, EC_EDW_REG_AX);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T6, EC_EDW_REG_T6, EC_EDW_REG_T2);
+        PKA_COMPARE_STATUS(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T6, EC_EDW_REG_T1, stat);
+        if (stat != 1) {
+                PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T6, EC_EDW_REG_T6, EC_EDW_REG_T1);
+                PKA_COMPARE_IM_STATUS(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T6, 0, stat);
+                if (stat != 1) {
+                        return CC_EC_EDW_INVALID_PUBL_KEY_ERROR;
+                }
+                PkaCopyDataIntoPkaReg(EC_EDW_REG_T7, 1, pDomain->ecSqrtM1, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+                PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_AX, EC_EDW_REG_AX, EC_EDW_REG_T7);
+        }
+
+        /* x = 0 has no negative; otherwise negate x to the sign bit */
+        PKA_COMPARE_IM_STATUS(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_AX, 0, stat);
+        if ((stat == 1) && (sign == 1)) {
+                return CC_EC_EDW_INVALID_PUBL_KEY_ERROR;
+        }
+        PKA_READ_WORD_FROM_REG(w, 0, EC_EDW_REG_AX);
+        if ((w & 1UL) != sign) {
+                PKA_CLEAR(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T0);
+                PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_AX, EC_EDW_REG_T0, EC_EDW_REG_AX);
+        }
+        return CC_OK;
+}
+
+
+/***********    EcEdwCombRecode   function      **********************/
+/**
+ * @brief Recodes the scalar for the fixed-base comb, as EcWrstCombRecode(): the scalar is made
+ *        odd (k' = k or L-k) and recoded to signed binary digits b_i = 2*c_i - 1,
+ *        c = (k' + 2^(teeth*spacing) - 1)/2. The recoding does not branch on the scalar.
+ *
+ * @return  - all-ones mask if the scalar was replaced by L - k (the product must be negated),
+ *            otherwise zero.
+ */
+static uint32_t EcEdwCombRecode(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+				const uint32_t *k,                /*!< [in] Pointer to the scalar, less than L. */
+				uint32_t *pComb)                  /*!< [out] Recoded scalar c, of size
+									 EC_EDW_COMB_SCALAR_SIZE_IN_WORDS words. */
+{
+        uint32_t combSizeInBits = EC_EDW_COMB_TEETH_COUNT*pDomain->combSpacing;
+        uint32_t i, diff, borrow, negMask;
+        uint64_t t;
+
+        /* k' = k if k is odd, otherwise L - k, which is odd since L is odd */
+        CC_PalMemSetZero(pComb, sizeof(uint32_t)*EC_EDW_COMB_SCALAR_SIZE_IN_WORDS);
+        CC_PalMemCopy(pComb, k, sizeof(uint32_t)*EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        negMask = (pComb[0] & 1UL) - 1UL;
+        borrow = 0;
+        for (i = 0; i < EC_MONT_EDW_MOD_SIZE_IN_WORDS; i++) {
+                t = (uint64_t)pDomain->ecOrd[i] - pComb[i] - borrow;
+                diff = (uint32_t)t;
+                borrow = (uint32_t)(t >> 32) & 1UL;
+                pComb[i] ^= (pComb[i] ^ diff) & negMask;
+        }
+
+        /* c = (k' - 1)/2 + 2^(combSizeInBits - 1) */
+        for (i = 0; i < EC_EDW_COMB_SCALAR_SIZE_IN_WORDS - 1; i++) {
+                pComb[i] = (pComb[i] >> 1) | (pComb[i+1] << 31);
+        }
+        pComb[(combSizeInBits - 1) >> 5] |= 1UL << ((combSizeInBits - 1) & 0x1F);
+
+        return negMask;
+}
+
+
+/***********    EcEdwLoadNiels   function      **********************/
+/**
+ * @brief Loads the point in the niels form (y+x, y-x, 2*d*x*y) into the registers of the added point.
+ *
+ * @return  - no return value.
+ */
+static void EcEdwLoadNiels(const uint32_t *pPoint) /*!< [in] Pointer to the point. */
+{
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_PYPX, 1, pPoint, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_PYMX, 1, pPoint + EC_MONT_EDW_MOD_SIZE_IN_WORDS,
+                              EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_PT2D, 1, pPoint + 2*EC_MONT_EDW_MOD_SIZE_IN_WORDS,
+                              EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        return;
+}
+
+
+/***********    EcEdwCombSelectPoint   function      **********************/
+/**
+ * @brief Loads the comb table entry into the registers of the added point in constant time:
+ *        all entries are read, and only the requested one is accumulated.
+ *
+ * @return  - no return value.
+ */
+static void EcEdwCombSelectPoint(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+				 uint32_t index,                   /*!< [in] Index of the entry (secret). */
+				 uint32_t *pPoint)                 /*!< [in] Buffer for the entry. */
+{
+        uint32_t i, j, mask;
+        const uint32_t *pEntry = pDomain->pCombPoints;
+
+        CC_PalMemSetZero(pPoint, EC_EDW_NIELS_POINT_SIZE_IN_WORDS*sizeof(uint32_t));
+        for (i = 0; i < EC_EDW_COMB_POINTS_COUNT; i++) {
+                mask = EcEdwMaskIfEqual(i, index);
+                for (j = 0; j < EC_EDW_NIELS_POINT_SIZE_IN_WORDS; j++) {
+                        pPoint[j] |= pEntry[j] & mask;
+                }
+                pEntry += EC_EDW_NIELS_POINT_SIZE_IN_WORDS;
+        }
+        EcEdwLoadNiels(pPoint);
+        return;
+}
+
+
+/***********    PkaEcEdwCombMult   function      **********************/
+/**
+ * @brief EC Edwards multiplication of the base point, (X,Y,Z) = k*B, using the fixed-base comb.
+ *
+ *  The scalar is recoded by EcEdwCombRecode() (the result is negated back if the scalar was
+ *  replaced by L-k); the column i gathers the digits b_(i + j*spacing), j = 0..teeth-1, and its
+ *  value is b_i * T[u], where bit (j-1) of u is set if b_(i + j*spacing) equals b_i.
+ *  Every column adds a point, and the sequence of PKA operations does not depend on the scalar:
+ *  the table entry is selected by a full table scan, and the negated entry by a masked
+ *  selection of the registers.
+ *  The function runs inside an open PKA session with the field modulus in N, NP.
+ *
+ * @return  - no return value.
+ */
+void PkaEcEdwCombMult(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+		      const uint32_t *pScalar)          /*!< [in] Pointer to the scalar, less than L. */
+{
+        uint32_t kt[EC_EDW_COMB_SCALAR_SIZE_IN_WORDS];
+        uint32_t pt[EC_EDW_NIELS_POINT_SIZE_IN_WORDS];
+        uint32_t i, j, index, negMask, colNegMask, bit;
+        uint32_t rYpX, rYmX, rT2d, rX;
+        int32_t col;
+
+        negMask = EcEdwCombRecode(pDomain, pScalar, kt);
+
+        EcEdwSetNeutral();
+        for (col = (int32_t)pDomain->combSpacing - 1; col >= 0; col--) {
+                i = (uint32_t)col;
+                /* index and sign of the column */
+                bit = EC_EDW_BIT(kt, i);
+                index = 0;
+                for (j = 1; j < EC_EDW_COMB_TEETH_COUNT; j++) {
+                        index |= (EC_EDW_BIT(kt, i + j*pDomain->combSpacing) ^ bit ^ 1UL) << (j - 1);
+                }
+                colNegMask = EcEdwMaskIfEqual(bit, 0);
+
+                EcEdwCombSelectPoint(pDomain, index, pt);
+                EcEdwNegT2d();
+                rYpX = EC_EDW_REG_PYPX ^ ((EC_EDW_REG_PYPX ^ EC_EDW_REG_PYMX) & colNegMask);
+                rYmX = EC_EDW_REG_PYMX ^ ((EC_EDW_REG_PYMX ^ EC_EDW_REG_PYPX) & colNegMask);
+                rT2d = EC_EDW_REG_PT2D ^ ((EC_EDW_REG_PT2D ^ EC_EDW_REG_PT2DN) & colNegMask);
+
+                if (i != pDomain->combSpacing - 1) {
+                        EcEdwDouble(1);
+                }
+                EcEdwAdd(rYpX, rYmX, rT2d, 0);
+        }
+
+        /* negate the result back if the scalar was replaced by L - k */
+        PKA_CLEAR(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T0);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T1, EC_EDW_REG_T0, EC_EDW_REG_X);
+        rX = EC_EDW_REG_X ^ ((EC_EDW_REG_X ^ EC_EDW_REG_T1) & negMask);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T0, rX);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_X, EC_EDW_REG_T0);
+
+        /* zeroing of the scalar and point buffers */
+        CC_PalMemSetZero(kt, sizeof(kt));
+        CC_PalMemSetZero(pt, sizeof(pt));
+        return;
+}
+
+
+/***********    PkaEcEdwScalarMultBase   function      **********************/
+/**
+ * @brief EC Edwards multiplication of the base point, k*B, with the encoded result.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ */
+CCError_t PkaEcEdwScalarMultBase(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+				 uint32_t *pEncPoint,              /*!< [out] Pointer to the encoded result. */
+				 const uint32_t *pScalar)          /*!< [in] Pointer to the scalar, less than L. */
+{
+        CCError_t err;
+        uint32_t pkaReqRegs;
+
+        err = EcEdwInitPka(pDomain, 0, &pkaReqRegs);
+        if (err != CC_OK) {
+                return err;
+        }
+        PkaEcEdwCombMult(pDomain, pScalar);
+        EcEdwEncode(pEncPoint);
+
+        PkaFinishAndMutexUnlock(pkaReqRegs);
+        return CC_OK;
+}
+
+
+/***********    EcEdwNaf   function      **********************/
+/**
+ * @brief Calculates the width-w NAF of the scalar: odd digits |d| < 2^(w-1), with at least
+ *        w-1 zero digits after each non-zero one. The scalar is public, so the function branches on it.
+ *
+ * @return  - the count of digits.
+ */
+static uint32_t EcEdwNaf(int8_t *pNaf,            /*!< [out] The digits, of EC_EDW_NAF_MAX_LENGTH bytes. */
+			 const uint32_t *pScalar) /*!< [in] Pointer to the scalar, of the modulus size. */
+{
+        uint32_t k[EC_MONT_EDW_MOD_SIZE_IN_WORDS + 1];
+        uint32_t i, j, c, len = 0, isZero;
+        int32_t d;
+        uint64_t t;
+
+        CC_PalMemCopy(k, pScalar, sizeof(uint32_t)*EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        k[EC_MONT_EDW_MOD_SIZE_IN_WORDS] = 0;
+        CC_PalMemSetZero(pNaf, EC_EDW_NAF_MAX_LENGTH);
+
+        do {
+                d = 0;
+                if (k[0] & 1UL) {
+                        /* d = k mods 2^w, k = k - d */
+                        d = (int32_t)(k[0] & ((1UL << EC_EDW_WNAF_WIDTH) - 1));
+                        if (d >= (1 << (EC_EDW_WNAF_WIDTH - 1))) {
+                                d -= (1 << EC_EDW_WNAF_WIDTH);
+                        }
+                        /* k = k - d: subtract a positive digit, or add the negated one */
+                        if (d > 0) {
+                                c = (uint32_t)d;
+                                for (j = 0; (j < EC_MONT_EDW_MOD_SIZE_IN_WORDS + 1) && (c != 0); j++) {
+                                        t = (uint64_t)k[j] - c;
+                                        k[j] = (uint32_t)t;
+                                        c = (uint32_t)(t >> 32) & 1UL;
+                                }
+                        } else {
+                                c = (uint32_t)(-d);
+                                for (j = 0; (j < EC_MONT_EDW_MOD_SIZE_IN_WORDS + 1) && (c != 0); j++) {
+                                        t = (uint64_t)k[j] + c;
+                                        k[j] = (uint32_t)t;
+                                        c = (uint32_t)(t >> 32);
+                                }
+                        }
+                }
+                pNaf[len++] = (int8_t)d;
+
+                /* k = k/2 */
+                isZero = 1;
+                for (i = 0; i < EC_MONT_EDW_MOD_SIZE_IN_WORDS; i++) {
+                        k[i] = (k[i] >> 1) | (k[i+1] << 31);
+                        isZero &= (k[i] == 0);
+                }
+                k[EC_MONT_EDW_MOD_SIZE_IN_WORDS] >>= 1;
+                isZero &= (k[EC_MONT_EDW_MOD_SIZE_IN_WORDS] == 0);
+        } while ((isZero == 0) && (len < EC_EDW_NAF_MAX_LENGTH));
+
+        CC_PalMemSetZero(k, sizeof(k));
+        return len;
+}
+
+
+/***********    EcEdwLoadCached   function      **********************/
+/**
+ * @brief Loads the point in the cached form (Y+X, Y-X, 2*d*T, 2*Z) into the registers of the added point.
+ *
+ * @return  - no return value.
+ */
+static void EcEdwLoadCached(const uint32_t *pPoint) /*!< [in] Pointer to the point. */
+{
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_PYPX, 1, pPoint, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_PYMX, 1, pPoint + EC_MONT_EDW_MOD_SIZE_IN_WORDS,
+                              EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_PT2D, 1, pPoint + 2*EC_MONT_EDW_MOD_SIZE_IN_WORDS,
+                              EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_PZ2, 1, pPoint + 3*EC_MONT_EDW_MOD_SIZE_IN_WORDS,
+                              EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        return;
+}
+
+
+/***********    EcEdwStoreCached   function      **********************/
+/**
+ * @brief Stores the accumulated point in the cached form (Y+X, Y-X, 2*d*T, 2*Z).
+ *
+ * @return  - no return value.
+ */
+static void EcEdwStoreCached(uint32_t *pPoint) /*!< [out] Pointer to the point. */
+{
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T0, EC_EDW_REG_Y, EC_EDW_REG_X);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T1, EC_EDW_REG_Y, EC_EDW_REG_X);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T2, EC_EDW_REG_T, EC_EDW_REG_D2);
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T3, EC_EDW_REG_Z, EC_EDW_REG_Z);
+        PkaCopyDataFromPkaReg(pPoint, EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_EDW_REG_T0);
+        PkaCopyDataFromPkaReg(pPoint + EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_EDW_REG_T1);
+        PkaCopyDataFromPkaReg(pPoint + 2*EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_EDW_REG_T2);
+        PkaCopyDataFromPkaReg(pPoint + 3*EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_EDW_REG_T3);
+        return;
+}
+
+
+/***********    PkaEcEdwDoubleScalarMult   function      **********************/
+/**
+ * @brief EC Edwards double scalar multiplication S*B - k*A, with the encoded result.
+ *
+ *  The verification inputs are public, so the multiplication branches on the scalars:
+ *  both scalars are recoded to the width-w NAF, and the loop shares one doubling per digit
+ *  between them. The odd multiples of the base point are precomputed in the domain, and the
+ *  odd multiples of -A are calculated once, in the cached form, into the temporary buffer.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ */
+CCError_t PkaEcEdwDoubleScalarMult(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+				   uint32_t *pEncPoint,              /*!< [out] Pointer to the encoded result. */
+				   const uint32_t *pScalarS,         /*!< [in] Pointer to the scalar of the base point. */
+				   const uint32_t *pScalarK,         /*!< [in] Pointer to the scalar of the point A. */
+				   const uint32_t *pEncPointA,       /*!< [in] Pointer to the encoded point A. */
+				   uint32_t *pTempBuff)              /*!< [in] Temporary buffer of
+									    EC_EDW_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
+{
+        CCError_t err;
+        uint32_t pkaReqRegs;
+        uint32_t *pPoints = pTempBuff;
+        int8_t *pNafS = (int8_t*)(pPoints + EC_EDW_WNAF_POINTS_COUNT*EC_EDW_CACHED_POINT_SIZE_IN_WORDS);
+        int8_t *pNafK = pNafS + CALC_32BIT_WORDS_FROM_BYTES(EC_EDW_NAF_MAX_LENGTH)*sizeof(uint32_t);
+        uint32_t lenS, lenK, len, i, isStarted = 0;
+        int32_t d;
+
+        lenS = EcEdwNaf(pNafS, pScalarS);
+        lenK = EcEdwNaf(pNafK, pScalarK);
+        len = CC_MAX(lenS, lenK);
+
+        err = EcEdwInitPka(pDomain, 0, &pkaReqRegs);
+        if (err != CC_OK) {
+                return err;
+        }
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_D2, 1, pDomain->ecEdwD2, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+
+        err = EcEdwDecode(pDomain, pEncPointA);
+        if (err != CC_OK) {
+                goto End;
+        }
+
+        /* the odd multiples of -A: P = -A, D = 2P, P_(i+1) = P_i + D */
+        PKA_CLEAR(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T0);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_AX, EC_EDW_REG_T0, EC_EDW_REG_AX);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_X, EC_EDW_REG_AX);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_Y, EC_EDW_REG_AY);
+        PKA_SET_VAL(EC_EDW_REG_Z, 1);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T, EC_EDW_REG_AX, EC_EDW_REG_AY);
+        EcEdwStoreCached(pPoints);
+        EcEdwDouble(1);
+        EcEdwStoreCached(pPoints + EC_EDW_CACHED_POINT_SIZE_IN_WORDS);
+        EcEdwLoadCached(pPoints + EC_EDW_CACHED_POINT_SIZE_IN_WORDS);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_X, EC_EDW_REG_AX);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_Y, EC_EDW_REG_AY);
+        PKA_SET_VAL(EC_EDW_REG_Z, 1);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T, EC_EDW_REG_AX, EC_EDW_REG_AY);
+        for (i = 1; i < EC_EDW_WNAF_POINTS_COUNT; i++) {
+                EcEdwAdd(EC_EDW_REG_PYPX, EC_EDW_REG_PYMX, EC_EDW_REG_PT2D, 1);
+                EcEdwStoreCached(pPoints + i*EC_EDW_CACHED_POINT_SIZE_IN_WORDS);
+        }
+
+        /* interleaved NAF loop */
+        EcEdwSetNeutral();
+        for (i = len; i > 0; i--) {
+                if (isStarted) {
+                        EcEdwDouble((pNafS[i-1] != 0) || (pNafK[i-1] != 0));
+                }
+                d = pNafS[i-1];
+                if (d != 0) {
+                        EcEdwLoadNiels(pDomain->pWnafPoints + (((d < 0) ? -d : d) >> 1)*EC_EDW_NIELS_POINT_SIZE_IN_WORDS);
+                        if (d > 0) {
+                                EcEdwAdd(EC_EDW_REG_PYPX, EC_EDW_REG_PYMX, EC_EDW_REG_PT2D, 0);
+                        } else {
+                                EcEdwNegT2d();
+                                EcEdwAdd(EC_EDW_REG_PYMX, EC_EDW_REG_PYPX, EC_EDW_REG_PT2DN, 0);
+                        }
+                        isStarted = 1;
+                }
+                d = pNafK[i-1];
+                if (d != 0) {
+                        EcEdwLoadCached(pPoints + (((d < 0) ? -d : d) >> 1)*EC_EDW_CACHED_POINT_SIZE_IN_WORDS);
+                        if (d > 0) {
+                                EcEdwAdd(EC_EDW_REG_PYPX, EC_EDW_REG_PYMX, EC_EDW_REG_PT2D, 1);
+                        } else {
+                                EcEdwNegT2d();
+                                EcEdwAdd(EC_EDW_REG_PYMX, EC_EDW_REG_PYPX, EC_EDW_REG_PT2DN, 1);
+                        }
+                        isStarted = 1;
+                }
+        }
+        EcEdwEncode(pEncPoint);
+
+End:
+        PkaFinishAndMutexUnlock(pkaReqRegs);
+        return err;
+}
+
+
+/***********    PkaEcEdwScalarReduce   function      **********************/
+/**
+ * @brief EC Edwards scalar reduction modulo the order L of the base point.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ */
+CCError_t PkaEcEdwScalarReduce(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+			       uint32_t *pRes,                   /*!< [out] Pointer to the result, of the modulus size. */
+			       const uint32_t *pScalar,          /*!< [in] Pointer to the scalar. */
+			       uint32_t scalarSizeInWords)       /*!< [in] The scalar size in words, up to 2*modulus size. */
+{
+        CCError_t err;
+        uint32_t pkaReqRegs;
+
+        err = EcEdwInitPka(pDomain, 1, &pkaReqRegs);
+        if (err != CC_OK) {
+                return err;
+        }
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_SA, LEN_ID_MAX_BITS, pScalar, scalarSizeInWords);
+        PKA_DIV(LEN_ID_MAX_BITS, EC_EDW_REG_SQ/*not used*/, EC_EDW_REG_SA, EC_MONT_EDW_REG_N);
+        PkaCopyDataFromPkaReg(pRes, EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_EDW_REG_SA);
+
+        PkaFinishAndMutexUnlock(pkaReqRegs);
+        return CC_OK;
+}
+
+
+/***********    PkaEcEdwScalarMulAdd   function      **********************/
+/**
+ * @brief EC Edwards scalar multiply-add modulo the order L: res = a*b + c mod L.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ */
+CCError_t PkaEcEdwScalarMulAdd(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+			       uint32_t *pRes,                   /*!< [out] Pointer to the result. */
+			       const uint32_t *pA,               /*!< [in] Pointers to the operands, of the modulus size. */
+			       const uint32_t *pB,
+			       const uint32_t *pC)
+{
+        CCError_t err;
+        uint32_t pkaReqRegs;
+
+        err = EcEdwInitPka(pDomain, 1, &pkaReqRegs);
+        if (err != CC_OK) {
+                return err;
+        }
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_SA, 1, pA, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_SB, 1, pB, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_EDW_REG_SC, 1, pC, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PKA_DIV(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_SQ/*not used*/, EC_EDW_REG_SA, EC_MONT_EDW_REG_N);
+        PKA_DIV(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_SQ/*not used*/, EC_EDW_REG_SB, EC_MONT_EDW_REG_N);
+        PKA_DIV(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_SQ/*not used*/, EC_EDW_REG_SC, EC_MONT_EDW_REG_N);
+        PKA_MOD_MUL_ACC(LEN_ID_N_BITS, EC_EDW_REG_SQ, EC_EDW_REG_SA, EC_EDW_REG_SB, EC_EDW_REG_SC);
+        PkaCopyDataFromPkaReg(pRes, EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_EDW_REG_SQ);
+
+        PkaFinishAndMutexUnlock(pkaReqRegs);
+        return CC_OK;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#include "cc_pal_mem.h"
+#include "cc_pal_types.h"
+#include "cc_ec_mont_edw_error.h"
+#include "pka_hw_defs.h"
+#include "pka.h"
+#include "pka_error.h"
+#include "ec_mont_edw_domain.h"
+#include "pka_ec_mont_edw.h"
+#include "pka_ec_mont_edw_regs.h"
+
+
+/***********    EcMontRegsCondSwap   function      **********************/
+/**
+ * @brief Swaps two PKA registers if the mask is all-ones, by exchanging their physical addresses
+ *        in the registers mapping table. Both entries of the table are written in both cases,
+ *        so the swap costs the same, whether the registers are exchanged or not.
+ *
+ * @return  - no return value.
+ */
+static void EcMontRegsCondSwap(uint32_t regA,     /*!< [in] Virtual address of the first register. */
+			       uint32_t regB,     /*!< [in] Virtual address of the second register. */
+			       uint32_t swapMask) /*!< [in] All-ones to swap, or zero. */
+{
+        uint32_t addrA, addrB, diff;
+
+        PKA_GET_REG_ADDRESS(regA, addrA);
+        PKA_GET_REG_ADDRESS(regB, addrB);
+        diff = (addrA ^ addrB) & swapMask;
+        PKA_SET_REG_ADDRESS(regA, addrA ^ diff);
+        PKA_SET_REG_ADDRESS(regB, addrB ^ diff);
+        return;
+}
+
+
+/***********    EcMontLadderStep   function      **********************/
+/**
+ * @brief One step of the Montgomery ladder (RFC 7748 5): the differential addition
+ *        (x3,z3) = (x2,z2) + (x3,z3) and the doubling (x2,z2) = 2*(x2,z2).
+ *
+ * @return  - no return value.
+ */
+static void EcMontLadderStep(void)
+{
+        /* A = x2 + z2, AA = A^2, B = x2 - z2, BB = B^2, E = AA - BB */
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_A, EC_MONT_REG_X2, EC_MONT_REG_Z2);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_AA, EC_MONT_REG_A, EC_MONT_REG_A);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_B, EC_MONT_REG_X2, EC_MONT_REG_Z2);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_BB, EC_MONT_REG_B, EC_MONT_REG_B);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_E, EC_MONT_REG_AA, EC_MONT_REG_BB);
+        /* C = x3 + z3, D = x3 - z3, DA = D*A, CB = C*B */
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_C, EC_MONT_REG_X3, EC_MONT_REG_Z3);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_D, EC_MONT_REG_X3, EC_MONT_REG_Z3);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_DA, EC_MONT_REG_D, EC_MONT_REG_A);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_CB, EC_MONT_REG_C, EC_MONT_REG_B);
+        /* x3 = (DA + CB)^2, z3 = u*(DA - CB)^2 */
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_X3, EC_MONT_REG_DA, EC_MONT_REG_CB);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_X3, EC_MONT_REG_X3, EC_MONT_REG_X3);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_Z3, EC_MONT_REG_DA, EC_MONT_REG_CB);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_Z3, EC_MONT_REG_Z3, EC_MONT_REG_Z3);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_Z3, EC_MONT_REG_Z3, EC_MONT_REG_U);
+        /* x2 = AA*BB, z2 = E*(AA + a24*E) */
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_X2, EC_MONT_REG_AA, EC_MONT_REG_BB);
+        PKA_MOD_MUL_ACC(LEN_ID_N_BITS, EC_MONT_REG_Z2, EC_MONT_REG_A24, EC_MONT_REG_E, EC_MONT_REG_AA);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_Z2, EC_MONT_REG_Z2, EC_MONT_REG_E);
+        return;
+}
+
+
+/***********    PkaEcMontScalarMult   function      **********************/
+/**
+ * @brief EC Montgomery scalar multiplication of the u-coordinate by the Montgomery ladder
+ *        (RFC 7748 5).
+ *
+ *  All the 255 bits of the scalar are processed by the same sequence of PKA operations;
+ *  the conditional swap of the ladder points is done in the registers mapping table.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ */
+CCError_t PkaEcMontScalarMult(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+			      uint32_t *pResU,                  /*!< [out] Pointer to the result u-coordinate. */
+			      const uint32_t *pScalar,          /*!< [in] Pointer to the clamped scalar. */
+			      const uint32_t *pU)               /*!< [in] Pointer to the input u-coordinate, less than 2^255. */
+{
+        CCError_t err;
+        uint32_t pkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+        uint32_t swap = 0, bit, swapMask;
+        int32_t i;
+
+        err = PkaInitAndMutexLock(EC_MONT_EDW_MOD_SIZE_IN_BITS, &pkaReqRegs);
+        if (err != CC_OK) {
+                return err;
+        }
+        PkaCopyDataIntoPkaReg(EC_MONT_EDW_REG_N, 1, pDomain->ecP, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_MONT_EDW_REG_NP, 1, pDomain->ecPTag, CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_MONT_REG_U, 1, pU, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_MONT_REG_A24, 1, &pDomain->ecMontA24, 1);
+
+        /* u may be non-canonical (p <= u < 2^255) */
+        PKA_DIV(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_A/*not used*/, EC_MONT_REG_U, EC_MONT_EDW_REG_N);
+
+        /* (x2,z2) = (1,0), (x3,z3) = (u,1) */
+        PKA_SET_VAL(EC_MONT_REG_X2, 1);
+        PKA_CLEAR(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_Z2);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_MONT_REG_X3, EC_MONT_REG_U);
+        PKA_SET_VAL(EC_MONT_REG_Z3, 1);
+
+        for (i = EC_MONT_EDW_MOD_SIZE_IN_BITS - 1; i >= 0; i--) {
+                bit = (pScalar[i >> 5] >> (i & 0x1F)) & 1UL;
+                swap ^= bit;
+                swapMask = 0U - swap;
+                EcMontRegsCondSwap(EC_MONT_REG_X2, EC_MONT_REG_X3, swapMask);
+                EcMontRegsCondSwap(EC_MONT_REG_Z2, EC_MONT_REG_Z3, swapMask);
+                swap = bit;
+                EcMontLadderStep();
+        }
+        swapMask = 0U - swap;
+        EcMontRegsCondSwap(EC_MONT_REG_X2, EC_MONT_REG_X3, swapMask);
+        EcMontRegsCondSwap(EC_MONT_REG_Z2, EC_MONT_REG_Z3, swapMask);
+
+        /* u = x2/z2 = x2*z2^(p-2), zero if z2 is zero */
+        PKA_MOD_INV_W_EXP(EC_MONT_REG_A, EC_MONT_REG_Z2, EC_MONT_REG_B);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_MONT_REG_X2, EC_MONT_REG_X2, EC_MONT_REG_A);
+        PkaCopyDataFromPkaReg(pResU, EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_MONT_REG_X2);
+
+        PkaFinishAndMutexUnlock(pkaReqRegs);
+        return CC_OK;
+}
+
+
+/***********    PkaEcMontScalarMultBase   function      **********************/
+/**
+ * @brief EC Montgomery scalar multiplication of the base point u = 9.
+ *
+ *  The multiplication is done on the birationally equivalent Edwards curve with the
+ *  fixed-base comb, and the result is mapped to u = (1 + y)/(1 - y) = (Z + Y)/(Z - Y).
+ *  The scalar is reduced modulo L first, since the base point is of order L.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ */
+CCError_t PkaEcMontScalarMultBase(const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+				  uint32_t *pResU,                  /*!< [out] Pointer to the result u-coordinate. */
+				  const uint32_t *pScalar)          /*!< [in] Pointer to the clamped scalar. */
+{
+        CCError_t err;
+        uint32_t pkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+        uint32_t k[EC_MONT_EDW_MOD_SIZE_IN_WORDS];
+
+        err = PkaEcEdwScalarReduce(pDomain, k, pScalar, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        if (err != CC_OK) {
+                goto End;
+        }
+
+        err = PkaInitAndMutexLock(EC_MONT_EDW_MOD_SIZE_IN_BITS, &pkaReqRegs);
+        if (err != CC_OK) {
+                goto End;
+        }
+        PkaCopyDataIntoPkaReg(EC_MONT_EDW_REG_N, 1, pDomain->ecP, EC_MONT_EDW_MOD_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(EC_MONT_EDW_REG_NP, 1, pDomain->ecPTag, CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+
+        PkaEcEdwCombMult(pDomain, k);
+
+        PKA_MOD_ADD(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T0, EC_EDW_REG_Z, EC_EDW_REG_Y);
+        PKA_MOD_SUB(LEN_ID_N_PKA_REG_BITS, EC_EDW_REG_T1, EC_EDW_REG_Z, EC_EDW_REG_Y);
+        PKA_MOD_INV_W_EXP(EC_EDW_REG_T2, EC_EDW_REG_T1, EC_EDW_REG_T3);
+        PKA_MOD_MUL(LEN_ID_N_BITS, EC_EDW_REG_T0, EC_EDW_REG_T0, EC_EDW_REG_T2);
+        PkaCopyDataFromPkaReg(pResU, EC_MONT_EDW_MOD_SIZE_IN_WORDS, EC_EDW_REG_T0);
+
+        PkaFinishAndMutexUnlock(pkaReqRegs);
+End:
+        CC_PalMemSetZero(k, sizeof(k));
+        return err;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef PKA_EC_MONT_EDW_H_H
+#define PKA_EC_MONT_EDW_H_H
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "cc_pal_types.h"
+#include "cc_error.h"
+#include "cc_ec_mont_edw_error.h"
+#include "pka_hw_defs.h"
+#include "pka.h"
+#include "ec_mont_edw_domain.h"
+
+/* size of a point in the cached form (Y+X, Y-X, 2*d*T, 2*Z) in words */
+#define EC_EDW_CACHED_POINT_SIZE_IN_WORDS      (4*EC_MONT_EDW_MOD_SIZE_IN_WORDS)
+/* maximal count of digits of the NAF of a scalar less than 2^256 */
+#define EC_EDW_NAF_MAX_LENGTH                  (CC_BITS_IN_32BIT_WORD*EC_MONT_EDW_MOD_SIZE_IN_WORDS + 1)
+/* size of the temporary buffer of PkaEcEdwDoubleScalarMult() in words: the odd multiples
+   of the public key and the NAF of both scalars */
+#define EC_EDW_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS  \
+        (EC_EDW_WNAF_POINTS_COUNT*EC_EDW_CACHED_POINT_SIZE_IN_WORDS + 2*CALC_32BIT_WORDS_FROM_BYTES(EC_EDW_NAF_MAX_LENGTH))
+
+
+/* EC Edwards fixed-base comb multiplication, inside an open PKA session with the field modulus */
+void PkaEcEdwCombMult(
+		const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+		const uint32_t *pScalar);         /*!< [in] Pointer to the scalar, less than L. */
+
+/* EC Edwards scalar reduction modulo L */
+CCError_t PkaEcEdwScalarReduce(
+		const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+		uint32_t *pRes,                   /*!< [out] Pointer to the result, of the modulus size. */
+		const uint32_t *pScalar,          /*!< [in] Pointer to the scalar. */
+		uint32_t scalarSizeInWords);      /*!< [in] The scalar size in words, up to 2*modulus size. */
+
+/* EC Edwards scalar multiply-add modulo L: res = a*b + c mod L */
+CCError_t PkaEcEdwScalarMulAdd(
+		const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+		uint32_t *pRes,                   /*!< [out] Pointer to the result. */
+		const uint32_t *pA,               /*!< [in] Pointers to the operands, of the modulus size. */
+		const uint32_t *pB,
+		const uint32_t *pC);
+
+/* EC Edwards multiplication of the base point, with encoded result */
+CCError_t PkaEcEdwScalarMultBase(
+		const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+		uint32_t *pEncPoint,              /*!< [out] Pointer to the encoded result. */
+		const uint32_t *pScalar);         /*!< [in] Pointer to the scalar, less than L. */
+
+/* EC Edwards double scalar multiplication S*B - k*A, with encoded result */
+CCError_t PkaEcEdwDoubleScalarMult(
+		const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+		uint32_t *pEncPoint,              /*!< [out] Pointer to the encoded result. */
+		const uint32_t *pScalarS,         /*!< [in] Pointer to the scalar of the base point. */
+		const uint32_t *pScalarK,         /*!< [in] Pointer to the scalar of the point A. */
+		const uint32_t *pEncPointA,       /*!< [in] Pointer to the encoded point A. */
+		uint32_t *pTempBuff);             /*!< [in] Temporary buffer of EC_EDW_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
+
+/* EC Montgomery ladder: the u-coordinate of scalar * (u, .) */
+CCError_t PkaEcMontScalarMult(
+		const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+		uint32_t *pResU,                  /*!< [out] Pointer to the result u-coordinate. */
+		const uint32_t *pScalar,          /*!< [in] Pointer to the clamped scalar. */
+		const uint32_t *pU);              /*!< [in] Pointer to the input u-coordinate, less than 2^255. */
+
+/* EC Montgomery multiplication of the base point u = 9 */
+CCError_t PkaEcMontScalarMultBase(
+		const EcMontEdwDomain_t *pDomain, /*!< [in] Pointer to the domain. */
+		uint32_t *pResU,                  /*!< [out] Pointer to the result u-coordinate. */
+		const uint32_t *pScalar);         /*!< [in] Pointer to the clamped scalar. */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+ #ifndef PKA_EC_MONT_EDW_REGS_DEF_H
+ #define PKA_EC_MONT_EDW_REGS_DEF_H
+
+ /* Define global PKA registers pointers */
+ #define EC_MONT_EDW_REG_N      PKA_REG_N
+ #define EC_MONT_EDW_REG_NP     PKA_REG_NP
+
+ /* Montgomery ladder: the input u, the ladder points (x2,z2), (x3,z3), (A-2)/4, temps */
+ #define EC_MONT_REG_U      2
+ #define EC_MONT_REG_X2     3
+ #define EC_MONT_REG_Z2     4
+ #define EC_MONT_REG_X3     5
+ #define EC_MONT_REG_Z3     6
+ #define EC_MONT_REG_A24    7
+ #define EC_MONT_REG_A      8
+ #define EC_MONT_REG_AA     9
+ #define EC_MONT_REG_B      10
+ #define EC_MONT_REG_BB     11
+ #define EC_MONT_REG_E      12
+ #define EC_MONT_REG_C      13
+ #define EC_MONT_REG_D      14
+ #define EC_MONT_REG_DA     15
+ #define EC_MONT_REG_CB     16
+
+ /* Edwards curve: the accumulated point (X,Y,Z,T), 2*d, the added point (Y+X, Y-X, 2*d*T, 2*Z)
+    of the niels form (Z = 1) or of the cached form, the negated 2*d*T, temps */
+ #define EC_EDW_REG_X       2
+ #define EC_EDW_REG_Y       3
+ #define EC_EDW_REG_Z       4
+ #define EC_EDW_REG_T       5
+ #define EC_EDW_REG_D2      6
+ #define EC_EDW_REG_PYPX    7
+ #define EC_EDW_REG_PYMX    8
+ #define EC_EDW_REG_PT2D    9
+ #define EC_EDW_REG_PZ2     10
+ #define EC_EDW_REG_PT2DN   11
+ #define EC_EDW_REG_T0      12
+ #define EC_EDW_REG_T1      13
+ #define EC_EDW_REG_T2      14
+ #define EC_EDW_REG_T3      15
+ #define EC_EDW_REG_T4      16
+ #define EC_EDW_REG_T5      17
+ #define EC_EDW_REG_T6      18
+ #define EC_EDW_REG_T7      19
+ /* the decompressed public key: x, y */
+ #define EC_EDW_REG_AX      20
+ #define EC_EDW_REG_AY      21
+ /* scalars modulo L */
+ #define EC_EDW_REG_SA      2
+ #define EC_EDW_REG_SB      3
+ #define EC_EDW_REG_SC      4
+ #define EC_EDW_REG_SQ      5
+#endif
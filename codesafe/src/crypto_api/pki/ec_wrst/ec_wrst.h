@@ -21,6 +21,7 @@ extern "C"
 #include "cc_pal_types.h"
 #include "cc_rnd_common.h"
 #include "cc_ecpki_types.h"
+#include "pka.h"
 
 
 /* Temporary buffers used for the functions called from ECDSA */
@@ -34,6 +35,18 @@ typedef struct{
 	CCEcdsaVerifyIntBuff_t tempBuff;
 }EcWrstDsaVerifyDb_t;
 
+/* width of the window NAF of the double scalar multiplication */
+#define EC_WRST_WNAF_WIDTH          4
+/* count of precomputed odd multiples of a point: P, 3P, ..., (2^(w-1) - 1)P */
+#define EC_WRST_WNAF_POINTS_COUNT   (1UL << (EC_WRST_WNAF_WIDTH - 2))
+/* maximal count of window NAF digits of a scalar */
+#define EC_WRST_WNAF_MAX_DIGITS     (CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS*32 + 1)
+/* size of the temporary buffer of PkaSum2ScalarMullt() in words: the odd multiples of
+   both points, the comb recoding of the first scalar and the window NAF of both scalars */
+#define EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS  \
+	(2*EC_WRST_WNAF_POINTS_COUNT*2*CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS + 2*CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + 1 + \
+	 2*CALC_32BIT_WORDS_FROM_BYTES(EC_WRST_WNAF_MAX_DIGITS))
+
 
 /* internal ECPKI buffer structure used on LLF and containing Barrett tags for*
 *  modulus and gen.order                                                      */
@@ -97,7 +110,16 @@ CCError_t EcWrstDsaVerify(CCEcpkiPublKey_t *signPublKey,
 		            uint32_t  *messageRepresent,
 		            uint32_t   messRepresSizeWords,
 		            uint32_t  *signC,
-		            uint32_t  *signD);
+		            uint32_t  *signD,
+		            uint32_t  *pTempBuff);
+
+CCError_t EcWrstDsaVerifyInSession(PkaSession_t *pSession,
+		            CCEcpkiPublKey_t *signPublKey,
+		            uint32_t  *messageRepresent,
+		            uint32_t   messRepresSizeWords,
+		            uint32_t  *signC,
+		            uint32_t  *signD,
+		            uint32_t  *pTempBuff);
 
 
 
@@ -21,6 +21,8 @@
 #include "pka_ec_wrst_glob_regs.h"
 #include "pka_ec_wrst_dsa_verify_regs.h"
 #include "cc_rnd_local.h"
+#include "cc_ecpki_domain.h"
+#include "pka_error.h"
 
 
 /* canceling the lint warning:
@@ -252,9 +254,8 @@ CCError_t EcWrstDsaSign(
 
         /* Calculate ephemeral public key               */
         funcTmpBuff = pMaxVect; /* because pMaxVect not needed yet */
-        err = PkaEcWrstScalarMult(pDomain,
+        err = PkaEcWrstScalarMultBase(pDomain,
                                   pEphemKeyBuf/*scalar*/, ordSizeInWords, /*scalar size*/
-                                  (uint32_t*)&pDomain->ecGx, (uint32_t*)&pDomain->ecGy, /*in point coordinates*/
                                   pEphemPublX/*C*/, pEphemPublY,  /*out point coordinates*/
                                   funcTmpBuff);
         if (err) {
@@ -286,25 +287,48 @@ CCError_t EcWrstDsaSign(
 }
 
 
-/***********      EcWrstDsaVerify function      **********************/
+/***********      EcWrstDsaResidentDomainId function      **********************/
 /**
- * @brief Verifies the signature.
+ * @brief Returns the identifier of the domain for keeping its constants resident in a
+ *        PKA session: the library copy of the domain if the given domain is identical to it.
  *
- * @author reuvenl (8/7/2014)
+ * @return  The library domain, or NULL if the domain is not a library domain.
+ */
+static const void *EcWrstDsaResidentDomainId(const CCEcpkiDomain_t *pDomain) /*!< [in] The EC domain. */
+{
+    const CCEcpkiDomain_t *pLibDomain = CC_EcpkiGetEcDomain(pDomain->DomainID);
+
+    if ((pLibDomain == NULL) ||
+        (CC_PalMemCmp(pLibDomain, pDomain, sizeof(CCEcpkiDomain_t)) != 0)) {
+        return NULL;
+    }
+    return pLibDomain;
+}
+
+
+/***********      EcWrstDsaVerifyInSession function      **********************/
+/**
+ * @brief Verifies the signature within an open PKA session.
+ *
+ *        The session must be opened with the maximum of the domain modulus and order sizes.
+ *        The constants of a library domain (order, modulus, their Barrett tags, G and A) stay
+ *        resident in the session, so a run of verifications over the same curve loads only
+ *        the public key, the signature and the message representative.
  *
  * @return  CC_OK On success, otherwise indicates failure
  */
-CCError_t EcWrstDsaVerify(CCEcpkiPublKey_t *pSignPublKey,   /*!< [in] Pointer to signer public key structure. */
+CCError_t EcWrstDsaVerifyInSession(PkaSession_t *pSession,         /*!< [in/out] Open PKA session. */
+                          CCEcpkiPublKey_t *pSignPublKey,   /*!< [in] Pointer to signer public key structure. */
                           uint32_t  *pMsgRepres,         /*!< [in] The pointer to the message representative buffer.*/
                           uint32_t   msgRepresSizeWords, /*!< [in] Size of the message representative buffer in words.*/
                           uint32_t  *pSignC,	        /*!< [in] Pointer to C-part of the signature (called also R-part). */
-                          uint32_t  *pSignD)          /*!< [in] Pointer to D-part of the signature (called also S-part). */
+                          uint32_t  *pSignD,          /*!< [in] Pointer to D-part of the signature (called also S-part). */
+                          uint32_t  *pTempBuff)       /*!< [in] Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
 {
     CCError_t err = CC_OK;
     const CCEcpkiDomain_t *domain = &pSignPublKey->domain;
     EcWrstDomain_t *llfBuff = (EcWrstDomain_t*)&pSignPublKey->domain.llfBuff;
     int32_t modSizeInBits, modSizeInWords, ordSizeInBits, ordSizeInWords;
-    uint32_t pkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
 
 
     /* set domain parameters */
@@ -316,41 +340,98 @@ CCError_t EcWrstDsaVerify(CCEcpkiPublKey_t *pSignPublKey,   /*!< [in] Pointer to
             (modSizeInWords > CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS)) {
         return ECWRST_SCALAR_MULT_INVALID_MOD_ORDER_SIZE_ERROR;
     }
-
-    /*  Init PKA for modular operations with EC modulus or EC order and   *
-     *   registers size according to maximal of them                       */
-    err = PkaInitAndMutexLock(CC_MAX(ordSizeInBits, modSizeInBits), &pkaReqRegs);
-    if (err != CC_OK) {
-        return err;
+    if ((pSession == NULL) || (pSession->isOpen == 0)) {
+        return PKA_SESSION_STATE_ERROR;
     }
+    if (pSession->sizeInBits != (uint32_t)CC_MAX(ordSizeInBits, modSizeInBits)) {
+        return PKA_SESSION_SIZE_ERROR;
+    }
+
     /* set order and modulus mod sizes */
     CC_HAL_WRITE_REGISTER(CC_REG_OFFSET (CRY_KERNEL, PKA_L0), ordSizeInBits);
     CC_HAL_WRITE_REGISTER(CC_REG_OFFSET (CRY_KERNEL, PKA_L2), modSizeInBits);
 
-    /* Set input data into PKA registers */
-    /* EC order and its Barrett tag */
-    PkaCopyDataIntoPkaReg(ECC_REG_N/*dest_reg*/, 1, domain->ecR/*src_ptr*/, ordSizeInWords);
-    PkaCopyDataIntoPkaReg(ECC_REG_NP, 1, llfBuff->ordTag, CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+    if (PkaSessionSelectKey(pSession, EcWrstDsaResidentDomainId(domain)) == CC_FALSE) {
+        /* Set domain data into PKA registers */
+        /* EC order and its Barrett tag */
+        PkaCopyDataIntoPkaReg(ECC_REG_N/*dest_reg*/, 1, domain->ecR/*src_ptr*/, ordSizeInWords);
+        PkaCopyDataIntoPkaReg(ECC_REG_NP, 1, llfBuff->ordTag, CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+        /* Load modulus and its Barrett tag */
+        PkaCopyDataIntoPkaReg(EC_VERIFY_REG_TMP_N, 1, domain->ecP, modSizeInWords);
+        PkaCopyDataIntoPkaReg(EC_VERIFY_REG_TMP_NP, 1, llfBuff->modTag, CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+        /* set pG */
+        PkaCopyDataIntoPkaReg(EC_VERIFY_REG_P_GX, 1, domain->ecGx, modSizeInWords);
+        PkaCopyDataIntoPkaReg(EC_VERIFY_REG_P_GY, 1, domain->ecGy, modSizeInWords);
+        PkaCopyDataIntoPkaReg(ECC_REG_EC_A, 1, domain->ecA, modSizeInWords);
+    } else {
+        /* the previous verification left the modulus in N and the order in TMP_N:
+           swap them back and reload the order Barrett tag */
+        PKA_CLEAR(LEN_ID_N_PKA_REG_BITS, PKA_REG_T0);
+        PKA_CLEAR(LEN_ID_N_PKA_REG_BITS, PKA_REG_T1);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_VERIFY_REG_TMP, ECC_REG_N);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, ECC_REG_N, EC_VERIFY_REG_TMP_N);
+        PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_VERIFY_REG_TMP_N, EC_VERIFY_REG_TMP);
+        PKA_WAIT_ON_PKA_DONE();
+        PkaCopyDataIntoPkaReg(ECC_REG_NP, 1, llfBuff->ordTag, CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+    }
+
     /* signature C, D */
     PkaCopyDataIntoPkaReg(EC_VERIFY_REG_C, 1, pSignC, ordSizeInWords);
     PkaCopyDataIntoPkaReg(EC_VERIFY_REG_D, 1, pSignD, ordSizeInWords);
     /* message representative EC_VERIFY_REG_F */
     PkaCopyDataIntoPkaReg(EC_VERIFY_REG_F, 1, pMsgRepres, msgRepresSizeWords);
-    /* Load modulus and its Barrett tag */
-    PkaCopyDataIntoPkaReg(EC_VERIFY_REG_TMP_N, 1, domain->ecP, modSizeInWords);
-    PkaCopyDataIntoPkaReg(EC_VERIFY_REG_TMP_NP, 1, llfBuff->modTag, CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
-    /* set pG */
-    PkaCopyDataIntoPkaReg(EC_VERIFY_REG_P_GX, 1, domain->ecGx, modSizeInWords);
-    PkaCopyDataIntoPkaReg(EC_VERIFY_REG_P_GY, 1, domain->ecGy, modSizeInWords);
     /* set pW */
     PkaCopyDataIntoPkaReg(EC_VERIFY_REG_P_WX, 1, pSignPublKey->x, modSizeInWords);
     PkaCopyDataIntoPkaReg(EC_VERIFY_REG_P_WY, 1, pSignPublKey->y, modSizeInWords);
-    PkaCopyDataIntoPkaReg(ECC_REG_EC_A, 1, domain->ecA, modSizeInWords);
 
     /* Verify */
-    err = PkaEcdsaVerify();
+    err = PkaEcdsaVerify(domain, pTempBuff);
 
-    PkaFinishAndMutexUnlock(pkaReqRegs);
+    /* only a verification that reached the final comparison leaves the domain
+       registers in the known swapped state */
+    if ((err != CC_OK) && (err != ECWRST_DSA_VERIFY_CALC_SIGNATURE_IS_INVALID)) {
+        PkaSessionInvalidate(pSession);
+    }
+
+    return err;
+}
+
+
+/***********      EcWrstDsaVerify function      **********************/
+/**
+ * @brief Verifies the signature in its own PKA session.
+ *
+ * @author reuvenl (8/7/2014)
+ *
+ * @return  CC_OK On success, otherwise indicates failure
+ */
+CCError_t EcWrstDsaVerify(CCEcpkiPublKey_t *pSignPublKey,   /*!< [in] Pointer to signer public key structure. */
+                          uint32_t  *pMsgRepres,         /*!< [in] The pointer to the message representative buffer.*/
+                          uint32_t   msgRepresSizeWords, /*!< [in] Size of the message representative buffer in words.*/
+                          uint32_t  *pSignC,	        /*!< [in] Pointer to C-part of the signature (called also R-part). */
+                          uint32_t  *pSignD,          /*!< [in] Pointer to D-part of the signature (called also S-part). */
+                          uint32_t  *pTempBuff)       /*!< [in] Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
+{
+    CCError_t err = CC_OK;
+    const CCEcpkiDomain_t *domain = &pSignPublKey->domain;
+    PkaSession_t session;
+    uint32_t pkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+
+    if ((CALC_FULL_32BIT_WORDS(domain->ordSizeInBits) > (CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS + 1)) ||
+            (CALC_FULL_32BIT_WORDS(domain->modSizeInBits) > CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS)) {
+        return ECWRST_SCALAR_MULT_INVALID_MOD_ORDER_SIZE_ERROR;
+    }
+
+    /*  Init PKA for modular operations with EC modulus or EC order and   *
+     *   registers size according to maximal of them                       */
+    err = PkaSessionOpen(&session, CC_MAX(domain->ordSizeInBits, domain->modSizeInBits), &pkaReqRegs);
+    if (err != CC_OK) {
+        return err;
+    }
+
+    err = EcWrstDsaVerifyInSession(&session, pSignPublKey, pMsgRepres, msgRepresSizeWords, pSignC, pSignD, pTempBuff);
+
+    PkaSessionClose(&session);
 
     return err;
 
@@ -37,7 +37,8 @@ CCError_t EcWrstDsaVerify(CCEcpkiPublKey_t *pSignPublKey,   /*!< [in] Pointer to
 			    uint32_t  *pMsgRepres,         /*!< [in] The pointer to the message representative buffer.*/
 			    uint32_t   msgRepresSizeWords, /*!< [in] Size of the message representative buffer in words.*/
 			    uint32_t  *pSignC,	        /*!< [in] Pointer to C-part of the signature (called also R-part). */
-			    uint32_t  *pSignD)          /*!< [in] Pointer to D-part of the signature (called also S-part). */
+			    uint32_t  *pSignD,          /*!< [in] Pointer to D-part of the signature (called also S-part). */
+			    uint32_t  *pTempBuff)       /*!< [in] Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
 {
 	CCError_t err = CC_OK;
 	const CCEcpkiDomain_t *domain = &pSignPublKey->domain;
@@ -83,7 +84,7 @@ CCError_t EcWrstDsaVerify(CCEcpkiPublKey_t *pSignPublKey,   /*!< [in] Pointer to
 	PkaCopyDataIntoPkaReg(ECC_REG_EC_A, 1, domain->ecA, modSizeInWords);
 
 	/* Verify */
-	err = PkaEcdsaVerify();
+	err = PkaEcdsaVerify(domain, pTempBuff);
 
     PkaFinishAndMutexUnlock(pkaReqRegs);
 
@@ -21,7 +21,8 @@
  *      1. Checks the validity of all of the function inputs. If one of the received
  *         parameters is not valid, it returns an error.
  *      2. Cleans buffers and generates random private key.
- *      3. Calls the low level function PkaEcWrstScalarMult to generate EC public key.
+ *      3. Calls the low level function PkaEcWrstScalarMult (PkaEcWrstScalarMultBase if the base
+ *         point is the domain generator) to generate EC public key.
  *      4. Outputs the user public and private key structures in little endian form.
  *      5. Cleans temporary buffers.
  *      6. Exits.
@@ -38,7 +39,7 @@ CEXPORT_C CCError_t EcWrstGenKeyPairBase(const CCEcpkiDomain_t  *pDomain,
     CCError_t err = CC_OK;
     CCEcpkiPrivKey_t *pPrivKey;
     CCEcpkiPublKey_t *pPublKey;
-    uint32_t  orderSizeInWords;
+    uint32_t  orderSizeInWords, modSizeInBytes;
 
     if (pDomain == NULL)
         return CC_ECPKI_DOMAIN_PTR_ERROR;
@@ -61,12 +62,21 @@ CEXPORT_C CCError_t EcWrstGenKeyPairBase(const CCEcpkiDomain_t  *pDomain,
 
     orderSizeInWords = (pDomain->ordSizeInBits+CC_BITS_IN_32BIT_WORD-1)/CC_BITS_IN_32BIT_WORD;
 
-    /* calculate public key point coordinates */
-    err = PkaEcWrstScalarMult(pDomain,
-                              pPrivKey->PrivKey/*scalar*/, orderSizeInWords, /*scalar size*/
-                              ecX, ecY, /*in point coordinates*/
-                              pPublKey->x, pPublKey->y,  /*out point coordinates*/
-                              (uint32_t*)pTempBuff);
+    /* calculate public key point coordinates; the generator has a faster fixed-base path */
+    modSizeInBytes = CALC_FULL_32BIT_WORDS(pDomain->modSizeInBits)*sizeof(uint32_t);
+    if ((CC_PalMemCmp(ecX, pDomain->ecGx, modSizeInBytes) == 0) &&
+        (CC_PalMemCmp(ecY, pDomain->ecGy, modSizeInBytes) == 0)) {
+        err = PkaEcWrstScalarMultBase(pDomain,
+                                  pPrivKey->PrivKey/*scalar*/, orderSizeInWords, /*scalar size*/
+                                  pPublKey->x, pPublKey->y,  /*out point coordinates*/
+                                  (uint32_t*)pTempBuff);
+    } else {
+        err = PkaEcWrstScalarMult(pDomain,
+                                  pPrivKey->PrivKey/*scalar*/, orderSizeInWords, /*scalar size*/
+                                  ecX, ecY, /*in point coordinates*/
+                                  pPublKey->x, pPublKey->y,  /*out point coordinates*/
+                                  (uint32_t*)pTempBuff);
+    }
     if(err) {
         err = CC_ECPKI_INTERNAL_ERROR;
         goto End;
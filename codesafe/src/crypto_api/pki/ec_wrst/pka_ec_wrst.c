@@ -7,6 +7,7 @@
 
 #include "cc_pal_mem.h"
 #include "cc_pal_types.h"
+#include "cc_pal_compiler.h"
 #include "cc_hal_plat.h"
 #include "cc_common_math.h"
 #include "cc_ecpki_error.h"
@@ -193,15 +194,173 @@ void PkaAddAff(
 	return;
 }
 
+/* the layout of the temporary buffer of PkaSum2ScalarMullt() */
+typedef struct {
+	uint32_t pointsP[EC_WRST_WNAF_POINTS_COUNT*2*CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS];
+	uint32_t pointsQ[EC_WRST_WNAF_POINTS_COUNT*2*CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS];
+	uint32_t kt[CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS];
+	uint32_t comb[CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + 1];
+	int8_t   nafP[EC_WRST_WNAF_MAX_DIGITS];
+	int8_t   nafQ[EC_WRST_WNAF_MAX_DIGITS];
+} EcWrstDoubleMultTemp_t;
+
+CC_PAL_COMPILER_ASSERT(sizeof(EcWrstDoubleMultTemp_t) <= EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS*sizeof(uint32_t),
+		       "EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS is too small");
+CC_PAL_COMPILER_ASSERT(EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS <= CC_PKA_ECDSA_VERIFY_2MUL_BUFF_MAX_LENGTH_IN_WORDS,
+		       "CC_PKA_ECDSA_VERIFY_2MUL_BUFF_MAX_LENGTH_IN_WORDS is too small");
+
+/***********    EcWrstBuildWnaf   function      **********************/
+/**
+ * @brief The function builds the width-w NAF of the scalar placed in PKA register:
+ *        non zero digits are odd, less than 2^(w-1) by absolute value and separated
+ *        by at least w-1 zero digits.
+ *        The function is not constant time. Besides the verification, it is used by the
+ *        SM2 key exchange with secret scalars, so the local copy of the scalar is cleared
+ *        here and the caller clears the digits.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ */
+static uint32_t EcWrstBuildWnaf(const uint32_t k,    /*!< [in] Pka register holding the scalar. */
+				int8_t *pNaf,        /*!< [out] Digits, the least significant first. */
+				uint32_t *pCount)    /*!< [out] Count of digits. */
+{
+	uint32_t kt[CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + 1];
+	uint32_t kSizeInWords, i, carry, count = 0;
+	int32_t d;
+
+	kSizeInWords = CALC_FULL_32BIT_WORDS(PkaGetRegEffectiveSizeInBits(k));
+	if (kSizeInWords > CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS) {
+		return ECWRST_SCALAR_MULT_INVALID_MOD_ORDER_SIZE_ERROR;
+	}
+	CC_PalMemSetZero(kt, sizeof(kt));
+	PkaCopyDataFromPkaReg(kt, kSizeInWords, k);
+
+	while (kSizeInWords > 0) {
+		d = 0;
+		if (kt[0] & 1UL) {
+			d = (int32_t)(kt[0] & ((1UL << EC_WRST_WNAF_WIDTH) - 1));
+			if (d >= (1L << (EC_WRST_WNAF_WIDTH - 1))) {
+				/* negative digit: k += |d| */
+				d -= (1L << EC_WRST_WNAF_WIDTH);
+				carry = (uint32_t)(-d);
+				for (i = 0; (carry != 0) && (i <= kSizeInWords); i++) {
+					kt[i] += carry;
+					carry = (kt[i] < carry) ? 1 : 0;
+				}
+				if (kt[kSizeInWords] != 0) {
+					kSizeInWords++;
+				}
+			} else {
+				/* k -= d, only the low bits are cleared */
+				kt[0] -= (uint32_t)d;
+			}
+		}
+		pNaf[count++] = (int8_t)d;
+
+		/* k >>= 1 */
+		for (i = 0; i < kSizeInWords - 1; i++) {
+			kt[i] = (kt[i] >> 1) | (kt[i+1] << 31);
+		}
+		kt[kSizeInWords - 1] >>= 1;
+		if (kt[kSizeInWords - 1] == 0) {
+			kSizeInWords--;
+		}
+	}
+	*pCount = count;
+
+	CC_PalMemSetZero(kt, sizeof(kt));
+	return CC_OK;
+}
+
+/***********    PkaEcWrstOddMultiples   function      **********************/
+/**
+ * @brief The function calculates the odd multiples P, 3P, ..., (2^(w-1) - 1)P of the EC point
+ *        in affine coordinates and outputs them into the buffer.
+ *        Registers EC_VERIFY_REG_XPQ, EC_VERIFY_REG_YPQ, EC_VERIFY_REG_ZR, EC_VERIFY_REG_TR
+ *        and the work registers are changed.
+ *
+ * @return  - no return value.
+ */
+static void PkaEcWrstOddMultiples(
+				 const uint32_t xp, const uint32_t yp, /*!< [in] Pka register holding P coordinates. */
+				 const uint32_t xw, const uint32_t yw, /*!< [in] Pka work registers. */
+				 uint32_t *pPoints,                    /*!< [out] Buffer for x,y of the multiples. */
+				 uint32_t modSizeInWords)              /*!< [in] Size of the modulus in words. */
+{
+	uint32_t i;
+
+	/* 2P in affine coordinates */
+	PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_VERIFY_REG_XPQ, xp);
+	PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_VERIFY_REG_YPQ, yp);
+	PKA_SET_VAL(EC_VERIFY_REG_ZR, 1);
+	PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_VERIFY_REG_TR, ECC_REG_EC_A);
+	PkaDoubleMdf2Jcb(EC_VERIFY_REG_XPQ,EC_VERIFY_REG_YPQ,EC_VERIFY_REG_ZR,
+			 EC_VERIFY_REG_XPQ,EC_VERIFY_REG_YPQ,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR);
+	PkaJcb2Afn(SCAP_Inactive, EC_VERIFY_REG_XPQ, EC_VERIFY_REG_YPQ, EC_VERIFY_REG_ZR);
+
+	/* (2i+1)P = (2i-1)P + 2P */
+	PKA_COPY(LEN_ID_N_PKA_REG_BITS, xw, xp);
+	PKA_COPY(LEN_ID_N_PKA_REG_BITS, yw, yp);
+	for (i = 0; i < EC_WRST_WNAF_POINTS_COUNT; i++) {
+		if (i > 0) {
+			PkaAddAff(xw, yw, xw, yw, EC_VERIFY_REG_XPQ, EC_VERIFY_REG_YPQ);
+		}
+		PkaCopyDataFromPkaReg(pPoints, modSizeInWords, xw);
+		PkaCopyDataFromPkaReg(pPoints + modSizeInWords, modSizeInWords, yw);
+		pPoints += 2*modSizeInWords;
+	}
+	return;
+}
+
+/***********    PkaEcWrstAddPoint   function      **********************/
+/**
+ * @brief The function adds the affine EC point given in the buffer (or its negation) to
+ *        the point R = (xr, yr, EC_VERIFY_REG_ZR, EC_VERIFY_REG_TR) in jacobian coordinates.
+ *        If R is not initialized yet, it is set to the point.
+ *
+ * @return  - no return value.
+ */
+static void PkaEcWrstAddPoint(
+			     const uint32_t xr, const uint32_t yr, /*!< [in/out] Pka register holding R coordinates. */
+			     const uint32_t *pPoint,               /*!< [in] Buffer holding x,y of the point. */
+			     uint32_t isNeg,                       /*!< [in] Non zero if the point must be negated. */
+			     uint32_t modSizeInWords,              /*!< [in] Size of the modulus in words. */
+			     uint32_t *pIsInit)                    /*!< [in/out] Indicator, that R is initialized. */
+{
+	PkaCopyDataIntoPkaReg(EC_VERIFY_REG_XPQ, 1, pPoint, modSizeInWords);
+	PkaCopyDataIntoPkaReg(EC_VERIFY_REG_YPQ, 1, pPoint + modSizeInWords, modSizeInWords);
+	if (isNeg) {
+		PKA_SUB(LEN_ID_N_PKA_REG_BITS, EC_VERIFY_REG_YPQ, ECC_REG_N, EC_VERIFY_REG_YPQ);
+	}
+
+	if (*pIsInit == CC_FALSE) {
+		PKA_COPY(LEN_ID_N_PKA_REG_BITS, xr, EC_VERIFY_REG_XPQ);
+		PKA_COPY(LEN_ID_N_PKA_REG_BITS, yr, EC_VERIFY_REG_YPQ);
+		PKA_SET_VAL(EC_VERIFY_REG_ZR, 1);
+		PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_VERIFY_REG_TR, ECC_REG_EC_A);
+		*pIsInit = CC_TRUE;
+	} else {
+		PkaAddJcbAfn2Mdf(xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR, xr,yr,EC_VERIFY_REG_ZR,
+				 EC_VERIFY_REG_XPQ,EC_VERIFY_REG_YPQ);
+	}
+	return;
+}
+
 /***********    PkaSum2ScalarMullt   function      **********************/
 /**
  * @brief The function calculates simultaneously summ of two scalar
- * multiplications of EC points.
- *
- * Used the Strauss algorithm, optimized by A.Klimow:
+ * multiplications of EC points:
  *     R = a*P + b*Q, where R,P,Q - EC points, a,b - scalars.
  *
- * @author reuvenl (8/26/2014)
+ * Used the interleaved window NAF method: both scalars are recoded to width-4 NAF and share
+ * one chain of doublings, and the odd multiples P, 3P, 5P, 7P and Q, 3Q, 5Q, 7Q are
+ * precomputed in affine coordinates. If P is the generator of a domain with a fixed-base
+ * comb table, a*P is added by the comb columns at the last (spacing) doublings of the chain
+ * instead, without the precomputation.
+ * The digits and the multiples are kept in the caller's temporary buffer.
+ * The function is not constant time. It is used by the verification and by the SM2 key
+ * exchange, whose scalars are secret, so the digits and the copies of the scalars are
+ * cleared on exit.
  *
  * @return  - On success CC_OK is returned, on failure an error code.
  */
@@ -210,12 +369,26 @@ uint32_t PkaSum2ScalarMullt(
 			   const uint32_t a,			 /*!< [in] Pka register holding scalar a. */
 			   const uint32_t xp, const uint32_t yp, /*!< [in] Pka register holding P coordinates. */
 			   const uint32_t b,			 /*!< [in] Pka register holding scalar b. */
-			   const uint32_t xq, const uint32_t yq) /*!< [in] Pka register holding Q coordinates. */
+			   const uint32_t xq, const uint32_t yq, /*!< [in] Pka register holding Q coordinates. */
+			   const CCEcpkiDomain_t *pDomain,	 /*!< [in] Pointer to EC domain, if P is its generator;
+								       otherwise NULL. */
+			   uint32_t *pTempBuff)			 /*!< [in] Temporary buffer of
+								       EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
 {
-	uint32_t wA, wB, err = 0;
-	uint32_t stat;
-	int32_t b2, i;
-	uint32_t isNewA=true, isNewB=true;
+	uint32_t err = 0;
+	uint32_t stat, modSizeInWords, countP, countQ, isNegP = 0;
+	uint32_t isInit = CC_FALSE;
+	EcWrstDoubleMultTemp_t *pTemp = (EcWrstDoubleMultTemp_t*)pTempBuff;
+	int8_t *nafP = pTemp->nafP;
+	int8_t *nafQ = pTemp->nafQ;
+	const uint32_t *pPointP;
+	int32_t i;
+#ifdef CC_SUPPORT_ECC_FIXED_BASE_COMB
+	const CCEcpkiCombTable_t *pTable = NULL;
+	uint32_t kSizeInWords, negMask = 0, index;
+#else
+	CC_UNUSED_PARAM(pDomain);
+#endif
 
 	/* check that a>0 and b>0 */
 	PKA_COMPARE_IM_STATUS(LEN_ID_N_PKA_REG_BITS, a, 0, stat);
@@ -229,64 +402,79 @@ uint32_t PkaSum2ScalarMullt(
 		goto End;
 	}
 
-	/* get max effective size of factors minus 1 */
-	i = CC_MAX(PkaGetRegEffectiveSizeInBits(a), PkaGetRegEffectiveSizeInBits(b)) - 1;
-
-	PkaAddAff(EC_VERIFY_REG_XPQ, EC_VERIFY_REG_YPQ, xp,yp, xq,yq); // p+q
-
-#ifdef ARM_DSM
-	*((volatile uint32_t *)(uint32_t)(0x44440000)) = i;
-#endif
+	PKA_WAIT_ON_PKA_DONE();
+	modSizeInWords = CALC_FULL_32BIT_WORDS(CC_HAL_READ_REGISTER(CC_REG_OFFSET (CRY_KERNEL, PKA_L0)));
+	if (modSizeInWords > CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS) {
+		err = ECWRST_SCALAR_MULT_INVALID_MOD_ORDER_SIZE_ERROR;
+		goto End;
+	}
 
-	b2 = PkaGetNextMsBit(a, i, &wA, &isNewA)*2 + PkaGetNextMsBit(b, i, &wB, &isNewB);
-	switch (b2) {
-	case 1:
-		PKA_COPY(LEN_ID_N_PKA_REG_BITS, xr, xq);
-		PKA_COPY(LEN_ID_N_PKA_REG_BITS, yr, yq);
-		break; // 01: r = q
-	case 2:
-		PKA_COPY(LEN_ID_N_PKA_REG_BITS, xr, xp);
-		PKA_COPY(LEN_ID_N_PKA_REG_BITS, yr, yp);
-		break; // 10: r = p
-	case 3:
-		PKA_COPY(LEN_ID_N_PKA_REG_BITS, xr, EC_VERIFY_REG_XPQ);
-		PKA_COPY(LEN_ID_N_PKA_REG_BITS, yr, EC_VERIFY_REG_YPQ);
-		break; // 11: r = p+q
-	default:
-		err = ECWRST_DSA_VERIFY_2MUL_FIRST_B2_ERROR;
+	/* recode the scalars: b to window NAF, a by the comb of the generator or as b */
+	err = EcWrstBuildWnaf(b, nafQ, &countQ);
+	if (err != CC_OK) {
 		goto End;
 	}
-	PKA_SET_VAL(EC_VERIFY_REG_ZR, 1);
-	PKA_COPY(LEN_ID_N_PKA_REG_BITS, EC_VERIFY_REG_TR, ECC_REG_EC_A);
+#ifdef CC_SUPPORT_ECC_FIXED_BASE_COMB
+	if (pDomain != NULL) {
+		pTable = EcWrstGetCombTable(pDomain);
+	}
+	if (pTable != NULL) {
+		kSizeInWords = CALC_FULL_32BIT_WORDS(PkaGetRegEffectiveSizeInBits(a));
+		if (kSizeInWords > CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS) {
+			err = ECWRST_SCALAR_MULT_INVALID_MOD_ORDER_SIZE_ERROR;
+			goto End;
+		}
+		PkaCopyDataFromPkaReg(pTemp->kt, kSizeInWords, a);
+		negMask = EcWrstCombRecode(pDomain, pTable, pTemp->kt, kSizeInWords, pTemp->comb);
+		countP = pTable->teethSpacing;
+	} else
+#endif
+	{
+		err = EcWrstBuildWnaf(a, nafP, &countP);
+		if (err != CC_OK) {
+			goto End;
+		}
+		PkaEcWrstOddMultiples(xp, yp, xr, yr, pTemp->pointsP, modSizeInWords);
+	}
+	PkaEcWrstOddMultiples(xq, yq, xr, yr, pTemp->pointsQ, modSizeInWords);
 
-	while (--i >= 0) {
-#ifdef ARM_DSM
-		*((volatile uint32_t *)(uint32_t)(0x44440000)) = i;
+	for (i = (int32_t)CC_MAX(countP, countQ) - 1; i >= 0; i--) {
+		pPointP = NULL;
+#ifdef CC_SUPPORT_ECC_FIXED_BASE_COMB
+		if (pTable != NULL) {
+			if ((uint32_t)i < countP) {
+				isNegP = EcWrstCombColumn(pTable, pTemp->comb, (uint32_t)i, &index) ^ negMask;
+				pPointP = pTable->pPoints + index*2*modSizeInWords;
+			}
+		} else
 #endif
-		b2 = PkaGetNextMsBit(a, i, &wA, &isNewA)*2 + PkaGetNextMsBit(b, i, &wB, &isNewB);
-		if (b2 == 0) {
-			PkaDoubleMdf2Mdf(xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR, xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR);
-		} else {
-			PkaDoubleMdf2Jcb(xr,yr,EC_VERIFY_REG_ZR, xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR);
-			switch (b2) {
-			case 1:
-				PkaAddJcbAfn2Mdf(xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR, xr,yr,EC_VERIFY_REG_ZR, xq,yq);
-				break; // 01: r += p
-			case 2:
-				PkaAddJcbAfn2Mdf(xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR, xr,yr,EC_VERIFY_REG_ZR, xp,yp);
-				break; // 10: r += q
-			case 3:
-				PkaAddJcbAfn2Mdf(xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR, xr,yr,EC_VERIFY_REG_ZR, EC_VERIFY_REG_XPQ,EC_VERIFY_REG_YPQ);
-				break; // 11: r += p+q
-			default:
-				err = ECWRST_DSA_VERIFY_2MUL_NEXT_B2_ERROR;
-				goto End;
+		if (((uint32_t)i < countP) && (nafP[i] != 0)) {
+			isNegP = (nafP[i] < 0);
+			pPointP = pTemp->pointsP + (uint32_t)((isNegP ? -nafP[i] : nafP[i]) >> 1)*2*modSizeInWords;
+		}
+
+		if (isInit == CC_TRUE) {
+			if ((pPointP == NULL) && (((uint32_t)i >= countQ) || (nafQ[i] == 0))) {
+				PkaDoubleMdf2Mdf(xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR, xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR);
+				continue;
 			}
+			PkaDoubleMdf2Jcb(xr,yr,EC_VERIFY_REG_ZR, xr,yr,EC_VERIFY_REG_ZR,EC_VERIFY_REG_TR);
+		}
+		if (pPointP != NULL) {
+			PkaEcWrstAddPoint(xr, yr, pPointP, isNegP, modSizeInWords, &isInit);
+		}
+		if (((uint32_t)i < countQ) && (nafQ[i] != 0)) {
+			PkaEcWrstAddPoint(xr, yr, pTemp->pointsQ + (uint32_t)((nafQ[i] < 0 ? -nafQ[i] : nafQ[i]) >> 1)*2*modSizeInWords,
+					  (nafQ[i] < 0), modSizeInWords, &isInit);
 		}
 	}
 	PkaJcb2Afn(SCAP_Inactive, xr, yr, EC_VERIFY_REG_ZR);
 
 	End:
+	CC_PalMemSetZero(pTemp->nafP, sizeof(pTemp->nafP));
+	CC_PalMemSetZero(pTemp->nafQ, sizeof(pTemp->nafQ));
+	CC_PalMemSetZero(pTemp->kt, sizeof(pTemp->kt));
+	CC_PalMemSetZero(pTemp->comb, sizeof(pTemp->comb));
 	return err;
 }
 
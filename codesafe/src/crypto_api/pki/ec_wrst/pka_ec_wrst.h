@@ -19,6 +19,9 @@ extern "C"
 #include "pka_hw_defs.h"
 #include "pka.h"
 #include "ec_wrst.h"
+#ifdef CC_SUPPORT_ECC_FIXED_BASE_COMB
+#include "cc_ecpki_domain_comb.h"
+#endif
 
 
 #define PKA_ECC_MAX_OPERATION_SIZE_BITS        640  /*for EC 521-bit*/
@@ -80,11 +83,14 @@ void PkaAddAff(
 	const uint32_t x1, const uint32_t y1,
 	const uint32_t x2, const uint32_t y2);
 
-/* double EC scalar multiplication: R = a*p + b*q */
+/* double EC scalar multiplication: R = a*p + b*q; pDomain is given if p is the domain generator,
+   pTempBuff is of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words */
 uint32_t PkaSum2ScalarMullt(
 	const uint32_t xr, const uint32_t yr, const uint32_t a,
 	const uint32_t xp, const uint32_t yp, const uint32_t b,
-	const uint32_t xq, const uint32_t yq);
+	const uint32_t xq, const uint32_t yq,
+	const CCEcpkiDomain_t *pDomain,
+	uint32_t *pTempBuff);
 
 
 CCError_t PkaEcWrstScalarMult(const CCEcpkiDomain_t *pDomain,
@@ -96,8 +102,24 @@ CCError_t PkaEcWrstScalarMult(const CCEcpkiDomain_t *pDomain,
                              uint32_t             *outPointY,
                              uint32_t             *tmpBuff);
 
-CCError_t PkaEcdsaVerify(void);
-CCError_t PkaSm2EcdsaVerify(void);
+CCError_t PkaEcWrstScalarMultBase(const CCEcpkiDomain_t *pDomain,
+                             const uint32_t       *scalar,
+                             uint32_t             scalSizeInWords,
+                             uint32_t             *outPointX,
+                             uint32_t             *outPointY,
+                             uint32_t             *tmpBuff);
+
+CCError_t PkaEcdsaVerify(const CCEcpkiDomain_t *pDomain, uint32_t *pTempBuff);
+CCError_t PkaSm2EcdsaVerify(const CCEcpkiDomain_t *pDomain, uint32_t *pTempBuff);
+
+#ifdef CC_SUPPORT_ECC_FIXED_BASE_COMB
+/* fixed-base comb helpers, shared by the generator multiplication and the verification */
+const CCEcpkiCombTable_t *EcWrstGetCombTable(const CCEcpkiDomain_t *domain);
+uint32_t EcWrstCombRecode(const CCEcpkiDomain_t *domain, const CCEcpkiCombTable_t *pTable,
+			  const uint32_t *k, uint32_t kSizeInWords, uint32_t *pComb);
+uint32_t EcWrstCombColumn(const CCEcpkiCombTable_t *pTable, const uint32_t *pComb,
+			  uint32_t col, uint32_t *pIndex);
+#endif
 
 
 #ifdef __cplusplus
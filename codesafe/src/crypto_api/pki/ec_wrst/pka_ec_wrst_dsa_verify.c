@@ -35,7 +35,9 @@
  *
  * @return  - On success CC_OK is returned, on failure an error code.
  */
-CCError_t PkaEcdsaVerify(void)
+CCError_t PkaEcdsaVerify(const CCEcpkiDomain_t *pDomain, /*!< [in] Pointer to EC domain. */
+                         uint32_t *pTempBuff)            /*!< [in] Temporary buffer of
+                                                               EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
 {
     CCError_t err = CC_OK;
     int32_t modSizeInBits, ordSizeInBits;
@@ -106,7 +108,9 @@ CCError_t PkaEcdsaVerify(void)
                              EC_VERIFY_REG_P_GY,
                              EC_VERIFY_REG_H2,
                              EC_VERIFY_REG_P_WX,
-                             EC_VERIFY_REG_P_WY);
+                             EC_VERIFY_REG_P_WY,
+                             pDomain,
+                             pTempBuff);
     if(err)
         goto End;
 
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#include "cc_pal_mem.h"
+#include "cc_pal_mutex.h"
+#include "cc_pal_abort.h"
+#include "cc_common_math.h"
+#include "cc_ecpki_types.h"
+#include "cc_ecpki_error.h"
+#include "cc_ecpki_local.h"
+#include "pka_hw_defs.h"
+#include "pki.h"
+#include "pka.h"
+#include "pka_error.h"
+#include "ec_wrst.h"
+#include "ec_wrst_error.h"
+#include "pka_ec_wrst.h"
+#include "pka_ec_wrst_glob_regs.h"
+#ifdef CC_SUPPORT_ECC_FIXED_BASE_COMB
+#include "cc_ecpki_domain_comb.h"
+#endif
+
+extern const int8_t regTemps[PKA_MAX_COUNT_OF_PHYS_MEM_REGS];
+
+#ifdef CC_SUPPORT_ECC_FIXED_BASE_COMB
+
+/* the bit i of the vector */
+#define EC_WRST_COMB_BIT(pVec, i)  (((pVec)[(i) >> 5] >> ((i) & 0x1F)) & 1UL)
+
+/***********    EcWrstCombMaskIfEqual   function      **********************/
+/**
+ * @brief Returns all-ones mask if the values are equal, otherwise zero, without branches.
+ *
+ * @return  - the mask.
+ */
+static uint32_t EcWrstCombMaskIfEqual(uint32_t a, /*!< [in] First value. */
+				      uint32_t b) /*!< [in] Second value. */
+{
+        uint32_t x = a ^ b;
+
+        return ((x | (0U - x)) >> 31) - 1U;
+}
+
+
+/***********    EcWrstCombSelectPoint   function      **********************/
+/**
+ * @brief Copies the comb table entry into the buffer in constant time:
+ *        all entries are read, and only the requested one is accumulated.
+ *
+ * @return  - no return value.
+ */
+static void EcWrstCombSelectPoint(const CCEcpkiCombTable_t *pTable, /*!< [in] The comb table. */
+				  uint32_t index,                   /*!< [in] Index of the entry (secret). */
+				  uint32_t *pPoint)                 /*!< [out] Buffer for x,y of the entry. */
+{
+        uint32_t i, j, mask;
+        uint32_t pointSizeInWords = 2*pTable->modSizeInWords;
+        const uint32_t *pEntry = pTable->pPoints;
+
+        CC_PalMemSetZero(pPoint, pointSizeInWords*sizeof(uint32_t));
+        for (i = 0; i < CC_ECPKI_COMB_POINTS_COUNT; i++) {
+                mask = EcWrstCombMaskIfEqual(i, index);
+                for (j = 0; j < pointSizeInWords; j++) {
+                        pPoint[j] |= pEntry[j] & mask;
+                }
+                pEntry += pointSizeInWords;
+        }
+        return;
+}
+
+
+/***********    EcWrstGetCombTable   function      **********************/
+/**
+ * @brief Returns the fixed-base comb table of the domain generator, if the domain has one
+ *        and the table covers the domain order and fits the scalar buffers.
+ *
+ * @return  - the comb table pointer or NULL.
+ */
+const CCEcpkiCombTable_t *EcWrstGetCombTable(const CCEcpkiDomain_t *domain) /*!< [in] Pointer to EC domain. */
+{
+        const CCEcpkiCombTable_t *pTable;
+        uint32_t combSizeInBits;
+
+        pTable = CC_EcpkiGetCombTable(domain);
+        if (pTable == NULL) {
+                return NULL;
+        }
+        combSizeInBits = CC_ECPKI_COMB_TEETH_COUNT*pTable->teethSpacing;
+        if ((combSizeInBits < domain->ordSizeInBits) ||
+            (CALC_FULL_32BIT_WORDS(domain->ordSizeInBits) > CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS) ||
+            (CALC_FULL_32BIT_WORDS(combSizeInBits) > CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS) ||
+            (CALC_FULL_32BIT_WORDS(domain->modSizeInBits) != pTable->modSizeInWords)) {
+                return NULL;
+        }
+        return pTable;
+}
+
+
+/***********    EcWrstCombRecode   function      **********************/
+/**
+ * @brief Recodes the scalar for the fixed-base comb: the scalar is made odd (k' = k or n-k)
+ *        and recoded to signed binary digits b_i = 2*c_i - 1, c = (k' + 2^(teeth*spacing) - 1)/2.
+ *        The recoding does not branch on the scalar.
+ *
+ * @return  - all-ones mask if the scalar was replaced by n - k (the product must be negated),
+ *            otherwise zero.
+ */
+uint32_t EcWrstCombRecode(const CCEcpkiDomain_t *domain,      /*!< [in] Pointer to EC domain. */
+			  const CCEcpkiCombTable_t *pTable,   /*!< [in] Comb table of the domain generator. */
+			  const uint32_t *k, uint32_t kSizeInWords, /*!< [in] Pointer to the scalar and its size. */
+			  uint32_t *pComb)                    /*!< [out] Recoded scalar c, of size
+								     CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + 1 words. */
+{
+        uint32_t ordSizeInWords, combSizeInBits, combSizeInWords;
+        uint32_t i, diff, borrow, negMask;
+        uint64_t t;
+
+        ordSizeInWords = CALC_FULL_32BIT_WORDS(domain->ordSizeInBits);
+        combSizeInBits = CC_ECPKI_COMB_TEETH_COUNT*pTable->teethSpacing;
+        combSizeInWords = CALC_FULL_32BIT_WORDS(combSizeInBits);
+
+        /* k' = k if k is odd, otherwise n - k, which is odd since n is odd */
+        CC_PalMemSetZero(pComb, sizeof(uint32_t)*(CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + 1));
+        CC_PalMemCopy(pComb, k, sizeof(uint32_t)*CC_MIN(kSizeInWords, ordSizeInWords));
+        negMask = (pComb[0] & 1UL) - 1UL;
+        borrow = 0;
+        for (i = 0; i < ordSizeInWords; i++) {
+                t = (uint64_t)domain->ecR[i] - pComb[i] - borrow;
+                diff = (uint32_t)t;
+                borrow = (uint32_t)(t >> 32) & 1UL;
+                pComb[i] ^= (pComb[i] ^ diff) & negMask;
+        }
+
+        /* c = (k' - 1)/2 + 2^(combSizeInBits - 1) */
+        for (i = 0; i < combSizeInWords; i++) {
+                pComb[i] = (pComb[i] >> 1) | (pComb[i+1] << 31);
+        }
+        pComb[(combSizeInBits - 1) >> 5] |= 1UL << ((combSizeInBits - 1) & 0x1F);
+
+        return negMask;
+}
+
+
+/***********    EcWrstCombColumn   function      **********************/
+/**
+ * @brief Returns the table index and the sign of the comb column of the recoded scalar:
+ *        the column i gathers the digits b_(i + j*spacing), j = 0..teeth-1; its value is
+ *        b_i * T[u], where bit (j-1) of u is set if b_(i + j*spacing) equals b_i.
+ *
+ * @return  - all-ones mask if the column point must be negated, otherwise zero.
+ */
+uint32_t EcWrstCombColumn(const CCEcpkiCombTable_t *pTable, /*!< [in] Comb table of the domain generator. */
+			  const uint32_t *pComb,            /*!< [in] Scalar recoded by EcWrstCombRecode(). */
+			  uint32_t col,                     /*!< [in] Column number, less than the teeth spacing. */
+			  uint32_t *pIndex)                 /*!< [out] Index of the table entry. */
+{
+        uint32_t j, index = 0;
+
+        for (j = 1; j < CC_ECPKI_COMB_TEETH_COUNT; j++) {
+                index |= (EC_WRST_COMB_BIT(pComb, col + j*pTable->teethSpacing) ^
+                          EC_WRST_COMB_BIT(pComb, col) ^ 1UL) << (j - 1);
+        }
+        *pIndex = index;
+
+        return EcWrstCombMaskIfEqual(EC_WRST_COMB_BIT(pComb, col), 0);
+}
+
+
+/***********    ScalarMultComb   function      **********************/
+/**
+ * @brief EC scalar multiplication of the domain generator r = k*G, using the fixed-base comb table.
+ *
+ *  The scalar is recoded by EcWrstCombRecode() (the result is negated back if the scalar
+ *  was replaced by n-k), and the column points are given by EcWrstCombColumn(). Every column
+ *  adds a point, and the sequence of PKA operations does not depend on the scalar:
+ *  (spacing - 1) doublings and additions, instead of a doubling per scalar bit.
+ *  The table entry is selected by a full table scan.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ *
+ */
+static CCError_t ScalarMultComb(const CCEcpkiDomain_t *domain,      /*!< [in] Pointer to EC domain. */
+				const CCEcpkiCombTable_t *pTable,   /*!< [in] Comb table of the domain generator. */
+				uint32_t *bxr, uint32_t *byr,       /*!< [out] Pointers to coordinates of result EC point. */
+				const uint32_t *k, uint32_t kSizeInWords) /*!< [in] Pointer to the scalar and its size. */
+{
+        CCError_t err = CC_OK;
+        uint32_t kt[CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + 1];
+        uint32_t pt[2*CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS];
+        uint32_t modSizeInBits, modSizeInWords;
+        uint32_t i, index, negMask, colNegMask, ys;
+        int32_t col;
+        uint32_t pkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+        /* Define pka registers used*/
+        uint8_t  xr = regTemps[14];
+        uint8_t  yr = regTemps[15];
+        uint8_t  zr = regTemps[16];
+        uint8_t  tr = regTemps[17];
+        uint8_t  xp = regTemps[18];
+        uint8_t  yp = regTemps[19];
+        uint8_t  tp = regTemps[20];
+
+        /* set domain parameters */
+        modSizeInBits  = domain->modSizeInBits;
+        modSizeInWords = CALC_FULL_32BIT_WORDS(modSizeInBits);
+
+        negMask = EcWrstCombRecode(domain, pTable, k, kSizeInWords, kt);
+
+        /*  Init PKA for modular operations */
+        err = PkaInitAndMutexLock(modSizeInBits, &pkaReqRegs);
+        if (err != CC_OK) {
+                goto End;
+        }
+
+        /*   Set data into PKA registers  */
+        PkaCopyDataIntoPkaReg(ECC_REG_N, 1, domain->ecP/*src_ptr*/, modSizeInWords);
+        PkaCopyDataIntoPkaReg(ECC_REG_NP, 1, ((EcWrstDomain_t*)&domain->llfBuff)->modTag,
+                               CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+        PkaCopyDataIntoPkaReg(ECC_REG_EC_A, 1, domain->ecA, modSizeInWords);
+
+        /* calculate auxiliary values */
+        PKA_ADD(LEN_ID_N_PKA_REG_BITS, ECC_REG_N4 , ECC_REG_N,   ECC_REG_N  );
+        PKA_ADD(LEN_ID_N_PKA_REG_BITS, ECC_REG_N4 , ECC_REG_N4, ECC_REG_N4);
+        PKA_ADD(LEN_ID_N_PKA_REG_BITS, ECC_REG_N8 , ECC_REG_N4, ECC_REG_N4);
+        PKA_ADD(LEN_ID_N_PKA_REG_BITS, ECC_REG_N12, ECC_REG_N8, ECC_REG_N4);
+
+        for (col = (int32_t)pTable->teethSpacing - 1; col >= 0; col--) {
+                i = (uint32_t)col;
+                /* index and sign of the column */
+                colNegMask = EcWrstCombColumn(pTable, kt, i, &index);
+
+                EcWrstCombSelectPoint(pTable, index, pt);
+                PkaCopyDataIntoPkaReg(xp, 1, pt, modSizeInWords);
+                PkaCopyDataIntoPkaReg(yp, 1, pt + modSizeInWords, modSizeInWords);
+                PKA_SUB(LEN_ID_N_PKA_REG_BITS, tp, ECC_REG_N, yp); // ry of -p
+                ys = yp ^ ((yp ^ tp) & colNegMask);
+
+                if (i == pTable->teethSpacing - 1) {
+                        PKA_COPY(LEN_ID_N_PKA_REG_BITS, xr, xp);
+                        PKA_COPY(LEN_ID_N_PKA_REG_BITS, yr, ys);
+                        PKA_SET_VAL(zr, 1);
+                        PKA_COPY(LEN_ID_N_PKA_REG_BITS, tr, ECC_REG_EC_A);
+                } else {
+                        PkaDoubleMdf2Jcb(xr,yr,zr, xr,yr,zr,tr);
+                        PkaAddJcbAfn2Mdf(xr,yr,zr,tr, xr,yr,zr, xp,ys);
+                }
+        }
+
+        /* convert to affine */
+        PkaJcb2Afn(SCAP_Active, xr,yr,zr);
+
+        /* negate the result back if the scalar was replaced by n - k */
+        PKA_SUB(LEN_ID_N_PKA_REG_BITS, tp, ECC_REG_N, yr);
+        ys = yr ^ ((yr ^ tp) & negMask);
+
+        /*  Output data from PKA registers  */
+        PkaCopyDataFromPkaReg(bxr, modSizeInWords, xr);
+        PkaCopyDataFromPkaReg(byr, modSizeInWords, ys);
+
+        PkaFinishAndMutexUnlock(pkaReqRegs);
+
+ End:
+        /* zeroing of the scalar and point buffers */
+        CC_PalMemSetZero(kt, sizeof(kt));
+        CC_PalMemSetZero(pt, sizeof(pt));
+        return err;
+}
+
+#endif /* CC_SUPPORT_ECC_FIXED_BASE_COMB */
+
+
+/***********    PkaEcWrstScalarMultBase   function      **********************/
+/**
+ * @brief ECC scalar multiplication of the domain generator:
+ *               outPoint = scalar * G.
+ *
+ *     If the domain is a library domain with a fixed-base comb table, the product is computed
+ *     with the table; otherwise the function falls back to PkaEcWrstScalarMult() with G as
+ *     the input point.
+ *     Note: All buffers are given as 32-bit words arrays, where LSWord is a leftmost one.
+ *
+ * @return  - On success CC_OK is returned, on failure an error code.
+ */
+CCError_t PkaEcWrstScalarMultBase(const CCEcpkiDomain_t *pDomain,   /*!< [in] Pointer to current EC domain. */
+                             const uint32_t       *scalar,         /*!< [in] Pointer to the scalar buffer. */
+                             uint32_t             scalSizeInWords,/*!< [in] The exact size of the scalar in words. */
+                             uint32_t             *outPointX,      /*!< [out] Pointer to the point X coordinate. */
+                             uint32_t             *outPointY,      /*!< [out] Pointer to the point Y coordinate. */
+                             uint32_t             *tmpBuff)        /*!< [in] The pointer to the temp buffer of size not less,
+                                                                             than CC_PKA_ECPKI_SCALAR_MUL_BUFF_MAX_LENGTH_IN_WORDS. */
+{
+#ifdef CC_SUPPORT_ECC_FIXED_BASE_COMB
+        const CCEcpkiCombTable_t *pTable;
+        CCCommonCmpCounter_t cmp;
+
+        pTable = EcWrstGetCombTable(pDomain);
+        if (pTable != NULL) {
+
+                /* compare scalar to EC generator order (0 < scalar < EC order) */
+                cmp = CC_CommonCmpLsWordsUnsignedCounters(scalar, scalSizeInWords,
+                                                             pDomain->ecR, CALC_FULL_32BIT_WORDS(pDomain->ordSizeInBits));
+
+                if ((CC_CommonGetWordsCounterEffectiveSizeInBits(scalar, scalSizeInWords) == 0) ||
+                    (cmp != CC_COMMON_CmpCounter2GreaterThenCounter1)) {
+                        return ECWRST_SCALAR_MULT_INVALID_SCALAR_VALUE_ERROR;
+                }
+
+                return ScalarMultComb(pDomain, pTable, outPointX, outPointY, scalar, scalSizeInWords);
+        }
+#endif
+        return PkaEcWrstScalarMult(pDomain, scalar, scalSizeInWords,
+                                   pDomain->ecGx, pDomain->ecGy,
+                                   outPointX, outPointY, tmpBuff);
+}
@@ -108,6 +108,18 @@ CCError_t RsaCalculateCrtParams(uint32_t *pPubExp,      /*!< [in]  Pointer to th
                                          uint32_t *pPrivExp2dq, /*!< [out]  Private exponent for second factor - dQ. */
                                          uint32_t *pQInv);
 
+CCError_t RsaCalculateOtherPrimesCrtParams(uint32_t *pPubExp,       /*!< [in]  Pointer to the public exponent. */
+                                           uint32_t eSizeInBits,    /*!< [in]  Public exponent size in bits. */
+                                           CCRsaPrivKey_t *pPrivKey); /*!< [in/out]  Private key on CRT mode with the factors set. */
+
+CCError_t RsaGenPrime(CCRndGenerateVectWorkFunc_t f_rng,
+                      void *p_rng,
+                      uint32_t        primeSizeInBits,
+                      uint32_t        eSizeInBits,
+                      uint32_t       *pPubExp,
+                      uint32_t       *pPrime,
+                      CCRsaKgData_t  *pKeyGenData);
+
 
 //#if (defined RSA_KG_FIND_BAD_RND || defined RSA_KG_NO_RND) && defined DEBUG
 extern uint8_t   RSA_KG_debugPvect[CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BYTES/2];
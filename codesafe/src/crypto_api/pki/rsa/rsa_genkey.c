@@ -50,16 +50,23 @@ Info 774: Boolean within 'if' always evaluates to False */
 
 /************************ Defines ******************************/
 
-#define RSA_QUICK_PRIME_TEST_DIVISIONS_COUNT  128
+/* count of small primes, by which the DH (ANSI X9.42) prime candidates are trial divided */
+#define RSA_QUICK_PRIME_TEST_DIVISIONS_COUNT  1024
 
-#define CALC_PRIME_PRODUCT_NUM ( CC_MIN(CALC_FULL_32BIT_WORDS(CC_RSA_MAX_KEY_GENERATION_SIZE_BITS),CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS) )
-#define PRIME_PRODUCT_BUFF_SIZE ( CC_MAX(CALC_FULL_32BIT_WORDS(CC_RSA_MAX_KEY_GENERATION_SIZE_BITS),CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS) )
-#define PRIME_NUM 256
+/* count of small primes, by which the RSA prime candidates are sieved */
+#define RSA_KG_SIEVE_PRIMES_COUNT  2048
 
-#define CALC_PRIME_PRODUCT   (CALC_PRIME_PRODUCT_NUM/2 - 3)
+/* count of prime candidates P + k*Delta, sieved at once */
+#define RSA_KG_SIEVE_WINDOW_SIZE  512
+#define RSA_KG_SIEVE_WINDOW_SIZE_IN_WORDS  (RSA_KG_SIEVE_WINDOW_SIZE/CC_BITS_IN_32BIT_WORD)
 
-#if (CALC_PRIME_PRODUCT > (CC_PKA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS-6))
-        #error ("CALC_PRIME_PRODUCT > (CC_PKA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS-6)")
+/* temp buffer words used by the sieve: the window base (one word more than the prime),
+   the step Delta and the sieve bits. The Miller-Rabin test uses the temp buffer following them */
+#define RSA_KG_SIEVE_BUFF_SIZE_IN_WORDS  (CALC_FULL_32BIT_WORDS(CC_RSA_MAX_KEY_GENERATION_SIZE_BITS/2) + 1 + \
+                                          2*PKA_RSA_AUX_PRIME_BUFF_SIZE_IN_32BIT_WORDS + RSA_KG_SIEVE_WINDOW_SIZE_IN_WORDS)
+
+#if (RSA_KG_SIEVE_BUFF_SIZE_IN_WORDS + 3*CALC_FULL_32BIT_WORDS(CC_RSA_MAX_KEY_GENERATION_SIZE_BITS/2) > CC_PKA_KGDATA_BUFF_SIZE_IN_WORDS)
+        #error ("RSA_KG_SIEVE_BUFF_SIZE_IN_WORDS does not fit into the key generation temp buffer")
 #endif
 
 
@@ -74,40 +81,137 @@ rsaKgInternalPrime_t  *primeInt = NULL;
 
 extern const int8_t regTemps[PKA_MAX_COUNT_OF_PHYS_MEM_REGS];
 
-const uint32_t g_PrimeProduct[PRIME_PRODUCT_BUFF_SIZE] = {
-        3234846615UL,95041567UL,907383479,4132280413UL,121330189,257557397UL,490995677,842952707,
-        1314423991UL,2125525169UL,3073309843UL,16965341,20193023,23300239,29884301,35360399,
-        42749359UL,49143869,56466073,65111573,76027969,84208541,94593973,103569859,119319383,133390067UL,
-        154769821UL,178433279,193397129,213479407,229580147,250367549,271661713,293158127,319512181,
-        357349471UL,393806449,422400701,452366557,507436351,547978913,575204137,627947039,666785731,
-        710381447UL,777767161UL,834985999UL,894826021UL,951747481UL,1019050649UL,1072651369UL,1125878063UL,1185362993UL,
-        1267745273UL,1322520163UL,1391119619UL,1498299287UL,1608372013UL,1700725291UL,1805418283UL,1871456063UL,
-        2008071007UL,2115193573UL,2178429527UL,2246284699UL,2385788087UL
-};
-
-const uint16_t g_SmallPrime[PRIME_NUM] =
+/* the odd primes 3 ... 17881 */
+const uint16_t g_SmallPrime[RSA_KG_SIEVE_PRIMES_COUNT] =
 {
-        3,5,7,11,13,17,19,23,29,31,37,41,43,47,53,59,61,67,71,73,79,83,89,97,101,103,107,109,
-        113,127,131,137,139,149,151,157,163,167,173,179,181,191,193,197,199,211,223,227,
-        229,233,239,241,251,257,263,269,271,277,281,283,293,307,311,313,317,331,337,347,349,353,
-        359,367,373,379,383,389,397,401,409,419,421,431,433,439,443,449,457,461,463,467,479,
-        487,491,499,503,509,521,523,541,547,557,563,569,571,577,587,593,599,601,607,613,617,
-        619,631,641,643,647,653,659,661,673,677,683,691,701,709,719,727,733,739,743,751,757,
-        761,769,773,787,797,809,811,821,823,827,829,839,853,857,859,863,877,881,883,887,907,
-        911,919,929,937,941,947,953,967,971,977,983,991,997,1009,1013,1019,1021,1031,1033,1039,1049,
-        1051,1061,1063,1069,1087,1091,1093,1097,1103,1109,1117,1123,1129,1151,1153,1163,1171,1181,
-        1187,1193,1201,1213,1217,1223,1229,1231,1237,1249,1259,1277,1279,1283,1289,1291,1297,1301,
-        1303,1307,1319,1321,1327,1361,1367,1373,1381,1399,1409,1423,1427,1429,1433,1439,1447,1451,
-        1453,1459,1471,1481,1483,1487,1489,1493,1499,1511,1523,1531,1543,1549,1553,1559,1567,1571,
-        1579,1583,1597,1601,1607,1609,1613,1619,1621
-};
-
-const uint16_t g_LastProductPrime[PRIME_PRODUCT_BUFF_SIZE] =
-{
-        9,14,19,24,28,32,36,40,44,48,52,55,58,61,64,67,70,73,76,79,82,85,88,91,94,97,100,103,106,109,112,
-        115,118,121,124,127,130,133,136,139,142,145,148,151,154,157,160,163,166,169,172,175,178,181,
-        184,187,190,193,196,199,202,205,208,211,214,217
-
+        3,5,7,11,13,17,19,23,29,31,37,41,43,47,53,59,
+        61,67,71,73,79,83,89,97,101,103,107,109,113,127,131,137,
+        139,149,151,157,163,167,173,179,181,191,193,197,199,211,223,227,
+        229,233,239,241,251,257,263,269,271,277,281,283,293,307,311,313,
+        317,331,337,347,349,353,359,367,373,379,383,389,397,401,409,419,
+        421,431,433,439,443,449,457,461,463,467,479,487,491,499,503,509,
+        521,523,541,547,557,563,569,571,577,587,593,599,601,607,613,617,
+        619,631,641,643,647,653,659,661,673,677,683,691,701,709,719,727,
+        733,739,743,751,757,761,769,773,787,797,809,811,821,823,827,829,
+        839,853,857,859,863,877,881,883,887,907,911,919,929,937,941,947,
+        953,967,971,977,983,991,997,1009,1013,1019,1021,1031,1033,1039,1049,1051,
+        1061,1063,1069,1087,1091,1093,1097,1103,1109,1117,1123,1129,1151,1153,1163,1171,
+        1181,1187,1193,1201,1213,1217,1223,1229,1231,1237,1249,1259,1277,1279,1283,1289,
+        1291,1297,1301,1303,1307,1319,1321,1327,1361,1367,1373,1381,1399,1409,1423,1427,
+        1429,1433,1439,1447,1451,1453,1459,1471,1481,1483,1487,1489,1493,1499,1511,1523,
+        1531,1543,1549,1553,1559,1567,1571,1579,1583,1597,1601,1607,1609,1613,1619,1621,
+        1627,1637,1657,1663,1667,1669,1693,1697,1699,1709,1721,1723,1733,1741,1747,1753,
+        1759,1777,1783,1787,1789,1801,1811,1823,1831,1847,1861,1867,1871,1873,1877,1879,
+        1889,1901,1907,1913,1931,1933,1949,1951,1973,1979,1987,1993,1997,1999,2003,2011,
+        2017,2027,2029,2039,2053,2063,2069,2081,2083,2087,2089,2099,2111,2113,2129,2131,
+        2137,2141,2143,2153,2161,2179,2203,2207,2213,2221,2237,2239,2243,2251,2267,2269,
+        2273,2281,2287,2293,2297,2309,2311,2333,2339,2341,2347,2351,2357,2371,2377,2381,
+        2383,2389,2393,2399,2411,2417,2423,2437,2441,2447,2459,2467,2473,2477,2503,2521,
+        2531,2539,2543,2549,2551,2557,2579,2591,2593,2609,2617,2621,2633,2647,2657,2659,
+        2663,2671,2677,2683,2687,2689,2693,2699,2707,2711,2713,2719,2729,2731,2741,2749,
+        2753,2767,2777,2789,2791,2797,2801,2803,2819,2833,2837,2843,2851,2857,2861,2879,
+        2887,2897,2903,2909,2917,2927,2939,2953,2957,2963,2969,2971,2999,3001,3011,3019,
+        3023,3037,3041,3049,3061,3067,3079,3083,3089,3109,3119,3121,3137,3163,3167,3169,
+        3181,3187,3191,3203,3209,3217,3221,3229,3251,3253,3257,3259,3271,3299,3301,3307,
+        3313,3319,3323,3329,3331,3343,3347,3359,3361,3371,3373,3389,3391,3407,3413,3433,
+        3449,3457,3461,3463,3467,3469,3491,3499,3511,3517,3527,3529,3533,3539,3541,3547,
+        3557,3559,3571,3581,3583,3593,3607,3613,3617,3623,3631,3637,3643,3659,3671,3673,
+        3677,3691,3697,3701,3709,3719,3727,3733,3739,3761,3767,3769,3779,3793,3797,3803,
+        3821,3823,3833,3847,3851,3853,3863,3877,3881,3889,3907,3911,3917,3919,3923,3929,
+        3931,3943,3947,3967,3989,4001,4003,4007,4013,4019,4021,4027,4049,4051,4057,4073,
+        4079,4091,4093,4099,4111,4127,4129,4133,4139,4153,4157,4159,4177,4201,4211,4217,
+        4219,4229,4231,4241,4243,4253,4259,4261,4271,4273,4283,4289,4297,4327,4337,4339,
+        4349,4357,4363,4373,4391,4397,4409,4421,4423,4441,4447,4451,4457,4463,4481,4483,
+        4493,4507,4513,4517,4519,4523,4547,4549,4561,4567,4583,4591,4597,4603,4621,4637,
+        4639,4643,4649,4651,4657,4663,4673,4679,4691,4703,4721,4723,4729,4733,4751,4759,
+        4783,4787,4789,4793,4799,4801,4813,4817,4831,4861,4871,4877,4889,4903,4909,4919,
+        4931,4933,4937,4943,4951,4957,4967,4969,4973,4987,4993,4999,5003,5009,5011,5021,
+        5023,5039,5051,5059,5077,5081,5087,5099,5101,5107,5113,5119,5147,5153,5167,5171,
+        5179,5189,5197,5209,5227,5231,5233,5237,5261,5273,5279,5281,5297,5303,5309,5323,
+        5333,5347,5351,5381,5387,5393,5399,5407,5413,5417,5419,5431,5437,5441,5443,5449,
+        5471,5477,5479,5483,5501,5503,5507,5519,5521,5527,5531,5557,5563,5569,5573,5581,
+        5591,5623,5639,5641,5647,5651,5653,5657,5659,5669,5683,5689,5693,5701,5711,5717,
+        5737,5741,5743,5749,5779,5783,5791,5801,5807,5813,5821,5827,5839,5843,5849,5851,
+        5857,5861,5867,5869,5879,5881,5897,5903,5923,5927,5939,5953,5981,5987,6007,6011,
+        6029,6037,6043,6047,6053,6067,6073,6079,6089,6091,6101,6113,6121,6131,6133,6143,
+        6151,6163,6173,6197,6199,6203,6211,6217,6221,6229,6247,6257,6263,6269,6271,6277,
+        6287,6299,6301,6311,6317,6323,6329,6337,6343,6353,6359,6361,6367,6373,6379,6389,
+        6397,6421,6427,6449,6451,6469,6473,6481,6491,6521,6529,6547,6551,6553,6563,6569,
+        6571,6577,6581,6599,6607,6619,6637,6653,6659,6661,6673,6679,6689,6691,6701,6703,
+        6709,6719,6733,6737,6761,6763,6779,6781,6791,6793,6803,6823,6827,6829,6833,6841,
+        6857,6863,6869,6871,6883,6899,6907,6911,6917,6947,6949,6959,6961,6967,6971,6977,
+        6983,6991,6997,7001,7013,7019,7027,7039,7043,7057,7069,7079,7103,7109,7121,7127,
+        7129,7151,7159,7177,7187,7193,7207,7211,7213,7219,7229,7237,7243,7247,7253,7283,
+        7297,7307,7309,7321,7331,7333,7349,7351,7369,7393,7411,7417,7433,7451,7457,7459,
+        7477,7481,7487,7489,7499,7507,7517,7523,7529,7537,7541,7547,7549,7559,7561,7573,
+        7577,7583,7589,7591,7603,7607,7621,7639,7643,7649,7669,7673,7681,7687,7691,7699,
+        7703,7717,7723,7727,7741,7753,7757,7759,7789,7793,7817,7823,7829,7841,7853,7867,
+        7873,7877,7879,7883,7901,7907,7919,7927,7933,7937,7949,7951,7963,7993,8009,8011,
+        8017,8039,8053,8059,8069,8081,8087,8089,8093,8101,8111,8117,8123,8147,8161,8167,
+        8171,8179,8191,8209,8219,8221,8231,8233,8237,8243,8263,8269,8273,8287,8291,8293,
+        8297,8311,8317,8329,8353,8363,8369,8377,8387,8389,8419,8423,8429,8431,8443,8447,
+        8461,8467,8501,8513,8521,8527,8537,8539,8543,8563,8573,8581,8597,8599,8609,8623,
+        8627,8629,8641,8647,8663,8669,8677,8681,8689,8693,8699,8707,8713,8719,8731,8737,
+        8741,8747,8753,8761,8779,8783,8803,8807,8819,8821,8831,8837,8839,8849,8861,8863,
+        8867,8887,8893,8923,8929,8933,8941,8951,8963,8969,8971,8999,9001,9007,9011,9013,
+        9029,9041,9043,9049,9059,9067,9091,9103,9109,9127,9133,9137,9151,9157,9161,9173,
+        9181,9187,9199,9203,9209,9221,9227,9239,9241,9257,9277,9281,9283,9293,9311,9319,
+        9323,9337,9341,9343,9349,9371,9377,9391,9397,9403,9413,9419,9421,9431,9433,9437,
+        9439,9461,9463,9467,9473,9479,9491,9497,9511,9521,9533,9539,9547,9551,9587,9601,
+        9613,9619,9623,9629,9631,9643,9649,9661,9677,9679,9689,9697,9719,9721,9733,9739,
+        9743,9749,9767,9769,9781,9787,9791,9803,9811,9817,9829,9833,9839,9851,9857,9859,
+        9871,9883,9887,9901,9907,9923,9929,9931,9941,9949,9967,9973,10007,10009,10037,10039,
+        10061,10067,10069,10079,10091,10093,10099,10103,10111,10133,10139,10141,10151,10159,10163,10169,
+        10177,10181,10193,10211,10223,10243,10247,10253,10259,10267,10271,10273,10289,10301,10303,10313,
+        10321,10331,10333,10337,10343,10357,10369,10391,10399,10427,10429,10433,10453,10457,10459,10463,
+        10477,10487,10499,10501,10513,10529,10531,10559,10567,10589,10597,10601,10607,10613,10627,10631,
+        10639,10651,10657,10663,10667,10687,10691,10709,10711,10723,10729,10733,10739,10753,10771,10781,
+        10789,10799,10831,10837,10847,10853,10859,10861,10867,10883,10889,10891,10903,10909,10937,10939,
+        10949,10957,10973,10979,10987,10993,11003,11027,11047,11057,11059,11069,11071,11083,11087,11093,
+        11113,11117,11119,11131,11149,11159,11161,11171,11173,11177,11197,11213,11239,11243,11251,11257,
+        11261,11273,11279,11287,11299,11311,11317,11321,11329,11351,11353,11369,11383,11393,11399,11411,
+        11423,11437,11443,11447,11467,11471,11483,11489,11491,11497,11503,11519,11527,11549,11551,11579,
+        11587,11593,11597,11617,11621,11633,11657,11677,11681,11689,11699,11701,11717,11719,11731,11743,
+        11777,11779,11783,11789,11801,11807,11813,11821,11827,11831,11833,11839,11863,11867,11887,11897,
+        11903,11909,11923,11927,11933,11939,11941,11953,11959,11969,11971,11981,11987,12007,12011,12037,
+        12041,12043,12049,12071,12073,12097,12101,12107,12109,12113,12119,12143,12149,12157,12161,12163,
+        12197,12203,12211,12227,12239,12241,12251,12253,12263,12269,12277,12281,12289,12301,12323,12329,
+        12343,12347,12373,12377,12379,12391,12401,12409,12413,12421,12433,12437,12451,12457,12473,12479,
+        12487,12491,12497,12503,12511,12517,12527,12539,12541,12547,12553,12569,12577,12583,12589,12601,
+        12611,12613,12619,12637,12641,12647,12653,12659,12671,12689,12697,12703,12713,12721,12739,12743,
+        12757,12763,12781,12791,12799,12809,12821,12823,12829,12841,12853,12889,12893,12899,12907,12911,
+        12917,12919,12923,12941,12953,12959,12967,12973,12979,12983,13001,13003,13007,13009,13033,13037,
+        13043,13049,13063,13093,13099,13103,13109,13121,13127,13147,13151,13159,13163,13171,13177,13183,
+        13187,13217,13219,13229,13241,13249,13259,13267,13291,13297,13309,13313,13327,13331,13337,13339,
+        13367,13381,13397,13399,13411,13417,13421,13441,13451,13457,13463,13469,13477,13487,13499,13513,
+        13523,13537,13553,13567,13577,13591,13597,13613,13619,13627,13633,13649,13669,13679,13681,13687,
+        13691,13693,13697,13709,13711,13721,13723,13729,13751,13757,13759,13763,13781,13789,13799,13807,
+        13829,13831,13841,13859,13873,13877,13879,13883,13901,13903,13907,13913,13921,13931,13933,13963,
+        13967,13997,13999,14009,14011,14029,14033,14051,14057,14071,14081,14083,14087,14107,14143,14149,
+        14153,14159,14173,14177,14197,14207,14221,14243,14249,14251,14281,14293,14303,14321,14323,14327,
+        14341,14347,14369,14387,14389,14401,14407,14411,14419,14423,14431,14437,14447,14449,14461,14479,
+        14489,14503,14519,14533,14537,14543,14549,14551,14557,14561,14563,14591,14593,14621,14627,14629,
+        14633,14639,14653,14657,14669,14683,14699,14713,14717,14723,14731,14737,14741,14747,14753,14759,
+        14767,14771,14779,14783,14797,14813,14821,14827,14831,14843,14851,14867,14869,14879,14887,14891,
+        14897,14923,14929,14939,14947,14951,14957,14969,14983,15013,15017,15031,15053,15061,15073,15077,
+        15083,15091,15101,15107,15121,15131,15137,15139,15149,15161,15173,15187,15193,15199,15217,15227,
+        15233,15241,15259,15263,15269,15271,15277,15287,15289,15299,15307,15313,15319,15329,15331,15349,
+        15359,15361,15373,15377,15383,15391,15401,15413,15427,15439,15443,15451,15461,15467,15473,15493,
+        15497,15511,15527,15541,15551,15559,15569,15581,15583,15601,15607,15619,15629,15641,15643,15647,
+        15649,15661,15667,15671,15679,15683,15727,15731,15733,15737,15739,15749,15761,15767,15773,15787,
+        15791,15797,15803,15809,15817,15823,15859,15877,15881,15887,15889,15901,15907,15913,15919,15923,
+        15937,15959,15971,15973,15991,16001,16007,16033,16057,16061,16063,16067,16069,16073,16087,16091,
+        16097,16103,16111,16127,16139,16141,16183,16187,16189,16193,16217,16223,16229,16231,16249,16253,
+        16267,16273,16301,16319,16333,16339,16349,16361,16363,16369,16381,16411,16417,16421,16427,16433,
+        16447,16451,16453,16477,16481,16487,16493,16519,16529,16547,16553,16561,16567,16573,16603,16607,
+        16619,16631,16633,16649,16651,16657,16661,16673,16691,16693,16699,16703,16729,16741,16747,16759,
+        16763,16787,16811,16823,16829,16831,16843,16871,16879,16883,16889,16901,16903,16921,16927,16931,
+        16937,16943,16963,16979,16981,16987,16993,17011,17021,17027,17029,17033,17041,17047,17053,17077,
+        17093,17099,17107,17117,17123,17137,17159,17167,17183,17189,17191,17203,17207,17209,17231,17239,
+        17257,17291,17293,17299,17317,17321,17327,17333,17341,17351,17359,17377,17383,17387,17389,17393,
+        17401,17417,17419,17431,17443,17449,17467,17471,17477,17483,17489,17491,17497,17509,17519,17539,
+        17551,17569,17573,17579,17581,17597,17599,17609,17623,17627,17657,17659,17669,17681,17683,17707,
+        17713,17729,17737,17747,17749,17761,17783,17789,17791,17807,17827,17837,17839,17851,17863,17881
 };
 
 
@@ -544,6 +648,124 @@ static CCError_t PkaRsaKgX931LucasPrimeTest(uint32_t  lenId,          /*!< [in]
 }
 
 
+/***********    RsaKgSmallPrimeResidue   function      **********************/
+/**
+ * @brief Calculates the residue of a big number modulo a small prime (of 16 bits max).
+ *
+ * @return  The residue.
+ */
+static uint32_t RsaKgSmallPrimeResidue(const uint32_t *pNum,      /*!< [in]  Pointer to the big number, LS word first. */
+                                       uint32_t  sizeWords,       /*!< [in]  Size of the number in words. */
+                                       uint32_t  smallPrime)      /*!< [in]  The small prime. */
+{
+        uint32_t i;
+        uint32_t r = 0;
+
+        /* Horner scheme on 16 bit digits, so that the partial residue fits into a 32 bit word */
+        for (i = sizeWords; i > 0; i--) {
+                r = ((r << 16) | (pNum[i-1] >> 16)) % smallPrime;
+                r = ((r << 16) | (pNum[i-1] & 0xFFFF)) % smallPrime;
+        }
+
+        return r;
+}
+
+
+/***********    RsaKgSmallPrimeInverse   function      **********************/
+/**
+ * @brief Calculates the inverse of a nonzero residue modulo a small prime (extended Euclid).
+ *
+ * @return  The inverse.
+ */
+static uint32_t RsaKgSmallPrimeInverse(uint32_t  a,           /*!< [in]  The residue, 0 < a < smallPrime. */
+                                       uint32_t  smallPrime)  /*!< [in]  The small prime. */
+{
+        uint32_t r0 = smallPrime, r1 = a, q, r;
+        int32_t  t0 = 0, t1 = 1, t;
+
+        while (r1 != 0) {
+                q = r0 / r1;
+                r = r0 - q*r1;
+                r0 = r1;
+                r1 = r;
+                t = t0 - (int32_t)q*t1;
+                t0 = t1;
+                t1 = t;
+        }
+
+        return (t0 < 0) ? (uint32_t)(t0 + (int32_t)smallPrime) : (uint32_t)t0;
+}
+
+
+/***********    RsaKgTrialDivision   function      **********************/
+/**
+ * @brief Checks that a big number is not divisible by the first primesCount small primes.
+ *
+ * @return  CC_TRUE if no small prime divides the number, otherwise CC_FALSE.
+ */
+static int32_t RsaKgTrialDivision(const uint32_t *pNum,      /*!< [in]  Pointer to the big number, LS word first. */
+                                  uint32_t  sizeWords,       /*!< [in]  Size of the number in words. */
+                                  uint32_t  primesCount)     /*!< [in]  Count of small primes to check. */
+{
+        uint32_t i;
+
+        for (i = 0; i < primesCount; i++) {
+                if (RsaKgSmallPrimeResidue(pNum, sizeWords, g_SmallPrime[i]) == 0) {
+                        return CC_FALSE;
+                }
+        }
+
+        return CC_TRUE;
+}
+
+
+/***********    RsaKgSieveWindow   function      **********************/
+/**
+ * @brief Sieves the window of RSA_KG_SIEVE_WINDOW_SIZE prime candidates Base + k*Delta
+ *        by the small primes: bit k of the sieve is set, if a small prime divides the candidate k.
+ *
+ *        For each small prime p the residues of Base and Delta are calculated once per window,
+ *        the divisible candidates are k = -Base/Delta mod p, k + p, k + 2p, ...,
+ *        so that only the survivors of the sieve are tested on the PKA.
+ *
+ * @return  None
+ */
+static void RsaKgSieveWindow(const uint32_t *pBase,        /*!< [in]  Pointer to the first candidate, LS word first. */
+                             uint32_t  baseSizeWords,      /*!< [in]  Size of the first candidate in words. */
+                             const uint32_t *pDelta,       /*!< [in]  Pointer to the step between the candidates. */
+                             uint32_t  deltaSizeWords,     /*!< [in]  Size of the step in words. */
+                             uint32_t *pSieve)             /*!< [out] The sieve bits, RSA_KG_SIEVE_WINDOW_SIZE_IN_WORDS words. */
+{
+        uint32_t i, k, p;
+        uint32_t rBase, rDelta;
+
+        CC_PalMemSetZero(pSieve, RSA_KG_SIEVE_WINDOW_SIZE_IN_WORDS*sizeof(uint32_t));
+
+        for (i = 0; i < RSA_KG_SIEVE_PRIMES_COUNT; i++) {
+                p = g_SmallPrime[i];
+                rBase = RsaKgSmallPrimeResidue(pBase, baseSizeWords, p);
+                rDelta = RsaKgSmallPrimeResidue(pDelta, deltaSizeWords, p);
+
+                /* p divides the step: all candidates have the residue of the base */
+                if (rDelta == 0) {
+                        if (rBase == 0) {
+                                CC_PalMemSet(pSieve, 0xFF, RSA_KG_SIEVE_WINDOW_SIZE_IN_WORDS*sizeof(uint32_t));
+                                return;
+                        }
+                        continue;
+                }
+
+                /* the first candidate divisible by p: k = (p - rBase)/rDelta mod p */
+                k = ((p - rBase) * RsaKgSmallPrimeInverse(rDelta, p)) % p;
+                for (; k < RSA_KG_SIEVE_WINDOW_SIZE; k += p) {
+                        pSieve[k >> 5] |= 1UL << (k & 0x1F);
+                }
+        }
+
+        return;
+}
+
+
 /***********    PkaRsaKgX931FindPrime1   function      **********************/
 /**
  * @brief Finds a small auxiliary prime (104...176 bits)
@@ -560,11 +782,11 @@ static CCError_t PkaRsaKgX931FindPrime1(CCRndGenerateVectWorkFunc_t f_rng, /*!<
                                          uint32_t  *pTempBuff)  		 /*!< [in]  Temp buffer of size 2 max RSA buffer size. */
 {
         CCError_t error = CC_OK;
-        uint32_t i, c, d;
-        uint32_t  *pTempRem = NULL;
-        uint32_t r;
-        /* the reminder and prime product virtual pointers */
-        int8_t rPrimeProduct;
+        uint32_t k, d;
+        uint32_t auxPrimeSizeInWords;
+        uint32_t *pBase, *pSieve;
+        /* the step between the candidates */
+        uint32_t delta = 2;
         /* temp register */
         int8_t rT, rT1, rT2;
         /* the rabin miller success code */
@@ -580,99 +802,70 @@ static CCError_t PkaRsaKgX931FindPrime1(CCRndGenerateVectWorkFunc_t f_rng, /*!<
 
 
         /* allocation of the temp registers */
-        rPrimeProduct = pRegTemps[0];
         rT  = pRegTemps[1];
         rT1 = pRegTemps[2];
         rT2 = pRegTemps[3];
 
-
-        /*  clearing the extended temp registers  */
-        PKA_2CLEAR(LEN_ID_MAX_BITS, rPrimeProduct/*regNum*/);
-        PKA_2CLEAR(LEN_ID_MAX_BITS, rT/*regNum*/);
+        /* allocation of the sieve buffers */
+        auxPrimeSizeInWords = CALC_FULL_32BIT_WORDS(rsaKgPrimeTestParams->auxPrimesSizeInBits);
+        pBase = pTempBuff;
+        pSieve = pTempBuff + RSA_KG_SIEVE_BUFF_SIZE_IN_WORDS - RSA_KG_SIEVE_WINDOW_SIZE_IN_WORDS;
 
         /* set the LSB of the prime to insure it is an odd number: rP_ptr[0] |= 1 */
         PKA_SET_BIT0( LEN_ID_PQ_PKA_REG_BITS/*lenId*/, rP/*Res*/, rP/*OpA*/);
 
-        //  calculating the prime reminder
-        pTempRem = &pTempBuff[0];
-        for (i = 0; i < CALC_PRIME_PRODUCT ; ++i) {
-                /* load the current prime product into PKA register */
-                PKA_WRITE_WORD_TO_REG(g_PrimeProduct[i], 0, rPrimeProduct);
-
-                /* copy rP=>rT and calculate the reminder */
-                PKA_COPY(LEN_ID_MAX_BITS, rT/*dest*/, rP/*src*/);
-                PKA_DIV(LEN_ID_PQ_PKA_REG_BITS, rT1/*resNotUsed*/, rT/*OpA*/, rPrimeProduct/*OpB*/);
-
-                /* read result rT word[0] and load it into reminder word[i] */
-                PKA_READ_WORD_FROM_REG(pTempRem[i], 0, rT);
-
-        }/* end of loop for calculating the reminders */
-
+        // the main loop for finding a prime: sieve the window of candidates P + 2*k
+        while (1) {
+                PkaCopyDataFromPkaReg(pBase/*dst_ptr*/, auxPrimeSizeInWords + 1, rP/*srcReg*/);
+                RsaKgSieveWindow(pBase, auxPrimeSizeInWords + 1, &delta, 1, pSieve);
 
-        // the main loop for finding a prime
-        for (d = 0; ; d += 2) {
+                /* d - the distance of the candidate k from the current P */
+                for (k = 0, d = 0; k < RSA_KG_SIEVE_WINDOW_SIZE; k++, d += delta) {
+                        if (pSieve[k >> 5] & (1UL << (k & 0x1F))) {
+                                continue;
+                        }
 
-                PKA_2CLEAR(LEN_ID_MAX_BITS, rT/*regNum*/);
+                        /* calculate P = P + d.  */
+                        PKA_2CLEAR(LEN_ID_MAX_BITS, rT/*regNum*/);
+                        PKA_WRITE_WORD_TO_REG(d, 0, rT);
+                        PKA_ADD( LEN_ID_PQ_PKA_REG_BITS, rP/*Res*/, rP/*OpA*/, rT/*OpB*/);
+                        d = 0;
 
-                // finding a candidate for a prime
-                for (c = 0, i = 0; i < CALC_PRIME_PRODUCT; ++i) {
-                        if (pTempRem[i] + d < d) {        /* remark: [*] */
-                                pTempRem[i] -= g_PrimeProduct[i];
+                        //  initialization of modular operations
+                        /* copy P into modulus register r0 */
+                        if (rP != PKA_REG_N) {
+                                PKA_COPY(LEN_ID_MAX_BITS, PKA_REG_N/*dst*/, rP/*src*/);
                         }
 
-                        r = pTempRem[i] + d;
+                        /* initialization of modular operations, the "modulus" in this case is P or Q which is 1/2 modulus size.*
+                        *  that's the reason we use PQ Len ID     						      */
+                        PkaCalcNpIntoPkaReg(LEN_ID_AUX_PRIME_BITS,
+                                             rsaKgPrimeTestParams->auxPrimesSizeInBits,
+                                             PKA_REG_N, PKA_REG_NP, rT, rT1);
+
+                        //  executing the Miller-Rabin test
+                        error = PkaRsaKgX931MillerRabinTest(f_rng, p_rng,
+                                                            LEN_ID_AUX_PRIME_BITS,
+                                                            rsaKgPrimeTestParams->auxPrimesSizeInBits,
+                                                            &successCode, /*out*/
+                                                            rsaKgPrimeTestParams->auxPrimesMilRabTestsCount, /*in*/
+                                                            rT, rT1, rT2,  /*temp registers*/
+                                                            pTempBuff + RSA_KG_SIEVE_BUFF_SIZE_IN_WORDS);
+                        if (error != CC_OK) {
+                                return error;
+                        }
 
-                        for (; c < g_LastProductPrime[i]; ++c) {
-                                if (r % g_SmallPrime[c] == 0)
-                                        goto Next_d;
+                        /* on sucess return CC_OK we have found a prime */
+                        if (successCode == CC_TRUE) {
+                                return CC_OK;
                         }
                 }
 
-                /* calculate P = P + d.  */
-                /* load d into register rT. Note: rT already cleared, except the LS word  */
+                /* move P to the first candidate of the next window */
+                PKA_2CLEAR(LEN_ID_MAX_BITS, rT/*regNum*/);
                 PKA_WRITE_WORD_TO_REG(d, 0, rT);
                 PKA_ADD( LEN_ID_PQ_PKA_REG_BITS, rP/*Res*/, rP/*OpA*/, rT/*OpB*/);
 
-
-                //  initialization of modular operations
-                /* copy P into modulus register r0 */
-                if (rP != PKA_REG_N) {
-                        PKA_COPY(LEN_ID_MAX_BITS, PKA_REG_N/*dst*/, rP/*src*/);
-                }
-
-                /* initialization of modular operations, the "modulus" in this case is P or Q which is 1/2 modulus size.*
-                *  that's the reason we use PQ Len ID     						      */
-                PkaCalcNpIntoPkaReg(LEN_ID_AUX_PRIME_BITS,
-                                     rsaKgPrimeTestParams->auxPrimesSizeInBits,
-                                     PKA_REG_N, PKA_REG_NP, rT, rT1);
-
-                //  executing the Miller-Rabin test
-                error = PkaRsaKgX931MillerRabinTest(f_rng, p_rng,
-                                                    LEN_ID_AUX_PRIME_BITS,
-                                                    rsaKgPrimeTestParams->auxPrimesSizeInBits,
-                                                    &successCode, /*out*/
-                                                    rsaKgPrimeTestParams->auxPrimesMilRabTestsCount, /*in*/
-                                                    rT, rT1, rT2,  /*temp registers*/
-                                                    pTempBuff+CALC_PRIME_PRODUCT);
-                if (error != CC_OK) {
-                        return error;
-                }
-
-                /* on sucess return CC_OK we have found a prime */
-                if (successCode == CC_TRUE) {
-                        return CC_OK;
-                }
-
-                /* update d and reminder to avoid overflow of d (unlikely event) */
-                for (i = 0; i < CALC_PRIME_PRODUCT; ++i) {
-                        pTempRem[i] += d; /* remark: since [*] passed, there is no need to recheck */
-                }
-
-                d = 0;
-
-                Next_d:
-                continue;
-
         }/* end of main loop for finding a prime */
 }
 
@@ -698,13 +891,11 @@ static CCError_t PkaRsaKgX931FindPrime2(CCRndGenerateVectWorkFunc_t f_rng, /*!<
 {
         CCError_t error = CC_OK;
         int8_t successCode;
-        uint32_t i, c;
+        uint32_t k;
         uint32_t status;
         uint32_t bitVal;
-        uint32_t  *pTempRem = NULL;
-        uint32_t  *pTempDelta = NULL;
-        /* the reminder and prime product virtual pointers */
-        int8_t rPrimeProduct;
+        uint32_t primeSizeInWords, deltaSizeInWords;
+        uint32_t *pBase, *pDelta, *pSieve;
         /* temp register */
         int8_t rT, rT1, rT2;
 
@@ -715,18 +906,18 @@ static CCError_t PkaRsaKgX931FindPrime2(CCRndGenerateVectWorkFunc_t f_rng, /*!<
 #endif
 
 
-        /* allocation of the reminder and product on temp registers */
-        rPrimeProduct = pRegTemps[0];
+        /* allocation of the temp registers */
         rT  = pRegTemps[1];
         rT1 = pRegTemps[2];
         rT2 = pRegTemps[3];
 
-        // calculating the prime reminder
-        /*  clearing the temp registers (extended) */
-        PKA_2CLEAR(LEN_ID_MAX_BITS, rPrimeProduct/*regNum*/);
-        PKA_2CLEAR(LEN_ID_MAX_BITS, rT/*regNum*/);
+        /* allocation of the sieve buffers: the delta is 2*P1*P2 */
+        primeSizeInWords = CALC_FULL_32BIT_WORDS(modulusSizeInBits);
+        deltaSizeInWords = CALC_FULL_32BIT_WORDS(2*rsaKgPrimeTestParams->auxPrimesSizeInBits + 1);
+        pBase = pTempBuff;
+        pDelta = pBase + primeSizeInWords + 1;
+        pSieve = pTempBuff + RSA_KG_SIEVE_BUFF_SIZE_IN_WORDS - RSA_KG_SIEVE_WINDOW_SIZE_IN_WORDS;
 
-        // calculate Rdelta and the Reminder
         /* if the prime candidate P is even add the delta */
         PKA_READ_BIT0(LEN_ID_PQ_PKA_REG_BITS, rP/*OpA*/, bitVal);
         if (bitVal == 0) {
@@ -735,120 +926,83 @@ static CCError_t PkaRsaKgX931FindPrime2(CCRndGenerateVectWorkFunc_t f_rng, /*!<
 
         /* multiply delta by 2 */
         PKA_ADD( LEN_ID_PQ_PKA_REG_BITS/*lenId*/, rDelta/*Res*/, rDelta/*OpA*/, rDelta/*OpB*/);
+        PkaCopyDataFromPkaReg(pDelta/*dst_ptr*/, deltaSizeInWords, rDelta/*srcReg*/);
 
-        // loop for calculating the products
-        pTempRem = &pTempBuff[0];
-        pTempDelta = &pTempBuff[CALC_PRIME_PRODUCT];
-
-        for (i = 0; i < CALC_PRIME_PRODUCT ; ++i) {
-                /* load the current rPrimeProduct[0] = g_PrimeProduct[i] */
-                PKA_WRITE_WORD_TO_REG(g_PrimeProduct[i], 0, rPrimeProduct);
-
-                /* copy rP=>rT and calculate the reminder in reg rT */
-                PKA_COPY(LEN_ID_MAX_BITS, rT/*dest*/, rP/*src*/);
-                PKA_DIV( LEN_ID_PQ_PKA_REG_BITS, rT1/*ResNotUsed*/, rT/*OpA*/, rPrimeProduct/*OpB*/);
-
-                /* load the next word of reminder: rRem[i] = rT[0] */
-                PKA_READ_WORD_FROM_REG(pTempRem[i], 0, rT);
-
-                /* calculate the Rdelta */
-                PKA_COPY(LEN_ID_MAX_BITS, rT/*dest*/, rDelta/*src*/);
-                PKA_DIV( LEN_ID_PQ_PKA_REG_BITS, rT1/*ResNotUsed*/, rT/*OpA*/, rPrimeProduct/*OpB*/);
-
-                /* load the Rdelta with the result rRdeltam[i] = rT[0]*/
-                PKA_READ_WORD_FROM_REG(pTempDelta[i], 0, rT);
-
-        }/* end of loop for calculating the reminders */
-
-        /*  main loop for finding the prime  */
+        /*  main loop for finding the prime: sieve the window of candidates P + k*Delta  */
         while (1) {
-                //WATCH_DOG_RESET(); // obsolete. Watchdog should be fed by dedicated task
-
-                /* checking if the current prime should be tested */
-                for (c=0 , i=0 ; i < CALC_PRIME_PRODUCT ; i++) {
-                        for (; c < g_LastProductPrime[i] ; c++) {
-                                if ((pTempRem[i] % g_SmallPrime[c]) == 0) {
+                PkaCopyDataFromPkaReg(pBase/*dst_ptr*/, primeSizeInWords + 1, rP/*srcReg*/);
+                RsaKgSieveWindow(pBase, primeSizeInWords + 1, pDelta, deltaSizeInWords, pSieve);
 
-                                        goto NextPrime;
-                                }
+                for (k = 0; k < RSA_KG_SIEVE_WINDOW_SIZE; k++) {
+                        /* the candidate k: P = P + Delta */
+                        if (k != 0) {
+                                PKA_ADD(LEN_ID_PQ_PKA_REG_BITS, rP/*Res*/, rP/*OpA*/, rDelta/*OpB*/);
                         }
-                }
 
-                /*  execute rT = GCD(e,P-1)  */
-                PKA_SUB_IM( LEN_ID_PQ_PKA_REG_BITS,  rT/*Res*/, rP/*OpA*/, 1/*imm*/);   /* rP= rP-1 */
-                PKA_COPY(LEN_ID_MAX_BITS, PKA_REG_N/*dest*/, rE/*src*/);
+                        /* checking if the current prime should be tested */
+                        if (pSieve[k >> 5] & (1UL << (k & 0x1F))) {
+                                continue;
+                        }
 
-                /* rT = GCD */
-                PKA_MOD_INV( LEN_ID_PQ_BITS, rT1/*Res*/, rT/*OpA*/);
+                        /*  execute rT = GCD(e,P-1)  */
+                        PKA_SUB_IM( LEN_ID_PQ_PKA_REG_BITS,  rT/*Res*/, rP/*OpA*/, 1/*imm*/);   /* rP= rP-1 */
+                        PKA_COPY(LEN_ID_MAX_BITS, PKA_REG_N/*dest*/, rE/*src*/);
 
-                /* if the GCD != 1, go to the next prime */
-                PKA_COMPARE_IM_STATUS(LEN_ID_PQ_PKA_REG_BITS, rT/*OpA*/, 1/*OpB*/, status);
-                if (status != 1) {
-                        goto NextPrime;
-                }
+                        /* rT = GCD */
+                        PKA_MOD_INV( LEN_ID_PQ_BITS, rT1/*Res*/, rT/*OpA*/);
 
-                /*  initialization of modular operations for modulus P */
-                /* reset modulus in register r0 = rP */
-                PKA_COPY(LEN_ID_MAX_BITS, PKA_REG_N/*dst*/, rP/*src*/);
+                        /* if the GCD != 1, go to the next prime */
+                        PKA_COMPARE_IM_STATUS(LEN_ID_PQ_PKA_REG_BITS, rT/*OpA*/, 1/*OpB*/, status);
+                        if (status != 1) {
+                                continue;
+                        }
 
-                /* initialization of modular operations */
-                PkaCalcNpIntoPkaReg(LEN_ID_PQ_BITS, modulusSizeInBits, PKA_REG_N, PKA_REG_NP, rT, rT1);
+                        /*  initialization of modular operations for modulus P */
+                        /* reset modulus in register r0 = rP */
+                        PKA_COPY(LEN_ID_MAX_BITS, PKA_REG_N/*dst*/, rP/*src*/);
 
+                        /* initialization of modular operations */
+                        PkaCalcNpIntoPkaReg(LEN_ID_PQ_BITS, modulusSizeInBits, PKA_REG_N, PKA_REG_NP, rT, rT1);
 
-                /*   perform primality tests   */
-                /* init lhe test flag to FALSE */
-                successCode = CC_FALSE;
 
-                /* execute the Miller-Rabin test */
-                error = PkaRsaKgX931MillerRabinTest(f_rng, p_rng,
-                                                    LEN_ID_PQ_BITS,
-                                                    modulusSizeInBits,
-                                                    &successCode,    /*out*/
-                                                    rsaKgPrimeTestParams->pqPrimesMilRabTestsCount, /*count R-M Tests */
-                                                    rT, rT1, rT2,    /*temp registers*/
-                                                    pTempBuff+2*CALC_PRIME_PRODUCT);
-                if (error != CC_OK) {
-                        goto End; //LR goto ClearAndReturn
-                }
+                        /*   perform primality tests   */
+                        /* init lhe test flag to FALSE */
+                        successCode = CC_FALSE;
 
-                /* if the previous test succeeded, execute the Lucas test */
-                if (successCode == CC_TRUE) {
-                        error = PkaRsaKgX931LucasPrimeTest(
-                                                          LEN_ID_PQ_BITS,
-                                                          &successCode,     /*out*/
-                                                          pRegTemps + 3, /*temp registers list*/
-                                                          tempsCount-3);
+                        /* execute the Miller-Rabin test */
+                        error = PkaRsaKgX931MillerRabinTest(f_rng, p_rng,
+                                                            LEN_ID_PQ_BITS,
+                                                            modulusSizeInBits,
+                                                            &successCode,    /*out*/
+                                                            rsaKgPrimeTestParams->pqPrimesMilRabTestsCount, /*count R-M Tests */
+                                                            rT, rT1, rT2,    /*temp registers*/
+                                                            pTempBuff + RSA_KG_SIEVE_BUFF_SIZE_IN_WORDS);
                         if (error != CC_OK) {
-                                goto End;  //LR goto ClearAndReturn
+                                return error;
                         }
-                }
 
-                /* if both tests are passed, exit - we have finded a prime */
-                if (successCode == CC_TRUE) {
-                        return CC_OK;
-                }
-
-                /*    finding the next prime candidate        */
-                NextPrime:
-
-                /* updating of remainders Rem[i] */
-                for (i = 0 ; i < CALC_PRIME_PRODUCT ; i++) {
-                        pTempRem[i] += pTempDelta[i];
-                        if (pTempRem[i] < pTempDelta[i]) {
-                                pTempRem[i] -= g_PrimeProduct[i];
+                        /* if the previous test succeeded, execute the Lucas test */
+                        if (successCode == CC_TRUE) {
+                                error = PkaRsaKgX931LucasPrimeTest(
+                                                                  LEN_ID_PQ_BITS,
+                                                                  &successCode,     /*out*/
+                                                                  pRegTemps + 3, /*temp registers list*/
+                                                                  tempsCount-3);
+                                if (error != CC_OK) {
+                                        return error;
+                                }
                         }
 
+                        /* if both tests are passed, exit - we have finded a prime */
+                        if (successCode == CC_TRUE) {
+                                return CC_OK;
+                        }
                 }
 
-		//find new P if previous one isn't correct
-                /* the new prime candidate: P = P + Delta */
+                /* move P to the first candidate of the next window */
                 PKA_ADD(LEN_ID_PQ_PKA_REG_BITS, rP/*Res*/, rP/*OpA*/, rDelta/*OpB*/);
 
         }/* end of searching for a prime loop */
-
-End:
-        return error;
-
 }
 
 /***********    RsaKgX931FindPrime   function      **********************/
@@ -1001,53 +1155,6 @@ static CCError_t RsaKgX931FindPrime(CCRndGenerateVectWorkFunc_t f_rng, /*!< [in]
 }
 
 
-/***********    RsaKgQuickPrimeTest   function      **********************/
-/**
- * @brief Checks primality of big number relating to set of small prime numbers.
- *
- *   Notes:  - 3 PKA registers used: rP, rModRes, rSmallNum,
- *           - the PKA must be initialized according tp P size,
- *           - lenId+1 entry containing the extended register size.
- *
- * @return  CC_OK On success, otherwise indicates failure
- */
-static int32_t RsaKgQuickPrimeTest(uint8_t    lenId,    /*!< [in]  The SizesTable entry, containing the exact P size in bits. */
-                                   int8_t     rP,       /*!< [in]  The virtual pointer to big number P register to be checked. */
-                                   int8_t     rModRes,     /*!< [in]  Virtual pointers to temp registers. */
-                                   int8_t     rSmallPrime, /*!< [in]  Virtual pointers to temp registers. */
-                                   int8_t     rT,          /*!< [in]  Virtual pointers to temp registers. */
-                                   uint32_t   divCount)    /*!< [in]  . */
-{
-        uint32_t i;
-        uint32_t status;
-
-        /* set pointer smallPrime_ptr to PKA register low word */
-        /* clear rSmallPrime register (with extension) */
-        PKA_2CLEAR(LEN_ID_MAX_BITS, rSmallPrime/*OpA*/);
-
-        /* Check primality by dividing P by small primes */
-        for (i = 0; i < divCount; i++) {
-                /* copy rP into rModReg for dividing */
-                PKA_COPY(LEN_ID_MAX_BITS, rModRes/*dst*/, rP/*src*/);
-
-                /* set the next small prime into PKA register */
-                PKA_WRITE_WORD_TO_REG(g_SmallPrime[i], 0, rSmallPrime);
-
-                /* calculate remainder: rModReg = rP % smallPrime */
-                PKA_DIV( lenId+1, rT/*ResNotUsed*/, rModRes/*OpA*/, rSmallPrime/*OpB*/);
-
-                /* check is the remainder equaled to 0 by add operation */
-                PKA_ADD_IM( lenId+1, RES_DISCARD/*discard Res*/, rModRes/*OpA*/, 0/*OpB*/);
-                PKA_GET_STATUS_ALU_OUT_ZERO(status);
-                if (status) {
-                        return CC_FALSE;
-                }
-        }
-
-        return CC_TRUE;
-}
-
-
 /***********    PkaRsaKgFindPrime   function      **********************/
 /**
  * @brief Finds a valid prime for the Key Gen.
@@ -1261,6 +1368,22 @@ static CCError_t RsaKgPrimeTest(CCRndGenerateVectWorkFunc_t f_rng, /*!< [in] - P
         /* exact size of P */
         modulusSizeInBits = CC_BITS_IN_32BIT_WORD * sizeWords;
 
+        /* count of small primes to check:
+            - for DH algorithm use predefined value,
+              else use maximal value  */
+        if (primeTestMode == CC_DH_PRIME_TEST_MODE) {
+                divCount = RSA_QUICK_PRIME_TEST_DIVISIONS_COUNT;
+        } else {
+                divCount = RSA_KG_SIEVE_PRIMES_COUNT;
+        }
+
+        /* test by small prime numbers: the candidates, divisible by a small prime,
+           are rejected without PKA operations */
+        *pIsPrime = (int8_t)RsaKgTrialDivision(pPrimeP, sizeWords, divCount);
+        if (*pIsPrime != CC_TRUE) {
+                return CC_OK;
+        }
+
         /* initialize the PKA engine on default mode with size of registers       */
         /* according to operation size = max(Asize,Bsize)                         */
         error = PkiCalcNp(pTempBuff, pPrimeP, modulusSizeInBits);
@@ -1280,24 +1403,6 @@ static CCError_t RsaKgPrimeTest(CCRndGenerateVectWorkFunc_t f_rng, /*!< [in] - P
         PkaCopyDataIntoPkaReg( PKA_REG_NP/*dstReg*/, LEN_ID_MAX_BITS/*lenId*/, pTempBuff/*src_ptr*/,
                                 CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
 
-        /*   execute primality tests       */
-        /* count of small primes (each one is DxUint16) to check:
-            - for DH algorithm use predefined value,
-              else use maximal value  */
-
-        if (primeTestMode == CC_DH_PRIME_TEST_MODE) {
-                divCount = RSA_QUICK_PRIME_TEST_DIVISIONS_COUNT;
-        } else {
-                divCount = sizeof(g_SmallPrime) / sizeof(uint16_t);
-        }
-
-        /* test by small prime numbers */
-        *pIsPrime = (int8_t)RsaKgQuickPrimeTest(
-                                                     LEN_ID_N_BITS/*lenId*/,
-                                                     PKA_REG_N /*prime P*/,
-                                                     rT2, rT3, rT4/*temp regs*/,
-                                                     divCount);
-
         /* the Miller-Rabin test */
         if (*pIsPrime == CC_TRUE) {
                 error = PkaRsaKgX931MillerRabinTest(f_rng, p_rng,
@@ -1493,21 +1598,19 @@ static CCError_t RsaKgFindPrime(
                     void *p_rng,           /*!< [in/out]  - Pointer to the random context - the input to f_rng. */
                     uint32_t *pPubExp,     /*!< [in]  Pointer to the public exponent. */
                     uint32_t  eSizeInBits, /*!< [in/out]  Size of public exponent in bits. */
-                    uint32_t  nSizeInBits, /*!< [in/out]  Required size of the key in bits. */
+                    uint32_t  primeSizeInBits, /*!< [in]  Required size of the prime in bits. */
                     uint32_t *pSuccess,    /*!< [out]  Pointer to the flag of success generation of P,Q.*/
                     uint32_t *pPrime,      /*!< [out]  Pointer to the first factor - P. */
                     uint32_t *pTempBuff)   /*!< [out]  Temp buffer for internal use. */
 {
     CCError_t error=CC_OK;
-    uint32_t primeSizeInBits, primeSizeInWords;
+    uint32_t primeSizeInWords;
     RsaKgParams_t rsaKgPrimeTestParams;
     /* virtual pointers to PKA registers of single size */
     int8_t   rE, rP;
     /* virtual pointers to single temp PKA registers */
     uint32_t  status, maxCountRegs = 20;
 
-    // setting the primes P,Q length ; Note: the size of the modulus n is even
-    primeSizeInBits = nSizeInBits / 2;
     primeSizeInWords = CALC_FULL_32BIT_WORDS(primeSizeInBits);
 
     /*Initialize PKA and mutex lock*/
@@ -1524,12 +1627,12 @@ static CCError_t RsaKgFindPrime(
 
     /* Set size if P, Q and auxiliary primes p1,p2,q1,q2 according  *
      *   to keysize. The following settings meet to  FIPS 186-4:    *
-     *   5.1, C.3: Tab.C3.                                          */
-    if (nSizeInBits <= CC_RSA_FIPS_KEY_SIZE_1024_BITS) {
+     *   5.1, C.3: Tab.C3, for a two-prime key of twice the prime size */
+    if (2*primeSizeInBits <= CC_RSA_FIPS_KEY_SIZE_1024_BITS) {
         rsaKgPrimeTestParams.auxPrimesSizeInBits = PKA_RSA_KEY_1024_AUX_PRIME_SIZE_BITS;
         rsaKgPrimeTestParams.auxPrimesMilRabTestsCount = PKA_RSA_KEY_1024_AUX_PRIME_RM_TST_COUNT /*38*/;
         rsaKgPrimeTestParams.pqPrimesMilRabTestsCount  = PKA_RSA_KEY_1024_PQ_PRIME_RM_TST_COUNT  /* 7*/;
-    } else if (nSizeInBits <= CC_RSA_FIPS_KEY_SIZE_2048_BITS) {
+    } else if (2*primeSizeInBits <= CC_RSA_FIPS_KEY_SIZE_2048_BITS) {
         rsaKgPrimeTestParams.auxPrimesSizeInBits = PKA_RSA_KEY_2048_AUX_PRIME_SIZE_BITS;
         rsaKgPrimeTestParams.auxPrimesMilRabTestsCount = PKA_RSA_KEY_2048_AUX_PRIME_RM_TST_COUNT /*32*/;
         rsaKgPrimeTestParams.pqPrimesMilRabTestsCount  = PKA_RSA_KEY_2048_PQ_PRIME_RM_TST_COUNT  /* 4*/;
@@ -1542,13 +1645,13 @@ static CCError_t RsaKgFindPrime(
     /**********************************************************************************/
     /*                     CALCULATIONS WITH SHORT REGISTERS                          */
     /* init PKA on default mode according to P,Q operation size for creating P and Q. */
-    /*  Note: All PKA memory shall be cleaned, insert nSizeInBits/2 => entry 0,       */
-    /*        nSizeInBits/2+CC_PKA_WORD_SIZE_IN_BITS => entry 1                     */
+    /*  Note: All PKA memory shall be cleaned, insert primeSizeInBits => entry 0,     */
+    /*        primeSizeInBits+CC_PKA_WORD_SIZE_IN_BITS => entry 1                   */
     /**********************************************************************************/
 
     /* set additional sizes into RegsSizesTable: */
-    PkaSetLenIds(nSizeInBits/2, LEN_ID_PQ_BITS);
-    PkaSetLenIds(GET_FULL_OP_SIZE_BITS(nSizeInBits/2), LEN_ID_PQ_PKA_REG_BITS);
+    PkaSetLenIds(primeSizeInBits, LEN_ID_PQ_BITS);
+    PkaSetLenIds(GET_FULL_OP_SIZE_BITS(primeSizeInBits), LEN_ID_PQ_PKA_REG_BITS);
     PkaSetLenIds(rsaKgPrimeTestParams.auxPrimesSizeInBits, LEN_ID_AUX_PRIME_BITS);
 
     /* inforcing the prime candidates P,Q so the size of they is keySize/2 */
@@ -1693,6 +1796,108 @@ End:
 }
 
 
+/***********    RsaCalculateOtherPrimesCrtParams   function      **********************/
+/**
+ * @brief Calculates the CRT parameters of the additional factors of a multi-prime key:
+ *        d_i = E^-1 mod (r_i - 1) and t_i = (P*Q*r_3*...*r_(i-1))^-1 mod r_i.
+ *        The factors P, Q and r_i are given in the private key structure.
+ *
+ *        Note: the PKA is initialized with registers of twice the factor size, so
+ *        the product of two reduced factors fits in a register.
+ *
+ * @return  CC_OK On success, otherwise indicates failure
+ */
+CCError_t RsaCalculateOtherPrimesCrtParams(uint32_t *pPubExp,       /*!< [in]  Pointer to the public exponent. */
+                                           uint32_t eSizeInBits,    /*!< [in]  Public exponent size in bits. */
+                                           CCRsaPrivKey_t *pPrivKey) /*!< [in/out]  Private key on CRT mode with the factors set. */
+{
+     CCError_t error=CC_OK;
+     uint32_t i, j, rSizeInWords, regSizeInBits;
+     CCRsaPrivCrtPrime_t *pPrime;
+     /* virtual pointers to PKA registers */
+     int8_t  r0, rE, rAcc, rB, rRes;
+     /* virtual pointers to single temp PKA registers */
+     int8_t rT1, rT2, rT3, rT4;
+     uint32_t maxCountRegs = 12;
+
+     /* registers size: twice the largest factor */
+     regSizeInBits = 0;
+     for (i = 0; i < pPrivKey->PriveKeyDb.Crt.primesCount - 2; i++) {
+         regSizeInBits = CC_MAX(regSizeInBits, 2*pPrivKey->PriveKeyDb.Crt.otherPrimes[i].RSizeInBits);
+     }
+
+     error = PkaInitAndMutexLock(regSizeInBits, &maxCountRegs);
+     if (error != CC_SUCCESS) {
+         return error;
+     }
+
+     // set virtual registers pointers
+     r0 = regTemps[0]; /* PKA_REG_N */
+     rE = regTemps[2]; /*2*/
+     rAcc = regTemps[3]; /*3*/
+     rB = regTemps[4]; /*4*/
+     rRes = regTemps[5]; /*5*/
+     rT1 = regTemps[6]; /*6*/
+     rT2 = regTemps[7]; /*7*/
+     rT3 = regTemps[8]; /*8*/
+     rT4 = regTemps[9]; /*9*/
+
+     PkaCopyDataIntoPkaReg(rE/*dstReg*/, LEN_ID_MAX_BITS, pPubExp/*src_ptr*/, CALC_FULL_32BIT_WORDS(eSizeInBits));
+
+     for (i = 0; i < pPrivKey->PriveKeyDb.Crt.primesCount - 2; i++) {
+         pPrime = &pPrivKey->PriveKeyDb.Crt.otherPrimes[i];
+         rSizeInWords = CALC_FULL_32BIT_WORDS(pPrime->RSizeInBits);
+
+         /* operations on the double size registers */
+         PkaSetLenIds(2*pPrime->RSizeInBits, LEN_ID_N_BITS);
+         PkaSetLenIds(GET_FULL_OP_SIZE_BITS(2*pPrime->RSizeInBits), LEN_ID_N_PKA_REG_BITS);
+
+         // rAcc = P*Q*r_3*...*r_(i-1) mod r_i;
+         PkaCopyDataIntoPkaReg(r0/*dstReg*/, LEN_ID_MAX_BITS, pPrime->R/*src_ptr*/, rSizeInWords);
+         PkaCopyDataIntoPkaReg(rAcc/*dstReg*/, LEN_ID_MAX_BITS, pPrivKey->PriveKeyDb.Crt.P/*src_ptr*/,
+                               CALC_FULL_32BIT_WORDS(pPrivKey->PriveKeyDb.Crt.PSizeInBits));
+         PKA_DIV(LEN_ID_N_PKA_REG_BITS, RES_DISCARD/*Res not used*/, rAcc/*OpA and remainder*/, r0/*OpB*/);
+         for (j = 0; j <= i; j++) {
+             if (j == 0) {
+                 PkaCopyDataIntoPkaReg(rB/*dstReg*/, LEN_ID_MAX_BITS, pPrivKey->PriveKeyDb.Crt.Q/*src_ptr*/,
+                                       CALC_FULL_32BIT_WORDS(pPrivKey->PriveKeyDb.Crt.QSizeInBits));
+             } else {
+                 PkaCopyDataIntoPkaReg(rB/*dstReg*/, LEN_ID_MAX_BITS, pPrivKey->PriveKeyDb.Crt.otherPrimes[j-1].R/*src_ptr*/,
+                                       CALC_FULL_32BIT_WORDS(pPrivKey->PriveKeyDb.Crt.otherPrimes[j-1].RSizeInBits));
+             }
+             PKA_DIV(LEN_ID_N_PKA_REG_BITS, RES_DISCARD/*Res not used*/, rB/*OpA and remainder*/, r0/*OpB*/);
+             PKA_MUL_LOW(LEN_ID_N_PKA_REG_BITS, rAcc/*Res*/, rAcc/*OpA*/, rB/*OpB*/);
+             PKA_DIV(LEN_ID_N_PKA_REG_BITS, RES_DISCARD/*Res not used*/, rAcc/*OpA and remainder*/, r0/*OpB*/);
+         }
+
+         /* modular operations on the factor size */
+         PkaSetLenIds(pPrime->RSizeInBits, LEN_ID_N_BITS);
+         PkaSetLenIds(GET_FULL_OP_SIZE_BITS(pPrime->RSizeInBits), LEN_ID_N_PKA_REG_BITS);
+
+         // t_i = rAcc^-1 mod r_i;
+         PKA_MOD_INV(LEN_ID_N_BITS, rRes/*Res*/, rAcc/*OpB*/);
+         PkaCopyDataFromPkaReg(pPrime->tR, rSizeInWords, rRes/*srcReg*/);
+
+         // d_i = E^-1 mod (r_i-1): set mod register r0=r_i-1 and perform ModInv operation
+         PKA_FLIP_BIT0(LEN_ID_N_PKA_REG_BITS, r0/*res*/, r0/*opA*/);
+         PKA_COPY(LEN_ID_MAX_BITS, rT1/*dst*/, rE/*src*/);
+         error = PkaExecFullModInv(rT1/*OpB*/, rRes/*Res*/, rT2, rT3, rT4, rAcc);
+         if (error != CC_OK) {
+             goto End;
+         }
+         PkaCopyDataFromPkaReg(pPrime->dR, rSizeInWords, rRes/*srcReg*/);
+
+         pPrime->dRSizeInBits = CC_CommonGetWordsCounterEffectiveSizeInBits(pPrime->dR, rSizeInWords);
+         pPrime->tRSizeInBits = CC_CommonGetWordsCounterEffectiveSizeInBits(pPrime->tR, rSizeInWords);
+     }
+
+ End:
+     PkaFinishAndMutexUnlock(maxCountRegs);
+     return error;
+
+}
+
+
 
 
 
@@ -1827,7 +2032,7 @@ CCError_t RsaGenPandQ(
 		error = RsaKgFindPrime(
 		        f_rng, p_rng,
 				pPubExp,  eSizeInBits,
-				KeySize,
+				KeySize/2,
 				&success,
 				pPrimeP,
 				pKeyGenData->KGData.kg_buf.ccRSAKGDataIntBuff);
@@ -1876,7 +2081,7 @@ CCError_t RsaGenPandQ(
 		error = RsaKgFindPrime(
 		        f_rng, p_rng,
 				pPubExp,  eSizeInBits,
-				KeySize,
+				KeySize/2,
 				&success,
 				pPrimeQ,
 				pKeyGenData->KGData.kg_buf.ccRSAKGDataIntBuff);
@@ -1936,4 +2141,57 @@ End:
 	return error;
 }
 
+
+/***********    RsaGenPrime   function      **********************/
+/**
+ * @brief Generates a single prime factor of a multi-prime RSA key.
+ *
+ *        The three most significant bits of the prime are set, so that the product of
+ *        up to CC_RSA_MAX_PRIMES_COUNT factors has the exact sum of their sizes.
+ *
+ * @return  CC_OK On success, otherwise indicates failure
+ */
+CCError_t RsaGenPrime(
+                    CCRndGenerateVectWorkFunc_t f_rng, /*!< [in] - Pointer to DRBG function*/
+                    void           *p_rng,          /*!< [in/out]  - Pointer to the random context - the input to f_rng. */
+                    uint32_t        primeSizeInBits,/*!< [in]  Size of the prime in bits, multiple of 32. */
+                    uint32_t        eSizeInBits,    /*!< [in]  Size of public exponent in bits. */
+                    uint32_t       *pPubExp,        /*!< [in]  Pointer to the public exponent. */
+                    uint32_t       *pPrime,         /*!< [out]  Pointer to the prime buffer of primeSizeInWords + 1 words. */
+                    CCRsaKgData_t  *pKeyGenData)    /*!< [in] Temporary buffer for internal use. */
+{
+	CCError_t error = CC_OK;
+	uint32_t primeSizeWords = CALC_FULL_32BIT_WORDS(primeSizeInBits);
+	uint32_t success = 0;
+
+	do {
+		/* clean the word adjacent to the old prime (in case there's garbage in it) */
+		pPrime[primeSizeWords] = 0;
+
+		error = CC_RsaGenerateVectorInRangeX931(f_rng, p_rng, primeSizeWords, pPrime);
+		if (error != CC_OK) {
+			return error;
+		}
+		pPrime[primeSizeWords - 1] |= 0xE0000000;
+
+		error = RsaKgFindPrime(
+		        f_rng, p_rng,
+				pPubExp,  eSizeInBits,
+				primeSizeInBits,
+				&success,
+				pPrime,
+				pKeyGenData->KGData.kg_buf.ccRSAKGDataIntBuff);
+		if (error != CC_OK) {
+			return error;
+		}
+
+		/* the search may step over the top bits */
+		if ((pPrime[primeSizeWords - 1] & 0xE0000000) != 0xE0000000) {
+			success = 0;
+		}
+	} while (!success);
+
+	return error;
+}
+
 #endif /* !defined(CC_IOT) || ( defined(CC_IOT) && defined(MBEDTLS_RSA_C)) */
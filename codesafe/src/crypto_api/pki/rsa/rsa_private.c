@@ -24,6 +24,7 @@
 #include "pka_error.h"
 #include "rsa.h"
 #include "rsa_private.h"
+#include "cc_pal_perf.h"
 
 extern const int8_t regTemps[PKA_MAX_COUNT_OF_PHYS_MEM_REGS];
 
@@ -101,6 +102,108 @@ static CCError_t RsaExecPrivKeyExpNonCrt(CCRsaPrivKey_t    *pPrivKey , /*!< [in]
 }
 
 
+/***********    RsaExecPrivKeyExpOtherPrimes   function      **********************/
+/**
+ * @brief This function completes the RSA private key CRT exponent of a multi-prime key
+ *        in the PKA session of RsaExecPrivKeyExpCrt: on input the register rMpq holds
+ *        the result M modulo P*Q, and the registers rP and rQ hold the factors P and Q.
+ *
+ *    Algorithm [PKCS #1 v2.2]:
+ *
+ *        R = P*Q;
+ *        for each additional factor r_i:
+ *        1. M_i  =  C^d_i mod r_i;
+ *        2. h = (M_i - M)*t_i mod r_i;
+ *        3. M = M + R * h;
+ *        4. R = R * r_i.
+ *
+ *     Where: M- message representative, C- ciphertext,
+ *            r_i, d_i, t_i - CRT parameters of the additional factors;
+ *            ^ - exponentiation symbol.
+ *
+ *     Note: 10 PKA registers are used: r0-r7,  r30,r31.
+ *
+ * @return  The register holding the result M.
+ */
+static int8_t RsaExecPrivKeyExpOtherPrimes(CCRsaPrivKey_t    *pPrivKey , /*!< [in]  Private key database. */
+					   CCRsaPrimeData_t *pPrivData,        /*!< [in]  Containing the DataIn buffer. */
+					   int8_t rMpq,                        /*!< [in]  Register of the result modulo P*Q. */
+					   int8_t rP,                          /*!< [in]  Register of the factor P. */
+					   int8_t rQ)                          /*!< [in]  Register of the factor Q. */
+{
+	uint32_t  modSizeWords, rSizeInWords;
+	uint32_t  i;
+	CCRsaPrivCrtPrime_t *pPrime;
+
+	/* virtual registers pointers */
+	int8_t  rN  = PKA_REG_N;
+	int8_t  rNP = PKA_REG_NP;
+	int8_t  rC  = regTemps[2];
+	int8_t  rT  = regTemps[3];
+	int8_t  rT1 = regTemps[4];
+	int8_t  rM  = regTemps[5];
+	int8_t  rD  = regTemps[6];
+	int8_t  rR  = regTemps[7];
+
+	modSizeWords = CALC_FULL_32BIT_WORDS(pPrivKey->nSizeInBits);
+
+	/* M and R = P*Q are taken from the registers of the CRT exponent, before r0 and r6 are reused */
+	PKA_COPY(LEN_ID_MAX_BITS/*LenID*/, rM/*dest*/, rMpq/*src*/);
+	PkaClearPkaRegWords(rM, modSizeWords);
+	PKA_MUL_LOW(LEN_ID_N_PKA_REG_BITS/*LenID*/, rR/*Res*/, rP/*OpA*/, rQ/*OpB*/);
+
+	/* set back the default N_NP_T0_T1 register: N->0, NP->1, T0->30, T1->31 */
+	PKA_SET_N_NP_T0_T1_REG(PKA_REG_N, PKA_REG_NP, PKA_REG_T0, PKA_REG_T1);
+
+	/* copy DataIn into PKA register */
+	PkaCopyDataIntoPkaReg(rC/*2 dstReg*/, LEN_ID_MAX_BITS/*LenID*/, pPrivData->DataIn/*src_ptr*/, modSizeWords);
+
+	for (i = 0; i < pPrivKey->PriveKeyDb.Crt.primesCount - 2; i++) {
+		pPrime = &pPrivKey->PriveKeyDb.Crt.otherPrimes[i];
+		rSizeInWords = CALC_FULL_32BIT_WORDS(pPrime->RSizeInBits);
+
+		/*  set Sizes table: 0- Nsize, 1- Nsize+1w (is done), 2- Rsize  */
+		PkaSetLenIds(pPrime->RSizeInBits, LEN_ID_PQ_BITS);
+
+		/* copy the factor r_i, its Barrett tag and the exponent d_i into PKA registers */
+		PkaCopyDataIntoPkaReg(rN/*0 dstReg*/, LEN_ID_MAX_BITS/*LenID*/, pPrime->R/*src_ptr*/, rSizeInWords);
+		PkaCopyDataIntoPkaReg(rNP/*1 dstReg*/, LEN_ID_MAX_BITS/*LenID*/,
+				      ((RsaPrivKeyDb_t*)(pPrivKey->ccRSAPrivKeyIntBuff))->Crt.RP[i]/*src_ptr*/,
+				      CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+		PkaCopyDataIntoPkaReg(rD/*6 dstReg*/, LEN_ID_MAX_BITS/*LenID*/, pPrime->dR/*src_ptr*/, rSizeInWords);
+
+		/* M_i = DataIn^d_i mod r_i: rT1 = (rC mod r_i)^rD mod r_i */
+		PKA_COPY(LEN_ID_MAX_BITS/*LenID*/, rT/*dest*/, rC/*src*/);
+		PKA_DIV(LEN_ID_N_PKA_REG_BITS/*LenID*/, RES_DISCARD/*Res not used*/, rT/*OpA and remainder*/, rN/*OpB*/);
+		PKA_MOD_EXP(LEN_ID_PQ_BITS/*LenID*/, rT1/*Res*/, rT/*OpA*/, rD/*exp*/);
+
+		/* h = (M_i - M)*t_i mod r_i */
+		PKA_COPY(LEN_ID_MAX_BITS/*LenID*/, rT/*dest*/, rM/*src*/);
+		PKA_DIV(LEN_ID_N_PKA_REG_BITS/*LenID*/, RES_DISCARD/*Res not used*/, rT/*OpA and remainder*/, rN/*OpB*/);
+		PKA_MOD_SUB(LEN_ID_PQ_BITS/*LenID*/, rT1/*Res*/, rT1/*OpA*/, rT/*OpB*/);
+		PkaCopyDataIntoPkaReg(rD/*6 dstReg*/, LEN_ID_MAX_BITS/*LenID*/, pPrime->tR/*src_ptr*/, rSizeInWords);
+		PKA_MOD_MUL(LEN_ID_PQ_BITS/*LenID*/, rT/*Res*/, rT1/*OpA*/, rD/*OpB*/);
+
+		/* operation changes from r_i size to N size, need clearing registers high bits */
+		PkaClearPkaRegWords(rT, rSizeInWords);
+		PKA_2CLEAR(LEN_ID_MAX_BITS/*LenID*/, PKA_REG_T0/*dest*/);
+		PKA_COPY(LEN_ID_MAX_BITS/*LenID*/, rT1/*dest*/, rT/*src*/);
+
+		/* M = M + R*h */
+		PKA_MUL_LOW(LEN_ID_N_PKA_REG_BITS/*LenID*/, rT/*Res*/, rT1/*OpA*/, rR/*OpB*/);
+		PkaClearPkaRegWords(rT, modSizeWords);
+		PKA_ADD(LEN_ID_N_BITS/*LenID*/, rM/*Res*/, rM/*OpA*/, rT/*OpB*/);
+
+		/* R = R*r_i for the next factor */
+		if (i + 1 < pPrivKey->PriveKeyDb.Crt.primesCount - 2) {
+			PKA_MUL_LOW(LEN_ID_N_PKA_REG_BITS/*LenID*/, rR/*Res*/, rR/*OpA*/, rN/*OpB*/);
+		}
+	}
+
+	return rM;
+}
+
+
 /***********    RsaExecPrivKeyExpCrt   function      **********************/
 /**
  * @brief This function executes the RSA primitive: private key CRT exponent.
@@ -113,12 +216,14 @@ static CCError_t RsaExecPrivKeyExpNonCrt(CCRsaPrivKey_t    *pPrivKey , /*!< [in]
  *        2. Mp  =  C ^dP mod P,
  *        3  h = (Mp-Mq)*qInv mod P;
  *        4. M = Mq + Q * h.
+ *        The additional factors of a multi-prime key are then applied in the same
+ *        PKA session (see RsaExecPrivKeyExpOtherPrimes).
  *
  *     Where: M- message representative, C- ciphertext, D- priv.exponent, N- modulus,
  *            P,Q,dP,dQ, qInv - CRT private key parameters;
  *            ^ - exponentiation symbol.
  *
- *     Note: 9 PKA registers are used: r0-r6,  r30,r31.
+ *     Note: 10 PKA registers are used: r0-r7,  r30,r31.
  *
  * @return  CC_OK On success, otherwise indicates failure
  */
@@ -242,6 +347,11 @@ static CCError_t RsaExecPrivKeyExpCrt(CCRsaPrivKey_t    *pPrivKey , /*!< [in]  P
 	/* M = rT1 = rMq + rT */
 	PKA_ADD(LEN_ID_N_BITS/*LenID*/, rT/*Res*/, rT1/*OpA*/, rT/*OpB*/);
 
+	/* additional factors of a multi-prime key, in the same session: P is in rN and Q in rQ */
+	if (pPrivKey->PriveKeyDb.Crt.primesCount > 2) {
+		rT = RsaExecPrivKeyExpOtherPrimes(pPrivKey, pPrivData, rT, rN, rQ);
+	}
+
 	/*  Finish PKA and copy result */
 	PkaCopyDataFromPkaReg(pPrivData->DataOut,  modSizeWords, rT/*srcReg*/);
 
@@ -263,6 +373,7 @@ static CCError_t RsaExecPrivKeyExpCrt(CCRsaPrivKey_t    *pPrivKey , /*!< [in]  P
 CCError_t RsaInitPrivKeyDb( CCRsaPrivKey_t *pPrivKey )  /*!< [in]  Private key database. */
 {
 	CCError_t error = CC_OK;
+	uint32_t i;
 
 	/* calculate NP on NonCRT mode  */
 	if (pPrivKey->OperationMode == CC_RSA_NoCrt) {
@@ -305,6 +416,24 @@ CCError_t RsaInitPrivKeyDb( CCRsaPrivKey_t *pPrivKey )  /*!< [in]  Private key d
 			goto END;
 		}
 
+		/* calculate Barrett tags RP for the additional factors of a multi-prime key */
+		if (pPrivKey->PriveKeyDb.Crt.primesCount > CC_RSA_MAX_PRIMES_COUNT) {
+			error = PKA_KEY_ILLEGAL_SIZE_ERROR;
+			goto END;
+		}
+		for (i = 2; i < pPrivKey->PriveKeyDb.Crt.primesCount; i++) {
+			if (pPrivKey->PriveKeyDb.Crt.otherPrimes[i-2].RSizeInBits > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS/2) {
+				error = PKA_KEY_ILLEGAL_SIZE_ERROR;
+				goto END;
+			}
+			error = PkiCalcNp( ((RsaPrivKeyDb_t *)(pPrivKey->ccRSAPrivKeyIntBuff))->Crt.RP[i-2],   /*out*/
+					    pPrivKey->PriveKeyDb.Crt.otherPrimes[i-2].R, /*in*/
+					    pPrivKey->PriveKeyDb.Crt.otherPrimes[i-2].RSizeInBits);
+			if (error != CC_SUCCESS) {
+				goto END;
+			}
+		}
+
 
 	}/* end of CRT case */
 
@@ -328,6 +457,11 @@ CCError_t RsaInitPrivKeyDb( CCRsaPrivKey_t *pPrivKey )  /*!< [in]  Private key d
  *        2.3  h = (M1-M2)*qInv mod P;
  *        2.4. M = M2 + Q * h.
  *
+ *     3. If CRT exponent of a multi-prime key, then for each additional factor r_i:
+ *        3.1. M_i  =  C^d_i mod r_i,
+ *        3.2. h = (M_i - M)*t_i mod r_i;
+ *        3.3. M = M + R * h, R = P*Q*r_3*...*r_(i-1).
+ *
  *     Where: M- message representative, C- ciphertext, N- modulus,
  *            P,Q,dP,dQ, qInv - CRT private key parameters;
  *            ^ - exponentiation symbol.
@@ -341,15 +475,162 @@ CCError_t RsaExecPrivKeyExp( CCRsaPrivKey_t    *pPrivKey ,   /*!< [in]  Private
 					CCRsaPrimeData_t *pPrivData )   /*!< [in/out]  Containing DataIn and DataOut buffers. */
 {
 	CCError_t error = CC_OK;
+	CCPalPerfData_t perfIdx = 0;
 
+	CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_ModExp);
 	/*         1.  NonCRT  case                     */
 	if (pPrivKey->OperationMode == CC_RSA_NoCrt) {
+		PKI_PROF_PUSH(RSA_PRIV_NON_CRT);
 		error = RsaExecPrivKeyExpNonCrt(pPrivKey, pPrivData );
+		PKI_PROF_POP();
 	} else {
 		/*         2.  CRT  case                         */
+		PKI_PROF_PUSH(RSA_PRIV_CRT);
+		/*         3.  and additional factors of a multi-prime key   */
 		error = RsaExecPrivKeyExpCrt(pPrivKey, pPrivData );
+		PKI_PROF_POP();
+	}
+	CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_ModExp);
+
+	return error;
+}
+
+
+/***********     RsaCalcMultiPrimeModulus  function      **********************/
+/**
+ * @brief This function calculates the modulus N of a multi-prime key on CRT mode:
+ *        the product of all the prime factors. The result is set into the n buffer
+ *        of the private key and the nSizeInBits is updated.
+ *
+ *     Note: PKA registers used: r0-r3,  r30,r31.
+ *
+ * @return  CC_OK On success, otherwise indicates failure
+ */
+CCError_t RsaCalcMultiPrimeModulus(CCRsaPrivKey_t *pPrivKey)  /*!< [in/out]  Private key database. */
+{
+	CCError_t error = CC_OK;
+	uint32_t i;
+	uint32_t pkaReqRegs = 6;
+	uint32_t sumSizeInBits;
+	uint8_t rProd = regTemps[2];
+	uint8_t rT = regTemps[3];
+
+	sumSizeInBits = pPrivKey->PriveKeyDb.Crt.PSizeInBits + pPrivKey->PriveKeyDb.Crt.QSizeInBits;
+	for (i = 2; i < pPrivKey->PriveKeyDb.Crt.primesCount; i++) {
+		sumSizeInBits += pPrivKey->PriveKeyDb.Crt.otherPrimes[i-2].RSizeInBits;
+	}
+	if (sumSizeInBits > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS + pPrivKey->PriveKeyDb.Crt.primesCount - 1) {
+		return CC_RSA_INVALID_MODULUS_SIZE;
+	}
+
+	error = PkaInitAndMutexLock(CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS, &pkaReqRegs);
+	if (error != CC_OK) {
+		return error;
+	}
+
+	PkaCopyDataIntoPkaReg(rProd, LEN_ID_MAX_BITS, pPrivKey->PriveKeyDb.Crt.P,
+			      CALC_FULL_32BIT_WORDS(pPrivKey->PriveKeyDb.Crt.PSizeInBits));
+	PkaCopyDataIntoPkaReg(rT, LEN_ID_MAX_BITS, pPrivKey->PriveKeyDb.Crt.Q,
+			      CALC_FULL_32BIT_WORDS(pPrivKey->PriveKeyDb.Crt.QSizeInBits));
+	PKA_MUL_LOW(LEN_ID_N_PKA_REG_BITS, rProd/*Res*/, rProd/*OpA*/, rT/*OpB*/);
+
+	for (i = 2; i < pPrivKey->PriveKeyDb.Crt.primesCount; i++) {
+		PkaCopyDataIntoPkaReg(rT, LEN_ID_MAX_BITS, pPrivKey->PriveKeyDb.Crt.otherPrimes[i-2].R,
+				      CALC_FULL_32BIT_WORDS(pPrivKey->PriveKeyDb.Crt.otherPrimes[i-2].RSizeInBits));
+		PKA_MUL_LOW(LEN_ID_N_PKA_REG_BITS, rProd/*Res*/, rProd/*OpA*/, rT/*OpB*/);
+	}
+
+	pPrivKey->nSizeInBits = PkaGetRegEffectiveSizeInBits(rProd);
+	if (pPrivKey->nSizeInBits > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS) {
+		error = CC_RSA_INVALID_MODULUS_SIZE;
+	} else {
+		PkaCopyDataFromPkaReg(pPrivKey->n, CALC_FULL_32BIT_WORDS(pPrivKey->nSizeInBits), rProd);
+	}
+
+	PkaFinishAndMutexUnlock(pkaReqRegs);
+
+	return error;
+}
+
+
+/***********     RsaCheckOtherPrimesCrtParams  function      **********************/
+/**
+ * @brief This function checks the CRT parameters of the additional factors of a
+ *        multi-prime key against the private exponent d:
+ *             d_i = d mod (r_i - 1)  and  t_i * (P*Q*r_3*...*r_(i-1)) mod r_i = 1.
+ *
+ *     Note: PKA registers used: r0-r5,  r30,r31.
+ *
+ * @return  CC_OK On success, otherwise indicates failure
+ */
+CCError_t RsaCheckOtherPrimesCrtParams(CCRsaPrivKey_t *pPrivKey,  /*!< [in]  Private key database with the factors set. */
+				       uint32_t *pPrivExp,         /*!< [in]  Pointer to the private exponent d. */
+				       uint32_t dSizeInBits)       /*!< [in]  Private exponent size in bits. */
+{
+	CCError_t error = CC_OK;
+	uint32_t i, j, status;
+	uint32_t pkaReqRegs = 8;
+	CCRsaPrivCrtPrime_t *pPrime;
+	uint8_t rR = regTemps[2];
+	uint8_t rAcc = regTemps[3];
+	uint8_t rB = regTemps[4];
+	uint8_t rD = regTemps[5];
+
+	if (dSizeInBits == 0 || dSizeInBits > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS) {
+		return CC_RSA_INCONSISTENT_CRT_PARAMS_ERROR;
 	}
 
+	error = PkaInitAndMutexLock(CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS, &pkaReqRegs);
+	if (error != CC_OK) {
+		return error;
+	}
+
+	for (i = 0; i < pPrivKey->PriveKeyDb.Crt.primesCount - 2; i++) {
+		pPrime = &pPrivKey->PriveKeyDb.Crt.otherPrimes[i];
+
+		// rAcc = P*Q*r_3*...*r_(i-1) mod r_i;
+		PkaCopyDataIntoPkaReg(rR, LEN_ID_MAX_BITS, pPrime->R, CALC_FULL_32BIT_WORDS(pPrime->RSizeInBits));
+		PkaCopyDataIntoPkaReg(rAcc, LEN_ID_MAX_BITS, pPrivKey->PriveKeyDb.Crt.P,
+				      CALC_FULL_32BIT_WORDS(pPrivKey->PriveKeyDb.Crt.PSizeInBits));
+		PKA_DIV(LEN_ID_N_PKA_REG_BITS, RES_DISCARD/*Res not used*/, rAcc/*OpA and remainder*/, rR/*OpB*/);
+		for (j = 0; j <= i; j++) {
+			if (j == 0) {
+				PkaCopyDataIntoPkaReg(rB, LEN_ID_MAX_BITS, pPrivKey->PriveKeyDb.Crt.Q,
+						      CALC_FULL_32BIT_WORDS(pPrivKey->PriveKeyDb.Crt.QSizeInBits));
+			} else {
+				PkaCopyDataIntoPkaReg(rB, LEN_ID_MAX_BITS, pPrivKey->PriveKeyDb.Crt.otherPrimes[j-1].R,
+						      CALC_FULL_32BIT_WORDS(pPrivKey->PriveKeyDb.Crt.otherPrimes[j-1].RSizeInBits));
+			}
+			PKA_DIV(LEN_ID_N_PKA_REG_BITS, RES_DISCARD/*Res not used*/, rB/*OpA and remainder*/, rR/*OpB*/);
+			PKA_MUL_LOW(LEN_ID_N_PKA_REG_BITS, rAcc/*Res*/, rAcc/*OpA*/, rB/*OpB*/);
+			PKA_DIV(LEN_ID_N_PKA_REG_BITS, RES_DISCARD/*Res not used*/, rAcc/*OpA and remainder*/, rR/*OpB*/);
+		}
+
+		// t_i * rAcc mod r_i == 1;
+		PkaCopyDataIntoPkaReg(rB, LEN_ID_MAX_BITS, pPrime->tR, CALC_FULL_32BIT_WORDS(pPrime->tRSizeInBits));
+		PKA_MUL_LOW(LEN_ID_N_PKA_REG_BITS, rAcc/*Res*/, rAcc/*OpA*/, rB/*OpB*/);
+		PKA_DIV(LEN_ID_N_PKA_REG_BITS, RES_DISCARD/*Res not used*/, rAcc/*OpA and remainder*/, rR/*OpB*/);
+		PKA_COMPARE_IM_STATUS(LEN_ID_N_PKA_REG_BITS, rAcc/*OpA*/, 1/*OpB*/, status);
+		if (status != 1) {
+			error = CC_RSA_INCONSISTENT_CRT_PARAMS_ERROR;
+			goto End;
+		}
+
+		// d mod (r_i-1) == d_i;
+		PKA_FLIP_BIT0(LEN_ID_N_PKA_REG_BITS, rR/*Res*/, rR/*OpA*/);
+		PkaCopyDataIntoPkaReg(rD, LEN_ID_MAX_BITS, pPrivExp, CALC_FULL_32BIT_WORDS(dSizeInBits));
+		PKA_DIV(LEN_ID_N_PKA_REG_BITS, RES_DISCARD/*Res not used*/, rD/*OpA and remainder*/, rR/*OpB*/);
+		PkaCopyDataIntoPkaReg(rB, LEN_ID_MAX_BITS, pPrime->dR, CALC_FULL_32BIT_WORDS(pPrime->dRSizeInBits));
+		PKA_COMPARE_STATUS(LEN_ID_N_PKA_REG_BITS, rD/*OpA*/, rB/*OpB*/, status);
+		if (status != 1) {
+			error = CC_RSA_INCONSISTENT_CRT_PARAMS_ERROR;
+			goto End;
+		}
+	}
+
+End:
+	PkaFinishAndMutexUnlock(pkaReqRegs);
+
 	return error;
 }
 
@@ -41,6 +41,10 @@ typedef union {
   exponentiation, calculated in CC_RsaPubKeyBuild function */
 		uint32_t QP[CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS];
 
+/* the Barrett mod R tags for the additional factors of a multi-prime key,
+  calculated in CC_RsaPrivKeyBuild function */
+		uint32_t RP[CC_RSA_MAX_PRIMES_COUNT - 2][CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS];
+
 	}Crt;
 
 }RsaPrivKeyDb_t;
@@ -50,6 +54,12 @@ CCError_t RsaInitPrivKeyDb(CCRsaPrivKey_t *pPrivKey);
 CCError_t RsaExecPrivKeyExp(CCRsaPrivKey_t    *pPrivKey,
 			CCRsaPrimeData_t *pPrivData);
 
+CCError_t RsaCalcMultiPrimeModulus(CCRsaPrivKey_t *pPrivKey);
+
+CCError_t RsaCheckOtherPrimesCrtParams(CCRsaPrivKey_t *pPrivKey,
+				       uint32_t *pPrivExp,
+				       uint32_t dSizeInBits);
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,6 +23,8 @@
 #include "pki.h"
 #include "cc_pal_mutex.h"
 #include "pka_error.h"
+#include "cc_common_math.h"
+#include "cc_pal_perf.h"
 
 extern const int8_t regTemps[PKA_MAX_COUNT_OF_PHYS_MEM_REGS];
 
@@ -53,29 +55,38 @@ CCError_t RsaInitPubKeyDb(CCRsaPubKey_t *pPubKey)  /*!< [in]  Public key structu
 
 }
 
-/***********     RsaExecPubKeyExp  function      **********************/
+/***********     RsaExecPubKeyExpInSession  function      **********************/
 /**
- * @brief Executes the RSA primitive public key exponent :
+ * @brief Executes the RSA primitive public key exponent within an open PKA session:
  *
  *    pPubData->DataOut =  pPubData->DataIn ** pPubKey->e  mod  pPubKey->n,
  *    where: ** - exponent symbol.
  *
+ *    The modulus and its Barrett tag are loaded only if the key is not resident in the session,
+ *    so a run of operations with the same key pays for them once.
+ *
  *    Note: PKA registers used: r0-r4,   r30,r31, size of registers - Nsize.
  *
  * @return  CC_OK On success, otherwise indicates failure
  */
-
-CCError_t RsaExecPubKeyExp( CCRsaPubKey_t     *pPubKey,     /*!< [in]  Public key structure. */
-				       CCRsaPrimeData_t *pPubData )   /*!< [in]  Containing input data and output buffer. */
+CCError_t RsaExecPubKeyExpInSession(PkaSession_t      *pSession,    /*!< [in/out] Open PKA session of the modulus size. */
+				    CCRsaPubKey_t     *pPubKey,     /*!< [in]  Public key structure. */
+				    CCRsaPrimeData_t  *pPubData )   /*!< [in]  Containing input data and output buffer. */
 {
-	CCError_t error = CC_OK;
 	uint32_t  nSizeInWords, eSizeInWords;
-	uint32_t  pkaReqRegs = 7;
+	int32_t   i;
 
 	uint8_t rT2 = regTemps[2];
 	uint8_t rT3 = regTemps[3];
 	uint8_t rT4 = regTemps[4];
 
+	if ((pSession == NULL) || (pSession->isOpen == 0)) {
+		return PKA_SESSION_STATE_ERROR;
+	}
+	if (pSession->sizeInBits != pPubKey->nSizeInBits) {
+		return PKA_SESSION_SIZE_ERROR;
+	}
+
 	/* modulus size in bytes */
 	nSizeInWords = CALC_FULL_32BIT_WORDS(pPubKey->nSizeInBits);
 	eSizeInWords = CALC_FULL_32BIT_WORDS(pPubKey->eSizeInBits);
@@ -83,35 +94,82 @@ CCError_t RsaExecPubKeyExp( CCRsaPubKey_t     *pPubKey,     /*!< [in]  Public ke
 		return CC_RSA_INVALID_MODULUS_SIZE;
 	}
 
-	error = PkaInitAndMutexLock(pPubKey->nSizeInBits, &pkaReqRegs);
-	if (error != CC_OK) {
-		return error;
-	}
+	if (PkaSessionSelectKey(pSession, pPubKey) == CC_FALSE) {
+		/* copy modulus N into r0 register */
+		PkaCopyDataIntoPkaReg(PKA_REG_N/*dstReg*/, LEN_ID_MAX_BITS/*LenID*/,  pPubKey->n/*srcPtr*/,
+				       nSizeInWords);
 
-	/* copy modulus N into r0 register */
-	PkaCopyDataIntoPkaReg(PKA_REG_N/*dstReg*/, LEN_ID_MAX_BITS/*LenID*/,  pPubKey->n/*srcPtr*/,
-			       nSizeInWords);
-
-	/* copy the NP into r1 register NP */
-	PkaCopyDataIntoPkaReg(PKA_REG_NP/*dstReg*/, LEN_ID_MAX_BITS/*LenID*/, ((RsaPubKeyDb_t*)(pPubKey->ccRSAIntBuff))->NP/*srcPtr*/,
-			       CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+		/* copy the NP into r1 register NP */
+		PkaCopyDataIntoPkaReg(PKA_REG_NP/*dstReg*/, LEN_ID_MAX_BITS/*LenID*/, ((RsaPubKeyDb_t*)(pPubKey->ccRSAIntBuff))->NP/*srcPtr*/,
+				       CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS);
+	}
 
 	/* copy input data into PKI register: DataIn=>r2 */
 	PkaCopyDataIntoPkaReg( rT2/*dstReg*/, LEN_ID_MAX_BITS/*LenID*/,
 				pPubData->DataIn, nSizeInWords);
 
-	/* copy exponent data PKI register: e=>r3 */
-	PkaCopyDataIntoPkaReg(rT3/*dstReg*/, LEN_ID_MAX_BITS/*LenID*/,
-			       pPubKey->e, eSizeInWords);
-
-	/* .. calculate the exponent Res = OpA**OpB mod N; */
-	PKA_MOD_EXP(LEN_ID_N_BITS/*LenID*/, rT4/*Res*/, rT2/*OpA*/, rT3/*OpB*/);
+	if (eSizeInWords == 1) {
+		/* short public exponent (e.g. 65537): the exponent is not secret, so run the
+		   left-to-right square and multiply as a fixed sequence of modular multiplications
+		   scheduled by the bits of e, without the generic exponentiation of the engine */
+		PKA_COPY(LEN_ID_MAX_BITS/*LenID*/, rT4/*dst*/, rT2/*src*/);
+		for (i = (int32_t)CC_CommonGetWordsCounterEffectiveSizeInBits(pPubKey->e, 1) - 2; i >= 0; i--) {
+			PKA_MOD_MUL(LEN_ID_N_BITS/*LenID*/, rT4/*Res*/, rT4/*OpA*/, rT4/*OpB*/);
+			if ((pPubKey->e[0] >> i) & 1) {
+				PKA_MOD_MUL(LEN_ID_N_BITS/*LenID*/, rT4/*Res*/, rT4/*OpA*/, rT2/*OpB*/);
+			}
+		}
+	} else {
+		/* copy exponent data PKI register: e=>r3 */
+		PkaCopyDataIntoPkaReg(rT3/*dstReg*/, LEN_ID_MAX_BITS/*LenID*/,
+				       pPubKey->e, eSizeInWords);
+
+		/* .. calculate the exponent Res = OpA**OpB mod N; */
+		PKA_MOD_EXP(LEN_ID_N_BITS/*LenID*/, rT4/*Res*/, rT2/*OpA*/, rT3/*OpB*/);
+	}
 
 	/* copy result into output: r4 =>DataOut */
 	PkaCopyDataFromPkaReg(pPubData->DataOut, nSizeInWords, rT4/*srcReg*/);
 
-	PkaFinishAndMutexUnlock(pkaReqRegs);
+	return CC_OK;
+}
+
+/***********     RsaExecPubKeyExp  function      **********************/
+/**
+ * @brief Executes the RSA primitive public key exponent :
+ *
+ *    pPubData->DataOut =  pPubData->DataIn ** pPubKey->e  mod  pPubKey->n,
+ *    where: ** - exponent symbol.
+ *
+ *    The operation runs in its own PKA session.
+ *
+ * @return  CC_OK On success, otherwise indicates failure
+ */
+
+CCError_t RsaExecPubKeyExp( CCRsaPubKey_t     *pPubKey,     /*!< [in]  Public key structure. */
+				       CCRsaPrimeData_t *pPubData )   /*!< [in]  Containing input data and output buffer. */
+{
+	CCError_t error = CC_OK;
+	PkaSession_t session;
+	uint32_t  pkaReqRegs = 7;
+	CCPalPerfData_t perfIdx = 0;
+
+	if (CALC_FULL_32BIT_WORDS(pPubKey->nSizeInBits) > CALC_FULL_32BIT_WORDS(CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS)) {
+		return CC_RSA_INVALID_MODULUS_SIZE;
+	}
+
+	error = PkaSessionOpen(&session, pPubKey->nSizeInBits, &pkaReqRegs);
+	if (error != CC_OK) {
+		return error;
+	}
+
+	PKI_PROF_PUSH(RSA_PUB);
+	CC_PAL_PERF_OPEN_NEW_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_ModExp);
+	error = RsaExecPubKeyExpInSession(&session, pPubKey, pPubData);
+	CC_PAL_PERF_CLOSE_ENTRY(perfIdx, PERF_TEST_TYPE_PKA_ModExp);
+	PKI_PROF_POP();
 
+	PkaSessionClose(&session);
 
 	return error;
 }
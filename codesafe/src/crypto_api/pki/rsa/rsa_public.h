@@ -16,6 +16,7 @@
 
 #include "cc_error.h"
 #include "cc_rsa_types.h"
+#include "pka.h"
 
 
 #ifdef __cplusplus
@@ -33,6 +34,10 @@ typedef struct {
 CCError_t RsaExecPubKeyExp(CCRsaPubKey_t     *pPubKey,
 				CCRsaPrimeData_t *pPubData );
 
+CCError_t RsaExecPubKeyExpInSession(PkaSession_t      *pSession,
+				    CCRsaPubKey_t     *pPubKey,
+				    CCRsaPrimeData_t  *pPubData);
+
 CCError_t RsaInitPubKeyDb(CCRsaPubKey_t *pPubKey);
 
 #ifdef __cplusplus
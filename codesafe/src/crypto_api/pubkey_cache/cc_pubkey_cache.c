@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/************* Include Files ****************/
+#include "cc_pal_types.h"
+#include "cc_pal_mem.h"
+#include "cc_pal_mutex.h"
+#include "cc_pal_abort.h"
+#include "cc_hash.h"
+#include "cc_ecpki_build.h"
+#include "cc_dh.h"
+#include "cc_pubkey_cache.h"
+#include "cc_pubkey_cache_error.h"
+
+
+/************************ Defines *******************************/
+
+/* the public key cache validity TAG */
+#define CC_PUBKEY_CACHE_VALIDATION_TAG      0x504B4348
+
+/* key types, hashed first so that keys of different types never share a digest */
+#define PUBKEY_CACHE_KEY_TYPE_ECPKI         0x45435055
+#define PUBKEY_CACHE_KEY_TYPE_DH            0x44485055
+
+/************************ macros ********************************/
+
+#define PUBKEY_CACHE_LOCK()                                             \
+    do {                                                                \
+        if (CC_PalMutexLock(&CCPubKeyCacheMutex, CC_INFINITE) != CC_SUCCESS) { \
+            CC_PalAbort("Fail to acquire mutex\n");                     \
+        }                                                               \
+    } while (0)
+
+#define PUBKEY_CACHE_UNLOCK()                                           \
+    do {                                                                \
+        if (CC_PalMutexUnlock(&CCPubKeyCacheMutex) != CC_SUCCESS) {     \
+            CC_PalAbort("Fail to release mutex\n");                     \
+        }                                                               \
+    } while (0)
+
+/*********************** Global data  ***************************/
+
+extern CC_PalMutex CCPubKeyCacheMutex;
+
+/******************************************************************************************/
+/************************         Private Functions          ******************************/
+/******************************************************************************************/
+
+/* checks the cache pointer and validation tag; called with CCPubKeyCacheMutex held */
+static CCError_t PubKeyCacheCheck(CCPubKeyCache_t *pCache)
+{
+    if (pCache == NULL) {
+        return CC_PUBKEY_CACHE_INVALID_CACHE_POINTER_ERROR;
+    }
+    if (pCache->validTag != CC_PUBKEY_CACHE_VALIDATION_TAG) {
+        return CC_PUBKEY_CACHE_INVALID_CACHE_ERROR;
+    }
+    return CC_OK;
+}
+
+/* hashes a field of the key or of its domain */
+static CCError_t PubKeyCacheDigestUpdate(CCHashUserContext_t *pHashContext, const void *pData, size_t dataSize)
+{
+    return CC_HashUpdate(pHashContext, (uint8_t *)pData, dataSize);
+}
+
+/* hashes a size word followed by the data of that size */
+static CCError_t PubKeyCacheDigestUpdateWithSize(CCHashUserContext_t *pHashContext, const void *pData, size_t dataSize)
+{
+    CCError_t err;
+    uint32_t sizeWord = (uint32_t)dataSize;
+
+    err = PubKeyCacheDigestUpdate(pHashContext, &sizeWord, sizeof(sizeWord));
+    if (err != CC_OK) {
+        return err;
+    }
+    return PubKeyCacheDigestUpdate(pHashContext, pData, dataSize);
+}
+
+/* looks the digest up in its entry and counts the hit or miss. The entry is selected by the digest
+   and is compared in full, so the time does not depend on the cache contents.
+   The generation of the cache is returned for the insertion of a missed key */
+static CCError_t PubKeyCacheLookup(CCPubKeyCache_t *pCache, const uint32_t *pDigest,
+                                   uint32_t *pIsHit, uint32_t *pGeneration)
+{
+    CCError_t err;
+    CCPubKeyCacheEntry_t *pEntry;
+    uint32_t diff = 0;
+    uint32_t i;
+
+    PUBKEY_CACHE_LOCK();
+
+    err = PubKeyCacheCheck(pCache);
+    if (err != CC_OK) {
+        goto End;
+    }
+
+    pEntry = &pCache->pEntries[pDigest[0] % pCache->entriesCount];
+    for (i = 0; i < CC_PUBKEY_CACHE_DIGEST_SIZE_IN_WORDS; i++) {
+        diff |= pEntry->digest[i] ^ pDigest[i];
+    }
+    *pIsHit = (pEntry->isValid != 0) & (diff == 0);
+    *pGeneration = pCache->generation;
+
+    if (*pIsHit) {
+        pCache->hitsCount++;
+    } else {
+        pCache->missesCount++;
+    }
+
+End:
+    PUBKEY_CACHE_UNLOCK();
+    return err;
+}
+
+/* records the digest of a key that passed the full validation, replacing the key of its entry */
+static void PubKeyCacheInsert(CCPubKeyCache_t *pCache, const uint32_t *pDigest, uint32_t generation)
+{
+    CCPubKeyCacheEntry_t *pEntry;
+
+    PUBKEY_CACHE_LOCK();
+
+    /* the cache may have been freed or invalidated during the validation */
+    if ((PubKeyCacheCheck(pCache) == CC_OK) && (pCache->generation == generation)) {
+        pEntry = &pCache->pEntries[pDigest[0] % pCache->entriesCount];
+        CC_PalMemCopy(pEntry->digest, pDigest, sizeof(pEntry->digest));
+        pEntry->isValid = 1;
+    }
+
+    PUBKEY_CACHE_UNLOCK();
+}
+
+/* calculates the digest of an EC public key and its domain */
+static CCError_t PubKeyCacheEcpkiDigest(const CCEcpkiDomain_t *pDomain,
+                                        const uint8_t *pPubKeyIn,
+                                        size_t PublKeySizeInBytes,
+                                        uint32_t *pDigest)
+{
+    CCError_t err;
+    CCHashUserContext_t hashContext;
+    CCHashResultBuf_t hashResult;
+    uint32_t keyType = PUBKEY_CACHE_KEY_TYPE_ECPKI;
+    size_t modSizeInBytes = CALC_FULL_32BIT_WORDS(pDomain->modSizeInBits)*sizeof(uint32_t);
+    size_t ordSizeInBytes = CALC_FULL_32BIT_WORDS(pDomain->ordSizeInBits)*sizeof(uint32_t);
+
+    err = CC_HashInit(&hashContext, CC_HASH_SHA256_mode);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdate(&hashContext, &keyType, sizeof(keyType));
+    if (err != CC_OK) {
+        goto End;
+    }
+
+    /* the domain: the sizes of all its fields are hashed with the modulus and the order */
+    err = PubKeyCacheDigestUpdateWithSize(&hashContext, pDomain->ecP, modSizeInBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdate(&hashContext, pDomain->ecA, modSizeInBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdate(&hashContext, pDomain->ecB, modSizeInBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdate(&hashContext, pDomain->ecGx, modSizeInBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdate(&hashContext, pDomain->ecGy, modSizeInBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdateWithSize(&hashContext, pDomain->ecR, ordSizeInBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdate(&hashContext, &pDomain->ecH, sizeof(pDomain->ecH));
+    if (err != CC_OK) {
+        goto End;
+    }
+
+    err = PubKeyCacheDigestUpdateWithSize(&hashContext, pPubKeyIn, PublKeySizeInBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = CC_HashFinish(&hashContext, hashResult);
+    if (err != CC_OK) {
+        goto End;
+    }
+    CC_PalMemCopy(pDigest, hashResult, CC_PUBKEY_CACHE_DIGEST_SIZE_IN_WORDS*sizeof(uint32_t));
+
+End:
+    CC_PalMemSetZero(&hashContext, sizeof(hashContext));
+    return err;
+}
+
+/* calculates the digest of a DH public key and its domain */
+static CCError_t PubKeyCacheDhDigest(const uint8_t *modP_ptr,
+                                     size_t modPsizeBytes,
+                                     const uint8_t *orderQ_ptr,
+                                     size_t orderQsizeBytes,
+                                     const uint8_t *pubKey_ptr,
+                                     size_t pubKeySizeBytes,
+                                     uint32_t *pDigest)
+{
+    CCError_t err;
+    CCHashUserContext_t hashContext;
+    CCHashResultBuf_t hashResult;
+    uint32_t keyType = PUBKEY_CACHE_KEY_TYPE_DH;
+
+    err = CC_HashInit(&hashContext, CC_HASH_SHA256_mode);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdate(&hashContext, &keyType, sizeof(keyType));
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdateWithSize(&hashContext, modP_ptr, modPsizeBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdateWithSize(&hashContext, orderQ_ptr, orderQsizeBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = PubKeyCacheDigestUpdateWithSize(&hashContext, pubKey_ptr, pubKeySizeBytes);
+    if (err != CC_OK) {
+        goto End;
+    }
+    err = CC_HashFinish(&hashContext, hashResult);
+    if (err != CC_OK) {
+        goto End;
+    }
+    CC_PalMemCopy(pDigest, hashResult, CC_PUBKEY_CACHE_DIGEST_SIZE_IN_WORDS*sizeof(uint32_t));
+
+End:
+    CC_PalMemSetZero(&hashContext, sizeof(hashContext));
+    return err;
+}
+
+/******************************************************************************************/
+/************************         Public Functions           ******************************/
+/******************************************************************************************/
+
+CEXPORT_C CCError_t CC_PubKeyCacheInit(CCPubKeyCache_t *pCache,
+                                       CCPubKeyCacheEntry_t *pEntries,
+                                       uint32_t entriesCount)
+{
+    if (pCache == NULL) {
+        return CC_PUBKEY_CACHE_INVALID_CACHE_POINTER_ERROR;
+    }
+    if (pEntries == NULL) {
+        return CC_PUBKEY_CACHE_INVALID_ARGUMENT_POINTER_ERROR;
+    }
+    if (entriesCount == 0) {
+        return CC_PUBKEY_CACHE_INVALID_ENTRIES_COUNT_ERROR;
+    }
+
+    PUBKEY_CACHE_LOCK();
+
+    CC_PalMemSetZero(pEntries, entriesCount*sizeof(CCPubKeyCacheEntry_t));
+    CC_PalMemSetZero(pCache, sizeof(CCPubKeyCache_t));
+    pCache->pEntries = pEntries;
+    pCache->entriesCount = entriesCount;
+    pCache->validTag = CC_PUBKEY_CACHE_VALIDATION_TAG;
+
+    PUBKEY_CACHE_UNLOCK();
+
+    return CC_OK;
+}
+
+CEXPORT_C CCError_t CC_EcpkiPubKeyBuildAndFullCheckCached(CCPubKeyCache_t *pCache,
+                                                          const CCEcpkiDomain_t *pDomain,
+                                                          uint8_t *pPubKeyIn,
+                                                          size_t PublKeySizeInBytes,
+                                                          CCEcpkiUserPublKey_t *pUserPublKey,
+                                                          CCEcpkiBuildTempData_t *pTempBuff)
+{
+    CCError_t err;
+    uint32_t digest[CC_PUBKEY_CACHE_DIGEST_SIZE_IN_WORDS];
+    uint32_t isHit = 0;
+    uint32_t generation = 0;
+
+    if (pCache == NULL) {
+        return CC_PUBKEY_CACHE_INVALID_CACHE_POINTER_ERROR;
+    }
+    if ((pDomain == NULL) || (pPubKeyIn == NULL)) {
+        return CC_PUBKEY_CACHE_INVALID_ARGUMENT_POINTER_ERROR;
+    }
+    if ((pDomain->modSizeInBits == 0) ||
+        (pDomain->modSizeInBits > CC_ECPKI_MODUL_MAX_LENGTH_IN_BITS) ||
+        (pDomain->ordSizeInBits == 0) ||
+        (pDomain->ordSizeInBits > pDomain->modSizeInBits + 1) ||
+        (PublKeySizeInBytes == 0) ||
+        (PublKeySizeInBytes > 2*CALC_FULL_BYTES(pDomain->modSizeInBits) + 1)) {
+        return CC_PUBKEY_CACHE_INVALID_ARGUMENT_SIZE_ERROR;
+    }
+
+    err = PubKeyCacheEcpkiDigest(pDomain, pPubKeyIn, PublKeySizeInBytes, digest);
+    if (err != CC_OK) {
+        return err;
+    }
+    err = PubKeyCacheLookup(pCache, digest, &isHit, &generation);
+    if (err != CC_OK) {
+        return err;
+    }
+
+    if (isHit) {
+        /* the key was fully validated: only build the key structure */
+        return CC_EcpkiPublKeyBuildAndCheck(pDomain, pPubKeyIn, PublKeySizeInBytes,
+                                            CheckPointersAndSizesOnly, pUserPublKey, NULL);
+    }
+
+    err = CC_EcpkiPublKeyBuildAndCheck(pDomain, pPubKeyIn, PublKeySizeInBytes,
+                                       ECpublKeyFullCheck, pUserPublKey, pTempBuff);
+    if (err == CC_OK) {
+        PubKeyCacheInsert(pCache, digest, generation);
+    }
+    return err;
+}
+
+CEXPORT_C CCError_t CC_DhCheckPubKeyCached(CCPubKeyCache_t *pCache,
+                                           uint8_t *modP_ptr,
+                                           size_t modPsizeBytes,
+                                           uint8_t *orderQ_ptr,
+                                           size_t orderQsizeBytes,
+                                           uint8_t *pubKey_ptr,
+                                           size_t pubKeySizeBytes,
+                                           CCDhTemp_t *tempBuff_ptr)
+{
+    CCError_t err;
+    uint32_t digest[CC_PUBKEY_CACHE_DIGEST_SIZE_IN_WORDS];
+    uint32_t isHit = 0;
+    uint32_t generation = 0;
+
+    if (pCache == NULL) {
+        return CC_PUBKEY_CACHE_INVALID_CACHE_POINTER_ERROR;
+    }
+    if ((modP_ptr == NULL) || (orderQ_ptr == NULL) || (pubKey_ptr == NULL)) {
+        return CC_PUBKEY_CACHE_INVALID_ARGUMENT_POINTER_ERROR;
+    }
+    if ((modPsizeBytes == 0) || (modPsizeBytes > CC_DH_MAX_MOD_SIZE_IN_BYTES) ||
+        (orderQsizeBytes == 0) || (orderQsizeBytes > modPsizeBytes) ||
+        (pubKeySizeBytes == 0) || (pubKeySizeBytes > modPsizeBytes)) {
+        return CC_PUBKEY_CACHE_INVALID_ARGUMENT_SIZE_ERROR;
+    }
+
+    err = PubKeyCacheDhDigest(modP_ptr, modPsizeBytes,
+                              orderQ_ptr, orderQsizeBytes,
+                              pubKey_ptr, pubKeySizeBytes,
+                              digest);
+    if (err != CC_OK) {
+        return err;
+    }
+    err = PubKeyCacheLookup(pCache, digest, &isHit, &generation);
+    if (err != CC_OK || isHit) {
+        return err;
+    }
+
+    err = CC_DhCheckPubKey(modP_ptr, modPsizeBytes,
+                           orderQ_ptr, orderQsizeBytes,
+                           pubKey_ptr, pubKeySizeBytes,
+                           tempBuff_ptr);
+    if (err == CC_OK) {
+        PubKeyCacheInsert(pCache, digest, generation);
+    }
+    return err;
+}
+
+CEXPORT_C CCError_t CC_PubKeyCacheStatsGet(CCPubKeyCache_t *pCache,
+                                           uint32_t *pHitsCount,
+                                           uint32_t *pMissesCount)
+{
+    CCError_t err;
+
+    if (pCache == NULL) {
+        return CC_PUBKEY_CACHE_INVALID_CACHE_POINTER_ERROR;
+    }
+    if ((pHitsCount == NULL) || (pMissesCount == NULL)) {
+        return CC_PUBKEY_CACHE_INVALID_ARGUMENT_POINTER_ERROR;
+    }
+
+    PUBKEY_CACHE_LOCK();
+
+    err = PubKeyCacheCheck(pCache);
+    if (err == CC_OK) {
+        *pHitsCount = pCache->hitsCount;
+        *pMissesCount = pCache->missesCount;
+    }
+
+    PUBKEY_CACHE_UNLOCK();
+    return err;
+}
+
+CEXPORT_C CCError_t CC_PubKeyCacheInvalidate(CCPubKeyCache_t *pCache)
+{
+    CCError_t err;
+
+    if (pCache == NULL) {
+        return CC_PUBKEY_CACHE_INVALID_CACHE_POINTER_ERROR;
+    }
+
+    PUBKEY_CACHE_LOCK();
+
+    err = PubKeyCacheCheck(pCache);
+    if (err == CC_OK) {
+        CC_PalMemSetZero(pCache->pEntries, pCache->entriesCount*sizeof(CCPubKeyCacheEntry_t));
+        pCache->generation++;
+    }
+
+    PUBKEY_CACHE_UNLOCK();
+    return err;
+}
+
+CEXPORT_C CCError_t CC_PubKeyCacheFree(CCPubKeyCache_t *pCache)
+{
+    CCError_t err;
+
+    if (pCache == NULL) {
+        return CC_PUBKEY_CACHE_INVALID_CACHE_POINTER_ERROR;
+    }
+
+    PUBKEY_CACHE_LOCK();
+
+    err = PubKeyCacheCheck(pCache);
+    if (err == CC_OK) {
+        CC_PalMemSetZero(pCache->pEntries, pCache->entriesCount*sizeof(CCPubKeyCacheEntry_t));
+        CC_PalMemSetZero(pCache, sizeof(CCPubKeyCache_t));
+    }
+
+    PUBKEY_CACHE_UNLOCK();
+    return err;
+}
@@ -19,6 +19,7 @@
 #include "cc_common_math.h"
 #include "cc_rsa_error.h"
 #include "cc_rsa_local.h"
+#include "cc_rsa_build.h"
 #include "pki.h"
 #include "rsa.h"
 #include "rsa_public.h"
@@ -456,27 +457,10 @@ CEXPORT_C CCError_t CC_RsaPrivKeyBuild(CCRsaUserPrivKey_t       *UserPrivKey_ptr
 
 /******************************************************************************************
 
-   @brief CC_RsaPrivKeyCrtBuild populates a CCRsaPrivKey_t structure with
-	  the provided parameters, marking the key as a "CRT" key.
-
-	Note: The "First" factor P must be great, than the "Second" factor Q.
-
-
-   @param[out] UserPrivKey_ptr - A pointer to the public key structure.
-			    This structure is used as input to the CC_RsaPrimDecrypt API.
-   @param[in] P_ptr - A pointer to the first factor stream of bytes (Big-Endian format)
-   @param[in] PSize - The size of the first factor, in bytes.
-   @param[in] Q_ptr - A pointer to the second factor stream of bytes (Big-Endian format)
-   @param[in] QSize - The size of the second factor, in bytes.
-   @param[in] dP_ptr - A pointer to the first factor's CRT exponent stream of bytes (Big-Endian format)
-   @param[in] dPSize - The size of the first factor's CRT exponent, in bytes.
-   @param[in] dQ_ptr - A pointer to the second factor's CRT exponent stream of bytes (Big-Endian format)
-   @param[in] dQSize - The size of the second factor's CRT exponent, in bytes.
-   @param[in] qInv_ptr - A pointer to the first CRT coefficient stream of bytes (Big-Endian format)
-   @param[in] qInvSize - The size of the first CRT coefficient, in bytes.
-
+   @brief RsaPrivKeyCrtBuild populates a CCRsaPrivKey_t structure of a two-prime or
+	  a multi-prime key on CRT mode (see CC_RsaPrivKeyCrtBuild).
 */
-CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
+static CCError_t RsaPrivKeyCrtBuild(
 					       CCRsaUserPrivKey_t *UserPrivKey_ptr,
 					       uint8_t *P_ptr,
 					       size_t   PSize,
@@ -487,7 +471,13 @@ CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 					       uint8_t *dQ_ptr,
 					       size_t   dQSize,
 					       uint8_t *qInv_ptr,
-					       size_t   qInvSize)
+					       size_t   qInvSize,
+					       uint8_t *N_ptr,
+					       size_t   NSize,
+					       uint8_t *d_ptr,
+					       size_t   dSize,
+					       const CCRsaOtherPrimeInfo_t *pOtherPrimes,
+					       size_t   otherPrimesCount)
 {
 	/* FUNCTION DECLARATIONS */
 
@@ -501,6 +491,8 @@ CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 	uint32_t dQ_EffectiveSizeInBits;
 	uint32_t qInv_EffectiveSizeInBits;
 	uint32_t ModulusEffectiveSizeInBits;
+	uint32_t FactorsSizeInBits;
+	uint32_t i;
 
 	/* the private key database pointer */
 	CCRsaPrivKey_t *PrivKey_ptr;
@@ -508,32 +500,16 @@ CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 	/* Max Size of buffers in CRT Key structure */
 	uint32_t  buffSizeBytes;
 
+	/* the modulus and the private exponent of a multi-prime key, to check the factors against */
+	uint32_t tempBuff[CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS];
+
 	/* the Error return code identifier */
 	CCError_t Error = CC_OK;
 
-	uint32_t regVal;
-
 	/* FUNCTION LOGIC */
 
-    /* The function should refuse to operate if the secure disable bit is set */
-    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
-    if (regVal == SECURE_DISABLE_FLAG_SET) {
-        return CC_RSA_SD_ENABLED_ERR;
-    }
-
-    /* The function should refuse to operate if the Fatal Error bit is set */
-    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
-    if (regVal == FATAL_ERROR_FLAG_SET) {
-        return CC_RSA_FATAL_ERR_IS_LOCKED_ERR;
-    }
-
 	/* ................. checking the validity of the pointer arguments ....... */
 	/* ------------------------------------------------------------------------ */
-	CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
-
-	/* ...... checking the key database handle pointer .................... */
-	if (UserPrivKey_ptr == NULL)
-		return CC_RSA_INVALID_PRIV_KEY_STRUCT_POINTER_ERROR;
 
 	/* checking the first factor pointer validity */
 	if (P_ptr == NULL)
@@ -592,6 +568,25 @@ CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 		return CC_RSA_INVALID_CRT_COEFF_VAL;
 	}
 
+	/* checking the additional factors of a multi-prime key: the exponent and *
+	*  the coefficient are less then the factor                               */
+	for (i = 0; i < otherPrimesCount; i++) {
+		if (pOtherPrimes[i].pPrime == NULL || pOtherPrimes[i].pExp == NULL || pOtherPrimes[i].pCoeff == NULL ||
+		    pOtherPrimes[i].primeSize > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BYTES/2 ||
+		    pOtherPrimes[i].expSize > pOtherPrimes[i].primeSize ||
+		    pOtherPrimes[i].coeffSize > pOtherPrimes[i].primeSize) {
+			return CC_RSA_INVALID_CRT_OTHER_PRIME_ERROR;
+		}
+		if (CC_CommonCmpMsbUnsignedCounters(pOtherPrimes[i].pExp, pOtherPrimes[i].expSize,
+						    pOtherPrimes[i].pPrime, pOtherPrimes[i].primeSize) !=
+						    CC_COMMON_CmpCounter2GreaterThenCounter1 ||
+		    CC_CommonCmpMsbUnsignedCounters(pOtherPrimes[i].pCoeff, pOtherPrimes[i].coeffSize,
+						    pOtherPrimes[i].pPrime, pOtherPrimes[i].primeSize) !=
+						    CC_COMMON_CmpCounter2GreaterThenCounter1) {
+			return CC_RSA_INVALID_CRT_OTHER_PRIME_ERROR;
+		}
+	}
+
 
 	/* .................. copy the buffers to the key handle structure .... */
 	/* -------------------------------------------------------------------- */
@@ -633,6 +628,33 @@ CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 		goto End;
 	}
 
+	for (i = 0; i < otherPrimesCount; i++) {
+		CCRsaPrivCrtPrime_t *pPrime = &PrivKey_ptr->PriveKeyDb.Crt.otherPrimes[i];
+		uint32_t primeBuffSizeBytes = 4*((pOtherPrimes[i].primeSize + 3)/4) + 4;
+
+		if (CC_CommonConvertMsbLsbBytesToLswMswWords(pPrime->R, primeBuffSizeBytes,
+							     pOtherPrimes[i].pPrime, pOtherPrimes[i].primeSize) != CC_OK ||
+		    CC_CommonConvertMsbLsbBytesToLswMswWords(pPrime->dR, primeBuffSizeBytes,
+							     pOtherPrimes[i].pExp, pOtherPrimes[i].expSize) != CC_OK ||
+		    CC_CommonConvertMsbLsbBytesToLswMswWords(pPrime->tR, primeBuffSizeBytes,
+							     pOtherPrimes[i].pCoeff, pOtherPrimes[i].coeffSize) != CC_OK) {
+			Error = CC_RSA_INVALID_CRT_OTHER_PRIME_ERROR;
+			goto End;
+		}
+
+		pPrime->RSizeInBits =
+		CC_CommonGetWordsCounterEffectiveSizeInBits(pPrime->R, (pOtherPrimes[i].primeSize+3)/4);
+		pPrime->dRSizeInBits =
+		CC_CommonGetWordsCounterEffectiveSizeInBits(pPrime->dR, (pOtherPrimes[i].expSize+3)/4);
+		pPrime->tRSizeInBits =
+		CC_CommonGetWordsCounterEffectiveSizeInBits(pPrime->tR, (pOtherPrimes[i].coeffSize+3)/4);
+
+		if (pPrime->RSizeInBits == 0 || pPrime->dRSizeInBits == 0 || pPrime->tRSizeInBits == 0) {
+			Error = CC_RSA_INVALID_CRT_OTHER_PRIME_ERROR;
+			goto End;
+		}
+	}
+
 	/* ............... initialize local variables ......................... */
 	/* -------------------------------------------------------------------- */
 
@@ -676,15 +698,55 @@ CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 	/* -------------------------------------------------------------------- */
 
 
-	Error = PkiLongNumMul(PrivKey_ptr->PriveKeyDb.Crt.P, P_EffectiveSizeInBits,
-				     PrivKey_ptr->PriveKeyDb.Crt.Q, PrivKey_ptr->n);
-	if (Error != CC_OK) {
-		Error = CC_RSA_INTERNAL_ERROR;
-		goto End;
-	}
+	FactorsSizeInBits = P_EffectiveSizeInBits + Q_EffectiveSizeInBits;
 
-	ModulusEffectiveSizeInBits =
-	CC_CommonGetWordsCounterEffectiveSizeInBits(PrivKey_ptr->n, (2*CALC_FULL_32BIT_WORDS(P_EffectiveSizeInBits)));
+	if (otherPrimesCount == 0) {
+		Error = PkiLongNumMul(PrivKey_ptr->PriveKeyDb.Crt.P, P_EffectiveSizeInBits,
+					     PrivKey_ptr->PriveKeyDb.Crt.Q, PrivKey_ptr->n);
+		if (Error != CC_OK) {
+			Error = CC_RSA_INTERNAL_ERROR;
+			goto End;
+		}
+
+		ModulusEffectiveSizeInBits =
+		CC_CommonGetWordsCounterEffectiveSizeInBits(PrivKey_ptr->n, (2*CALC_FULL_32BIT_WORDS(P_EffectiveSizeInBits)));
+	} else {
+		/* multi-prime key: N is the product of all the factors */
+		PrivKey_ptr->PriveKeyDb.Crt.PSizeInBits = P_EffectiveSizeInBits;
+		PrivKey_ptr->PriveKeyDb.Crt.QSizeInBits = Q_EffectiveSizeInBits;
+		PrivKey_ptr->PriveKeyDb.Crt.primesCount = otherPrimesCount + 2;
+		for (i = 0; i < otherPrimesCount; i++) {
+			FactorsSizeInBits += PrivKey_ptr->PriveKeyDb.Crt.otherPrimes[i].RSizeInBits;
+		}
+
+		Error = RsaCalcMultiPrimeModulus(PrivKey_ptr);
+		if (Error != CC_OK) {
+			Error = CC_RSA_INVALID_MODULUS_SIZE;
+			goto End;
+		}
+
+		ModulusEffectiveSizeInBits = PrivKey_ptr->nSizeInBits;
+
+		/* the product of the factors is the modulus N */
+		CC_PalMemSetZero(tempBuff, sizeof(tempBuff));
+		if (CC_CommonConvertMsbLsbBytesToLswMswWords(tempBuff, sizeof(tempBuff), N_ptr, NSize) != CC_OK ||
+		    CC_CommonGetWordsCounterEffectiveSizeInBits(tempBuff, CALC_FULL_32BIT_WORDS(8*NSize)) != ModulusEffectiveSizeInBits ||
+		    CC_PalMemCmp(tempBuff, PrivKey_ptr->n, 4*CALC_FULL_32BIT_WORDS(ModulusEffectiveSizeInBits)) != 0) {
+			Error = CC_RSA_INCONSISTENT_CRT_PARAMS_ERROR;
+			goto End;
+		}
+
+		/* d_i = d mod (r_i - 1) and t_i is the inverse of the preceding factors modulo r_i */
+		if (CC_CommonConvertMsbLsbBytesToLswMswWords(tempBuff, sizeof(tempBuff), d_ptr, dSize) != CC_OK) {
+			Error = CC_RSA_INVALID_EXPONENT_SIZE;
+			goto End;
+		}
+		Error = RsaCheckOtherPrimesCrtParams(PrivKey_ptr, tempBuff,
+						     CC_CommonGetWordsCounterEffectiveSizeInBits(tempBuff, CALC_FULL_32BIT_WORDS(8*dSize)));
+		if (Error != CC_OK) {
+			goto End;
+		}
+	}
 
 	/* .................. checking the validity of the counters ............... */
 	/* ------------------------------------------------------------------------ */
@@ -697,8 +759,9 @@ CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 		goto End;
 	}
 
-	if ((P_EffectiveSizeInBits + Q_EffectiveSizeInBits != ModulusEffectiveSizeInBits) &&
-	    (P_EffectiveSizeInBits + Q_EffectiveSizeInBits != ModulusEffectiveSizeInBits - 1)) {
+	/* the product of k factors is shorter then the sum of their sizes by at most k-1 bits */
+	if ((FactorsSizeInBits < ModulusEffectiveSizeInBits) ||
+	    (FactorsSizeInBits > ModulusEffectiveSizeInBits + otherPrimesCount + 1)) {
 		Error = CC_RSA_INVALID_CRT_FIRST_AND_SECOND_FACTOR_SIZE;
 		goto End;
 	}
@@ -738,6 +801,8 @@ CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 
 	End:
 
+	CC_PalMemSetZero(tempBuff, sizeof(tempBuff));
+
 	/* if the structure created is not valid - clear it */
 	if (Error != CC_OK) {
 		CC_PalMemSetZero(UserPrivKey_ptr, sizeof(CCRsaUserPrivKey_t));
@@ -746,9 +811,156 @@ CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 
 	return Error;
 
+}/* END OF RsaPrivKeyCrtBuild */
+
+/******************************************************************************************
+
+   @brief CC_RsaPrivKeyCrtBuild populates a CCRsaPrivKey_t structure with
+	  the provided parameters, marking the key as a "CRT" key.
+
+	Note: The "First" factor P must be great, than the "Second" factor Q.
+
+
+   @param[out] UserPrivKey_ptr - A pointer to the public key structure.
+			    This structure is used as input to the CC_RsaPrimDecrypt API.
+   @param[in] P_ptr - A pointer to the first factor stream of bytes (Big-Endian format)
+   @param[in] PSize - The size of the first factor, in bytes.
+   @param[in] Q_ptr - A pointer to the second factor stream of bytes (Big-Endian format)
+   @param[in] QSize - The size of the second factor, in bytes.
+   @param[in] dP_ptr - A pointer to the first factor's CRT exponent stream of bytes (Big-Endian format)
+   @param[in] dPSize - The size of the first factor's CRT exponent, in bytes.
+   @param[in] dQ_ptr - A pointer to the second factor's CRT exponent stream of bytes (Big-Endian format)
+   @param[in] dQSize - The size of the second factor's CRT exponent, in bytes.
+   @param[in] qInv_ptr - A pointer to the first CRT coefficient stream of bytes (Big-Endian format)
+   @param[in] qInvSize - The size of the first CRT coefficient, in bytes.
+
+*/
+CEXPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
+					       CCRsaUserPrivKey_t *UserPrivKey_ptr,
+					       uint8_t *P_ptr,
+					       size_t   PSize,
+					       uint8_t *Q_ptr,
+					       size_t   QSize,
+					       uint8_t *dP_ptr,
+					       size_t   dPSize,
+					       uint8_t *dQ_ptr,
+					       size_t   dQSize,
+					       uint8_t *qInv_ptr,
+					       size_t   qInvSize)
+{
+	uint32_t regVal;
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_RSA_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_RSA_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+	CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+	/* ...... checking the key database handle pointer .................... */
+	if (UserPrivKey_ptr == NULL)
+		return CC_RSA_INVALID_PRIV_KEY_STRUCT_POINTER_ERROR;
+
+	return RsaPrivKeyCrtBuild(UserPrivKey_ptr, P_ptr, PSize, Q_ptr, QSize, dP_ptr, dPSize,
+				  dQ_ptr, dQSize, qInv_ptr, qInvSize, NULL, 0, NULL, 0, NULL, 0);
+
 }/* END OF CC_RsaPrivKeyCrtBuild */
 
 
+/******************************************************************************************
+
+   @brief CC_RsaPrivKeyMultiPrimeCrtBuild populates a CCRsaPrivKey_t structure with
+	  the provided parameters of a multi-prime key, marking the key as a "CRT" key.
+
+	Note: The parameters of the first two factors are as of CC_RsaPrivKeyCrtBuild.
+	      The factors are checked against the modulus N and the private exponent d:
+	      N is the product of all the factors, d_i = d mod (r_i - 1) and t_i is the
+	      inverse modulo r_i of the product of the preceding factors.
+
+
+   @param[out] UserPrivKey_ptr - A pointer to the public key structure.
+   @param[in] P_ptr ... qInvSize - The parameters of the first two factors as of CC_RsaPrivKeyCrtBuild.
+   @param[in] N_ptr - A pointer to the modulus stream of bytes (Big-Endian format).
+   @param[in] NSize - The size of the modulus in bytes.
+   @param[in] d_ptr - A pointer to the private exponent stream of bytes (Big-Endian format).
+   @param[in] dSize - The size of the private exponent in bytes.
+   @param[in] pOtherPrimes - A pointer to the array of the additional factors (r_i, d_i, t_i).
+   @param[in] otherPrimesCount - The count of the additional factors: 1 to CC_RSA_MAX_PRIMES_COUNT-2.
+
+*/
+CEXPORT_C CCError_t CC_RsaPrivKeyMultiPrimeCrtBuild(
+					       CCRsaUserPrivKey_t *UserPrivKey_ptr,
+					       uint8_t *P_ptr,
+					       size_t   PSize,
+					       uint8_t *Q_ptr,
+					       size_t   QSize,
+					       uint8_t *dP_ptr,
+					       size_t   dPSize,
+					       uint8_t *dQ_ptr,
+					       size_t   dQSize,
+					       uint8_t *qInv_ptr,
+					       size_t   qInvSize,
+					       uint8_t *N_ptr,
+					       size_t   NSize,
+					       uint8_t *d_ptr,
+					       size_t   dSize,
+					       const CCRsaOtherPrimeInfo_t *pOtherPrimes,
+					       size_t   otherPrimesCount)
+{
+	uint32_t regVal;
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_RSA_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_RSA_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+	CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+	/* ...... checking the key database handle pointer .................... */
+	if (UserPrivKey_ptr == NULL)
+		return CC_RSA_INVALID_PRIV_KEY_STRUCT_POINTER_ERROR;
+
+	/* checking the modulus and the private exponent */
+	if (N_ptr == NULL)
+		return CC_RSA_INVALID_MODULUS_POINTER_ERROR;
+
+	if (NSize == 0 || NSize > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BYTES)
+		return CC_RSA_INVALID_MODULUS_SIZE;
+
+	if (d_ptr == NULL)
+		return CC_RSA_INVALID_EXPONENT_POINTER_ERROR;
+
+	if (dSize == 0 || dSize > NSize)
+		return CC_RSA_INVALID_EXPONENT_SIZE;
+
+	/* checking the additional factors */
+	if (pOtherPrimes == NULL)
+		return CC_RSA_INVALID_CRT_OTHER_PRIME_ERROR;
+
+	if (otherPrimesCount == 0 || otherPrimesCount > CC_RSA_MAX_PRIMES_COUNT - 2)
+		return CC_RSA_INVALID_PRIMES_COUNT_ERROR;
+
+	return RsaPrivKeyCrtBuild(UserPrivKey_ptr, P_ptr, PSize, Q_ptr, QSize, dP_ptr, dPSize,
+				  dQ_ptr, dQSize, qInv_ptr, qInvSize, N_ptr, NSize, d_ptr, dSize,
+				  pOtherPrimes, otherPrimesCount);
+
+}/* END OF CC_RsaPrivKeyMultiPrimeCrtBuild */
+
+
 /******************************************************************************************
    @brief CC_RsaPubKeyGet gets the e,n public key from the database.
 
@@ -12,16 +12,149 @@
 #include "cc_common_math.h"
 #include "cc_rsa_error.h"
 #include "cc_rsa_local.h"
+#include "cc_rsa_build.h"
+#include "cc_hmac.h"
+#include "cc_fips_defs.h"
 #include "cc_util_int_defs.h"
 
 /************************ Defines ******************************/
 
+/* "RSAK" */
+#define RSA_PRIV_KEY_BLOB_MAGIC         0x4B415352UL
+#define RSA_PRIV_KEY_BLOB_VERSION       1UL
+/* the part of the blob covered by the integrity check */
+#define RSA_PRIV_KEY_BLOB_MAC_DATA_SIZE (CC_RSA_PRIV_KEY_BLOB_HEADER_SIZE_IN_BYTES + sizeof(CCRsaPrivKey_t))
+
 /************************ Enums ******************************/
 
 /************************ Typedefs ******************************/
 
+/* the header of a private key blob, followed by the CCRsaPrivKey_t database and the HMAC */
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t keyDbSize;
+	uint32_t nSizeInBits;
+} RsaPrivKeyBlobHeader_t;
+
 /************************ Global Data ******************************/
 
+/************************ Private Functions ******************************/
+
+#if !defined(_INTERNAL_CC_NO_RSA_DECRYPT_SUPPORT) && !defined(_INTERNAL_CC_NO_RSA_SIGN_SUPPORT)
+/* computes the HMAC of a blob on a copy of the keyed context, so that the key is processed once per batch */
+static CCError_t RsaPrivKeyBlobMac(CCHmacUserContext_t *pKeyedCtx,
+				   uint8_t *pBlob,
+				   CCHashResultBuf_t macResult)
+{
+	CCHmacUserContext_t ctx;
+	CCError_t Error;
+
+	/* the user context holds only relative offsets, so a byte copy is a valid fork */
+	CC_PalMemCopy(&ctx, pKeyedCtx, sizeof(CCHmacUserContext_t));
+
+	Error = CC_HmacUpdate(&ctx, pBlob, RSA_PRIV_KEY_BLOB_MAC_DATA_SIZE);
+	if (Error == CC_OK) {
+		Error = CC_HmacFinish(&ctx, macResult);
+	}
+
+	CC_HmacFree(&ctx);
+	return Error;
+}
+
+/* checks that the sizes of the key database are in the bounds of its buffers */
+static CCError_t RsaPrivKeyBlobCheckSizes(CCRsaPrivKey_t *PrivKey_ptr)
+{
+	CCRsaPrivCrtKey_t *pCrt = &PrivKey_ptr->PriveKeyDb.Crt;
+	uint32_t i;
+
+	if (PrivKey_ptr->nSizeInBits < CC_RSA_MIN_VALID_KEY_SIZE_VALUE_IN_BITS ||
+	    PrivKey_ptr->nSizeInBits > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS) {
+		return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+	}
+
+	if (PrivKey_ptr->OperationMode == CC_RSA_NoCrt) {
+		if (PrivKey_ptr->PriveKeyDb.NonCrt.dSizeInBits > PrivKey_ptr->nSizeInBits ||
+		    PrivKey_ptr->PriveKeyDb.NonCrt.eSizeInBits > PrivKey_ptr->nSizeInBits) {
+			return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+		}
+		return CC_OK;
+	}
+
+	if (PrivKey_ptr->OperationMode != CC_RSA_Crt ||
+	    pCrt->PSizeInBits > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS/2 ||
+	    pCrt->QSizeInBits > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS/2 ||
+	    pCrt->dPSizeInBits > pCrt->PSizeInBits ||
+	    pCrt->dQSizeInBits > pCrt->QSizeInBits ||
+	    pCrt->qInvSizeInBits > pCrt->PSizeInBits ||
+	    pCrt->primesCount == 1 || pCrt->primesCount > CC_RSA_MAX_PRIMES_COUNT) {
+		return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+	}
+	for (i = 2; i < pCrt->primesCount; i++) {
+		if (pCrt->otherPrimes[i-2].RSizeInBits > CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS/2) {
+			return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+		}
+	}
+	return CC_OK;
+}
+
+/* imports one blob with the keyed HMAC context (see CC_RsaPrivKeyImport) */
+static CCError_t RsaPrivKeyImport(CCRsaUserPrivKey_t *UserPrivKey_ptr,
+				  CCHmacUserContext_t *pKeyedCtx,
+				  uint8_t *pBlob,
+				  size_t blobSize)
+{
+	RsaPrivKeyBlobHeader_t header;
+	CCHashResultBuf_t macResult;
+	CCRsaPrivKey_t *PrivKey_ptr;
+	uint8_t *pMac;
+	uint8_t macDiff = 0;
+	uint32_t i;
+	CCError_t Error;
+
+	if (UserPrivKey_ptr == NULL)
+		return CC_RSA_INVALID_PRIV_KEY_STRUCT_POINTER_ERROR;
+
+	if (pBlob == NULL || blobSize != CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES)
+		return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+
+	/* the blob is bound to the layout of the key database of this library */
+	CC_PalMemCopy(&header, pBlob, sizeof(header));
+	if (header.magic != RSA_PRIV_KEY_BLOB_MAGIC ||
+	    header.version != RSA_PRIV_KEY_BLOB_VERSION ||
+	    header.keyDbSize != sizeof(CCRsaPrivKey_t)) {
+		return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+	}
+
+	Error = RsaPrivKeyBlobMac(pKeyedCtx, pBlob, macResult);
+	if (Error != CC_OK)
+		return Error;
+
+	/* compare the whole HMAC in constant time */
+	pMac = pBlob + RSA_PRIV_KEY_BLOB_MAC_DATA_SIZE;
+	for (i = 0; i < CC_RSA_PRIV_KEY_BLOB_MAC_SIZE_IN_BYTES; i++) {
+		macDiff |= ((uint8_t *)macResult)[i] ^ pMac[i];
+	}
+	if (macDiff != 0)
+		return CC_RSA_PRIV_KEY_BLOB_INTEGRITY_ERROR;
+
+	/* the key and its Barrett tags were validated when the key was built, *
+	*  so it is restored as is, without any PKA operation                 */
+	PrivKey_ptr = (CCRsaPrivKey_t *)UserPrivKey_ptr->PrivateKeyDbBuff;
+	CC_PalMemCopy(PrivKey_ptr, pBlob + CC_RSA_PRIV_KEY_BLOB_HEADER_SIZE_IN_BYTES, sizeof(CCRsaPrivKey_t));
+
+	Error = RsaPrivKeyBlobCheckSizes(PrivKey_ptr);
+	if (Error != CC_OK || PrivKey_ptr->nSizeInBits != header.nSizeInBits) {
+		CC_PalMemSetZero(UserPrivKey_ptr, sizeof(CCRsaUserPrivKey_t));
+		return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+	}
+
+	UserPrivKey_ptr->valid_tag = CC_RSA_PRIV_KEY_VALIDATION_TAG;
+
+	return CC_OK;
+}
+#endif /*!defined(_INTERNAL_CC_NO_RSA_DECRYPT_SUPPORT) && !defined(_INTERNAL_CC_NO_RSA_SIGN_SUPPORT)*/
+
 /************************ Public Functions ******************************/
 
 
@@ -269,6 +402,11 @@ CEXPORT_C CCError_t CC_RsaGetPrivKeyCRT(CCRsaUserPrivKey_t *UserPrivKey_ptr,
 		return CC_RSA_WRONG_PRIVATE_KEY_TYPE;
 	}
 
+	/* the additional factors of a multi-prime key can not be exported */
+	if (PrivKey_ptr->PriveKeyDb.Crt.primesCount > 2) {
+		return CC_RSA_WRONG_PRIVATE_KEY_TYPE;
+	}
+
 
 	PSizeInBytes =  CALC_FULL_BYTES(PrivKey_ptr->PriveKeyDb.Crt.PSizeInBits);
 	QSizeInBytes =  CALC_FULL_BYTES(PrivKey_ptr->PriveKeyDb.Crt.QSizeInBits);
@@ -329,5 +467,194 @@ CEXPORT_C CCError_t CC_RsaGetPrivKeyCRT(CCRsaUserPrivKey_t *UserPrivKey_ptr,
 
 }/* END OF CC_RsaGetPrivKeyCRT */
 
-#endif /*!defined(_INTERNAL_CC_NO_RSA_DECRYPT_SUPPORT) && !defined(_INTERNAL_CC_NO_RSA_SIGN_SUPPORT)*/
 
+/******************************************************************************************
+   @brief CC_RsaPrivKeyExport exports a built private key with its derived values
+	  (modulus, Barrett tags) to a blob protected by an HMAC-SHA256.
+
+	  The blob is: the header (magic, version, size of the key database, modulus size),
+	  the CCRsaPrivKey_t database and the HMAC of both under the caller's key.
+
+   @param[in] UserPrivKey_ptr - A pointer to the private key structure.
+   @param[in] pMacKey - A pointer to the key of the integrity check.
+   @param[in] macKeySize - The size of the key of the integrity check, in bytes.
+   @param[out] pBlob - A pointer to the blob.
+   @param[in/out] pBlobSize - The size of the blob buffer in bytes, updated to the size of the blob.
+*/
+CEXPORT_C CCError_t CC_RsaPrivKeyExport(CCRsaUserPrivKey_t *UserPrivKey_ptr,
+					uint8_t  *pMacKey,
+					size_t    macKeySize,
+					uint8_t  *pBlob,
+					size_t   *pBlobSize)
+{
+	RsaPrivKeyBlobHeader_t header;
+	CCHmacUserContext_t keyedCtx;
+	CCHashResultBuf_t macResult;
+	CCRsaPrivKey_t *PrivKey_ptr;
+	CCError_t Error;
+	uint32_t regVal;
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_RSA_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_RSA_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+	CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+	if (UserPrivKey_ptr == NULL)
+		return CC_RSA_INVALID_PRIV_KEY_STRUCT_POINTER_ERROR;
+
+	if (pMacKey == NULL || macKeySize == 0 || pBlob == NULL || pBlobSize == NULL)
+		return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+
+	if (*pBlobSize < CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES)
+		return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+
+	/* only a built, and so validated, key is exported */
+	if (UserPrivKey_ptr->valid_tag != CC_RSA_PRIV_KEY_VALIDATION_TAG)
+		return CC_RSA_PRIV_KEY_VALIDATION_TAG_ERROR;
+
+	PrivKey_ptr = (CCRsaPrivKey_t *)UserPrivKey_ptr->PrivateKeyDbBuff;
+
+	header.magic       = RSA_PRIV_KEY_BLOB_MAGIC;
+	header.version     = RSA_PRIV_KEY_BLOB_VERSION;
+	header.keyDbSize   = sizeof(CCRsaPrivKey_t);
+	header.nSizeInBits = PrivKey_ptr->nSizeInBits;
+
+	CC_PalMemCopy(pBlob, &header, sizeof(header));
+	CC_PalMemCopy(pBlob + CC_RSA_PRIV_KEY_BLOB_HEADER_SIZE_IN_BYTES, PrivKey_ptr, sizeof(CCRsaPrivKey_t));
+
+	Error = CC_HmacInit(&keyedCtx, CC_HASH_SHA256_mode, pMacKey, macKeySize);
+	if (Error == CC_OK) {
+		Error = RsaPrivKeyBlobMac(&keyedCtx, pBlob, macResult);
+	}
+	CC_HmacFree(&keyedCtx);
+
+	if (Error != CC_OK) {
+		CC_PalMemSetZero(pBlob, CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES);
+		return Error;
+	}
+
+	CC_PalMemCopy(pBlob + RSA_PRIV_KEY_BLOB_MAC_DATA_SIZE, macResult, CC_RSA_PRIV_KEY_BLOB_MAC_SIZE_IN_BYTES);
+	*pBlobSize = CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES;
+
+	return CC_OK;
+
+}/* END OF CC_RsaPrivKeyExport */
+
+
+/******************************************************************************************
+   @brief CC_RsaPrivKeyImport imports a private key from a blob exported by CC_RsaPrivKeyExport.
+	  The key is restored with its derived values, without validating it again.
+
+   @param[out] UserPrivKey_ptr - A pointer to the private key structure.
+   @param[in] pMacKey - A pointer to the key of the integrity check.
+   @param[in] macKeySize - The size of the key of the integrity check, in bytes.
+   @param[in] pBlob - A pointer to the blob.
+   @param[in] blobSize - The size of the blob, in bytes.
+*/
+CEXPORT_C CCError_t CC_RsaPrivKeyImport(CCRsaUserPrivKey_t *UserPrivKey_ptr,
+					uint8_t  *pMacKey,
+					size_t    macKeySize,
+					uint8_t  *pBlob,
+					size_t    blobSize)
+{
+	CCHmacUserContext_t keyedCtx;
+	CCError_t Error;
+	uint32_t regVal;
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_RSA_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_RSA_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+	CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+	if (pMacKey == NULL || macKeySize == 0)
+		return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+
+	Error = CC_HmacInit(&keyedCtx, CC_HASH_SHA256_mode, pMacKey, macKeySize);
+	if (Error == CC_OK) {
+		Error = RsaPrivKeyImport(UserPrivKey_ptr, &keyedCtx, pBlob, blobSize);
+	}
+	CC_HmacFree(&keyedCtx);
+
+	return Error;
+
+}/* END OF CC_RsaPrivKeyImport */
+
+
+/******************************************************************************************
+   @brief CC_RsaPrivKeyImportBatch imports a batch of private keys protected by the same key.
+	  The HMAC key is processed once for the batch, and the result of each item is
+	  returned in the item.
+
+   @param[in] pMacKey - A pointer to the key of the integrity check.
+   @param[in] macKeySize - The size of the key of the integrity check, in bytes.
+   @param[in/out] pItems - A pointer to the array of the items.
+   @param[in] itemsCount - The count of the items.
+*/
+CEXPORT_C CCError_t CC_RsaPrivKeyImportBatch(uint8_t  *pMacKey,
+					     size_t    macKeySize,
+					     CCRsaPrivKeyImportItem_t *pItems,
+					     size_t    itemsCount)
+{
+	CCHmacUserContext_t keyedCtx;
+	CCError_t Error;
+	uint32_t regVal;
+	size_t i;
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_RSA_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_RSA_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+	CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+	if (pItems == NULL || itemsCount == 0)
+		return CC_RSA_INVALID_BATCH_ERROR;
+
+	if (pMacKey == NULL || macKeySize == 0)
+		return CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR;
+
+	Error = CC_HmacInit(&keyedCtx, CC_HASH_SHA256_mode, pMacKey, macKeySize);
+	if (Error != CC_OK) {
+		CC_HmacFree(&keyedCtx);
+		return Error;
+	}
+
+	for (i = 0; i < itemsCount; i++) {
+		pItems[i].result = RsaPrivKeyImport(pItems[i].pUserPrivKey, &keyedCtx,
+						    pItems[i].pBlob, pItems[i].blobSize);
+		if (pItems[i].result != CC_OK) {
+			Error = CC_RSA_PRIV_KEY_BLOB_BATCH_ERROR;
+		}
+	}
+	CC_HmacFree(&keyedCtx);
+
+	return Error;
+
+}/* END OF CC_RsaPrivKeyImportBatch */
+
+#endif /*!defined(_INTERNAL_CC_NO_RSA_DECRYPT_SUPPORT) && !defined(_INTERNAL_CC_NO_RSA_SIGN_SUPPORT)*/
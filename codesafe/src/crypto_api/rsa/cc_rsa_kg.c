@@ -508,6 +508,218 @@ End:
 }/* END OF CC_RsaKgKeyPairCrtGenerate */
 
 
+/***********************************************************************************************/
+/**
+   @brief CC_RsaKgKeyPairMultiPrimeGenerate generates a Pair of public and private keys on CRT mode
+          with up to CC_RSA_MAX_PRIMES_COUNT prime factors (multi-prime RSA, RFC 8017).
+
+   Note: The factors are of about KeySize/primesCount bits each. P and Q are of the same size
+         and P > Q, the last factor takes the rest of the key size. Multi-prime keys are not
+         FIPS 186-4 compliant.
+
+   @param [in] f_rng - Pointer to DRBG function
+   @param [in,out] p_rng  - Pointer to the random context - the input to f_rng.
+   @param [in] PubExp_ptr - The pointer to the public exponent (public key).
+          Allowed values 0x3, 0x11, 0x10001.
+   @param [in] PubExpSizeInBytes - The public exponent size in bytes.
+   @param [in] KeySize  - The size of the key in bits. Supported sizes are 256 bit multiples
+                          between 512 - 4096;
+   @param [in] primesCount - The count of the prime factors: 2 - CC_RSA_MAX_PRIMES_COUNT.
+   @param [out] pCcUserPrivKey - A pointer to the private key structure.
+                           This structure is used as input to the CC_RsaPrimDecrypt API.
+   @param [out] pCcUserPubKey - A pointer to the public key structure.
+                           This structure is used as input to the CC_RsaPrimEncrypt API.
+   @param [in] KeyGenData_ptr - a pointer to a structure required for the KeyGen operation.
+
+   @return CCError_t - CC_OK,
+                         CC_RSA_INVALID_PRIMES_COUNT_ERROR,
+                         or the errors of CC_RsaKgKeyPairCrtGenerate
+*/
+CEXPORT_C CCError_t CC_RsaKgKeyPairMultiPrimeGenerate(
+                                                CCRndGenerateVectWorkFunc_t f_rng,
+                                                void *p_rng,
+                                                uint8_t                 *PubExp_ptr,
+                                                size_t                   PubExpSizeInBytes,
+                                                size_t                   KeySize,
+                                                uint32_t                 primesCount,
+                                                CCRsaUserPrivKey_t   *pCcUserPrivKey,
+                                                CCRsaUserPubKey_t    *pCcUserPubKey,
+                                                CCRsaKgData_t        *KeyGenData_ptr )
+{
+        /* LOCAL INITIALIZATIONS AND DECLERATIONS */
+
+        /* the error identifier */
+        CCError_t Error = CC_OK;
+
+        /* the pointers to the key structures */
+        CCRsaPubKey_t  *pCcPubKey;
+        CCRsaPrivKey_t *pCcPrivKey;
+        CCRsaPrivCrtKey_t *pCrt;
+        uint32_t pSizeWords, rSizeWords, i, j;
+        uint32_t *pPrime;
+        CCCommonCmpCounter_t cmpRes;
+        uint32_t regVal;
+
+        /* The function should refuse to operate if the secure disable bit is set */
+        CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+        if (regVal == SECURE_DISABLE_FLAG_SET) {
+            return CC_RSA_SD_ENABLED_ERR;
+        }
+
+        /* The function should refuse to operate if the Fatal Error bit is set */
+        CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+        if (regVal == FATAL_ERROR_FLAG_SET) {
+            return CC_RSA_FATAL_ERR_IS_LOCKED_ERR;
+        }
+
+        if (primesCount < 2 || primesCount > CC_RSA_MAX_PRIMES_COUNT) {
+        	return CC_RSA_INVALID_PRIMES_COUNT_ERROR;
+        }
+
+        /* a two-prime key is the regular CRT key */
+        if (primesCount == 2) {
+        	return CC_RsaKgKeyPairCrtGenerate(f_rng, p_rng, PubExp_ptr, PubExpSizeInBytes, KeySize,
+        					  pCcUserPrivKey, pCcUserPubKey, KeyGenData_ptr, NULL);
+        }
+
+        Error = KGCheckAndSetParamsRSA(
+                    PubExp_ptr,
+					PubExpSizeInBytes,
+					KeySize,
+					pCcUserPrivKey,
+					pCcUserPubKey,
+					KeyGenData_ptr );
+        if (Error != CC_OK){
+        	return Error;
+        }
+        /* set the public and private key structure pointers */
+        pCcPubKey  = (CCRsaPubKey_t*)pCcUserPubKey->PublicKeyDbBuff;
+        pCcPrivKey = (CCRsaPrivKey_t*)pCcUserPrivKey->PrivateKeyDbBuff;
+        pCrt = &pCcPrivKey->PriveKeyDb.Crt;
+
+        /* .......... initializing the factors sizes: P,Q of the same size, the last   *
+        *            factor takes the rest of the key size ........................... */
+        pSizeWords = (uint32_t)KeySize / (primesCount*CC_BITS_IN_32BIT_WORD);
+
+        /* .......... set the private mode to CRT .................................. */
+        pCcPrivKey->OperationMode = CC_RSA_Crt;
+        pCrt->primesCount = primesCount;
+
+        /* ................ generate the factors ..................................... */
+        /* ------------------------------------------------------------------------- */
+        for (i = 0; i < primesCount; i++) {
+        	if (i == 0) {
+        		pPrime = pCrt->P;
+        	} else if (i == 1) {
+        		pPrime = pCrt->Q;
+        	} else {
+        		pPrime = pCrt->otherPrimes[i-2].R;
+        	}
+        	rSizeWords = (i == primesCount - 1) ? ((uint32_t)KeySize/CC_BITS_IN_32BIT_WORD - (primesCount-1)*pSizeWords) : pSizeWords;
+
+        	Error = RsaGenPrime(f_rng, p_rng, rSizeWords*CC_BITS_IN_32BIT_WORD,
+        			    pCcPubKey->eSizeInBits, pCcPubKey->e, pPrime, KeyGenData_ptr);
+        	if (Error != CC_OK) {
+        		goto End;
+        	}
+
+        	/* the factors must be distinct */
+        	for (j = 0; j < i; j++) {
+        		cmpRes = CC_CommonCmpLsWordsUnsignedCounters(pPrime, rSizeWords,
+        							      (j == 0) ? pCrt->P : ((j == 1) ? pCrt->Q : pCrt->otherPrimes[j-2].R),
+        							      (j < 2) ? pSizeWords : rSizeWords);
+        		if (cmpRes == CC_COMMON_CmpCounter1AndCounter2AreIdentical) {
+        			break;
+        		}
+        	}
+        	if (j < i) {
+        		i--;
+        		continue;
+        	}
+
+        	if (i < 2) {
+        		pCrt->PSizeInBits = pSizeWords*CC_BITS_IN_32BIT_WORD;
+        		pCrt->QSizeInBits = pSizeWords*CC_BITS_IN_32BIT_WORD;
+        	} else {
+        		pCrt->otherPrimes[i-2].RSizeInBits = rSizeWords*CC_BITS_IN_32BIT_WORD;
+        	}
+        }
+
+        /* we want to have P > Q */
+        cmpRes = CC_CommonCmpLsWordsUnsignedCounters(pCrt->P, pSizeWords, pCrt->Q, pSizeWords);
+        if (cmpRes != CC_COMMON_CmpCounter1GreaterThenCounter2) {
+        	CC_PalMemCopy(KeyGenData_ptr->KGData.p, pCrt->P, pSizeWords*CC_32BIT_WORD_SIZE);
+        	CC_PalMemCopy(pCrt->P, pCrt->Q, pSizeWords*CC_32BIT_WORD_SIZE);
+        	CC_PalMemCopy(pCrt->Q, KeyGenData_ptr->KGData.p, pSizeWords*CC_32BIT_WORD_SIZE);
+        }
+
+        /* ................ calculate the CRT parameters and the modulus ........... */
+        /* ------------------------------------------------------------------------- */
+        Error = RsaCalculateCrtParams(
+        		pCcPubKey->e, pCcPubKey->eSizeInBits,
+			2*pSizeWords*CC_BITS_IN_32BIT_WORD,
+			pCrt->P, pCrt->Q,
+			pCrt->dP,
+			pCrt->dQ,
+			pCrt->qInv);
+        if (Error != CC_OK) {
+        	goto End;
+        }
+
+        Error = RsaCalculateOtherPrimesCrtParams(pCcPubKey->e, pCcPubKey->eSizeInBits, pCcPrivKey);
+        if (Error != CC_OK) {
+        	goto End;
+        }
+
+        Error = RsaCalcMultiPrimeModulus(pCcPrivKey);
+        if (Error != CC_OK) {
+        	goto End;
+        }
+        if (pCcPrivKey->nSizeInBits != KeySize) {
+        	Error = CC_RSA_INVALID_MODULUS_SIZE;
+        	goto End;
+        }
+        CC_PalMemCopy(pCcPubKey->n, pCcPrivKey->n, KeySize/CC_BITS_IN_BYTE);
+        pCcPubKey->nSizeInBits = KeySize;
+
+        /* ................ set the vector sizes ................................... */
+        /* ------------------------------------------------------------------------- */
+        pCrt->dPSizeInBits = CC_CommonGetWordsCounterEffectiveSizeInBits(pCrt->dP, pSizeWords);
+        pCrt->dQSizeInBits = CC_CommonGetWordsCounterEffectiveSizeInBits(pCrt->dQ, pSizeWords);
+        pCrt->qInvSizeInBits = CC_CommonGetWordsCounterEffectiveSizeInBits(pCrt->qInv, pSizeWords);
+
+        /* ................ initialize the low level key structures ................ */
+        /* ------------------------------------------------------------------------- */
+
+        Error = RsaInitPubKeyDb(pCcPubKey);
+        if (Error != CC_OK) {
+                goto End;
+        }
+
+        Error = RsaInitPrivKeyDb(pCcPrivKey);
+        if (Error != CC_OK) {
+                goto End;
+        }
+
+        pCcUserPrivKey->valid_tag = CC_RSA_PRIV_KEY_VALIDATION_TAG;
+        pCcUserPubKey->valid_tag  = CC_RSA_PUB_KEY_VALIDATION_TAG;
+
+End:
+
+        /* on failure clear the generated key */
+        if (Error != CC_OK) {
+                Error = CC_RSA_INTERNAL_ERROR;
+		CC_PalMemSetZero(pCcUserPrivKey,  sizeof(CCRsaUserPrivKey_t) );
+		CC_PalMemSetZero(pCcUserPubKey, sizeof(CCRsaUserPubKey_t) );
+	}
+        /* clear the KG data structure */
+        CC_PalMemSetZero (KeyGenData_ptr ,sizeof(CCRsaKgData_t) );
+
+        return Error;
+
+}/* END OF CC_RsaKgKeyPairMultiPrimeGenerate */
+
+
 
 /**********************************************************************************************************/
 /**
@@ -11,6 +11,7 @@
 #include "cc_error.h"
 #include "cc_rsa_types.h"
 #include "cc_rnd_common.h"
+#include "pka.h"
 
 
 #ifdef __cplusplus
@@ -84,9 +85,8 @@ typedef struct HashDerCode_t {
 
 /************************ Structs  ******************************/
 typedef struct CCRsaOaepData_t{
-	uint8_t  MaskDB[CC_RSA_OAEP_ENCODE_MAX_MASKDB_SIZE];
-	uint8_t  SeedMask[CC_RSA_OAEP_ENCODE_MAX_SEEDMASK_SIZE];
-	CCHashUserContext_t HashUsercontext;
+	CCHashUserContext_t HashUsercontext;	/* the label hash; the MGF1 hashed seed */
+	CCHashUserContext_t MgfBlockContext;	/* the MGF1 block hash */
 	CCHashResultBuf_t         HashResultBuff;
 }CC_PAL_COMPILER_TYPE_MAY_ALIAS CCRsaOaepData_t;
 
@@ -122,14 +122,16 @@ CCError_t RsaEmsaPkcs1v15Encode(
 
 /**********************************************************************************************************/
 
+/* Generates the MGF1 mask of L bytes from the seed Z, and XORs it into Data_ptr.
+   The seed is hashed once; the mask is not stored, each hash block is XORed as it is generated.
+   The hash states are kept in the caller's pTempData instead of on the stack. */
 CCError_t RsaOaepMGF1( uint16_t hLen, /*size in Bytes*/
 			    uint8_t * Z_ptr,
 			    uint16_t ZSize,/*size in Bytes*/
 			    uint32_t L,
-			    uint8_t  *Mask_ptr,
+			    uint8_t  *Data_ptr,	/*the data to mask, of L bytes; must not overlap Z_ptr*/
 			    CCPkcs1HashFunc_t hashFunc,
-			    uint8_t  *T_Buf,	/*T_Buf is a buffer used for data manipulation for the function to use instead of allocating the space on stack*/
-			    uint8_t  *T_TMP_Buf);/*T_TMP_Buf is a buffer used for data manipulation for the function to use instead of allocating the space on stack*/
+			    CCRsaOaepData_t *pTempData);	/*temp buffer: all its fields are overwritten*/
 
 /**********************************************************************************************************/
 /**
@@ -158,6 +160,7 @@ CCError_t RsaPssOaepEncode(CCRndGenerateVectWorkFunc_t f_rng, /* Pointer to DRBG
 */
 CCError_t RsaPssOaepDecode(CCPkcs1HashFunc_t hashFunc,
                              CCPkcs1Mgf_t MGF,
+                             uint8_t  Y,
                              uint8_t  *EM_ptr,
                              uint16_t EMSize,
                              uint8_t *P_ptr,
@@ -212,6 +215,21 @@ CCError_t RsaPssSign21(CCRndGenerateVectWorkFunc_t f_rng, /*in*/
 */
 CCError_t RsaPssVerify21(RSAPubContext_t *Context_ptr);
 
+/**********************************************************************************************************/
+/**
+   \brief RsaPrimEncryptInSession implements CC_RsaPrimEncrypt in an open PKA session of the
+   modulus size, so a run of operations with the same key loads the key once.
+   If pSession is NULL, the operation runs in its own PKA session.
+
+   @return CCError_t - CC_OK, or error as CC_RsaPrimEncrypt
+*/
+CCError_t RsaPrimEncryptInSession(PkaSession_t      *pSession,
+				  CCRsaUserPubKey_t *UserPubKey_ptr,
+				  CCRsaPrimeData_t  *PrimeData_ptr,
+				  uint8_t           *Data_ptr,
+				  size_t             DataSize,
+				  uint8_t           *Output_ptr);
+
 /**********************************************************************************************************/
 /**
  * @brief The CC_RsaGenerateVectorInRangeX931 function generates a random vector in range:
@@ -26,6 +26,11 @@
 
 /************************ Defines ****************************/
 
+/* 1 if x is zero, 0 otherwise, without a branch; x must be less than 2^31 */
+#define RSA_OAEP_CT_IS_ZERO(x)  (((((uint32_t)(x)) | (0U - (uint32_t)(x))) >> 31) ^ 1U)
+/* all ones if bit is 1, zero if bit is 0 */
+#define RSA_OAEP_CT_MASK(bit)   (0U - (uint32_t)(bit))
+
 /************************ Enums ******************************/
 
 /************************ Typedefs ***************************/
@@ -41,6 +46,8 @@ extern uint16_t Global_vector_Index;
 
 /************* Private function prototype ****************/
 
+static void RsaOaepXorBytes(uint8_t *pData, const uint8_t *pMask, uint32_t size);
+
 
 
 #if !defined(_INTERNAL_CC_NO_RSA_ENCRYPT_SUPPORT) && !defined(_INTERNAL_CC_NO_RSA_VERIFY_SUPPORT)
@@ -71,11 +78,8 @@ CCError_t RsaPssOaepEncode(
         CCError_t Error = CC_OK;
 
         /*For PKCS1 Ver21 standard: emLen = k = Public mod N size*/
-        /*Used for output of MGF1 function ; the size is at most emLen */
-        uint8_t *MaskDB_Ptr =((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->MaskDB;
+        uint8_t *MaskDB_Ptr;
         uint32_t HashOutputSize;
-        uint16_t TmpSize, I;
-        uint8_t *TmpByte_ptr;
         uint8_t *EM_ptr = &EMInput_ptr[1];
         uint8_t VersionConstant;   /*Used to distinguish between Ver 2.1 and others for some memory manipulations*/
 
@@ -258,8 +262,15 @@ CCError_t RsaPssOaepEncode(
  * Step 7 : Let dbMask = MGF(seed, emLen-hLen).  *
  * PKCS1_VER21 Step 2 <e> Let                    *
  *      dbMask = MGF(seed, emLen-hLen-1).        *
+ *-----------------------------------------------*
+ *  Step 8 : PKCS1_VER21 Step 2.f:               *
+ *             Let maskedDB = DB xor dbMask.     *
+ *   The mask is XORed into DB as it is          *
+ *   generated.                                  *
  *-----------------------------------------------*/
 
+        MaskDB_Ptr = &EM_ptr[HashOutputSize];
+
         switch (MGF) {
         case CC_PKCS1_MGF1:
 
@@ -268,10 +279,9 @@ CCError_t RsaPssOaepEncode(
                                          &EM_ptr[0],                                                              /*mgfSeed*/
                                          HashOutputSize,                                                          /*seedLen*/
                                          emLen-HashOutputSize-(VersionConstant-1),                                /*maskLen*/
-                                         &(((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->MaskDB[0]), /*mask*/
+                                         MaskDB_Ptr,                                                              /*data to mask*/
                                          hashFunc,                                                                /*hashMode*/
-                                         (uint8_t *)PrimeData_ptr->DataIn,                                        /*1-st tempBuff*/
-                                         (uint8_t *)PrimeData_ptr->DataOut);                                      /*2-nd tempBuff*/
+                                         (CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff));                 /*temp buffer*/
 
                 if (Error != CC_OK) {
                         goto End;
@@ -285,21 +295,11 @@ CCError_t RsaPssOaepEncode(
                 goto End;
         }
 
-        /*----------------------------------------------*
-        *  Step 8 : PKCS1_VER21 Step 2.f:               *
-        *             Let maskedDB = DB xor dbMask.     *
-        *-----------------------------------------------*/
-
-        TmpSize = emLen - HashOutputSize - (VersionConstant - 1);
-        TmpByte_ptr = &EM_ptr[HashOutputSize];
-        for (I = 0; I < TmpSize; I++)
-                *(TmpByte_ptr + I) ^= ((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->MaskDB[I];
-
-        MaskDB_Ptr = TmpByte_ptr;
-
 /*-----------------------------------------------*
  * Step 9 : Let seedMask = MGF(maskedDB, hLen).  *
  * PKCS1_VER21 Step 2.g                          *
+ * Step 10: Let maskedSeed = seed \xor seedMask. *
+ * PKCS1_VER21 Step 2 <h>                        *
  *-----------------------------------------------*/
 
         switch (MGF) {
@@ -310,10 +310,9 @@ CCError_t RsaPssOaepEncode(
                                  MaskDB_Ptr,
                                  (uint16_t)(emLen-HashOutputSize-(VersionConstant-1)),
                                  HashOutputSize,
-                                 &(((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->SeedMask[0]),
+                                 &EM_ptr[0],
                                  hashFunc,
-                                 (uint8_t *)PrimeData_ptr->DataIn,
-                                 (uint8_t *)PrimeData_ptr->DataOut);
+                                 (CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff));
 
                 if (Error != CC_OK)
                         goto End;
@@ -328,16 +327,6 @@ CCError_t RsaPssOaepEncode(
 
         }/* end of MGF type switch */
 
-/*-----------------------------------------------*
- * Step 10: Let maskedSeed = seed \xor seedMask. *
- * PKCS1_VER21 Step 2 <h>                        *
- *-----------------------------------------------*/
-
-        TmpSize = HashOutputSize;
-        TmpByte_ptr =& EM_ptr[0];
-        for (I = 0;I < TmpSize; I++)
-                *(TmpByte_ptr + I)^=((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->SeedMask[I];
-
 /*---------------------------------------------*
  *  * Step 11:  PKCS1_VER21 Step 2.i:	       *
  * Let EM = 0x00 || maskedSeed || maskedDB.    *
@@ -367,7 +356,8 @@ CCError_t RsaPssOaepEncode(
 CCError_t RsaPssOaepDecode(
                                    CCPkcs1HashFunc_t hashFunc,
                                    CCPkcs1Mgf_t MGF,
-                                   uint8_t  *EM_ptr,
+                                   uint8_t  Y,                   /* the leading octet of EM, must be 0x00 */
+                                   uint8_t  *EM_ptr,             /* EM without the leading octet */
                                    uint16_t EMSize,
                                    uint8_t *P_ptr,
                                    size_t  PSize,
@@ -383,6 +373,8 @@ CCError_t RsaPssOaepDecode(
         uint8_t  *maskedDB_ptr;
         uint16_t  I, TmpSize;
         uint8_t  *TmpByte_ptr;
+        uint8_t  *pHash_ptr;
+        uint32_t  diff, good, found, isZero, isOne, msgIndex;
 #ifdef USE_MBEDTLS_CRYPTOCELL
         const mbedtls_md_info_t *md_info=NULL;
         mbedtls_md_context_t *md_ctx=NULL;
@@ -445,6 +437,8 @@ CCError_t RsaPssOaepDecode(
 /*-------------------------------------------------------*
  * Step 4: Let seedMask = MGF(maskedDB, hLen).           *
  * PKCS1 Ver2.1: Step <3> <c>                            *
+ * Step 5: Let seed = maskedSeed xor seedMask.           *
+ * PKCS1 Ver2.1: Step <3> <d>                            *
  *-------------------------------------------------------*/
 
         switch (MGF) {
@@ -455,10 +449,9 @@ CCError_t RsaPssOaepDecode(
                                          maskedDB_ptr,                                                               /*mgfSeed - in*/
                                          (uint16_t)(EMSize - HashOutputSize),                                        /*seedLen*/
                                          HashOutputSize,                                                             /*maskLen*/
-                                         &(((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->SeedMask[0]),  /*mask - out*/
+                                         EM_ptr,                                                                     /*data to mask*/
                                          hashFunc,                                                                   /*hashMode*/
-                                         (uint8_t *)PrimeData_ptr->DataIn,                                           /*1-st tempBuff*/
-                                         (uint8_t *)PrimeData_ptr->DataOut);                                         /*2-nd tempBuff*/
+                                         (CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff));                    /*temp buffer*/
                 if (Error != CC_OK) {
                         return Error;
                 }
@@ -471,39 +464,24 @@ CCError_t RsaPssOaepDecode(
 
         }
 
-/*-------------------------------------------------------*
- * Step 5: Let seed = maskedSeed xor seedMask.           *
- * PKCS1 Ver2.1: Step <3> <d>                            *
- *-------------------------------------------------------*/
-        for (I = 0; I < HashOutputSize; I++)
-                EM_ptr[I] ^= ((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->SeedMask[I];
-
 /*-------------------------------------------------------*
  * Step 6: Let dbMask = MGF(seed, ||EM|| - hLen).        *
  * PKCS1 Ver2.1: Step <3> <e>                            *
+ * Step 7: Let DB = maskedDB xor dbMask.                 *
+ *         PKCS1 Ver2.1: Step <3> <f>                    *
  *-------------------------------------------------------*/
         Error=RsaOaepMGF1(
                                HashOutputSize,
                                EM_ptr,
                                HashOutputSize,
                                EMSize - HashOutputSize,
-                               &(((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->MaskDB[0]),
+                               maskedDB_ptr,
                                hashFunc,
-                               (uint8_t *)PrimeData_ptr->DataIn,
-                               (uint8_t *)PrimeData_ptr->DataOut);
+                               (CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff));
 
         if (Error!=CC_OK)
                 return Error;
 
-/*-------------------------------------------------------*
- * Step 7: Let DB = maskedDB xor dbMask.                 *
- *         PKCS1 Ver2.1: Step <3> <f>                    *
- *-------------------------------------------------------*/
-        TmpSize = EMSize - HashOutputSize;
-        TmpByte_ptr = &EM_ptr[0] + HashOutputSize;
-        for (I = 0; I < TmpSize; I++)
-                TmpByte_ptr[I] ^= ((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->MaskDB[I];
-
 /*-------------------------------------------------------*
  * Step 8: Let pHash = Hash(P), an octet string of       *
  *         length hLen.                                  *
@@ -573,34 +551,45 @@ CCError_t RsaPssOaepDecode(
  *         output "decoding error" and stop.               *
  *                                                         *
  * PKCS1 Ver2.1: Step <3> <g>                              *
+ * Step 10: If pHash' does not equal pHash, output         *
+ *          "decoding error" and stop.                     *
+ *                                                         *
+ * The whole DB is scanned, and both checks and the check  *
+ * that the leading octet Y is 0x00 are combined into one  *
+ * error, so that the time and the error do not tell which *
+ * check failed, nor where the 01 octet is.                *
  *---------------------------------------------------------*/
+        pHash_ptr = (uint8_t *)(((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->HashResultBuff);
+        diff = 0;
+        for (I = 0; I < HashOutputSize; I++) {
+                diff |= (uint32_t)(EM_ptr[HashOutputSize + I] ^ pHash_ptr[I]);
+        }
+        good = RSA_OAEP_CT_MASK(RSA_OAEP_CT_IS_ZERO(diff));
+        good &= RSA_OAEP_CT_MASK(RSA_OAEP_CT_IS_ZERO(Y));
+
         TmpSize = EMSize - 2*HashOutputSize;
         TmpByte_ptr = &EM_ptr[0] + 2*HashOutputSize;
+        found = 0;
+        msgIndex = 0;
         for (I = 0; I < TmpSize; I++) {
-                if (TmpByte_ptr[I] != 0x00)
-                        break;
+                isZero = RSA_OAEP_CT_MASK(RSA_OAEP_CT_IS_ZERO(TmpByte_ptr[I]));
+                isOne = RSA_OAEP_CT_MASK(RSA_OAEP_CT_IS_ZERO(TmpByte_ptr[I] ^ 0x01));
+                /* the index of the first 01 octet */
+                msgIndex |= ~found & isOne & I;
+                /* before the first 01 octet, only zero octets are allowed */
+                good &= found | isZero | isOne;
+                found |= isOne;
         }
+        good &= found;
 
-        if (TmpByte_ptr[I] != 0x01){
+        if (good == 0) {
                 Error = CC_RSA_OAEP_DECODE_ERROR;
                 goto End;
         }
 
+        I = (uint16_t)msgIndex;
         TmpByte_ptr += I;
 
-/*------------------------------------------------------*
- * Step 10: If pHash' does not equal pHash, output      *
- *          "decoding error" and stop.                  *
- *                                                      *
- * PKCS1 Ver2.1: Step <3> <g>                           *
- *------------------------------------------------------*/
-        if (CC_PalMemCmp(&EM_ptr[0] + HashOutputSize,
-                        (uint8_t *)(((CCRsaOaepData_t*)((void*)PrimeData_ptr->InternalBuff))->HashResultBuff),
-                        HashOutputSize)) {
-                Error = CC_RSA_OAEP_DECODE_ERROR;
-                goto End;
-        }
-
 /*-----------------------------------------------*
  * Step 11: Output M.                            *
  *-----------------------------------------------*/
@@ -637,6 +626,24 @@ CCError_t RsaPssOaepDecode(
 #endif /*!defined(CC_NO_RSA_DECRYPT_SUPPORT) && !defined(_INTERNAL_CC_NO_RSA_SIGN_SUPPORT)*/
 
 
+/************************ Private Functions ******************************/
+
+/* XORs the mask into the data, 8 bytes at a time; the data and the mask may be unaligned */
+static void RsaOaepXorBytes(uint8_t *pData, const uint8_t *pMask, uint32_t size)
+{
+        uint64_t word;
+        uint32_t i;
+
+        for (i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+                word = CC_COMMON_LOAD_LE64(&pData[i]) ^ CC_COMMON_LOAD_LE64(&pMask[i]);
+                CC_COMMON_STORE_LE64(&pData[i], word);
+        }
+        for (; i < size; i++) {
+                pData[i] ^= pMask[i];
+        }
+}
+
+
 /**********************************************************************************************************/
 
 /* -------------------------------------------------------------
@@ -656,23 +663,26 @@ CCError_t RsaOaepMGF1( uint16_t hLen,                  /*hashLen*/
                                uint8_t *Z_ptr,                 /*mgfSeed*/
                                uint16_t ZSize,                 /*seedLen*/
                                uint32_t L,                     /*maskLen*/
-                               uint8_t  *Mask_ptr,             /*mask*/
-                               CCPkcs1HashFunc_t hashFunc, /*hashMode*/
-                               uint8_t  *T_Buf,                /*1-st tempBuff*/
-                               uint8_t  *T_TMP_Buf)            /*2-nd tempBuff*/
+                               uint8_t  *Data_ptr,             /*data to mask*/
+                               CCPkcs1HashFunc_t hashFunc,     /*hashMode*/
+                               CCRsaOaepData_t *pTempData)     /*temp buffer for the hash states*/
 {
 
         /* FUNCTION DECLARATIONS */
 
-        CCError_t Error;
+        CCError_t Error = CC_OK;
         uint32_t Counter = 0;
-        uint32_t CounterMaxSize, Tmp32Bit;
-        CCHashResultBuf_t  HashResultBuff;
-        uint8_t *Output_ptr;
-        uint8_t *T = T_Buf;/*The size of T for MGF1 used to be 2048/8 now the size of T_Buf in the context is even bigger*/
-        uint8_t *T_TMP = T_TMP_Buf;
+        uint32_t CounterMaxSize, BlockSize;
+        uint8_t  CounterBuff[sizeof(uint32_t)];
+        uint32_t *HashResultBuff = pTempData->HashResultBuff;
 #ifdef USE_MBEDTLS_CRYPTOCELL
         const mbedtls_md_info_t *md_info=NULL;
+        mbedtls_md_context_t SeedContext;
+        mbedtls_md_context_t BlockContext;
+#else
+        /* the hash states are in the caller's temp buffer, not on the stack */
+        CCHashUserContext_t *pSeedContext = &pTempData->HashUsercontext;
+        CCHashUserContext_t *pBlockContext = &pTempData->MgfBlockContext;
 #endif
 
 
@@ -689,7 +699,35 @@ CCError_t RsaOaepMGF1( uint16_t hLen,                  /*hashLen*/
 
 /*---------------------------------------------------------------------*
  * Step 2:  Let T  be the empty octet string.                          *
+ *          The seed Z is the same in all the blocks Hash (Z || C): it *
+ *          is hashed once, and each block continues from a copy of    *
+ *          the hash state. The hash user context holds only relative  *
+ *          offsets, so a byte copy of it is a valid copy of the state.*
  *---------------------------------------------------------------------*/
+#ifdef USE_MBEDTLS_CRYPTOCELL
+        md_info = mbedtls_md_info_from_string( HashAlgMode2mbedtlsString[hashFunc] );
+        if (NULL == md_info)
+        {
+            return CC_RSA_HASH_ILLEGAL_OPERATION_MODE_ERROR;
+        }
+        mbedtls_md_init(&SeedContext);
+        mbedtls_md_init(&BlockContext);
+        if ((mbedtls_md_setup(&SeedContext, md_info, 0) != 0) ||
+            (mbedtls_md_setup(&BlockContext, md_info, 0) != 0) ||
+            (mbedtls_md_starts(&SeedContext) != 0) ||
+            (mbedtls_md_update(&SeedContext, Z_ptr, ZSize) != 0)) {
+                Error = CC_RSA_HASH_ILLEGAL_OPERATION_MODE_ERROR;
+                goto End;
+        }
+#else
+        Error = CC_HashInit(pSeedContext, hashFunc);
+        if (Error != CC_OK)
+                goto End;
+
+        Error = CC_HashUpdate(pSeedContext, Z_ptr, ZSize);
+        if (Error != CC_OK)
+                goto End;
+#endif
 
 /*---------------------------------------------------------------------*
  * Step 3:  For counter from 0 to  | l / hLen | -1 , do the following: *
@@ -698,9 +736,10 @@ CCError_t RsaOaepMGF1( uint16_t hLen,                  /*hashLen*/
  *               C = I2OSP (counter, 4)                                *
  *          b.	Concatenate the hash of the seed Z and C to the octet  *
  *               string T:   T = T || Hash (Z || C)                    *
+ * Step 4:  Output the leading L octets of T as the octet string mask. *
+ *          The mask is not stored: each block of T is XORed into the  *
+ *          data as soon as it is hashed.                              *
  *---------------------------------------------------------------------*/
-        Output_ptr = T;
-        CC_PalMemCopy(T_TMP, Z_ptr/*seed*/, ZSize);
 
         /* count of Hash blocks needed for mask calculation */
         CounterMaxSize = (uint32_t)((L + hLen - 1)/hLen);
@@ -711,55 +750,50 @@ CCError_t RsaOaepMGF1( uint16_t hLen,                  /*hashLen*/
                  *          a.	Convert counter to an octet string C of length 4
                  *              with the primitive I2OSP:   C = I2OSP (counter, 4)
                  *--------------------------------------------------------------------*/
-
-                /* T_TMP = H||C */
-
-#ifndef BIG__ENDIAN
-                Tmp32Bit = CC_COMMON_REVERSE32(Counter);
-#else
-                Tmp32Bit = Counter;
-#endif
-
-                CC_PalMemCopy(&T_TMP[0] + ZSize, &Tmp32Bit, sizeof(uint32_t));
+                CounterBuff[0] = (uint8_t)(Counter >> 24);
+                CounterBuff[1] = (uint8_t)(Counter >> 16);
+                CounterBuff[2] = (uint8_t)(Counter >> 8);
+                CounterBuff[3] = (uint8_t)Counter;
 
                 /*--------------------------------------------------------------------
-                 *          b.	Concatenate the hash of the seed Z and C to the octet
-                 *               string T: T = T || Hash (Z || C)
+                 *          b.	Hash (Z || C), continuing from the hashed seed
                  *--------------------------------------------------------------------*/
-
-                /* Hash Z||C */
 #ifdef USE_MBEDTLS_CRYPTOCELL
-                md_info = mbedtls_md_info_from_string( HashAlgMode2mbedtlsString[hashFunc] );
-                if (NULL == md_info)
-                {
-                    return CC_RSA_HASH_ILLEGAL_OPERATION_MODE_ERROR;
-                }
-                Error = mbedtls_md(md_info,
-                        T_TMP,
-                        ZSize + sizeof(uint32_t)/*counterSize*/,
-                        (unsigned char *)HashResultBuff);
-                if (0 != Error)
-                {
-                        return CC_RSA_HASH_ILLEGAL_OPERATION_MODE_ERROR;
+                if ((mbedtls_md_clone(&BlockContext, &SeedContext) != 0) ||
+                    (mbedtls_md_update(&BlockContext, CounterBuff, sizeof(CounterBuff)) != 0) ||
+                    (mbedtls_md_finish(&BlockContext, (unsigned char *)HashResultBuff) != 0)) {
+                        Error = CC_RSA_HASH_ILLEGAL_OPERATION_MODE_ERROR;
+                        goto End;
                 }
 #else
-                Error = CC_Hash(hashFunc,
-                                T_TMP,
-                                ZSize + sizeof(uint32_t)/*counterSize*/,
-                                HashResultBuff);
+                CC_PalMemCopy(pBlockContext, pSeedContext, sizeof(CCHashUserContext_t));
 
-                if (Error!=CC_OK)
-                        return Error;
+                Error = CC_HashUpdate(pBlockContext, CounterBuff, sizeof(CounterBuff));
+                if (Error != CC_OK)
+                        goto End;
+
+                Error = CC_HashFinish(pBlockContext, HashResultBuff);
+                if (Error != CC_OK)
+                        goto End;
 #endif
-                CC_PalMemCopy(Output_ptr, (uint8_t *)HashResultBuff, hLen);
-                Output_ptr += hLen;
+
+                /* the last block is truncated to the L octets of the mask */
+                BlockSize = (L - Counter*hLen < hLen) ? (L - Counter*hLen) : hLen;
+                RsaOaepXorBytes(Data_ptr, (uint8_t *)HashResultBuff, BlockSize);
+                Data_ptr += hLen;
         }
 
-/*---------------------------------------------------------------------*
- * Step 4:  Output the leading L octets of T as the octet string mask. *
- *---------------------------------------------------------------------*/
-        CC_PalMemCopy(Mask_ptr,(uint8_t *)T, L);
+End:
+#ifdef USE_MBEDTLS_CRYPTOCELL
+        if (md_info != NULL) {
+                mbedtls_md_free(&SeedContext);
+                mbedtls_md_free(&BlockContext);
+        }
+        CC_PalMemSetZero(&SeedContext, sizeof(SeedContext));
+        CC_PalMemSetZero(&BlockContext, sizeof(BlockContext));
+#endif
+        CC_PalMemSetZero(pTempData, sizeof(CCRsaOaepData_t));
 
-        return CC_OK;
+        return Error;
 }
 #endif /* !defined(CC_IOT) || ( defined(CC_IOT) && defined(MBEDTLS_RSA_C)) */
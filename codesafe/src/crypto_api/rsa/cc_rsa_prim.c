@@ -71,6 +71,26 @@ CEXPORT_C CCError_t CC_RsaPrimEncrypt(CCRsaUserPubKey_t *UserPubKey_ptr,
 					    uint8_t              *Data_ptr,
 					    size_t                DataSize,
 					    uint8_t              *Output_ptr)
+{
+	return RsaPrimEncryptInSession(NULL, UserPubKey_ptr, PrimeData_ptr, Data_ptr, DataSize, Output_ptr);
+}/* END OF CC_RsaPrimEncrypt */
+
+
+/**********************************************************************************/
+/**
+@brief
+RsaPrimEncryptInSession implements CC_RsaPrimEncrypt in an open PKA session of the modulus size,
+keeping the key resident for the next operations of the session.
+If pSession is NULL, the operation runs in its own PKA session.
+
+  @return CCError_t - as CC_RsaPrimEncrypt
+ */
+CCError_t RsaPrimEncryptInSession(PkaSession_t      *pSession,
+				  CCRsaUserPubKey_t *UserPubKey_ptr,
+				  CCRsaPrimeData_t  *PrimeData_ptr,
+				  uint8_t           *Data_ptr,
+				  size_t             DataSize,
+				  uint8_t           *Output_ptr)
 {
 	/* FUNCTION LOCAL DECLERATIONS */
 
@@ -162,7 +182,11 @@ CEXPORT_C CCError_t CC_RsaPrimEncrypt(CCRsaUserPubKey_t *UserPubKey_ptr,
 	}
 
 	/* executing the encryption */
-	Error = RsaExecPubKeyExp(PubKey_ptr, PrimeData_ptr);
+	if (pSession == NULL) {
+		Error = RsaExecPubKeyExp(PubKey_ptr, PrimeData_ptr);
+	} else {
+		Error = RsaExecPubKeyExpInSession(pSession, PubKey_ptr, PrimeData_ptr);
+	}
 
 	if (Error != CC_OK) {
 		Error = CC_RSA_INTERNAL_ERROR;
@@ -187,7 +211,7 @@ End:
 	return Error;
 
 
-}/* END OF CC_RsaPrimEncrypt */
+}/* END OF RsaPrimEncryptInSession */
 
 
 /**********************************************************************************/
@@ -125,18 +125,23 @@ CCError_t RsaPssVerify21(RSAPubContext_t *Context_ptr)
           i.e. COPIed hash size bytes directly before 0xbc byte (FIPS 186-4, 5.4)      */
         CC_PalMemCopy((uint8_t *)H_Saved_buf, &ED_ptr[maskedDB_size], Context_ptr->HASH_Result_Size*4);
 
-        /* Calculate the mask by MGF */
+        /* Calculate DB = maskedDB xor dbMask: the mask is XORed into a copy of maskedDB */
+        CC_PalMemCopy(dbMask_ptr, maskedDB_ptr, maskedDB_size);
+
         switch (Context_ptr->MGF_2use) {
         case CC_PKCS1_MGF1:
 
+                /*
+                 *  9.1.2 <7> dbMask = MGF(H, emLen - hLen - 1)
+                 *  9.1.2 <8> Xor operation on length (PubNNewSizeBytes - Context_ptr->hLen - 1)
+                 */
                 Error = RsaOaepMGF1( (uint16_t)(Context_ptr->HASH_Result_Size*sizeof(uint32_t)), /*hashLen*/
                                            (uint8_t *)H_Saved_buf,                                 /*mgfSeed = hash */
                                            (uint16_t)(Context_ptr->HASH_Result_Size*sizeof(uint32_t)),/*seedLen*/
-                                           PubNNewSizeBytes - Context_ptr->HASH_Result_Size*sizeof(uint32_t) - 1, /*maskLen*/
-                                           dbMask_ptr,                                             /*mask out*/
+                                           maskedDB_size,                                          /*maskLen*/
+                                           dbMask_ptr,                                             /*data to mask*/
                                            Context_ptr->HashOperationMode,                         /*hashMode*/
-                                           (uint8_t *)Context_ptr->PrimeData.DataOut,              /*1-st tempBuff*/
-                                           (uint8_t *)Context_ptr->PrimeData.DataIn);              /*2-nd tempBuff*/
+                                           (CCRsaOaepData_t*)((void*)Context_ptr->PrimeData.InternalBuff)); /*temp buffer*/
                 if (Error != CC_OK) {
                         return Error;
                 }
@@ -149,14 +154,6 @@ CCError_t RsaPssVerify21(RSAPubContext_t *Context_ptr)
                 return CC_RSA_MGF_ILLEGAL_ARG_ERROR;
         }
 
-        /*
-         *  9.1.2 <8> Xor operation on length (PubNNewSizeBytes - Context_ptr->hLen - 1)
-         */
-
-        for (i=0;i<maskedDB_size;i++) {
-                dbMask_ptr[i] = dbMask_ptr[i] ^ maskedDB_ptr[i] ;
-        }
-
         /*
          *  9.1.2 <9> Set the leftmost 8emLen - emBits bits of the leftmost octet in DB to zero
          *     Note: In CC implementation only NS bit must be zeroed, because modulus size is
@@ -286,8 +283,6 @@ CCError_t RsaPssSign21(
 #endif
         /* The return error identifier */
         CCError_t Error = CC_OK;
-        uint32_t i;
-        uint32_t TempIndex;
 
         /*Parameter for the actual size of the modulus N in bits*/
         uint32_t PrvNSizebits;
@@ -297,7 +292,6 @@ CCError_t RsaPssSign21(
         uint32_t Index4PSLength;
 
         uint8_t *EMPadOutputBuffer;
-        uint8_t *MaskOutput_ptr = Context_ptr->T_Buf;/*for stack space saving*/
 
         CCRsaPrivKey_t *PrivKey_ptr = (CCRsaPrivKey_t *)Context_ptr->PrivUserKey.PrivateKeyDbBuff;
         uint32_t hashResultSize; /*HASH size in bytes*/
@@ -397,6 +391,8 @@ CCError_t RsaPssSign21(
 
         /*
          *  9.1.1 <9> MGF operation
+         *  9.1.1 <10> Xor operation on length (PrvNNewSizeBytes - Context_ptr->hLen - 1):
+         *             the mask is XORed into DB as it is generated
          */
 
         switch (Context_ptr->MGF_2use) {
@@ -406,10 +402,9 @@ CCError_t RsaPssSign21(
                                            (uint8_t *)Context_ptr->HASH_Result,         /* mgfSeed */
                                            (uint16_t)hashResultSize, /* seedLen */
                                            PrvNNewSizeBytes - hashResultSize - 1, /* maskLen */
-                                           MaskOutput_ptr,                              /* mask */
+                                           EMPadOutputBuffer,                           /* data to mask */
                                            Context_ptr->HashOperationMode,              /* hashMode */
-                                           (uint8_t *)Context_ptr->PrimeData.DataOut,   /* temp1 */
-                                           (uint8_t *)Context_ptr->PrimeData.DataIn);   /* temp2 */
+                                           (CCRsaOaepData_t*)((void*)Context_ptr->PrimeData.InternalBuff)); /* temp buffer */
                 if (Error != CC_OK) {
                         return Error;
                 }
@@ -426,16 +421,6 @@ CCError_t RsaPssSign21(
         }/* end of MGF type switch case */
 
 
-        /*
-         *  9.1.1 <10> Xor operation on length (PrvNNewSizeBytes - Context_ptr->hLen - 1)
-         */
-
-        TempIndex = PrvNNewSizeBytes - hashResultSize - 1;
-        for (i = 0; i < TempIndex; i++) {
-                EMPadOutputBuffer[i] = EMPadOutputBuffer[i] ^ MaskOutput_ptr[i];
-        }
-
-
         /*
          *   9.1.1 <11> Set the leftmost 8*emLen-emBits bits of the leftmost octet in maskedDB to zero
          *		Because the RSA modulus in CC always is a multiple of 8, only one (left most) bit
@@ -538,11 +538,8 @@ CEXPORT_C CCError_t CC_RsaSchemesDecrypt(
          * Step 3 :  EME-OAEP Decoding			*
          *----------------------------------------------*/
 
-        /* for all modes */
-        if (EB_buff[0] != 0x00) {
-                Error = CC_RSA_ERROR_IN_DECRYPTED_BLOCK_PARSING;
-		goto End;
-        }
+        /* the leading octet of EM must be 0x00: it is checked per version, OAEP folds *
+         * it into the constant time decoding so it does not return a distinct error  */
 
         /*------------------------------------------------*
          * Perform decoding operation according to the    *
@@ -562,6 +559,11 @@ CEXPORT_C CCError_t CC_RsaSchemesDecrypt(
                  * and stop. Output the message M.	          *
                  *------------------------------------------------*/
 
+                if (EB_buff[0] != 0x00) {
+                        Error = CC_RSA_ERROR_IN_DECRYPTED_BLOCK_PARSING;
+			goto End;
+                }
+
                 if (EB_buff[1] != 0x02/*Block type for EME-PKCS1-v1_5*/) {
                         Error = CC_RSA_ERROR_IN_DECRYPTED_BLOCK_PARSING;
 			goto End;
@@ -620,6 +622,7 @@ CEXPORT_C CCError_t CC_RsaSchemesDecrypt(
                 Error=RsaPssOaepDecode(
                                              hashOpMode,
                                              MGF,
+                                             EB_buff[0],
                                              &EB_buff[1],
                                              (uint16_t)(K-1),
                                              L,
@@ -415,20 +415,22 @@ End:
 /**********************************************************************************************************/
 /**
 
-   \brief RSA_VerifyFinish implements the Finish Phase of the Verify algorithm
-   as defined in PKCS#1 v2.1 or PKCS#1 v1.5
+   \brief RsaVerifyFinishInSession implements the Finish Phase of the Verify algorithm
+   as defined in PKCS#1 v2.1 or PKCS#1 v1.5, running the public key operation in an open
+   PKA session of the modulus size, or in its own session if pSession is NULL.
 
    @param[in] UserContext_ptr - A pointer to the public Context
 	                           structure of the User.
    @param[in] Sig_ptr - A pointer to the signature to be verified.
                         The length of the signature is PubKey_ptr->N.len bytes
                         (that is, the size of the modulus, in bytes).
+   @param[in/out] pSession - The PKA session, or NULL.
 
    @return CCError_t - CC_OK, or error
 */
-
-CEXPORT_C CCError_t CC_RsaVerifyFinish(CCRsaPubUserContext_t *UserContext_ptr,
-					   uint8_t *Sig_ptr)
+static CCError_t RsaVerifyFinishInSession(CCRsaPubUserContext_t *UserContext_ptr,
+					  uint8_t *Sig_ptr,
+					  PkaSession_t *pSession)
 {
 	/* FUNCTION DECLERATIONS */
     uint32_t regVal;
@@ -486,11 +488,12 @@ CEXPORT_C CCError_t CC_RsaVerifyFinish(CCRsaPubUserContext_t *UserContext_ptr,
 	modSizeBytes = (uint16_t)(CALC_FULL_BYTES(PubKey_ptr->nSizeInBits));
 
 	/* execute the RSA encription of formatted sign block */
-	Error = CC_RsaPrimEncrypt(&ccmWorkingContext_ptr->PubUserKey,
-				      &ccmWorkingContext_ptr->PrimeData,
-				      Sig_ptr,
-				      modSizeBytes,
-				      (uint8_t*)ccmWorkingContext_ptr->EBD);
+	Error = RsaPrimEncryptInSession(pSession,
+					&ccmWorkingContext_ptr->PubUserKey,
+					&ccmWorkingContext_ptr->PrimeData,
+					Sig_ptr,
+					modSizeBytes,
+					(uint8_t*)ccmWorkingContext_ptr->EBD);
 	if (Error != CC_OK)
 		goto End;
 
@@ -568,6 +571,29 @@ End:
 	return Error;
 
 
+}/* END OF RsaVerifyFinishInSession */
+
+
+/**********************************************************************************************************/
+/**
+
+   \brief RSA_VerifyFinish implements the Finish Phase of the Verify algorithm
+   as defined in PKCS#1 v2.1 or PKCS#1 v1.5
+
+   @param[in] UserContext_ptr - A pointer to the public Context
+	                           structure of the User.
+   @param[in] Sig_ptr - A pointer to the signature to be verified.
+                        The length of the signature is PubKey_ptr->N.len bytes
+                        (that is, the size of the modulus, in bytes).
+
+   @return CCError_t - CC_OK, or error
+*/
+
+CEXPORT_C CCError_t CC_RsaVerifyFinish(CCRsaPubUserContext_t *UserContext_ptr,
+					   uint8_t *Sig_ptr)
+{
+	return RsaVerifyFinishInSession(UserContext_ptr, Sig_ptr, NULL);
+
 }/* END OF CC_RsaVerifyFinish */
 
 
@@ -673,5 +699,120 @@ CEXPORT_C CCError_t CC_RsaVerify(CCRsaPubUserContext_t *UserContext_ptr,
 
 }/* END OF CC_RsaVerify */
 
+
+/**********************************************************************************************************/
+/**
+   \brief CC_RsaVerifyBatch verifies a batch of signatures of one scheme, as by CC_RsaVerify.
+
+	All the items share one PKA session, so the PKA is initialized once for each run of
+	items with the same modulus size, and the modulus of a key is loaded once for each run
+	of items with the same key (the same key structure pointer). The result of each item is
+	returned in the item.
+
+   @param[in] UserContext_ptr - A pointer to the public Context, reused for every item.
+   @param[in] rsaHashMode - The hash function to be used for all the items.
+   @param[in] MGF - The mask generation function. only for PKCS#1 v2.1.
+   @param[in] SaltLen - The Length of the Salt buffer. relevant for PKCS#1 Ver 2.1 Only.
+   @param[in] PKCS1_ver - Ver 1.5 or 2.1, according to the functionality required.
+   @param[in/out] pItems - The array of the items.
+   @param[in] itemsCount - The count of the items.
+
+   @return CCError_t - CC_OK if all the signatures are valid,
+			CC_RSA_ERROR_VER15_INCONSISTENT_VERIFY if at least one item failed,
+			CC_RSA_INVALID_USER_CONTEXT_POINTER_ERROR,
+			CC_RSA_INVALID_BATCH_ERROR,
+			or a PKA error of opening the session.
+*/
+CEXPORT_C CCError_t CC_RsaVerifyBatch(CCRsaPubUserContext_t *UserContext_ptr,
+				      CCRsaHashOpMode_t rsaHashMode,
+				      CCPkcs1Mgf_t MGF,
+				      size_t    SaltLen,
+				      CCPkcs1Version_t PKCS1_ver,
+				      CCRsaVerifyBatchItem_t *pItems,
+				      size_t    itemsCount)
+{
+	/* FUNCTION DECLERATIONS */
+	uint32_t regVal;
+	/* The return error identifier */
+	CCError_t Error = CC_OK;
+	CCError_t itemError;
+	CCRsaVerifyBatchItem_t *pItem;
+	CCRsaUserPubKey_t *pPrevUserPubKey = NULL;
+	CCRsaPubKey_t *PubKey_ptr;
+	PkaSession_t session;
+	uint32_t pkaReqRegs = 7;
+	size_t i;
+
+	/* FUNCTION LOGIC */
+
+	CHECK_AND_RETURN_ERR_UPON_FIPS_ERROR();
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_RSA_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_RSA_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+	if (UserContext_ptr == NULL)
+		return CC_RSA_INVALID_USER_CONTEXT_POINTER_ERROR;
+
+	if ((pItems == NULL) || (itemsCount == 0))
+		return CC_RSA_INVALID_BATCH_ERROR;
+
+	session.isOpen = 0;
+	for (i = 0; i < itemsCount; i++) {
+		pItem = &pItems[i];
+
+		itemError = CC_RsaVerifyInit(UserContext_ptr, pItem->pUserPubKey, rsaHashMode,
+					     MGF, SaltLen, PKCS1_ver);
+		if (itemError == CC_OK) {
+			itemError = CC_RsaVerifyUpdate(UserContext_ptr, pItem->pDataIn, pItem->dataInSize);
+		}
+		if (itemError != CC_OK) {
+			pItem->result = itemError;
+			Error = CC_RSA_ERROR_VER15_INCONSISTENT_VERIFY;
+			continue;
+		}
+
+		/* the key passed Init, so its modulus size is valid */
+		PubKey_ptr = (CCRsaPubKey_t *)pItem->pUserPubKey->PublicKeyDbBuff;
+		if ((session.isOpen != 0) && (session.sizeInBits != PubKey_ptr->nSizeInBits)) {
+			PkaSessionClose(&session);
+		}
+		if (session.isOpen == 0) {
+			pkaReqRegs = 7;
+			itemError = PkaSessionOpen(&session, PubKey_ptr->nSizeInBits, &pkaReqRegs);
+			if (itemError != CC_OK) {
+				CC_PalMemSetZero(UserContext_ptr, sizeof(CCRsaPubUserContext_t));
+				return itemError;
+			}
+			pPrevUserPubKey = NULL;
+		}
+		/* the key is copied into the context, so the session sees the same key address
+		   for all the items: the residency is tracked by the user key pointer */
+		if (pItem->pUserPubKey != pPrevUserPubKey) {
+			PkaSessionInvalidate(&session);
+			pPrevUserPubKey = pItem->pUserPubKey;
+		}
+
+		itemError = RsaVerifyFinishInSession(UserContext_ptr, pItem->pSig, &session);
+		pItem->result = itemError;
+		if (itemError != CC_OK) {
+			Error = CC_RSA_ERROR_VER15_INCONSISTENT_VERIFY;
+		}
+	}
+
+	PkaSessionClose(&session);
+
+	return Error;
+
+}/* END OF CC_RsaVerifyBatch */
+
 #endif /*_INTERNAL_CC_NO_RSA_VERIFY_SUPPORT*/
 #endif /* !defined(CC_IOT) || ( defined(CC_IOT) && defined(MBEDTLS_RSA_C)) */
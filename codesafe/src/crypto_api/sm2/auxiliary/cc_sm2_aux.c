@@ -29,9 +29,9 @@
     @param[in] A pointer to the message.
     @param[in] The message size in bytes.
     @param[in] The Working_buffer
-    @param[in] The working buffer size should be at least  The working buffer size should be at least
-                                2 + idlen + modSizeInBytes*4 + ordSizeInBytes*2
-                                + idlen + msglen
+    @param[in] The working buffer size should be at least
+                                2 + modSizeInBytes*4 + ordSizeInBytes*2 + idlen
+                                (the message is hashed from pMsg, not copied to the working buffer)
     @param[out] The output buffer.
     @param[out] The size of the output buffer in words.
 
@@ -51,7 +51,7 @@ CIMPORT_C CCError_t CC_Sm2ComputeMessageDigest (
         uint8_t                     *pWorkingBuffer,/*!< [in]        - The working buffer */
         const size_t                wblen,          /*!< [in]        - The working buffer size should be at least
                                                                             2 + modSizeInBytes*4 + ordSizeInBytes*2
-                                                                            + idlen + msglen*/
+                                                                            + idlen*/
         uint32_t                    *pOut,          /*!< [out]       - A pointer to a buffer for the output. */
         size_t                      *pOutLen        /*!< [in/out]    - A pointer to the output length in words. */
 )
@@ -97,7 +97,7 @@ CIMPORT_C CCError_t CC_Sm2ComputeMessageDigest (
     }
 
     if (wblen < 2 + CC_SM2_MODULE_LENGTH_IN_BYTES*4 + CC_SM2_ORDER_LENGTH_IN_BYTES*2
-                                + idlen + msglen) {
+                                + idlen) {
         err = CC_ECPKI_GEN_KEY_INVALID_TEMP_DATA_PTR_ERROR;
         goto End;
     }
@@ -128,7 +128,7 @@ CIMPORT_C CCError_t CC_Sm2ComputeMessageDigest (
     if (CC_OK != err)
         goto End;
 
-    err = Sm2ComputeMessageFromIdDigest (idh, idhlen, pMsg, msglen, pWorkingBuffer, wblen, pOut, pOutLen );
+    err = Sm2ComputeMessageFromIdDigest (idh, idhlen, pMsg, msglen, pOut, pOutLen );
     if (CC_OK != err)
         goto End;
 End:
@@ -0,0 +1,455 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/************* Include Files ****************/
+#include "cc_pal_types.h"
+#include "cc_pal_mem.h"
+#include "cc_pal_mutex.h"
+#include "cc_pal_abort.h"
+#include "cc_sm3.h"
+#include "cc_sm2.h"
+#include "cc_sm2_int.h"
+#include "cc_sm2_za_cache.h"
+#include "cc_ecpki_domain_sm2.h"
+#include "cc_ecpki_error.h"
+#include "cc_ecpki_local.h"
+#include "pka_ec_wrst.h"
+#include "cc_common.h"
+#include "cc_util_int_defs.h"
+
+
+/************************ Defines *******************************/
+
+/* the ZA cache validity TAG */
+#define CC_SM2_ZA_CACHE_VALIDATION_TAG      0x534D5A43
+/* the prepared signer validity TAG */
+#define CC_SM2_SIGNER_VALIDATION_TAG        0x534D5347
+
+/************************ macros ********************************/
+
+#define SM2_ZA_CACHE_LOCK()                                             \
+    do {                                                                \
+        if (CC_PalMutexLock(&CCSm2ZaCacheMutex, CC_INFINITE) != CC_SUCCESS) { \
+            CC_PalAbort("Fail to acquire mutex\n");                     \
+        }                                                               \
+    } while (0)
+
+#define SM2_ZA_CACHE_UNLOCK()                                           \
+    do {                                                                \
+        if (CC_PalMutexUnlock(&CCSm2ZaCacheMutex) != CC_SUCCESS) {      \
+            CC_PalAbort("Fail to release mutex\n");                     \
+        }                                                               \
+    } while (0)
+
+/*********************** Global data  ***************************/
+
+extern CC_PalMutex CCSm2ZaCacheMutex;
+
+/******************************************************************************************/
+/************************         Private Functions          ******************************/
+/******************************************************************************************/
+
+/* checks the cache pointer and validation tag; called with CCSm2ZaCacheMutex held */
+static CCError_t Sm2ZaCacheCheck(CCSm2ZaCache_t *pCache)
+{
+    if (pCache == NULL) {
+        return CC_ECPKI_SM2_INVALID_ZA_CACHE_PTR;
+    }
+    if (pCache->validTag != CC_SM2_ZA_CACHE_VALIDATION_TAG) {
+        return CC_ECPKI_SM2_INVALID_ZA_CACHE;
+    }
+    return CC_OK;
+}
+
+/* returns the entry of the signer: the entry is selected by the public key and the ID size */
+static CCSm2ZaCacheEntry_t *Sm2ZaCacheEntry(CCSm2ZaCache_t *pCache, const CCEcpkiPublKey_t *pPubKey, size_t idlen)
+{
+    return &pCache->pEntries[(pPubKey->x[0] ^ pPubKey->y[0] ^ (uint32_t)idlen) % pCache->entriesCount];
+}
+
+/* returns non zero if the entry records the signer */
+static uint32_t Sm2ZaCacheIsMatch(const CCSm2ZaCacheEntry_t *pEntry, const CCEcpkiPublKey_t *pPubKey,
+                                  const char *pId, size_t idlen)
+{
+    return (pEntry->isValid != 0) &&
+           (pEntry->idSize == idlen) &&
+           (CC_PalMemCmp(pEntry->id, pId, idlen) == 0) &&
+           (CC_PalMemCmp(pEntry->pubKeyX, pPubKey->x, sizeof(pEntry->pubKeyX)) == 0) &&
+           (CC_PalMemCmp(pEntry->pubKeyY, pPubKey->y, sizeof(pEntry->pubKeyY)) == 0);
+}
+
+/* copies the cached ZA of the signer and counts the hit or miss */
+static CCError_t Sm2ZaCacheLookup(CCSm2ZaCache_t *pCache, const CCEcpkiPublKey_t *pPubKey,
+                                  const char *pId, size_t idlen, uint8_t *pZa, uint32_t *pIsHit)
+{
+    CCError_t err;
+    CCSm2ZaCacheEntry_t *pEntry;
+
+    SM2_ZA_CACHE_LOCK();
+
+    err = Sm2ZaCacheCheck(pCache);
+    if (err != CC_OK) {
+        goto End;
+    }
+
+    *pIsHit = 0;
+    if (idlen <= CC_SM2_ZA_CACHE_ID_MAX_SIZE_IN_BYTES) {
+        pEntry = Sm2ZaCacheEntry(pCache, pPubKey, idlen);
+        if (Sm2ZaCacheIsMatch(pEntry, pPubKey, pId, idlen)) {
+            CC_PalMemCopy(pZa, pEntry->za, CC_SM3_RESULT_SIZE_IN_BYTES);
+            *pIsHit = 1;
+        }
+    }
+
+    if (*pIsHit) {
+        pCache->hitsCount++;
+    } else {
+        pCache->missesCount++;
+    }
+
+End:
+    SM2_ZA_CACHE_UNLOCK();
+    return err;
+}
+
+/* records the ZA of the signer, replacing the signer of its entry */
+static void Sm2ZaCacheInsert(CCSm2ZaCache_t *pCache, const CCEcpkiPublKey_t *pPubKey,
+                             const char *pId, size_t idlen, const uint8_t *pZa)
+{
+    CCSm2ZaCacheEntry_t *pEntry;
+
+    if (idlen > CC_SM2_ZA_CACHE_ID_MAX_SIZE_IN_BYTES) {
+        return;
+    }
+
+    SM2_ZA_CACHE_LOCK();
+
+    /* the cache may have been freed while ZA was computed */
+    if (Sm2ZaCacheCheck(pCache) == CC_OK) {
+        pEntry = Sm2ZaCacheEntry(pCache, pPubKey, idlen);
+        CC_PalMemSetZero(pEntry, sizeof(CCSm2ZaCacheEntry_t));
+        pEntry->idSize = (uint32_t)idlen;
+        CC_PalMemCopy(pEntry->id, pId, idlen);
+        CC_PalMemCopy(pEntry->pubKeyX, pPubKey->x, sizeof(pEntry->pubKeyX));
+        CC_PalMemCopy(pEntry->pubKeyY, pPubKey->y, sizeof(pEntry->pubKeyY));
+        CC_PalMemCopy(pEntry->za, pZa, CC_SM3_RESULT_SIZE_IN_BYTES);
+        pEntry->isValid = 1;
+    }
+
+    SM2_ZA_CACHE_UNLOCK();
+}
+
+/* computes ZA = SM3(ENTL || ID || a || b || xG || yG || xA || yA) by SM3 Init/Update/Finish,
+   with the ID hashed in place */
+static CCError_t Sm2ZaCompute(const CCEcpkiPublKey_t *pPubKey, const char *pId, size_t idlen, uint8_t *pZa)
+{
+    CCError_t err;
+    CCSm3UserContext_t sm3Context;
+    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain();
+    size_t modSizeInBytes = CALC_FULL_BYTES(pDomain->modSizeInBits);
+    uint8_t entl[2];
+    uint8_t fields[6*CC_SM2_MODULE_LENGTH_IN_BYTES];
+    size_t idlenInBits = idlen * CC_BITS_IN_BYTE;
+
+    entl[0] = (uint8_t)(idlenInBits >> CC_BITS_IN_BYTE);
+    entl[1] = (uint8_t)idlenInBits;
+
+    CC_CommonReverseMemcpy(fields,                      (uint8_t*)pDomain->ecA, modSizeInBytes);
+    CC_CommonReverseMemcpy(fields +     modSizeInBytes, (uint8_t*)pDomain->ecB, modSizeInBytes);
+    CC_CommonReverseMemcpy(fields + 2 * modSizeInBytes, (uint8_t*)pDomain->ecGx, modSizeInBytes);
+    CC_CommonReverseMemcpy(fields + 3 * modSizeInBytes, (uint8_t*)pDomain->ecGy, modSizeInBytes);
+    CC_CommonReverseMemcpy(fields + 4 * modSizeInBytes, (uint8_t*)pPubKey->x, modSizeInBytes);
+    CC_CommonReverseMemcpy(fields + 5 * modSizeInBytes, (uint8_t*)pPubKey->y, modSizeInBytes);
+
+    if (CC_OK != (err = CC_Sm3Init(&sm3Context)))
+        goto End;
+    if (CC_OK != (err = CC_Sm3Update(&sm3Context, entl, sizeof(entl))))
+        goto End;
+    if (CC_OK != (err = CC_Sm3Update(&sm3Context, (uint8_t*)pId, idlen)))
+        goto End;
+    if (CC_OK != (err = CC_Sm3Update(&sm3Context, fields, 6 * modSizeInBytes)))
+        goto End;
+    err = CC_Sm3Finish(&sm3Context, pZa);
+
+End:
+    CC_PalMemSetZero(&sm3Context, sizeof(sm3Context));
+    return err;
+}
+
+/* computes the SM3 digest of the private key, which binds the key to a signer */
+static CCError_t Sm2PrivKeyDigest(const CCEcpkiUserPrivKey_t *pSm2PrivKey, uint8_t *pDigest)
+{
+    const CCEcpkiPrivKey_t *pPrivKey = (const CCEcpkiPrivKey_t *)pSm2PrivKey->PrivKeyDbBuff;
+
+    return CC_Sm3((uint8_t*)pPrivKey->PrivKey, CC_SM2_ORDER_LENGTH_IN_WORDS*sizeof(uint32_t), pDigest);
+}
+
+/* checks that the private key is the private key of the public key: Q = d*G */
+static CCError_t Sm2KeyPairCheck(const CCEcpkiPublKey_t *pPubKey, const CCEcpkiUserPrivKey_t *pSm2PrivKey)
+{
+    CCError_t err;
+    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain();
+    const CCEcpkiPrivKey_t *pPrivKey = (const CCEcpkiPrivKey_t *)pSm2PrivKey->PrivKeyDbBuff;
+    uint32_t pointX[CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS];
+    uint32_t pointY[CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS];
+    uint32_t tmpBuff[CC_PKA_ECPKI_SCALAR_MUL_BUFF_MAX_LENGTH_IN_WORDS];
+
+    err = PkaEcWrstScalarMultBase(pDomain, pPrivKey->PrivKey, CC_SM2_ORDER_LENGTH_IN_WORDS,
+                                  pointX, pointY, tmpBuff);
+    if ((err != CC_OK) ||
+        (CC_PalMemCmp(pointX, pPubKey->x, CC_SM2_MODULE_LENGTH_IN_WORDS*sizeof(uint32_t)) != 0) ||
+        (CC_PalMemCmp(pointY, pPubKey->y, CC_SM2_MODULE_LENGTH_IN_WORDS*sizeof(uint32_t)) != 0)) {
+        err = CC_ECPKI_SM2_SIGNER_KEY_MISMATCH;
+    }
+
+    CC_PalMemSetZero(tmpBuff, sizeof(tmpBuff));
+    return err;
+}
+
+/* checks the prepared signer */
+static CCError_t Sm2SignerCheck(const CCSm2Signer_t *pSigner)
+{
+    if (pSigner == NULL) {
+        return CC_ECPKI_SM2_INVALID_SIGNER_PTR;
+    }
+    if (pSigner->validTag != CC_SM2_SIGNER_VALIDATION_TAG) {
+        return CC_ECPKI_SM2_INVALID_SIGNER;
+    }
+    return CC_OK;
+}
+
+/******************************************************************************************/
+/************************         Public Functions           ******************************/
+/******************************************************************************************/
+
+CEXPORT_C CCError_t CC_Sm2ZaCacheInit(CCSm2ZaCache_t *pCache,
+                                      CCSm2ZaCacheEntry_t *pEntries,
+                                      uint32_t entriesCount)
+{
+    if (pCache == NULL) {
+        return CC_ECPKI_SM2_INVALID_ZA_CACHE_PTR;
+    }
+    if (pEntries == NULL) {
+        return CC_ECPKI_SM2_INVALID_IN_PARAM_PTR;
+    }
+    if (entriesCount == 0) {
+        return CC_ECPKI_SM2_INVALID_ZA_CACHE_ENTRIES_COUNT;
+    }
+
+    SM2_ZA_CACHE_LOCK();
+
+    CC_PalMemSetZero(pEntries, entriesCount*sizeof(CCSm2ZaCacheEntry_t));
+    CC_PalMemSetZero(pCache, sizeof(CCSm2ZaCache_t));
+    pCache->pEntries = pEntries;
+    pCache->entriesCount = entriesCount;
+    pCache->validTag = CC_SM2_ZA_CACHE_VALIDATION_TAG;
+
+    SM2_ZA_CACHE_UNLOCK();
+
+    return CC_OK;
+}
+
+CEXPORT_C CCError_t CC_Sm2ZaCacheStatsGet(CCSm2ZaCache_t *pCache,
+                                          uint32_t *pHitsCount,
+                                          uint32_t *pMissesCount)
+{
+    CCError_t err;
+
+    if (pCache == NULL) {
+        return CC_ECPKI_SM2_INVALID_ZA_CACHE_PTR;
+    }
+    if ((pHitsCount == NULL) || (pMissesCount == NULL)) {
+        return CC_ECPKI_SM2_INVALID_OUT_PARAM_PTR;
+    }
+
+    SM2_ZA_CACHE_LOCK();
+
+    err = Sm2ZaCacheCheck(pCache);
+    if (err == CC_OK) {
+        *pHitsCount = pCache->hitsCount;
+        *pMissesCount = pCache->missesCount;
+    }
+
+    SM2_ZA_CACHE_UNLOCK();
+    return err;
+}
+
+CEXPORT_C CCError_t CC_Sm2ZaCacheFree(CCSm2ZaCache_t *pCache)
+{
+    CCError_t err;
+
+    if (pCache == NULL) {
+        return CC_ECPKI_SM2_INVALID_ZA_CACHE_PTR;
+    }
+
+    SM2_ZA_CACHE_LOCK();
+
+    err = Sm2ZaCacheCheck(pCache);
+    if (err == CC_OK) {
+        CC_PalMemSetZero(pCache->pEntries, pCache->entriesCount*sizeof(CCSm2ZaCacheEntry_t));
+        CC_PalMemSetZero(pCache, sizeof(CCSm2ZaCache_t));
+    }
+
+    SM2_ZA_CACHE_UNLOCK();
+    return err;
+}
+
+CEXPORT_C CCError_t CC_Sm2SignerInit(CCSm2ZaCache_t *pCache,
+                                     const CCEcpkiUserPublKey_t *pUserPublKey,
+                                     const char *pId,
+                                     const size_t idlen,
+                                     const CCEcpkiUserPrivKey_t *pSm2PrivKey,
+                                     CCSm2Signer_t *pSigner)
+{
+    CCError_t err = CC_OK;
+    const CCEcpkiPublKey_t *pPubKey;
+    uint32_t isHit = 0;
+    uint32_t regVal;
+
+    if (pUserPublKey == NULL) {
+        return CC_ECDSA_VERIFY_INVALID_SIGNER_PUBL_KEY_PTR_ERROR;
+    }
+    if (pUserPublKey->valid_tag != CC_ECPKI_PUBL_KEY_VALIDATION_TAG) {
+        return CC_ECDSA_VERIFY_SIGNER_PUBL_KEY_VALIDATION_TAG_ERROR;
+    }
+    if (pId == NULL) {
+        return CC_ECPKI_SM2_INVALID_ID_PTR;
+    }
+    if ((idlen == 0) || (idlen > CC_SM2_MAX_ID_LEN_IN_BYTES)) {
+        return CC_ECPKI_SM2_INVALID_ID_SIZE;
+    }
+    if ((pSm2PrivKey != NULL) && (pSm2PrivKey->valid_tag != CC_ECPKI_PRIV_KEY_VALIDATION_TAG)) {
+        return CC_ECDSA_SIGN_USER_PRIV_KEY_VALIDATION_TAG_ERROR;
+    }
+    if (pSigner == NULL) {
+        return CC_ECPKI_SM2_INVALID_SIGNER_PTR;
+    }
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_ECPKI_SM2_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_ECPKI_SM2_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+    CC_PalMemSetZero(pSigner, sizeof(CCSm2Signer_t));
+    pPubKey = (const CCEcpkiPublKey_t *)pUserPublKey->PublKeyDbBuff;
+
+    /* bind the private key: a signer signs only with the private key of its public key */
+    if (pSm2PrivKey != NULL) {
+        err = Sm2KeyPairCheck(pPubKey, pSm2PrivKey);
+        if (err == CC_OK) {
+            err = Sm2PrivKeyDigest(pSm2PrivKey, pSigner->privKeyDigest);
+        }
+        if (err != CC_OK) {
+            CC_PalMemSetZero(pSigner, sizeof(CCSm2Signer_t));
+            return err;
+        }
+        pSigner->isPrivKeyBound = 1;
+    }
+
+    if (pCache != NULL) {
+        err = Sm2ZaCacheLookup(pCache, pPubKey, pId, idlen, pSigner->za, &isHit);
+        if (err != CC_OK) {
+            return err;
+        }
+    }
+
+    if (!isHit) {
+        err = Sm2ZaCompute(pPubKey, pId, idlen, pSigner->za);
+        if (err != CC_OK) {
+            CC_PalMemSetZero(pSigner, sizeof(CCSm2Signer_t));
+            return err;
+        }
+        if (pCache != NULL) {
+            Sm2ZaCacheInsert(pCache, pPubKey, pId, idlen, pSigner->za);
+        }
+    }
+
+    CC_PalMemCopy(&pSigner->pubKey, pUserPublKey, sizeof(CCEcpkiUserPublKey_t));
+    pSigner->validTag = CC_SM2_SIGNER_VALIDATION_TAG;
+
+    return CC_OK;
+}
+
+CEXPORT_C CCError_t CC_Sm2SignWithSigner(CCRndGenerateVectWorkFunc_t f_rng,
+                                         void *p_rng,
+                                         const CCSm2Signer_t *pSigner,
+                                         const CCEcpkiUserPrivKey_t *pSm2PrivKey,
+                                         const uint8_t *pMsg,
+                                         const size_t msglen,
+                                         uint8_t *pSignatureOut,
+                                         size_t *pSignatureOutSize)
+{
+    CCError_t err;
+    uint32_t msgDigest[CC_SM3_RESULT_SIZE_IN_WORDS];
+    size_t msgDigestSize = CC_SM3_RESULT_SIZE_IN_WORDS;
+    CCSm3ResultBuf_t privKeyDigest;
+
+    err = Sm2SignerCheck(pSigner);
+    if (err != CC_OK) {
+        return err;
+    }
+    if (pSm2PrivKey == NULL) {
+        return CC_ECDSA_SIGN_INVALID_USER_PRIV_KEY_PTR_ERROR;
+    }
+    if (pSm2PrivKey->valid_tag != CC_ECPKI_PRIV_KEY_VALIDATION_TAG) {
+        return CC_ECDSA_SIGN_USER_PRIV_KEY_VALIDATION_TAG_ERROR;
+    }
+
+    /* sign only with the private key bound to the signer */
+    if (pSigner->isPrivKeyBound == 0) {
+        return CC_ECPKI_SM2_SIGNER_KEY_MISMATCH;
+    }
+    err = Sm2PrivKeyDigest(pSm2PrivKey, privKeyDigest);
+    if (err != CC_OK) {
+        return err;
+    }
+    if (CC_PalMemCmp(privKeyDigest, pSigner->privKeyDigest, CC_SM3_RESULT_SIZE_IN_BYTES) != 0) {
+        return CC_ECPKI_SM2_SIGNER_KEY_MISMATCH;
+    }
+
+    err = Sm2ComputeMessageFromIdDigest(pSigner->za, CC_SM3_RESULT_SIZE_IN_BYTES,
+                                        pMsg, msglen, msgDigest, &msgDigestSize);
+    if (err != CC_OK) {
+        return err;
+    }
+
+    return CC_Sm2Sign(f_rng, p_rng, pSm2PrivKey,
+                      msgDigest, msgDigestSize,
+                      pSignatureOut, pSignatureOutSize);
+}
+
+CEXPORT_C CCError_t CC_Sm2VerifyWithSigner(const CCSm2Signer_t *pSigner,
+                                           uint8_t *pSignatureIn,
+                                           const size_t SignatureSizeBytes,
+                                           const uint8_t *pMsg,
+                                           const size_t msglen)
+{
+    CCError_t err;
+    uint32_t msgDigest[CC_SM3_RESULT_SIZE_IN_WORDS];
+    size_t msgDigestSize = CC_SM3_RESULT_SIZE_IN_WORDS;
+
+    err = Sm2SignerCheck(pSigner);
+    if (err != CC_OK) {
+        return err;
+    }
+
+    err = Sm2ComputeMessageFromIdDigest(pSigner->za, CC_SM3_RESULT_SIZE_IN_BYTES,
+                                        pMsg, msglen, msgDigest, &msgDigestSize);
+    if (err != CC_OK) {
+        return err;
+    }
+
+    return CC_Sm2Verify(&pSigner->pubKey, pSignatureIn, SignatureSizeBytes,
+                        msgDigest, msgDigestSize);
+}
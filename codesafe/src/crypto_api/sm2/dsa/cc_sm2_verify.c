@@ -19,37 +19,26 @@
 #include "cc_util_int_defs.h"
 
 /**************************************************************************
-*                   CC_Sm2Verify
+*                   Sm2VerifyParamsConvert
 **************************************************************************/
 /*!
-@brief This function performs an SM2 verify operation in integrated form.
-Algorithm according to the Public key cryptographic algorithm SM2 based on
-elliptic curves. Part 2: Digital signature algorithm
-
-The message data is a digest of a hash function.
+@brief Checks the parameters of an SM2 verify operation and converts the message hash and the signature
+to words arrays with LE order of words.
 
 @return CC_OK on success.
-@return A non-zero value on failure as defined cc_ecpki_error.h or cc_hash_error.h.
-@param[in] Pointer to a user public key structure.
-@param[in] Pointer to the signature to be verified.
-@param[in] Size of the signature (in bytes).
-@param[in] Pointer to the hash of the input data that was signed
-@param[in] Size of the hash of the input data (in words).
+@return A non-zero value on failure as defined cc_ecpki_error.h.
 */
-
-CIMPORT_C CCError_t CC_Sm2Verify (
+static CCError_t Sm2VerifyParamsConvert (
     const CCEcpkiUserPublKey_t  *pUserPublKey,
     uint8_t                     *pSignatureIn,
     const size_t                SignatureSizeBytes,
     const uint32_t              *pMessageHash,
-    const size_t                HashInputSize
+    const size_t                HashInputSize,
+    uint32_t                    *pWorkingContext    /* CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS*3 words: R, S and the message representative */
 )
 {
     CCError_t err = CC_OK;
-    uint32_t pWorkingContext[CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS*3];
     const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain(); /* Currently the standard specifies only one possible domain for SM2. */
-    CCEcpkiPublKey_t  *PublKey_ptr;
-    uint32_t regVal;
     uint32_t    *pMessRepres, *pSignatureR, *pSignatureS;
     size_t      orderSizeInBits, orderSizeInBytes, orderSizeInWords;
 
@@ -81,18 +70,6 @@ CIMPORT_C CCError_t CC_Sm2Verify (
         goto End;
     }
 
-    /* The function should refuse to operate if the secure disable bit is set */
-    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
-    if (regVal == SECURE_DISABLE_FLAG_SET) {
-        return CC_ECPKI_SM2_SD_ENABLED_ERR;
-    }
-
-    /* The function should refuse to operate if the Fatal Error bit is set */
-    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
-    if (regVal == FATAL_ERROR_FLAG_SET) {
-        return CC_ECPKI_SM2_FATAL_ERR_IS_LOCKED_ERR;
-    }
-
     /* Currently there is only one possible domain. This assignment is constant.
      * In the future we may have more than one domain. */
     orderSizeInBits     = pDomain->ordSizeInBits;
@@ -117,9 +94,6 @@ CIMPORT_C CCError_t CC_Sm2Verify (
     pSignatureS = pSignatureR + orderSizeInWords; /* Max lengths of C in whole words */
     pMessRepres = pSignatureS + orderSizeInWords;
 
-    PublKey_ptr = (CCEcpkiPublKey_t *)&pUserPublKey->PublKeyDbBuff;
-
-
     // Check shortened cleaning    /* Clean memory  */
     CC_PalMemSetZero(pSignatureR, 2*sizeof(uint32_t)*orderSizeInWords);
     CC_PalMemSetZero(pMessRepres, CC_SM3_RESULT_SIZE_IN_BYTES);
@@ -132,11 +106,75 @@ CIMPORT_C CCError_t CC_Sm2Verify (
     CC_CommonReverseMemcpy((uint8_t*)pSignatureR, pSignatureIn, orderSizeInBytes);
     pSignatureS[orderSizeInWords-1] = 0;
     CC_CommonReverseMemcpy((uint8_t*)pSignatureS, pSignatureIn + orderSizeInBytes, orderSizeInBytes);
+End:
+    return err;
+}
+
+/**************************************************************************
+*                   CC_Sm2Verify
+**************************************************************************/
+/*!
+@brief This function performs an SM2 verify operation in integrated form.
+Algorithm according to the Public key cryptographic algorithm SM2 based on
+elliptic curves. Part 2: Digital signature algorithm
+
+The message data is a digest of a hash function.
+
+@return CC_OK on success.
+@return A non-zero value on failure as defined cc_ecpki_error.h or cc_hash_error.h.
+@param[in] Pointer to a user public key structure.
+@param[in] Pointer to the signature to be verified.
+@param[in] Size of the signature (in bytes).
+@param[in] Pointer to the hash of the input data that was signed
+@param[in] Size of the hash of the input data (in words).
+*/
+
+CIMPORT_C CCError_t CC_Sm2Verify (
+    const CCEcpkiUserPublKey_t  *pUserPublKey,
+    uint8_t                     *pSignatureIn,
+    const size_t                SignatureSizeBytes,
+    const uint32_t              *pMessageHash,
+    const size_t                HashInputSize
+)
+{
+    CCError_t err = CC_OK;
+    uint32_t pWorkingContext[CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS*3];
+    uint32_t tempBuff[EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS];
+    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain(); /* Currently the standard specifies only one possible domain for SM2. */
+    CCEcpkiPublKey_t  *PublKey_ptr;
+    uint32_t regVal;
+    uint32_t    *pMessRepres, *pSignatureR, *pSignatureS;
+    size_t      orderSizeInWords;
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_ECPKI_SM2_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_ECPKI_SM2_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+    err = Sm2VerifyParamsConvert(pUserPublKey, pSignatureIn, SignatureSizeBytes,
+                                 pMessageHash, HashInputSize, pWorkingContext);
+    if (err != CC_OK) {
+        goto End;
+    }
+
+    orderSizeInWords = CALC_FULL_32BIT_WORDS(pDomain->ordSizeInBits);
+    pSignatureR = pWorkingContext;
+    pSignatureS = pSignatureR + orderSizeInWords;
+    pMessRepres = pSignatureS + orderSizeInWords;
+
+    PublKey_ptr = (CCEcpkiPublKey_t *)&pUserPublKey->PublKeyDbBuff;
 
     /*------------------------------*/
     /* Verifying operation          */
     /*------------------------------*/
-    err =  EcWrstSm2Verify(PublKey_ptr, pMessRepres, orderSizeInWords, pSignatureR, pSignatureS);
+    err =  EcWrstSm2Verify(PublKey_ptr, pMessRepres, orderSizeInWords, pSignatureR, pSignatureS, tempBuff);
 
     if (err != CC_OK) {
         err = CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR;
@@ -144,10 +182,92 @@ CIMPORT_C CCError_t CC_Sm2Verify (
     }
 End:
     /* clear the users context  */
-    CC_PalMemSetZero(pWorkingContext, CC_PKA_ECDSA_VERIFY_BUFF_MAX_LENGTH_IN_WORDS);
+    CC_PalMemSetZero(pWorkingContext, sizeof(pWorkingContext));
     return err;
 }/* END OF CC_Sm2Verify */
 
 
+/**************************************************************************
+*                   CC_Sm2VerifyBatch
+**************************************************************************/
+/*!
+@brief This function verifies a batch of SM2 signatures in a single PKA session.
+
+@return CC_OK if all the signatures are valid.
+@return CC_ECPKI_SM2_BATCH_ITEM_FAILED if any item failed, the result of each item is set in pResults.
+@return A non-zero value on failure as defined cc_ecpki_error.h.
+*/
+
+CIMPORT_C CCError_t CC_Sm2VerifyBatch (
+    const CCSm2VerifyBatchItem_t    *pItems,
+    const size_t                    itemsCount,
+    CCError_t                       *pResults
+)
+{
+    CCError_t err = CC_OK;
+    CCError_t itemErr;
+    uint32_t pWorkingContext[CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS*3];
+    uint32_t tempBuff[EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS];
+    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain(); /* Currently the standard specifies only one possible domain for SM2. */
+    uint32_t pkaReqRegs = 0;
+    uint32_t regVal;
+    uint32_t    *pMessRepres, *pSignatureR, *pSignatureS;
+    size_t      orderSizeInWords;
+    size_t      i;
+
+    if ((pItems == NULL) || (pResults == NULL)) {
+        err = CC_ECPKI_SM2_INVALID_BATCH_PTR;
+        goto End;
+    }
+
+    if ((itemsCount == 0) || (itemsCount > CC_SM2_BATCH_MAX_ITEMS_COUNT)) {
+        err = CC_ECPKI_SM2_INVALID_BATCH_ITEMS_COUNT;
+        goto End;
+    }
 
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_ECPKI_SM2_SD_ENABLED_ERR;
+    }
 
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_ECPKI_SM2_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+    orderSizeInWords = CALC_FULL_32BIT_WORDS(pDomain->ordSizeInBits);
+    pSignatureR = pWorkingContext;
+    pSignatureS = pSignatureR + orderSizeInWords;
+    pMessRepres = pSignatureS + orderSizeInWords;
+
+    err = EcWrstSm2PkaSessionStart(&pkaReqRegs);
+    if (err != CC_OK) {
+        goto End;
+    }
+
+    /* every item loads its own data into the PKA, so that a failed item does not affect the next ones */
+    for (i = 0; i < itemsCount; i++) {
+        itemErr = Sm2VerifyParamsConvert(pItems[i].pUserPublKey, pItems[i].pSignatureIn, pItems[i].SignatureSizeBytes,
+                                         pItems[i].pHashInput, pItems[i].HashInputSize, pWorkingContext);
+        if (itemErr == CC_OK) {
+            itemErr = EcWrstSm2VerifyInSession((CCEcpkiPublKey_t *)&pItems[i].pUserPublKey->PublKeyDbBuff,
+                                               pMessRepres, orderSizeInWords, pSignatureR, pSignatureS, tempBuff);
+            if (itemErr != CC_OK) {
+                itemErr = CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR;
+            }
+        }
+
+        pResults[i] = itemErr;
+        if (itemErr != CC_OK) {
+            err = CC_ECPKI_SM2_BATCH_ITEM_FAILED;
+        }
+    }
+
+    EcWrstSm2PkaSessionFinish(pkaReqRegs);
+End:
+    /* clear the users context  */
+    CC_PalMemSetZero(pWorkingContext, sizeof(pWorkingContext));
+    return err;
+}/* END OF CC_Sm2VerifyBatch */
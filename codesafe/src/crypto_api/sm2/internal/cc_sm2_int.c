@@ -26,8 +26,7 @@ extern const int8_t regTemps[PKA_MAX_COUNT_OF_PHYS_MEM_REGS];
 /* Local defintions */
 #define CT_LEN_IN_BYTES             4
 #define KDF_BUF_MAX_LEN_IN_BYTES    2 * CC_SM3_RESULT_SIZE_IN_BYTES +  \
-                                    2 * CC_SM2_ORDER_LENGTH_IN_BYTES + \
-                                    CT_LEN_IN_BYTES
+                                    2 * CC_SM2_ORDER_LENGTH_IN_BYTES
 
 
 /***********      Sm2CalcSignature function      **********************/
@@ -146,18 +145,17 @@ End:
  ******************************************************************************/
 /*!
 @brief This function gets as an input the digest of id and calculates message digest.
+The id digest and the message are hashed in place by SM3 Init/Update/Finish, so neither is copied.
 
-    @param[in] id as a string.
-    @param[in] id length in bytes.
+    @param[in] A pointer to the id digest.
+    @param[in] The id digest length in bytes.
     @param[in] A pointer to the message.
     @param[in] The message size in bytes.
-    @param[in] The Working_buffer
-    @param[in] The working buffer size should be at least idhlen + msglen
     @param[out] The output buffer.
     @param[out] The size of the output buffer in words.
 
 @return CC_OK on success.
-@return a non-zero value on failure as defined cc_ecpki_error.h or cc_hash_error.h.
+@return a non-zero value on failure as defined cc_ecpki_error.h or cc_sm3_error.h.
 */
 
 /******************************************************************************/
@@ -166,14 +164,12 @@ CCError_t Sm2ComputeMessageFromIdDigest (
         const size_t                idhlen,         /*!< [in]        - The size of the id digest in bytes. */
         const uint8_t               *msg,           /*!< [in]        - A pointer to the message. */
         const size_t                msglen,         /*!< [in]        - The size of the message in bytes. */
-        uint8_t                     *working_buffer,/*!< [in]        - The working buffer */
-        const size_t                wblen,          /*!< [in]        - The working buffer size should be at least idhlen + msglen*/
         uint32_t                    *out,           /*!< [out]       - A pointer to a buffer for the output. */
         size_t                      *outlen         /*!< [in/out]    - output length in words. */
 )
 {
     CCError_t err = CC_OK;
-    size_t blen = 0;
+    CCSm3UserContext_t sm3Context;
 
 
     if ( NULL == idh ){
@@ -196,11 +192,6 @@ CCError_t Sm2ComputeMessageFromIdDigest (
         goto End;
     }
 
-    if ( NULL == working_buffer ) {
-        err = CC_ECPKI_GEN_KEY_INVALID_TEMP_DATA_PTR_ERROR;
-        goto End;
-    }
-
     if ( NULL == out ) {
         err = CC_ECPKI_INVALID_OUT_HASH_PTR_ERROR;
         goto End;
@@ -211,25 +202,21 @@ CCError_t Sm2ComputeMessageFromIdDigest (
         goto End;
     }
 
-    blen = msglen + idhlen;
-    if ( wblen < blen ) {
-        err = CC_ECPKI_GEN_KEY_INVALID_TEMP_DATA_PTR_ERROR;
+    /* the id digest is half an SM3 block: it stays in the context until the message completes the block */
+    if (CC_OK != (err = CC_Sm3Init(&sm3Context)))
         goto End;
-    }
-
-    CC_PalMemSetZero(working_buffer, blen);
-    CC_PalMemCopy( working_buffer, idh, idhlen);
-    CC_PalMemCopy( working_buffer+idhlen, msg, msglen);
-
-    if (CC_OK != (err = CC_Sm3(working_buffer, blen, (uint8_t*)out)))
+    if (CC_OK != (err = CC_Sm3Update(&sm3Context, (uint8_t*)idh, idhlen)))
+        goto End;
+    if (CC_OK != (err = CC_Sm3Update(&sm3Context, (uint8_t*)msg, msglen)))
+        goto End;
+    if (CC_OK != (err = CC_Sm3Finish(&sm3Context, (uint8_t*)out)))
         goto End;
 
     CC_CommonConvertLsbMsbBytesToLswMswWords (out, (uint8_t*)out, *outlen * 4);
     *outlen = CC_SM3_RESULT_SIZE_IN_WORDS;
 
 End:
-    if (NULL != working_buffer)
-        CC_PalMemSet(working_buffer, 0, wblen);
+    CC_PalMemSetZero(&sm3Context, sizeof(sm3Context));
     return err;
 }
 
@@ -406,27 +393,24 @@ End:
 }
 
 /******************************************************************************
- *                Sm2CalcKdfBlock
+ *                Sm2KdfPrefixInit
  ******************************************************************************/
 /*!
-@brief This function calculates the kdf block number ct.
+@brief This function hashes the prefix xV || yV || ZA || ZB, common to all kdf blocks,
+       into an SM3 context.
 
     @param[in] A pointer to the key exchange context
-    @param[in] value for concatenation.
-    @param[out] The output buffer.
-    @param[out] The size of the output buffer in bytes.
+    @param[out] The SM3 context of the prefix.
 
 @return a non-zero value on failure@return CC_OK on success.
 */
 /******************************************************************************/
-CCError_t Sm2CalcKdfBlock (
+CCError_t Sm2KdfPrefixInit (
         const CC_Sm2KeContext_t     *pSm2KeContext,     /*!< [in]        - A pointer to the key exchange context*/
-        const uint32_t              ct,
-        uint8_t                     *digest,            /*!< [out]       - The kdf block*/
-        size_t                      *dsize              /*!< [in/out]    - The kdf block size*/
+        CCSm3UserContext_t          *pPrefixCtx         /*!< [out]       - The SM3 context of the prefix*/
 )
 {
-    /* Hash(xV || yV || ZA || ZB || ct) */
+    /* Hash(xV || yV || ZA || ZB ... */
     CCError_t                   err = CC_OK;
     size_t                      ordSizeInBytes = 0;
     size_t                      zSizeInBytes = 0;
@@ -441,10 +425,8 @@ CCError_t Sm2CalcKdfBlock (
         goto End;
     }
 
-    if ( NULL == digest ||
-         NULL == dsize  ||
-         *dsize < CC_SM3_RESULT_SIZE_IN_BYTES) {
-        err = CC_ECPKI_INVALID_OUT_HASH_PTR_ERROR;
+    if ( NULL == pPrefixCtx ) {
+        err = CC_ECPKI_SM2_INVALID_IN_PARAM_PTR;
         goto End;
     }
 
@@ -453,7 +435,7 @@ CCError_t Sm2CalcKdfBlock (
     ordSizeInBytes = CALC_FULL_BYTES(pDomain->ordSizeInBits);
     zSizeInBytes = pSm2KeContext->Z_value_size;
     /* Calculate the actual buffer size to be digested */
-    wblen = 2 * ordSizeInBytes + 2 * zSizeInBytes + CT_LEN_IN_BYTES;
+    wblen = 2 * ordSizeInBytes + 2 * zSizeInBytes;
     /* verify that the local buffer is sufficient */
     if(wblen > KDF_BUF_MAX_LEN_IN_BYTES) {
         err = CC_ECPKI_TEMP_BUFF_SIZE_ERROR;
@@ -474,15 +456,67 @@ CCError_t Sm2CalcKdfBlock (
         CC_PalMemCopy(working_buffer + ordSizeInBytes*2, pSm2KeContext->Z_remote, zSizeInBytes);
         CC_PalMemCopy(working_buffer + ordSizeInBytes*2 + zSizeInBytes, pSm2KeContext->Z, zSizeInBytes);
     }
-    /* concatenate the ct to the end of the buffer */
-    CC_CommonReverseMemcpy(working_buffer + ordSizeInBytes*2 + zSizeInBytes*2, (uint8_t*)&ct, CT_LEN_IN_BYTES);
-    if (CC_OK != (err = CC_Sm3(working_buffer, wblen, digest))) {
+
+    if (CC_OK != (err = CC_Sm3Init(pPrefixCtx)))
+        goto End;
+    if (CC_OK != (err = CC_Sm3Update(pPrefixCtx, working_buffer, wblen)))
+        goto End;
+
+End:
+    CC_PalMemSet(working_buffer, 0, KDF_BUF_MAX_LEN_IN_BYTES);
+    return err;
+}
+
+/******************************************************************************
+ *                Sm2CalcKdfBlock
+ ******************************************************************************/
+/*!
+@brief This function calculates the kdf block number ct, continuing from a copy of
+       the prefix context set by Sm2KdfPrefixInit.
+
+    @param[in] The SM3 context of the prefix.
+    @param[in] value for concatenation.
+    @param[out] The output buffer.
+    @param[out] The size of the output buffer in bytes.
+
+@return a non-zero value on failure@return CC_OK on success.
+*/
+/******************************************************************************/
+CCError_t Sm2CalcKdfBlock (
+        const CCSm3UserContext_t    *pPrefixCtx,        /*!< [in]        - The SM3 context of the prefix*/
+        const uint32_t              ct,
+        uint8_t                     *digest,            /*!< [out]       - The kdf block*/
+        size_t                      *dsize              /*!< [in/out]    - The kdf block size*/
+)
+{
+    /* Hash(xV || yV || ZA || ZB || ct) */
+    CCError_t                   err = CC_OK;
+    CCSm3UserContext_t          sm3Context;
+    uint8_t                     ctBuff[CT_LEN_IN_BYTES];
+
+    if ( NULL == pPrefixCtx ) {
+        err = CC_ECPKI_SM2_INVALID_IN_PARAM_PTR;
+        goto End;
+    }
+
+    if ( NULL == digest ||
+         NULL == dsize  ||
+         *dsize < CC_SM3_RESULT_SIZE_IN_BYTES) {
+        err = CC_ECPKI_INVALID_OUT_HASH_PTR_ERROR;
         goto End;
     }
+
+    /* the ct is concatenated to the prefix */
+    CC_PalMemCopy(&sm3Context, pPrefixCtx, sizeof(CCSm3UserContext_t));
+    CC_CommonReverseMemcpy(ctBuff, (uint8_t*)&ct, CT_LEN_IN_BYTES);
+    if (CC_OK != (err = CC_Sm3Update(&sm3Context, ctBuff, CT_LEN_IN_BYTES)))
+        goto End;
+    if (CC_OK != (err = CC_Sm3Finish(&sm3Context, digest)))
+        goto End;
     *dsize = CC_SM3_RESULT_SIZE_IN_BYTES;
 
 End:
-    CC_PalMemSet(working_buffer, 0, KDF_BUF_MAX_LEN_IN_BYTES);
+    CC_PalMemSetZero(&sm3Context, sizeof(sm3Context));
     return err;
 }
 
@@ -576,9 +610,8 @@ CCError_t EcWrstSm2Sign(
 
         /* Calculate ephemeral public key               */
         funcTmpBuff = pMaxVect; /* because pMaxVect not needed yet */
-        err = PkaEcWrstScalarMult(pDomain,
+        err = PkaEcWrstScalarMultBase(pDomain,
                                   pEphemKeyBuf/*scalar*/, ordSizeInWords, /*scalar size*/
-                                  (uint32_t*)&pDomain->ecGx, (uint32_t*)&pDomain->ecGy, /*in point coordinates*/
                                   pEphemPublX/*C*/, pEphemPublY,  /*out point coordinates*/
                                   funcTmpBuff);
         if (err) {
@@ -611,28 +644,55 @@ End:
 }
 
 
-/***********      EcWrstSm2Verify function      **********************/
+/***********      EcWrstSm2PkaSessionStart function      **********************/
 /**
- * @brief Verifies the signature.
+ * @brief Initializes the PKA for SM2 operations and locks the asymmetric mutex.
  *
- * @author yury kreimer (11/18/2018)
+ * The session serves any count of EcWrstSm2VerifyInSession and EcWrstSm2CalculateSharedSecretInSession
+ * calls, which load all their data and sizes, and must be closed by EcWrstSm2PkaSessionFinish.
  *
  * @return  CC_OK On success, otherwise indicates failure
  */
-CCError_t EcWrstSm2Verify(
+CCError_t EcWrstSm2PkaSessionStart(
+    uint32_t  *pPkaReqRegs)             /*!< [out] The count of PKA registers to clear on finish. */
+{
+    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain(); /* Currently the standard specifies only one possible domain for SM2. */
+
+    *pPkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+    return PkaInitAndMutexLock(CC_MAX(pDomain->ordSizeInBits, pDomain->modSizeInBits), pPkaReqRegs);
+}
+
+/***********      EcWrstSm2PkaSessionFinish function      **********************/
+/**
+ * @brief Clears the PKA registers, finishes the PKA and unlocks the asymmetric mutex.
+ *
+ * @return  None
+ */
+void EcWrstSm2PkaSessionFinish(
+    uint32_t  pkaReqRegs)               /*!< [in] The count of PKA registers returned by EcWrstSm2PkaSessionStart. */
+{
+    PkaFinishAndMutexUnlock(pkaReqRegs);
+}
+
+/***********      EcWrstSm2VerifyInSession function      **********************/
+/**
+ * @brief Verifies the signature in an open PKA session.
+ *
+ * @return  CC_OK On success, otherwise indicates failure
+ */
+CCError_t EcWrstSm2VerifyInSession(
     CCEcpkiPublKey_t *pSignPublKey,     /*!< [in] Pointer to signer public key structure. */
     uint32_t  *pMsgRepres,              /*!< [in] The pointer to the message representative buffer.*/
     uint32_t   msgRepresSizeWords,      /*!< [in] Size of the message representative buffer in words.*/
     uint32_t  *pSignR,                  /*!< [in] Pointer to R-part of the signature (called also R-part). */
-    uint32_t  *pSignS)                  /*!< [in] Pointer to S-part of the signature (called also S-part). */
+    uint32_t  *pSignS,                  /*!< [in] Pointer to S-part of the signature (called also S-part). */
+    uint32_t  *pTempBuff)               /*!< [in] Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
 {
     CCError_t err = CC_OK;
-    uint32_t pkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
     const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain(); /* Currently the standard specifies only one possible domain for SM2. */
 
-    EcWrstDomain_t *llfBuff = (EcWrstDomain_t*)&pSignPublKey->domain.llfBuff;
+    EcWrstDomain_t *llfBuff;
     size_t modSizeInBits, modSizeInWords, ordSizeInBits, ordSizeInWords;
-    uint8_t pka_started = 0;
 
 
 
@@ -658,6 +718,8 @@ CCError_t EcWrstSm2Verify(
         goto End;
     }
 
+    llfBuff = (EcWrstDomain_t*)&pSignPublKey->domain.llfBuff;
+
     /* set domain parameters.
      * Currently there is only one possible domain. This assignment is constant.
      * In the future we may have more than one domain. */
@@ -666,12 +728,6 @@ CCError_t EcWrstSm2Verify(
     ordSizeInBits  = pDomain->ordSizeInBits;
     ordSizeInWords = CALC_FULL_32BIT_WORDS(ordSizeInBits);
 
-    err = PkaInitAndMutexLock(CC_MAX(ordSizeInBits, modSizeInBits), &pkaReqRegs);
-    if (err != CC_OK) {
-        goto End;
-    }
-
-    pka_started = 1;
     /* set order and modulus mod sizes */
     CC_HAL_WRITE_REGISTER(CC_REG_OFFSET (CRY_KERNEL, PKA_L0), ordSizeInBits);
     CC_HAL_WRITE_REGISTER(CC_REG_OFFSET (CRY_KERNEL, PKA_L2), modSizeInBits);
@@ -697,13 +753,46 @@ CCError_t EcWrstSm2Verify(
     PkaCopyDataIntoPkaReg(ECC_REG_EC_A, 1, pDomain->ecA, modSizeInWords);
 
     /* Verify */
-    err = PkaSm2EcdsaVerify();
-    if ( CC_OK != err ) {
+    err = PkaSm2EcdsaVerify(pDomain, pTempBuff);
+End:
+    return err;
+}
+
+
+/***********      EcWrstSm2Verify function      **********************/
+/**
+ * @brief Verifies the signature.
+ *
+ * @author yury kreimer (11/18/2018)
+ *
+ * @return  CC_OK On success, otherwise indicates failure
+ */
+CCError_t EcWrstSm2Verify(
+    CCEcpkiPublKey_t *pSignPublKey,     /*!< [in] Pointer to signer public key structure. */
+    uint32_t  *pMsgRepres,              /*!< [in] The pointer to the message representative buffer.*/
+    uint32_t   msgRepresSizeWords,      /*!< [in] Size of the message representative buffer in words.*/
+    uint32_t  *pSignR,                  /*!< [in] Pointer to R-part of the signature (called also R-part). */
+    uint32_t  *pSignS,                  /*!< [in] Pointer to S-part of the signature (called also S-part). */
+    uint32_t  *pTempBuff)               /*!< [in] Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
+{
+    CCError_t err = CC_OK;
+    uint32_t pkaReqRegs = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+
+    /*if the public key object is NULL return an error*/
+    if (pSignPublKey == NULL){
+        err = CC_ECDSA_VERIFY_INVALID_SIGNER_PUBL_KEY_PTR_ERROR;
+        goto End;
+    }
+
+    err = EcWrstSm2PkaSessionStart(&pkaReqRegs);
+    if (err != CC_OK) {
         goto End;
     }
+
+    err = EcWrstSm2VerifyInSession(pSignPublKey, pMsgRepres, msgRepresSizeWords, pSignR, pSignS, pTempBuff);
+
+    EcWrstSm2PkaSessionFinish(pkaReqRegs);
 End:
-    if (pka_started)
-        PkaFinishAndMutexUnlock(pkaReqRegs);
     return err;
 }
 
@@ -792,9 +881,8 @@ CCError_t EcWrstSm2CalculateRandom (
     ordSizeInWords = CALC_FULL_32BIT_WORDS(ordSizeInBits);
     modSizeInWords = CALC_FULL_32BIT_WORDS(pDomain->modSizeInBits);
 
-    err = PkaEcWrstScalarMult(pDomain,
+    err = PkaEcWrstScalarMultBase(pDomain,
                               pEphemKeyBuf/*scalar*/, ordSizeInWords, /*scalar size*/
-                              (uint32_t*)&pDomain->ecGx, (uint32_t*)&pDomain->ecGy, /*in point coordinates*/
                               pRandomPoint->x/*C*/, pRandomPoint->y,  /*out point coordinates*/
                               funcTmpBuff);
     if (CC_OK != err) {
@@ -840,26 +928,25 @@ End:
 }
 
 /**************************************************************************
- *                EcWrstSm2CalculateSharedSecret
+ *                EcWrstSm2CalculateSharedSecretInSession
  * *************************************************************************/
 /*!
 
-@brief Calculates the shared secret
+@brief Calculates the shared secret in an open PKA session
 @return CC_OK on success.
 @return A non-zero value on failure
  */
 
-CCError_t EcWrstSm2CalculateSharedSecret (
+CCError_t EcWrstSm2CalculateSharedSecretInSession (
         const CCEcpkiPublKey_t      *pPublicKey,                /*!< [in]   - A pointer to the public key exchange context.*/
         const CCEcpkiPointAffine_t  *pRandomPoint,              /*!< [in]   - A pointer to the random point from the second party. */
         const CCEcpkiDomain_t       *pDomain,                   /*!< [in]   - A pointer to the domain.    */
         const uint32_t              *t,                         /*!< [in]   - The t value.*/
-        CCEcpkiPointAffine_t        *shared_secret              /*!< [out]  - shared secret output parameter */
-
+        CCEcpkiPointAffine_t        *shared_secret,             /*!< [out]  - shared secret output parameter */
+        uint32_t                    *pTempBuff                  /*!< [in]   - Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
 )
 {
     CCError_t  err                      = CC_OK;
-    uint32_t   pkaReqRegs               = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
     /* define registers (ECC_REG_N=0, ECC_REG_NP=1) */
     uint8_t rTwoToOmegaMinusOne         = regTemps[16]; /*2^w-1 parameter of the domain*/
     uint8_t rTwoToOmega                 = regTemps[17]; /*2^w* parameter of the domain */
@@ -921,11 +1008,9 @@ CCError_t EcWrstSm2CalculateSharedSecret (
     }
 
 
-    /*  Init PKA for operations with EC order */
-    err = PkaInitAndMutexLock(ordSizeInBits , &pkaReqRegs);
-    if (err != CC_OK) {
-        goto End;
-    }
+    /*  Set PKA for operations with EC order */
+    PKA_WAIT_ON_PKA_DONE();
+    CC_HAL_WRITE_REGISTER(CC_REG_OFFSET (CRY_KERNEL, PKA_L0), ordSizeInBits);
 
 
     /*   Set data into PKA registers  */
@@ -988,7 +1073,9 @@ CCError_t EcWrstSm2CalculateSharedSecret (
         rP_remote_y,
         rXbar,
         rRandomPoint_x,
-        rRandomPoint_y
+        rRandomPoint_y,
+        NULL,
+        pTempBuff
     );
 
     if (err != CC_OK) {
@@ -998,8 +1085,48 @@ CCError_t EcWrstSm2CalculateSharedSecret (
     PkaCopyDataFromPkaReg(shared_secret->x, ordSizeInWords, rVx);
     PkaCopyDataFromPkaReg(shared_secret->y, ordSizeInWords, rVy);
 
-    PkaFinishAndMutexUnlock(pkaReqRegs);
 
+End:
+    return err;
+}
+
+
+
+/**************************************************************************
+ *                EcWrstSm2CalculateSharedSecret
+ * *************************************************************************/
+/*!
+
+@brief Calculates the shared secret
+@return CC_OK on success.
+@return A non-zero value on failure
+ */
+
+CCError_t EcWrstSm2CalculateSharedSecret (
+        const CCEcpkiPublKey_t      *pPublicKey,                /*!< [in]   - A pointer to the public key exchange context.*/
+        const CCEcpkiPointAffine_t  *pRandomPoint,              /*!< [in]   - A pointer to the random point from the second party. */
+        const CCEcpkiDomain_t       *pDomain,                   /*!< [in]   - A pointer to the domain.    */
+        const uint32_t              *t,                         /*!< [in]   - The t value.*/
+        CCEcpkiPointAffine_t        *shared_secret,             /*!< [out]  - shared secret output parameter */
+        uint32_t                    *pTempBuff                  /*!< [in]   - Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
+)
+{
+    CCError_t  err                      = CC_OK;
+    uint32_t   pkaReqRegs               = PKA_MAX_COUNT_OF_PHYS_MEM_REGS;
+
+    if (NULL == pDomain) {
+        err = CC_ECPKI_DOMAIN_PTR_ERROR;
+        goto End;
+    }
+
+    err = EcWrstSm2PkaSessionStart(&pkaReqRegs);
+    if (err != CC_OK) {
+        goto End;
+    }
+
+    err = EcWrstSm2CalculateSharedSecretInSession(pPublicKey, pRandomPoint, pDomain, t, shared_secret, pTempBuff);
+
+    EcWrstSm2PkaSessionFinish(pkaReqRegs);
 
 End:
     return err;
@@ -1019,7 +1146,9 @@ End:
  *
  * @return  - On success CC_OK is returned, on failure an error code.
  */
-CCError_t PkaSm2EcdsaVerify(void)
+CCError_t PkaSm2EcdsaVerify(const CCEcpkiDomain_t *pDomain, /*!< [in] Pointer to EC domain. */
+                            uint32_t *pTempBuff)            /*!< [in] Temporary buffer of
+                                                                  EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
 {
     CCError_t err = CC_OK;
     int32_t modSizeInBits, ordSizeInBits;
@@ -1088,7 +1217,9 @@ CCError_t PkaSm2EcdsaVerify(void)
                              EC_VERIFY_REG_P_GY,
                              EC_VERIFY_REG_H2,
                              EC_VERIFY_REG_P_WX,
-                             EC_VERIFY_REG_P_WY);
+                             EC_VERIFY_REG_P_WY,
+                             pDomain,
+                             pTempBuff);
     if(err)
         goto End;
 
@@ -21,6 +21,7 @@
 #include "cc_rnd_common.h"
 #include "cc_sm3_defs.h"
 #include "cc_sm2.h"
+#include "ec_wrst.h"
 
 
 /******************************************************************************
@@ -29,17 +30,15 @@
 /*!
 @brief This function gets as an input the digest of id and calculates message digest.
 
-    @param[in] id as a string.
-    @param[in] id length in bytes.
+    @param[in] A pointer to the id digest.
+    @param[in] The id digest length in bytes.
     @param[in] A pointer to the message.
     @param[in] The message size in bytes.
-    @param[in] The Working_buffer
-    @param[in] The working buffer size should be at least idhlen + msglen
     @param[out] The output buffer.
-    @param[out] The size of the output buffer in bytes.
+    @param[out] The size of the output buffer in words.
 
 @return CC_OK on success.
-@return a non-zero value on failure as defined cc_ecpki_error.h or cc_hash_error.h.
+@return a non-zero value on failure as defined cc_ecpki_error.h or cc_sm3_error.h.
 */
 
 /******************************************************************************/
@@ -49,8 +48,6 @@ CCError_t Sm2ComputeMessageFromIdDigest (
         const size_t                idhlen,         /*!< [in]        - The size of the id digest in bytes. */
         const uint8_t               *msg,           /*!< [in]        - A pointer to the message. */
         const size_t                msglen,         /*!< [in]        - The size of the message in bytes. */
-        uint8_t                     *working_buffer,/*!< [in]        - The working buffer */
-        const size_t                wblength,       /*!< [in]        - The working buffer size should be at least idhlen + msglen*/
         uint32_t                    *out,           /*!< [out]       - A pointer to a buffer for the output. */
         size_t                      *outlen         /*!< [in/out]    - output length in words. */
 );
@@ -135,12 +132,32 @@ CCError_t Sm2CalculateConfirmationValue (
 );
 
 /******************************************************************************
- *                Sm2CalcKdfBlock
+ *                Sm2KdfPrefixInit
  ******************************************************************************/
 /*!
-@brief This function calculates the kdf block number ct.
+@brief This function hashes the prefix xV || yV || ZA || ZB, common to all kdf blocks,
+       into an SM3 context.
 
     @param[in] A pointer to the key exchange context
+    @param[out] The SM3 context of the prefix.
+
+@return a non-zero value on failure@return CC_OK on success.
+*/
+/******************************************************************************/
+
+CCError_t Sm2KdfPrefixInit (
+        const CC_Sm2KeContext_t     *pSm2KeContext,     /*!< [in]        - A pointer to the key exchange context*/
+        CCSm3UserContext_t          *pPrefixCtx         /*!< [out]       - The SM3 context of the prefix*/
+);
+
+/******************************************************************************
+ *                Sm2CalcKdfBlock
+ ******************************************************************************/
+/*!
+@brief This function calculates the kdf block number ct, continuing from a copy of
+       the prefix context set by Sm2KdfPrefixInit.
+
+    @param[in] The SM3 context of the prefix.
     @param[in] value for concatenation.
     @param[out] The output buffer.
     @param[out] The size of the output buffer in bytes.
@@ -150,7 +167,7 @@ CCError_t Sm2CalculateConfirmationValue (
 /******************************************************************************/
 
 CCError_t Sm2CalcKdfBlock (
-        const CC_Sm2KeContext_t     *pSm2KeContext,     /*!< [in]        - A pointer to the key exchange context*/
+        const CCSm3UserContext_t    *pPrefixCtx,        /*!< [in]        - The SM3 context of the prefix*/
         const uint32_t              ct,
         uint8_t                     *digest,            /*!< [out]       - The kdf block*/
         size_t                      *dsize              /*!< [in/out]    - The kdf block size*/
@@ -189,12 +206,48 @@ CCError_t EcWrstSm2Sign(
  *
  * @return  CC_OK On success, otherwise indicates failure
  */
+/*!
+@brief This function initializes the PKA for SM2 operations and locks the asymmetric mutex. The session
+serves any count of ::EcWrstSm2VerifyInSession and ::EcWrstSm2CalculateSharedSecretInSession calls,
+and must be closed by ::EcWrstSm2PkaSessionFinish.
+
+@return CC_OK on success.
+@return A non-zero value on failure
+*/
+CCError_t EcWrstSm2PkaSessionStart(
+    uint32_t  *pPkaReqRegs              /*!< [out] The count of PKA registers to clear on finish. */
+);
+
+/*!
+@brief This function clears the PKA registers, finishes the PKA and unlocks the asymmetric mutex.
+*/
+void EcWrstSm2PkaSessionFinish(
+    uint32_t  pkaReqRegs                /*!< [in] The count of PKA registers returned by ::EcWrstSm2PkaSessionStart. */
+);
+
+/*!
+@brief This function verifies the signature, as ::EcWrstSm2Verify, in an open PKA session.
+
+@return CC_OK on success.
+@return A non-zero value on failure
+*/
+CCError_t EcWrstSm2VerifyInSession(
+    CCEcpkiPublKey_t *pSignPublKey,     /*!< [in] Pointer to signer public key structure. */
+    uint32_t  *pMsgRepres,              /*!< [in] The pointer to the message representative buffer.*/
+    uint32_t   msgRepresSizeWords,      /*!< [in] Size of the message representative buffer in words.*/
+    uint32_t  *pSignR,                  /*!< [in] Pointer to R-part of the signature (called also R-part). */
+    uint32_t  *pSignS,                  /*!< [in] Pointer to S-part of the signature (called also S-part). */
+    uint32_t  *pTempBuff                /*!< [in] Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
+);
+
+
 CCError_t EcWrstSm2Verify(
     CCEcpkiPublKey_t *pSignPublKey,     /*!< [in] Pointer to signer public key structure. */
     uint32_t  *pMsgRepres,              /*!< [in] The pointer to the message representative buffer.*/
     uint32_t   msgRepresSizeWords,      /*!< [in] Size of the message representative buffer in words.*/
     uint32_t  *pSignR,                  /*!< [in] Pointer to R-part of the signature (called also R-part). */
-    uint32_t  *pSignS                   /*!< [in] Pointer to S-part of the signature (called also S-part). */
+    uint32_t  *pSignS,                  /*!< [in] Pointer to S-part of the signature (called also S-part). */
+    uint32_t  *pTempBuff                /*!< [in] Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
 );
 
 /**************************************************************************
@@ -212,8 +265,24 @@ CCError_t EcWrstSm2CalculateSharedSecret (
         const CCEcpkiPointAffine_t  *pRandomPoint,              /*!< [in]   - A pointer to the random point from the second party. */
         const CCEcpkiDomain_t       *pDomain,                   /*!< [in]   - A pointer to the domain.    */
         const uint32_t              *t,                         /*!< [in]   - The t value.*/
-        CCEcpkiPointAffine_t        *shared_secret              /*!< [out]  - shared secret output parameter */
+        CCEcpkiPointAffine_t        *shared_secret,             /*!< [out]  - shared secret output parameter */
+        uint32_t                    *pTempBuff                  /*!< [in]   - Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
+);
+
 
+/*!
+@brief Calculates the shared secret, as ::EcWrstSm2CalculateSharedSecret, in an open PKA session.
+@return CC_OK on success.
+@return A non-zero value on failure
+ */
+
+CCError_t EcWrstSm2CalculateSharedSecretInSession (
+        const CCEcpkiPublKey_t      *pPublicKey,                /*!< [in]   - A pointer to the public key exchange context.*/
+        const CCEcpkiPointAffine_t  *pRandomPoint,              /*!< [in]   - A pointer to the random point from the second party. */
+        const CCEcpkiDomain_t       *pDomain,                   /*!< [in]   - A pointer to the domain.    */
+        const uint32_t              *t,                         /*!< [in]   - The t value.*/
+        CCEcpkiPointAffine_t        *shared_secret,             /*!< [out]  - shared secret output parameter */
+        uint32_t                    *pTempBuff                  /*!< [in]   - Temporary buffer of EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS words. */
 );
 
 
@@ -206,6 +206,7 @@ CEXPORT_C CCError_t CC_Sm2Kdf (
     uint32_t regVal;
     uint32_t ct;
     size_t out_block_size = CC_SM3_RESULT_SIZE_IN_BYTES;
+    CCSm3UserContext_t prefixCtx;
 
     if ( NULL == pCtx ) {
         err = CC_ECPKI_SM2_INVALID_KE_CONTEXT_PTR;
@@ -244,8 +245,15 @@ CEXPORT_C CCError_t CC_Sm2Kdf (
     bits_in_last_block = ((SharedSecretSizeInBits % CC_SM3_RESULT_SIZE_IN_BITS) == 0) ? CC_SM3_RESULT_SIZE_IN_BITS :  SharedSecretSizeInBits % CC_SM3_RESULT_SIZE_IN_BITS;
     bytes_in_last_block = (bits_in_last_block + CC_BITS_IN_BYTE - 1) / CC_BITS_IN_BYTE;
 
+    /* xV || yV || ZA || ZB is hashed once, and every block continues from it with its ct */
+    if (CC_OK != (err = Sm2KdfPrefixInit(pCtx, &prefixCtx))) {
+        goto End;
+    }
+
     for (ct = 1U; ct <= blocks; ct++) {
-        Sm2CalcKdfBlock (pCtx, ct, cur_digest, &out_block_size);
+        if (CC_OK != (err = Sm2CalcKdfBlock (&prefixCtx, ct, cur_digest, &out_block_size))) {
+            goto End;
+        }
         if (ct == blocks) {
             CC_PalMemCopy(pKeyOut + (ct-1)*CC_SM3_RESULT_SIZE_IN_BYTES, cur_digest, bytes_in_last_block);
             break;
@@ -256,6 +264,8 @@ CEXPORT_C CCError_t CC_Sm2Kdf (
     *pKeyOutSize = (blocks-1) * CC_SM3_RESULT_SIZE_IN_BYTES + ((bits_in_last_block + CC_BITS_IN_BYTE - 1) / CC_BITS_IN_BYTE);
 
 End:
+    CC_PalMemSetZero(&prefixCtx, sizeof(prefixCtx));
+    CC_PalMemSetZero(cur_digest, sizeof(cur_digest));
     if (err!= CC_OK && NULL != pKeyOut && NULL != pKeyOutSize){
         CC_PalMemSetZero( pKeyOut, *pKeyOutSize);
     }
@@ -401,38 +411,23 @@ End:
 
 
 /**************************************************************************
- *                    CC_Sm2CalculateSharedSecret
+ *                    Sm2SharedSecretParamsCheck
  * *************************************************************************/
 /*!
 
-@brief Calculates shared secret and optionally the internal confirmation value and stores
-   them into the context. Optionally calculates output confirmation value.
+@brief Checks the parameters of the shared secret calculation.
 
 @return CC_OK on success.
 @return A non-zero value on failure
  */
-
-CEXPORT_C CCError_t CC_Sm2CalculateSharedSecret (
-        CC_Sm2KeContext_t           *pCtx,                      /*!< [in/out]   - A pointer to the key exchange context.*/
-        const CCEcpkiUserPublKey_t  *pRandomPoint,              /*!< [in]       - A pointer to the random point from the second party. */
-        uint8_t                     *pConfirmationValueOut,     /*!< [out]      - The output confirmation value.*/
-        size_t                      *pConfirmationValueOutSize  /*!< [in/out]   - A pointer to the output confirmation value size in bytes */
+static CCError_t Sm2SharedSecretParamsCheck (
+        const CC_Sm2KeContext_t     *pCtx,
+        const CCEcpkiUserPublKey_t  *pRandomPoint,
+        const uint8_t               *pConfirmationValueOut,
+        const size_t                *pConfirmationValueOutSize
 )
 {
-
-    CCError_t               err                   = CC_OK;
-    CCEcpkiPublKey_t*       pRemotePubKey ;
-    uint8_t                 int_conf_prefix       = 0;
-    uint8_t                 out_conf_prefix       = 0;
-    uint8_t                 conf_temp_buffer[CC_SM3_RESULT_SIZE_IN_BYTES];
-    size_t                  conf_template_buffer_size = CC_SM3_RESULT_SIZE_IN_BYTES;
-    CCEcpkiPublKey_t        *pEphPubKey = 0;
-    uint32_t regVal;
-
-    /*domain related values*/
-
-    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain(); /* Currently the standard specifies only one possible domain for SM2. */
-    size_t ordSizeInBits, ordSizeInWords, modSizeInWords, modSizeInBits, ordSizeInBytes;
+    CCError_t err = CC_OK;
 
     if (NULL == pCtx) {
         err = CC_ECPKI_SM2_INVALID_KE_CONTEXT_PTR;
@@ -451,47 +446,51 @@ CEXPORT_C CCError_t CC_Sm2CalculateSharedSecret (
         err = CC_ECPKI_SM2_INVALID_OUT_PARAM_SIZE;
         goto End;
     }
+End:
+    return err;
+}
 
-    /* The function should refuse to operate if the secure disable bit is set */
-    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
-    if (regVal == SECURE_DISABLE_FLAG_SET) {
-        return CC_ECPKI_SM2_SD_ENABLED_ERR;
-    }
-
-    /* The function should refuse to operate if the Fatal Error bit is set */
-    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
-    if (regVal == FATAL_ERROR_FLAG_SET) {
-        return CC_ECPKI_SM2_FATAL_ERR_IS_LOCKED_ERR;
-    }
-
-    pRemotePubKey = (CCEcpkiPublKey_t *)&pCtx->remotePubKey.PublKeyDbBuff;
-    pEphPubKey = (CCEcpkiPublKey_t *)&pRandomPoint->PublKeyDbBuff;
-    /* set EC domain parameters modulus and EC order sizes */
-    /* Currently there is only one possible domain. This assignment is constant.
-     * In the future we may have more than one domain. */
-    ordSizeInBits  = pDomain->ordSizeInBits;
-    modSizeInBits  = pDomain->modSizeInBits;
-    ordSizeInWords = CALC_FULL_32BIT_WORDS(ordSizeInBits);
-    modSizeInWords = CALC_FULL_32BIT_WORDS(modSizeInBits);
-    ordSizeInBytes = CALC_FULL_BYTES(ordSizeInBits);
-
-    if ((ordSizeInWords > CC_SM2_ORDER_LENGTH_IN_WORDS) ||
-            (modSizeInWords> CC_SM2_MODULE_LENGTH_IN_WORDS))
-    {
-        err = ECWRST_SCALAR_MULT_INVALID_MOD_ORDER_SIZE_ERROR;
-        goto End;
-    }
+/**************************************************************************
+ *                    Sm2RemoteEphemeralSet
+ * *************************************************************************/
+/*!
 
+@brief Copies the random point from the second party into the context.
+ */
+static void Sm2RemoteEphemeralSet (
+        CC_Sm2KeContext_t           *pCtx,
+        const CCEcpkiUserPublKey_t  *pRandomPoint
+)
+{
+    CCEcpkiPublKey_t        *pEphPubKey = (CCEcpkiPublKey_t *)&pRandomPoint->PublKeyDbBuff;
+    size_t                  ordSizeInBytes = CALC_FULL_BYTES(CC_EcpkiGetSm2Domain()->ordSizeInBits);
 
     CC_PalMemCopy( (uint8_t*)pCtx->remote_ephemeral_pub.x, (uint8_t*)pEphPubKey->x, ordSizeInBytes);
     CC_PalMemCopy( (uint8_t*)pCtx->remote_ephemeral_pub.y, (uint8_t*)pEphPubKey->y, ordSizeInBytes);
+}
 
+/**************************************************************************
+ *                    Sm2ConfirmationValuesCalc
+ * *************************************************************************/
+/*!
 
-    err = EcWrstSm2CalculateSharedSecret (pRemotePubKey, &pCtx->remote_ephemeral_pub, pDomain, pCtx->t, &pCtx->V);
-    if (CC_OK != err) {
-        goto Cleanup;
-    }
+@brief Calculates the internal and the output confirmation values required by the context,
+ from the shared secret stored in the context.
 
+@return CC_OK on success.
+@return A non-zero value on failure
+ */
+static CCError_t Sm2ConfirmationValuesCalc (
+        CC_Sm2KeContext_t           *pCtx,
+        uint8_t                     *pConfirmationValueOut,
+        size_t                      *pConfirmationValueOutSize
+)
+{
+    CCError_t               err                   = CC_OK;
+    uint8_t                 int_conf_prefix       = 0;
+    uint8_t                 out_conf_prefix       = 0;
+    uint8_t                 conf_temp_buffer[CC_SM3_RESULT_SIZE_IN_BYTES];
+    size_t                  conf_template_buffer_size = CC_SM3_RESULT_SIZE_IN_BYTES;
 
     if (pCtx->isInitiator){
         int_conf_prefix = 0x2;
@@ -505,7 +504,7 @@ CEXPORT_C CCError_t CC_Sm2CalculateSharedSecret (
     if (pCtx->confirmation != 0){
         err = Sm2CalculateConfirmationTemplate (pCtx, conf_temp_buffer, &conf_template_buffer_size);
         if (err != CC_OK) {
-            goto Cleanup;
+            goto End;
         }
     }
 
@@ -515,7 +514,7 @@ CEXPORT_C CCError_t CC_Sm2CalculateSharedSecret (
         err = Sm2CalculateConfirmationValue (pCtx, int_conf_prefix, conf_temp_buffer, conf_template_buffer_size,
                                           pCtx->conf_value, &pCtx->conf_value_size);
         if (err != CC_OK) {
-            goto Cleanup;
+            goto End;
         }
 
     }
@@ -525,9 +524,70 @@ CEXPORT_C CCError_t CC_Sm2CalculateSharedSecret (
         err = Sm2CalculateConfirmationValue (pCtx, out_conf_prefix, conf_temp_buffer, conf_template_buffer_size,
                                           pConfirmationValueOut, pConfirmationValueOutSize);
         if (err != CC_OK) {
-            goto Cleanup;
+            goto End;
         }
     }
+End:
+    CC_PalMemSetZero(conf_temp_buffer, sizeof(conf_temp_buffer));
+    return err;
+}
+
+/**************************************************************************
+ *                    CC_Sm2CalculateSharedSecret
+ * *************************************************************************/
+/*!
+
+@brief Calculates shared secret and optionally the internal confirmation value and stores
+   them into the context. Optionally calculates output confirmation value.
+
+@return CC_OK on success.
+@return A non-zero value on failure
+ */
+
+CEXPORT_C CCError_t CC_Sm2CalculateSharedSecret (
+        CC_Sm2KeContext_t           *pCtx,                      /*!< [in/out]   - A pointer to the key exchange context.*/
+        const CCEcpkiUserPublKey_t  *pRandomPoint,              /*!< [in]       - A pointer to the random point from the second party. */
+        uint8_t                     *pConfirmationValueOut,     /*!< [out]      - The output confirmation value.*/
+        size_t                      *pConfirmationValueOutSize  /*!< [in/out]   - A pointer to the output confirmation value size in bytes */
+)
+{
+
+    CCError_t               err                   = CC_OK;
+    CCEcpkiPublKey_t*       pRemotePubKey ;
+    uint32_t regVal;
+    uint32_t                tempBuff[EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS];
+
+    /*domain related values*/
+
+    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain(); /* Currently the standard specifies only one possible domain for SM2. */
+
+    err = Sm2SharedSecretParamsCheck(pCtx, pRandomPoint, pConfirmationValueOut, pConfirmationValueOutSize);
+    if (err != CC_OK) {
+        goto End;
+    }
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_ECPKI_SM2_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_ECPKI_SM2_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+    pRemotePubKey = (CCEcpkiPublKey_t *)&pCtx->remotePubKey.PublKeyDbBuff;
+
+    Sm2RemoteEphemeralSet(pCtx, pRandomPoint);
+
+    err = EcWrstSm2CalculateSharedSecret (pRemotePubKey, &pCtx->remote_ephemeral_pub, pDomain, pCtx->t, &pCtx->V, tempBuff);
+    if (CC_OK != err) {
+        goto Cleanup;
+    }
+
+    err = Sm2ConfirmationValuesCalc(pCtx, pConfirmationValueOut, pConfirmationValueOutSize);
 
 Cleanup:
     if (err != CC_OK && NULL != pCtx){
@@ -541,6 +601,115 @@ End:
 }
 
 
+/**************************************************************************
+ *                    CC_Sm2CalculateSharedSecretBatch
+ * *************************************************************************/
+/*!
+
+@brief Calculates the shared secrets of a batch of key exchanges in a single PKA session,
+   and then their confirmation values.
+
+@return CC_OK if all the items succeeded.
+@return CC_ECPKI_SM2_BATCH_ITEM_FAILED if any item failed, the result of each item is set in pResults.
+@return A non-zero value on failure
+ */
+
+CEXPORT_C CCError_t CC_Sm2CalculateSharedSecretBatch (
+        const CCSm2KeBatchItem_t    *pItems,                    /*!< [in/out]   - A pointer to the key exchanges.*/
+        const size_t                itemsCount,                 /*!< [in]       - The count of items.*/
+        CCError_t                   *pResults                   /*!< [out]      - A pointer to the result of each item.*/
+)
+{
+    CCError_t               err                   = CC_OK;
+    CCError_t               itemErr;
+    const CCSm2KeBatchItem_t *pItem;
+    uint32_t                pkaReqRegs            = 0;
+    uint32_t                regVal;
+    uint32_t                tempBuff[EC_WRST_DOUBLE_MULT_TEMP_BUFF_SIZE_IN_WORDS];
+    size_t                  i;
+
+    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetSm2Domain(); /* Currently the standard specifies only one possible domain for SM2. */
+
+    if ((NULL == pItems) || (NULL == pResults)) {
+        err = CC_ECPKI_SM2_INVALID_BATCH_PTR;
+        goto End;
+    }
+
+    if ((itemsCount == 0) || (itemsCount > CC_SM2_BATCH_MAX_ITEMS_COUNT)) {
+        err = CC_ECPKI_SM2_INVALID_BATCH_ITEMS_COUNT;
+        goto End;
+    }
+
+    /* The function should refuse to operate if the secure disable bit is set */
+    CC_UTIL_IS_SECURE_DISABLE_FLAG_SET(regVal);
+    if (regVal == SECURE_DISABLE_FLAG_SET) {
+        return CC_ECPKI_SM2_SD_ENABLED_ERR;
+    }
+
+    /* The function should refuse to operate if the Fatal Error bit is set */
+    CC_UTIL_IS_FATAL_ERROR_SET(regVal);
+    if (regVal == FATAL_ERROR_FLAG_SET) {
+        return CC_ECPKI_SM2_FATAL_ERR_IS_LOCKED_ERR;
+    }
+
+    for (i = 0; i < itemsCount; i++) {
+        pItem = &pItems[i];
+        pResults[i] = Sm2SharedSecretParamsCheck(pItem->pCtx, pItem->pRandomPoint,
+                                                 pItem->pConfirmationValueOut, pItem->pConfirmationValueOutSize);
+        if (pResults[i] == CC_OK) {
+            Sm2RemoteEphemeralSet(pItem->pCtx, pItem->pRandomPoint);
+        }
+    }
+
+    /* the shared secrets of all the items in one PKA session */
+    err = EcWrstSm2PkaSessionStart(&pkaReqRegs);
+    if (err != CC_OK) {
+        for (i = 0; i < itemsCount; i++) {
+            if (pResults[i] == CC_OK) {
+                pResults[i] = err;
+            }
+        }
+        goto End;
+    }
+
+    for (i = 0; i < itemsCount; i++) {
+        pItem = &pItems[i];
+        if (pResults[i] != CC_OK) {
+            continue;
+        }
+        pResults[i] = EcWrstSm2CalculateSharedSecretInSession((CCEcpkiPublKey_t *)&pItem->pCtx->remotePubKey.PublKeyDbBuff,
+                                                              &pItem->pCtx->remote_ephemeral_pub, pDomain,
+                                                              pItem->pCtx->t, &pItem->pCtx->V, tempBuff);
+        if (pResults[i] != CC_OK) {
+            /* the item is failed by the PKA and is cleared as by CC_Sm2CalculateSharedSecret */
+            CC_PalMemSetZero( pItem->pCtx, sizeof (CC_Sm2KeContext_t));
+            CC_PalMemSetZero( pItem->pConfirmationValueOut, *pItem->pConfirmationValueOutSize);
+        }
+    }
+
+    EcWrstSm2PkaSessionFinish(pkaReqRegs);
+
+    /* the confirmation values, after the PKA is released */
+    for (i = 0; i < itemsCount; i++) {
+        pItem = &pItems[i];
+        if (pResults[i] == CC_OK) {
+            itemErr = Sm2ConfirmationValuesCalc(pItem->pCtx, pItem->pConfirmationValueOut, pItem->pConfirmationValueOutSize);
+            if (itemErr != CC_OK) {
+                CC_PalMemSetZero( pItem->pCtx, sizeof (CC_Sm2KeContext_t));
+                CC_PalMemSetZero( pItem->pConfirmationValueOut, *pItem->pConfirmationValueOutSize);
+            }
+            pResults[i] = itemErr;
+        }
+        if (pResults[i] != CC_OK) {
+            err = CC_ECPKI_SM2_BATCH_ITEM_FAILED;
+        }
+    }
+
+End:
+    return err;
+}
+
+
 
 /**************************************************************************
  *                    CC_Sm2Confirmation
@@ -26,6 +26,16 @@ extern "C"
       PUBLIC FUNCTIONS
 -----------------------------------*/
 
+#ifdef CC_HAL_SW_MODEL
+#include "cc_hal_sw_model.h"
+
+/* The software model is mapped at address zero, so the register address is its offset. */
+#define SB_HAL_READ_REGISTER(addr,val)   \
+            ((val) = CC_HalSwModelRead((unsigned long)(addr)))
+
+#define SB_HAL_WRITE_REGISTER(addr,val)     \
+        CC_HalSwModelWrite((unsigned long)(addr), (uint32_t)(val))
+#else
 /*! Reads a 32-bit value from a CryptoCell-713 memory-mapped register. */
 #define SB_HAL_READ_REGISTER(addr,val)   \
             ((val) = (*((volatile uint32_t*)(addr))))
@@ -42,6 +52,7 @@ extern "C"
  */
 #define SB_HAL_WRITE_REGISTER(addr,val)     \
         ((*((volatile uint32_t*)(addr))) = (uint32_t)(val))
+#endif /* CC_HAL_SW_MODEL */
 
 #ifdef __cplusplus
 }
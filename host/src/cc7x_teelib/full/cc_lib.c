@@ -40,6 +40,10 @@
 #include "cc_fips_defs.h"
 #endif
 
+#ifdef CC_SUPPORT_KEYPOOL
+#include "cc_keypool_local.h"
+#endif
+
 #ifdef CC_SUPPORT_CH_CERT
 #include "cc_pal_cert.h"
 #include "cc_chinese_cert.h"
@@ -68,6 +72,15 @@ CC_PalMutex CCFipsMutex;
 CC_PalMutex CCChCertMutex;
 CC_PalMutex *pCCRndCryptoMutex;
 CC_PalMutex *pCCGenVecMutex;
+#ifdef CC_SUPPORT_KEYPOOL
+CC_PalMutex CCKeyPoolMutex;
+#endif
+#ifdef CC_SUPPORT_PUBKEY_CACHE
+CC_PalMutex CCPubKeyCacheMutex;
+#endif
+#ifdef CC_SUPPORT_SM2_ZA_CACHE
+CC_PalMutex CCSm2ZaCacheMutex;
+#endif
 
 /************************ Private Functions **********************************/
 static CClibRetCode_t InitHukRma(void *p_rng)
@@ -503,6 +516,11 @@ void CC_LibFini(CCRndGenerateVectWorkFunc_t *f_rng, void *p_rng)
     /* common finalisations */
     CC_CommonFini();
 
+#ifdef CC_SUPPORT_KEYPOOL
+    /* zeroize the pre-generated keys */
+    KeyPoolTerminateAll();
+#endif
+
     CC_RndUnInstantiation(f_rng, p_rng);
     SymDriverAdaptorModuleTerminate();
     RpmbSymDriverAdaptorModuleTerminate();
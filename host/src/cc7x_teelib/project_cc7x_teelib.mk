@@ -28,6 +28,19 @@ CFLAGS += -DLIB_PERF
 SOURCES_$(TARGET_LIBS) += cc_pal_perf_plat.c
 endif
 
+ifeq ($(LIB_TRACE),1)
+CFLAGS += -DCC_PAL_TRACE
+SOURCES_$(TARGET_LIBS) += cc_pal_trace.c
+endif
+
+# Software model of the HW, for running and profiling the drivers on a plain host
+ifeq ($(CC_SW_MODEL),1)
+VPATH += $(HOST_SRCDIR)/hal/sw_model
+INCDIRS_EXTRA += $(HOST_SRCDIR)/hal/sw_model
+CFLAGS += -DCC_HAL_SW_MODEL -DCC_CONFIG_INTERRUPT_POLLING
+SOURCES_$(TARGET_LIBS) += cc_hal_sw_model.c cc_hal_sw_model_sym.c cc_hal_sw_model_pka.c
+endif
+
 CFLAGS += -DCC_HW_VERSION=$(CC_HW_VERSION)
 
 PUBLIC_INCLUDES += $(HOST_SRCDIR)/hal/$(PROJ_PRD)/cc_hal_defs.h
@@ -67,6 +80,13 @@ ifeq ($(CC_CONFIG_SUPPORT_ECC_SCA_SW_PROTECT), 1)
 else
     SOURCES_$(TARGET_LIBS) += pka_ec_wrst_smul_no_scap.c
 endif
+SOURCES_$(TARGET_LIBS) += pka_ec_wrst_smul_base.c
+
+# Fixed-base comb tables of the library domains generators, for k*G
+ifeq ($(CC_CONFIG_SUPPORT_ECC_FIXED_BASE_COMB), 1)
+    CFLAGS += -DCC_SUPPORT_ECC_FIXED_BASE_COMB
+    SOURCES_$(TARGET_LIBS) += cc_ecpki_domain_comb.c
+endif
 
 # random files
 SOURCES_$(TARGET_LIBS) += llf_rnd.c
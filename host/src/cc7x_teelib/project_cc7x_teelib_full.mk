@@ -42,6 +42,15 @@ CFLAGS += -DPKA_DEBUG
 SOURCES_$(TARGET_LIBS) += pki_dbg.c
 endif
 
+# PKA operation profiler, timed by the CC_PalPerf backend
+ifeq ($(PKA_PROFILE),1)
+ifneq ($(LIB_PERF),1)
+$(error PKA_PROFILE=1 requires LIB_PERF=1)
+endif
+CFLAGS += -DPKA_PROFILE
+SOURCES_$(TARGET_LIBS) += pki_prof.c
+endif
+
 ifeq ($(TEE_OS),optee)
 ifndef OPTEE_OS_DIR
 $(error OPTEE_OS_DIR is undefined)
@@ -101,7 +110,11 @@ SOURCES_$(TARGET_LIBS) += cc_rsa_build_priv.c
 SOURCES_$(TARGET_LIBS) += rsa_public.c rsa_private.c rsa_genkey.c
 
 #DH
-SOURCES_$(TARGET_LIBS) += cc_dh.c cc_dh_kg.c cc_kdf.c cc_kdf_internal.c
+SOURCES_$(TARGET_LIBS) += cc_dh.c cc_dh_kg.c cc_dh_groups.c cc_kdf.c cc_kdf_internal.c
+ifeq ($(CC_CONFIG_SUPPORT_DH_FIXED_BASE_COMB),1)
+CFLAGS += -DCC_SUPPORT_DH_FIXED_BASE_COMB
+SOURCES_$(TARGET_LIBS) += cc_dh_groups_comb.c
+endif
 
 #ECC (Canonic)
 SOURCES_$(TARGET_LIBS) += cc_ecpki_info.c
@@ -114,6 +127,41 @@ SOURCES_$(TARGET_LIBS) += cc_ecpki_domain_secp192k1.c cc_ecpki_domain_secp224r1.
 SOURCES_$(TARGET_LIBS) += cc_ecpki_domain_secp256k1.c cc_ecpki_domain_secp384r1.c cc_ecpki_domain_secp521r1.c cc_ecpki_domain_bp256r1.c
 SOURCES_$(TARGET_LIBS) += bsv_crypto_asym_api.c
 
+#Key pool
+ifeq ($(CC_CONFIG_SUPPORT_KEYPOOL),1)
+CFLAGS += -DCC_SUPPORT_KEYPOOL
+SOURCES_$(TARGET_LIBS) += cc_keypool.c
+endif
+
+#Validated public key cache
+ifeq ($(CC_CONFIG_SUPPORT_PUBKEY_CACHE),1)
+CFLAGS += -DCC_SUPPORT_PUBKEY_CACHE
+SOURCES_$(TARGET_LIBS) += cc_pubkey_cache.c
+endif
+
+#SM2 ZA cache and prepared signers
+ifeq ($(CC_CONFIG_SUPPORT_SM2_ZA_CACHE),1)
+CFLAGS += -DCC_SUPPORT_SM2_ZA_CACHE
+SOURCES_$(TARGET_LIBS) += cc_sm2_za_cache.c
+endif
+
+#Hybrid ECIES
+ifeq ($(CC_CONFIG_SUPPORT_ECIES_HYBRID),1)
+CFLAGS += -DCC_SUPPORT_ECIES_HYBRID
+SOURCES_$(TARGET_LIBS) += cc_ecies_hybrid.c
+endif
+
+#X25519 and Ed25519
+ifeq ($(CC_CONFIG_SUPPORT_EC_MONT_EDW),1)
+CFLAGS += -DCC_SUPPORT_EC_MONT_EDW
+SOURCES_$(TARGET_LIBS) += cc_ec_mont.c cc_ec_edw.c ec_mont_edw_domain_25519.c
+SOURCES_$(TARGET_LIBS) += pka_ec_mont.c pka_ec_edw.c
+INCDIRS_EXTRA += $(CODESAFE_SRCDIR)/crypto_api/ec_mont_edw
+INCDIRS_EXTRA += $(CODESAFE_SRCDIR)/crypto_api/pki/ec_mont_edw
+VPATH += $(CODESAFE_SRCDIR)/crypto_api/ec_mont_edw
+VPATH += $(CODESAFE_SRCDIR)/crypto_api/pki/ec_mont_edw
+endif
+
 #secure boot debug
 SOURCES_$(TARGET_LIBS) += bsv_rsa_driver.c
 SOURCES_$(TARGET_LIBS) += rsa_pki_pka.c
@@ -206,6 +254,8 @@ INCDIRS_EXTRA += $(CODESAFE_SRCDIR)/crypto_api/pki/ec_wrst
 INCDIRS_EXTRA += $(HOST_SRCDIR)/utils
 INCDIRS_EXTRA += $(CODESAFE_SRCDIR)/crypto_api/fips
 INCDIRS_EXTRA += $(CODESAFE_SRCDIR)/crypto_api/chinese_cert
+INCDIRS_EXTRA += $(CODESAFE_SRCDIR)/crypto_api/keypool
+INCDIRS_EXTRA += $(CODESAFE_SRCDIR)/crypto_api/pubkey_cache
 INCDIRS_EXTRA += $(SHARED_INCDIR)/trng
 INCDIRS_EXTRA += $(SHARED_INCDIR)/cc_util
 INCDIRS_EXTRA += $(SHARED_INCDIR)/boot
@@ -223,6 +273,8 @@ VPATH += $(CODESAFE_SRCDIR)/crypto_api/pki/rsa $(CODESAFE_SRCDIR)/crypto_api/pki
 VPATH += $(CODESAFE_SRCDIR)/crypto_api/pki/common
 VPATH += $(CODESAFE_SRCDIR)/crypto_api/fips
 VPATH += $(CODESAFE_SRCDIR)/crypto_api/chinese_cert
+VPATH += $(CODESAFE_SRCDIR)/crypto_api/keypool
+VPATH += $(CODESAFE_SRCDIR)/crypto_api/pubkey_cache
 VPATH += $(CODESAFE_SRCDIR)/secure_boot_debug/platform/hal/cc7x
 VPATH += $(CODESAFE_SRCDIR)/secure_boot_debug/
 VPATH += $(CODESAFE_SRCDIR)/secure_boot_debug/secure_boot
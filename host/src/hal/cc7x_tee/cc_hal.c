@@ -36,7 +36,10 @@ unsigned long gCcRegBase = 0;
 ******************************************************************************/
 CCError_t CC_HalInit(void)
 {
-#ifndef CMPU_UTIL
+#if defined(CC_HAL_SW_MODEL)
+    gCcRegBase = 0;
+    return CC_HalSwModelInit();
+#elif !defined(CMPU_UTIL)
     unsigned long *pVirtBuffAddr = NULL;
     CC_PalMemMap(CC_BASE_CC, DX_CC_REG_AREA_LEN, (uint32_t**) &pVirtBuffAddr);
     gCcRegBase = (unsigned long) pVirtBuffAddr;
@@ -47,7 +50,9 @@ CCError_t CC_HalInit(void)
 
 CCError_t CC_HalTerminate(void)
 {
-#ifndef CMPU_UTIL
+#if defined(CC_HAL_SW_MODEL)
+    CC_HalSwModelTerminate();
+#elif !defined(CMPU_UTIL)
     CC_PalMemUnMap((uint32_t *) gCcRegBase, DX_CC_REG_AREA_LEN);
     gCcRegBase = 0;
 #endif
@@ -35,6 +35,25 @@ extern unsigned long gCcRegBase;
 *                               MACROS
 ******************************************************************************/
 
+#ifdef CC_HAL_SW_MODEL
+#include "cc_hal_sw_model.h"
+
+/* Registers are served by the software model; gCcRegBase stays zero. */
+#define CC_HAL_READ_REGISTER(regOffset) 				\
+		CC_HalSwModelRead(gCcRegBase + (regOffset))
+
+#define CC_HAL_WRITE_REGISTER(regOffset, val) 		\
+		CC_HalSwModelWrite(gCcRegBase + (regOffset), (uint32_t)(val))
+
+#define CC_HAL_READ_REGISTER_BLOCK(regOffset, pBuff, sizeWords) 	\
+		CC_HalSwModelReadBlock(gCcRegBase + (regOffset), (pBuff), (sizeWords))
+
+#define CC_HAL_WRITE_REGISTER_BLOCK(regOffset, pBuff, sizeWords) 	\
+		CC_HalSwModelWriteBlock(gCcRegBase + (regOffset), (pBuff), (sizeWords))
+
+#define CC_HAL_WRITE_REGISTER_ZEROS(regOffset, sizeWords) 		\
+		CC_HalSwModelWriteBlock(gCcRegBase + (regOffset), NULL, (sizeWords))
+#else
 /*!
  * Read CryptoCell memory-mapped-IO register.
  *
@@ -56,6 +75,59 @@ extern unsigned long gCcRegBase;
 #define CC_HAL_WRITE_REGISTER(regOffset, val) 		\
 		(*((volatile uint32_t *)(gCcRegBase + (regOffset))) = (uint32_t)(val))
 
+/*!
+ * Read a block of words from one CryptoCell data register, that advances its address on every
+ * access (such as PKA_SRAM_RDATA).
+ *
+ * \param regOffset The offset of the Arm CryptoCell register to read.
+ * \param pBuff The output buffer.
+ * \param sizeWords The number of words to read.
+ */
+#define CC_HAL_READ_REGISTER_BLOCK(regOffset, pBuff, sizeWords) 	\
+do { 									\
+		volatile uint32_t *pHalReg = (volatile uint32_t *)(gCcRegBase + (regOffset)); \
+		uint32_t *pHalBuff = (pBuff); 				\
+		uint32_t halIdx; 					\
+		for (halIdx = 0; halIdx < (uint32_t)(sizeWords); halIdx++) { \
+			pHalBuff[halIdx] = *pHalReg; 			\
+		} 							\
+} while (0)
+
+/*!
+ * Write a block of words to one CryptoCell data register, that advances its address on every
+ * access (such as PKA_SRAM_WDATA).
+ *
+ * \param regOffset The offset of the Arm CryptoCell register to write.
+ * \param pBuff The input buffer.
+ * \param sizeWords The number of words to write.
+ */
+#define CC_HAL_WRITE_REGISTER_BLOCK(regOffset, pBuff, sizeWords) 	\
+do { 									\
+		volatile uint32_t *pHalReg = (volatile uint32_t *)(gCcRegBase + (regOffset)); \
+		const uint32_t *pHalBuff = (pBuff); 			\
+		uint32_t halIdx; 					\
+		for (halIdx = 0; halIdx < (uint32_t)(sizeWords); halIdx++) { \
+			*pHalReg = pHalBuff[halIdx]; 			\
+		} 							\
+} while (0)
+
+/*!
+ * Write zero words to one CryptoCell data register, that advances its address on every
+ * access (such as PKA_SRAM_WDATA).
+ *
+ * \param regOffset The offset of the Arm CryptoCell register to write.
+ * \param sizeWords The number of words to write.
+ */
+#define CC_HAL_WRITE_REGISTER_ZEROS(regOffset, sizeWords) 		\
+do { 									\
+		volatile uint32_t *pHalReg = (volatile uint32_t *)(gCcRegBase + (regOffset)); \
+		uint32_t halIdx; 					\
+		for (halIdx = 0; halIdx < (uint32_t)(sizeWords); halIdx++) { \
+			*pHalReg = 0; 					\
+		} 							\
+} while (0)
+#endif /* CC_HAL_SW_MODEL */
+
 /*!
  @}
  */
@@ -0,0 +1,774 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#define CC_PAL_LOG_CUR_COMPONENT CC_LOG_MASK_CCLIB
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "cc_pal_types.h"
+#include "cc_pal_log.h"
+#include "cc_regs.h"
+#include "cc_registers.h"
+#include "cc_reg_base_host.h"
+#include "cc_hal_defs.h"
+#include "cc_hw_queue_defs.h"
+#include "cc_lli_defs.h"
+#include "cc_general_defs.h"
+#include "cc_secure_clk_defs.h"
+#include "cc_hal_sw_model.h"
+#include "cc_hal_sw_model_int.h"
+
+/******************************************************************************
+*				DEFINITIONS
+******************************************************************************/
+
+/* default latency model, roughly a CC-713 clocked at 400MHz */
+#define SW_MODEL_DEF_DESC_NS            50
+#define SW_MODEL_DEF_BYPASS_PS          250
+#define SW_MODEL_DEF_AES_PS             800
+#define SW_MODEL_DEF_HASH_PS            1000
+#define SW_MODEL_DEF_PKA_OP_NS          100
+#define SW_MODEL_DEF_PKA_MUL_PS         400
+#define SW_MODEL_DEF_TRNG_NS            20000
+
+#define SW_MODEL_LLI_SIZE_MAX           0x10000
+#define SW_MODEL_EHR_WORDS              6
+#define SW_MODEL_LATENCY_ENV_MAX        128
+
+#define SW_MODEL_REG_IDX(regOffset)     (((regOffset) & (SW_MODEL_REG_AREA_LEN - 1)) >> 2)
+
+/******************************************************************************
+*				TYPE DEFINITIONS
+******************************************************************************/
+
+typedef struct {
+    uint32_t   sramAddr;        /* host indirect SRAM address */
+    uint32_t   sramPrimed;      /* first read after an address write is a dummy read */
+    uint32_t   pkaWAddr;        /* PKA SRAM write address, in words */
+    uint32_t   pkaRAddr;        /* PKA SRAM read address, in words */
+    uint32_t   pkaStatus;
+    uint32_t   irr;
+    uint32_t   monComp;
+    uint32_t   compPending;
+    uint64_t   compDeadline;
+    uint64_t   symBusyUntil;
+    uint64_t   pkaBusyUntil;
+    uint32_t   rngIsr;
+    uint32_t   ehrPending;
+    uint64_t   ehrDeadline;
+    uint32_t   ehr[SW_MODEL_EHR_WORDS];
+    uint64_t   trngSeed;
+    uint64_t   timerBase;
+    uint32_t   desc[HW_DESC_SIZE_WORDS];
+} SwModelState_t;
+
+/******************************************************************************
+*				GLOBALS
+******************************************************************************/
+
+static pthread_mutex_t gSwModelLock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t gSwModelRegs[SW_MODEL_REG_AREA_LEN / sizeof(uint32_t)];
+static uint8_t gSwModelSram[SW_MODEL_SRAM_SIZE];
+static SwModelState_t gSwModelState;
+static CCHalSwModelLatency_t gSwModelLatency = {
+    SW_MODEL_DEF_DESC_NS,
+    SW_MODEL_DEF_BYPASS_PS,
+    SW_MODEL_DEF_AES_PS,
+    SW_MODEL_DEF_HASH_PS,
+    SW_MODEL_DEF_PKA_OP_NS,
+    SW_MODEL_DEF_PKA_MUL_PS,
+    SW_MODEL_DEF_TRNG_NS
+};
+static CCHalSwModelStats_t gSwModelStats;
+
+/* DMA scratch buffers, grown on demand */
+static uint8_t *gSwModelDin = NULL;
+static uint8_t *gSwModelDout = NULL;
+static size_t gSwModelBuffSize = 0;
+
+/******************************************************************************
+*				PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint64_t SwModelNowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* schedules work on an engine and returns its completion time */
+static uint64_t SwModelSchedule(uint64_t *pBusyUntil, uint64_t nowNs, uint64_t costNs)
+{
+    uint64_t start = (*pBusyUntil > nowNs) ? *pBusyUntil : nowNs;
+
+    *pBusyUntil = start + costNs;
+    gSwModelStats.modeledNs += costNs;
+
+    return *pBusyUntil;
+}
+
+static uint32_t SwModelTrngNext(void)
+{
+    uint64_t x = gSwModelState.trngSeed;
+    uint32_t word;
+
+    do {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        word = (uint32_t)(x >> 16);
+    } while (word == 0);
+
+    gSwModelState.trngSeed = x;
+    return word;
+}
+
+/* advances the asynchronous events up to the current time */
+static void SwModelMature(void)
+{
+    uint64_t nowNs = SwModelNowNs();
+    uint32_t i;
+
+    if ((gSwModelState.compPending != 0) && (nowNs >= gSwModelState.compDeadline)) {
+        gSwModelState.monComp += gSwModelState.compPending;
+        gSwModelState.compPending = 0;
+        gSwModelState.irr |= CC_REG_BIT_MASK(HOST_RGF, IRR_AXIM_COMP_INT);
+    }
+
+    if ((gSwModelState.ehrPending != 0) && (nowNs >= gSwModelState.ehrDeadline)) {
+        for (i = 0; i < SW_MODEL_EHR_WORDS; i++) {
+            gSwModelState.ehr[i] = SwModelTrngNext();
+        }
+        gSwModelState.ehrPending = 0;
+        gSwModelState.rngIsr |= CC_REG_BIT_MASK(RNG_ISR, EHR_VALID);
+        gSwModelState.irr |= CC_REG_BIT_MASK(HOST_RGF, IRR_RNG_INT);
+        gSwModelStats.trngEhrs++;
+    }
+}
+
+static uint32_t SwModelTimerRead(uint32_t msb)
+{
+    uint64_t ticks;
+
+    ticks = (SwModelNowNs() - gSwModelState.timerBase) / (1000000000ULL / EXTERNAL_SLOW_OSCILLATOR_HZ);
+    ticks ^= ticks >> 1;
+
+    return (msb != 0) ? (uint32_t)(ticks >> 32) : (uint32_t)ticks;
+}
+
+static int SwModelBuffReserve(size_t size)
+{
+    uint8_t *pDin, *pDout;
+
+    if (size <= gSwModelBuffSize) {
+        return 0;
+    }
+
+    pDin = realloc(gSwModelDin, size);
+    if (pDin == NULL) {
+        return 1;
+    }
+    gSwModelDin = pDin;
+
+    pDout = realloc(gSwModelDout, size);
+    if (pDout == NULL) {
+        return 1;
+    }
+    gSwModelDout = pDout;
+    gSwModelBuffSize = size;
+
+    return 0;
+}
+
+static uint32_t SwModelSramWord(uint32_t addr)
+{
+    uint32_t val;
+
+    memcpy(&val, &gSwModelSram[addr & (SW_MODEL_SRAM_SIZE - sizeof(uint32_t))], sizeof(val));
+    return val;
+}
+
+static void SwModelSramCopy(uint8_t *pDst, uint32_t addr, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        pDst[i] = gSwModelSram[(addr + i) & (SW_MODEL_SRAM_SIZE - 1)];
+    }
+}
+
+static void SwModelSramStore(uint32_t addr, const uint8_t *pSrc, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        gSwModelSram[(addr + i) & (SW_MODEL_SRAM_SIZE - 1)] = pSrc[i];
+    }
+}
+
+/* returns the byte count of an MLLI table held in SRAM */
+static size_t SwModelMlliSize(uint32_t tableAddr, uint32_t entries)
+{
+    size_t total = 0;
+    uint32_t size;
+    uint32_t i;
+
+    for (i = 0; i < entries; i++) {
+        size = SwModelSramWord(tableAddr + i * LLI_ENTRY_BYTE_SIZE + sizeof(uint32_t)) & (SW_MODEL_LLI_SIZE_MAX - 1);
+        total += (size == 0) ? SW_MODEL_LLI_SIZE_MAX : size;
+    }
+
+    return total;
+}
+
+static uint8_t *SwModelMlliEntry(uint32_t tableAddr, uint32_t idx, size_t *pSize)
+{
+    uint32_t word0 = SwModelSramWord(tableAddr + idx * LLI_ENTRY_BYTE_SIZE);
+    uint32_t word1 = SwModelSramWord(tableAddr + idx * LLI_ENTRY_BYTE_SIZE + sizeof(uint32_t));
+
+    *pSize = word1 & (SW_MODEL_LLI_SIZE_MAX - 1);
+    if (*pSize == 0) {
+        *pSize = SW_MODEL_LLI_SIZE_MAX;
+    }
+
+    return (uint8_t *)(uintptr_t)(((uint64_t)(word1 >> 16) << 32) | word0);
+}
+
+static size_t SwModelDinSize(const uint32_t *pWord)
+{
+    uint32_t mode = SW_MODEL_DESC_FLD(WORD1, DIN_DMA_MODE);
+    uint32_t size = SW_MODEL_DESC_FLD(WORD1, DIN_SIZE);
+
+    switch (mode) {
+    case DMA_SRAM:
+    case DMA_DLLI:
+        return size;
+    case DMA_MLLI:
+        return SwModelMlliSize(pWord[0], size);
+    default:
+        return 0;
+    }
+}
+
+static size_t SwModelDoutSize(const uint32_t *pWord)
+{
+    uint32_t mode = SW_MODEL_DESC_FLD(WORD3, DOUT_DMA_MODE);
+    uint32_t size = SW_MODEL_DESC_FLD(WORD3, DOUT_SIZE);
+
+    switch (mode) {
+    case DMA_SRAM:
+    case DMA_DLLI:
+        return size;
+    case DMA_MLLI:
+        return SwModelMlliSize(pWord[2], size);
+    default:
+        return 0;
+    }
+}
+
+static void SwModelDinGather(const uint32_t *pWord, uint8_t *pDin, size_t size)
+{
+    uint32_t mode = SW_MODEL_DESC_FLD(WORD1, DIN_DMA_MODE);
+    uint64_t addr = ((uint64_t)SW_MODEL_DESC_FLD(WORD5, DIN_ADDR_HIGH) << 32) | pWord[0];
+    size_t entrySize, offset;
+    uint8_t *pEntry;
+    uint32_t i;
+
+    switch (mode) {
+    case DMA_SRAM:
+        if (SW_MODEL_DESC_FLD(WORD1, DIN_CONST_VALUE) != 0) {
+            for (offset = 0; offset < size; offset++) {
+                pDin[offset] = (uint8_t)(pWord[0] >> (8 * (offset & 3)));
+            }
+        } else {
+            SwModelSramCopy(pDin, (uint32_t)addr, size);
+        }
+        break;
+    case DMA_DLLI:
+        memcpy(pDin, (const uint8_t *)(uintptr_t)addr, size);
+        break;
+    case DMA_MLLI:
+        for (i = 0, offset = 0; offset < size; i++) {
+            pEntry = SwModelMlliEntry(pWord[0], i, &entrySize);
+            memcpy(pDin + offset, pEntry, entrySize);
+            offset += entrySize;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void SwModelDoutScatter(const uint32_t *pWord, const uint8_t *pDout, size_t size)
+{
+    uint32_t mode = SW_MODEL_DESC_FLD(WORD3, DOUT_DMA_MODE);
+    uint64_t addr = ((uint64_t)SW_MODEL_DESC_FLD(WORD5, DOUT_ADDR_HIGH) << 32) | pWord[2];
+    size_t entrySize, offset;
+    uint8_t *pEntry;
+    uint32_t i;
+
+    switch (mode) {
+    case DMA_SRAM:
+        SwModelSramStore((uint32_t)addr, pDout, size);
+        break;
+    case DMA_DLLI:
+        memcpy((uint8_t *)(uintptr_t)addr, pDout, size);
+        break;
+    case DMA_MLLI:
+        for (i = 0, offset = 0; offset < size; i++) {
+            pEntry = SwModelMlliEntry(pWord[2], i, &entrySize);
+            if (entrySize > size - offset) {
+                entrySize = size - offset;
+            }
+            memcpy(pEntry, pDout + offset, entrySize);
+            offset += entrySize;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static uint32_t SwModelFlowPsPerByte(uint32_t flow)
+{
+    switch (flow) {
+    case BYPASS:
+        return gSwModelLatency.bypassPsPerByte;
+    case DIN_HASH:
+    case HASH_to_DOUT:
+    case DIN_HASH_and_BYPASS:
+        return gSwModelLatency.hashPsPerByte;
+    case AES_to_HASH:
+    case AES_and_HASH:
+    case DES_to_HASH:
+    case DES_and_HASH:
+    case AES_to_HASH_and_DOUT:
+    case DES_to_HASH_and_DOUT:
+    case AES_to_AES_to_HASH_and_DOUT:
+    case AES_to_AES_to_HASH:
+    case AES_to_HASH_and_AES:
+        return (gSwModelLatency.aesPsPerByte > gSwModelLatency.hashPsPerByte) ?
+               gSwModelLatency.aesPsPerByte : gSwModelLatency.hashPsPerByte;
+    default:
+        if (flow >= S_DIN_to_AES) {
+            return gSwModelLatency.bypassPsPerByte;
+        }
+        return gSwModelLatency.aesPsPerByte;
+    }
+}
+
+/* executes the descriptor held in the queue words */
+static void SwModelExecDesc(uint64_t nowNs)
+{
+    const uint32_t *pWord = gSwModelState.desc;
+    uint32_t flow = SW_MODEL_DESC_FLD(WORD4, DATA_FLOW_MODE);
+    uint32_t setup = SW_MODEL_DESC_FLD(WORD4, SETUP_OPERATION);
+    size_t dinSize = SwModelDinSize(pWord);
+    size_t doutSize = SwModelDoutSize(pWord);
+    size_t outLen = 0;
+    uint64_t costNs;
+
+    if (SwModelBuffReserve((dinSize > doutSize) ? dinSize : doutSize) != 0) {
+        CC_PAL_LOG_ERR("sw model: failed to allocate %zu bytes\n", dinSize);
+        gSwModelState.irr |= CC_REG_BIT_MASK(HOST_RGF_IRR, AXI_ERR_INT);
+        return;
+    }
+    SwModelDinGather(pWord, gSwModelDin, dinSize);
+
+    switch (flow) {
+    case BYPASS:
+        outLen = (dinSize < doutSize) ? dinSize : doutSize;
+        memcpy(gSwModelDout, gSwModelDin, outLen);
+        break;
+    case DIN_AES_DOUT:
+        outLen = SwModelAesProcess(pWord, gSwModelDin, gSwModelDout, dinSize);
+        break;
+    case DIN_HASH:
+        SwModelHashProcess(pWord, gSwModelDin, dinSize);
+        break;
+    case S_DIN_to_AES:
+    case S_DIN_to_AES2:
+        SwModelAesLoad(pWord, gSwModelDin, dinSize);
+        break;
+    case S_AES_to_DOUT:
+    case S_AES2_to_DOUT:
+        outLen = SwModelAesStore(pWord, gSwModelDout, doutSize);
+        break;
+    case S_DIN_to_HASH:
+        SwModelHashLoad(pWord, gSwModelDin, dinSize);
+        break;
+    case S_HASH_to_DOUT:
+        outLen = SwModelHashStore(pWord, gSwModelDout, doutSize);
+        break;
+    default:
+        /* DES, SM4, RC4 and the combined flows are modeled for timing only */
+        if (flow < S_DIN_to_AES) {
+            outLen = (dinSize < doutSize) ? dinSize : doutSize;
+            memcpy(gSwModelDout, gSwModelDin, outLen);
+        }
+        break;
+    }
+    CC_UNUSED_PARAM(setup);
+
+    if (outLen > doutSize) {
+        outLen = doutSize;
+    }
+    SwModelDoutScatter(pWord, gSwModelDout, outLen);
+
+    costNs = gSwModelLatency.descNs +
+             ((uint64_t)(dinSize + outLen) * SwModelFlowPsPerByte(flow)) / 1000;
+    SwModelSchedule(&gSwModelState.symBusyUntil, nowNs, costNs);
+
+    gSwModelStats.descriptors++;
+    gSwModelStats.dmaBytes += dinSize + outLen;
+
+    if (SW_MODEL_DESC_FLD(WORD3, DOUT_LAST_IND) != 0) {
+        gSwModelState.compPending++;
+        gSwModelState.compDeadline = gSwModelState.symBusyUntil;
+        gSwModelStats.completions++;
+    }
+}
+
+static void SwModelExecPka(uint32_t opcode, uint64_t nowNs)
+{
+    uint64_t mulWords2;
+    uint64_t costNs;
+
+    mulWords2 = SwModelPkaExec(opcode, &gSwModelState.pkaStatus);
+
+    costNs = gSwModelLatency.pkaOpNs + (mulWords2 * gSwModelLatency.pkaMulPsPerWord2) / 1000;
+    SwModelSchedule(&gSwModelState.pkaBusyUntil, nowNs, costNs);
+
+    gSwModelStats.pkaOps++;
+}
+
+static void SwModelLatencyParse(const char *pEnv)
+{
+    char env[SW_MODEL_LATENCY_ENV_MAX];
+    char *pSave = NULL;
+    char *pTok;
+    char *pVal;
+    uint32_t val;
+
+    if (strcmp(pEnv, "off") == 0) {
+        memset(&gSwModelLatency, 0, sizeof(gSwModelLatency));
+        return;
+    }
+
+    strncpy(env, pEnv, sizeof(env) - 1);
+    env[sizeof(env) - 1] = '\0';
+
+    for (pTok = strtok_r(env, ",", &pSave); pTok != NULL; pTok = strtok_r(NULL, ",", &pSave)) {
+        pVal = strchr(pTok, '=');
+        if (pVal == NULL) {
+            CC_PAL_LOG_ERR("sw model: ignoring latency token %s\n", pTok);
+            continue;
+        }
+        *pVal++ = '\0';
+        val = (uint32_t)strtoul(pVal, NULL, 0);
+
+        if (strcmp(pTok, "desc") == 0) {
+            gSwModelLatency.descNs = val;
+        } else if (strcmp(pTok, "bypass") == 0) {
+            gSwModelLatency.bypassPsPerByte = val;
+        } else if (strcmp(pTok, "aes") == 0) {
+            gSwModelLatency.aesPsPerByte = val;
+        } else if (strcmp(pTok, "hash") == 0) {
+            gSwModelLatency.hashPsPerByte = val;
+        } else if (strcmp(pTok, "pka") == 0) {
+            gSwModelLatency.pkaOpNs = val;
+        } else if (strcmp(pTok, "mul") == 0) {
+            gSwModelLatency.pkaMulPsPerWord2 = val;
+        } else if (strcmp(pTok, "trng") == 0) {
+            gSwModelLatency.trngEhrNs = val;
+        } else {
+            CC_PAL_LOG_ERR("sw model: ignoring latency token %s\n", pTok);
+        }
+    }
+}
+
+static uint32_t SwModelRead(uint32_t regOffset)
+{
+    uint32_t val;
+
+    switch (regOffset) {
+    case CC_REG_OFFSET(HOST_RGF, HOST_RGF_IRR):
+        SwModelMature();
+        return gSwModelState.irr;
+    case CC_REG_OFFSET(HOST_RGF, AXIM_MON_COMP):
+        SwModelMature();
+        val = gSwModelState.monComp;
+        gSwModelState.monComp = 0;
+        return val;
+    case CC_REG_OFFSET(HOST_RGF, AXIM_MON_ERR):
+        return 0;
+    case CC_REG_OFFSET(CRY_KERNEL, DSCRPTR_QUEUE_CONTENT):
+        /* descriptors execute on push, the queue is never occupied */
+        return HW_QUEUE_SLOTS_MAX;
+    case CC_REG_OFFSET(HOST_RGF, SRAM_DATA):
+        if (gSwModelState.sramPrimed == 0) {
+            gSwModelState.sramPrimed = 1;
+            return 0;
+        }
+        val = SwModelSramWord(gSwModelState.sramAddr);
+        gSwModelState.sramAddr += sizeof(uint32_t);
+        return val;
+    case CC_REG_OFFSET(HOST_RGF, SRAM_DATA_READY):
+        return 1;
+    case CC_REG_OFFSET(HOST_RGF, HOST_LOW_RES_SECURE_TIMER_0):
+        return SwModelTimerRead(0);
+    case CC_REG_OFFSET(HOST_RGF, HOST_LOW_RES_SECURE_TIMER_1):
+        return SwModelTimerRead(1);
+    case CC_REG_OFFSET(CRY_KERNEL, PKA_DONE):
+        return (SwModelNowNs() >= gSwModelState.pkaBusyUntil) ? 1 : 0;
+    case CC_REG_OFFSET(CRY_KERNEL, PKA_PIPE_RDY):
+        /* opcodes are queued behind the modeled pipeline */
+        return 1;
+    case CC_REG_OFFSET(CRY_KERNEL, PKA_STATUS):
+        return gSwModelState.pkaStatus;
+    case CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_RDATA):
+        return SwModelPkaSramRead(gSwModelState.pkaRAddr++);
+    case CC_REG_OFFSET(RNG, RNG_ISR):
+        SwModelMature();
+        return gSwModelState.rngIsr;
+    case CC_REG_OFFSET(RNG, EHR_DATA_0):
+    case CC_REG_OFFSET(RNG, EHR_DATA_1):
+    case CC_REG_OFFSET(RNG, EHR_DATA_2):
+    case CC_REG_OFFSET(RNG, EHR_DATA_3):
+    case CC_REG_OFFSET(RNG, EHR_DATA_4):
+    case CC_REG_OFFSET(RNG, EHR_DATA_5):
+        return gSwModelState.ehr[(regOffset - CC_REG_OFFSET(RNG, EHR_DATA_0)) / sizeof(uint32_t)];
+    default:
+        return gSwModelRegs[SW_MODEL_REG_IDX(regOffset)];
+    }
+}
+
+static void SwModelWrite(uint32_t regOffset, uint32_t val)
+{
+    uint64_t nowNs;
+
+    switch (regOffset) {
+    case CC_REG_OFFSET(HOST_RGF, HOST_RGF_ICR):
+        gSwModelState.irr &= ~val;
+        break;
+    case CC_REG_OFFSET(CRY_KERNEL, DSCRPTR_QUEUE_WORD0):
+    case CC_REG_OFFSET(CRY_KERNEL, DSCRPTR_QUEUE_WORD1):
+    case CC_REG_OFFSET(CRY_KERNEL, DSCRPTR_QUEUE_WORD2):
+    case CC_REG_OFFSET(CRY_KERNEL, DSCRPTR_QUEUE_WORD3):
+    case CC_REG_OFFSET(CRY_KERNEL, DSCRPTR_QUEUE_WORD4):
+        gSwModelState.desc[(regOffset - CC_REG_OFFSET(CRY_KERNEL, DSCRPTR_QUEUE_WORD0)) / sizeof(uint32_t)] = val;
+        break;
+    case CC_REG_OFFSET(CRY_KERNEL, DSCRPTR_QUEUE_WORD5):
+        /* writing the last word pushes the descriptor */
+        nowNs = SwModelNowNs();
+        gSwModelState.desc[CC_DSCRPTR_QUEUE_WORD5_IDX] = val;
+        SwModelExecDesc(nowNs);
+        break;
+    case CC_REG_OFFSET(HOST_RGF, SRAM_ADDR):
+        gSwModelState.sramAddr = val;
+        gSwModelState.sramPrimed = 0;
+        break;
+    case CC_REG_OFFSET(HOST_RGF, SRAM_DATA):
+        SwModelSramStore(gSwModelState.sramAddr, (const uint8_t *)&val, sizeof(val));
+        gSwModelState.sramAddr += sizeof(uint32_t);
+        break;
+    case CC_REG_OFFSET(HOST_RGF, HOST_LOW_RES_SECURE_TIMER_RST):
+        gSwModelState.timerBase = SwModelNowNs();
+        break;
+    case CC_REG_OFFSET(CRY_KERNEL, OPCODE):
+        SwModelExecPka(val, SwModelNowNs());
+        break;
+    case CC_REG_OFFSET(CRY_KERNEL, PKA_SW_RESET):
+        SwModelPkaReset();
+        gSwModelState.pkaStatus = 0;
+        gSwModelState.pkaBusyUntil = 0;
+        break;
+    case CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_ADDR):
+        gSwModelState.pkaWAddr = val;
+        break;
+    case CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_WDATA):
+        SwModelPkaSramWrite(gSwModelState.pkaWAddr++, val);
+        break;
+    case CC_REG_OFFSET(CRY_KERNEL, PKA_SRAM_RADDR):
+        gSwModelState.pkaRAddr = val;
+        break;
+    case CC_REG_OFFSET(RNG, RND_SOURCE_ENABLE):
+        if ((val & 1) && (gSwModelState.ehrPending == 0)) {
+            gSwModelState.ehrPending = 1;
+            gSwModelState.ehrDeadline = SwModelNowNs() + gSwModelLatency.trngEhrNs;
+        } else if ((val & 1) == 0) {
+            gSwModelState.ehrPending = 0;
+        }
+        gSwModelRegs[SW_MODEL_REG_IDX(regOffset)] = val;
+        break;
+    case CC_REG_OFFSET(RNG, RNG_ICR):
+        gSwModelState.rngIsr &= ~val;
+        break;
+    case CC_REG_OFFSET(RNG, RNG_SW_RESET):
+        gSwModelState.rngIsr = 0;
+        gSwModelState.ehrPending = 0;
+        break;
+    default:
+        gSwModelRegs[SW_MODEL_REG_IDX(regOffset)] = val;
+        break;
+    }
+}
+
+/******************************************************************************
+*				FUNCTIONS
+******************************************************************************/
+
+uint32_t SwModelRegGet(uint32_t regOffset)
+{
+    return gSwModelRegs[SW_MODEL_REG_IDX(regOffset)];
+}
+
+CCError_t CC_HalSwModelInit(void)
+{
+    const char *pEnv;
+    uint32_t lcs = CC_LCS_CHIP_MANUFACTURE_LCS;
+
+    pthread_mutex_lock(&gSwModelLock);
+
+    memset(gSwModelRegs, 0, sizeof(gSwModelRegs));
+    memset(gSwModelSram, 0, sizeof(gSwModelSram));
+    memset(&gSwModelState, 0, sizeof(gSwModelState));
+    memset(&gSwModelStats, 0, sizeof(gSwModelStats));
+    gSwModelState.trngSeed = 0x9E3779B97F4A7C15ULL;
+    gSwModelState.timerBase = SwModelNowNs();
+
+    pEnv = getenv(CC_HAL_SW_MODEL_LATENCY_ENV);
+    if (pEnv != NULL) {
+        SwModelLatencyParse(pEnv);
+    }
+    pEnv = getenv(CC_HAL_SW_MODEL_LCS_ENV);
+    if (pEnv != NULL) {
+        lcs = (uint32_t)strtoul(pEnv, NULL, 0);
+    }
+
+    /* identification and power-on values read by CC_LibInit */
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, PERIPHERAL_ID_0))] = CC_PID_0_VAL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, PERIPHERAL_ID_1))] = CC_PID_1_VAL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, PERIPHERAL_ID_2))] = CC_PID_2_VAL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, PERIPHERAL_ID_3))] = CC_PID_3_VAL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, PERIPHERAL_ID_4))] = CC_PID_4_VAL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, COMPONENT_ID_0))] = CC_CID_0_VAL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, COMPONENT_ID_1))] = CC_CID_1_VAL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, COMPONENT_ID_2))] = CC_CID_2_VAL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, COMPONENT_ID_3))] = CC_CID_3_VAL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, NVM_IS_IDLE))] = 1;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, LCS_IS_VALID))] = 1;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, LCS_REG))] = lcs & CC_REG_BIT_MASK(LCS_REG, LCS_REG);
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(HOST_RGF, HOST_RGF_IMR))] = 0xFFFFFFFFUL;
+    gSwModelRegs[SW_MODEL_REG_IDX(CC_REG_OFFSET(CRY_KERNEL, N_NP_T0_T1_ADDR))] = 0x000FF820;
+
+    SwModelAesReset();
+    SwModelHashReset();
+    SwModelPkaReset();
+
+    pthread_mutex_unlock(&gSwModelLock);
+
+    return CC_OK;
+}
+
+void CC_HalSwModelTerminate(void)
+{
+    pthread_mutex_lock(&gSwModelLock);
+
+    free(gSwModelDin);
+    free(gSwModelDout);
+    gSwModelDin = NULL;
+    gSwModelDout = NULL;
+    gSwModelBuffSize = 0;
+
+    pthread_mutex_unlock(&gSwModelLock);
+}
+
+uint32_t CC_HalSwModelRead(unsigned long regOffset)
+{
+    uint32_t val;
+
+    pthread_mutex_lock(&gSwModelLock);
+    val = SwModelRead((uint32_t)regOffset & (SW_MODEL_REG_AREA_LEN - 1));
+    pthread_mutex_unlock(&gSwModelLock);
+
+    return val;
+}
+
+void CC_HalSwModelWrite(unsigned long regOffset, uint32_t val)
+{
+    pthread_mutex_lock(&gSwModelLock);
+    SwModelWrite((uint32_t)regOffset & (SW_MODEL_REG_AREA_LEN - 1), val);
+    pthread_mutex_unlock(&gSwModelLock);
+}
+
+void CC_HalSwModelReadBlock(unsigned long regOffset, uint32_t *pBuff, uint32_t sizeWords)
+{
+    uint32_t i;
+
+    pthread_mutex_lock(&gSwModelLock);
+    for (i = 0; i < sizeWords; i++) {
+        pBuff[i] = SwModelRead((uint32_t)regOffset & (SW_MODEL_REG_AREA_LEN - 1));
+    }
+    pthread_mutex_unlock(&gSwModelLock);
+}
+
+void CC_HalSwModelWriteBlock(unsigned long regOffset, const uint32_t *pBuff, uint32_t sizeWords)
+{
+    uint32_t i;
+
+    pthread_mutex_lock(&gSwModelLock);
+    for (i = 0; i < sizeWords; i++) {
+        SwModelWrite((uint32_t)regOffset & (SW_MODEL_REG_AREA_LEN - 1), (pBuff == NULL) ? 0 : pBuff[i]);
+    }
+    pthread_mutex_unlock(&gSwModelLock);
+}
+
+void CC_HalSwModelLatencySet(const CCHalSwModelLatency_t *pLatency)
+{
+    if (pLatency == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&gSwModelLock);
+    gSwModelLatency = *pLatency;
+    pthread_mutex_unlock(&gSwModelLock);
+}
+
+void CC_HalSwModelLatencyGet(CCHalSwModelLatency_t *pLatency)
+{
+    if (pLatency == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&gSwModelLock);
+    *pLatency = gSwModelLatency;
+    pthread_mutex_unlock(&gSwModelLock);
+}
+
+void CC_HalSwModelStatsGet(CCHalSwModelStats_t *pStats)
+{
+    if (pStats == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&gSwModelLock);
+    *pStats = gSwModelStats;
+    pthread_mutex_unlock(&gSwModelLock);
+}
+
+void CC_HalSwModelStatsReset(void)
+{
+    pthread_mutex_lock(&gSwModelLock);
+    memset(&gSwModelStats, 0, sizeof(gSwModelStats));
+    pthread_mutex_unlock(&gSwModelLock);
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+ /*!
+ @file
+ @brief This file contains the software model of the CryptoCell register file.
+
+        When the library is built with \c CC_HAL_SW_MODEL, register accesses are routed to
+        a user-space model of the register file, the descriptor queue, the DMA, the SRAM,
+        the AES, HASH and BYPASS engines, the PKA and the TRNG, instead of the memory-mapped
+        hardware. Completion of every engine operation is delayed according to a latency
+        model, so that driver-side overhead can be measured on a plain host.
+ */
+
+ /*!
+ @ingroup cc_hal_register
+ @{
+     */
+
+#ifndef __CC_HAL_SW_MODEL_H__
+#define __CC_HAL_SW_MODEL_H__
+
+#include <stdint.h>
+#include "cc_pal_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/******************************************************************************
+*				DEFINITIONS
+******************************************************************************/
+
+/*! Environment variable overriding the default latency model, for example
+    "desc=50,bypass=250,aes=800,hash=1000,pka=100,mul=400,trng=20000".
+    The value "off" disables the latency model. */
+#define CC_HAL_SW_MODEL_LATENCY_ENV     "CC_SW_MODEL_LATENCY"
+
+/*! Environment variable selecting the modeled life-cycle state (default CM). */
+#define CC_HAL_SW_MODEL_LCS_ENV         "CC_SW_MODEL_LCS"
+
+/******************************************************************************
+*				TYPE DEFINITIONS
+******************************************************************************/
+
+/*! Latency model of the engines. A zero value removes the related cost. */
+typedef struct {
+    uint32_t descNs;            /*!< Fixed cost of every descriptor, in nanoseconds. */
+    uint32_t bypassPsPerByte;   /*!< BYPASS and DMA cost, in picoseconds per byte. */
+    uint32_t aesPsPerByte;      /*!< AES, DES and SM4 cost, in picoseconds per byte. */
+    uint32_t hashPsPerByte;     /*!< HASH and SM3 cost, in picoseconds per byte. */
+    uint32_t pkaOpNs;           /*!< Fixed cost of every PKA opcode, in nanoseconds. */
+    uint32_t pkaMulPsPerWord2;  /*!< PKA multiplier cost, in picoseconds per squared operand word. */
+    uint32_t trngEhrNs;         /*!< Time to fill the TRNG EHR, in nanoseconds. */
+} CCHalSwModelLatency_t;
+
+/*! Activity counters of the model. */
+typedef struct {
+    uint64_t descriptors;       /*!< Descriptors executed. */
+    uint64_t completions;       /*!< Descriptors with a last indication. */
+    uint64_t dmaBytes;          /*!< Bytes moved by DIN and DOUT. */
+    uint64_t pkaOps;            /*!< PKA opcodes executed. */
+    uint64_t trngEhrs;          /*!< TRNG EHR fills. */
+    uint64_t modeledNs;         /*!< Total modeled engine time, in nanoseconds. */
+} CCHalSwModelStats_t;
+
+/******************************************************************************
+*				FUNCTIONS
+******************************************************************************/
+
+/*!
+ * @brief This function resets the model to its power-on state. It is called by ::CC_HalInit.
+ *
+ * @return \c CC_OK on success.
+ * @return A non-zero value on failure.
+ */
+CCError_t CC_HalSwModelInit(void);
+
+/*!
+ * @brief This function releases the resources of the model. It is called by ::CC_HalTerminate.
+ */
+void CC_HalSwModelTerminate(void);
+
+/*!
+ * @brief This function reads a register of the model.
+ *
+ * @return The value of the register.
+ */
+uint32_t CC_HalSwModelRead(
+        /*! [in] The offset of the register. */
+        unsigned long regOffset);
+
+/*!
+ * @brief This function writes a register of the model.
+ */
+void CC_HalSwModelWrite(
+        /*! [in] The offset of the register. */
+        unsigned long regOffset,
+        /*! [in] The value to write. */
+        uint32_t val);
+
+/*!
+ * @brief This function reads a block of words from one register of the model, for the data
+ *        registers that advance their address on every access.
+ */
+void CC_HalSwModelReadBlock(
+        /*! [in] The offset of the register. */
+        unsigned long regOffset,
+        /*! [out] The output buffer. */
+        uint32_t *pBuff,
+        /*! [in] The number of words to read. */
+        uint32_t sizeWords);
+
+/*!
+ * @brief This function writes a block of words to one register of the model, for the data
+ *        registers that advance their address on every access.
+ */
+void CC_HalSwModelWriteBlock(
+        /*! [in] The offset of the register. */
+        unsigned long regOffset,
+        /*! [in] The input buffer, or NULL to write zeros. */
+        const uint32_t *pBuff,
+        /*! [in] The number of words to write. */
+        uint32_t sizeWords);
+
+/*!
+ * @brief This function sets the latency model.
+ */
+void CC_HalSwModelLatencySet(
+        /*! [in] The latency model. */
+        const CCHalSwModelLatency_t *pLatency);
+
+/*!
+ * @brief This function returns the latency model in use.
+ */
+void CC_HalSwModelLatencyGet(
+        /*! [out] The latency model. */
+        CCHalSwModelLatency_t *pLatency);
+
+/*!
+ * @brief This function returns a snapshot of the activity counters.
+ */
+void CC_HalSwModelStatsGet(
+        /*! [out] The activity counters. */
+        CCHalSwModelStats_t *pStats);
+
+/*!
+ * @brief This function clears the activity counters.
+ */
+void CC_HalSwModelStatsReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/*!
+ @}
+ */
+
+#endif /*__CC_HAL_SW_MODEL_H__*/
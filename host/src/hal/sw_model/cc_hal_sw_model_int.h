@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef __CC_HAL_SW_MODEL_INT_H__
+#define __CC_HAL_SW_MODEL_INT_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************
+*				DEFINITIONS
+******************************************************************************/
+
+#define SW_MODEL_REG_AREA_LEN           0x100000
+#define SW_MODEL_SRAM_SIZE              0x10000
+#define SW_MODEL_PKA_SRAM_SIZE_WORDS    (CC_PKA_SRAM_SIZE_IN_KBYTES * 1024 / sizeof(uint32_t))
+
+#define SW_MODEL_AES_BLOCK_SIZE         16
+
+/* extracts a field of the descriptor held in pWord (requires cc_regs.h) */
+#define SW_MODEL_DESC_FLD(word, fld)    CC_REG_FLD_GET(0, DSCRPTR_QUEUE_ ## word, fld, pWord[CC_DSCRPTR_QUEUE_ ## word ## _IDX])
+
+/* indexes of the descriptor words */
+#define CC_DSCRPTR_QUEUE_WORD0_IDX      0
+#define CC_DSCRPTR_QUEUE_WORD1_IDX      1
+#define CC_DSCRPTR_QUEUE_WORD2_IDX      2
+#define CC_DSCRPTR_QUEUE_WORD3_IDX      3
+#define CC_DSCRPTR_QUEUE_WORD4_IDX      4
+#define CC_DSCRPTR_QUEUE_WORD5_IDX      5
+
+/******************************************************************************
+*				FUNCTIONS
+******************************************************************************/
+
+/* Register file access without locking, for the engines */
+uint32_t SwModelRegGet(uint32_t regOffset);
+
+/* AES engine */
+void SwModelAesReset(void);
+void SwModelAesLoad(const uint32_t *pWord, const uint8_t *pIn, size_t inLen);
+size_t SwModelAesStore(const uint32_t *pWord, uint8_t *pOut, size_t outLen);
+size_t SwModelAesProcess(const uint32_t *pWord, const uint8_t *pIn, uint8_t *pOut, size_t len);
+
+/* HASH engine */
+void SwModelHashReset(void);
+void SwModelHashLoad(const uint32_t *pWord, const uint8_t *pIn, size_t inLen);
+size_t SwModelHashStore(const uint32_t *pWord, uint8_t *pOut, size_t outLen);
+void SwModelHashProcess(const uint32_t *pWord, const uint8_t *pIn, size_t len);
+
+/* PKA engine; returns the modeled cost in squared operand words */
+void SwModelPkaReset(void);
+uint32_t SwModelPkaSramRead(uint32_t wordAddr);
+void SwModelPkaSramWrite(uint32_t wordAddr, uint32_t val);
+uint64_t SwModelPkaExec(uint32_t opcode, uint32_t *pStatus);
+
+#endif /*__CC_HAL_SW_MODEL_INT_H__*/
@@ -0,0 +1,673 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/*
+ * Software model of the PKA engine.
+ *
+ * The operands are read from the PKA SRAM through the registers mapping table and the
+ * sizes table, exactly as the HW does. Modular results are always fully reduced, which
+ * is a valid result of the "no final reduction" opcodes as well.
+ */
+
+#include <string.h>
+
+#include "cc_pal_types.h"
+#include "cc_regs.h"
+#include "cc_registers.h"
+#include "cc_reg_base_host.h"
+#include "cc_sram_map.h"
+#include "cc_hal_sw_model_int.h"
+
+/******************************************************************************
+*				DEFINITIONS
+******************************************************************************/
+
+/* the largest operand, 4096 bits plus extra PKA words, in 32-bit words */
+#define SW_MODEL_PKA_OP_WORDS_MAX       160
+#define SW_MODEL_PKA_PROD_WORDS_MAX     (2 * SW_MODEL_PKA_OP_WORDS_MAX + 2)
+#define SW_MODEL_PKA_WORD_BITS          128
+#define SW_MODEL_PKA_LEN_IDS            8
+#define SW_MODEL_PKA_VIRT_REGS          32
+
+/* opcode fields */
+#define SW_MODEL_PKA_FLD(opcode, fld)   CC_REG_FLD_GET(0, OPCODE, fld, (opcode))
+#define SW_MODEL_PKA_OPERAND_FLAG       0x20    /* immediate or discard indication */
+#define SW_MODEL_PKA_OPERAND_MASK       0x1F
+
+/* operation identifiers, see pka_hw_defs.h */
+#define SW_MODEL_PKA_OP_TERMINATE       0x00
+#define SW_MODEL_PKA_OP_ADD             0x04
+#define SW_MODEL_PKA_OP_SUB             0x05
+#define SW_MODEL_PKA_OP_MODADD          0x06
+#define SW_MODEL_PKA_OP_MODSUB          0x07
+#define SW_MODEL_PKA_OP_AND             0x08
+#define SW_MODEL_PKA_OP_OR              0x09
+#define SW_MODEL_PKA_OP_XOR             0x0A
+#define SW_MODEL_PKA_OP_SHR0            0x0C
+#define SW_MODEL_PKA_OP_SHR1            0x0D
+#define SW_MODEL_PKA_OP_SHL0            0x0E
+#define SW_MODEL_PKA_OP_SHL1            0x0F
+#define SW_MODEL_PKA_OP_MULLOW          0x10
+#define SW_MODEL_PKA_OP_MODMUL          0x11
+#define SW_MODEL_PKA_OP_MODMULN         0x12
+#define SW_MODEL_PKA_OP_MODEXP          0x13
+#define SW_MODEL_PKA_OP_DIVISION        0x14
+#define SW_MODEL_PKA_OP_MODINV          0x15
+#define SW_MODEL_PKA_OP_MULHIGH         0x17
+#define SW_MODEL_PKA_OP_MODMLAC         0x18
+#define SW_MODEL_PKA_OP_MODMLACNR       0x19
+#define SW_MODEL_PKA_OP_SEPINT          0x1A
+#define SW_MODEL_PKA_OP_REDUCTION       0x1B
+
+#define SW_MODEL_PKA_STATUS_MASK        (CC_REG_BIT_MASK(PKA_STATUS, ALU_CARRY) | \
+                                         CC_REG_BIT_MASK(PKA_STATUS, ALU_OUT_ZERO) | \
+                                         CC_REG_BIT_MASK(PKA_STATUS, DIV_BY_ZERO))
+
+/******************************************************************************
+*				GLOBALS
+******************************************************************************/
+
+static uint32_t gSwModelPkaSram[SW_MODEL_PKA_SRAM_SIZE_WORDS];
+
+/* scratch operands; the model is serialized by the register file lock */
+static uint32_t gSwModelPkaA[SW_MODEL_PKA_PROD_WORDS_MAX];
+static uint32_t gSwModelPkaB[SW_MODEL_PKA_PROD_WORDS_MAX];
+static uint32_t gSwModelPkaC[SW_MODEL_PKA_PROD_WORDS_MAX];
+static uint32_t gSwModelPkaN[SW_MODEL_PKA_PROD_WORDS_MAX];
+static uint32_t gSwModelPkaR[SW_MODEL_PKA_PROD_WORDS_MAX];
+static uint32_t gSwModelPkaProd[SW_MODEL_PKA_PROD_WORDS_MAX];
+static uint32_t gSwModelPkaQuot[SW_MODEL_PKA_PROD_WORDS_MAX];
+static uint32_t gSwModelPkaT0[SW_MODEL_PKA_PROD_WORDS_MAX + 1];
+static uint32_t gSwModelPkaT1[SW_MODEL_PKA_PROD_WORDS_MAX + 1];
+static uint32_t gSwModelPkaT2[SW_MODEL_PKA_PROD_WORDS_MAX + 1];
+static uint32_t gSwModelPkaT3[SW_MODEL_PKA_PROD_WORDS_MAX + 1];
+static uint32_t gSwModelPkaT4[SW_MODEL_PKA_PROD_WORDS_MAX + 1];
+
+/******************************************************************************
+*				PRIVATE FUNCTIONS - BIG NUMBERS
+******************************************************************************/
+
+static uint32_t SwModelBnIsZero(const uint32_t *pA, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        if (pA[i] != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* returns the count of significant words */
+static uint32_t SwModelBnWords(const uint32_t *pA, uint32_t n)
+{
+    while ((n > 0) && (pA[n - 1] == 0)) {
+        n--;
+    }
+    return n;
+}
+
+static int SwModelBnCmp(const uint32_t *pA, const uint32_t *pB, uint32_t n)
+{
+    while (n-- > 0) {
+        if (pA[n] != pB[n]) {
+            return (pA[n] > pB[n]) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t SwModelBnAdd(uint32_t *pR, const uint32_t *pA, const uint32_t *pB, uint32_t n)
+{
+    uint64_t acc = 0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        acc += (uint64_t)pA[i] + pB[i];
+        pR[i] = (uint32_t)acc;
+        acc >>= 32;
+    }
+    return (uint32_t)acc;
+}
+
+/* returns the borrow */
+static uint32_t SwModelBnSub(uint32_t *pR, const uint32_t *pA, const uint32_t *pB, uint32_t n)
+{
+    uint64_t diff;
+    uint32_t borrow = 0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        diff = (uint64_t)pA[i] - pB[i] - borrow;
+        pR[i] = (uint32_t)diff;
+        borrow = (uint32_t)(diff >> 63);
+    }
+    return borrow;
+}
+
+/* pR[na + nb] = pA[na] * pB[nb]; pR must not overlap the operands */
+static void SwModelBnMul(uint32_t *pR, const uint32_t *pA, uint32_t na, const uint32_t *pB, uint32_t nb)
+{
+    uint64_t acc;
+    uint32_t i, j;
+
+    memset(pR, 0, (na + nb) * sizeof(uint32_t));
+    for (i = 0; i < na; i++) {
+        if (pA[i] == 0) {
+            continue;
+        }
+        acc = 0;
+        for (j = 0; j < nb; j++) {
+            acc += (uint64_t)pA[i] * pB[j] + pR[i + j];
+            pR[i + j] = (uint32_t)acc;
+            acc >>= 32;
+        }
+        pR[i + nb] = (uint32_t)acc;
+    }
+}
+
+static uint32_t SwModelNlz(uint32_t x)
+{
+    uint32_t n = 0;
+
+    while ((x & 0x80000000UL) == 0) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+}
+
+/*
+ * Long division (Knuth, algorithm D): pQ[m - n + 1] = pU[m] / pV[n] and pRem[n] = pU mod pV.
+ * pV[n - 1] must be non-zero and m >= n. Either output may be NULL.
+ */
+static void SwModelBnDivMod(uint32_t *pQ, uint32_t *pRem,
+                            const uint32_t *pU, uint32_t m,
+                            const uint32_t *pV, uint32_t n)
+{
+    uint32_t *pUn = gSwModelPkaT0;
+    uint32_t *pVn = gSwModelPkaT1;
+    uint64_t qhat, rhat, p, k64;
+    int64_t t, k;
+    uint32_t s, i;
+    int32_t j;
+
+    if (n == 1) {
+        k64 = 0;
+        for (j = (int32_t)m - 1; j >= 0; j--) {
+            k64 = (k64 << 32) | pU[j];
+            if (pQ != NULL) {
+                pQ[j] = (uint32_t)(k64 / pV[0]);
+            }
+            k64 %= pV[0];
+        }
+        if (pRem != NULL) {
+            pRem[0] = (uint32_t)k64;
+        }
+        return;
+    }
+
+    /* normalize so that the divisor MS bit is set */
+    s = SwModelNlz(pV[n - 1]);
+    for (i = n - 1; i > 0; i--) {
+        pVn[i] = (s == 0) ? pV[i] : ((pV[i] << s) | (pV[i - 1] >> (32 - s)));
+    }
+    pVn[0] = pV[0] << s;
+
+    pUn[m] = (s == 0) ? 0 : (pU[m - 1] >> (32 - s));
+    for (i = m - 1; i > 0; i--) {
+        pUn[i] = (s == 0) ? pU[i] : ((pU[i] << s) | (pU[i - 1] >> (32 - s)));
+    }
+    pUn[0] = pU[0] << s;
+
+    for (j = (int32_t)(m - n); j >= 0; j--) {
+        /* estimate the quotient digit */
+        k64 = ((uint64_t)pUn[j + n] << 32) | pUn[j + n - 1];
+        qhat = k64 / pVn[n - 1];
+        rhat = k64 % pVn[n - 1];
+        while ((qhat >> 32) != 0 ||
+               (qhat * pVn[n - 2]) > ((rhat << 32) | pUn[j + n - 2])) {
+            qhat--;
+            rhat += pVn[n - 1];
+            if ((rhat >> 32) != 0) {
+                break;
+            }
+        }
+
+        /* multiply and subtract */
+        k = 0;
+        for (i = 0; i < n; i++) {
+            p = qhat * pVn[i];
+            t = (int64_t)pUn[i + j] - k - (int64_t)(p & 0xFFFFFFFFUL);
+            pUn[i + j] = (uint32_t)t;
+            k = (int64_t)(p >> 32) - (t >> 32);
+        }
+        t = (int64_t)pUn[j + n] - k;
+        pUn[j + n] = (uint32_t)t;
+
+        /* add back if the estimate was one too large */
+        if (t < 0) {
+            qhat--;
+            k64 = 0;
+            for (i = 0; i < n; i++) {
+                k64 += (uint64_t)pUn[i + j] + pVn[i];
+                pUn[i + j] = (uint32_t)k64;
+                k64 >>= 32;
+            }
+            pUn[j + n] += (uint32_t)k64;
+        }
+        if (pQ != NULL) {
+            pQ[j] = (uint32_t)qhat;
+        }
+    }
+
+    if (pRem != NULL) {
+        for (i = 0; i < n; i++) {
+            pRem[i] = (s == 0) ? pUn[i] : ((pUn[i] >> s) | (pUn[i + 1] << (32 - s)));
+        }
+    }
+}
+
+/* pR[nn] = pA[na] mod pN[nn]; pR may alias pA */
+static void SwModelBnMod(uint32_t *pR, const uint32_t *pA, uint32_t na, const uint32_t *pN, uint32_t nn)
+{
+    uint32_t nw = SwModelBnWords(pN, nn);
+    uint32_t aw = SwModelBnWords(pA, na);
+
+    if (aw < nw) {
+        memmove(pR, pA, aw * sizeof(uint32_t));
+        memset(pR + aw, 0, (nn - aw) * sizeof(uint32_t));
+        return;
+    }
+    SwModelBnDivMod(NULL, pR, pA, aw, pN, nw);
+    memset(pR + nw, 0, (nn - nw) * sizeof(uint32_t));
+}
+
+/* pR[n] = pA[n] * pB[n] mod pN[n]; pR may alias the operands */
+static void SwModelBnModMul(uint32_t *pR, const uint32_t *pA, const uint32_t *pB, const uint32_t *pN, uint32_t n)
+{
+    SwModelBnMul(gSwModelPkaProd, pA, n, pB, n);
+    SwModelBnMod(pR, gSwModelPkaProd, 2 * n, pN, n);
+}
+
+/* (pA + pN) / 2, or pA / 2 if pA is even; pA has n + 1 words */
+static void SwModelBnHalveMod(uint32_t *pA, const uint32_t *pN, uint32_t n)
+{
+    uint32_t i;
+
+    if (pA[0] & 1) {
+        pA[n] += SwModelBnAdd(pA, pA, pN, n);
+    }
+    for (i = 0; i < n; i++) {
+        pA[i] = (pA[i] >> 1) | (pA[i + 1] << 31);
+    }
+    pA[n] >>= 1;
+}
+
+/* pR = pX - pY mod pN, with pX, pY < pN */
+static void SwModelBnSubMod(uint32_t *pR, const uint32_t *pX, const uint32_t *pY, const uint32_t *pN, uint32_t n)
+{
+    if (SwModelBnSub(pR, pX, pY, n) != 0) {
+        SwModelBnAdd(pR, pR, pN, n);
+    }
+}
+
+/* pR = 1 / pB mod pN for an odd modulus (binary extended Euclid) and pG = GCD(pB, pN), as the
+   HW leaves it in operand B; returns 1 if there is no inverse. pG is not set for an even modulus */
+static uint32_t SwModelBnModInv(uint32_t *pR, uint32_t *pG, const uint32_t *pB, const uint32_t *pN, uint32_t n)
+{
+    uint32_t *pU = gSwModelPkaT2;
+    uint32_t *pV = gSwModelPkaT3;
+    uint32_t *pX1 = gSwModelPkaQuot;
+    uint32_t *pX2 = gSwModelPkaT4;
+    uint32_t i;
+
+    memset(pR, 0, n * sizeof(uint32_t));
+    if ((pN[0] & 1) == 0) {
+        return 1;
+    }
+
+    SwModelBnMod(pU, pB, n, pN, n);
+    memcpy(pV, pN, n * sizeof(uint32_t));
+    memset(pX1, 0, (n + 1) * sizeof(uint32_t));
+    memset(pX2, 0, (n + 1) * sizeof(uint32_t));
+    pX1[0] = 1;
+    pU[n] = 0;
+    pV[n] = 0;
+
+    /* the GCD is odd, so halving either value keeps it */
+    for (;;) {
+        if (SwModelBnIsZero(pU, n) || SwModelBnIsZero(pV, n)) {
+            memcpy(pG, SwModelBnIsZero(pU, n) ? pV : pU, n * sizeof(uint32_t));
+            return 1;
+        }
+        if ((SwModelBnWords(pU, n) == 1) && (pU[0] == 1)) {
+            memcpy(pR, pX1, n * sizeof(uint32_t));
+            break;
+        }
+        if ((SwModelBnWords(pV, n) == 1) && (pV[0] == 1)) {
+            memcpy(pR, pX2, n * sizeof(uint32_t));
+            break;
+        }
+        while ((pU[0] & 1) == 0) {
+            for (i = 0; i < n; i++) {
+                pU[i] = (pU[i] >> 1) | (pU[i + 1] << 31);
+            }
+            SwModelBnHalveMod(pX1, pN, n);
+        }
+        while ((pV[0] & 1) == 0) {
+            for (i = 0; i < n; i++) {
+                pV[i] = (pV[i] >> 1) | (pV[i + 1] << 31);
+            }
+            SwModelBnHalveMod(pX2, pN, n);
+        }
+        if (SwModelBnCmp(pU, pV, n) >= 0) {
+            SwModelBnSub(pU, pU, pV, n);
+            SwModelBnSubMod(pX1, pX1, pX2, pN, n);
+        } else {
+            SwModelBnSub(pV, pV, pU, n);
+            SwModelBnSubMod(pX2, pX2, pX1, pN, n);
+        }
+    }
+
+    memset(pG, 0, n * sizeof(uint32_t));
+    pG[0] = 1;
+    return 0;
+}
+
+/******************************************************************************
+*				PRIVATE FUNCTIONS - REGISTERS
+******************************************************************************/
+
+static uint32_t SwModelPkaRegAddr(uint32_t virtReg)
+{
+    return SwModelRegGet(CC_REG_OFFSET(CRY_KERNEL, MEMORY_MAP0) + sizeof(uint32_t) * (virtReg & SW_MODEL_PKA_OPERAND_MASK));
+}
+
+static void SwModelPkaRegRead(uint32_t virtReg, uint32_t *pVal, uint32_t words)
+{
+    uint32_t addr = SwModelPkaRegAddr(virtReg);
+    uint32_t i;
+
+    for (i = 0; i < words; i++) {
+        pVal[i] = ((addr + i) < SW_MODEL_PKA_SRAM_SIZE_WORDS) ? gSwModelPkaSram[addr + i] : 0;
+    }
+}
+
+static void SwModelPkaRegWrite(uint32_t virtReg, const uint32_t *pVal, uint32_t words)
+{
+    uint32_t addr = SwModelPkaRegAddr(virtReg);
+    uint32_t i;
+
+    for (i = 0; (i < words) && ((addr + i) < SW_MODEL_PKA_SRAM_SIZE_WORDS); i++) {
+        gSwModelPkaSram[addr + i] = pVal[i];
+    }
+}
+
+/* reads a register operand or sign extends a 5-bit immediate */
+static void SwModelPkaOperand(uint32_t field, uint32_t *pVal, uint32_t words)
+{
+    uint32_t imm;
+
+    if ((field & SW_MODEL_PKA_OPERAND_FLAG) != 0) {
+        imm = field & SW_MODEL_PKA_OPERAND_MASK;
+        memset(pVal, (imm & 0x10) ? 0xFF : 0x00, words * sizeof(uint32_t));
+        pVal[0] = (imm & 0x10) ? (imm | 0xFFFFFFE0UL) : imm;
+    } else {
+        SwModelPkaRegRead(field, pVal, words);
+    }
+}
+
+/******************************************************************************
+*				PUBLIC FUNCTIONS
+******************************************************************************/
+
+void SwModelPkaReset(void)
+{
+    memset(gSwModelPkaSram, 0, sizeof(gSwModelPkaSram));
+}
+
+uint32_t SwModelPkaSramRead(uint32_t wordAddr)
+{
+    return (wordAddr < SW_MODEL_PKA_SRAM_SIZE_WORDS) ? gSwModelPkaSram[wordAddr] : 0;
+}
+
+void SwModelPkaSramWrite(uint32_t wordAddr, uint32_t val)
+{
+    if (wordAddr < SW_MODEL_PKA_SRAM_SIZE_WORDS) {
+        gSwModelPkaSram[wordAddr] = val;
+    }
+}
+
+uint64_t SwModelPkaExec(uint32_t opcode, uint32_t *pStatus)
+{
+    uint32_t op = SW_MODEL_PKA_FLD(opcode, OPCODE);
+    uint32_t lenId = SW_MODEL_PKA_FLD(opcode, LEN);
+    uint32_t fieldA = SW_MODEL_PKA_FLD(opcode, REG_A);
+    uint32_t fieldB = SW_MODEL_PKA_FLD(opcode, REG_B);
+    uint32_t fieldR = SW_MODEL_PKA_FLD(opcode, REG_R);
+    uint32_t tag = SW_MODEL_PKA_FLD(opcode, TAG);
+    uint32_t *pA = gSwModelPkaA;
+    uint32_t *pB = gSwModelPkaB;
+    uint32_t *pC = gSwModelPkaC;
+    uint32_t *pN = gSwModelPkaN;
+    uint32_t *pR = gSwModelPkaR;
+    uint32_t lenBits, words, mulWords, resWords, opWords, regWords;
+    uint32_t carry = 0, divByZero = 0, writeRes = 1;
+    uint32_t shift, i;
+    uint64_t cost = 0;
+    int32_t bit;
+
+    if ((op == SW_MODEL_PKA_OP_TERMINATE) || (op == SW_MODEL_PKA_OP_SEPINT)) {
+        return 0;
+    }
+
+    /* the ALU works on whole PKA words, the multiplier on 32-bit words of the exact size */
+    lenBits = SwModelRegGet(CC_REG_OFFSET(CRY_KERNEL, PKA_L0) + sizeof(uint32_t) * (lenId % SW_MODEL_PKA_LEN_IDS));
+    mulWords = (lenBits + 31) / 32;
+    words = ((lenBits + SW_MODEL_PKA_WORD_BITS - 1) / SW_MODEL_PKA_WORD_BITS) * (SW_MODEL_PKA_WORD_BITS / 32);
+    if ((words == 0) || (words > SW_MODEL_PKA_OP_WORDS_MAX)) {
+        words = SW_MODEL_PKA_OP_WORDS_MAX;
+    }
+    if ((mulWords == 0) || (mulWords > words)) {
+        mulWords = words;
+    }
+    resWords = words;
+
+    memset(pA, 0, sizeof(gSwModelPkaA));
+    memset(pB, 0, sizeof(gSwModelPkaB));
+    memset(pR, 0, sizeof(gSwModelPkaR));
+    SwModelPkaOperand(fieldA, pA, words);
+    SwModelPkaOperand(fieldB, pB, words);
+
+    switch (op) {
+    case SW_MODEL_PKA_OP_ADD:
+        carry = SwModelBnAdd(pR, pA, pB, words);
+        break;
+    case SW_MODEL_PKA_OP_SUB:
+        carry = (SwModelBnSub(pR, pA, pB, words) == 0);
+        break;
+    case SW_MODEL_PKA_OP_AND:
+    case SW_MODEL_PKA_OP_OR:
+    case SW_MODEL_PKA_OP_XOR:
+        for (i = 0; i < words; i++) {
+            pR[i] = (op == SW_MODEL_PKA_OP_AND) ? (pA[i] & pB[i]) :
+                    (op == SW_MODEL_PKA_OP_OR) ? (pA[i] | pB[i]) : (pA[i] ^ pB[i]);
+        }
+        break;
+    case SW_MODEL_PKA_OP_SHR0:
+    case SW_MODEL_PKA_OP_SHR1:
+    case SW_MODEL_PKA_OP_SHL0:
+    case SW_MODEL_PKA_OP_SHL1:
+        /* the B field holds the shift count minus one */
+        shift = (fieldB & SW_MODEL_PKA_OPERAND_MASK) + 1;
+        for (i = 0; i < words * 32; i++) {
+            uint32_t src, val;
+
+            if ((op == SW_MODEL_PKA_OP_SHR0) || (op == SW_MODEL_PKA_OP_SHR1)) {
+                src = i + shift;
+                val = (src < words * 32) ? ((pA[src / 32] >> (src % 32)) & 1) : (op == SW_MODEL_PKA_OP_SHR1);
+            } else {
+                val = (i >= shift) ? ((pA[(i - shift) / 32] >> ((i - shift) % 32)) & 1) : (op == SW_MODEL_PKA_OP_SHL1);
+            }
+            pR[i / 32] |= val << (i % 32);
+        }
+        break;
+    case SW_MODEL_PKA_OP_MULLOW:
+    case SW_MODEL_PKA_OP_MULHIGH:
+        memset(pA + mulWords, 0, (words - mulWords) * sizeof(uint32_t));
+        memset(pB + mulWords, 0, (words - mulWords) * sizeof(uint32_t));
+        SwModelBnMul(gSwModelPkaProd, pA, mulWords, pB, mulWords);
+        if (op == SW_MODEL_PKA_OP_MULLOW) {
+            memcpy(pR, gSwModelPkaProd, mulWords * sizeof(uint32_t));
+        } else {
+            /* the high half, without the top word of the low half of the former HW */
+            memcpy(pR, gSwModelPkaProd + mulWords, mulWords * sizeof(uint32_t));
+        }
+        cost = (uint64_t)mulWords * mulWords;
+        break;
+    case SW_MODEL_PKA_OP_DIVISION:
+        if (SwModelBnIsZero(pB, words)) {
+            divByZero = 1;
+            writeRes = 0;
+            break;
+        }
+        memset(gSwModelPkaQuot, 0, sizeof(gSwModelPkaQuot));
+        memset(pC, 0, sizeof(gSwModelPkaC));
+        if (SwModelBnWords(pA, words) >= SwModelBnWords(pB, words)) {
+            SwModelBnDivMod(gSwModelPkaQuot, pC, pA, SwModelBnWords(pA, words), pB, SwModelBnWords(pB, words));
+        } else {
+            memcpy(pC, pA, words * sizeof(uint32_t));
+        }
+        memcpy(pR, gSwModelPkaQuot, words * sizeof(uint32_t));
+        /* the remainder replaces operand A */
+        if ((fieldA & SW_MODEL_PKA_OPERAND_FLAG) == 0) {
+            SwModelPkaRegWrite(fieldA, pC, words);
+        }
+        cost = (uint64_t)words * words;
+        break;
+    default:
+        /* modular operations, N is the register selected by N_NP_T0_T1; the operands may be
+           not fully reduced, so they are read with the extra PKA word of the register, which
+           the full operation size (length ID 1) already includes */
+        opWords = words;
+        regWords = SwModelRegGet(CC_REG_OFFSET(CRY_KERNEL, PKA_L0) + sizeof(uint32_t));
+        regWords = ((regWords + SW_MODEL_PKA_WORD_BITS - 1) / SW_MODEL_PKA_WORD_BITS) * (SW_MODEL_PKA_WORD_BITS / 32);
+        if (words < regWords) {
+            words += SW_MODEL_PKA_WORD_BITS / 32;
+            if (words > regWords) {
+                words = regWords;
+            }
+        }
+        if (words > SW_MODEL_PKA_OP_WORDS_MAX) {
+            words = SW_MODEL_PKA_OP_WORDS_MAX;
+        }
+        resWords = words;
+        SwModelPkaOperand(fieldA, pA, words);
+        SwModelPkaOperand(fieldB, pB, words);
+        memset(pN, 0, sizeof(gSwModelPkaN));
+        SwModelPkaRegRead(CC_REG_FLD_GET(0, N_NP_T0_T1_ADDR, N_VIRTUAL_ADDR,
+                                         SwModelRegGet(CC_REG_OFFSET(CRY_KERNEL, N_NP_T0_T1_ADDR))),
+                          pN, words);
+        if (SwModelBnIsZero(pN, words)) {
+            divByZero = 1;
+            writeRes = 0;
+            break;
+        }
+        switch (op) {
+        case SW_MODEL_PKA_OP_MODADD:
+        case SW_MODEL_PKA_OP_MODSUB:
+            SwModelBnMod(pA, pA, words, pN, words);
+            SwModelBnMod(pB, pB, words, pN, words);
+            if (op == SW_MODEL_PKA_OP_MODADD) {
+                pR[words] = SwModelBnAdd(pR, pA, pB, words);
+                SwModelBnMod(pR, pR, words + 1, pN, words);
+            } else {
+                SwModelBnSubMod(pR, pA, pB, pN, words);
+            }
+            break;
+        case SW_MODEL_PKA_OP_MODMUL:
+        case SW_MODEL_PKA_OP_MODMULN:
+            SwModelBnMul(gSwModelPkaProd, pA, words, pB, words);
+            SwModelBnMod(pR, gSwModelPkaProd, 2 * words, pN, words);
+            cost = (uint64_t)opWords * opWords;
+            break;
+        case SW_MODEL_PKA_OP_MODMLAC:
+        case SW_MODEL_PKA_OP_MODMLACNR:
+            /* the accumulated operand C is selected by the tag field */
+            memset(pC, 0, sizeof(gSwModelPkaC));
+            SwModelPkaRegRead(tag, pC, words);
+            SwModelBnMul(gSwModelPkaProd, pA, words, pB, words);
+            gSwModelPkaProd[2 * words] = 0;
+            for (i = 0, carry = 0; i < words; i++) {
+                uint64_t acc = (uint64_t)gSwModelPkaProd[i] + pC[i] + carry;
+
+                gSwModelPkaProd[i] = (uint32_t)acc;
+                carry = (uint32_t)(acc >> 32);
+            }
+            for (; (carry != 0) && (i <= 2 * words); i++) {
+                carry = (++gSwModelPkaProd[i] == 0);
+            }
+            carry = 0;
+            SwModelBnMod(pR, gSwModelPkaProd, 2 * words + 1, pN, words);
+            cost = (uint64_t)opWords * opWords;
+            break;
+        case SW_MODEL_PKA_OP_MODEXP:
+            SwModelBnMod(pA, pA, words, pN, words);
+            memset(pR, 0, words * sizeof(uint32_t));
+            pR[0] = 1;
+            SwModelBnMod(pR, pR, words, pN, words);
+            for (bit = (int32_t)(words * 32) - 1; (bit >= 0) && (((pB[bit / 32] >> (bit % 32)) & 1) == 0); bit--);
+            for (; bit >= 0; bit--) {
+                SwModelBnModMul(pR, pR, pR, pN, words);
+                cost += (uint64_t)opWords * opWords;
+                if ((pB[bit / 32] >> (bit % 32)) & 1) {
+                    SwModelBnModMul(pR, pR, pA, pN, words);
+                    cost += (uint64_t)opWords * opWords;
+                }
+            }
+            break;
+        case SW_MODEL_PKA_OP_MODINV:
+            /* R = A / B mod N, the drivers pass A = 1; B is replaced by GCD(B, N), which the
+               drivers read to test coprimality */
+            memcpy(pC, pA, words * sizeof(uint32_t));
+            SwModelBnModInv(pR, pB, pB, pN, words);
+            SwModelBnMod(pC, pC, words, pN, words);
+            SwModelBnModMul(pR, pR, pC, pN, words);
+            if ((fieldB & SW_MODEL_PKA_OPERAND_FLAG) == 0) {
+                SwModelPkaRegWrite(fieldB, pB, words);
+            }
+            cost = 2ULL * opWords * 32 * opWords;
+            break;
+        case SW_MODEL_PKA_OP_REDUCTION:
+            SwModelBnMod(pR, pA, words, pN, words);
+            break;
+        default:
+            writeRes = 0;
+            break;
+        }
+        break;
+    }
+
+    if ((writeRes != 0) && ((fieldR & SW_MODEL_PKA_OPERAND_FLAG) == 0)) {
+        SwModelPkaRegWrite(fieldR, pR, resWords);
+    }
+
+    *pStatus &= ~SW_MODEL_PKA_STATUS_MASK;
+    if (carry != 0) {
+        *pStatus |= CC_REG_BIT_MASK(PKA_STATUS, ALU_CARRY);
+    }
+    if (SwModelBnIsZero(pR, resWords)) {
+        *pStatus |= CC_REG_BIT_MASK(PKA_STATUS, ALU_OUT_ZERO);
+    }
+    if (divByZero != 0) {
+        *pStatus |= CC_REG_BIT_MASK(PKA_STATUS, DIV_BY_ZERO);
+    }
+
+    return cost;
+}
@@ -0,0 +1,976 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/*
+ * Software model of the AES and HASH engines.
+ *
+ * AES ECB, CBC, CTR, OFB, CBC-MAC, CMAC and XCBC-MAC and the MD5, SHA-1, SHA-2 and SM3
+ * hashes are bit exact. The other cipher modes pass the data through and are modeled
+ * for timing only. HW keys are modeled as an all-zero key.
+ */
+
+#include <string.h>
+
+#include "cc_pal_types.h"
+#include "cc_regs.h"
+#include "cc_registers.h"
+#include "cc_hw_queue_defs.h"
+#include "cc_crypto_ctx.h"
+#include "cc_hal_sw_model_int.h"
+
+/******************************************************************************
+*				DEFINITIONS
+******************************************************************************/
+
+#define SW_MODEL_AES_ROUNDS_MAX         14
+#define SW_MODEL_AES_KEY_SIZE_MAX       32
+
+#define SW_MODEL_HASH_STATE_WORDS       8
+#define SW_MODEL_HASH_BLOCK_MAX         128
+#define SW_MODEL_HASH_LEN_WORDS_MAX     4
+
+/* CIPHER_CONF0 of a final digest write and CIPHER_DO of a padding request, see hash_defs.h */
+#define SW_MODEL_HASH_CONF0_RESULT_LE   2
+#define SW_MODEL_HASH_DO_PAD            1
+
+#define SW_MODEL_ROL32(x, n)            (((x) << (n)) | ((x) >> (32 - (n))))
+#define SW_MODEL_ROR32(x, n)            (((x) >> (n)) | ((x) << (32 - (n))))
+#define SW_MODEL_ROR64(x, n)            (((x) >> (n)) | ((x) << (64 - (n))))
+
+/******************************************************************************
+*				TYPE DEFINITIONS
+******************************************************************************/
+
+typedef struct {
+    uint32_t   mode;            /* DRV_CIPHER_* of the last key load */
+    uint32_t   decrypt;
+    uint32_t   rounds;
+    uint8_t    roundKey[(SW_MODEL_AES_ROUNDS_MAX + 1) * SW_MODEL_AES_BLOCK_SIZE];
+    uint8_t    state0[SW_MODEL_AES_BLOCK_SIZE];     /* IV or MAC state */
+    uint8_t    state1[SW_MODEL_AES_BLOCK_SIZE];     /* counter, OFB state or XCBC K2 */
+    uint8_t    state2[SW_MODEL_AES_BLOCK_SIZE];     /* XCBC K3 */
+} SwModelAes_t;
+
+typedef struct {
+    uint32_t   mode;            /* DRV_HASH_HW_* */
+    uint32_t   sm3;
+    uint32_t   padEnable;
+    uint32_t   xorVal;
+    uint64_t   length;          /* digested bytes */
+    uint32_t   h[SW_MODEL_HASH_STATE_WORDS];
+    uint64_t   h64[SW_MODEL_HASH_STATE_WORDS];
+    uint8_t    block[SW_MODEL_HASH_BLOCK_MAX];
+    uint32_t   blockLen;
+} SwModelHash_t;
+
+/******************************************************************************
+*				GLOBALS
+******************************************************************************/
+
+static SwModelAes_t gSwModelAes;
+static SwModelHash_t gSwModelHash;
+
+static uint8_t gSwModelSbox[256];
+static uint8_t gSwModelInvSbox[256];
+
+static const uint32_t gSwModelSha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint64_t gSwModelSha512K[80] = {
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+    0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+    0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+    0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+    0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+    0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+    0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+    0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+    0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+    0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+    0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+    0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+    0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+    0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+static const uint32_t gSwModelMd5K[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+};
+
+static const uint8_t gSwModelMd5R[64] = {
+    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+    5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+};
+
+/******************************************************************************
+*				PRIVATE FUNCTIONS - AES
+******************************************************************************/
+
+static uint8_t SwModelXtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ ((x & 0x80) ? 0x1B : 0x00));
+}
+
+static uint8_t SwModelGfMul(uint8_t a, uint8_t b)
+{
+    uint8_t res = 0;
+
+    while (b != 0) {
+        if (b & 1) {
+            res ^= a;
+        }
+        a = SwModelXtime(a);
+        b >>= 1;
+    }
+
+    return res;
+}
+
+/* builds the S-box from the multiplicative inverse and the affine transform */
+static void SwModelAesSboxInit(void)
+{
+    uint8_t p = 1, q = 1, x;
+
+    do {
+        /* p is multiplied by 3 and q divided by 3, so q is the inverse of p */
+        p = p ^ SwModelXtime(p);
+        q ^= q << 1;
+        q ^= q << 2;
+        q ^= q << 4;
+        if (q & 0x80) {
+            q ^= 0x09;
+        }
+        x = q ^ (uint8_t)((q << 1) | (q >> 7)) ^ (uint8_t)((q << 2) | (q >> 6)) ^
+            (uint8_t)((q << 3) | (q >> 5)) ^ (uint8_t)((q << 4) | (q >> 4));
+        gSwModelSbox[p] = x ^ 0x63;
+    } while (p != 1);
+    gSwModelSbox[0] = 0x63;
+
+    for (x = 0; ; x++) {
+        gSwModelInvSbox[gSwModelSbox[x]] = x;
+        if (x == 0xFF) {
+            break;
+        }
+    }
+}
+
+static void SwModelAesKeyExpand(const uint8_t *pKey, size_t keySize)
+{
+    uint32_t nk = (uint32_t)(keySize / sizeof(uint32_t));
+    uint32_t total;
+    uint32_t i;
+    uint8_t tmp[4], t;
+    uint8_t rcon = 1;
+
+    gSwModelAes.rounds = nk + 6;
+    total = 4 * (gSwModelAes.rounds + 1);
+    memcpy(gSwModelAes.roundKey, pKey, keySize);
+
+    for (i = nk; i < total; i++) {
+        memcpy(tmp, &gSwModelAes.roundKey[(i - 1) * 4], sizeof(tmp));
+        if ((i % nk) == 0) {
+            t = tmp[0];
+            tmp[0] = gSwModelSbox[tmp[1]] ^ rcon;
+            tmp[1] = gSwModelSbox[tmp[2]];
+            tmp[2] = gSwModelSbox[tmp[3]];
+            tmp[3] = gSwModelSbox[t];
+            rcon = SwModelXtime(rcon);
+        } else if ((nk > 6) && ((i % nk) == 4)) {
+            tmp[0] = gSwModelSbox[tmp[0]];
+            tmp[1] = gSwModelSbox[tmp[1]];
+            tmp[2] = gSwModelSbox[tmp[2]];
+            tmp[3] = gSwModelSbox[tmp[3]];
+        }
+        gSwModelAes.roundKey[i * 4 + 0] = gSwModelAes.roundKey[(i - nk) * 4 + 0] ^ tmp[0];
+        gSwModelAes.roundKey[i * 4 + 1] = gSwModelAes.roundKey[(i - nk) * 4 + 1] ^ tmp[1];
+        gSwModelAes.roundKey[i * 4 + 2] = gSwModelAes.roundKey[(i - nk) * 4 + 2] ^ tmp[2];
+        gSwModelAes.roundKey[i * 4 + 3] = gSwModelAes.roundKey[(i - nk) * 4 + 3] ^ tmp[3];
+    }
+}
+
+static void SwModelAesAddRoundKey(uint8_t *pState, uint32_t round)
+{
+    uint32_t i;
+
+    for (i = 0; i < SW_MODEL_AES_BLOCK_SIZE; i++) {
+        pState[i] ^= gSwModelAes.roundKey[round * SW_MODEL_AES_BLOCK_SIZE + i];
+    }
+}
+
+static void SwModelAesEncryptBlock(const uint8_t *pIn, uint8_t *pOut)
+{
+    uint8_t s[SW_MODEL_AES_BLOCK_SIZE], t[SW_MODEL_AES_BLOCK_SIZE];
+    uint32_t round, c, i;
+    uint8_t a0, a1, a2, a3;
+
+    memcpy(s, pIn, sizeof(s));
+    SwModelAesAddRoundKey(s, 0);
+
+    for (round = 1; round <= gSwModelAes.rounds; round++) {
+        /* SubBytes and ShiftRows */
+        for (i = 0; i < SW_MODEL_AES_BLOCK_SIZE; i++) {
+            t[i] = gSwModelSbox[s[(i + 4 * (i & 3)) & 0xF]];
+        }
+        /* MixColumns */
+        if (round != gSwModelAes.rounds) {
+            for (c = 0; c < 4; c++) {
+                a0 = t[4 * c];
+                a1 = t[4 * c + 1];
+                a2 = t[4 * c + 2];
+                a3 = t[4 * c + 3];
+                t[4 * c]     = SwModelXtime(a0 ^ a1) ^ a1 ^ a2 ^ a3;
+                t[4 * c + 1] = SwModelXtime(a1 ^ a2) ^ a2 ^ a3 ^ a0;
+                t[4 * c + 2] = SwModelXtime(a2 ^ a3) ^ a3 ^ a0 ^ a1;
+                t[4 * c + 3] = SwModelXtime(a3 ^ a0) ^ a0 ^ a1 ^ a2;
+            }
+        }
+        memcpy(s, t, sizeof(s));
+        SwModelAesAddRoundKey(s, round);
+    }
+
+    memcpy(pOut, s, sizeof(s));
+}
+
+static void SwModelAesDecryptBlock(const uint8_t *pIn, uint8_t *pOut)
+{
+    uint8_t s[SW_MODEL_AES_BLOCK_SIZE], t[SW_MODEL_AES_BLOCK_SIZE];
+    uint32_t round, c, i;
+    uint8_t a0, a1, a2, a3;
+
+    memcpy(s, pIn, sizeof(s));
+    SwModelAesAddRoundKey(s, gSwModelAes.rounds);
+
+    for (round = gSwModelAes.rounds; round > 0; round--) {
+        /* InvShiftRows and InvSubBytes */
+        for (i = 0; i < SW_MODEL_AES_BLOCK_SIZE; i++) {
+            t[(i + 4 * (i & 3)) & 0xF] = gSwModelInvSbox[s[i]];
+        }
+        memcpy(s, t, sizeof(s));
+        SwModelAesAddRoundKey(s, round - 1);
+        /* InvMixColumns */
+        if (round != 1) {
+            for (c = 0; c < 4; c++) {
+                a0 = s[4 * c];
+                a1 = s[4 * c + 1];
+                a2 = s[4 * c + 2];
+                a3 = s[4 * c + 3];
+                s[4 * c]     = SwModelGfMul(a0, 14) ^ SwModelGfMul(a1, 11) ^ SwModelGfMul(a2, 13) ^ SwModelGfMul(a3, 9);
+                s[4 * c + 1] = SwModelGfMul(a0, 9) ^ SwModelGfMul(a1, 14) ^ SwModelGfMul(a2, 11) ^ SwModelGfMul(a3, 13);
+                s[4 * c + 2] = SwModelGfMul(a0, 13) ^ SwModelGfMul(a1, 9) ^ SwModelGfMul(a2, 14) ^ SwModelGfMul(a3, 11);
+                s[4 * c + 3] = SwModelGfMul(a0, 11) ^ SwModelGfMul(a1, 13) ^ SwModelGfMul(a2, 9) ^ SwModelGfMul(a3, 14);
+            }
+        }
+    }
+
+    memcpy(pOut, s, sizeof(s));
+}
+
+static void SwModelXorBlock(uint8_t *pDst, const uint8_t *pSrc, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        pDst[i] ^= pSrc[i];
+    }
+}
+
+static void SwModelCtrIncrement(uint8_t *pCtr)
+{
+    int i;
+
+    for (i = SW_MODEL_AES_BLOCK_SIZE - 1; i >= 0; i--) {
+        if (++pCtr[i] != 0) {
+            break;
+        }
+    }
+}
+
+/* doubling in GF(2^128), used to derive the CMAC sub keys */
+static void SwModelCmacDouble(uint8_t *pBlock)
+{
+    uint8_t carry = pBlock[0] & 0x80;
+    uint32_t i;
+
+    for (i = 0; i < SW_MODEL_AES_BLOCK_SIZE - 1; i++) {
+        pBlock[i] = (uint8_t)((pBlock[i] << 1) | (pBlock[i + 1] >> 7));
+    }
+    pBlock[SW_MODEL_AES_BLOCK_SIZE - 1] <<= 1;
+    if (carry != 0) {
+        pBlock[SW_MODEL_AES_BLOCK_SIZE - 1] ^= 0x87;
+    }
+}
+
+/* MACs the last block (1..16 bytes, or none) into state0 */
+static void SwModelMacLastBlock(const uint8_t *pIn, size_t len)
+{
+    uint8_t block[SW_MODEL_AES_BLOCK_SIZE] = { 0 };
+    uint8_t k1[SW_MODEL_AES_BLOCK_SIZE] = { 0 };
+    uint8_t k2[SW_MODEL_AES_BLOCK_SIZE];
+
+    if (gSwModelAes.mode == DRV_CIPHER_XCBC_MAC) {
+        memcpy(k1, gSwModelAes.state1, sizeof(k1));
+        memcpy(k2, gSwModelAes.state2, sizeof(k2));
+    } else {
+        SwModelAesEncryptBlock(k1, k1);
+        SwModelCmacDouble(k1);
+        memcpy(k2, k1, sizeof(k2));
+        SwModelCmacDouble(k2);
+    }
+
+    if (len != 0) {
+        memcpy(block, pIn, len);
+    }
+    if (len == SW_MODEL_AES_BLOCK_SIZE) {
+        SwModelXorBlock(block, k1, sizeof(block));
+    } else {
+        block[len] = 0x80;
+        SwModelXorBlock(block, k2, sizeof(block));
+    }
+
+    SwModelXorBlock(gSwModelAes.state0, block, sizeof(block));
+    SwModelAesEncryptBlock(gSwModelAes.state0, gSwModelAes.state0);
+}
+
+/******************************************************************************
+*				PRIVATE FUNCTIONS - HASH
+******************************************************************************/
+
+static uint32_t SwModelLoadBe32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint32_t SwModelLoadLe32(const uint8_t *p)
+{
+    return ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+}
+
+static void SwModelStoreBe32(uint8_t *p, uint32_t val)
+{
+    p[0] = (uint8_t)(val >> 24);
+    p[1] = (uint8_t)(val >> 16);
+    p[2] = (uint8_t)(val >> 8);
+    p[3] = (uint8_t)val;
+}
+
+static void SwModelStoreLe32(uint8_t *p, uint32_t val)
+{
+    p[0] = (uint8_t)val;
+    p[1] = (uint8_t)(val >> 8);
+    p[2] = (uint8_t)(val >> 16);
+    p[3] = (uint8_t)(val >> 24);
+}
+
+static uint32_t SwModelHashStateWords(void)
+{
+    if (gSwModelHash.sm3 != 0) {
+        return 8;
+    }
+    switch (gSwModelHash.mode) {
+    case DRV_HASH_HW_MD5:
+        return 4;
+    case DRV_HASH_HW_SHA1:
+        return 5;
+    case DRV_HASH_HW_SHA512:
+    case DRV_HASH_HW_SHA384:
+        return 16;
+    default:
+        return 8;
+    }
+}
+
+static uint32_t SwModelHashBlockSize(void)
+{
+    if ((gSwModelHash.sm3 == 0) &&
+        ((gSwModelHash.mode == DRV_HASH_HW_SHA512) || (gSwModelHash.mode == DRV_HASH_HW_SHA384))) {
+        return 128;
+    }
+    return 64;
+}
+
+static void SwModelMd5Block(const uint8_t *pBlock)
+{
+    uint32_t w[16];
+    uint32_t a, b, c, d, f, tmp;
+    uint32_t i, g;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = SwModelLoadLe32(pBlock + 4 * i);
+    }
+
+    a = gSwModelHash.h[0];
+    b = gSwModelHash.h[1];
+    c = gSwModelHash.h[2];
+    d = gSwModelHash.h[3];
+
+    for (i = 0; i < 64; i++) {
+        if (i < 16) {
+            f = (b & c) | (~b & d);
+            g = i;
+        } else if (i < 32) {
+            f = (d & b) | (~d & c);
+            g = (5 * i + 1) & 0xF;
+        } else if (i < 48) {
+            f = b ^ c ^ d;
+            g = (3 * i + 5) & 0xF;
+        } else {
+            f = c ^ (b | ~d);
+            g = (7 * i) & 0xF;
+        }
+        tmp = d;
+        d = c;
+        c = b;
+        b = b + SW_MODEL_ROL32(a + f + gSwModelMd5K[i] + w[g], gSwModelMd5R[i]);
+        a = tmp;
+    }
+
+    gSwModelHash.h[0] += a;
+    gSwModelHash.h[1] += b;
+    gSwModelHash.h[2] += c;
+    gSwModelHash.h[3] += d;
+}
+
+static void SwModelSha1Block(const uint8_t *pBlock)
+{
+    uint32_t w[80];
+    uint32_t a, b, c, d, e, f, k, tmp;
+    uint32_t i;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = SwModelLoadBe32(pBlock + 4 * i);
+    }
+    for (i = 16; i < 80; i++) {
+        w[i] = SW_MODEL_ROL32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+
+    a = gSwModelHash.h[0];
+    b = gSwModelHash.h[1];
+    c = gSwModelHash.h[2];
+    d = gSwModelHash.h[3];
+    e = gSwModelHash.h[4];
+
+    for (i = 0; i < 80; i++) {
+        if (i < 20) {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        } else if (i < 40) {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        } else if (i < 60) {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        } else {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+        tmp = SW_MODEL_ROL32(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = SW_MODEL_ROL32(b, 30);
+        b = a;
+        a = tmp;
+    }
+
+    gSwModelHash.h[0] += a;
+    gSwModelHash.h[1] += b;
+    gSwModelHash.h[2] += c;
+    gSwModelHash.h[3] += d;
+    gSwModelHash.h[4] += e;
+}
+
+static void SwModelSha256Block(const uint8_t *pBlock)
+{
+    uint32_t w[64];
+    uint32_t v[8];
+    uint32_t t1, t2, s0, s1;
+    uint32_t i;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = SwModelLoadBe32(pBlock + 4 * i);
+    }
+    for (i = 16; i < 64; i++) {
+        s0 = SW_MODEL_ROR32(w[i - 15], 7) ^ SW_MODEL_ROR32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        s1 = SW_MODEL_ROR32(w[i - 2], 17) ^ SW_MODEL_ROR32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    memcpy(v, gSwModelHash.h, sizeof(v));
+
+    for (i = 0; i < 64; i++) {
+        s1 = SW_MODEL_ROR32(v[4], 6) ^ SW_MODEL_ROR32(v[4], 11) ^ SW_MODEL_ROR32(v[4], 25);
+        t1 = v[7] + s1 + ((v[4] & v[5]) ^ (~v[4] & v[6])) + gSwModelSha256K[i] + w[i];
+        s0 = SW_MODEL_ROR32(v[0], 2) ^ SW_MODEL_ROR32(v[0], 13) ^ SW_MODEL_ROR32(v[0], 22);
+        t2 = s0 + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+        v[7] = v[6];
+        v[6] = v[5];
+        v[5] = v[4];
+        v[4] = v[3] + t1;
+        v[3] = v[2];
+        v[2] = v[1];
+        v[1] = v[0];
+        v[0] = t1 + t2;
+    }
+
+    for (i = 0; i < 8; i++) {
+        gSwModelHash.h[i] += v[i];
+    }
+}
+
+static void SwModelSha512Block(const uint8_t *pBlock)
+{
+    uint64_t w[80];
+    uint64_t v[8];
+    uint64_t t1, t2, s0, s1;
+    uint32_t i;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = ((uint64_t)SwModelLoadBe32(pBlock + 8 * i) << 32) | SwModelLoadBe32(pBlock + 8 * i + 4);
+    }
+    for (i = 16; i < 80; i++) {
+        s0 = SW_MODEL_ROR64(w[i - 15], 1) ^ SW_MODEL_ROR64(w[i - 15], 8) ^ (w[i - 15] >> 7);
+        s1 = SW_MODEL_ROR64(w[i - 2], 19) ^ SW_MODEL_ROR64(w[i - 2], 61) ^ (w[i - 2] >> 6);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    memcpy(v, gSwModelHash.h64, sizeof(v));
+
+    for (i = 0; i < 80; i++) {
+        s1 = SW_MODEL_ROR64(v[4], 14) ^ SW_MODEL_ROR64(v[4], 18) ^ SW_MODEL_ROR64(v[4], 41);
+        t1 = v[7] + s1 + ((v[4] & v[5]) ^ (~v[4] & v[6])) + gSwModelSha512K[i] + w[i];
+        s0 = SW_MODEL_ROR64(v[0], 28) ^ SW_MODEL_ROR64(v[0], 34) ^ SW_MODEL_ROR64(v[0], 39);
+        t2 = s0 + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+        v[7] = v[6];
+        v[6] = v[5];
+        v[5] = v[4];
+        v[4] = v[3] + t1;
+        v[3] = v[2];
+        v[2] = v[1];
+        v[1] = v[0];
+        v[0] = t1 + t2;
+    }
+
+    for (i = 0; i < 8; i++) {
+        gSwModelHash.h64[i] += v[i];
+    }
+}
+
+static void SwModelSm3Block(const uint8_t *pBlock)
+{
+    uint32_t w[68];
+    uint32_t v[8];
+    uint32_t ss1, ss2, tt1, tt2, t, x;
+    uint32_t i;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = SwModelLoadBe32(pBlock + 4 * i);
+    }
+    for (i = 16; i < 68; i++) {
+        x = w[i - 16] ^ w[i - 9] ^ SW_MODEL_ROL32(w[i - 3], 15);
+        x = x ^ SW_MODEL_ROL32(x, 15) ^ SW_MODEL_ROL32(x, 23);
+        w[i] = x ^ SW_MODEL_ROL32(w[i - 13], 7) ^ w[i - 6];
+    }
+
+    memcpy(v, gSwModelHash.h, sizeof(v));
+
+    for (i = 0; i < 64; i++) {
+        t = (i < 16) ? 0x79CC4519 : 0x7A879D8A;
+        ss1 = SW_MODEL_ROL32(SW_MODEL_ROL32(v[0], 12) + v[4] + SW_MODEL_ROL32(t, i % 32), 7);
+        ss2 = ss1 ^ SW_MODEL_ROL32(v[0], 12);
+        if (i < 16) {
+            tt1 = (v[0] ^ v[1] ^ v[2]) + v[3] + ss2 + (w[i] ^ w[i + 4]);
+            tt2 = (v[4] ^ v[5] ^ v[6]) + v[7] + ss1 + w[i];
+        } else {
+            tt1 = ((v[0] & v[1]) | (v[0] & v[2]) | (v[1] & v[2])) + v[3] + ss2 + (w[i] ^ w[i + 4]);
+            tt2 = ((v[4] & v[5]) | (~v[4] & v[6])) + v[7] + ss1 + w[i];
+        }
+        v[3] = v[2];
+        v[2] = SW_MODEL_ROL32(v[1], 9);
+        v[1] = v[0];
+        v[0] = tt1;
+        v[7] = v[6];
+        v[6] = SW_MODEL_ROL32(v[5], 19);
+        v[5] = v[4];
+        v[4] = tt2 ^ SW_MODEL_ROL32(tt2, 9) ^ SW_MODEL_ROL32(tt2, 17);
+    }
+
+    for (i = 0; i < 8; i++) {
+        gSwModelHash.h[i] ^= v[i];
+    }
+}
+
+static void SwModelHashBlock(const uint8_t *pBlock)
+{
+    if (gSwModelHash.sm3 != 0) {
+        SwModelSm3Block(pBlock);
+        return;
+    }
+    switch (gSwModelHash.mode) {
+    case DRV_HASH_HW_MD5:
+        SwModelMd5Block(pBlock);
+        break;
+    case DRV_HASH_HW_SHA1:
+        SwModelSha1Block(pBlock);
+        break;
+    case DRV_HASH_HW_SHA512:
+    case DRV_HASH_HW_SHA384:
+        SwModelSha512Block(pBlock);
+        break;
+    default:
+        SwModelSha256Block(pBlock);
+        break;
+    }
+}
+
+static void SwModelHashUpdate(const uint8_t *pIn, size_t len)
+{
+    uint32_t blockSize = SwModelHashBlockSize();
+    size_t chunk;
+
+    gSwModelHash.length += len;
+    while (len > 0) {
+        chunk = blockSize - gSwModelHash.blockLen;
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(&gSwModelHash.block[gSwModelHash.blockLen], pIn, chunk);
+        gSwModelHash.blockLen += (uint32_t)chunk;
+        pIn += chunk;
+        len -= chunk;
+        if (gSwModelHash.blockLen == blockSize) {
+            SwModelHashBlock(gSwModelHash.block);
+            gSwModelHash.blockLen = 0;
+        }
+    }
+}
+
+/* appends the padding and the bit length of the message */
+static void SwModelHashPad(void)
+{
+    uint32_t blockSize = SwModelHashBlockSize();
+    uint32_t lenBytes = (blockSize == 128) ? 16 : 8;
+    uint64_t bits = gSwModelHash.length << 3;
+    uint64_t length = gSwModelHash.length;
+    uint8_t pad[SW_MODEL_HASH_BLOCK_MAX + 16] = { 0x80 };
+    uint32_t padLen;
+    uint32_t i;
+
+    padLen = (gSwModelHash.blockLen < blockSize - lenBytes) ?
+             (blockSize - lenBytes - gSwModelHash.blockLen) :
+             (2 * blockSize - lenBytes - gSwModelHash.blockLen);
+
+    for (i = 0; i < 8; i++) {
+        if ((gSwModelHash.sm3 == 0) && (gSwModelHash.mode == DRV_HASH_HW_MD5)) {
+            pad[padLen + i] = (uint8_t)(bits >> (8 * i));
+        } else {
+            pad[padLen + lenBytes - 1 - i] = (uint8_t)(bits >> (8 * i));
+        }
+    }
+
+    SwModelHashUpdate(pad, padLen + lenBytes);
+    gSwModelHash.length = length;
+}
+
+/******************************************************************************
+*				PUBLIC FUNCTIONS
+******************************************************************************/
+
+void SwModelAesReset(void)
+{
+    memset(&gSwModelAes, 0, sizeof(gSwModelAes));
+    if (gSwModelSbox[0] == 0) {
+        SwModelAesSboxInit();
+    }
+}
+
+void SwModelAesLoad(const uint32_t *pWord, const uint8_t *pIn, size_t inLen)
+{
+    uint8_t key[SW_MODEL_AES_KEY_SIZE_MAX] = { 0 };
+    size_t keySize;
+
+    if (inLen > SW_MODEL_AES_BLOCK_SIZE * 2) {
+        inLen = SW_MODEL_AES_BLOCK_SIZE * 2;
+    }
+
+    switch (SW_MODEL_DESC_FLD(WORD4, SETUP_OPERATION)) {
+    case SETUP_LOAD_KEY0:
+        gSwModelAes.mode = SW_MODEL_DESC_FLD(WORD4, CIPHER_MODE);
+        gSwModelAes.decrypt = SW_MODEL_DESC_FLD(WORD4, CIPHER_CONF0) & DRV_CRYPTO_DIRECTION_DECRYPT;
+        keySize = (SW_MODEL_DESC_FLD(WORD4, KEY_SIZE) + 2) * 8;
+        if (keySize > SW_MODEL_AES_KEY_SIZE_MAX) {
+            keySize = SW_MODEL_AES_KEY_SIZE_MAX;
+        }
+        /* a HW key has no DIN and is modeled as zero */
+        memcpy(key, pIn, (inLen < keySize) ? inLen : keySize);
+        SwModelAesKeyExpand(key, keySize);
+        break;
+    case SETUP_LOAD_STATE0:
+        memset(gSwModelAes.state0, 0, SW_MODEL_AES_BLOCK_SIZE);
+        memcpy(gSwModelAes.state0, pIn, (inLen < SW_MODEL_AES_BLOCK_SIZE) ? inLen : SW_MODEL_AES_BLOCK_SIZE);
+        break;
+    case SETUP_LOAD_STATE1:
+        memset(gSwModelAes.state1, 0, SW_MODEL_AES_BLOCK_SIZE);
+        memcpy(gSwModelAes.state1, pIn, (inLen < SW_MODEL_AES_BLOCK_SIZE) ? inLen : SW_MODEL_AES_BLOCK_SIZE);
+        break;
+    case SETUP_LOAD_STATE2:
+        memset(gSwModelAes.state2, 0, SW_MODEL_AES_BLOCK_SIZE);
+        memcpy(gSwModelAes.state2, pIn, (inLen < SW_MODEL_AES_BLOCK_SIZE) ? inLen : SW_MODEL_AES_BLOCK_SIZE);
+        break;
+    case SETUP_LOAD_NOP:
+        /* MAC of an empty message */
+        if (SW_MODEL_DESC_FLD(WORD4, CMAC_SIZE0) != 0) {
+            SwModelMacLastBlock(NULL, 0);
+        }
+        break;
+    default:
+        /* the XEX key is modeled for timing only */
+        break;
+    }
+}
+
+size_t SwModelAesStore(const uint32_t *pWord, uint8_t *pOut, size_t outLen)
+{
+    const uint8_t *pState = gSwModelAes.state0;
+
+    if (SW_MODEL_DESC_FLD(WORD4, SETUP_OPERATION) == SETUP_WRITE_STATE1) {
+        pState = gSwModelAes.state1;
+    }
+    if (outLen > SW_MODEL_AES_BLOCK_SIZE) {
+        outLen = SW_MODEL_AES_BLOCK_SIZE;
+    }
+    memcpy(pOut, pState, outLen);
+
+    return outLen;
+}
+
+size_t SwModelAesProcess(const uint32_t *pWord, const uint8_t *pIn, uint8_t *pOut, size_t len)
+{
+    uint8_t block[SW_MODEL_AES_BLOCK_SIZE];
+    size_t offset, chunk;
+    size_t macLen;
+
+    switch (gSwModelAes.mode) {
+    case DRV_CIPHER_ECB:
+        for (offset = 0; offset + SW_MODEL_AES_BLOCK_SIZE <= len; offset += SW_MODEL_AES_BLOCK_SIZE) {
+            if (gSwModelAes.decrypt != 0) {
+                SwModelAesDecryptBlock(pIn + offset, pOut + offset);
+            } else {
+                SwModelAesEncryptBlock(pIn + offset, pOut + offset);
+            }
+        }
+        return offset;
+
+    case DRV_CIPHER_CBC:
+        for (offset = 0; offset + SW_MODEL_AES_BLOCK_SIZE <= len; offset += SW_MODEL_AES_BLOCK_SIZE) {
+            if (gSwModelAes.decrypt != 0) {
+                memcpy(block, pIn + offset, sizeof(block));
+                SwModelAesDecryptBlock(block, pOut + offset);
+                SwModelXorBlock(pOut + offset, gSwModelAes.state0, sizeof(block));
+                memcpy(gSwModelAes.state0, block, sizeof(block));
+            } else {
+                SwModelXorBlock(gSwModelAes.state0, pIn + offset, sizeof(block));
+                SwModelAesEncryptBlock(gSwModelAes.state0, gSwModelAes.state0);
+                memcpy(pOut + offset, gSwModelAes.state0, sizeof(block));
+            }
+        }
+        return offset;
+
+    case DRV_CIPHER_CTR:
+    case DRV_CIPHER_OFB:
+        for (offset = 0; offset < len; offset += chunk) {
+            chunk = ((len - offset) < SW_MODEL_AES_BLOCK_SIZE) ? (len - offset) : SW_MODEL_AES_BLOCK_SIZE;
+            if (gSwModelAes.mode == DRV_CIPHER_CTR) {
+                SwModelAesEncryptBlock(gSwModelAes.state1, block);
+                SwModelCtrIncrement(gSwModelAes.state1);
+            } else {
+                SwModelAesEncryptBlock(gSwModelAes.state1, gSwModelAes.state1);
+                memcpy(block, gSwModelAes.state1, sizeof(block));
+            }
+            memmove(pOut + offset, pIn + offset, chunk);
+            SwModelXorBlock(pOut + offset, block, chunk);
+        }
+        return len;
+
+    case DRV_CIPHER_CBC_MAC:
+        for (offset = 0; offset < len; offset += chunk) {
+            chunk = ((len - offset) < SW_MODEL_AES_BLOCK_SIZE) ? (len - offset) : SW_MODEL_AES_BLOCK_SIZE;
+            SwModelXorBlock(gSwModelAes.state0, pIn + offset, chunk);
+            SwModelAesEncryptBlock(gSwModelAes.state0, gSwModelAes.state0);
+        }
+        return 0;
+
+    case DRV_CIPHER_CMAC:
+    case DRV_CIPHER_XCBC_MAC:
+        /* all blocks but the last of the final descriptor are plain CBC-MAC */
+        macLen = len;
+        if ((SW_MODEL_DESC_FLD(WORD1, NOT_LAST) == 0) && (len > 0)) {
+            macLen = ((len - 1) / SW_MODEL_AES_BLOCK_SIZE) * SW_MODEL_AES_BLOCK_SIZE;
+        }
+        for (offset = 0; offset + SW_MODEL_AES_BLOCK_SIZE <= macLen; offset += SW_MODEL_AES_BLOCK_SIZE) {
+            SwModelXorBlock(gSwModelAes.state0, pIn + offset, SW_MODEL_AES_BLOCK_SIZE);
+            SwModelAesEncryptBlock(gSwModelAes.state0, gSwModelAes.state0);
+        }
+        if ((SW_MODEL_DESC_FLD(WORD1, NOT_LAST) == 0) && (len > 0)) {
+            SwModelMacLastBlock(pIn + macLen, len - macLen);
+        }
+        return 0;
+
+    default:
+        /* XTS, CBC-CTS, CCM and the other modes are modeled for timing only */
+        memmove(pOut, pIn, len);
+        return len;
+    }
+}
+
+void SwModelHashReset(void)
+{
+    memset(&gSwModelHash, 0, sizeof(gSwModelHash));
+}
+
+void SwModelHashLoad(const uint32_t *pWord, const uint8_t *pIn, size_t inLen)
+{
+    uint32_t w[SW_MODEL_HASH_STATE_WORDS * 2] = { 0 };
+    uint32_t words, i;
+
+    gSwModelHash.mode = SW_MODEL_DESC_FLD(WORD4, CIPHER_MODE);
+    gSwModelHash.sm3 = SW_MODEL_DESC_FLD(WORD4, AES_XOR_CRYPTO_KEY);
+    words = SwModelHashStateWords();
+
+    for (i = 0; (i < words) && ((i + 1) * sizeof(uint32_t) <= inLen); i++) {
+        w[i] = SwModelLoadLe32(pIn + i * sizeof(uint32_t));
+    }
+
+    switch (SW_MODEL_DESC_FLD(WORD4, SETUP_OPERATION)) {
+    case SETUP_LOAD_STATE0:
+        /* the intermediate digest is held in reversed word order */
+        if (words == 16) {
+            for (i = 0; i < 8; i++) {
+                gSwModelHash.h64[7 - i] = ((uint64_t)w[2 * i] << 32) | w[2 * i + 1];
+            }
+        } else {
+            for (i = 0; i < words; i++) {
+                gSwModelHash.h[words - 1 - i] = w[i];
+            }
+        }
+        break;
+    case SETUP_LOAD_KEY0:
+        /* the digested length, in bytes, least significant word first */
+        gSwModelHash.length = ((uint64_t)w[1] << 32) | w[0];
+        gSwModelHash.blockLen = 0;
+        gSwModelHash.padEnable = SW_MODEL_DESC_FLD(WORD4, CIPHER_CONF1);
+        break;
+    case SETUP_LOAD_STATE1:
+        /* XOR value of the HMAC pad */
+        gSwModelHash.xorVal = pWord[CC_DSCRPTR_QUEUE_WORD2_IDX];
+        break;
+    default:
+        break;
+    }
+}
+
+size_t SwModelHashStore(const uint32_t *pWord, uint8_t *pOut, size_t outLen)
+{
+    uint32_t words = SwModelHashStateWords();
+    uint32_t isFinal;
+    uint32_t i;
+    size_t len;
+
+    if (SW_MODEL_DESC_FLD(WORD4, SETUP_OPERATION) == SETUP_WRITE_STATE1) {
+        if (SW_MODEL_DESC_FLD(WORD4, CIPHER_DO) == SW_MODEL_HASH_DO_PAD) {
+            SwModelHashPad();
+        }
+        if (outLen > SW_MODEL_HASH_LEN_WORDS_MAX * sizeof(uint32_t)) {
+            outLen = SW_MODEL_HASH_LEN_WORDS_MAX * sizeof(uint32_t);
+        }
+        memset(pOut, 0, outLen);
+        for (i = 0; (i < 2) && ((i + 1) * sizeof(uint32_t) <= outLen); i++) {
+            SwModelStoreLe32(pOut + i * sizeof(uint32_t), (uint32_t)(gSwModelHash.length >> (32 * i)));
+        }
+        return outLen;
+    }
+
+    isFinal = (SW_MODEL_DESC_FLD(WORD4, BYTES_SWAP) != 0) ||
+              (SW_MODEL_DESC_FLD(WORD4, CIPHER_CONF0) == SW_MODEL_HASH_CONF0_RESULT_LE);
+
+    len = words * sizeof(uint32_t);
+    if (outLen > len) {
+        outLen = len;
+    }
+
+    for (i = 0; i < words; i++) {
+        uint8_t bytes[sizeof(uint32_t)];
+
+        if (isFinal != 0) {
+            /* the digest in its standard byte order */
+            if (words == 16) {
+                SwModelStoreBe32(bytes, (uint32_t)(gSwModelHash.h64[i / 2] >> ((i & 1) ? 0 : 32)));
+            } else if ((gSwModelHash.sm3 == 0) && (gSwModelHash.mode == DRV_HASH_HW_MD5)) {
+                SwModelStoreLe32(bytes, gSwModelHash.h[i]);
+            } else {
+                SwModelStoreBe32(bytes, gSwModelHash.h[i]);
+            }
+        } else {
+            if (words == 16) {
+                SwModelStoreLe32(bytes, (uint32_t)(gSwModelHash.h64[7 - i / 2] >> ((i & 1) ? 0 : 32)));
+            } else {
+                SwModelStoreLe32(bytes, gSwModelHash.h[words - 1 - i]);
+            }
+        }
+        if (i * sizeof(uint32_t) >= outLen) {
+            break;
+        }
+        memcpy(pOut + i * sizeof(uint32_t), bytes,
+               ((outLen - i * sizeof(uint32_t)) < sizeof(bytes)) ? (outLen - i * sizeof(uint32_t)) : sizeof(bytes));
+    }
+
+    return outLen;
+}
+
+void SwModelHashProcess(const uint32_t *pWord, const uint8_t *pIn, size_t len)
+{
+    uint8_t chunk[SW_MODEL_HASH_BLOCK_MAX];
+    size_t offset, size, i;
+
+    if (SW_MODEL_DESC_FLD(WORD3, HASH_XOR_BIT) != 0) {
+        for (offset = 0; offset < len; offset += size) {
+            size = ((len - offset) < sizeof(chunk)) ? (len - offset) : sizeof(chunk);
+            for (i = 0; i < size; i++) {
+                chunk[i] = pIn[offset + i] ^ (uint8_t)(gSwModelHash.xorVal >> (8 * ((offset + i) & 3)));
+            }
+            SwModelHashUpdate(chunk, size);
+        }
+    } else {
+        SwModelHashUpdate(pIn, len);
+    }
+
+    if ((gSwModelHash.padEnable != 0) && (SW_MODEL_DESC_FLD(WORD1, NOT_LAST) == 0)) {
+        SwModelHashPad();
+        gSwModelHash.padEnable = 0;
+    }
+}
@@ -9,13 +9,29 @@
 
 /************* Include Files ****************/
 #include <time.h>
+#include <errno.h>
 #include "cc_pal_types.h"
+#include "cc_pal_error.h"
 #include "cc_pal_mutex.h"
+#include "cc_pal_mem.h"
 #include "cc_pal_log.h"
-#include <stdio.h>
 
 /************************ Defines ******************************/
 
+#define PAL_MUTEX_NSEC_IN_SEC		1000000000ULL
+#define PAL_MUTEX_NSEC_IN_MSEC		1000000ULL
+
+/* Minimal number of spins, so a mutex that was never won by spinning keeps probing */
+#define PAL_MUTEX_MIN_SPIN_COUNT	10
+
+#if defined(__aarch64__) || defined(__arm__)
+#define PAL_MUTEX_CPU_RELAX()		__asm__ __volatile__("yield" ::: "memory")
+#elif defined(__x86_64__) || defined(__i386__)
+#define PAL_MUTEX_CPU_RELAX()		__asm__ __volatile__("pause" ::: "memory")
+#else
+#define PAL_MUTEX_CPU_RELAX()		__asm__ __volatile__("" ::: "memory")
+#endif
+
 /************************ Enums ******************************/
 
 /************************ Typedefs ******************************/
@@ -24,6 +40,88 @@
 
 /************************ Private Functions ******************************/
 
+static uint64_t PalMutexGetTimeNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * PAL_MUTEX_NSEC_IN_SEC) + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t PalMutexHistBucket(uint64_t valNs)
+{
+	uint32_t bucket = 0;
+
+	while ((valNs > 1) && (bucket < (CC_PAL_MUTEX_HIST_BUCKETS - 1))) {
+		valNs >>= 1;
+		bucket++;
+	}
+	return bucket;
+}
+
+/* Must be called while holding the mutex */
+static void PalMutexAcquired(CC_PalMutex *pMutexId, uint64_t startNs, CCBool isContended)
+{
+	uint64_t curNs = PalMutexGetTimeNs();
+	uint64_t waitNs = curNs - startNs;
+	CCPalMutexStats_t *pStats = &pMutexId->stats;
+
+	pMutexId->lockTimeNs = curNs;
+	pStats->acquireCount++;
+	if (isContended == CC_FALSE) {
+		return;
+	}
+	pStats->contendedCount++;
+	pStats->totalWaitNs += waitNs;
+	if (waitNs > pStats->maxWaitNs) {
+		pStats->maxWaitNs = waitNs;
+	}
+	pStats->waitHist[PalMutexHistBucket(waitNs)]++;
+}
+
+/*
+ * Spin on the mutex for up to twice the adaptive estimate before giving up
+ * and blocking in the kernel. The estimate follows the spin count that was
+ * actually needed, so mutexes with short critical sections spin and mutexes
+ * held for a long HW operation go straight to the futex.
+ */
+static int PalMutexSpin(CC_PalMutex *pMutexId)
+{
+	uint32_t maxSpin = CC_MIN((pMutexId->spinEstimate * 2) + PAL_MUTEX_MIN_SPIN_COUNT,
+				  CC_PAL_MUTEX_MAX_SPIN_COUNT);
+	uint32_t spin;
+
+	for (spin = 0; spin < maxSpin; spin++) {
+		PAL_MUTEX_CPU_RELAX();
+		if (pthread_mutex_trylock(&pMutexId->mutex) == 0) {
+			/* the estimate is updated under the mutex */
+			pMutexId->spinEstimate += ((int32_t)spin - (int32_t)pMutexId->spinEstimate) / 8;
+			pMutexId->stats.spinAcquireCount++;
+			return 0;
+		}
+	}
+	return EBUSY;
+}
+
+static int PalMutexBlockingLock(CC_PalMutex *pMutexId, uint32_t timeOut)
+{
+	struct timespec absTime;
+	uint64_t deadlineNs;
+
+	if (timeOut == CC_INFINITE) {
+		return pthread_mutex_lock(&pMutexId->mutex);
+	}
+
+	/* pthread_mutex_timedlock() expects an absolute CLOCK_REALTIME deadline */
+	clock_gettime(CLOCK_REALTIME, &absTime);
+	deadlineNs = ((uint64_t)absTime.tv_sec * PAL_MUTEX_NSEC_IN_SEC) + (uint64_t)absTime.tv_nsec +
+		     ((uint64_t)timeOut * PAL_MUTEX_NSEC_IN_MSEC);
+	absTime.tv_sec = (time_t)(deadlineNs / PAL_MUTEX_NSEC_IN_SEC);
+	absTime.tv_nsec = (long)(deadlineNs % PAL_MUTEX_NSEC_IN_SEC);
+
+	return pthread_mutex_timedlock(&pMutexId->mutex, &absTime);
+}
+
 /************************ Public Functions ******************************/
 
 /**
@@ -37,8 +135,27 @@
 CCError_t CC_PalMutexCreate(CC_PalMutex *pMutexId)
 {
 	int  rc = CC_SUCCESS;
+	pthread_mutexattr_t attr;
 
-	rc = pthread_mutex_init(pMutexId, NULL);
+	CC_PalMemSetZero(pMutexId, sizeof(CC_PalMutex));
+
+	rc = pthread_mutexattr_init(&attr);
+	if (rc != 0) {
+		CC_PAL_LOG_ERR("pthread_mutexattr_init failed 0x%x", rc);
+		return CC_FAIL;
+	}
+#ifdef CC_PAL_MUTEX_PRIO_INHERIT
+	/* Avoid priority inversion when low priority threads hold the HW */
+	rc = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+	if (rc != 0) {
+		CC_PAL_LOG_ERR("pthread_mutexattr_setprotocol failed 0x%x", rc);
+		pthread_mutexattr_destroy(&attr);
+		return CC_FAIL;
+	}
+#endif
+
+	rc = pthread_mutex_init(&pMutexId->mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
 	if (rc != 0) {
 		CC_PAL_LOG_ERR("pthread_mutex_init failed 0x%x", rc);
 		return CC_FAIL;
@@ -59,9 +176,9 @@ CCError_t CC_PalMutexDestroy(CC_PalMutex *pMutexId)
 {
 	int  rc = CC_SUCCESS;
 
-	rc = pthread_mutex_destroy(pMutexId);
+	rc = pthread_mutex_destroy(&pMutexId->mutex);
 	if (rc != 0) {
-		 printf /* CC_PAL_LOG_ERR */("pthread_mutex_destroy failed 0x%x", rc);
+		CC_PAL_LOG_ERR("pthread_mutex_destroy failed 0x%x", rc);
 		return CC_FAIL;
 	}
 	return CC_SUCCESS;
@@ -72,22 +189,44 @@ CCError_t CC_PalMutexDestroy(CC_PalMutex *pMutexId)
  * @brief This function purpose is to Wait for Mutex with aTimeOut. aTimeOut is
  *        specified in milliseconds. (CC_INFINITE is blocking)
  *
+ *        The mutex is first probed, then spun on for an adaptive number of
+ *        attempts, and only then waited on in the kernel.
  *
  * @param[in] pMutexId - pointer to Mutex handle
- * @param[in] timeOut - for future use
+ * @param[in] timeOut - timeout in mSec, or CC_INFINITE
  *
- * @return returns 0 on success, otherwise indicates failure
+ * @return returns 0 on success, CC_PAL_SEM_WAIT_TIMEOUT on timeout, otherwise indicates failure
  */
 CCError_t CC_PalMutexLock(CC_PalMutex *pMutexId, uint32_t timeOut)
 {
 	int  rc = CC_SUCCESS;
+	uint64_t startNs = PalMutexGetTimeNs();
 
-	CC_UNUSED_PARAM(timeOut); // remove compilation warning
-	rc = pthread_mutex_lock(pMutexId);
+	rc = pthread_mutex_trylock(&pMutexId->mutex);
+	if (rc == 0) {
+		PalMutexAcquired(pMutexId, startNs, CC_FALSE);
+		return CC_SUCCESS;
+	}
+	if (rc != EBUSY) {
+		CC_PAL_LOG_ERR("pthread_mutex_trylock failed 0x%x", rc);
+		return CC_FAIL;
+	}
+
+	rc = (timeOut == 0) ? ETIMEDOUT : PalMutexSpin(pMutexId);
+	if (rc == EBUSY) {
+		rc = PalMutexBlockingLock(pMutexId, timeOut);
+	}
+	if (rc == ETIMEDOUT) {
+		/* the statistics are owned by the mutex holder, count the timeout atomically */
+		__atomic_fetch_add(&pMutexId->stats.timeoutCount, 1, __ATOMIC_RELAXED);
+		return CC_PAL_SEM_WAIT_TIMEOUT;
+	}
 	if (rc != 0) {
-		printf /* CC_PAL_LOG_ERR */("pthread_mutex_lock failed 0x%x", rc);
+		CC_PAL_LOG_ERR("pthread_mutex_lock failed 0x%x", rc);
 		return CC_FAIL;
 	}
+
+	PalMutexAcquired(pMutexId, startNs, CC_TRUE);
 	return CC_SUCCESS;
 }
 
@@ -102,13 +241,80 @@ CCError_t CC_PalMutexLock(CC_PalMutex *pMutexId, uint32_t timeOut)
  * @return returns 0 on success, otherwise indicates failure
  */
 CCError_t CC_PalMutexUnlock(CC_PalMutex *pMutexId)
+{
+	int  rc = CC_SUCCESS;
+	uint64_t holdNs = PalMutexGetTimeNs() - pMutexId->lockTimeNs;
+	CCPalMutexStats_t *pStats = &pMutexId->stats;
+
+	pStats->totalHoldNs += holdNs;
+	if (holdNs > pStats->maxHoldNs) {
+		pStats->maxHoldNs = holdNs;
+	}
+	pStats->holdHist[PalMutexHistBucket(holdNs)]++;
+
+	rc = pthread_mutex_unlock(&pMutexId->mutex);
+	if (rc != 0) {
+		CC_PAL_LOG_ERR("pthread_mutex_unlock failed 0x%x", rc);
+		return CC_FAIL;
+	}
+	return CC_SUCCESS;
+}
+
+
+/**
+ * @brief This function returns a snapshot of the mutex contention statistics.
+ *        The OS mutex is taken directly, so the query itself is not counted.
+ *
+ *
+ * @param[in] pMutexId - pointer to Mutex handle
+ * @param[out] pStats - pointer to the statistics snapshot
+ *
+ * @return returns 0 on success, otherwise indicates failure
+ */
+CCError_t CC_PalMutexStatsGet(CC_PalMutex *pMutexId, CCPalMutexStats_t *pStats)
+{
+	int  rc = CC_SUCCESS;
+
+	if ((pMutexId == NULL) || (pStats == NULL)) {
+		return CC_FAIL;
+	}
+
+	rc = pthread_mutex_lock(&pMutexId->mutex);
+	if (rc != 0) {
+		CC_PAL_LOG_ERR("pthread_mutex_lock failed 0x%x", rc);
+		return CC_FAIL;
+	}
+	CC_PalMemCopy(pStats, &pMutexId->stats, sizeof(CCPalMutexStats_t));
+	pStats->timeoutCount = __atomic_load_n(&pMutexId->stats.timeoutCount, __ATOMIC_RELAXED);
+	pthread_mutex_unlock(&pMutexId->mutex);
+
+	return CC_SUCCESS;
+}
+
+
+/**
+ * @brief This function clears the mutex contention statistics.
+ *
+ *
+ * @param[in] pMutexId - pointer to Mutex handle
+ *
+ * @return returns 0 on success, otherwise indicates failure
+ */
+CCError_t CC_PalMutexStatsReset(CC_PalMutex *pMutexId)
 {
 	int  rc = CC_SUCCESS;
 
-	rc = pthread_mutex_unlock(pMutexId);
+	if (pMutexId == NULL) {
+		return CC_FAIL;
+	}
+
+	rc = pthread_mutex_lock(&pMutexId->mutex);
 	if (rc != 0) {
-		printf /* CC_PAL_LOG_ERR */("pthread_mutex_unlock failed 0x%x", rc);
+		CC_PAL_LOG_ERR("pthread_mutex_lock failed 0x%x", rc);
 		return CC_FAIL;
 	}
+	CC_PalMemSetZero(&pMutexId->stats, sizeof(CCPalMutexStats_t));
+	pthread_mutex_unlock(&pMutexId->mutex);
+
 	return CC_SUCCESS;
 }
@@ -18,6 +18,8 @@
 #include "cc_pal_dma_plat.h"
 #include "cc_pal_pm.h"
 #include "cc_pal_interrupt_ctrl.h"
+#include "cc_pal_trace.h"
+#include "cc_pal_memmap.h"
 
 extern CC_PalMutex CCSymCryptoMutex;
 extern CC_PalMutex CCAsymCryptoMutex;
@@ -27,6 +29,15 @@ extern CC_PalMutex CCRndCryptoMutex;
     #ifdef CC_SUPPORT_FULL_PROJECT
     extern CC_PalMutex *pCCGenVecMutex;
     extern CC_PalMutex CCFipsMutex;
+    #ifdef CC_SUPPORT_KEYPOOL
+    extern CC_PalMutex CCKeyPoolMutex;
+    #endif
+    #ifdef CC_SUPPORT_PUBKEY_CACHE
+    extern CC_PalMutex CCPubKeyCacheMutex;
+    #endif
+    #ifdef CC_SUPPORT_SM2_ZA_CACHE
+    extern CC_PalMutex CCSm2ZaCacheMutex;
+    #endif
     #else // SLIM
     extern CC_PalMutex CCChCertMutex;
     #endif
@@ -89,6 +100,30 @@ int CC_PalInit(void)
     }
 
     pCCGenVecMutex = &CCRndCryptoMutex;
+
+    #ifdef CC_SUPPORT_KEYPOOL
+    /* Initialize mutex that protects the key pools */
+    rc = CC_PalMutexCreate(&CCKeyPoolMutex);
+    if (rc != 0) {
+        CC_PalAbort("Fail to create key pool mutex\n");
+    }
+    #endif
+
+    #ifdef CC_SUPPORT_PUBKEY_CACHE
+    /* Initialize mutex that protects the public key caches */
+    rc = CC_PalMutexCreate(&CCPubKeyCacheMutex);
+    if (rc != 0) {
+        CC_PalAbort("Fail to create public key cache mutex\n");
+    }
+    #endif
+
+    #ifdef CC_SUPPORT_SM2_ZA_CACHE
+    /* Initialize mutex that protects the SM2 ZA caches */
+    rc = CC_PalMutexCreate(&CCSm2ZaCacheMutex);
+    if (rc != 0) {
+        CC_PalAbort("Fail to create SM2 ZA cache mutex\n");
+    }
+    #endif
     #else //SLIM
     /* Initialize mutex that protects Chinese certification access */
     rc = CC_PalMutexCreate(&CCChCertMutex);
@@ -151,6 +186,30 @@ void CC_PalTerminate(void)
         CC_PAL_LOG_DEBUG("failed to destroy mutex CCFipsMutex\n");
     }
     CC_PalMemSetZero(&CCFipsMutex, sizeof(CC_PalMutex));
+
+    #ifdef CC_SUPPORT_KEYPOOL
+    err = CC_PalMutexDestroy(&CCKeyPoolMutex);
+    if (err != 0){
+        CC_PAL_LOG_DEBUG("failed to destroy mutex CCKeyPoolMutex\n");
+    }
+    CC_PalMemSetZero(&CCKeyPoolMutex, sizeof(CC_PalMutex));
+    #endif
+
+    #ifdef CC_SUPPORT_PUBKEY_CACHE
+    err = CC_PalMutexDestroy(&CCPubKeyCacheMutex);
+    if (err != 0){
+        CC_PAL_LOG_DEBUG("failed to destroy mutex CCPubKeyCacheMutex\n");
+    }
+    CC_PalMemSetZero(&CCPubKeyCacheMutex, sizeof(CC_PalMutex));
+    #endif
+
+    #ifdef CC_SUPPORT_SM2_ZA_CACHE
+    err = CC_PalMutexDestroy(&CCSm2ZaCacheMutex);
+    if (err != 0){
+        CC_PAL_LOG_DEBUG("failed to destroy mutex CCSm2ZaCacheMutex\n");
+    }
+    CC_PalMemSetZero(&CCSm2ZaCacheMutex, sizeof(CC_PalMutex));
+    #endif
     #else// SLIM
     err = CC_PalMutexDestroy(&CCChCertMutex);
     if (err != 0){
@@ -167,4 +226,9 @@ void CC_PalTerminate(void)
     }
     CC_PalMemSetZero(&CCApbFilteringRegMutex, sizeof(CC_PalMutex));
 #endif
+
+    /* unmap the windows kept by the mapping cache */
+    (void)CC_PalMemMapCacheFlush();
+
+    CC_PAL_TRACE_FIN();
 }
@@ -21,6 +21,11 @@
 
 #define dsb() __asm__ __volatile__ ("dsb" : : : "memory")
 
+#elif defined(CC_HAL_SW_MODEL) || defined(__x86_64__) || defined(__i386__)
+/* This is memmory barrier for the host of the SW model and for x86 */
+
+#define dsb() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
 #else
 #error This is a place holder for platform specific memory barrier implementation
 #define dsb()
@@ -220,6 +220,16 @@ uint32_t CC_PalDmaInit(uint32_t  buffSize,
 	if (drvFd >= 0) {
 		return 1;
 	}
+#ifdef CC_HAL_SW_MODEL
+	/* The software model reaches host memory directly: the pool is anonymous
+	 * memory and every virtual address is its own DMA address. */
+	CC_UNUSED_PARAM(drvName);
+	pWsBase = mmap(NULL, buffSize, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+	if (pWsBase == MAP_FAILED) {
+		return 3;
+	}
+	physBuffAddr = (CCDmaAddr_t)(CCVirtAddr_t)pWsBase;
+#else
 	strncat(drvName, PAL_LINUX_DRV_NAME, sizeof(drvName));
 	drvFd = open(drvName, O_RDWR);
 	if (drvFd < 0) {
@@ -231,6 +241,7 @@ uint32_t CC_PalDmaInit(uint32_t  buffSize,
 	if (pWsBase == MAP_FAILED) {
 		return (unsigned long)NULL;
 	}
+#endif
 
 	gMemVirtBaseAddr = (CCVirtAddr_t)pWsBase;
 	gMemPhysBaseAddr = physBuffAddr;
@@ -269,6 +280,14 @@ uint32_t CC_PalDmaInit(uint32_t  buffSize,
  */
 void CC_PalDmaTerminate(void)
 {
+#ifdef CC_HAL_SW_MODEL
+	if (gMemVirtBaseAddr != 0) {
+		munmap((uint32_t *)gMemVirtBaseAddr, gMemPoolLen);
+		gMemVirtBaseAddr = 0;
+		gMemPhysBaseAddr = 0;
+		gMemPoolLen = 0;
+	}
+#endif
 	if (fd_mem < 0) {
 		return;
 	}
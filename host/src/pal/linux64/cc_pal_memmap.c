@@ -11,7 +11,7 @@
 #include <unistd.h>
 #include <sys/mman.h>
 #include <fcntl.h>
-#include "cc_pal_log.h"
+#include <pthread.h>
 #include <errno.h>
 #include <string.h>
 #include "cc_pal_types.h"
@@ -19,45 +19,267 @@
 #include "cc_pal_memmap.h"
 #include "cc_registers.h"
 /************************ Defines ******************************/
-static int mapCountImage = 0;
-static int halFileImage = -1;
-
-static int mapCount = 0;
-static int halFileH = -1;
-
 #define PAL_PAGE_SIZE       getpagesize()
 #define PAL_PAGE_MASK       (~(PAL_PAGE_SIZE-1))
 
+#define PAL_MEMMAP_MEM_DEV_NAME     "/dev/mem"
+#define PAL_MEMMAP_IMAGE_DEV_NAME   "/dev/cc_linux_driver"
+
+#define PAL_MEMMAP_NO_WINDOW        (-1)
+
 /************************ Enums ******************************/
 
 /************************ Typedefs ******************************/
 
+/* A page aligned mapping of the device, shared by all the requests it contains */
+typedef struct {
+    CCDmaAddr_t physBase;
+    size_t size;
+    uint8_t *pVirtBase;     /* NULL for a free entry */
+    uint32_t refCount;
+    uint32_t lastUse;       /* release tick, to evict the least recently used idle window */
+} PalMemMapWindow_t;
+
+typedef struct {
+    const char *pDefaultName;
+    const char *pName;
+    int openFlags;
+    int fd;
+    uint32_t useTick;
+    PalMemMapWindow_t windows[CC_PAL_MEMMAP_CACHE_ENTRIES];
+    CCPalMemMapStats_t stats;
+} PalMemMapDev_t;
+
 /************************ Global Data ******************************/
+static pthread_mutex_t palMemMapLock = PTHREAD_MUTEX_INITIALIZER;
+
+static PalMemMapDev_t palMemMapDevs[CC_PAL_MEMMAP_DEV_MAX] = {
+    { PAL_MEMMAP_MEM_DEV_NAME, NULL, O_RDWR | O_SYNC, -1, 0, {{0}}, {0} },
+    { PAL_MEMMAP_IMAGE_DEV_NAME, NULL, O_RDWR, -1, 0, {{0}}, {0} },
+};
 
 /************************ Private Functions ******************************/
-static void PalMemMap(CCDmaAddr_t physicalAddress, uint32_t mapSize, uint32_t **ppVirtBuffAddr, int halFile)
+static uint32_t PalMemMapOpen(PalMemMapDev_t *pDev)
+{
+    const char *pName = (pDev->pName != NULL) ? pDev->pName : pDev->pDefaultName;
+
+    /* Open device file if not already opened */
+    if (pDev->fd >= 0) {
+        return 0;
+    }
+
+    pDev->fd = open(pName, pDev->openFlags);
+    if (pDev->fd < 0) {
+        CC_PAL_LOG_ERR("unable to open %s [%s]\n", pName, strerror(errno));
+        return 1;
+    }
+    (void) fcntl(pDev->fd, F_SETFD, FD_CLOEXEC);
+
+    return 0;
+}
+
+static void PalMemMapCloseIfUnused(PalMemMapDev_t *pDev)
 {
-    CCDmaAddr_t alignStartOffset = physicalAddress & PAL_PAGE_MASK;
-    uint32_t alignSize = physicalAddress - alignStartOffset;
+    if ((pDev->fd >= 0) && (pDev->stats.activeWindows == 0) && (pDev->stats.idleWindows == 0)) {
+        close(pDev->fd);
+        pDev->fd = -1;
+    }
+}
+
+static void PalMemMapWindowUnmap(PalMemMapDev_t *pDev, PalMemMapWindow_t *pWindow)
+{
+    munmap(pWindow->pVirtBase, pWindow->size);
+    pDev->stats.munmapCalls++;
+    pDev->stats.mappedBytes -= pWindow->size;
+    pDev->stats.idleWindows--;
+    memset(pWindow, 0, sizeof(PalMemMapWindow_t));
+}
 
-    *ppVirtBuffAddr = (uint32_t *) mmap(0,
-            mapSize + alignSize,
-            PROT_READ | PROT_WRITE,
-            MAP_SHARED,
-            halFile,
-            alignStartOffset);
+/* Returns the least recently released idle window */
+static int PalMemMapLruIdleWindow(PalMemMapDev_t *pDev)
+{
+    int lruIdx = PAL_MEMMAP_NO_WINDOW;
+    int i;
 
-    if ((*ppVirtBuffAddr != NULL) && (*ppVirtBuffAddr != MAP_FAILED)) {
-        *ppVirtBuffAddr = (uint32_t *)((uintptr_t)*ppVirtBuffAddr + alignSize);
+    for (i = 0; i < CC_PAL_MEMMAP_CACHE_ENTRIES; i++) {
+        if ((pDev->windows[i].pVirtBase != NULL) && (pDev->windows[i].refCount == 0) &&
+            ((lruIdx == PAL_MEMMAP_NO_WINDOW) ||
+             ((int32_t)(pDev->windows[i].lastUse - pDev->windows[lruIdx].lastUse) < 0))) {
+            lruIdx = i;
+        }
     }
+    return lruIdx;
 }
 
-static void PalMemUnMap(uint32_t *pVirtBuffAddr, uint32_t mapSize)
+/* Returns a window containing the whole physical range */
+static int PalMemMapFindPhys(PalMemMapDev_t *pDev, CCDmaAddr_t physStart, CCDmaAddr_t physEnd)
 {
-    uint32_t *pAlignStartOffset = (uint32_t *)((uintptr_t)pVirtBuffAddr & PAL_PAGE_MASK);
-    uint32_t alignSize = (uintptr_t)pVirtBuffAddr - (uintptr_t)pAlignStartOffset;
+    int i;
 
-    munmap(pAlignStartOffset, mapSize + alignSize);
+    for (i = 0; i < CC_PAL_MEMMAP_CACHE_ENTRIES; i++) {
+        if ((pDev->windows[i].pVirtBase != NULL) &&
+            (physStart >= pDev->windows[i].physBase) &&
+            (physEnd <= pDev->windows[i].physBase + pDev->windows[i].size)) {
+            return i;
+        }
+    }
+    return PAL_MEMMAP_NO_WINDOW;
+}
+
+/* Returns the window that contains a virtual address */
+static int PalMemMapFindVirt(PalMemMapDev_t *pDev, const uint8_t *pVirt)
+{
+    int i;
+
+    for (i = 0; i < CC_PAL_MEMMAP_CACHE_ENTRIES; i++) {
+        if ((pDev->windows[i].pVirtBase != NULL) &&
+            (pVirt >= pDev->windows[i].pVirtBase) &&
+            (pVirt < pDev->windows[i].pVirtBase + pDev->windows[i].size)) {
+            return i;
+        }
+    }
+    return PAL_MEMMAP_NO_WINDOW;
+}
+
+/* Checks if another window contains the physical range of a window */
+static CCBool PalMemMapIsCovered(PalMemMapDev_t *pDev, int idx)
+{
+    PalMemMapWindow_t *pWindow = &pDev->windows[idx];
+    int i;
+
+    for (i = 0; i < CC_PAL_MEMMAP_CACHE_ENTRIES; i++) {
+        if ((i != idx) && (pDev->windows[i].pVirtBase != NULL) &&
+            (pWindow->physBase >= pDev->windows[i].physBase) &&
+            (pWindow->physBase + pWindow->size <= pDev->windows[i].physBase + pDev->windows[i].size)) {
+            return CC_TRUE;
+        }
+    }
+    return CC_FALSE;
+}
+
+static uint32_t PalMemMap(PalMemMapDev_t *pDev, CCDmaAddr_t physicalAddress, uint32_t mapSize, uint32_t **ppVirtBuffAddr)
+{
+    CCDmaAddr_t physEnd = physicalAddress + ((mapSize != 0) ? mapSize : 1);
+    CCDmaAddr_t alignStart;
+    CCDmaAddr_t alignEnd;
+    PalMemMapWindow_t *pWindow;
+    void *pMapBase;
+    CCBool isGrown;
+    int idx;
+    int i;
+
+    pDev->stats.mapCalls++;
+
+    idx = PalMemMapFindPhys(pDev, physicalAddress, physEnd);
+    if (idx != PAL_MEMMAP_NO_WINDOW) {
+        pWindow = &pDev->windows[idx];
+        if (pWindow->refCount++ == 0) {
+            pDev->stats.idleWindows--;
+            pDev->stats.activeWindows++;
+        }
+        pDev->stats.cacheHits++;
+        *ppVirtBuffAddr = (uint32_t *)(pWindow->pVirtBase + (physicalAddress - pWindow->physBase));
+        return 0;
+    }
+
+    alignStart = physicalAddress & PAL_PAGE_MASK;
+    alignEnd = (physEnd + PAL_PAGE_SIZE - 1) & PAL_PAGE_MASK;
+
+    /* A window overlapping or adjacent to others replaces them: it covers their range,
+       the idle ones are unmapped now and the referenced ones when they are released */
+    do {
+        isGrown = CC_FALSE;
+        for (i = 0; i < CC_PAL_MEMMAP_CACHE_ENTRIES; i++) {
+            pWindow = &pDev->windows[i];
+            if ((pWindow->pVirtBase == NULL) ||
+                (pWindow->physBase > alignEnd) || (pWindow->physBase + pWindow->size < alignStart)) {
+                continue;
+            }
+            if ((pWindow->physBase < alignStart) || (pWindow->physBase + pWindow->size > alignEnd)) {
+                alignStart = CC_MIN(alignStart, pWindow->physBase);
+                alignEnd = CC_MAX(alignEnd, pWindow->physBase + pWindow->size);
+                isGrown = CC_TRUE;
+            }
+            if (pWindow->refCount == 0) {
+                PalMemMapWindowUnmap(pDev, pWindow);
+            }
+        }
+    } while (isGrown == CC_TRUE);
+
+    for (idx = 0; idx < CC_PAL_MEMMAP_CACHE_ENTRIES; idx++) {
+        if (pDev->windows[idx].pVirtBase == NULL) {
+            break;
+        }
+    }
+    if (idx == CC_PAL_MEMMAP_CACHE_ENTRIES) {
+        idx = PalMemMapLruIdleWindow(pDev);
+        if (idx == PAL_MEMMAP_NO_WINDOW) {
+            CC_PAL_LOG_ERR("no free mapping window for physAddd[0x%08llx]\n", (unsigned long long)physicalAddress);
+            return 2;
+        }
+        PalMemMapWindowUnmap(pDev, &pDev->windows[idx]);
+        pDev->stats.evictions++;
+    }
+
+    if (PalMemMapOpen(pDev) != 0) {
+        return 1;
+    }
+
+    pMapBase = mmap(0,
+                    alignEnd - alignStart,
+                    PROT_READ | PROT_WRITE,
+                    MAP_SHARED,
+                    pDev->fd,
+                    alignStart);
+    pDev->stats.mmapCalls++;
+    if ((pMapBase == NULL) || (pMapBase == MAP_FAILED)) {
+        CC_PAL_LOG_ERR("CC_PalMemMap physAddd[0x%08llx] size[%u] fd[%d] %s\n",
+                       (unsigned long long)physicalAddress, mapSize, pDev->fd, strerror(errno));
+        PalMemMapCloseIfUnused(pDev);
+        return 2;
+    }
+
+    pWindow = &pDev->windows[idx];
+    pWindow->physBase = alignStart;
+    pWindow->size = alignEnd - alignStart;
+    pWindow->pVirtBase = (uint8_t *)pMapBase;
+    pWindow->refCount = 1;
+    pDev->stats.activeWindows++;
+    pDev->stats.mappedBytes += pWindow->size;
+
+    *ppVirtBuffAddr = (uint32_t *)(pWindow->pVirtBase + (physicalAddress - alignStart));
+    return 0;
+}
+
+static uint32_t PalMemUnMap(PalMemMapDev_t *pDev, uint32_t *pVirtBuffAddr)
+{
+    PalMemMapWindow_t *pWindow;
+    int idx;
+
+    idx = PalMemMapFindVirt(pDev, (uint8_t *)pVirtBuffAddr);
+    if ((idx == PAL_MEMMAP_NO_WINDOW) || (pDev->windows[idx].refCount == 0)) {
+        CC_PAL_LOG_ERR("Atempting to unmap an address that is not mapped\n");
+        return 1;
+    }
+
+    pWindow = &pDev->windows[idx];
+    if (--pWindow->refCount != 0) {
+        return 0;
+    }
+    pDev->stats.activeWindows--;
+    pDev->stats.idleWindows++;
+    pWindow->lastUse = ++pDev->useTick;
+
+    /* The window is kept mapped for reuse, unless a larger window replaced it */
+    if (PalMemMapIsCovered(pDev, idx) == CC_TRUE) {
+        PalMemMapWindowUnmap(pDev, pWindow);
+    }
+    while (pDev->stats.idleWindows > CC_PAL_MEMMAP_MAX_IDLE_ENTRIES) {
+        PalMemMapWindowUnmap(pDev, &pDev->windows[PalMemMapLruIdleWindow(pDev)]);
+        pDev->stats.evictions++;
+    }
+
+    return 0;
 }
 
 /************************ Public Functions ******************************/
@@ -74,71 +296,44 @@ static void PalMemUnMap(uint32_t *pVirtBuffAddr, uint32_t mapSize)
  */
 uint32_t CC_PalMemMap(CCDmaAddr_t physicalAddress, uint32_t mapSize, uint32_t **ppVirtBuffAddr)
 {
-    /* Open device file if not already opened */
-    if (halFileH == -1) { /* not opened */
-        halFileH = open("/dev/mem", O_RDWR | O_SYNC);
-        if (halFileH < 0) {
-            CC_PAL_LOG_ERR("unable to open /dev/mem [%s]\n", strerror(errno));
-            return 1;
-        }
-
-        (void) fcntl(halFileH, F_SETFD, FD_CLOEXEC);
-    }
+    uint32_t rc;
 
-    PalMemMap(physicalAddress, mapSize, ppVirtBuffAddr, halFileH);
-    if ((*ppVirtBuffAddr == NULL) || (*ppVirtBuffAddr == MAP_FAILED)) {
-        CC_PAL_LOG_ERR("CC_PalMemMap physAddd[0x%08llx] size[%u] halFileH[%d] %s\n", physicalAddress, mapSize, halFileH, strerror(errno));
-        return 2;
-    }
+    pthread_mutex_lock(&palMemMapLock);
+    rc = PalMemMap(&palMemMapDevs[CC_PAL_MEMMAP_DEV_MEM], physicalAddress, mapSize, ppVirtBuffAddr);
+    pthread_mutex_unlock(&palMemMapLock);
 
-    mapCount++;
-    return 0;
+    return rc;
 }/* End of CC_PalMemMap */
 
 uint32_t CC_PalMemMapImage(CCDmaAddr_t physicalAddress, uint32_t mapSize, uint32_t **ppVirtBuffAddr)
 {
-    /* Open device file if not already opened */
-    if (halFileImage == -1) { /* not opened */
-        halFileImage = open("/dev/cc_linux_driver", O_RDWR);
-        if (halFileImage < 0) {
-            CC_PAL_LOG_ERR("unable to open /dev/cc_linux_driver [%s]\n", strerror(errno));
-            return 1;
-        }
-    }
+    uint32_t rc;
 
+    pthread_mutex_lock(&palMemMapLock);
+    rc = PalMemMap(&palMemMapDevs[CC_PAL_MEMMAP_DEV_IMAGE], physicalAddress, mapSize, ppVirtBuffAddr);
+    pthread_mutex_unlock(&palMemMapLock);
 
-    PalMemMap(physicalAddress, mapSize, ppVirtBuffAddr, halFileImage);
-    if ((*ppVirtBuffAddr == NULL) || (*ppVirtBuffAddr == MAP_FAILED)) {
-        CC_PAL_LOG_ERR("CC_PalMemMap physAddd[0x%08llx] size[%u] halFileH[%d] %s\n", physicalAddress, mapSize, halFileImage, strerror(errno));
-        return 2;
-    }
-
-    mapCountImage++;
-    return 0;
-}/* End of CC_PalMemMap */
+    return rc;
+}/* End of CC_PalMemMapImage */
 
 uint32_t CC_PalMemUnMapImage(uint32_t *pVirtBuffAddr,
 	                 uint32_t mapSize)
 {
-    if (halFileImage < 0) {
-        CC_PAL_LOG_ERR("Atempting to unmap while no FD is open\n");
-        return 1;
-    }
+    uint32_t rc;
 
-    PalMemUnMap(pVirtBuffAddr, mapSize);
-    mapCountImage--;
+    CC_UNUSED_PARAM(mapSize);
 
-    if (mapCountImage == 0) {
-        close(halFileImage);
-        halFileImage = -1;
-    }
+    pthread_mutex_lock(&palMemMapLock);
+    rc = PalMemUnMap(&palMemMapDevs[CC_PAL_MEMMAP_DEV_IMAGE], pVirtBuffAddr);
+    pthread_mutex_unlock(&palMemMapLock);
 
-    return 0;
-}/* End of CC_PalMemUnMap */
+    return rc;
+}/* End of CC_PalMemUnMapImage */
 
 /**
  * @brief This function purpose is to Unmaps a specified address range previously mapped
- *        by CC_PalMemMap
+ *        by CC_PalMemMap. The pages are kept mapped for reuse until they are evicted
+ *        or CC_PalMemMapCacheFlush is called.
  *
  *
  * @param[in] pVirtBuffAddr - Pointer to the base virtual address to which the physical
@@ -150,18 +345,118 @@ uint32_t CC_PalMemUnMapImage(uint32_t *pVirtBuffAddr,
 uint32_t CC_PalMemUnMap(uint32_t *pVirtBuffAddr,
                      uint32_t mapSize)
 {
-    if (halFileH < 0) {
-        CC_PAL_LOG_ERR("Atempting to unmap while no FD is open\n");
+    uint32_t rc;
+
+    CC_UNUSED_PARAM(mapSize);
+
+    pthread_mutex_lock(&palMemMapLock);
+    rc = PalMemUnMap(&palMemMapDevs[CC_PAL_MEMMAP_DEV_MEM], pVirtBuffAddr);
+    pthread_mutex_unlock(&palMemMapLock);
+
+    return rc;
+}/* End of CC_PalMemUnMap */
+
+/**
+ * @brief This function replaces the file that is mapped for a device
+ *
+ * @param[in] dev - The device
+ * @param[in] pDevName - The file name, or NULL for the default device
+ *
+ * @return Returns a non-zero value in case of failure
+ */
+uint32_t CC_PalMemMapDevSet(CCPalMemMapDev_t dev, const char *pDevName)
+{
+    PalMemMapDev_t *pDev;
+    uint32_t rc = 0;
+
+    if (dev >= CC_PAL_MEMMAP_DEV_MAX) {
+        return 1;
+    }
+    pDev = &palMemMapDevs[dev];
+
+    pthread_mutex_lock(&palMemMapLock);
+    if (pDev->stats.activeWindows != 0) {
+        CC_PAL_LOG_ERR("Atempting to replace a device that is in use\n");
+        rc = 2;
+    } else {
+        while (pDev->stats.idleWindows != 0) {
+            PalMemMapWindowUnmap(pDev, &pDev->windows[PalMemMapLruIdleWindow(pDev)]);
+        }
+        PalMemMapCloseIfUnused(pDev);
+        pDev->pName = pDevName;
+    }
+    pthread_mutex_unlock(&palMemMapLock);
+
+    return rc;
+}
+
+/**
+ * @brief This function unmaps the windows that are no longer referenced
+ *
+ * @return Returns a non-zero value in case of failure
+ */
+uint32_t CC_PalMemMapCacheFlush(void)
+{
+    PalMemMapDev_t *pDev;
+    uint32_t dev;
+
+    pthread_mutex_lock(&palMemMapLock);
+    for (dev = 0; dev < CC_PAL_MEMMAP_DEV_MAX; dev++) {
+        pDev = &palMemMapDevs[dev];
+        while (pDev->stats.idleWindows != 0) {
+            PalMemMapWindowUnmap(pDev, &pDev->windows[PalMemMapLruIdleWindow(pDev)]);
+        }
+        PalMemMapCloseIfUnused(pDev);
+    }
+    pthread_mutex_unlock(&palMemMapLock);
+
+    return 0;
+}
+
+/**
+ * @brief This function returns the statistics of the mapping cache of a device
+ *
+ * @param[in] dev - The device
+ * @param[out] pStats - The statistics
+ *
+ * @return Returns a non-zero value in case of failure
+ */
+uint32_t CC_PalMemMapStatsGet(CCPalMemMapDev_t dev, CCPalMemMapStats_t *pStats)
+{
+    if ((dev >= CC_PAL_MEMMAP_DEV_MAX) || (pStats == NULL)) {
         return 1;
     }
 
-    PalMemUnMap(pVirtBuffAddr, mapSize);
-    mapCount--;
+    pthread_mutex_lock(&palMemMapLock);
+    memcpy(pStats, &palMemMapDevs[dev].stats, sizeof(CCPalMemMapStats_t));
+    pthread_mutex_unlock(&palMemMapLock);
+
+    return 0;
+}
+
+/**
+ * @brief This function clears the counters of the mapping cache of a device
+ *
+ * @param[in] dev - The device
+ *
+ * @return Returns a non-zero value in case of failure
+ */
+uint32_t CC_PalMemMapStatsReset(CCPalMemMapDev_t dev)
+{
+    CCPalMemMapStats_t *pStats;
 
-    if (mapCount == 0) {
-        close(halFileH);
-        halFileH = -1;
+    if (dev >= CC_PAL_MEMMAP_DEV_MAX) {
+        return 1;
     }
 
+    pthread_mutex_lock(&palMemMapLock);
+    pStats = &palMemMapDevs[dev].stats;
+    pStats->mapCalls = 0;
+    pStats->cacheHits = 0;
+    pStats->mmapCalls = 0;
+    pStats->munmapCalls = 0;
+    pStats->evictions = 0;
+    pthread_mutex_unlock(&palMemMapLock);
+
     return 0;
-}/* End of CC_PalMemUnMap */
+}
@@ -9,6 +9,9 @@
 #include "cc_pal_log.h"
 #include <unistd.h>
 #include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
 #include <fcntl.h>
 #include <stdlib.h>
 #include <time.h>
@@ -16,9 +19,10 @@
 #include <errno.h>
 #include <string.h>  //memset()
 #include <limits.h>
-#include <unistd.h>
+#include <sched.h>
 #include "dx_reg_base_host.h"
 #include "cc_pal_perf.h"
+#include "cc_pal_memmap.h"
 
 #define SCU_PERIPH_BASE 0xF8F00000
 #define SCU_PERIPH_LEN (4*1024)	//4 K length
@@ -28,31 +32,237 @@
 #define READ_SCU_REG(offset) \
 	(*((volatile uint32_t *)(scuBaseRegVirt + (offset))))
 
+/* Only PKA entries are recorded, set to 0 to record the symmetric entries as well */
+#ifndef CC_PAL_PERF_IGNORE_SYMMETRIC
+#define CC_PAL_PERF_IGNORE_SYMMETRIC  1
+#endif
 
-#define IGNORE_SYMMETRIC  1
-
-static int halArmRegFileH = -1;
-static uint32_t   scuBaseRegVirt = 0;
+#define PAL_PERF_NSEC_IN_SEC	1000000000ULL
 
 typedef struct {
-	uint32_t opCount; /* Number of operations measured */
-	CCPalPerfData_t totalVal; /* Accumulated cycles/uSec */
-	CCPalPerfData_t maxVal; /* Maximum cycles/usec */
-	CCPalPerfData_t minVal; /* Minimum cycles/usec */
+	uint64_t opCount; /* Number of operations measured */
+	CCPalPerfData_t totalVal; /* Accumulated cycles/nSec */
+	CCPalPerfData_t maxVal; /* Maximum cycles/nSec */
+	CCPalPerfData_t minVal; /* Minimum cycles/nSec */
+	uint32_t hist[CC_PAL_PERF_HIST_BUCKETS]; /* Log-linear histogram of the measured values */
 } LibPerfStats_t;
 
+/* Statistics of one thread. Only the owner thread writes to it, so no lock is needed.
+   The blocks are linked to a global list that is only walked by the dump.
+   The owner makes seq odd while it updates the statistics, so that the dump can take a
+   consistent copy without stopping it. */
+typedef struct LibPerfThreadStats {
+	struct LibPerfThreadStats *pNext;
+	uint32_t generation;  /* CC_PalPerfInit generation the block belongs to */
+	uint32_t seq;         /* odd while the owner updates pStats */
+	int perfEventFd;      /* per thread cycle counter, PERF_EVENT backend only */
+	LibPerfStats_t *pStats[PERF_TEST_TYPE_MAX]; /* allocated on first use of each type */
+} LibPerfThreadStats_t;
+
+typedef struct {
+	const char *pName;
+	const char *pUnit;
+	int (*init)(void);
+	void (*fin)(void);
+	CCPalPerfData_t (*read)(void);
+	CCPalPerfData_t (*toUnits)(CCPalPerfData_t delta);
+} LibPerfBackend_t;
+
+static uintptr_t scuBaseRegVirt = 0;
+
+static const LibPerfBackend_t *pLibPerfBackend = NULL;
+static LibPerfThreadStats_t *pLibPerfThreadList = NULL;
+static uint32_t libPerfGeneration = 0;
+/* number of threads that may access the backend or the thread blocks, per generation parity,
+   see LibPerfEnter */
+static uint32_t libPerfUsers[2] = {0, 0};
+static __thread LibPerfThreadStats_t *pLibPerfThreadStats = NULL;
+/* generation of pLibPerfThreadStats, kept here since a block of an old generation may be freed */
+static __thread uint32_t libPerfThreadGeneration = 0;
+
+static LibPerfThreadStats_t *LibStatsGetThreadBlock(void);
+
+/* Every access to the backend or to the thread blocks is done between LibPerfEnter and
+   LibPerfExit. CC_PalPerfInit and CC_PalPerfFin first bump the generation, so that new
+   accesses do not use the old blocks, and then wait for the accesses that entered with the
+   old generation to exit before they release the old blocks and the backend. The accesses
+   of the new generation are counted apart, so they do not delay the wait.
+   CC_PalPerfInit and CC_PalPerfFin are not called concurrently with each other. */
+static uint32_t LibPerfEnter(void)
+{
+	uint32_t generation;
+
+	for (;;) {
+		generation = __atomic_load_n(&libPerfGeneration, __ATOMIC_SEQ_CST);
+		__atomic_add_fetch(&libPerfUsers[generation & 1], 1, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&libPerfGeneration, __ATOMIC_SEQ_CST) == generation) {
+			return generation;
+		}
+		/* raced with CC_PalPerfInit or CC_PalPerfFin, count in the new generation */
+		__atomic_sub_fetch(&libPerfUsers[generation & 1], 1, __ATOMIC_RELEASE);
+	}
+}
+
+static void LibPerfExit(uint32_t generation)
+{
+	__atomic_sub_fetch(&libPerfUsers[generation & 1], 1, __ATOMIC_RELEASE);
+}
+
+/* Bump the generation and wait for the accesses of the previous one */
+static void LibPerfNewGeneration(void)
+{
+	uint32_t generation = __atomic_fetch_add(&libPerfGeneration, 1, __ATOMIC_SEQ_CST);
+
+	while (__atomic_load_n(&libPerfUsers[generation & 1], __ATOMIC_SEQ_CST) != 0) {
+		sched_yield();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////  backends //////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static CCPalPerfData_t PalPerfIdentity(CCPalPerfData_t delta)
+{
+	return delta;
+}
+
+/* CLOCK_MONOTONIC_RAW */
+static int PalPerfMonotonicInit(void)
+{
+	struct timespec ts;
+
+	return clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+}
 
-/* Performance statistics for init/process/finalize/integrated */
-LibPerfStats_t libPerfStats[PERF_TEST_TYPE_MAX];
+static void PalPerfMonotonicFin(void)
+{
+}
+
+static CCPalPerfData_t PalPerfMonotonicRead(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+	return ((CCPalPerfData_t)ts.tv_sec * PAL_PERF_NSEC_IN_SEC) + (CCPalPerfData_t)ts.tv_nsec;
+}
+
+static const LibPerfBackend_t libPerfBackendMonotonic = {
+	"monotonic_raw", "ns", PalPerfMonotonicInit, PalPerfMonotonicFin, PalPerfMonotonicRead, PalPerfIdentity
+};
+
+#ifdef __aarch64__
+/* AArch64 generic timer virtual counter */
+static uint64_t cntFrq = 0;
+
+static int PalPerfCntvctInit(void)
+{
+	__asm__ __volatile__("mrs %0, cntfrq_el0" : "=r" (cntFrq));
+	return (cntFrq == 0) ? -1 : 0;
+}
+
+static CCPalPerfData_t PalPerfCntvctRead(void)
+{
+	uint64_t val;
+
+	__asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r" (val) :: "memory");
+	return val;
+}
+
+static CCPalPerfData_t PalPerfCntvctToNs(CCPalPerfData_t delta)
+{
+	/* split to avoid overflow of delta * 10^9 */
+	return ((delta / cntFrq) * PAL_PERF_NSEC_IN_SEC) + (((delta % cntFrq) * PAL_PERF_NSEC_IN_SEC) / cntFrq);
+}
+
+static const LibPerfBackend_t libPerfBackendCntvct = {
+	"cntvct_el0", "ns", PalPerfCntvctInit, PalPerfMonotonicFin, PalPerfCntvctRead, PalPerfCntvctToNs
+};
+#endif
+
+/* perf_event CPU cycles, counted per thread */
+static int PalPerfEventOpen(void)
+{
+	struct perf_event_attr attr;
+	int fd;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CPU_CYCLES;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+
+	fd = (int)syscall(__NR_perf_event_open, &attr, 0 /* this thread */, -1, -1, 0);
+	if (fd >= 0) {
+		(void)fcntl(fd, F_SETFD, FD_CLOEXEC);
+	}
+	return fd;
+}
+
+static int PalPerfEventInit(void)
+{
+	int fd = PalPerfEventOpen();
+
+	if (fd < 0) {
+		CC_PAL_LOG_ERR("perf_event_open failed [%s]\n", strerror(errno));
+		return -1;
+	}
+	close(fd);
+	return 0;
+}
 
-static inline CCPalPerfData_t get_libCyclecount(void)
+static CCPalPerfData_t PalPerfEventRead(void)
+{
+	LibPerfThreadStats_t *pBlock = LibStatsGetThreadBlock();
+	uint64_t val = 0;
+
+	/* the counter is per thread, it is opened with the thread block */
+	if ((pBlock == NULL) || (pBlock->perfEventFd < 0)) {
+		return 0;
+	}
+	if (read(pBlock->perfEventFd, &val, sizeof(val)) != sizeof(val)) {
+		return 0;
+	}
+	return val;
+}
+
+static const LibPerfBackend_t libPerfBackendPerfEvent = {
+	"perf_event", "cycles", PalPerfEventInit, PalPerfMonotonicFin, PalPerfEventRead, PalPerfIdentity
+};
+
+/* Zynq SCU global timer, mapped through the PAL mapping cache */
+static int init_Perfcounters(void)
+{
+	uint32_t *pMapBase = NULL;
+
+	if (scuBaseRegVirt != 0) { /* already mapped */
+		return 0;
+	}
+	if (CC_PalMemMap(SCU_PERIPH_BASE, SCU_PERIPH_LEN, &pMapBase) != 0) {
+		CC_PAL_LOG_ERR("Invalid pMapBase\n");
+		return -1;
+	}
+	scuBaseRegVirt = (uintptr_t)pMapBase;
+	return 0;
+}
+
+static void finish_Perfcounters(void)
+{
+	if (scuBaseRegVirt != 0) {
+		(void)CC_PalMemUnMap((uint32_t *)scuBaseRegVirt, SCU_PERIPH_LEN);
+	}
+	scuBaseRegVirt = 0;
+}
+
+static CCPalPerfData_t get_libCyclecount(void)
 {
         uint32_t valMsb;
         uint32_t valMsbPrev;
         uint32_t valLsb;
 	CCPalPerfData_t totalVal = 0;
 
-	if (scuBaseRegVirt <= 0) {
+	if (scuBaseRegVirt == 0) {
 		CC_PAL_LOG_ERR("Invalid scuBaseRegVirt\n");
 		return 0;
 	}
@@ -75,63 +285,228 @@ static inline CCPalPerfData_t get_libCyclecount(void)
         return (totalVal);
 }
 
-void init_Perfcounters()
+static const LibPerfBackend_t libPerfBackendZynqScu = {
+	"zynq_scu", "cycles", init_Perfcounters, finish_Perfcounters, get_libCyclecount, PalPerfIdentity
+};
+
+static const LibPerfBackend_t *PalPerfSelectBackend(void)
 {
-	uint32_t *pMapBase = NULL;
-	/* Open device file if not already opened */
-	if (halArmRegFileH >= 0) { /* already opened */
-		return;
+	switch (CC_PAL_PERF_BACKEND) {
+#ifdef __aarch64__
+	case CC_PAL_PERF_BACKEND_CNTVCT:
+		return &libPerfBackendCntvct;
+#endif
+	case CC_PAL_PERF_BACKEND_PERF_EVENT:
+		return &libPerfBackendPerfEvent;
+	case CC_PAL_PERF_BACKEND_ZYNQ_SCU:
+		return &libPerfBackendZynqScu;
+	default:
+		return &libPerfBackendMonotonic;
 	}
-	scuBaseRegVirt = 0;
-	halArmRegFileH = open("/dev/mem", O_RDWR|O_SYNC);
-	if (halArmRegFileH < 0) {
-		CC_PAL_LOG_ERR("Invalid halArmRegFileH\n");
-		return;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////  statistics ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t LibStatsHistBucket(CCPalPerfData_t val)
+{
+	uint32_t exp;
+	uint32_t bucket;
+
+	if (val < (1UL << CC_PAL_PERF_HIST_SUB_BITS)) {
+		return (uint32_t)val;
 	}
-	(void)fcntl(halArmRegFileH, F_SETFD, FD_CLOEXEC);
+	exp = 63 - __builtin_clzll(val);
+	bucket = ((exp - CC_PAL_PERF_HIST_SUB_BITS + 1) << CC_PAL_PERF_HIST_SUB_BITS) +
+		 (uint32_t)((val >> (exp - CC_PAL_PERF_HIST_SUB_BITS)) & ((1UL << CC_PAL_PERF_HIST_SUB_BITS) - 1));
 
-	pMapBase = mmap(0, SCU_PERIPH_LEN, PROT_READ|PROT_WRITE, MAP_SHARED, halArmRegFileH, SCU_PERIPH_BASE);
-	if ((pMapBase == NULL) || (pMapBase == MAP_FAILED)) {
-		close(halArmRegFileH);
-		halArmRegFileH = -1;
-		CC_PAL_LOG_ERR("Invalid pMapBase\n");
-		return;
+	return CC_MIN(bucket, CC_PAL_PERF_HIST_BUCKETS - 1);
+}
+
+/* Largest value that falls in the bucket */
+static CCPalPerfData_t LibStatsHistBucketTop(uint32_t bucket)
+{
+	uint32_t exp;
+	uint32_t sub;
+
+	if (bucket < (1UL << CC_PAL_PERF_HIST_SUB_BITS)) {
+		return bucket;
 	}
-	scuBaseRegVirt =  (uint32_t)pMapBase;
+	exp = (bucket >> CC_PAL_PERF_HIST_SUB_BITS) + CC_PAL_PERF_HIST_SUB_BITS - 1;
+	sub = bucket & ((1UL << CC_PAL_PERF_HIST_SUB_BITS) - 1);
+
+	return ((((CCPalPerfData_t)1 << CC_PAL_PERF_HIST_SUB_BITS) + sub + 1) << (exp - CC_PAL_PERF_HIST_SUB_BITS)) - 1;
 }
 
-void finish_Perfcounters()
+/* Called between LibPerfEnter and LibPerfExit */
+static LibPerfThreadStats_t *LibStatsGetThreadBlock(void)
 {
-	munmap((uint32_t *)scuBaseRegVirt, SCU_PERIPH_LEN);
-	close(halArmRegFileH);
-	halArmRegFileH = -1;
-	scuBaseRegVirt = 0;
+	LibPerfThreadStats_t *pBlock = pLibPerfThreadStats;
+	uint32_t generation = __atomic_load_n(&libPerfGeneration, __ATOMIC_SEQ_CST);
+
+	if ((pBlock != NULL) && (libPerfThreadGeneration == generation)) {
+		return pBlock;
+	}
+
+	/* First use in this thread since CC_PalPerfInit - the previous block, if any, is released
+	   by CC_PalPerfInit or CC_PalPerfFin and must not be accessed */
+	pLibPerfThreadStats = NULL;
+	pBlock = calloc(1, sizeof(LibPerfThreadStats_t));
+	if (pBlock == NULL) {
+		return NULL;
+	}
+	pBlock->generation = generation;
+	pBlock->perfEventFd = -1;
+	if (__atomic_load_n(&pLibPerfBackend, __ATOMIC_RELAXED) == &libPerfBackendPerfEvent) {
+		pBlock->perfEventFd = PalPerfEventOpen();
+	}
+
+	/* lock free push to the list of thread blocks */
+	pBlock->pNext = __atomic_load_n(&pLibPerfThreadList, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n(&pLibPerfThreadList, &pBlock->pNext, pBlock,
+					    0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+		/* pBlock->pNext was updated with the current head */
+	}
+
+	pLibPerfThreadStats = pBlock;
+	libPerfThreadGeneration = generation;
+	return pBlock;
 }
 
 /*!
- * Accumulate given cycles or latency (in nSec) to the statistics
+ * Accumulate given cycles or latency (in nSec) to the statistics of the calling thread.
+ * Called between LibPerfEnter and LibPerfExit.
  *
  * \param val cycles/time in nsec
  * \param opType Operation type
  */
 void LibStatsValAccum(CCPalPerfData_t val,  CCPalPerfType_t opType)
 {
-	libPerfStats[opType].opCount++;
-	libPerfStats[opType].totalVal += val;
-	if ((val < libPerfStats[opType].minVal) ||
-	    (1 == libPerfStats[opType].opCount)) {
-		libPerfStats[opType].minVal = val;
+	LibPerfThreadStats_t *pBlock = LibStatsGetThreadBlock();
+	LibPerfStats_t *pStats;
+
+	if (pBlock == NULL) {
+		return;
+	}
+	pStats = pBlock->pStats[opType];
+	if (pStats == NULL) {
+		pStats = calloc(1, sizeof(LibPerfStats_t));
+		if (pStats == NULL) {
+			return;
+		}
+		__atomic_store_n(&pBlock->pStats[opType], pStats, __ATOMIC_RELEASE);
+	}
+
+	__atomic_store_n(&pBlock->seq, pBlock->seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	if ((val < pStats->minVal) || (0 == pStats->opCount)) {
+		pStats->minVal = val;
+	}
+	if (val > pStats->maxVal) {
+		pStats->maxVal = val;
+	}
+	pStats->totalVal += val;
+	pStats->hist[LibStatsHistBucket(val)]++;
+	pStats->opCount++;
+	__atomic_store_n(&pBlock->seq, pBlock->seq + 1, __ATOMIC_RELEASE);
+}
+
+/* Copy the statistics of one thread, retrying while the owner updates them */
+static void LibStatsSnapshot(LibPerfThreadStats_t *pBlock, LibPerfStats_t *pStats, LibPerfStats_t *pCopy)
+{
+	uint32_t seq;
+
+	do {
+		while (((seq = __atomic_load_n(&pBlock->seq, __ATOMIC_ACQUIRE)) & 1) != 0) {
+			sched_yield();
+		}
+		memcpy(pCopy, pStats, sizeof(LibPerfStats_t));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	} while (__atomic_load_n(&pBlock->seq, __ATOMIC_RELAXED) != seq);
+}
+
+/* Merge the statistics of all threads for one type. Called between LibPerfEnter and LibPerfExit. */
+static void LibStatsMerge(CCPalPerfType_t opType, LibPerfStats_t *pMerged)
+{
+	LibPerfThreadStats_t *pBlock;
+	LibPerfStats_t *pStats;
+	LibPerfStats_t stats;
+	uint32_t generation = __atomic_load_n(&libPerfGeneration, __ATOMIC_SEQ_CST);
+	uint32_t i;
+
+	memset(pMerged, 0, sizeof(LibPerfStats_t));
+	for (pBlock = __atomic_load_n(&pLibPerfThreadList, __ATOMIC_ACQUIRE); pBlock != NULL; pBlock = pBlock->pNext) {
+		pStats = __atomic_load_n(&pBlock->pStats[opType], __ATOMIC_ACQUIRE);
+		if ((pStats == NULL) || (pBlock->generation != generation)) {
+			continue;
+		}
+		LibStatsSnapshot(pBlock, pStats, &stats);
+		if (stats.opCount == 0) {
+			continue;
+		}
+		if ((pMerged->opCount == 0) || (stats.minVal < pMerged->minVal)) {
+			pMerged->minVal = stats.minVal;
+		}
+		if (stats.maxVal > pMerged->maxVal) {
+			pMerged->maxVal = stats.maxVal;
+		}
+		pMerged->opCount += stats.opCount;
+		pMerged->totalVal += stats.totalVal;
+		for (i = 0; i < CC_PAL_PERF_HIST_BUCKETS; i++) {
+			pMerged->hist[i] += stats.hist[i];
+		}
 	}
-	if (val > libPerfStats[opType].maxVal) {
-		libPerfStats[opType].maxVal = val;
+}
+
+static CCPalPerfData_t LibStatsPercentile(LibPerfStats_t *pStats, uint32_t perMille)
+{
+	uint64_t rank = ((pStats->opCount * perMille) + 999) / 1000;
+	uint64_t accum = 0;
+	uint32_t i;
+
+	for (i = 0; i < CC_PAL_PERF_HIST_BUCKETS; i++) {
+		accum += pStats->hist[i];
+		if (accum >= rank) {
+			return CC_MIN(LibStatsHistBucketTop(i), pStats->maxVal);
+		}
 	}
+	return pStats->maxVal;
+}
 
+/* Release the blocks of the previous generations. Called after the generation is bumped and
+   LibPerfNewGeneration returned, so that no thread accesses these blocks any more. The blocks that
+   threads created since then belong to the current generation and are put back on the list. */
+static void LibStatsRelease(void)
+{
+	uint32_t generation = __atomic_load_n(&libPerfGeneration, __ATOMIC_SEQ_CST);
+	LibPerfThreadStats_t *pBlock = __atomic_exchange_n(&pLibPerfThreadList, NULL, __ATOMIC_ACQ_REL);
+	LibPerfThreadStats_t *pNext;
+	uint32_t i;
+
+	for (; pBlock != NULL; pBlock = pNext) {
+		pNext = pBlock->pNext;
+		if (pBlock->generation == generation) {
+			pBlock->pNext = __atomic_load_n(&pLibPerfThreadList, __ATOMIC_RELAXED);
+			while (!__atomic_compare_exchange_n(&pLibPerfThreadList, &pBlock->pNext, pBlock,
+							    0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+				/* pBlock->pNext was updated with the current head */
+			}
+			continue;
+		}
+		for (i = 0; i < PERF_TEST_TYPE_MAX; i++) {
+			free(pBlock->pStats[i]);
+		}
+		if (pBlock->perfEventFd >= 0) {
+			close(pBlock->perfEventFd);
+		}
+		free(pBlock);
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////  cycle implemetation ///////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#if CC_PLAT_ZYNQ7000
 
 /**
  * @brief   initialize performance test mechanism
@@ -142,8 +517,17 @@ void LibStatsValAccum(CCPalPerfData_t val,  CCPalPerfType_t opType)
  */
 void CC_PalPerfInit(void)
 {
-	init_Perfcounters();
-	memset(&libPerfStats, 0, sizeof(libPerfStats));
+	const LibPerfBackend_t *pBackend = PalPerfSelectBackend();
+
+	if (pBackend->init() != 0) {
+		CC_PAL_LOG_ERR("perf backend %s failed, using %s\n", pBackend->pName, libPerfBackendMonotonic.pName);
+		pBackend = &libPerfBackendMonotonic;
+		(void)pBackend->init();
+	}
+	__atomic_store_n(&pLibPerfBackend, pBackend, __ATOMIC_SEQ_CST);
+	/* invalidates the thread blocks of the previous init, they are released once no thread uses them */
+	LibPerfNewGeneration();
+	LibStatsRelease();
 }
 
 /**
@@ -155,8 +539,68 @@ void CC_PalPerfInit(void)
  */
 void CC_PalPerfFin(void)
 {
-	finish_Perfcounters();
-	memset(&libPerfStats, 0, sizeof(libPerfStats));
+	const LibPerfBackend_t *pBackend = __atomic_exchange_n(&pLibPerfBackend, NULL, __ATOMIC_SEQ_CST);
+
+	LibPerfNewGeneration();
+	if (pBackend != NULL) {
+		pBackend->fin();
+	}
+	LibStatsRelease();
+}
+
+/**
+ * @brief   reads the time stamp of the perf backend
+ *
+ * @param[in] None
+ *
+ * @return The time stamp in backend ticks, or 0 if the perf is not initialized
+ */
+CCPalPerfData_t CC_PalPerfGetTimestamp(void)
+{
+	const LibPerfBackend_t *pBackend;
+	CCPalPerfData_t val = 0;
+	uint32_t generation = LibPerfEnter();
+
+	pBackend = __atomic_load_n(&pLibPerfBackend, __ATOMIC_SEQ_CST);
+	if (pBackend != NULL) {
+		val = pBackend->read();
+	}
+	LibPerfExit(generation);
+	return val;
+}
+
+/**
+ * @brief   converts a difference of time stamps to the units of the perf backend
+ *
+ * @param[in] ticks -  difference of time stamps returned by CC_PalPerfGetTimestamp
+ *
+ * @return The difference in backend units
+ */
+CCPalPerfData_t CC_PalPerfTicksToUnits(CCPalPerfData_t ticks)
+{
+	const LibPerfBackend_t *pBackend = __atomic_load_n(&pLibPerfBackend, __ATOMIC_ACQUIRE);
+
+	if (pBackend == NULL) {
+		return 0;
+	}
+	return pBackend->toUnits(ticks);
+}
+
+/**
+ * @brief   returns the name of the units of the perf backend
+ *
+ * @param[in] None
+ *
+ * @return The units name
+ */
+const char *CC_PalPerfUnitStr(void)
+{
+	const LibPerfBackend_t *pBackend = __atomic_load_n(&pLibPerfBackend, __ATOMIC_ACQUIRE);
+
+	if (pBackend == NULL) {
+		return "";
+	}
+	return pBackend->pUnit;
 }
 
 /**
@@ -168,10 +612,9 @@ void CC_PalPerfFin(void)
  */
 CCPalPerfData_t CC_PalPerfOpenNewEntry(CCPalPerfType_t perfType)
 {
-	CCPalPerfData_t curCycles = 0;
-	curCycles =  get_libCyclecount();
-	CC_PAL_LOG_INFO("CC_PalPerfOpenNewEntry ended 0x%x \n", curCycles);
-	return curCycles;
+	CC_UNUSED_PARAM(perfType);
+
+	return CC_PalPerfGetTimestamp();
 }
 
 /**
@@ -184,106 +627,130 @@ CCPalPerfData_t CC_PalPerfOpenNewEntry(CCPalPerfType_t perfType)
  */
 void CC_PalPerfCloseEntry(CCPalPerfData_t startCycles, CCPalPerfType_t opType)
 {
+	const LibPerfBackend_t *pBackend;
 	CCPalPerfData_t curCycles = 0;
 	CCPalPerfData_t totalVal = 0;
+	uint32_t generation;
 
 	if ((opType >= PERF_TEST_TYPE_MAX) ||
 	    (0 == startCycles)) {
 		CC_PAL_LOG_ERR("%s Invalid opType=%d or startCycles %lld\n", __FUNCTION__, opType, startCycles);
 		return;
 	}
-#if IGNORE_SYMMETRIC
+#if CC_PAL_PERF_IGNORE_SYMMETRIC
 	if ((opType < PERF_TEST_TYPE_PKA_ModExp) ||
 	    (opType >= PERF_TEST_TYPE_TEST_BASE)) {
 		return;
 	}
 #endif
-	curCycles = get_libCyclecount();
+	generation = LibPerfEnter();
+	pBackend = __atomic_load_n(&pLibPerfBackend, __ATOMIC_SEQ_CST);
+	if (pBackend == NULL) {
+		CC_PAL_LOG_ERR("%s perf is not initialized\n", __FUNCTION__);
+		goto End;
+	}
+	curCycles = pBackend->read();
 	if (0 == curCycles) {
 		CC_PAL_LOG_ERR("0 == curCycles\n");
-		return;
+		goto End;
 	}
 	if (curCycles < startCycles) {
 		totalVal = (UINT64_MAX-startCycles)+curCycles;
 	} else {
 		totalVal = curCycles - startCycles;
 	}
-	LibStatsValAccum(totalVal,  opType);
-	CC_PAL_LOG_INFO("CC_PalPerfCloseEntry ended 0x%x\n", totalVal);
+	LibStatsValAccum(pBackend->toUnits(totalVal), opType);
+End:
+	LibPerfExit(generation);
 }
 
 /**
- * @brief   dumps the performance buffer
+ * @brief   dumps the performance statistics of all threads
  *
- * @param[in] None
+ * @param[in] format -  output format
+ * @param[in] pFileName -  output file name, or NULL for stdout
  *
- * @return None
+ * @return Returns a non-zero value in case of failure
  */
-void CC_PalPerfDump()
+int CC_PalPerfDumpToFile(CCPalPerfDumpFormat_t format, const char *pFileName)
 {
 	int i;
-	CCPalPerfData_t avgCycles;
+	uint32_t numOfDumped = 0;
+	LibPerfStats_t mergedStats;
+	char typeStr[64];
+	FILE *pFile = stdout;
+	const LibPerfBackend_t *pBackend;
+	uint32_t generation;
 
-#if IGNORE_SYMMETRIC
-	for (i = PERF_TEST_TYPE_PKA_ModExp; i < PERF_TEST_TYPE_TEST_BASE; i++) {
-#else
-	for (i = PERF_TEST_TYPE_CC_AES_INTGR; i < PERF_TEST_TYPE_MAX; i++) {
-#endif
-		if (libPerfStats[i].opCount != 0) {
-			avgCycles = libPerfStats[i].totalVal / libPerfStats[i].opCount;
-		} else {
-			continue;
+	/* the statistics of the threads are merged while they keep accumulating */
+	generation = LibPerfEnter();
+	pBackend = __atomic_load_n(&pLibPerfBackend, __ATOMIC_SEQ_CST);
+	if (pBackend == NULL) {
+		LibPerfExit(generation);
+		return 1;
+	}
+	if (pFileName != NULL) {
+		pFile = fopen(pFileName, "w");
+		if (pFile == NULL) {
+			CC_PAL_LOG_ERR("unable to open %s [%s]\n", pFileName, strerror(errno));
+			LibPerfExit(generation);
+			return 1;
 		}
-		CC_PAL_LOG_INFO("0x%x: count=%d  cycles=[min,avg,max,sum] %lld %lld %lld %lld \n",
-		     i, libPerfStats[i].opCount, libPerfStats[i].minVal, avgCycles, libPerfStats[i].maxVal, libPerfStats[i].totalVal );
 	}
-}
 
+	if (format == CC_PAL_PERF_DUMP_FORMAT_JSON) {
+		fprintf(pFile, "{\"backend\":\"%s\",\"unit\":\"%s\",\"entries\":[",
+			pBackend->pName, pBackend->pUnit);
+	} else {
+		fprintf(pFile, "type,name,unit,count,min,avg,max,p50,p99,p999,sum\n");
+	}
 
-#else  //CC_PLAT_ZYNQ7000
-/**
- * @brief   initialize performance test mechanism
- *
- * @param[in]
- * *
- * @return None
- */
-void CC_PalPerfInit(void)
-{
-}
+	for (i = 0; i < PERF_TEST_TYPE_MAX; i++) {
+		LibStatsMerge((CCPalPerfType_t)i, &mergedStats);
+		if (mergedStats.opCount == 0) {
+			continue;
+		}
+		CC_PalPerfTypeStr((CCPalPerfType_t)i, typeStr, sizeof(typeStr) - 1);
+		typeStr[sizeof(typeStr) - 1] = '\0';
 
-/**
- * @brief   terminates resources used for performance tests
- *
- * @param[in]
- * *
- * @return None
- */
-void CC_PalPerfFin(void)
-{
-}
+		if (format == CC_PAL_PERF_DUMP_FORMAT_JSON) {
+			fprintf(pFile, "%s{\"type\":%d,\"name\":\"%s\",\"count\":%llu,\"min\":%llu,\"avg\":%llu,\"max\":%llu,"
+				"\"p50\":%llu,\"p99\":%llu,\"p999\":%llu,\"sum\":%llu}",
+				(numOfDumped == 0) ? "" : ",", i, typeStr,
+				(unsigned long long)mergedStats.opCount,
+				(unsigned long long)mergedStats.minVal,
+				(unsigned long long)(mergedStats.totalVal / mergedStats.opCount),
+				(unsigned long long)mergedStats.maxVal,
+				(unsigned long long)LibStatsPercentile(&mergedStats, 500),
+				(unsigned long long)LibStatsPercentile(&mergedStats, 990),
+				(unsigned long long)LibStatsPercentile(&mergedStats, 999),
+				(unsigned long long)mergedStats.totalVal);
+		} else {
+			fprintf(pFile, "0x%x,%s,%s,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu\n",
+				i, typeStr, pBackend->pUnit,
+				(unsigned long long)mergedStats.opCount,
+				(unsigned long long)mergedStats.minVal,
+				(unsigned long long)(mergedStats.totalVal / mergedStats.opCount),
+				(unsigned long long)mergedStats.maxVal,
+				(unsigned long long)LibStatsPercentile(&mergedStats, 500),
+				(unsigned long long)LibStatsPercentile(&mergedStats, 990),
+				(unsigned long long)LibStatsPercentile(&mergedStats, 999),
+				(unsigned long long)mergedStats.totalVal);
+		}
+		numOfDumped++;
+	}
 
-/**
- * @brief   opens new entry in perf buffer to record new entry
- *
- * @param[in] entryType -  entry type (defined in cc_pal_perf.h) to be recorded in buffer
- *
- * @return Returns a non-zero value in case of failure
- */
-CCPalPerfData_t CC_PalPerfOpenNewEntry(CCPalPerfType_t perfType)
-{
-}
+	if (format == CC_PAL_PERF_DUMP_FORMAT_JSON) {
+		fprintf(pFile, "]}\n");
+	}
+	LibPerfExit(generation);
 
-/**
- * @brief   closes entry in perf buffer previously opened by CC_PalPerfOpenNewEntry
- *
- * @param[in] idx -  index of the entry to be closed, the return value of CC_PalPerfOpenNewEntry
- * @param[in] entryType -  entry type (defined in cc_pal_perf.h) to be recorded in buffer
- *
- * @return Returns a non-zero value in case of failure
- */
-void CC_PalPerfCloseEntry(CCPalPerfData_t startCycles, CCPalPerfType_t opType)
-{
+	if (pFile != stdout) {
+		fclose(pFile);
+	} else {
+		fflush(pFile);
+	}
+	return 0;
 }
 
 /**
@@ -295,5 +762,5 @@ void CC_PalPerfCloseEntry(CCPalPerfData_t startCycles, CCPalPerfType_t opType)
  */
 void CC_PalPerfDump()
 {
+	(void)CC_PalPerfDumpToFile(CC_PAL_PERF_DUMP_FORMAT_CSV, NULL);
 }
-#endif  //CC_PLAT_ZYNQ7000
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/************* Include Files ****************/
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "cc_pal_types.h"
+#include "cc_pal_trace.h"
+
+/************************ Defines ******************************/
+#if (CC_PAL_TRACE_RING_ENTRIES & (CC_PAL_TRACE_RING_ENTRIES - 1)) != 0
+#error CC_PAL_TRACE_RING_ENTRIES must be a power of 2
+#endif
+
+#define PAL_TRACE_RING_MASK     (CC_PAL_TRACE_RING_ENTRIES - 1)
+#define PAL_TRACE_NSEC_IN_SEC   1000000000ULL
+
+/************************ Enums ******************************/
+
+/************************ Typedefs ******************************/
+
+/* Ring of one thread. Only the owner thread writes to it, so no lock is needed.
+   The rings are linked to a global list that is only walked by the dump. */
+typedef struct PalTraceRing {
+	struct PalTraceRing *pNext;
+	uint32_t threadId;
+	uint64_t head;      /* number of records written */
+	CCPalTraceRecord_t records[CC_PAL_TRACE_RING_ENTRIES];
+} PalTraceRing_t;
+
+/************************ Global Data ******************************/
+
+static PalTraceRing_t *pPalTraceRingList = NULL;
+static uint32_t palTraceEnabled = 1;
+static uint32_t palTraceGeneration = 0;
+static __thread PalTraceRing_t *pPalTraceRing = NULL;
+static __thread uint32_t palTraceRingGeneration = 0;
+
+/************************ Private Functions ******************************/
+
+static PalTraceRing_t *PalTraceGetRing(void)
+{
+	PalTraceRing_t *pRing = pPalTraceRing;
+	uint32_t generation = __atomic_load_n(&palTraceGeneration, __ATOMIC_ACQUIRE);
+
+	if ((pRing != NULL) && (palTraceRingGeneration == generation)) {
+		return pRing;
+	}
+
+	/* First record of this thread since the last CC_PalTraceFin - the previous ring, if any, was released */
+	pRing = calloc(1, sizeof(PalTraceRing_t));
+	pPalTraceRing = pRing;
+	palTraceRingGeneration = generation;
+	if (pRing == NULL) {
+		return NULL;
+	}
+	pRing->threadId = (uint32_t)syscall(SYS_gettid);
+
+	/* lock free push to the list of rings */
+	pRing->pNext = __atomic_load_n(&pPalTraceRingList, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n(&pPalTraceRingList, &pRing->pNext, pRing,
+					    0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+		/* pRing->pNext was updated with the current head */
+	}
+
+	return pRing;
+}
+
+/* Copy the record of the given ring index, dropping it if its owner thread is overwriting it
+   or has already replaced it with a newer record */
+static uint32_t PalTraceRecordCopy(const CCPalTraceRecord_t *pSrc, CCPalTraceRecord_t *pDst, uint64_t idx)
+{
+	uint32_t seq = __atomic_load_n(&pSrc->seq, __ATOMIC_ACQUIRE);
+
+	memcpy(pDst, pSrc, sizeof(CCPalTraceRecord_t));
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	if ((seq == 0) || (seq != (uint32_t)(idx + 1)) || (__atomic_load_n(&pSrc->seq, __ATOMIC_RELAXED) != seq)) {
+		memset(pDst, 0, sizeof(CCPalTraceRecord_t));
+		return 0;
+	}
+	pDst->seq = seq;
+	return 1;
+}
+
+/************************ Public Functions ******************************/
+
+/**
+ * @brief   Stores a trace record in the ring of the calling thread
+ *
+ * @param[in] fmtId - the trace point identifier
+ * @param[in] numArgs - the number of valid arguments
+ * @param[in] a0-a5 - the raw arguments
+ *
+ * @return None
+ */
+void CC_PalTraceRecord(uint16_t fmtId, uint32_t numArgs,
+		       uint64_t a0, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	PalTraceRing_t *pRing;
+	CCPalTraceRecord_t *pRecord;
+	struct timespec ts;
+	uint64_t head;
+
+	if (__atomic_load_n(&palTraceEnabled, __ATOMIC_RELAXED) == 0) {
+		return;
+	}
+	pRing = PalTraceGetRing();
+	if (pRing == NULL) {
+		return;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	head = pRing->head;
+	pRecord = &pRing->records[head & PAL_TRACE_RING_MASK];
+
+	/* invalidate the record for a concurrent dump, then fill it and publish its sequence number */
+	__atomic_store_n(&pRecord->seq, 0, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	pRecord->fmtId = fmtId;
+	pRecord->numArgs = (uint8_t)numArgs;
+	pRecord->reserved = 0;
+	pRecord->timeNs = ((uint64_t)ts.tv_sec * PAL_TRACE_NSEC_IN_SEC) + (uint64_t)ts.tv_nsec;
+	pRecord->args[0] = a0;
+	pRecord->args[1] = a1;
+	pRecord->args[2] = a2;
+	pRecord->args[3] = a3;
+	pRecord->args[4] = a4;
+	pRecord->args[5] = a5;
+	__atomic_store_n(&pRecord->seq, (uint32_t)(head + 1), __ATOMIC_RELEASE);
+	__atomic_store_n(&pRing->head, head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief   Enables or disables the recording of trace points
+ *
+ * @param[in] enable - CC_TRUE to record trace points
+ *
+ * @return None
+ */
+void CC_PalTraceEnable(CCBool enable)
+{
+	__atomic_store_n(&palTraceEnabled, (enable == CC_FALSE) ? 0 : 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief   Writes the rings of all threads to a binary file
+ *
+ * @param[in] pFileName - the output file name
+ *
+ * @return 0 on success, non-zero value on failure
+ */
+int CC_PalTraceDump(const char *pFileName)
+{
+	CCPalTraceFileHeader_t fileHeader;
+	CCPalTraceRingHeader_t ringHeader;
+	CCPalTraceRecord_t record;
+	PalTraceRing_t *pRing;
+	PalTraceRing_t *pList;
+	FILE *pFile;
+	uint64_t idx;
+	uint64_t first;
+	int rc = 0;
+
+	if (pFileName == NULL) {
+		return -1;
+	}
+	pFile = fopen(pFileName, "wb");
+	if (pFile == NULL) {
+		return -1;
+	}
+
+	pList = __atomic_load_n(&pPalTraceRingList, __ATOMIC_ACQUIRE);
+	memset(&fileHeader, 0, sizeof(fileHeader));
+	fileHeader.magic = CC_PAL_TRACE_FILE_MAGIC;
+	fileHeader.version = CC_PAL_TRACE_FILE_VERSION;
+	fileHeader.recordSize = sizeof(CCPalTraceRecord_t);
+	for (pRing = pList; pRing != NULL; pRing = pRing->pNext) {
+		fileHeader.numOfRings++;
+	}
+	if (fwrite(&fileHeader, sizeof(fileHeader), 1, pFile) != 1) {
+		rc = -1;
+		goto end;
+	}
+
+	for (pRing = pList; pRing != NULL; pRing = pRing->pNext) {
+		/* oldest to newest, the records overwritten during the dump are written as zeros,
+		   including those already replaced by a later lap of the ring */
+		ringHeader.head = __atomic_load_n(&pRing->head, __ATOMIC_ACQUIRE);
+		ringHeader.threadId = pRing->threadId;
+		ringHeader.numOfEntries = (uint32_t)CC_MIN(ringHeader.head, (uint64_t)CC_PAL_TRACE_RING_ENTRIES);
+		if (fwrite(&ringHeader, sizeof(ringHeader), 1, pFile) != 1) {
+			rc = -1;
+			goto end;
+		}
+		first = ringHeader.head - ringHeader.numOfEntries;
+		for (idx = first; idx < ringHeader.head; idx++) {
+			(void)PalTraceRecordCopy(&pRing->records[idx & PAL_TRACE_RING_MASK], &record, idx);
+			if (fwrite(&record, sizeof(record), 1, pFile) != 1) {
+				rc = -1;
+				goto end;
+			}
+		}
+	}
+
+end:
+	if (fclose(pFile) != 0) {
+		rc = -1;
+	}
+	return rc;
+}
+
+/**
+ * @brief   Releases the rings of all threads
+ *
+ * @return None
+ */
+void CC_PalTraceFin(void)
+{
+	PalTraceRing_t *pRing;
+	PalTraceRing_t *pNext;
+
+	/* invalidates the rings cached by the threads */
+	__atomic_add_fetch(&palTraceGeneration, 1, __ATOMIC_RELEASE);
+	pRing = __atomic_exchange_n(&pPalTraceRingList, NULL, __ATOMIC_ACQ_REL);
+	for (; pRing != NULL; pRing = pNext) {
+		pNext = pRing->pNext;
+		free(pRing);
+	}
+}
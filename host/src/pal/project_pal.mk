@@ -34,5 +34,10 @@ SOURCES_pal_$(PLAT_OS) += cc_pal_perf_plat.c
 CFLAGS += -DLIB_PERF
 endif
 
+ifeq ($(LIB_TRACE),1)
+SOURCES_pal_$(PLAT_OS) += cc_pal_trace.c
+CFLAGS += -DCC_PAL_TRACE
+endif
+
 VPATH += $(HOST_SRCDIR)/pal $(HOST_SRCDIR)/pal/$(PLAT_OS)
 
@@ -23,6 +23,7 @@ SUPPORTED_CONFIGURATIONS="SUPPORTED CONFIGURATIONS
 |   10  |  linux   |  a72 a53   |    aarch64-br-7.3   | target | Juno  |
 |   11  | freertos | cortex-m33 |    arm-compiler-6   | target | MPS2+ |
 |   12  | freertos | cortex-m3  |    arm-compiler-6   | target | MPS2+ |
+|   13  |  linux   |    x86     |        native       |  host  | SwModel |
 |----------------------------------------------------------------------|
 
 There is an option to run this script with ConfNum as an argument.
@@ -89,6 +90,10 @@ make setconfig_testal_freertos_cm33
 #set_toolchain arm-compiler-6
 make setconfig_testal_freertos_cm3
 ;;
+13)
+#set_toolchain native
+make setconfig_testal_linux_x86_swmodel
+;;
 *)
 echo "Configuration number $1 is undefined"
 exit 1;
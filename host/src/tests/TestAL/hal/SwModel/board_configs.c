@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm’s non-OSI source license
+ *
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "board_configs.h"
+
+#include "test_pal_mem.h"
+#include "test_pal_map_addrs.h"
+#include "test_pal_log.h"
+
+/* The software model accesses the DMA buffers by their virtual address,
+ * so plain anonymous memory is used instead of the driver mappings. */
+#define TEST_HAL_MEM_DMA_AREA_LEN		0x004000000	/* 64MB */
+#define TEST_HAL_MEM_UNMANAGED_AREA_LEN		0x000100000	/* 1MB */
+
+/******************************************************************************/
+static unsigned long Test_HalAnonMap(size_t len)
+{
+	void *pAddr = mmap(NULL, len, PROT_READ | PROT_WRITE,
+			   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	return (pAddr == MAP_FAILED) ? 0 : (unsigned long)pAddr;
+}
+
+/******************************************************************************/
+uint32_t Test_HalBoardInit(void)
+{
+	unsigned long DMABaseAddr;
+	unsigned long unmanagedBaseAddr;
+
+	DMABaseAddr = Test_HalAnonMap(TEST_HAL_MEM_DMA_AREA_LEN);
+	if (DMABaseAddr == 0) {
+		TEST_PRINTF_ERROR("Error: mmap failed for DMABaseAddr\n");
+		goto end_with_error;
+	}
+
+	TEST_PRINTF("DMABaseAddr = 0x%lx\n", DMABaseAddr);
+
+	unmanagedBaseAddr = Test_HalAnonMap(TEST_HAL_MEM_UNMANAGED_AREA_LEN);
+	if (unmanagedBaseAddr == 0) {
+		TEST_PRINTF_ERROR("Error: mmap failed for unmanagedBaseAddr\n");
+		goto end_with_error;
+	}
+	TEST_PRINTF("unmanagedBaseAddr = 0x%lx\n", unmanagedBaseAddr);
+
+	if (Test_PalMemInit(DMABaseAddr, unmanagedBaseAddr,
+				TEST_HAL_MEM_DMA_AREA_LEN)) {
+		TEST_PRINTF_ERROR("Error: MemInit failed\n");
+		goto end_with_error;
+	}
+
+	return 0;
+
+	end_with_error:
+	Test_HalBoardFree();
+	return 1;
+}
+
+/******************************************************************************/
+void Test_HalBoardFree(void)
+{
+	if (Test_PalGetDMABaseAddr() != 0) {
+		munmap((void *)Test_PalGetDMABaseAddr(),
+				TEST_HAL_MEM_DMA_AREA_LEN);
+	}
+
+	if (Test_PalGetUnmanagedBaseAddr() != 0) {
+		munmap((void *)Test_PalGetUnmanagedBaseAddr(),
+				TEST_HAL_MEM_UNMANAGED_AREA_LEN);
+	}
+}
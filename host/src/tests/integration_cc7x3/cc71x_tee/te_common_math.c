@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "test_engine.h"
+#include "cc_rsa_build.h"
+#include "cc_rsa_prim.h"
+#include "cc_rsa_error.h"
+#include "te_common_math.h"
+
+
+/* The bignum helpers of cc_common_math are internal to the library, so they are
+   exercised through the public RSA key and primitive APIs, which convert, size
+   and compare the operands with them. */
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+#define TE_COMMON_MATH_MAX_SIZE_IN_BYTES    (CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS / 8)
+#define TE_COMMON_MATH_BENCH_LOOPS          1000
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+static const uint32_t benchSizesInBits[] = { 2048, 3072, 4096 };
+static const char *benchSizesStr[] = { "2048", "3072", "4096" };
+
+static uint8_t expThree[] = { 0x03 };
+
+static uint8_t modulus[TE_COMMON_MATH_MAX_SIZE_IN_BYTES];
+static uint8_t dataIn[TE_COMMON_MATH_MAX_SIZE_IN_BYTES];
+static uint8_t dataOut[TE_COMMON_MATH_MAX_SIZE_IN_BYTES];
+static uint8_t expected[TE_COMMON_MATH_MAX_SIZE_IN_BYTES];
+static uint8_t expOut[sizeof(uint32_t)];
+
+static CCRsaUserPubKey_t pubKey;
+static CCRsaPrimeData_t primeData;
+
+static uint32_t fillSeed = 0x2545F491;
+
+/******************************************************************
+ * Static Prototypes
+ ******************************************************************/
+
+static TE_rc_t common_math_correctness(void* pContext);
+static TE_rc_t common_math_bench(void* pContext);
+
+/******************************************************************
+ * Static functions
+ ******************************************************************/
+
+/* xorshift fill, the moduli do not need to be prime, only odd and of full size */
+static void common_math_fill_modulus(uint8_t *pMod, size_t sizeInBytes)
+{
+    size_t i;
+
+    for (i = 0; i < sizeInBytes; i++) {
+        fillSeed ^= fillSeed << 13;
+        fillSeed ^= fillSeed >> 17;
+        fillSeed ^= fillSeed << 5;
+        pMod[i] = (uint8_t)fillSeed;
+    }
+    pMod[0] |= 0x80;
+    pMod[sizeInBytes - 1] |= 0x01;
+}
+
+static TE_rc_t common_math_correctness(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    uint8_t *pMod;
+    size_t sizeInBytes, modSize, expSize;
+    uint32_t sizeInBits, bit;
+    TE_UNUSED(pContext);
+
+    for (sizeInBits = CC_RSA_MIN_VALID_KEY_SIZE_VALUE_IN_BITS;
+         sizeInBits <= CC_RSA_MAX_VALID_KEY_SIZE_VALUE_IN_BITS;
+         sizeInBits += CC_RSA_VALID_KEY_SIZE_MULTIPLE_VALUE_IN_BITS) {
+        sizeInBytes = sizeInBits / 8;
+        pMod = modulus + sizeof(modulus) - sizeInBytes;
+        memset(modulus, 0, sizeof(modulus));
+        common_math_fill_modulus(pMod, sizeInBytes);
+
+        /* the modulus is passed in a buffer of the maximal size, the leading zero
+           bytes do not change the effective size, and the key reads back as the
+           same big endian modulus */
+        TE_ASSERT(CC_RsaPubKeyBuild(&pubKey, expThree, sizeof(expThree),
+                                    modulus, sizeof(modulus)) == CC_OK);
+        modSize = sizeof(dataOut);
+        expSize = sizeof(expOut);
+        TE_ASSERT(CC_RsaPubKeyGet(&pubKey, expOut, &expSize, dataOut, &modSize) == CC_OK);
+        TE_ASSERT(modSize == sizeInBytes);
+        TE_ASSERT(memcmp(dataOut, pMod, sizeInBytes) == 0);
+        TE_ASSERT((expSize == 1) && (expOut[0] == 0x03));
+
+        /* the exponent must be below the modulus */
+        TE_ASSERT(CC_RsaPubKeyBuild(&pubKey, pMod, sizeInBytes,
+                                    modulus, sizeof(modulus)) ==
+                  CC_RSA_INVALID_EXPONENT_VAL);
+
+        /* a top byte of one bit less gives a size that is not a valid multiple */
+        pMod[0] = 0x7F;
+        TE_ASSERT(CC_RsaPubKeyBuild(&pubKey, expThree, sizeof(expThree), pMod, sizeInBytes) ==
+                  CC_RSA_INVALID_MODULUS_SIZE);
+        pMod[0] = 0xFF;
+
+        TE_ASSERT(CC_RsaPubKeyBuild(&pubKey, expThree, sizeof(expThree), pMod, sizeInBytes) == CC_OK);
+
+        /* a message equal to the modulus is rejected, one below it is accepted */
+        TE_ASSERT(CC_RsaPrimEncrypt(&pubKey, &primeData, pMod, sizeInBytes, dataOut) ==
+                  CC_RSA_INVALID_MESSAGE_VAL);
+        memcpy(dataIn, pMod, sizeInBytes);
+        dataIn[sizeInBytes - 1] &= ~0x01;
+        TE_ASSERT(CC_RsaPrimEncrypt(&pubKey, &primeData, dataIn, sizeInBytes, dataOut) == CC_OK);
+
+        /* (2^bit)^3 is below the modulus, so the result is the plain power and checks
+           the conversions of the message and of the result at every word offset */
+        for (bit = 0; 3 * bit < sizeInBits - 1; bit += 29) {
+            memset(dataIn, 0, sizeInBytes);
+            dataIn[sizeInBytes - 1 - bit / 8] = (uint8_t)(1 << (bit % 8));
+            memset(expected, 0, sizeInBytes);
+            expected[sizeInBytes - 1 - (3 * bit) / 8] = (uint8_t)(1 << ((3 * bit) % 8));
+            TE_ASSERT(CC_RsaPrimEncrypt(&pubKey, &primeData, dataIn, sizeInBytes, dataOut) == CC_OK);
+            TE_ASSERT(memcmp(dataOut, expected, sizeInBytes) == 0);
+        }
+    }
+
+bail:
+    return res;
+}
+
+static TE_rc_t common_math_bench(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    size_t sizeInBytes, modSize, expSize;
+    uint32_t i, j;
+    TE_UNUSED(pContext);
+
+    for (i = 0; i < TE_VEC_COUNT(benchSizesInBits); i++) {
+        sizeInBytes = benchSizesInBits[i] / 8;
+        common_math_fill_modulus(modulus, sizeInBytes);
+
+        /* the build converts, sizes and compares the operands, then computes the
+           Barrett tag once per key */
+        cookie = TE_perfOpenNewEntry("pubkey build", benchSizesStr[i]);
+        TE_ASSERT(CC_RsaPubKeyBuild(&pubKey, expThree, sizeof(expThree), modulus, sizeInBytes) == CC_OK);
+        TE_perfCloseEntry(cookie);
+
+        /* the export is only the conversion back to big endian bytes */
+        cookie = TE_perfOpenNewEntry("pubkey get", benchSizesStr[i]);
+        for (j = 0; j < TE_COMMON_MATH_BENCH_LOOPS; j++) {
+            modSize = sizeof(dataOut);
+            expSize = sizeof(expOut);
+            TE_ASSERT(CC_RsaPubKeyGet(&pubKey, expOut, &expSize, dataOut, &modSize) == CC_OK);
+        }
+        TE_perfCloseEntry(cookie);
+    }
+
+bail:
+    return res;
+}
+
+/******************************************************************
+ * Public
+ ******************************************************************/
+
+int TE_init_common_math_test(void)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    uint32_t i;
+
+    for (i = 0; i < TE_VEC_COUNT(benchSizesStr); i++) {
+        TE_perfEntryInit("pubkey build", benchSizesStr[i]);
+        TE_perfEntryInit("pubkey get", benchSizesStr[i]);
+    }
+
+    TE_ASSERT(TE_registerFlow("common_math-test-1",
+                               "common math",
+                               "rsa public key",
+                               NULL,
+                               common_math_correctness,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("common_math-test-2",
+                               "common math",
+                               "2048 to 4096 bits",
+                               NULL,
+                               common_math_bench,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+bail:
+    return res;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC71X_TEE_INTEGRATION_TE_COMMON_MATH_H
+#define _CC71X_TEE_INTEGRATION_TE_COMMON_MATH_H
+/*!
+  @file
+  @brief This file contains common math definitions for test usage.
+
+  This file defines:
+      <ol><li>Common math mapping used for common math integration tests.</li>
+      <li>Declarations of common math integration test functions.</li></ol>
+ */
+
+/*!
+ @addtogroup common_math_apis
+ @{
+ */
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+/******************************************************************
+ * Functions
+ ******************************************************************/
+
+/*!
+@brief This function allocates and initializes the common math test resources.
+
+
+@return \c zero on success.
+@return A non-zero value on failure.
+*/
+int TE_init_common_math_test(void);
+
+
+/*!
+ @}
+ */
+#endif /* _CC71X_TEE_INTEGRATION_TE_COMMON_MATH_H */
+
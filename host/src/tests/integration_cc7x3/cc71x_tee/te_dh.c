@@ -9,6 +9,8 @@
 #include <stdint.h>
 #include "test_engine.h"
 #include "cc_dh.h"
+#include "cc_dh_error.h"
+#include "cc_dh_groups.h"
 #include "te_dh.h"
 
 /******************************************************************
@@ -19,6 +21,7 @@
 #define TE_DH_PRIME_SIZE_IN_BYTES                      TE_DH_GENERATOR_SIZE_IN_BYTES
 #define TE_MAX_DH_KEY_SIZE                             256
 #define TE_MAX_DH_OTHER_INFO_BUF_SIZE_BYTES            50
+#define TE_MAX_DH_NAMED_GROUP_PRIME_SIZE_IN_BYTES      (CC_DH_MAX_VALID_KEY_SIZE_VALUE_IN_BITS / 8)
 
 /******************************************************************
  * Types
@@ -56,6 +59,11 @@ typedef struct dhDataVector_t {
     dhOtherInfo_t               otherInfo;
 } dhDataVector_t;
 
+typedef struct dhNamedGroupVector_t {
+    CCDhNamedGroupId_t          groupId;
+    size_t                      prvKeySizeInBits;
+} dhNamedGroupVector_t;
+
 /******************************************************************
  * Externs
  ******************************************************************/
@@ -170,6 +178,18 @@ static dhDataVector_t ansi942TestVector = {
                                                          .suppPublInfoSize = 7, }
 };
 
+/* short private key of 2*112 bits: the public key uses the comb table of the group */
+static dhNamedGroupVector_t ffdhe2048TestVector = {
+                                                   .groupId = CC_DH_NAMED_GROUP_FFDHE2048,
+                                                   .prvKeySizeInBits = 224,
+};
+
+/* private key in full range [1, q-1] */
+static dhNamedGroupVector_t modp3072TestVector = {
+                                                  .groupId = CC_DH_NAMED_GROUP_MODP3072,
+                                                  .prvKeySizeInBits = CC_DH_NAMED_GROUP_FULL_PRV_KEY,
+};
+
 /******************************************************************
  * Static Prototypes
  ******************************************************************/
@@ -178,6 +198,8 @@ static TE_rc_t dh_pkcs3_exec(void* pContext);
 
 static TE_rc_t dh_ansi942_exec(void* pContext);
 
+static TE_rc_t dh_named_group_exec(void* pContext);
+
 /******************************************************************
  * Static functions
  ******************************************************************/
@@ -424,6 +446,144 @@ bail:
     return res;
 }
 
+static TE_rc_t dh_named_group_exec(void* pContext)
+{
+    TE_perfIndex_t cookie = 0;
+    TE_rc_t res = TE_RC_SUCCESS;
+    dhNamedGroupVector_t* pGroupTestVec = NULL;
+    const CCDhNamedGroup_t *pGroup = NULL;
+    CCDhUserPubKey_t userPublKey;
+    CCDhPrimeData_t primeData;
+    CCDhTemp_t tempBuff;
+    uint8_t workBuff[TE_MAX_DH_NAMED_GROUP_PRIME_SIZE_IN_BYTES];
+    size_t clientPrivKeySize = TE_MAX_DH_NAMED_GROUP_PRIME_SIZE_IN_BYTES;
+    size_t clientPublKeySize = TE_MAX_DH_NAMED_GROUP_PRIME_SIZE_IN_BYTES;
+    size_t serverPrivKeySize = TE_MAX_DH_NAMED_GROUP_PRIME_SIZE_IN_BYTES;
+    size_t serverPublKeySize = TE_MAX_DH_NAMED_GROUP_PRIME_SIZE_IN_BYTES;
+    size_t clientSecretKeySize = TE_MAX_DH_NAMED_GROUP_PRIME_SIZE_IN_BYTES;
+    size_t serverSecretKeySize = TE_MAX_DH_NAMED_GROUP_PRIME_SIZE_IN_BYTES;
+    uint8_t *pClientPrivKey = NULL, *pClientPublKey = NULL, *pServerPrivKey = NULL,
+                    *pServerPublKey = NULL, *pClientSecretKey = NULL, *pServerSecretKey = NULL;
+    size_t i;
+
+    TE_ASSERT(pContext != NULL);
+
+    pGroupTestVec = (dhNamedGroupVector_t *)pContext;
+    pGroup = CC_DhGetNamedGroup(pGroupTestVec->groupId);
+    TE_ASSERT(pGroup != NULL);
+
+    TE_ALLOC(pClientPrivKey, clientPrivKeySize);
+    TE_ALLOC(pClientPublKey, clientPublKeySize);
+    TE_ALLOC(pServerPrivKey, serverPrivKeySize);
+    TE_ALLOC(pServerPublKey, serverPublKeySize);
+    TE_ALLOC(pClientSecretKey, clientSecretKeySize);
+    TE_ALLOC(pServerSecretKey, serverSecretKeySize);
+
+    /* Generating clients and servers public and private keys */
+    /*--------------------------------------------------------*/
+    cookie = TE_perfOpenNewEntry("dh", "named-group-generate-keys");
+    TE_ASSERT(CC_DhNamedGroupGeneratePubPrv(pRndFunc_proj,
+                                            pRndState_proj,
+                                            pGroup,
+                                            pGroupTestVec->prvKeySizeInBits,
+                                            &tempBuff,
+                                            pClientPrivKey,
+                                            &clientPrivKeySize,
+                                            pClientPublKey,
+                                            &clientPublKeySize) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    cookie = TE_perfOpenNewEntry("dh", "named-group-generate-keys");
+    TE_ASSERT(CC_DhNamedGroupGeneratePubPrv(pRndFunc_proj,
+                                            pRndState_proj,
+                                            pGroup,
+                                            pGroupTestVec->prvKeySizeInBits,
+                                            &tempBuff,
+                                            pServerPrivKey,
+                                            &serverPrivKeySize,
+                                            pServerPublKey,
+                                            &serverPublKeySize) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    TE_ASSERT(clientPublKeySize == pGroup->primeSizeInBytes);
+    if (pGroupTestVec->prvKeySizeInBits != CC_DH_NAMED_GROUP_FULL_PRV_KEY) {
+        TE_ASSERT(clientPrivKeySize == (pGroupTestVec->prvKeySizeInBits + 7) / 8);
+    }
+
+    /* Checking the public keys */
+    /*--------------------------*/
+    cookie = TE_perfOpenNewEntry("dh", "named-group-publ-key-check");
+    TE_ASSERT(CC_DhNamedGroupCheckPubKey(pGroup,
+                                         pClientPublKey,
+                                         clientPublKeySize,
+                                         &tempBuff) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    /* the order q = (p-1)/2 is accepted by the generic check as well */
+    for (i = pGroup->primeSizeInBytes - 1; i > 0; i--) {
+        workBuff[i] = (uint8_t)((pGroup->pPrime[i] >> 1) | (pGroup->pPrime[i-1] << 7));
+    }
+    workBuff[0] = pGroup->pPrime[0] >> 1;
+    TE_ASSERT(CC_DhCheckPubKey((uint8_t *)pGroup->pPrime,
+                               pGroup->primeSizeInBytes,
+                               workBuff, pGroup->primeSizeInBytes,
+                               pServerPublKey,
+                               serverPublKeySize,
+                               &tempBuff) == CC_OK);
+
+    /* p-1 is not a valid public key */
+    for (i = 0; i < pGroup->primeSizeInBytes; i++) {
+        workBuff[i] = pGroup->pPrime[i];
+    }
+    workBuff[pGroup->primeSizeInBytes - 1] -= 1;
+    TE_ASSERT(CC_DhNamedGroupCheckPubKey(pGroup,
+                                         workBuff,
+                                         pGroup->primeSizeInBytes,
+                                         &tempBuff) == CC_DH_INVALID_PUBLIC_KEY_ERROR);
+
+    /* Generating clients and servers secret keys */
+    /*--------------------------------------------*/
+    cookie = TE_perfOpenNewEntry("dh", "secret-key");
+    TE_ASSERT(CC_DhGetSecretKey(pClientPrivKey,
+                                clientPrivKeySize,
+                                pServerPublKey,
+                                serverPublKeySize,
+                                (uint8_t *)pGroup->pPrime,
+                                pGroup->primeSizeInBytes,
+                                &userPublKey,
+                                &primeData,
+                                pClientSecretKey,
+                                &clientSecretKeySize) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    cookie = TE_perfOpenNewEntry("dh", "secret-key");
+    TE_ASSERT(CC_DhGetSecretKey(pServerPrivKey,
+                                serverPrivKeySize,
+                                pClientPublKey,
+                                clientPublKeySize,
+                                (uint8_t *)pGroup->pPrime,
+                                pGroup->primeSizeInBytes,
+                                &userPublKey,
+                                &primeData,
+                                pServerSecretKey,
+                                &serverSecretKeySize) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    /* Comparing clients and servers secret keys */
+    /*-------------------------------------------*/
+    TE_ASSERT(clientSecretKeySize == serverSecretKeySize);
+    TE_ASSERT(memcmp(pServerSecretKey, pClientSecretKey, serverSecretKeySize) == 0);
+
+bail:
+    TE_FREE(pClientPrivKey);
+    TE_FREE(pClientPublKey);
+    TE_FREE(pServerPrivKey);
+    TE_FREE(pServerPublKey);
+    TE_FREE(pClientSecretKey);
+    TE_FREE(pServerSecretKey);
+    return res;
+}
+
 /******************************************************************
  * Public
  ******************************************************************/
@@ -436,6 +596,8 @@ int TE_init_dh_test(void)
     TE_perfEntryInit("dh", "publ-key-check");
     TE_perfEntryInit("dh", "secret-key");
     TE_perfEntryInit("dh", "get-secret-key");
+    TE_perfEntryInit("dh", "named-group-generate-keys");
+    TE_perfEntryInit("dh", "named-group-publ-key-check");
 
     TE_ASSERT(TE_registerFlow("dh",
                               "pkcs3",
@@ -455,6 +617,24 @@ int TE_init_dh_test(void)
                               NULL,
                               &ansi942TestVector) == TE_RC_SUCCESS);
 
+    TE_ASSERT(TE_registerFlow("dh",
+                              "named-group",
+                              "ffdhe2048-short-prv-key",
+                              NULL,
+                              dh_named_group_exec,
+                              NULL,
+                              NULL,
+                              &ffdhe2048TestVector) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("dh",
+                              "named-group",
+                              "modp3072-full-prv-key",
+                              NULL,
+                              dh_named_group_exec,
+                              NULL,
+                              NULL,
+                              &modp3072TestVector) == TE_RC_SUCCESS);
+
 bail:
     return res;
 }
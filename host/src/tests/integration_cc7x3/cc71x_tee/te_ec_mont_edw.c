@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "test_engine.h"
+#include "cc_ec_mont_api.h"
+#include "cc_ec_edw_api.h"
+#include "cc_ec_mont_edw_error.h"
+#include "cc_ecpki_kg.h"
+#include "cc_ecpki_domain.h"
+#include "cc_ecpki_dh.h"
+#include "cc_ecpki_ecdsa.h"
+#include "cc_rnd.h"
+#include "te_ec_mont_edw.h"
+
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+#define TE_EC_MONT_EDW_BENCH_DOMAIN         CC_ECPKI_DomainID_secp256r1
+#define TE_EC_MONT_EDW_BENCH_HASH           CC_ECPKI_HASH_SHA256_mode
+#define TE_EC_MONT_EDW_BENCH_MSG_SIZE       64
+/* longer than the SHA-512 block, so the message does not fit the block hashed with the heads */
+#define TE_EC_MONT_EDW_LONG_MSG_SIZE        200
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+extern CCRndState_t *pRndState_proj;
+extern CCRndGenerateVectWorkFunc_t pRndFunc_proj;
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+/* RFC 7748 6.1 */
+static const uint8_t x25519AlicePriv[CC_EC_MONT_SCALAR_SIZE_IN_BYTES] = {
+    0x77, 0x07, 0x6d, 0x0a, 0x73, 0x18, 0xa5, 0x7d, 0x3c, 0x16, 0xc1, 0x72, 0x51, 0xb2, 0x66, 0x45,
+    0xdf, 0x4c, 0x2f, 0x87, 0xeb, 0xc0, 0x99, 0x2a, 0xb1, 0x77, 0xfb, 0xa5, 0x1d, 0xb9, 0x2c, 0x2a };
+static const uint8_t x25519AlicePub[CC_EC_MONT_MOD_SIZE_IN_BYTES] = {
+    0x85, 0x20, 0xf0, 0x09, 0x89, 0x30, 0xa7, 0x54, 0x74, 0x8b, 0x7d, 0xdc, 0xb4, 0x3e, 0xf7, 0x5a,
+    0x0d, 0xbf, 0x3a, 0x0d, 0x26, 0x38, 0x1a, 0xf4, 0xeb, 0xa4, 0xa9, 0x8e, 0xaa, 0x9b, 0x4e, 0x6a };
+static const uint8_t x25519BobPriv[CC_EC_MONT_SCALAR_SIZE_IN_BYTES] = {
+    0x5d, 0xab, 0x08, 0x7e, 0x62, 0x4a, 0x8a, 0x4b, 0x79, 0xe1, 0x7f, 0x8b, 0x83, 0x80, 0x0e, 0xe6,
+    0x6f, 0x3b, 0xb1, 0x29, 0x26, 0x18, 0xb6, 0xfd, 0x1c, 0x2f, 0x8b, 0x27, 0xff, 0x88, 0xe0, 0xeb };
+static const uint8_t x25519BobPub[CC_EC_MONT_MOD_SIZE_IN_BYTES] = {
+    0xde, 0x9e, 0xdb, 0x7d, 0x7b, 0x7d, 0xc1, 0xb4, 0xd3, 0x5b, 0x61, 0xc2, 0xec, 0xe4, 0x35, 0x37,
+    0x3f, 0x83, 0x43, 0xc8, 0x5b, 0x78, 0x67, 0x4d, 0xad, 0xfc, 0x7e, 0x14, 0x6f, 0x88, 0x2b, 0x4f };
+static const uint8_t x25519Shared[CC_EC_MONT_MOD_SIZE_IN_BYTES] = {
+    0x4a, 0x5d, 0x9d, 0x5b, 0xa4, 0xce, 0x2d, 0xe1, 0x72, 0x8e, 0x3b, 0xf4, 0x80, 0x35, 0x0f, 0x25,
+    0xe0, 0x7e, 0x21, 0xc9, 0x47, 0xd1, 0x9e, 0x33, 0x76, 0xf0, 0x9b, 0x3c, 0x1e, 0x16, 0x17, 0x42 };
+
+/* RFC 8032 7.1, TEST 2 */
+static const uint8_t ed25519Seed[CC_EC_EDW_SEED_BYTES] = {
+    0x4c, 0xcd, 0x08, 0x9b, 0x28, 0xff, 0x96, 0xda, 0x9d, 0xb6, 0xc3, 0x46, 0xec, 0x11, 0x4e, 0x0f,
+    0x5b, 0x8a, 0x31, 0x9f, 0x35, 0xab, 0xa6, 0x24, 0xda, 0x8c, 0xf6, 0xed, 0x4f, 0xb8, 0xa6, 0xfb };
+static const uint8_t ed25519Pub[CC_EC_EDW_PUBL_KEY_BYTES] = {
+    0x3d, 0x40, 0x17, 0xc3, 0xe8, 0x43, 0x89, 0x5a, 0x92, 0xb7, 0x0a, 0xa7, 0x4d, 0x1b, 0x7e, 0xbc,
+    0x9c, 0x98, 0x2c, 0xcf, 0x2e, 0xc4, 0x96, 0x8c, 0xc0, 0xcd, 0x55, 0xf1, 0x2a, 0xf4, 0x66, 0x0c };
+static const uint8_t ed25519Msg[] = { 0x72 };
+static const uint8_t ed25519Sign[CC_EC_EDW_SIGNATURE_BYTES] = {
+    0x92, 0xa0, 0x09, 0xa9, 0xf0, 0xd4, 0xca, 0xb8, 0x72, 0x0e, 0x82, 0x0b, 0x5f, 0x64, 0x25, 0x40,
+    0xa2, 0xb2, 0x7b, 0x54, 0x16, 0x50, 0x3f, 0x8f, 0xb3, 0x76, 0x22, 0x23, 0xeb, 0xdb, 0x69, 0xda,
+    0x08, 0x5a, 0xc1, 0xe4, 0x3e, 0x15, 0x99, 0x6e, 0x45, 0x8f, 0x36, 0x13, 0xd0, 0xf1, 0x1d, 0x8c,
+    0x38, 0x7b, 0x2e, 0xae, 0xb4, 0x30, 0x2a, 0xee, 0xb0, 0x0d, 0x29, 0x16, 0x12, 0xbb, 0x0c, 0x00 };
+
+static CCEcEdwTempBuff_t            edwTempBuff;
+static CCEcpkiUserPrivKey_t         ecPrivKey1;
+static CCEcpkiUserPublKey_t         ecPublKey1;
+static CCEcpkiUserPrivKey_t         ecPrivKey2;
+static CCEcpkiUserPublKey_t         ecPublKey2;
+static CCEcpkiKgTempData_t          ecKgTempData;
+static CCEcdhTempData_t             ecdhTempData;
+static CCEcdsaSignUserContext_t     signUserContext;
+static CCEcdsaVerifyUserContext_t   verifyUserContext;
+
+/******************************************************************
+ * Static Prototypes
+ ******************************************************************/
+
+static TE_rc_t ec_mont_edw_x25519(void* pContext);
+static TE_rc_t ec_mont_edw_ed25519(void* pContext);
+static TE_rc_t ec_mont_edw_p256_bench(void* pContext);
+
+/******************************************************************
+ * Static functions
+ ******************************************************************/
+
+static TE_rc_t ec_mont_edw_x25519(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    uint8_t publKey[CC_EC_MONT_MOD_SIZE_IN_BYTES];
+    uint8_t secrKey[CC_EC_MONT_SCALAR_SIZE_IN_BYTES];
+    uint8_t shared1[CC_EC_MONT_MOD_SIZE_IN_BYTES];
+    uint8_t shared2[CC_EC_MONT_MOD_SIZE_IN_BYTES];
+    size_t publKeySize = sizeof(publKey);
+    size_t secrKeySize = sizeof(secrKey);
+    size_t sharedSize = sizeof(shared1);
+    TE_UNUSED(pContext);
+
+    /* RFC 7748 public keys and shared secret */
+    cookie = TE_perfOpenNewEntry("x25519", "base");
+    TE_ASSERT(CC_EcMontScalarmultBase(publKey, &publKeySize,
+                                      x25519AlicePriv, sizeof(x25519AlicePriv)) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(memcmp(publKey, x25519AlicePub, sizeof(publKey)) == 0);
+
+    publKeySize = sizeof(publKey);
+    TE_ASSERT(CC_EcMontScalarmultBase(publKey, &publKeySize,
+                                      x25519BobPriv, sizeof(x25519BobPriv)) == CC_OK);
+    TE_ASSERT(memcmp(publKey, x25519BobPub, sizeof(publKey)) == 0);
+
+    cookie = TE_perfOpenNewEntry("x25519", "shared");
+    TE_ASSERT(CC_EcMontScalarmult(shared1, &sharedSize,
+                                  x25519AlicePriv, sizeof(x25519AlicePriv),
+                                  x25519BobPub, sizeof(x25519BobPub)) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(memcmp(shared1, x25519Shared, sizeof(shared1)) == 0);
+
+    /* random key pair agrees with the peer */
+    publKeySize = sizeof(publKey);
+    TE_ASSERT(CC_EcMontKeyPair(publKey, &publKeySize, secrKey, &secrKeySize,
+                               pRndFunc_proj, pRndState_proj) == CC_OK);
+    sharedSize = sizeof(shared1);
+    TE_ASSERT(CC_EcMontScalarmult(shared1, &sharedSize, secrKey, secrKeySize,
+                                  x25519BobPub, sizeof(x25519BobPub)) == CC_OK);
+    sharedSize = sizeof(shared2);
+    TE_ASSERT(CC_EcMontScalarmult(shared2, &sharedSize, x25519BobPriv, sizeof(x25519BobPriv),
+                                  publKey, publKeySize) == CC_OK);
+    TE_ASSERT(memcmp(shared1, shared2, sizeof(shared1)) == 0);
+
+    /* the point of small order u = 0 gives the zero secret */
+    memset(publKey, 0, sizeof(publKey));
+    sharedSize = sizeof(shared1);
+    TE_ASSERT(CC_EcMontScalarmult(shared1, &sharedSize, secrKey, secrKeySize,
+                                  publKey, sizeof(publKey)) == CC_EC_MONT_SHARED_SECRET_IS_ZERO_ERROR);
+
+bail:
+    return res;
+}
+
+static TE_rc_t ec_mont_edw_ed25519(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    uint8_t secrKey[CC_EC_EDW_SECR_KEY_BYTES];
+    uint8_t publKey[CC_EC_EDW_PUBL_KEY_BYTES];
+    uint8_t sign[CC_EC_EDW_SIGNATURE_BYTES];
+    uint8_t msg[TE_EC_MONT_EDW_LONG_MSG_SIZE];
+    size_t secrKeySize = sizeof(secrKey);
+    size_t publKeySize = sizeof(publKey);
+    size_t signSize = sizeof(sign);
+    TE_UNUSED(pContext);
+
+    /* RFC 8032 key pair and signature */
+    cookie = TE_perfOpenNewEntry("ed25519", "keygen");
+    TE_ASSERT(CC_EcEdwSeedKeyPair(ed25519Seed, sizeof(ed25519Seed),
+                                  secrKey, &secrKeySize,
+                                  publKey, &publKeySize,
+                                  &edwTempBuff) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(memcmp(publKey, ed25519Pub, sizeof(publKey)) == 0);
+
+    cookie = TE_perfOpenNewEntry("ed25519", "sign");
+    TE_ASSERT(CC_EcEdwSign(sign, &signSize,
+                           ed25519Msg, sizeof(ed25519Msg),
+                           secrKey, secrKeySize,
+                           &edwTempBuff) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(memcmp(sign, ed25519Sign, sizeof(sign)) == 0);
+
+    cookie = TE_perfOpenNewEntry("ed25519", "verify");
+    TE_ASSERT(CC_EcEdwVerify(sign, signSize,
+                             publKey, publKeySize,
+                             ed25519Msg, sizeof(ed25519Msg),
+                             &edwTempBuff) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    /* the modified message and signature are rejected */
+    msg[0] = ed25519Msg[0] ^ 1;
+    TE_ASSERT(CC_EcEdwVerify(sign, signSize, publKey, publKeySize,
+                             msg, sizeof(ed25519Msg),
+                             &edwTempBuff) == CC_EC_EDW_SIGN_VERIFY_FAILED_ERROR);
+    sign[0] ^= 1;
+    TE_ASSERT(CC_EcEdwVerify(sign, signSize, publKey, publKeySize,
+                             ed25519Msg, sizeof(ed25519Msg),
+                             &edwTempBuff) == CC_EC_EDW_SIGN_VERIFY_FAILED_ERROR);
+
+    /* random key pair, a message longer than the SHA-512 block */
+    secrKeySize = sizeof(secrKey);
+    publKeySize = sizeof(publKey);
+    TE_ASSERT(CC_EcEdwKeyPair(secrKey, &secrKeySize, publKey, &publKeySize,
+                              pRndFunc_proj, pRndState_proj, &edwTempBuff) == CC_OK);
+    memset(msg, 0x5A, sizeof(msg));
+    signSize = sizeof(sign);
+    TE_ASSERT(CC_EcEdwSign(sign, &signSize, msg, sizeof(msg),
+                           secrKey, secrKeySize, &edwTempBuff) == CC_OK);
+    TE_ASSERT(CC_EcEdwVerify(sign, signSize, publKey, publKeySize,
+                             msg, sizeof(msg), &edwTempBuff) == CC_OK);
+
+    /* a modified byte past the first hashed block is rejected */
+    msg[sizeof(msg) - 1] ^= 1;
+    TE_ASSERT(CC_EcEdwVerify(sign, signSize, publKey, publKeySize,
+                             msg, sizeof(msg),
+                             &edwTempBuff) == CC_EC_EDW_SIGN_VERIFY_FAILED_ERROR);
+
+bail:
+    return res;
+}
+
+/* the secp256r1 operations of the same use, as the baseline of the X25519 and Ed25519 figures */
+static TE_rc_t ec_mont_edw_p256_bench(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetEcDomain(TE_EC_MONT_EDW_BENCH_DOMAIN);
+    uint8_t shared[CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS * sizeof(uint32_t)];
+    uint8_t sign[2 * CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS * sizeof(uint32_t)];
+    uint8_t msg[TE_EC_MONT_EDW_BENCH_MSG_SIZE];
+    size_t sharedSize = sizeof(shared);
+    size_t signSize = sizeof(sign);
+    TE_UNUSED(pContext);
+
+    TE_ASSERT(CC_EcpkiKeyPairGenerate(pRndFunc_proj, pRndState_proj, pDomain,
+                                      &ecPrivKey1, &ecPublKey1,
+                                      &ecKgTempData, NULL) == CC_OK);
+    TE_ASSERT(CC_EcpkiKeyPairGenerate(pRndFunc_proj, pRndState_proj, pDomain,
+                                      &ecPrivKey2, &ecPublKey2,
+                                      &ecKgTempData, NULL) == CC_OK);
+
+    cookie = TE_perfOpenNewEntry("secp256r1", "shared");
+    TE_ASSERT(CC_EcdhSvdpDh(&ecPublKey2, &ecPrivKey1,
+                            shared, &sharedSize,
+                            &ecdhTempData) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    memset(msg, 0x5A, sizeof(msg));
+    cookie = TE_perfOpenNewEntry("secp256r1", "sign");
+    TE_ASSERT(CC_EcdsaSign(pRndFunc_proj, pRndState_proj,
+                           &signUserContext, &ecPrivKey1,
+                           TE_EC_MONT_EDW_BENCH_HASH,
+                           msg, sizeof(msg),
+                           sign, &signSize) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    cookie = TE_perfOpenNewEntry("secp256r1", "verify");
+    TE_ASSERT(CC_EcdsaVerify(&verifyUserContext, &ecPublKey1,
+                             TE_EC_MONT_EDW_BENCH_HASH,
+                             sign, signSize,
+                             msg, sizeof(msg)) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+bail:
+    return res;
+}
+
+/******************************************************************
+ * Public
+ ******************************************************************/
+
+int TE_init_ec_mont_edw_test(void)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+
+    TE_perfEntryInit("x25519", "base");
+    TE_perfEntryInit("x25519", "shared");
+    TE_perfEntryInit("ed25519", "keygen");
+    TE_perfEntryInit("ed25519", "sign");
+    TE_perfEntryInit("ed25519", "verify");
+    TE_perfEntryInit("secp256r1", "shared");
+    TE_perfEntryInit("secp256r1", "sign");
+    TE_perfEntryInit("secp256r1", "verify");
+
+    TE_ASSERT(TE_registerFlow("ec_mont_edw-test-1",
+                               "x25519",
+                               "RFC 7748",
+                               NULL,
+                               ec_mont_edw_x25519,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("ec_mont_edw-test-2",
+                               "ed25519",
+                               "RFC 8032",
+                               NULL,
+                               ec_mont_edw_ed25519,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("ec_mont_edw-test-3",
+                               "secp256r1",
+                               "ECDH and ECDSA baseline",
+                               NULL,
+                               ec_mont_edw_p256_bench,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+bail:
+    return res;
+}
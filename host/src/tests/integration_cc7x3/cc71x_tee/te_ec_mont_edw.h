@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC71X_TEE_INTEGRATION_TE_EC_MONT_EDW_H
+#define _CC71X_TEE_INTEGRATION_TE_EC_MONT_EDW_H
+/*!
+  @file
+  @brief This file contains X25519 and Ed25519 definitions for test usage.
+
+  This file defines:
+      <ol><li>X25519 and Ed25519 mapping used for X25519 and Ed25519 integration tests.</li>
+      <li>Declarations of X25519 and Ed25519 integration test functions.</li></ol>
+ */
+
+/*!
+ @addtogroup ec_mont_edw_apis
+ @{
+ */
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+/******************************************************************
+ * Functions
+ ******************************************************************/
+
+/*!
+@brief This function allocates and initializes the X25519 and Ed25519 test resources.
+
+
+@return \c zero on success.
+@return A non-zero value on failure.
+*/
+int TE_init_ec_mont_edw_test(void);
+
+
+/*!
+ @}
+ */
+#endif /* _CC71X_TEE_INTEGRATION_TE_EC_MONT_EDW_H */
+
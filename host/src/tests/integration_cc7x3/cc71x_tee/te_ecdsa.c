@@ -10,6 +10,7 @@
 
 #include "test_engine.h"
 #include "cc_ecpki_ecdsa.h"
+#include "cc_ecpki_error.h"
 #include "cc_ecpki_kg.h"
 #include "cc_ecpki_domain.h"
 #include "cc_rnd.h"
@@ -23,11 +24,19 @@
 #define TE_ECDSA_DOMAIN           CC_ECPKI_DomainID_secp256r1
 #define TE_ECDSA_HASH             CC_ECPKI_HASH_SHA256_mode
 #define RANDON_MSG_SIZE_IN_BYTES     64
+#define TE_ECDSA_BATCH_SIZE          4
 
 /******************************************************************
  * Types
  ******************************************************************/
 
+typedef struct {
+    CCEcpkiDomainID_t domainId;
+    const char *pKeyGenEntry;
+    const char *pSignEntry;
+    const char *pVerifyEntry;
+} ecdsaDomainVector_t;
+
 /******************************************************************
  * Externs
  ******************************************************************/
@@ -39,11 +48,19 @@ extern CCRndGenerateVectWorkFunc_t pRndFunc_proj;
  * Globals
  ******************************************************************/
 
+/* P-384 and P-521 use the full PKA register size as operation size */
+static ecdsaDomainVector_t ecdsaDomainVectors[] = {
+    { CC_ECPKI_DomainID_secp256r1, "key-pair-generate", "sign", "verify" },
+    { CC_ECPKI_DomainID_secp384r1, "key-pair-generate-p384", "sign-p384", "verify-p384" },
+    { CC_ECPKI_DomainID_secp521r1, "key-pair-generate-p521", "sign-p521", "verify-p521" },
+};
+
 /******************************************************************
  * Static Prototypes
  ******************************************************************/
 
 static TE_rc_t ecdsa_sign_verify(void* pContext);
+static TE_rc_t ecdsa_verify_batch(void* pContext);
 
 static CCEcpkiUserPrivKey_t            userPrivKey;
 static CCEcpkiUserPublKey_t            userPublKey;
@@ -63,14 +80,17 @@ static TE_rc_t ecdsa_sign_verify(void* pContext)
     size_t signedDataLen = sizeof(signedData);
     uint8_t msgIn[RANDON_MSG_SIZE_IN_BYTES];
     size_t msgInSize = sizeof(msgIn);
-    TE_UNUSED(pContext);
+    ecdsaDomainVector_t *pVector = NULL;
+
+    TE_ASSERT(pContext != NULL);
+    pVector = (ecdsaDomainVector_t *)pContext;
 
     /* Building the ECC Keys for user */
     /*--------------------------------*/
-    cookie = TE_perfOpenNewEntry("ecdsa", "key-pair-generate");
+    cookie = TE_perfOpenNewEntry("ecdsa", pVector->pKeyGenEntry);
     TE_ASSERT(CC_EcpkiKeyPairGenerate(pRndFunc_proj,
                                       pRndState_proj,
-                                      CC_EcpkiGetEcDomain(TE_ECDSA_DOMAIN),
+                                      CC_EcpkiGetEcDomain(pVector->domainId),
                                       &userPrivKey,
                                       &userPublKey,
                                       &tempBuff,
@@ -85,7 +105,7 @@ static TE_rc_t ecdsa_sign_verify(void* pContext)
 
     /* Performing the Sign operation */
     /*-------------------------------*/
-    cookie = TE_perfOpenNewEntry("ecdsa", "sign");
+    cookie = TE_perfOpenNewEntry("ecdsa", pVector->pSignEntry);
     TE_ASSERT(CC_EcdsaSign(pRndFunc_proj,
                            pRndState_proj,
                            &signUserContext,
@@ -99,7 +119,7 @@ static TE_rc_t ecdsa_sign_verify(void* pContext)
 
     /* Verify the data using the public Key */
     /*--------------------------------------*/
-    cookie = TE_perfOpenNewEntry("ecdsa", "verify");
+    cookie = TE_perfOpenNewEntry("ecdsa", pVector->pVerifyEntry);
     TE_ASSERT(CC_EcdsaVerify(&verifyUserContext,
                              &userPublKey,
                              TE_ECDSA_HASH,
@@ -109,6 +129,76 @@ static TE_rc_t ecdsa_sign_verify(void* pContext)
                              msgInSize) == CC_OK);
     TE_perfCloseEntry(cookie);
 
+    /* A modified signature must be rejected */
+    signedData[signedDataLen - 1] ^= 0x01;
+    TE_ASSERT(CC_EcdsaVerify(&verifyUserContext,
+                             &userPublKey,
+                             TE_ECDSA_HASH,
+                             signedData,
+                             signedDataLen,
+                             msgIn,
+                             msgInSize) == CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR);
+
+bail:
+    return res;
+}
+
+static TE_rc_t ecdsa_verify_batch(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    uint8_t signedData[TE_ECDSA_BATCH_SIZE][CALC_WORDS_TO_BYTES(CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS) * 2];
+    uint8_t msgIn[TE_ECDSA_BATCH_SIZE][RANDON_MSG_SIZE_IN_BYTES];
+    CCEcdsaVerifyBatchItem_t items[TE_ECDSA_BATCH_SIZE];
+    size_t signedDataLen;
+    uint32_t i;
+    TE_UNUSED(pContext);
+
+    TE_ASSERT(CC_EcpkiKeyPairGenerate(pRndFunc_proj,
+                                      pRndState_proj,
+                                      CC_EcpkiGetEcDomain(TE_ECDSA_DOMAIN),
+                                      &userPrivKey,
+                                      &userPublKey,
+                                      &tempBuff,
+                                      NULL) == CC_OK);
+
+    for (i = 0; i < TE_ECDSA_BATCH_SIZE; i++) {
+        TE_ASSERT(CC_RndGenerateVector(pRndState_proj, msgIn[i], sizeof(msgIn[i])) == CC_OK);
+        signedDataLen = sizeof(signedData[i]);
+        TE_ASSERT(CC_EcdsaSign(pRndFunc_proj,
+                               pRndState_proj,
+                               &signUserContext,
+                               &userPrivKey,
+                               TE_ECDSA_HASH,
+                               msgIn[i],
+                               sizeof(msgIn[i]),
+                               signedData[i],
+                               &signedDataLen) == CC_OK);
+        items[i].pUserPublKey = &userPublKey;
+        items[i].pSignatureIn = signedData[i];
+        items[i].signatureSizeBytes = signedDataLen;
+        items[i].pMessageDataIn = msgIn[i];
+        items[i].messageSizeInBytes = sizeof(msgIn[i]);
+    }
+
+    /* all the signatures are valid */
+    cookie = TE_perfOpenNewEntry("ecdsa", "verify-batch");
+    TE_ASSERT(CC_EcdsaVerifyBatch(&verifyUserContext,
+                                  TE_ECDSA_HASH,
+                                  items,
+                                  TE_ECDSA_BATCH_SIZE) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    /* one corrupted message fails only its own item */
+    msgIn[1][0] ^= 0x1;
+    TE_ASSERT(CC_EcdsaVerifyBatch(&verifyUserContext,
+                                  TE_ECDSA_HASH,
+                                  items,
+                                  TE_ECDSA_BATCH_SIZE) == CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR);
+    for (i = 0; i < TE_ECDSA_BATCH_SIZE; i++) {
+        TE_ASSERT((items[i].result == CC_OK) == (i != 1));
+    }
+
 bail:
     return res;
 }
@@ -120,11 +210,15 @@ bail:
 int TE_init_ecdsa_test(void)
 {
     TE_rc_t res = TE_RC_SUCCESS;
+    uint32_t i = 0;
 
-    TE_perfEntryInit("ecdsa", "key-pair-generate");
-    TE_perfEntryInit("ecdsa", "sign");
-    TE_perfEntryInit("ecdsa", "verify");
+    for (i = 0; i < sizeof(ecdsaDomainVectors) / sizeof(ecdsaDomainVectors[0]); i++) {
+        TE_perfEntryInit("ecdsa", ecdsaDomainVectors[i].pKeyGenEntry);
+        TE_perfEntryInit("ecdsa", ecdsaDomainVectors[i].pSignEntry);
+        TE_perfEntryInit("ecdsa", ecdsaDomainVectors[i].pVerifyEntry);
+    }
     TE_perfEntryInit("ecdsa", "generate-rand-vec");
+    TE_perfEntryInit("ecdsa", "verify-batch");
 
     TE_ASSERT(TE_registerFlow("ecdsa-test-1",
                                "ECDSA",
@@ -133,6 +227,33 @@ int TE_init_ecdsa_test(void)
                                ecdsa_sign_verify,
                                NULL,
                                NULL,
+                               &ecdsaDomainVectors[0]) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("ecdsa-test-3",
+                               "ECDSA",
+                               "sign&verify P-384",
+                               NULL,
+                               ecdsa_sign_verify,
+                               NULL,
+                               NULL,
+                               &ecdsaDomainVectors[1]) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("ecdsa-test-4",
+                               "ECDSA",
+                               "sign&verify P-521",
+                               NULL,
+                               ecdsa_sign_verify,
+                               NULL,
+                               NULL,
+                               &ecdsaDomainVectors[2]) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("ecdsa-test-2",
+                               "ECDSA",
+                               "batch verify",
+                               NULL,
+                               ecdsa_verify_batch,
+                               NULL,
+                               NULL,
                                NULL) == TE_RC_SUCCESS);
 
 bail:
@@ -8,8 +8,12 @@
 #include <stdio.h>
 #include <stdint.h>
 #include "test_engine.h"
+#include "cc_aes.h"
+#include "cc_aesgcm.h"
 #include "cc_ecpki_domain.h"
 #include "cc_ecpki_ecies.h"
+#include "cc_ecpki_ecies_hybrid.h"
+#include "cc_ecpki_error.h"
 #include "cc_ecpki_kg.h"
 #include "te_ecies.h"
 
@@ -19,6 +23,10 @@
 
 #define TE_ECIES_KEY_DATA_MAX_LEN_BYTES                200
 #define TE_ECIES_KEY_DATA_LEN_IN_BYTES                 128
+#define TE_ECIES_HYBRID_TEXT_SIZE_IN_BYTES             4099
+#define TE_ECIES_HYBRID_CHUNK_SIZE_IN_BYTES            333
+#define TE_ECIES_HYBRID_DEM_KEY_SIZE_IN_BYTES          16
+#define TE_ECIES_HYBRID_GCM_IV_SIZE_IN_BYTES           12
 
 /******************************************************************
  * Types
@@ -49,11 +57,27 @@ static eciesDataVector_t teEciesTestVec = {
                                            .isSingleHashMode = CC_FALSE,
 };
 
+static CCEciesHybridContext_t teEciesHybridContext;
+static uint8_t teEciesHybridText[TE_ECIES_HYBRID_TEXT_SIZE_IN_BYTES];
+/* the AES-CBC padding extends the ciphertext by up to a block */
+static uint8_t teEciesHybridCipher[TE_ECIES_HYBRID_TEXT_SIZE_IN_BYTES + CC_AES_BLOCK_SIZE_IN_BYTES];
+static uint8_t teEciesHybridPlain[TE_ECIES_HYBRID_TEXT_SIZE_IN_BYTES + CC_AES_BLOCK_SIZE_IN_BYTES];
+
+/* the hybrid figures of each DEM mode, next to the raw AES figures of the same text */
+static const char *teEciesHybridEncryptEntries[CC_ECIES_DEM_NumOfModes] = {
+    "hybrid-encrypt-ctr-hmac", "hybrid-encrypt-cbc-hmac", "hybrid-encrypt-gcm"
+};
+static const char *teEciesHybridDecryptEntries[CC_ECIES_DEM_NumOfModes] = {
+    "hybrid-decrypt-ctr-hmac", "hybrid-decrypt-cbc-hmac", "hybrid-decrypt-gcm"
+};
+
 /******************************************************************
  * Static Prototypes
  ******************************************************************/
 
 static TE_rc_t ecies_exec(void* pContext);
+static TE_rc_t ecies_hybrid_exec(void* pContext);
+static TE_rc_t ecies_hybrid_aes_bench(void);
 
 /******************************************************************
  * Static functions
@@ -139,6 +163,252 @@ static TE_rc_t ecies_exec(void* pContext)
     return res;
 }
 
+/* processes the input in chunks by the hybrid ECIES context, and finishes it with the expected result */
+static TE_rc_t ecies_hybrid_process(CCError_t expFinishError,
+                                    uint8_t *pDataIn,
+                                    size_t dataInSize,
+                                    uint8_t *pDataOut,
+                                    size_t *pDataOutSize,
+                                    uint8_t *pTag,
+                                    size_t *pTagSize)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    size_t offset = 0;
+    size_t chunkSize = 0;
+    size_t outSize = 0;
+    size_t totalOutSize = 0;
+
+    for (offset = 0; offset < dataInSize; offset += chunkSize) {
+        chunkSize = dataInSize - offset;
+        if (chunkSize > TE_ECIES_HYBRID_CHUNK_SIZE_IN_BYTES) {
+            chunkSize = TE_ECIES_HYBRID_CHUNK_SIZE_IN_BYTES;
+        }
+        outSize = chunkSize + CC_AES_BLOCK_SIZE_IN_BYTES;
+        TE_ASSERT(CC_EciesHybridUpdate(&teEciesHybridContext,
+                                       pDataIn + offset,
+                                       chunkSize,
+                                       pDataOut + totalOutSize,
+                                       &outSize) == CC_OK);
+        totalOutSize += outSize;
+    }
+
+    outSize = 2 * CC_AES_BLOCK_SIZE_IN_BYTES;
+    TE_ASSERT(CC_EciesHybridFinish(&teEciesHybridContext,
+                                   pDataOut + totalOutSize,
+                                   &outSize,
+                                   pTag,
+                                   pTagSize) == expFinishError);
+    *pDataOutSize = totalOutSize + outSize;
+
+bail:
+    return res;
+}
+
+static TE_rc_t ecies_hybrid_exec(void* pContext)
+{
+    TE_perfIndex_t cookie = 0;
+    TE_rc_t res = TE_RC_SUCCESS;
+    eciesDataVector_t* pEciesTestVec = NULL;
+    const CCEcpkiDomain_t *pDomain;
+    CCEcpkiUserPrivKey_t userPrivKey;
+    CCEcpkiUserPublKey_t userPublKey;
+    CCEcpkiKgTempData_t tempBuff;
+    CCEciesTempData_t eciesTempBuff;
+    uint32_t pCipherData[2 * CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS + 1] = { 0 };
+    size_t cipherDataSize = 0;
+    uint8_t tag[CC_ECIES_DEM_MAX_TAG_SIZE_IN_BYTES];
+    size_t tagSize = 0;
+    size_t encSize = 0;
+    size_t decSize = 0;
+    CCEciesDemMode_t demMode;
+    size_t i;
+
+    TE_ASSERT(pContext != NULL);
+
+    pEciesTestVec = (eciesDataVector_t *)pContext;
+
+    pDomain = CC_EcpkiGetEcDomain(pEciesTestVec->domainId);
+    TE_ASSERT(pDomain != NULL);
+
+    TE_ASSERT(CC_EcpkiKeyPairGenerate(pRndFunc_proj,
+                                      pRndState_proj,
+                                      pDomain,
+                                      &userPrivKey,
+                                      &userPublKey,
+                                      &tempBuff,
+                                      NULL) == CC_OK);
+
+    for (i = 0; i < sizeof(teEciesHybridText); i++) {
+        teEciesHybridText[i] = (uint8_t)i;
+    }
+
+    for (demMode = CC_ECIES_DEM_AES_CTR_HMAC; demMode < CC_ECIES_DEM_NumOfModes; demMode++) {
+
+        /* Encrypting */
+        /*------------*/
+        cipherDataSize = sizeof(pCipherData);
+        tagSize = sizeof(tag);
+        cookie = TE_perfOpenNewEntry("ecies", teEciesHybridEncryptEntries[demMode]);
+        TE_ASSERT(CC_EciesHybridEncryptInit(&teEciesHybridContext,
+                                            &userPublKey,
+                                            pEciesTestVec->kDerivFuncMode,
+                                            pEciesTestVec->kdfHashMode,
+                                            pEciesTestVec->isSingleHashMode,
+                                            demMode,
+                                            TE_ECIES_HYBRID_DEM_KEY_SIZE_IN_BYTES,
+                                            sizeof(teEciesHybridText),
+                                            (uint8_t*)pCipherData,
+                                            &cipherDataSize,
+                                            &eciesTempBuff,
+                                            pRndFunc_proj,
+                                            pRndState_proj,
+                                            NULL) == CC_OK);
+        TE_ASSERT(ecies_hybrid_process(CC_OK,
+                                       teEciesHybridText,
+                                       sizeof(teEciesHybridText),
+                                       teEciesHybridCipher,
+                                       &encSize,
+                                       tag,
+                                       &tagSize) == TE_RC_SUCCESS);
+        TE_perfCloseEntry(cookie);
+
+        /* Decrypting */
+        /*------------*/
+        cookie = TE_perfOpenNewEntry("ecies", teEciesHybridDecryptEntries[demMode]);
+        TE_ASSERT(CC_EciesHybridDecryptInit(&teEciesHybridContext,
+                                            &userPrivKey,
+                                            pEciesTestVec->kDerivFuncMode,
+                                            pEciesTestVec->kdfHashMode,
+                                            pEciesTestVec->isSingleHashMode,
+                                            demMode,
+                                            TE_ECIES_HYBRID_DEM_KEY_SIZE_IN_BYTES,
+                                            encSize,
+                                            (uint8_t*)pCipherData,
+                                            cipherDataSize,
+                                            &eciesTempBuff) == CC_OK);
+        TE_ASSERT(ecies_hybrid_process(CC_OK,
+                                       teEciesHybridCipher,
+                                       encSize,
+                                       teEciesHybridPlain,
+                                       &decSize,
+                                       tag,
+                                       &tagSize) == TE_RC_SUCCESS);
+        TE_perfCloseEntry(cookie);
+
+        /* Comparing messages */
+        /*--------------------*/
+        TE_ASSERT(decSize == sizeof(teEciesHybridText));
+        TE_ASSERT(memcmp(teEciesHybridText, teEciesHybridPlain, decSize) == 0);
+
+        /* a modified ciphertext is not authentic */
+        /*----------------------------------------*/
+        teEciesHybridCipher[encSize / 2] ^= 1;
+        TE_ASSERT(CC_EciesHybridDecryptInit(&teEciesHybridContext,
+                                            &userPrivKey,
+                                            pEciesTestVec->kDerivFuncMode,
+                                            pEciesTestVec->kdfHashMode,
+                                            pEciesTestVec->isSingleHashMode,
+                                            demMode,
+                                            TE_ECIES_HYBRID_DEM_KEY_SIZE_IN_BYTES,
+                                            encSize,
+                                            (uint8_t*)pCipherData,
+                                            cipherDataSize,
+                                            &eciesTempBuff) == CC_OK);
+        TE_ASSERT(ecies_hybrid_process(CC_ECIES_TAG_VERIFY_FAILED_ERROR,
+                                       teEciesHybridCipher,
+                                       encSize,
+                                       teEciesHybridPlain,
+                                       &decSize,
+                                       tag,
+                                       &tagSize) == TE_RC_SUCCESS);
+    }
+
+    TE_ASSERT(ecies_hybrid_aes_bench() == TE_RC_SUCCESS);
+
+bail:
+    CC_EciesHybridFree(&teEciesHybridContext);
+    return res;
+}
+
+/* the raw AES-CBC and AES-GCM of the hybrid text, as the baseline of the hybrid ECIES figures */
+static TE_rc_t ecies_hybrid_aes_bench(void)
+{
+    TE_perfIndex_t cookie = 0;
+    TE_rc_t res = TE_RC_SUCCESS;
+    CCAesUserContext_t aesContext;
+    CCAesUserKeyData_t keyData;
+    CCAesIv_t iv;
+    CCAesGcmKey_t gcmKey;
+    CCAesGcmTagRes_t gcmTag;
+    uint8_t gcmIv[TE_ECIES_HYBRID_GCM_IV_SIZE_IN_BYTES];
+    uint8_t lastIn[2 * CC_AES_BLOCK_SIZE_IN_BYTES];
+    uint8_t lastOut[2 * CC_AES_BLOCK_SIZE_IN_BYTES];
+    size_t blocksSize = sizeof(teEciesHybridText) - (sizeof(teEciesHybridText) % CC_AES_BLOCK_SIZE_IN_BYTES);
+    size_t lastOutSize = 0;
+    size_t encSize = 0;
+
+    memset(gcmKey, 0x3C, sizeof(gcmKey));
+    memset(gcmIv, 0x5A, sizeof(gcmIv));
+    memset(iv, 0, sizeof(iv));
+    keyData.pKey = gcmKey;
+    keyData.keySize = TE_ECIES_HYBRID_DEM_KEY_SIZE_IN_BYTES;
+
+    /* AES-CBC with the PKCS7 padding, as the AES-CBC/HMAC DEM */
+    /*-------------------------------------------------------*/
+    memset(lastIn, 0, sizeof(lastIn));
+    memcpy(lastIn, teEciesHybridText + blocksSize, sizeof(teEciesHybridText) - blocksSize);
+    lastOutSize = sizeof(lastOut);
+    cookie = TE_perfOpenNewEntry("ecies", "aes-cbc-encrypt");
+    TE_ASSERT(CC_AesInit(&aesContext, CC_AES_ENCRYPT, CC_AES_MODE_CBC, CC_AES_PADDING_PKCS7) == CC_OK);
+    TE_ASSERT(CC_AesSetKey(&aesContext, CC_AES_USER_KEY, &keyData, sizeof(keyData)) == CC_OK);
+    TE_ASSERT(CC_AesSetIv(&aesContext, iv) == CC_OK);
+    TE_ASSERT(CC_AesBlock(&aesContext, teEciesHybridText, blocksSize, teEciesHybridCipher) == CC_OK);
+    TE_ASSERT(CC_AesFinish(&aesContext, sizeof(teEciesHybridText) - blocksSize,
+                           lastIn, sizeof(lastIn), lastOut, &lastOutSize) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(CC_AesFree(&aesContext) == CC_OK);
+    memcpy(teEciesHybridCipher + blocksSize, lastOut, lastOutSize);
+    encSize = blocksSize + lastOutSize;
+
+    lastOutSize = sizeof(lastOut);
+    cookie = TE_perfOpenNewEntry("ecies", "aes-cbc-decrypt");
+    TE_ASSERT(CC_AesInit(&aesContext, CC_AES_DECRYPT, CC_AES_MODE_CBC, CC_AES_PADDING_PKCS7) == CC_OK);
+    TE_ASSERT(CC_AesSetKey(&aesContext, CC_AES_USER_KEY, &keyData, sizeof(keyData)) == CC_OK);
+    TE_ASSERT(CC_AesSetIv(&aesContext, iv) == CC_OK);
+    TE_ASSERT(CC_AesBlock(&aesContext, teEciesHybridCipher, encSize - CC_AES_BLOCK_SIZE_IN_BYTES,
+                          teEciesHybridPlain) == CC_OK);
+    TE_ASSERT(CC_AesFinish(&aesContext, CC_AES_BLOCK_SIZE_IN_BYTES,
+                           teEciesHybridCipher + encSize - CC_AES_BLOCK_SIZE_IN_BYTES, CC_AES_BLOCK_SIZE_IN_BYTES,
+                           lastOut, &lastOutSize) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(CC_AesFree(&aesContext) == CC_OK);
+    memcpy(teEciesHybridPlain + encSize - CC_AES_BLOCK_SIZE_IN_BYTES, lastOut, lastOutSize);
+
+    TE_ASSERT(encSize - CC_AES_BLOCK_SIZE_IN_BYTES + lastOutSize == sizeof(teEciesHybridText));
+    TE_ASSERT(memcmp(teEciesHybridText, teEciesHybridPlain, sizeof(teEciesHybridText)) == 0);
+
+    /* AES-GCM, as the AES-GCM DEM */
+    /*----------------------------*/
+    cookie = TE_perfOpenNewEntry("ecies", "aes-gcm-encrypt");
+    TE_ASSERT(CC_AesGcm(CC_AES_ENCRYPT, gcmKey, CC_AESGCM_Key128BitSize,
+                        gcmIv, sizeof(gcmIv), NULL, 0,
+                        teEciesHybridText, sizeof(teEciesHybridText),
+                        teEciesHybridCipher, sizeof(gcmTag), gcmTag) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    cookie = TE_perfOpenNewEntry("ecies", "aes-gcm-decrypt");
+    TE_ASSERT(CC_AesGcm(CC_AES_DECRYPT, gcmKey, CC_AESGCM_Key128BitSize,
+                        gcmIv, sizeof(gcmIv), NULL, 0,
+                        teEciesHybridCipher, sizeof(teEciesHybridText),
+                        teEciesHybridPlain, sizeof(gcmTag), gcmTag) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    TE_ASSERT(memcmp(teEciesHybridText, teEciesHybridPlain, sizeof(teEciesHybridText)) == 0);
+
+bail:
+    return res;
+}
+
 /******************************************************************
  * Public
  ******************************************************************/
@@ -146,11 +416,20 @@ static TE_rc_t ecies_exec(void* pContext)
 int TE_init_ecies_test(void)
 {
     TE_rc_t res = TE_RC_SUCCESS;
+    CCEciesDemMode_t demMode;
 
     TE_perfEntryInit("ecies", "get-domain");
     TE_perfEntryInit("ecies", "key-pair-gen");
     TE_perfEntryInit("ecies", "encrypt");
     TE_perfEntryInit("ecies", "decrypt");
+    for (demMode = CC_ECIES_DEM_AES_CTR_HMAC; demMode < CC_ECIES_DEM_NumOfModes; demMode++) {
+        TE_perfEntryInit("ecies", teEciesHybridEncryptEntries[demMode]);
+        TE_perfEntryInit("ecies", teEciesHybridDecryptEntries[demMode]);
+    }
+    TE_perfEntryInit("ecies", "aes-cbc-encrypt");
+    TE_perfEntryInit("ecies", "aes-cbc-decrypt");
+    TE_perfEntryInit("ecies", "aes-gcm-encrypt");
+    TE_perfEntryInit("ecies", "aes-gcm-decrypt");
 
     TE_ASSERT(TE_registerFlow("ecies",
                               "encrypt&decrypt",
@@ -161,6 +440,15 @@ int TE_init_ecies_test(void)
                               NULL,
                               &teEciesTestVec) == TE_RC_SUCCESS);
 
+    TE_ASSERT(TE_registerFlow("ecies",
+                              "hybrid encrypt&decrypt",
+                              "AES-CTR/HMAC, AES-CBC/HMAC, AES-GCM",
+                              NULL,
+                              ecies_hybrid_exec,
+                              NULL,
+                              NULL,
+                              &teEciesTestVec) == TE_RC_SUCCESS);
+
 bail:
     return res;
 }
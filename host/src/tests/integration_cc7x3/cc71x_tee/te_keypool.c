@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "test_engine.h"
+#include "cc_keypool.h"
+#include "cc_keypool_error.h"
+#include "cc_ecpki_ecdsa.h"
+#include "cc_ecpki_domain.h"
+#include "cc_rsa_schemes.h"
+#include "cc_rnd.h"
+#include "te_keypool.h"
+
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+#define TE_KEYPOOL_EC_DOMAIN            CC_ECPKI_DomainID_secp256r1
+#define TE_KEYPOOL_EC_SLOTS_COUNT       4
+#define TE_KEYPOOL_RSA_KEY_SIZE_IN_BITS 2048
+#define TE_KEYPOOL_RSA_SLOTS_COUNT      2
+#define RANDON_MSG_SIZE_IN_BYTES        64
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+extern CCRndState_t *pRndState_proj;
+extern CCRndGenerateVectWorkFunc_t pRndFunc_proj;
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+static CCKeyPool_t                  keyPool;
+static CCKeyPoolSlot_t              keySlots[TE_KEYPOOL_EC_SLOTS_COUNT];
+static CCKeyPoolTempData_t          tempData;
+static CCEcpkiUserPrivKey_t         ecPrivKey;
+static CCEcpkiUserPublKey_t         ecPublKey;
+static CCEcdsaSignUserContext_t     signUserContext;
+static CCEcdsaVerifyUserContext_t   verifyUserContext;
+static CCRsaUserPrivKey_t           rsaPrivKey;
+static CCRsaUserPubKey_t            rsaPubKey;
+static CCRsaPrivUserContext_t       rsaPrivUserContext;
+static CCRsaPubUserContext_t        rsaPubUserContext;
+
+/******************************************************************
+ * Static Prototypes
+ ******************************************************************/
+
+static TE_rc_t keypool_ec(void* pContext);
+static TE_rc_t keypool_rsa(void* pContext);
+
+/******************************************************************
+ * Static functions
+ ******************************************************************/
+
+/* refills the pool until it is full; the refill stops early when the PKA is busy */
+static TE_rc_t keypool_fill(CCKeyPool_t *pPool, uint32_t slotsCount)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    uint32_t keysCount = 0;
+    uint32_t generated = 0;
+
+    while (keysCount < slotsCount) {
+        cookie = TE_perfOpenNewEntry("keypool", "refill");
+        TE_ASSERT(CC_KeyPoolRefill(pPool,
+                                   pRndFunc_proj,
+                                   pRndState_proj,
+                                   &tempData,
+                                   slotsCount,
+                                   &generated) == CC_OK);
+        TE_perfCloseEntry(cookie);
+        TE_ASSERT(CC_KeyPoolLevelGet(pPool, &keysCount) == CC_OK);
+    }
+
+    /* a full pool generates nothing */
+    TE_ASSERT(CC_KeyPoolRefill(pPool,
+                               pRndFunc_proj,
+                               pRndState_proj,
+                               &tempData,
+                               slotsCount,
+                               &generated) == CC_OK);
+    TE_ASSERT(generated == 0);
+
+bail:
+    return res;
+}
+
+static TE_rc_t keypool_ec(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    uint8_t signedData[CALC_WORDS_TO_BYTES(CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS) * 2];
+    size_t signedDataLen = sizeof(signedData);
+    uint8_t msgIn[RANDON_MSG_SIZE_IN_BYTES];
+    uint32_t keysCount = 0;
+    uint32_t i;
+    TE_UNUSED(pContext);
+
+    TE_ASSERT(CC_KeyPoolInit(&keyPool,
+                             CC_KEYPOOL_ALG_ECPKI,
+                             NULL, 0, 0,
+                             CC_EcpkiGetEcDomain(TE_KEYPOOL_EC_DOMAIN),
+                             keySlots,
+                             TE_KEYPOOL_EC_SLOTS_COUNT) == CC_OK);
+
+    /* an empty pool serves no key */
+    TE_ASSERT(CC_KeyPoolGetEcpki(&keyPool, &ecPrivKey, &ecPublKey) == CC_KEYPOOL_EMPTY_ERROR);
+    TE_ASSERT(CC_KeyPoolGetRsa(&keyPool, &rsaPrivKey, &rsaPubKey) == CC_KEYPOOL_ALGORITHM_MISMATCH_ERROR);
+
+    TE_ASSERT(keypool_fill(&keyPool, TE_KEYPOOL_EC_SLOTS_COUNT) == TE_RC_SUCCESS);
+
+    /* every served key pair is valid */
+    TE_ASSERT(CC_RndGenerateVector(pRndState_proj, msgIn, sizeof(msgIn)) == CC_OK);
+    for (i = 0; i < TE_KEYPOOL_EC_SLOTS_COUNT; i++) {
+        cookie = TE_perfOpenNewEntry("keypool", "get");
+        TE_ASSERT(CC_KeyPoolGetEcpki(&keyPool, &ecPrivKey, &ecPublKey) == CC_OK);
+        TE_perfCloseEntry(cookie);
+
+        signedDataLen = sizeof(signedData);
+        TE_ASSERT(CC_EcdsaSign(pRndFunc_proj,
+                               pRndState_proj,
+                               &signUserContext,
+                               &ecPrivKey,
+                               CC_ECPKI_HASH_SHA256_mode,
+                               msgIn,
+                               sizeof(msgIn),
+                               signedData,
+                               &signedDataLen) == CC_OK);
+        TE_ASSERT(CC_EcdsaVerify(&verifyUserContext,
+                                 &ecPublKey,
+                                 CC_ECPKI_HASH_SHA256_mode,
+                                 signedData,
+                                 signedDataLen,
+                                 msgIn,
+                                 sizeof(msgIn)) == CC_OK);
+    }
+    TE_ASSERT(CC_KeyPoolLevelGet(&keyPool, &keysCount) == CC_OK);
+    TE_ASSERT(keysCount == 0);
+
+    /* the freed pool keeps no key */
+    TE_ASSERT(keypool_fill(&keyPool, TE_KEYPOOL_EC_SLOTS_COUNT) == TE_RC_SUCCESS);
+    TE_ASSERT(CC_KeyPoolFree(&keyPool) == CC_OK);
+    for (i = 0; i < sizeof(keySlots); i++) {
+        TE_ASSERT(((uint8_t *)keySlots)[i] == 0);
+    }
+    TE_ASSERT(CC_KeyPoolGetEcpki(&keyPool, &ecPrivKey, &ecPublKey) == CC_KEYPOOL_INVALID_POOL_ERROR);
+
+bail:
+    return res;
+}
+
+static TE_rc_t keypool_rsa(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    uint8_t sigBuff[CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS * sizeof(uint32_t)];
+    uint8_t pubExp65537[] = { 0x01, 0x00, 0x01 };
+    uint8_t msgIn[RANDON_MSG_SIZE_IN_BYTES];
+    size_t sigBuffSize = sizeof(sigBuff);
+    TE_UNUSED(pContext);
+
+    TE_ASSERT(CC_KeyPoolInit(&keyPool,
+                             CC_KEYPOOL_ALG_RSA_CRT,
+                             pubExp65537, sizeof(pubExp65537),
+                             TE_KEYPOOL_RSA_KEY_SIZE_IN_BITS,
+                             NULL,
+                             keySlots,
+                             TE_KEYPOOL_RSA_SLOTS_COUNT) == CC_OK);
+
+    TE_ASSERT(keypool_fill(&keyPool, TE_KEYPOOL_RSA_SLOTS_COUNT) == TE_RC_SUCCESS);
+
+    TE_ASSERT(CC_KeyPoolGetRsa(&keyPool, &rsaPrivKey, &rsaPubKey) == CC_OK);
+    TE_ASSERT(CC_RndGenerateVector(pRndState_proj, msgIn, sizeof(msgIn)) == CC_OK);
+    TE_ASSERT(CC_RsaSign(pRndFunc_proj,
+                         pRndState_proj, &rsaPrivUserContext,
+                         &rsaPrivKey, CC_RSA_HASH_SHA256_mode,
+                         CC_PKCS1_MGF1, 0, msgIn, sizeof(msgIn), sigBuff,
+                         &sigBuffSize, CC_PKCS1_VER21) == CC_OK);
+    TE_ASSERT(CC_RsaVerify(&rsaPubUserContext, &rsaPubKey,
+                           CC_RSA_HASH_SHA256_mode, CC_PKCS1_MGF1, 0, msgIn,
+                           sizeof(msgIn), sigBuff, CC_PKCS1_VER21) == CC_OK);
+
+    TE_ASSERT(CC_KeyPoolFree(&keyPool) == CC_OK);
+
+bail:
+    return res;
+}
+
+/******************************************************************
+ * Public
+ ******************************************************************/
+
+int TE_init_keypool_test(void)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+
+    TE_perfEntryInit("keypool", "refill");
+    TE_perfEntryInit("keypool", "get");
+
+    TE_ASSERT(TE_registerFlow("keypool-test-1",
+                               "key pool",
+                               "EC key pairs",
+                               NULL,
+                               keypool_ec,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("keypool-test-2",
+                               "key pool",
+                               "RSA CRT key pairs",
+                               NULL,
+                               keypool_rsa,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+bail:
+    return res;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC71X_TEE_INTEGRATION_TE_KEYPOOL_H
+#define _CC71X_TEE_INTEGRATION_TE_KEYPOOL_H
+/*!
+  @file
+  @brief This file contains key pool definitions for test usage.
+
+  This file defines:
+      <ol><li>Key pool mapping used for key pool integration tests.</li>
+      <li>Declarations of key pool integration test functions.</li></ol>
+ */
+
+/*!
+ @addtogroup keypool_apis
+ @{
+ */
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+/******************************************************************
+ * Functions
+ ******************************************************************/
+
+/*!
+@brief This function allocates and initializes the key pool test resources.
+
+
+@return \c zero on success.
+@return A non-zero value on failure.
+*/
+int TE_init_keypool_test(void);
+
+
+/*!
+ @}
+ */
+#endif /* _CC71X_TEE_INTEGRATION_TE_KEYPOOL_H */
+
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "test_engine.h"
+#include "cc_pal_memmap.h"
+#include "te_pal_memmap.h"
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+#define TE_PAL_MEMMAP_FILE_SIZE         (64 * 1024)
+#define TE_PAL_MEMMAP_IMAGE_OFFSET      0x1010
+#define TE_PAL_MEMMAP_IMAGE_SIZE        0x2000
+#define TE_PAL_MEMMAP_VERIFY_CYCLES     1000
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+/* file-backed stand-in for the image device */
+static char memFileName[] = "/tmp/te_pal_memmap_XXXXXX";
+static int memFileFd = -1;
+
+/******************************************************************
+ * Static Prototypes
+ ******************************************************************/
+
+static TE_rc_t pal_memmap_prepare(void *pContext);
+static TE_rc_t pal_memmap_cache(void *pContext);
+static TE_rc_t pal_memmap_clean(void *pContext);
+
+/******************************************************************
+ * Static functions
+ ******************************************************************/
+
+static TE_rc_t pal_memmap_prepare(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+
+    TE_UNUSED(pContext);
+
+    memFileFd = mkstemp(memFileName);
+    TE_ASSERT(memFileFd >= 0);
+    TE_ASSERT(ftruncate(memFileFd, TE_PAL_MEMMAP_FILE_SIZE) == 0);
+    TE_ASSERT(CC_PalMemMapDevSet(CC_PAL_MEMMAP_DEV_IMAGE, memFileName) == 0);
+    TE_ASSERT(CC_PalMemMapStatsReset(CC_PAL_MEMMAP_DEV_IMAGE) == 0);
+
+bail:
+    return res;
+}
+
+static TE_rc_t pal_memmap_cache(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    CCPalMemMapStats_t stats;
+    uint32_t *pImage = NULL;
+    uint32_t *pWord = NULL;
+    uint32_t *pInner = NULL;
+    uint32_t word = 0;
+    uint32_t i;
+
+    TE_UNUSED(pContext);
+
+    /* an unaligned range is mapped through a page aligned window */
+    TE_ASSERT(CC_PalMemMapImage(TE_PAL_MEMMAP_IMAGE_OFFSET, TE_PAL_MEMMAP_IMAGE_SIZE, &pImage) == 0);
+    for (i = 0; i < TE_PAL_MEMMAP_IMAGE_SIZE / sizeof(uint32_t); i++) {
+        pImage[i] = i;
+    }
+    TE_ASSERT(pread(memFileFd, &word, sizeof(word), TE_PAL_MEMMAP_IMAGE_OFFSET + 4 * sizeof(uint32_t)) == sizeof(word));
+    TE_ASSERT(word == 4);
+
+    /* a range inside the window is served without mapping */
+    TE_ASSERT(CC_PalMemMapImage(TE_PAL_MEMMAP_IMAGE_OFFSET + 0x100, sizeof(uint32_t), &pWord) == 0);
+    TE_ASSERT(pWord == pImage + (0x100 / sizeof(uint32_t)));
+    TE_ASSERT(*pWord == 0x100 / sizeof(uint32_t));
+    TE_ASSERT(CC_PalMemUnMapImage(pWord, sizeof(uint32_t)) == 0);
+    TE_ASSERT(CC_PalMemUnMapImage(pImage, TE_PAL_MEMMAP_IMAGE_SIZE) == 0);
+
+    /* repeated verification cycles reuse the idle window */
+    cookie = TE_perfOpenNewEntry("memmap", "map-unmap-cycle");
+    for (i = 0; i < TE_PAL_MEMMAP_VERIFY_CYCLES; i++) {
+        TE_ASSERT(CC_PalMemMapImage(TE_PAL_MEMMAP_IMAGE_OFFSET, TE_PAL_MEMMAP_IMAGE_SIZE, &pImage) == 0);
+        TE_ASSERT(pImage[1] == 1);
+        TE_ASSERT(CC_PalMemUnMapImage(pImage, TE_PAL_MEMMAP_IMAGE_SIZE) == 0);
+    }
+    TE_perfCloseEntry(cookie);
+
+    TE_ASSERT(CC_PalMemMapStatsGet(CC_PAL_MEMMAP_DEV_IMAGE, &stats) == 0);
+    TE_ASSERT(stats.mapCalls == TE_PAL_MEMMAP_VERIFY_CYCLES + 2);
+    TE_ASSERT(stats.mmapCalls == 1);
+    TE_ASSERT(stats.munmapCalls == 0);
+    TE_ASSERT(stats.activeWindows == 0);
+    TE_ASSERT(stats.idleWindows == 1);
+
+    /* a range overlapping the window replaces it with one covering both */
+    TE_ASSERT(CC_PalMemMapImage(TE_PAL_MEMMAP_IMAGE_OFFSET, TE_PAL_MEMMAP_IMAGE_SIZE, &pImage) == 0);
+    TE_ASSERT(CC_PalMemMapImage(TE_PAL_MEMMAP_IMAGE_OFFSET + TE_PAL_MEMMAP_IMAGE_SIZE, TE_PAL_MEMMAP_IMAGE_SIZE, &pWord) == 0);
+    TE_ASSERT(CC_PalMemUnMapImage(pImage, TE_PAL_MEMMAP_IMAGE_SIZE) == 0);
+    TE_ASSERT(CC_PalMemMapImage(TE_PAL_MEMMAP_IMAGE_OFFSET, 2 * TE_PAL_MEMMAP_IMAGE_SIZE, &pInner) == 0);
+    TE_ASSERT(pInner[2] == 2);
+    TE_ASSERT(CC_PalMemUnMapImage(pInner, 2 * TE_PAL_MEMMAP_IMAGE_SIZE) == 0);
+    TE_ASSERT(CC_PalMemUnMapImage(pWord, TE_PAL_MEMMAP_IMAGE_SIZE) == 0);
+
+    TE_ASSERT(CC_PalMemMapStatsGet(CC_PAL_MEMMAP_DEV_IMAGE, &stats) == 0);
+    TE_ASSERT(stats.mmapCalls == 2);
+    TE_ASSERT(stats.munmapCalls == 1);
+    TE_ASSERT(stats.idleWindows == 1);
+
+    /* unmapping an address that is not mapped fails */
+    TE_ASSERT(CC_PalMemUnMapImage(&word, sizeof(word)) != 0);
+
+    TE_ASSERT(CC_PalMemMapCacheFlush() == 0);
+    TE_ASSERT(CC_PalMemMapStatsGet(CC_PAL_MEMMAP_DEV_IMAGE, &stats) == 0);
+    TE_ASSERT(stats.idleWindows == 0);
+    TE_ASSERT(stats.mappedBytes == 0);
+
+    TE_LOG_INFO("memmap: calls[%u] hits[%u] mmap[%u] munmap[%u] evictions[%u]\n",
+                stats.mapCalls, stats.cacheHits, stats.mmapCalls, stats.munmapCalls, stats.evictions);
+
+bail:
+    return res;
+}
+
+static TE_rc_t pal_memmap_clean(void *pContext)
+{
+    TE_UNUSED(pContext);
+
+    (void)CC_PalMemMapDevSet(CC_PAL_MEMMAP_DEV_IMAGE, NULL);
+    if (memFileFd >= 0) {
+        close(memFileFd);
+        unlink(memFileName);
+        memFileFd = -1;
+    }
+
+    return TE_RC_SUCCESS;
+}
+
+/******************************************************************
+ * Public
+ ******************************************************************/
+
+int TE_init_pal_memmap_test(void)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+
+    TE_perfEntryInit("memmap", "map-unmap-cycle");
+
+    TE_ASSERT(TE_registerFlow("pal-memmap-test-1",
+                               "PAL memmap",
+                               "mapping cache",
+                               pal_memmap_prepare,
+                               pal_memmap_cache,
+                               NULL,
+                               pal_memmap_clean,
+                               NULL) == TE_RC_SUCCESS);
+
+bail:
+    return res;
+}
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "test_engine.h"
+#include "tests_thread.h"
+#include "cc_hash.h"
+#include "cc_pal_mutex.h"
+#include "cc_pal_error.h"
+#include "test_pal_time.h"
+#include "te_pal_mutex.h"
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+#define TE_PAL_MUTEX_HASH_OPS_PER_THREAD     1000
+#define TE_PAL_MUTEX_DATA_SIZE_IN_BYTES      64
+#define TE_PAL_MUTEX_TIMEOUT_MSEC            100
+#define TE_PAL_MUTEX_HOLD_USEC               50000
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+extern CC_PalMutex CCSymCryptoMutex;
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+static const uint32_t threadCounts[] = { 1, 2, 4, 8 };
+static const char *threadCountsStr[] = { "hash-1-thread", "hash-2-threads", "hash-4-threads", "hash-8-threads" };
+
+static uint8_t plaintext[TE_PAL_MUTEX_DATA_SIZE_IN_BYTES];
+
+/* a mutex of the test, so the library traffic does not change the expected counts */
+static CC_PalMutex testMutex;
+
+/* results of the lock attempts made by the timeout thread */
+static CCError_t noWaitRc;
+static uint32_t noWaitMsec;
+static CCError_t timedWaitRc;
+static uint32_t timedWaitMsec;
+
+/* hand-off between the holder and the waiter of the contention schedule */
+static uint32_t holderLocked;
+static uint32_t waiterStarted;
+static uint32_t holderRole = 0;
+static uint32_t waiterRole = 1;
+
+/******************************************************************
+ * Static Prototypes
+ ******************************************************************/
+
+static void *pal_mutex_hash_thread(void *pArgs);
+static void pal_mutex_dump_stats(const char *pName, CCPalMutexStats_t *pStats);
+static TE_rc_t pal_mutex_thread_scaling(void *pContext);
+static void *pal_mutex_timeout_thread(void *pArgs);
+static void *pal_mutex_contention_thread(void *pArgs);
+static TE_rc_t pal_mutex_timeout_and_contention(void *pContext);
+
+/******************************************************************
+ * Static functions
+ ******************************************************************/
+
+static void *pal_mutex_hash_thread(void *pArgs)
+{
+    CCHashResultBuf_t resBuff;
+    uint32_t i;
+
+    TE_UNUSED(pArgs);
+
+    for (i = 0; i < TE_PAL_MUTEX_HASH_OPS_PER_THREAD; i++) {
+        if (CC_Hash(CC_HASH_SHA256_mode, plaintext, sizeof(plaintext), resBuff) != CC_OK) {
+            return (void *)(uintptr_t)TE_RC_FAIL;
+        }
+    }
+
+    return NULL;
+}
+
+static void pal_mutex_dump_stats(const char *pName, CCPalMutexStats_t *pStats)
+{
+    uint32_t i;
+
+    TE_LOG_INFO("%s: acquires[%llu] contended[%llu] spin-acquired[%llu] timeouts[%llu]\n",
+                pName,
+                (unsigned long long)pStats->acquireCount,
+                (unsigned long long)pStats->contendedCount,
+                (unsigned long long)pStats->spinAcquireCount,
+                (unsigned long long)pStats->timeoutCount);
+    TE_LOG_INFO("%s: wait[sum,max]=[%llu,%llu]ns hold[sum,max]=[%llu,%llu]ns\n",
+                pName,
+                (unsigned long long)pStats->totalWaitNs,
+                (unsigned long long)pStats->maxWaitNs,
+                (unsigned long long)pStats->totalHoldNs,
+                (unsigned long long)pStats->maxHoldNs);
+
+    for (i = 0; i < CC_PAL_MUTEX_HIST_BUCKETS; i++) {
+        if ((pStats->waitHist[i] == 0) && (pStats->holdHist[i] == 0)) {
+            continue;
+        }
+        TE_LOG_INFO("%s: [2^%u ns] wait[%u] hold[%u]\n", pName, i, pStats->waitHist[i], pStats->holdHist[i]);
+    }
+}
+
+static TE_rc_t pal_mutex_thread_scaling(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    void *argsList[TESTS_MAX_CONCURRENT_THREADS] = { NULL };
+    CCPalMutexStats_t stats;
+    uint32_t i;
+
+    TE_UNUSED(pContext);
+
+    for (i = 0; i < TE_VEC_COUNT(threadCounts); i++) {
+        TE_ASSERT(CC_PalMutexStatsReset(&CCSymCryptoMutex) == CC_OK);
+
+        cookie = TE_perfOpenNewEntry("mutex", threadCountsStr[i]);
+        TE_ASSERT(Tests_RunthreadsConcurrent(threadCounts[i], pal_mutex_hash_thread, argsList) == 0);
+        TE_perfCloseEntry(cookie);
+
+        TE_ASSERT(CC_PalMutexStatsGet(&CCSymCryptoMutex, &stats) == CC_OK);
+        pal_mutex_dump_stats(threadCountsStr[i], &stats);
+    }
+
+bail:
+    return res;
+}
+
+/* Runs while the main thread holds the test mutex */
+static void *pal_mutex_timeout_thread(void *pArgs)
+{
+    uint32_t startMsec;
+
+    TE_UNUSED(pArgs);
+
+    startMsec = Test_PalGetTimestamp();
+    noWaitRc = CC_PalMutexLock(&testMutex, 0);
+    noWaitMsec = Test_PalGetTimestamp() - startMsec;
+
+    startMsec = Test_PalGetTimestamp();
+    timedWaitRc = CC_PalMutexLock(&testMutex, TE_PAL_MUTEX_TIMEOUT_MSEC);
+    timedWaitMsec = Test_PalGetTimestamp() - startMsec;
+
+    return NULL;
+}
+
+/*
+ * The holder takes the mutex before the waiter starts, and keeps it long
+ * enough for the waiter to find it taken: one plain and one contended acquire.
+ */
+static void *pal_mutex_contention_thread(void *pArgs)
+{
+    uint32_t role = *(uint32_t *)pArgs;
+
+    if (role == holderRole) {
+        if (CC_PalMutexLock(&testMutex, CC_INFINITE) != CC_OK) {
+            return (void *)(uintptr_t)TE_RC_FAIL;
+        }
+        __atomic_store_n(&holderLocked, 1, __ATOMIC_RELEASE);
+        while (__atomic_load_n(&waiterStarted, __ATOMIC_ACQUIRE) == 0) {
+            Test_PalDelay(100);
+        }
+        Test_PalDelay(TE_PAL_MUTEX_HOLD_USEC);
+    } else {
+        while (__atomic_load_n(&holderLocked, __ATOMIC_ACQUIRE) == 0) {
+            Test_PalDelay(100);
+        }
+        __atomic_store_n(&waiterStarted, 1, __ATOMIC_RELEASE);
+        if (CC_PalMutexLock(&testMutex, CC_INFINITE) != CC_OK) {
+            return (void *)(uintptr_t)TE_RC_FAIL;
+        }
+    }
+
+    if (CC_PalMutexUnlock(&testMutex) != CC_OK) {
+        return (void *)(uintptr_t)TE_RC_FAIL;
+    }
+    return NULL;
+}
+
+static TE_rc_t pal_mutex_timeout_and_contention(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    void *argsList[TESTS_MAX_CONCURRENT_THREADS] = { NULL };
+    CCPalMutexStats_t stats;
+    CCBool isCreated = CC_FALSE;
+    CCBool isLocked = CC_FALSE;
+
+    TE_UNUSED(pContext);
+
+    TE_ASSERT(CC_PalMutexCreate(&testMutex) == CC_OK);
+    isCreated = CC_TRUE;
+
+    /* a held mutex: no wait fails at once, a finite wait expires, both are counted */
+    TE_ASSERT(CC_PalMutexLock(&testMutex, CC_INFINITE) == CC_OK);
+    isLocked = CC_TRUE;
+    TE_ASSERT(Tests_RunthreadsConcurrent(1, pal_mutex_timeout_thread, argsList) == 0);
+    TE_ASSERT(CC_PalMutexUnlock(&testMutex) == CC_OK);
+    isLocked = CC_FALSE;
+
+    TE_ASSERT(noWaitRc == CC_PAL_SEM_WAIT_TIMEOUT);
+    TE_ASSERT(noWaitMsec < TE_PAL_MUTEX_TIMEOUT_MSEC);
+    TE_ASSERT(timedWaitRc == CC_PAL_SEM_WAIT_TIMEOUT);
+    TE_ASSERT(timedWaitMsec >= TE_PAL_MUTEX_TIMEOUT_MSEC - 1);
+
+    TE_ASSERT(CC_PalMutexStatsGet(&testMutex, &stats) == CC_OK);
+    pal_mutex_dump_stats("timeout", &stats);
+    TE_ASSERT(stats.acquireCount == 1);
+    TE_ASSERT(stats.contendedCount == 0);
+    TE_ASSERT(stats.timeoutCount == 2);
+
+    /* two threads, the second one finds the mutex held */
+    TE_ASSERT(CC_PalMutexStatsReset(&testMutex) == CC_OK);
+    holderLocked = 0;
+    waiterStarted = 0;
+    argsList[0] = &holderRole;
+    argsList[1] = &waiterRole;
+    TE_ASSERT(Tests_RunthreadsConcurrent(2, pal_mutex_contention_thread, argsList) == 0);
+
+    TE_ASSERT(CC_PalMutexStatsGet(&testMutex, &stats) == CC_OK);
+    pal_mutex_dump_stats("contention", &stats);
+    TE_ASSERT(stats.acquireCount == 2);
+    TE_ASSERT(stats.contendedCount == 1);
+    TE_ASSERT(stats.timeoutCount == 0);
+    TE_ASSERT(stats.maxWaitNs > 0);
+
+bail:
+    if (isLocked == CC_TRUE) {
+        CC_PalMutexUnlock(&testMutex);
+    }
+    if (isCreated == CC_TRUE) {
+        CC_PalMutexDestroy(&testMutex);
+    }
+    return res;
+}
+
+/******************************************************************
+ * Public
+ ******************************************************************/
+
+int TE_init_pal_mutex_test(void)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    uint32_t i;
+
+    for (i = 0; i < TE_VEC_COUNT(threadCounts); i++) {
+        TE_perfEntryInit("mutex", threadCountsStr[i]);
+    }
+
+    TE_ASSERT(TE_registerFlow("pal-mutex-test-1",
+                               "PAL mutex",
+                               "thread scaling",
+                               NULL,
+                               pal_mutex_thread_scaling,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("pal-mutex-test-2",
+                               "PAL mutex",
+                               "timeout, contention",
+                               NULL,
+                               pal_mutex_timeout_and_contention,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+bail:
+    return res;
+}
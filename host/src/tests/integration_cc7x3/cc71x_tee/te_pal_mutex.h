@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC71X_TEE_INTEGRATION_TE_PAL_MUTEX_H
+#define _CC71X_TEE_INTEGRATION_TE_PAL_MUTEX_H
+/*!
+  @file
+  @brief This file contains PAL mutex definitions for test usage.
+
+  This file defines:
+      <ol><li>Declarations of the PAL mutex thread-scaling integration test functions.</li></ol>
+ */
+
+/*!
+ @addtogroup pal_mutex_apis
+ @{
+ */
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+/******************************************************************
+ * Functions
+ ******************************************************************/
+
+/*!
+@brief This function allocates and initializes the PAL mutex test resources.
+
+
+@return \c zero on success.
+@return A non-zero value on failure.
+*/
+int TE_init_pal_mutex_test(void);
+
+
+/*!
+ @}
+ */
+#endif /* _CC71X_TEE_INTEGRATION_TE_PAL_MUTEX_H */
+
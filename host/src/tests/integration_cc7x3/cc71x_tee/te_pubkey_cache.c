@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "test_engine.h"
+#include "cc_pubkey_cache.h"
+#include "cc_pubkey_cache_error.h"
+#include "cc_ecpki_kg.h"
+#include "cc_ecpki_build.h"
+#include "cc_ecpki_domain.h"
+#include "cc_ecpki_error.h"
+#include "cc_dh.h"
+#include "cc_dh_error.h"
+#include "cc_dh_groups.h"
+#include "cc_rnd.h"
+#include "te_pubkey_cache.h"
+
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+#define TE_PUBKEY_CACHE_EC_DOMAIN           CC_ECPKI_DomainID_secp256r1
+#define TE_PUBKEY_CACHE_DH_GROUP            CC_DH_NAMED_GROUP_FFDHE2048
+#define TE_PUBKEY_CACHE_DH_PRV_KEY_SIZE     224
+#define TE_PUBKEY_CACHE_ENTRIES_COUNT       8
+#define TE_PUBKEY_CACHE_EC_KEY_MAX_SIZE     (2*CALC_WORDS_TO_BYTES(CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS) + 1)
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+extern CCRndState_t *pRndState_proj;
+extern CCRndGenerateVectWorkFunc_t pRndFunc_proj;
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+static CCPubKeyCache_t              pubKeyCache;
+static CCPubKeyCacheEntry_t         cacheEntries[TE_PUBKEY_CACHE_ENTRIES_COUNT];
+static CCEcpkiUserPrivKey_t         ecPrivKey;
+static CCEcpkiUserPublKey_t         ecPublKey;
+static CCEcpkiUserPublKey_t         ecBuiltPublKey;
+static CCEcpkiKgTempData_t          ecKgTempData;
+static CCEcpkiBuildTempData_t       ecBuildTempData;
+static CCDhTemp_t                   dhTempBuff;
+
+/******************************************************************
+ * Static Prototypes
+ ******************************************************************/
+
+static TE_rc_t pubkey_cache_ec(void* pContext);
+static TE_rc_t pubkey_cache_dh(void* pContext);
+
+/******************************************************************
+ * Static functions
+ ******************************************************************/
+
+/* checks the counters of the cache */
+static TE_rc_t pubkey_cache_stats_check(uint32_t expHitsCount, uint32_t expMissesCount)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    uint32_t hitsCount = 0;
+    uint32_t missesCount = 0;
+
+    TE_ASSERT(CC_PubKeyCacheStatsGet(&pubKeyCache, &hitsCount, &missesCount) == CC_OK);
+    TE_ASSERT(hitsCount == expHitsCount);
+    TE_ASSERT(missesCount == expMissesCount);
+
+bail:
+    return res;
+}
+
+static TE_rc_t pubkey_cache_ec(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    const CCEcpkiDomain_t *pDomain = CC_EcpkiGetEcDomain(TE_PUBKEY_CACHE_EC_DOMAIN);
+    uint8_t pubKeyBuff[TE_PUBKEY_CACHE_EC_KEY_MAX_SIZE];
+    size_t pubKeySize = sizeof(pubKeyBuff);
+    TE_UNUSED(pContext);
+
+    TE_ASSERT(CC_PubKeyCacheInit(&pubKeyCache, cacheEntries, TE_PUBKEY_CACHE_ENTRIES_COUNT) == CC_OK);
+
+    TE_ASSERT(CC_EcpkiKeyPairGenerate(pRndFunc_proj,
+                                      pRndState_proj,
+                                      pDomain,
+                                      &ecPrivKey,
+                                      &ecPublKey,
+                                      &ecKgTempData,
+                                      NULL) == CC_OK);
+    TE_ASSERT(CC_EcpkiPubKeyExport(&ecPublKey,
+                                   CC_EC_PointUncompressed,
+                                   pubKeyBuff,
+                                   &pubKeySize) == CC_OK);
+
+    /* the first check is fully validated, the second one is served by the cache */
+    cookie = TE_perfOpenNewEntry("pubkey_cache", "ec-miss");
+    TE_ASSERT(CC_EcpkiPubKeyBuildAndFullCheckCached(&pubKeyCache, pDomain,
+                                                    pubKeyBuff, pubKeySize,
+                                                    &ecBuiltPublKey,
+                                                    &ecBuildTempData) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(pubkey_cache_stats_check(0, 1) == TE_RC_SUCCESS);
+
+    cookie = TE_perfOpenNewEntry("pubkey_cache", "ec-hit");
+    TE_ASSERT(CC_EcpkiPubKeyBuildAndFullCheckCached(&pubKeyCache, pDomain,
+                                                    pubKeyBuff, pubKeySize,
+                                                    &ecBuiltPublKey,
+                                                    &ecBuildTempData) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(pubkey_cache_stats_check(1, 1) == TE_RC_SUCCESS);
+
+    /* a key off the curve is not recorded */
+    pubKeyBuff[pubKeySize - 1] ^= 1;
+    TE_ASSERT(CC_EcpkiPubKeyBuildAndFullCheckCached(&pubKeyCache, pDomain,
+                                                    pubKeyBuff, pubKeySize,
+                                                    &ecBuiltPublKey,
+                                                    &ecBuildTempData) != CC_OK);
+    TE_ASSERT(CC_EcpkiPubKeyBuildAndFullCheckCached(&pubKeyCache, pDomain,
+                                                    pubKeyBuff, pubKeySize,
+                                                    &ecBuiltPublKey,
+                                                    &ecBuildTempData) != CC_OK);
+    TE_ASSERT(pubkey_cache_stats_check(1, 3) == TE_RC_SUCCESS);
+    pubKeyBuff[pubKeySize - 1] ^= 1;
+
+    /* the invalidated cache validates the key again */
+    TE_ASSERT(CC_PubKeyCacheInvalidate(&pubKeyCache) == CC_OK);
+    TE_ASSERT(CC_EcpkiPubKeyBuildAndFullCheckCached(&pubKeyCache, pDomain,
+                                                    pubKeyBuff, pubKeySize,
+                                                    &ecBuiltPublKey,
+                                                    &ecBuildTempData) == CC_OK);
+    TE_ASSERT(pubkey_cache_stats_check(1, 4) == TE_RC_SUCCESS);
+
+    /* the freed cache keeps no key */
+    TE_ASSERT(CC_PubKeyCacheFree(&pubKeyCache) == CC_OK);
+    TE_ASSERT(CC_EcpkiPubKeyBuildAndFullCheckCached(&pubKeyCache, pDomain,
+                                                    pubKeyBuff, pubKeySize,
+                                                    &ecBuiltPublKey,
+                                                    &ecBuildTempData) == CC_PUBKEY_CACHE_INVALID_CACHE_ERROR);
+
+bail:
+    return res;
+}
+
+static TE_rc_t pubkey_cache_dh(void* pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    const CCDhNamedGroup_t *pGroup = CC_DhGetNamedGroup(TE_PUBKEY_CACHE_DH_GROUP);
+    uint8_t orderQ[CC_DH_MAX_MOD_SIZE_IN_BYTES];
+    uint8_t prvKey[CC_DH_MAX_MOD_SIZE_IN_BYTES];
+    uint8_t pubKey[CC_DH_MAX_MOD_SIZE_IN_BYTES];
+    size_t prvKeySize = sizeof(prvKey);
+    size_t pubKeySize = sizeof(pubKey);
+    size_t i;
+    TE_UNUSED(pContext);
+
+    TE_ASSERT(pGroup != NULL);
+    TE_ASSERT(CC_PubKeyCacheInit(&pubKeyCache, cacheEntries, TE_PUBKEY_CACHE_ENTRIES_COUNT) == CC_OK);
+
+    /* the order q = (p-1)/2 */
+    for (i = pGroup->primeSizeInBytes - 1; i > 0; i--) {
+        orderQ[i] = (uint8_t)((pGroup->pPrime[i] >> 1) | (pGroup->pPrime[i-1] << 7));
+    }
+    orderQ[0] = pGroup->pPrime[0] >> 1;
+
+    TE_ASSERT(CC_DhNamedGroupGeneratePubPrv(pRndFunc_proj,
+                                            pRndState_proj,
+                                            pGroup,
+                                            TE_PUBKEY_CACHE_DH_PRV_KEY_SIZE,
+                                            &dhTempBuff,
+                                            prvKey,
+                                            &prvKeySize,
+                                            pubKey,
+                                            &pubKeySize) == CC_OK);
+
+    cookie = TE_perfOpenNewEntry("pubkey_cache", "dh-miss");
+    TE_ASSERT(CC_DhCheckPubKeyCached(&pubKeyCache,
+                                     (uint8_t *)pGroup->pPrime, pGroup->primeSizeInBytes,
+                                     orderQ, pGroup->primeSizeInBytes,
+                                     pubKey, pubKeySize,
+                                     &dhTempBuff) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    cookie = TE_perfOpenNewEntry("pubkey_cache", "dh-hit");
+    TE_ASSERT(CC_DhCheckPubKeyCached(&pubKeyCache,
+                                     (uint8_t *)pGroup->pPrime, pGroup->primeSizeInBytes,
+                                     orderQ, pGroup->primeSizeInBytes,
+                                     pubKey, pubKeySize,
+                                     &dhTempBuff) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(pubkey_cache_stats_check(1, 1) == TE_RC_SUCCESS);
+
+    /* p-1 is not a valid public key and is never served by the cache */
+    for (i = 0; i < pGroup->primeSizeInBytes; i++) {
+        pubKey[i] = pGroup->pPrime[i];
+    }
+    pubKey[pGroup->primeSizeInBytes - 1] -= 1;
+    for (i = 0; i < 2; i++) {
+        TE_ASSERT(CC_DhCheckPubKeyCached(&pubKeyCache,
+                                         (uint8_t *)pGroup->pPrime, pGroup->primeSizeInBytes,
+                                         orderQ, pGroup->primeSizeInBytes,
+                                         pubKey, pGroup->primeSizeInBytes,
+                                         &dhTempBuff) == CC_DH_INVALID_PUBLIC_KEY_ERROR);
+    }
+    TE_ASSERT(pubkey_cache_stats_check(1, 3) == TE_RC_SUCCESS);
+
+    TE_ASSERT(CC_PubKeyCacheFree(&pubKeyCache) == CC_OK);
+    for (i = 0; i < sizeof(cacheEntries); i++) {
+        TE_ASSERT(((uint8_t *)cacheEntries)[i] == 0);
+    }
+
+bail:
+    return res;
+}
+
+/******************************************************************
+ * Public
+ ******************************************************************/
+
+int TE_init_pubkey_cache_test(void)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+
+    TE_perfEntryInit("pubkey_cache", "ec-miss");
+    TE_perfEntryInit("pubkey_cache", "ec-hit");
+    TE_perfEntryInit("pubkey_cache", "dh-miss");
+    TE_perfEntryInit("pubkey_cache", "dh-hit");
+
+    TE_ASSERT(TE_registerFlow("pubkey_cache-test-1",
+                               "public key cache",
+                               "EC full check",
+                               NULL,
+                               pubkey_cache_ec,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("pubkey_cache-test-2",
+                               "public key cache",
+                               "DH check",
+                               NULL,
+                               pubkey_cache_dh,
+                               NULL,
+                               NULL,
+                               NULL) == TE_RC_SUCCESS);
+
+bail:
+    return res;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC71X_TEE_INTEGRATION_TE_PUBKEY_CACHE_H
+#define _CC71X_TEE_INTEGRATION_TE_PUBKEY_CACHE_H
+/*!
+  @file
+  @brief This file contains validated public key cache definitions for test usage.
+
+  This file defines:
+      <ol><li>Public key cache mapping used for public key cache integration tests.</li>
+      <li>Declarations of public key cache integration test functions.</li></ol>
+ */
+
+/*!
+ @addtogroup pubkey_cache_apis
+ @{
+ */
+
+/******************************************************************
+ * Defines
+ ******************************************************************/
+
+/******************************************************************
+ * Types
+ ******************************************************************/
+
+/******************************************************************
+ * Externs
+ ******************************************************************/
+
+/******************************************************************
+ * Globals
+ ******************************************************************/
+
+/******************************************************************
+ * Functions
+ ******************************************************************/
+
+/*!
+@brief This function allocates and initializes the public key cache test resources.
+
+
+@return \c zero on success.
+@return A non-zero value on failure.
+*/
+int TE_init_pubkey_cache_test(void);
+
+
+/*!
+ @}
+ */
+#endif /* _CC71X_TEE_INTEGRATION_TE_PUBKEY_CACHE_H */
+
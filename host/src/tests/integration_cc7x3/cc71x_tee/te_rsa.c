@@ -9,6 +9,8 @@
 #include "test_engine.h"
 #include "cc_rsa_schemes.h"
 #include "cc_rsa_kg.h"
+#include "cc_rsa_build.h"
+#include "cc_rsa_error.h"
 #include "cc_rnd.h"
 #include "te_rsa.h"
 
@@ -20,6 +22,12 @@
 #define KEY_SIZE_IN_BITS                KEY_SIZE_IN_BYTES * 8
 #define RANDON_MSG_SIZE_IN_BYTES        64
 #define RSA_DEFAULT_HASH                CC_RSA_HASH_SHA256_mode
+#define TE_RSA_BATCH_SIZE               4
+#define TE_RSA_MULTI_PRIME_COUNT        3
+#define TE_RSA_KG_BENCH_COUNT           8
+#define TE_RSA_PAD_BENCH_COUNT          4
+#define TE_RSA_KEY_STORE_COUNT          4
+#define TE_RSA_KEY_STORE_MAC_KEY_SIZE   32
 
 /******************************************************************
  * Types
@@ -56,12 +64,146 @@ static teRsaVector_t encryptDecryptVer21 = {
                                     .version = CC_PKCS1_VER21,
 };
 
+static teRsaVector_t verifyBatchVer21 = {
+                                    .version = CC_PKCS1_VER21,
+};
+
+static teRsaVector_t signVerifyMultiPrimeVer21 = {
+                                    .version = CC_PKCS1_VER21,
+};
+
+static teRsaVector_t keyGenBenchVer21 = {
+                                    .version = CC_PKCS1_VER21,
+};
+
+static teRsaVector_t padBenchVer21 = {
+                                    .version = CC_PKCS1_VER21,
+};
+
+static teRsaVector_t keyStoreVer21 = {
+                                    .version = CC_PKCS1_VER21,
+};
+
+static const uint32_t padBenchKeySizes[] = { 3072, 4096 };
+static const char *padBenchEntries[][4] = {
+    { "pss-sign-3072", "pss-verify-3072", "oaep-encrypt-3072", "oaep-decrypt-3072" },
+    { "pss-sign-4096", "pss-verify-4096", "oaep-encrypt-4096", "oaep-decrypt-4096" }
+};
+
+static const uint32_t multiPrimeBenchKeySizes[] = { 2048, 3072, 4096 };
+static const char *multiPrimeBenchEntries[][2] = {
+    { "sign-2-primes-2048", "sign-3-primes-2048" },
+    { "sign-2-primes-3072", "sign-3-primes-3072" },
+    { "sign-2-primes-4096", "sign-3-primes-4096" }
+};
+
+/* 2048 bits key of three primes (RFC 8017 multi-prime), e = 65537 */
+static uint8_t multiPrimeKeyN[] = {
+    0xd4, 0x93, 0xbb, 0x10, 0x13, 0x56, 0xda, 0x94, 0x6c, 0xdd, 0x72, 0x77, 0x2d, 0x2a, 0x4a, 0xa2,
+    0xcf, 0x5e, 0xb7, 0xa8, 0x0c, 0xf6, 0xc0, 0x7e, 0x1f, 0xe4, 0xc8, 0x31, 0x71, 0xee, 0xaf, 0xeb,
+    0xd8, 0x5c, 0x41, 0x7d, 0x70, 0xa2, 0x07, 0x02, 0xb1, 0x7b, 0x77, 0x03, 0xfd, 0x9b, 0x7c, 0x29,
+    0x9b, 0xe8, 0xfd, 0x9f, 0x18, 0x10, 0x90, 0x6e, 0x97, 0xfe, 0xda, 0xf4, 0xf7, 0xcc, 0xc7, 0x0d,
+    0xf9, 0x62, 0x90, 0x6e, 0x38, 0x1c, 0xb6, 0x90, 0x52, 0x5d, 0x80, 0xc7, 0x07, 0x8d, 0x7c, 0x58,
+    0x6d, 0x34, 0x41, 0x72, 0x34, 0x88, 0xc2, 0x53, 0x01, 0xdb, 0xe7, 0xe4, 0x62, 0x1e, 0xb4, 0x86,
+    0x31, 0x06, 0x14, 0x57, 0x2a, 0x2f, 0x21, 0x8d, 0x5d, 0x0f, 0x5f, 0x13, 0x9a, 0x35, 0x7f, 0xa1,
+    0x0a, 0xec, 0x42, 0x13, 0x69, 0x72, 0xc3, 0x81, 0xd8, 0xdc, 0x58, 0xe1, 0x32, 0x87, 0xd2, 0x45,
+    0x67, 0xc5, 0x12, 0xab, 0xbb, 0xe2, 0x2d, 0xbe, 0x9a, 0x6b, 0x86, 0x53, 0x71, 0xdd, 0x3a, 0x88,
+    0xf7, 0xf6, 0xb7, 0xcd, 0x59, 0x46, 0xff, 0x8c, 0x14, 0x89, 0x53, 0xc1, 0xf3, 0xe2, 0x90, 0xb6,
+    0xdf, 0xc2, 0xaa, 0x5d, 0xc1, 0x16, 0x24, 0xc7, 0xb1, 0x7d, 0x07, 0x92, 0xb2, 0x3b, 0xf2, 0x13,
+    0x85, 0x31, 0xea, 0xe2, 0x15, 0x13, 0x16, 0xd9, 0xc4, 0xc8, 0xc9, 0xdf, 0x29, 0x04, 0xfc, 0xa7,
+    0xb3, 0x0a, 0xfe, 0xc8, 0x2d, 0x84, 0x4e, 0x13, 0x20, 0x53, 0x43, 0xd5, 0xf4, 0x4a, 0xa5, 0xac,
+    0xcd, 0xd3, 0xac, 0x87, 0xf1, 0x3c, 0xdf, 0xe1, 0x2e, 0x39, 0xf1, 0xfe, 0xb9, 0x16, 0xc1, 0x2f,
+    0x30, 0xfd, 0xa9, 0x24, 0xcd, 0x49, 0xf5, 0xcf, 0x1e, 0x36, 0x3f, 0xb9, 0x3d, 0x74, 0x7e, 0x04,
+    0xbb, 0xfa, 0x4a, 0x7a, 0xdb, 0x7a, 0x55, 0x4c, 0x52, 0xbf, 0x3c, 0xe2, 0x34, 0x94, 0x07, 0x67 };
+static uint8_t multiPrimeKeyD[] = {
+    0x0d, 0x73, 0x87, 0xab, 0xbd, 0xbd, 0x8a, 0x39, 0x48, 0x26, 0x3f, 0x1f, 0x01, 0x71, 0xa2, 0xa5,
+    0x68, 0xbf, 0xd2, 0x99, 0x44, 0xb0, 0xbc, 0x7f, 0x7e, 0x9f, 0x28, 0x77, 0xd0, 0x80, 0xcd, 0x0a,
+    0xfc, 0x76, 0xe2, 0x02, 0x01, 0x05, 0x8f, 0xb2, 0x00, 0xef, 0x12, 0x19, 0xe3, 0x8b, 0x5a, 0x30,
+    0xfb, 0xd7, 0xa3, 0x6c, 0xd4, 0xc5, 0xff, 0x8d, 0xaf, 0xfa, 0x85, 0x7a, 0x68, 0xcf, 0xc1, 0x6c,
+    0xc5, 0xf2, 0x11, 0xb7, 0x97, 0xbf, 0x61, 0x62, 0x02, 0x84, 0x3e, 0x28, 0xd9, 0xf6, 0x7e, 0xfe,
+    0xcd, 0x72, 0x38, 0x0d, 0xd8, 0x03, 0x96, 0xaa, 0x5d, 0x37, 0x86, 0x32, 0xf4, 0xdb, 0xb1, 0x1e,
+    0xac, 0x38, 0xb6, 0x33, 0x8d, 0x07, 0x01, 0x87, 0x41, 0x2f, 0x1d, 0x8e, 0xa7, 0x3b, 0x6b, 0xc0,
+    0x90, 0x2b, 0xd3, 0xa1, 0x2b, 0xd4, 0x01, 0x68, 0x69, 0xf3, 0x10, 0xc7, 0xe8, 0x4d, 0xb6, 0xc8,
+    0x18, 0xba, 0x5d, 0x00, 0xad, 0x85, 0xa7, 0xc7, 0x4d, 0x26, 0xf4, 0xcc, 0x9c, 0x10, 0xd2, 0x35,
+    0x11, 0x39, 0xe3, 0xbe, 0x33, 0x36, 0x2f, 0x00, 0x5b, 0x55, 0xa1, 0x28, 0x5a, 0x4a, 0xb0, 0x4d,
+    0x42, 0xad, 0x77, 0x07, 0xe5, 0x4a, 0x49, 0x1f, 0xa1, 0x3b, 0x40, 0x3f, 0xea, 0x3f, 0xf0, 0x0d,
+    0xcd, 0xf8, 0x93, 0x78, 0x51, 0x22, 0x5b, 0xa6, 0x34, 0xe3, 0xbc, 0x29, 0x6a, 0x3b, 0x35, 0x60,
+    0xa7, 0x96, 0x27, 0xc4, 0xc2, 0xdc, 0xe5, 0x5a, 0x83, 0x8d, 0xaa, 0x2e, 0x47, 0x88, 0x84, 0x54,
+    0xb4, 0x35, 0xec, 0x51, 0xc5, 0x2e, 0x0f, 0xa5, 0xba, 0x22, 0xbd, 0x4f, 0xd2, 0xf0, 0x64, 0x88,
+    0x6e, 0xf8, 0xb5, 0xfd, 0x7a, 0x73, 0x4d, 0x2b, 0x65, 0xce, 0x2e, 0xa3, 0x11, 0x79, 0xde, 0x76,
+    0x65, 0x44, 0x30, 0xf8, 0xfc, 0xf8, 0xb0, 0x7c, 0x80, 0xfe, 0x36, 0x51, 0x8e, 0x56, 0xd8, 0x81 };
+static uint8_t multiPrimeKeyP[] = {
+    0xf6, 0x65, 0xb9, 0xba, 0x0f, 0xf6, 0x6d, 0x66, 0xe0, 0x38, 0xd0, 0xb8, 0xc4, 0x3f, 0x49, 0xa6,
+    0xa9, 0xe2, 0x9c, 0xa1, 0x95, 0xe8, 0xa8, 0x6b, 0x66, 0xb3, 0x4d, 0xe4, 0xb2, 0xd3, 0x01, 0x91,
+    0x9f, 0x6b, 0x09, 0x7d, 0x55, 0xe3, 0x2f, 0xc5, 0x31, 0x83, 0xc1, 0x21, 0x2c, 0x01, 0x7f, 0x62,
+    0x6a, 0x65, 0x3c, 0xc7, 0x99, 0xc7, 0x2c, 0x5e, 0x4a, 0xb4, 0x79, 0xf9, 0xa2, 0xa1, 0x51, 0x09,
+    0x1b, 0xf1, 0x67, 0x3e, 0x1a, 0xe4, 0x05, 0x38, 0x86, 0xd6, 0x39, 0x3b, 0x56, 0x94, 0xbe, 0xce,
+    0x19, 0xda, 0x6f, 0xae, 0xa3, 0x96, 0x31, 0x37 };
+static uint8_t multiPrimeKeyQ[] = {
+    0xf1, 0x39, 0xb8, 0x02, 0x1b, 0x24, 0xd5, 0x64, 0x5a, 0x67, 0x43, 0xf5, 0x72, 0x5f, 0x73, 0xd7,
+    0x4a, 0xd3, 0x1b, 0x76, 0xdd, 0x7e, 0x7a, 0x6e, 0xd4, 0xa4, 0xc8, 0x63, 0xdf, 0xc8, 0xc9, 0x2d,
+    0x22, 0x80, 0x95, 0x59, 0x86, 0x70, 0x33, 0x03, 0x91, 0xf0, 0x7c, 0x85, 0x7b, 0x0b, 0xc3, 0xd2,
+    0xd2, 0x0f, 0x57, 0x88, 0x2c, 0xa9, 0xcd, 0xd6, 0x6b, 0x2c, 0x6b, 0xa3, 0x1c, 0xd0, 0x8d, 0x33,
+    0x87, 0xfc, 0xfd, 0xfd, 0x34, 0xea, 0xa2, 0xd7, 0x2c, 0xee, 0xbb, 0x0b, 0xea, 0x5a, 0x8e, 0x16,
+    0x9e, 0x7d, 0x0d, 0xa9 };
+static uint8_t multiPrimeKeyDP[] = {
+    0xd1, 0x48, 0x2c, 0x0d, 0x86, 0x9b, 0x67, 0xe7, 0x16, 0x92, 0x0b, 0x6e, 0xb4, 0x79, 0x90, 0xe4,
+    0x37, 0xad, 0xdc, 0x1e, 0x3f, 0x47, 0x23, 0x2e, 0x3e, 0x48, 0x13, 0xe4, 0x29, 0xa3, 0xa1, 0xd4,
+    0x7f, 0x94, 0x99, 0xb5, 0xd4, 0x6a, 0xa8, 0x5b, 0x94, 0xa7, 0xf5, 0x35, 0x68, 0xbc, 0x48, 0xe7,
+    0x5d, 0xb9, 0x69, 0x7b, 0x9b, 0xf9, 0x19, 0x8d, 0x69, 0x64, 0x8b, 0xa9, 0xe6, 0x61, 0xa0, 0x83,
+    0xdd, 0x31, 0x18, 0xe1, 0x1e, 0x54, 0x08, 0xbf, 0x2f, 0x7f, 0xeb, 0x92, 0xa4, 0x02, 0xa9, 0x62,
+    0x43, 0x81, 0x4e, 0x95, 0x06, 0x2b, 0x7e, 0xd7 };
+static uint8_t multiPrimeKeyDQ[] = {
+    0x12, 0x0d, 0xd8, 0xd8, 0xc7, 0x81, 0x4d, 0x3b, 0x52, 0x8c, 0xd2, 0x08, 0x47, 0xc4, 0x1f, 0x1e,
+    0x68, 0xea, 0x3d, 0xee, 0xfa, 0x8a, 0xe1, 0xcc, 0xf3, 0xbb, 0x55, 0x88, 0x2c, 0x12, 0x92, 0x03,
+    0xff, 0xc6, 0x11, 0xe7, 0x7e, 0x69, 0x5d, 0x58, 0x12, 0x0f, 0x26, 0xb2, 0xb2, 0xcf, 0xe1, 0x9b,
+    0x20, 0xbf, 0xa7, 0x34, 0x78, 0xeb, 0x48, 0x8d, 0x98, 0xbd, 0xdd, 0x5c, 0x7a, 0xe6, 0x9c, 0xfa,
+    0xd3, 0x5d, 0xbb, 0x00, 0xbd, 0x7a, 0x26, 0x2f, 0xe6, 0x9c, 0x03, 0x81, 0xd3, 0xcb, 0x6d, 0x41,
+    0x02, 0x21, 0xa7, 0xe9 };
+static uint8_t multiPrimeKeyQInv[] = {
+    0xf5, 0x20, 0x80, 0x52, 0x41, 0xd7, 0xbc, 0x96, 0xe2, 0x90, 0xac, 0x9b, 0xfe, 0xb6, 0x78, 0x09,
+    0x04, 0x8a, 0xfb, 0x33, 0xb3, 0xd3, 0xd9, 0x7c, 0x1b, 0xc5, 0x0d, 0x02, 0x4c, 0xcd, 0xeb, 0x90,
+    0x55, 0x82, 0xeb, 0x56, 0x60, 0xae, 0x54, 0xe7, 0x28, 0x63, 0xe2, 0xd5, 0x7f, 0x19, 0x35, 0xaa,
+    0x89, 0x58, 0xc4, 0xa0, 0x27, 0xe1, 0x2b, 0x44, 0xf6, 0xed, 0xe4, 0xcd, 0x27, 0x59, 0x98, 0xb8,
+    0xe5, 0x2a, 0x8f, 0x30, 0xf9, 0x57, 0x80, 0xbb, 0xca, 0x54, 0x01, 0xad, 0x24, 0xdb, 0x8c, 0x65,
+    0x52, 0x8e, 0x58, 0x92, 0x2f, 0x4f, 0x6c, 0x45 };
+static uint8_t multiPrimeKeyR[] = {
+    0xea, 0x63, 0x92, 0x97, 0x4d, 0x69, 0x86, 0xab, 0xc3, 0x1f, 0xcd, 0x2c, 0xaf, 0x88, 0xdf, 0x43,
+    0x32, 0xb1, 0x0a, 0x4a, 0xe3, 0xad, 0x71, 0xff, 0xfa, 0x83, 0x82, 0xab, 0x45, 0xb9, 0x7e, 0xb4,
+    0xc5, 0xeb, 0x74, 0x79, 0x2c, 0x38, 0xc6, 0xb2, 0x57, 0x21, 0x1b, 0xc5, 0x5d, 0x67, 0xa2, 0xa6,
+    0x30, 0xf2, 0x5c, 0x35, 0x20, 0xb0, 0x1a, 0xed, 0xf1, 0x48, 0xa4, 0x26, 0x4e, 0x35, 0xed, 0x99,
+    0x97, 0x9e, 0x2b, 0x97, 0x03, 0x83, 0xc2, 0xea, 0x67, 0x45, 0xb0, 0xe6, 0x1d, 0x0a, 0x8e, 0x5b,
+    0xbc, 0x15, 0xf1, 0x69 };
+static uint8_t multiPrimeKeyDR[] = {
+    0xd4, 0x9a, 0xd9, 0x3f, 0x30, 0xd2, 0xc5, 0x7b, 0x4b, 0x94, 0xaf, 0x11, 0x17, 0x6f, 0xf9, 0xc4,
+    0x04, 0x59, 0x1e, 0x52, 0xeb, 0xce, 0x4a, 0x17, 0xbc, 0xee, 0x49, 0x3a, 0x7e, 0x16, 0x51, 0xde,
+    0x3b, 0xa0, 0xe5, 0x97, 0x7c, 0x0b, 0x4c, 0x00, 0x3c, 0x94, 0x25, 0x92, 0x92, 0xb5, 0x0c, 0x8d,
+    0xde, 0xdc, 0x17, 0xd3, 0x81, 0x00, 0xfc, 0x8c, 0x54, 0x4e, 0x65, 0xc6, 0xf1, 0x2e, 0x6d, 0x84,
+    0xe2, 0x48, 0x70, 0x95, 0x9c, 0x74, 0x89, 0xfb, 0x01, 0x0d, 0xef, 0xf5, 0xea, 0xe5, 0xc6, 0x57,
+    0x63, 0x76, 0x2b, 0xf1 };
+static uint8_t multiPrimeKeyTR[] = {
+    0x3e, 0x7f, 0xf6, 0x19, 0xd8, 0xad, 0xa0, 0x22, 0x3f, 0xd7, 0x42, 0x63, 0x81, 0x14, 0xcb, 0x0d,
+    0xd9, 0xf0, 0xe3, 0x68, 0x21, 0x16, 0x34, 0x87, 0x51, 0x30, 0x74, 0xa7, 0x96, 0x91, 0xd6, 0x5d,
+    0xe3, 0x73, 0x1e, 0xaa, 0xb5, 0x73, 0x89, 0xfa, 0xf0, 0xa1, 0xfa, 0xdd, 0xb2, 0x95, 0x38, 0xd3,
+    0x5a, 0x46, 0xbd, 0xf6, 0x99, 0x49, 0xf7, 0xc1, 0x17, 0x86, 0x73, 0x61, 0xe1, 0xef, 0x06, 0xe6,
+    0x06, 0x6a, 0xc6, 0x24, 0x23, 0x11, 0x19, 0x3c, 0xa2, 0xc2, 0x43, 0x29, 0x68, 0x29, 0x19, 0xbc,
+    0x14, 0xe9, 0x4a, 0x7d };
+
+static uint8_t keyStoreBlob[CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES];
+static uint8_t keyStoreBadBlob[CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES];
+static CCRsaUserPrivKey_t keyStoreKeys[TE_RSA_KEY_STORE_COUNT];
+
 /******************************************************************
  * Static Prototypes
  ******************************************************************/
 
 TE_rc_t rsa_encrypt_decrypt(void *pContext);
 TE_rc_t rsa_sign_verify(void *pContext);
+TE_rc_t rsa_verify_batch(void *pContext);
+TE_rc_t rsa_multi_prime_sign_verify(void *pContext);
+TE_rc_t rsa_key_gen_bench(void *pContext);
+TE_rc_t rsa_pss_oaep_bench(void *pContext);
+TE_rc_t rsa_priv_key_store(void *pContext);
 
 
 
@@ -188,6 +330,439 @@ TE_rc_t rsa_encrypt_decrypt(void *pContext)
     /*-------------------------------------------*/
     TE_ASSERT(memcmp(msgIn, decBuff, decBuffSize) == 0);
 
+bail:
+    return res;
+}
+TE_rc_t rsa_verify_batch(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    CCRsaKgData_t KeyGenData;
+    CCRsaUserPrivKey_t userPrivateKey;
+    CCRsaUserPubKey_t userPublicKey;
+    CCRsaPrivUserContext_t privUserContext;
+    CCRsaPubUserContext_t publUserContext;
+    CCRsaVerifyBatchItem_t items[TE_RSA_BATCH_SIZE];
+    uint8_t sigBuff[TE_RSA_BATCH_SIZE][KEY_SIZE_IN_BYTES];
+    uint8_t pubExp65537[] = { 0x01, 0x00, 0x01 };
+    uint8_t msgIn[TE_RSA_BATCH_SIZE][RANDON_MSG_SIZE_IN_BYTES];
+    size_t sigBuffSize;
+    CCPkcs1Version_t version = 0;
+    CCPkcs1Mgf_t mgf = 0;
+    uint32_t i;
+
+    if (pContext == NULL) {
+        TE_LOG_ERROR("Invalid Params! (pContext == NULL)");
+        res = TE_RC_FAIL;
+        goto bail;
+    }
+
+    version = ((teRsaVector_t *) pContext)->version;
+    mgf = (version == CC_PKCS1_VER15 ? CC_PKCS1_NO_MGF : CC_PKCS1_MGF1);
+
+    /* Generates public and private key, with the short public exponent */
+    /*------------------------------------------------------------------*/
+    TE_ASSERT(CC_RsaKgKeyPairGenerate(pRndFunc_proj,
+                                      pRndState_proj, pubExp65537,
+                                      sizeof(pubExp65537), KEY_SIZE_IN_BITS,
+                                      &userPrivateKey, &userPublicKey,
+                                      &KeyGenData, NULL) == CC_OK);
+
+    /* Signing the messages of the batch */
+    /*-----------------------------------*/
+    for (i = 0; i < TE_RSA_BATCH_SIZE; i++) {
+        TE_ASSERT(CC_RndGenerateVector(pRndState_proj,
+                                       msgIn[i], RANDON_MSG_SIZE_IN_BYTES) == CC_OK);
+        sigBuffSize = sizeof(sigBuff[i]);
+        TE_ASSERT(CC_RsaSign(pRndFunc_proj,
+                             pRndState_proj, &privUserContext,
+                             &userPrivateKey, RSA_DEFAULT_HASH,
+                             mgf, 0, msgIn[i], sizeof(msgIn[i]), sigBuff[i],
+                             &sigBuffSize, version) == CC_OK);
+
+        items[i].pUserPubKey = &userPublicKey;
+        items[i].pDataIn = msgIn[i];
+        items[i].dataInSize = sizeof(msgIn[i]);
+        items[i].pSig = sigBuff[i];
+        items[i].result = CC_OK;
+    }
+
+    /* Verifying the batch */
+    /*---------------------*/
+    cookie = TE_perfOpenNewEntry("rsa", "verify-batch");
+    TE_ASSERT(CC_RsaVerifyBatch(&publUserContext, RSA_DEFAULT_HASH, mgf, 0, version,
+                                items, TE_RSA_BATCH_SIZE) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    /* A corrupted message fails only its own item */
+    /*---------------------------------------------*/
+    msgIn[1][0] ^= 0x01;
+    TE_ASSERT(CC_RsaVerifyBatch(&publUserContext, RSA_DEFAULT_HASH, mgf, 0, version,
+                                items, TE_RSA_BATCH_SIZE) == CC_RSA_ERROR_VER15_INCONSISTENT_VERIFY);
+    for (i = 0; i < TE_RSA_BATCH_SIZE; i++) {
+        TE_ASSERT((items[i].result == CC_OK) == (i != 1));
+    }
+
+bail:
+    return res;
+}
+
+TE_rc_t rsa_multi_prime_sign_verify(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    CCRsaKgData_t KeyGenData;
+    CCRsaUserPrivKey_t userPrivateKey;
+    CCRsaUserPubKey_t userPublicKey;
+    CCRsaPrivUserContext_t privUserContext;
+    CCRsaPubUserContext_t publUserContext;
+    uint8_t sigBuff[CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS * sizeof(uint32_t)];
+    uint8_t pubExp65537[] = { 0x01, 0x00, 0x01 };
+    uint8_t msgIn[RANDON_MSG_SIZE_IN_BYTES];
+    size_t sigBuffSize = sizeof(sigBuff);
+    CCPkcs1Version_t version = 0;
+    CCPkcs1Mgf_t mgf = 0;
+    CCRsaOtherPrimeInfo_t otherPrime;
+    CCError_t rc;
+    uint32_t primesCount;
+    uint32_t i, j;
+
+    if (pContext == NULL) {
+        TE_LOG_ERROR("Invalid Params! (pContext == NULL)");
+        res = TE_RC_FAIL;
+        goto bail;
+    }
+
+    version = ((teRsaVector_t *) pContext)->version;
+    mgf = (version == CC_PKCS1_VER15 ? CC_PKCS1_NO_MGF : CC_PKCS1_MGF1);
+
+    TE_ASSERT(CC_RndGenerateVector(pRndState_proj,
+                                   msgIn, RANDON_MSG_SIZE_IN_BYTES) == CC_OK);
+
+    /* Same key size and message with two and three primes, so the sign entries pair up */
+    /*-----------------------------------------------------------------------------------*/
+    for (i = 0; i < TE_VEC_COUNT(multiPrimeBenchKeySizes); i++) {
+        for (j = 0; j < TE_VEC_COUNT(multiPrimeBenchEntries[i]); j++) {
+            primesCount = j + 2;
+
+            cookie = (primesCount == TE_RSA_MULTI_PRIME_COUNT) ?
+                     TE_perfOpenNewEntry("rsa", "multi-prime-key-pair-generate") : 0;
+            TE_ASSERT(CC_RsaKgKeyPairMultiPrimeGenerate(pRndFunc_proj,
+                                                        pRndState_proj, pubExp65537,
+                                                        sizeof(pubExp65537),
+                                                        multiPrimeBenchKeySizes[i],
+                                                        primesCount,
+                                                        &userPrivateKey, &userPublicKey,
+                                                        &KeyGenData) == CC_OK);
+            if (primesCount == TE_RSA_MULTI_PRIME_COUNT) {
+                TE_perfCloseEntry(cookie);
+            }
+
+            sigBuffSize = sizeof(sigBuff);
+            cookie = TE_perfOpenNewEntry("rsa", multiPrimeBenchEntries[i][j]);
+            TE_ASSERT(CC_RsaSign(pRndFunc_proj,
+                                 pRndState_proj, &privUserContext,
+                                 &userPrivateKey, RSA_DEFAULT_HASH,
+                                 mgf, 0, msgIn, sizeof(msgIn), sigBuff,
+                                 &sigBuffSize, version) == CC_OK);
+            TE_perfCloseEntry(cookie);
+
+            TE_ASSERT(CC_RsaVerify(&publUserContext, &userPublicKey,
+                                   RSA_DEFAULT_HASH, mgf, 0, msgIn,
+                                   sizeof(msgIn), sigBuff, version) == CC_OK);
+        }
+    }
+
+    /* A key built from its components is checked against N and d */
+    /*-------------------------------------------------------------*/
+    otherPrime.pPrime = multiPrimeKeyR;
+    otherPrime.primeSize = sizeof(multiPrimeKeyR);
+    otherPrime.pExp = multiPrimeKeyDR;
+    otherPrime.expSize = sizeof(multiPrimeKeyDR);
+    otherPrime.pCoeff = multiPrimeKeyTR;
+    otherPrime.coeffSize = sizeof(multiPrimeKeyTR);
+    TE_ASSERT(CC_RsaPrivKeyMultiPrimeCrtBuild(&userPrivateKey,
+                                              multiPrimeKeyP, sizeof(multiPrimeKeyP),
+                                              multiPrimeKeyQ, sizeof(multiPrimeKeyQ),
+                                              multiPrimeKeyDP, sizeof(multiPrimeKeyDP),
+                                              multiPrimeKeyDQ, sizeof(multiPrimeKeyDQ),
+                                              multiPrimeKeyQInv, sizeof(multiPrimeKeyQInv),
+                                              multiPrimeKeyN, sizeof(multiPrimeKeyN),
+                                              multiPrimeKeyD, sizeof(multiPrimeKeyD),
+                                              &otherPrime, 1) == CC_OK);
+    TE_ASSERT(CC_RsaPubKeyBuild(&userPublicKey, pubExp65537, sizeof(pubExp65537),
+                                multiPrimeKeyN, sizeof(multiPrimeKeyN)) == CC_OK);
+
+    sigBuffSize = sizeof(sigBuff);
+    TE_ASSERT(CC_RsaSign(pRndFunc_proj,
+                         pRndState_proj, &privUserContext,
+                         &userPrivateKey, RSA_DEFAULT_HASH,
+                         mgf, 0, msgIn, sizeof(msgIn), sigBuff,
+                         &sigBuffSize, version) == CC_OK);
+    TE_ASSERT(CC_RsaVerify(&publUserContext, &userPublicKey,
+                           RSA_DEFAULT_HASH, mgf, 0, msgIn,
+                           sizeof(msgIn), sigBuff, version) == CC_OK);
+
+    multiPrimeKeyTR[sizeof(multiPrimeKeyTR) - 1] ^= 0x01;
+    rc = CC_RsaPrivKeyMultiPrimeCrtBuild(&userPrivateKey,
+                                         multiPrimeKeyP, sizeof(multiPrimeKeyP),
+                                         multiPrimeKeyQ, sizeof(multiPrimeKeyQ),
+                                         multiPrimeKeyDP, sizeof(multiPrimeKeyDP),
+                                         multiPrimeKeyDQ, sizeof(multiPrimeKeyDQ),
+                                         multiPrimeKeyQInv, sizeof(multiPrimeKeyQInv),
+                                         multiPrimeKeyN, sizeof(multiPrimeKeyN),
+                                         multiPrimeKeyD, sizeof(multiPrimeKeyD),
+                                         &otherPrime, 1);
+    multiPrimeKeyTR[sizeof(multiPrimeKeyTR) - 1] ^= 0x01;
+    TE_ASSERT(rc == CC_RSA_INCONSISTENT_CRT_PARAMS_ERROR);
+    TE_ASSERT(userPrivateKey.valid_tag == 0);
+
+    /* More primes than supported are rejected */
+    /*-----------------------------------------*/
+    TE_ASSERT(CC_RsaKgKeyPairMultiPrimeGenerate(pRndFunc_proj,
+                                                pRndState_proj, pubExp65537,
+                                                sizeof(pubExp65537), KEY_SIZE_IN_BITS,
+                                                CC_RSA_MAX_PRIMES_COUNT + 1,
+                                                &userPrivateKey, &userPublicKey,
+                                                &KeyGenData) == CC_RSA_INVALID_PRIMES_COUNT_ERROR);
+
+bail:
+    return res;
+}
+
+TE_rc_t rsa_key_gen_bench(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    CCRsaKgData_t KeyGenData;
+    CCRsaUserPrivKey_t userPrivateKey;
+    CCRsaUserPubKey_t userPublicKey;
+    uint8_t pubExp65537[] = { 0x01, 0x00, 0x01 };
+    uint32_t i;
+
+    if (pContext == NULL) {
+        TE_LOG_ERROR("Invalid Params! (pContext == NULL)");
+        res = TE_RC_FAIL;
+        goto bail;
+    }
+
+    /* Each key is a separate entry, so min/avg/max show the spread of the prime search */
+    /*----------------------------------------------------------------------------------*/
+    for (i = 0; i < TE_RSA_KG_BENCH_COUNT; i++) {
+        cookie = TE_perfOpenNewEntry("rsa", "key-pair-generate-crt-2048");
+        TE_ASSERT(CC_RsaKgKeyPairCrtGenerate(pRndFunc_proj, pRndState_proj,
+                                             pubExp65537, sizeof(pubExp65537), 2048,
+                                             &userPrivateKey, &userPublicKey,
+                                             &KeyGenData, NULL) == CC_OK);
+        TE_perfCloseEntry(cookie);
+    }
+
+    for (i = 0; i < TE_RSA_KG_BENCH_COUNT; i++) {
+        cookie = TE_perfOpenNewEntry("rsa", "key-pair-generate-crt-3072");
+        TE_ASSERT(CC_RsaKgKeyPairCrtGenerate(pRndFunc_proj, pRndState_proj,
+                                             pubExp65537, sizeof(pubExp65537), 3072,
+                                             &userPrivateKey, &userPublicKey,
+                                             &KeyGenData, NULL) == CC_OK);
+        TE_perfCloseEntry(cookie);
+    }
+
+bail:
+    return res;
+}
+
+TE_rc_t rsa_pss_oaep_bench(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    CCRsaKgData_t KeyGenData;
+    CCRsaUserPrivKey_t userPrivateKey;
+    CCRsaUserPubKey_t userPublicKey;
+    CCRsaPrivUserContext_t privUserContext;
+    CCRsaPubUserContext_t publUserContext;
+    CCRsaPrimeData_t primeData;
+    uint8_t pubExp65537[] = { 0x01, 0x00, 0x01 };
+    uint8_t msgIn[RANDON_MSG_SIZE_IN_BYTES];
+    uint8_t sigBuff[CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS * sizeof(uint32_t)];
+    uint8_t decBuff[CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS * sizeof(uint32_t)];
+    size_t sigBuffSize, decBuffSize;
+    CCPkcs1Version_t version = 0;
+    uint32_t i, j;
+
+    if (pContext == NULL) {
+        TE_LOG_ERROR("Invalid Params! (pContext == NULL)");
+        res = TE_RC_FAIL;
+        goto bail;
+    }
+
+    version = ((teRsaVector_t *) pContext)->version;
+
+    TE_ASSERT(CC_RndGenerateVector(pRndState_proj,
+                                   msgIn, RANDON_MSG_SIZE_IN_BYTES) == CC_OK);
+
+    for (i = 0; i < TE_VEC_COUNT(padBenchKeySizes); i++) {
+        TE_ASSERT(CC_RsaKgKeyPairCrtGenerate(pRndFunc_proj, pRndState_proj,
+                                             pubExp65537, sizeof(pubExp65537), padBenchKeySizes[i],
+                                             &userPrivateKey, &userPublicKey,
+                                             &KeyGenData, NULL) == CC_OK);
+
+        /* PSS sign and verify: the MGF1 mask covers the whole encoded message */
+        /*---------------------------------------------------------------------*/
+        for (j = 0; j < TE_RSA_PAD_BENCH_COUNT; j++) {
+            sigBuffSize = sizeof(sigBuff);
+            cookie = TE_perfOpenNewEntry("rsa", padBenchEntries[i][0]);
+            TE_ASSERT(CC_RsaSign(pRndFunc_proj, pRndState_proj, &privUserContext,
+                                 &userPrivateKey, RSA_DEFAULT_HASH,
+                                 CC_PKCS1_MGF1, 32, msgIn, sizeof(msgIn), sigBuff,
+                                 &sigBuffSize, version) == CC_OK);
+            TE_perfCloseEntry(cookie);
+
+            cookie = TE_perfOpenNewEntry("rsa", padBenchEntries[i][1]);
+            TE_ASSERT(CC_RsaVerify(&publUserContext, &userPublicKey,
+                                   RSA_DEFAULT_HASH, CC_PKCS1_MGF1, 32, msgIn,
+                                   sizeof(msgIn), sigBuff, version) == CC_OK);
+            TE_perfCloseEntry(cookie);
+        }
+
+        /* OAEP encrypt and decrypt */
+        /*--------------------------*/
+        for (j = 0; j < TE_RSA_PAD_BENCH_COUNT; j++) {
+            cookie = TE_perfOpenNewEntry("rsa", padBenchEntries[i][2]);
+            TE_ASSERT(CC_RsaSchemesEncrypt(pRndFunc_proj, pRndState_proj, &userPublicKey, &primeData,
+                                           RSA_DEFAULT_HASH, NULL, 0, CC_PKCS1_MGF1, msgIn, sizeof(msgIn),
+                                           sigBuff, version) == CC_OK);
+            TE_perfCloseEntry(cookie);
+
+            decBuffSize = sizeof(decBuff);
+            cookie = TE_perfOpenNewEntry("rsa", padBenchEntries[i][3]);
+            TE_ASSERT(CC_RsaSchemesDecrypt(&userPrivateKey, &primeData, RSA_DEFAULT_HASH, NULL, 0,
+                                           CC_PKCS1_MGF1, sigBuff, padBenchKeySizes[i] / 8,
+                                           decBuff, &decBuffSize, version) == CC_OK);
+            TE_perfCloseEntry(cookie);
+            TE_ASSERT(decBuffSize == sizeof(msgIn));
+            TE_ASSERT(memcmp(msgIn, decBuff, decBuffSize) == 0);
+        }
+
+        /* A corrupted ciphertext is rejected */
+        /*------------------------------------*/
+        sigBuff[padBenchKeySizes[i] / 16] ^= 0x01;
+        decBuffSize = sizeof(decBuff);
+        TE_ASSERT(CC_RsaSchemesDecrypt(&userPrivateKey, &primeData, RSA_DEFAULT_HASH, NULL, 0,
+                                       CC_PKCS1_MGF1, sigBuff, padBenchKeySizes[i] / 8,
+                                       decBuff, &decBuffSize, version) != CC_OK);
+    }
+
+bail:
+    return res;
+}
+
+TE_rc_t rsa_priv_key_store(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie = 0;
+    CCRsaKgData_t KeyGenData;
+    CCRsaUserPrivKey_t userPrivateKey;
+    CCRsaUserPrivKey_t builtPrivateKey;
+    CCRsaUserPubKey_t userPublicKey;
+    CCRsaPrivUserContext_t privUserContext;
+    CCRsaPubUserContext_t publUserContext;
+    CCRsaPrivKeyImportItem_t items[TE_RSA_KEY_STORE_COUNT];
+    uint8_t pubExp65537[] = { 0x01, 0x00, 0x01 };
+    uint8_t macKey[TE_RSA_KEY_STORE_MAC_KEY_SIZE];
+    uint8_t msgIn[RANDON_MSG_SIZE_IN_BYTES];
+    uint8_t sigBuff[CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS * sizeof(uint32_t)];
+    uint8_t P[KEY_SIZE_IN_BYTES / 2], Q[KEY_SIZE_IN_BYTES / 2];
+    uint8_t dP[KEY_SIZE_IN_BYTES / 2], dQ[KEY_SIZE_IN_BYTES / 2], qInv[KEY_SIZE_IN_BYTES / 2];
+    uint16_t PSize = sizeof(P), QSize = sizeof(Q);
+    uint16_t dPSize = sizeof(dP), dQSize = sizeof(dQ), qInvSize = sizeof(qInv);
+    size_t sigBuffSize, blobSize;
+    CCPkcs1Version_t version = 0;
+    uint32_t i;
+
+    if (pContext == NULL) {
+        TE_LOG_ERROR("Invalid Params! (pContext == NULL)");
+        res = TE_RC_FAIL;
+        goto bail;
+    }
+
+    version = ((teRsaVector_t *) pContext)->version;
+
+    TE_ASSERT(CC_RndGenerateVector(pRndState_proj, msgIn, sizeof(msgIn)) == CC_OK);
+    TE_ASSERT(CC_RndGenerateVector(pRndState_proj, macKey, sizeof(macKey)) == CC_OK);
+
+    TE_ASSERT(CC_RsaKgKeyPairCrtGenerate(pRndFunc_proj, pRndState_proj,
+                                         pubExp65537, sizeof(pubExp65537), KEY_SIZE_IN_BITS,
+                                         &userPrivateKey, &userPublicKey,
+                                         &KeyGenData, NULL) == CC_OK);
+
+    TE_ASSERT(CC_RsaGetPrivKeyCRT(&userPrivateKey, P, &PSize, Q, &QSize, dP, &dPSize,
+                                  dQ, &dQSize, qInv, &qInvSize) == CC_OK);
+
+    /* first import: the key is built and validated, then exported */
+    /*--------------------------------------------------------------*/
+    for (i = 0; i < TE_RSA_KEY_STORE_COUNT; i++) {
+        cookie = TE_perfOpenNewEntry("rsa", "priv-key-crt-build");
+        TE_ASSERT(CC_RsaPrivKeyCrtBuild(&builtPrivateKey, P, PSize, Q, QSize, dP, dPSize,
+                                        dQ, dQSize, qInv, qInvSize) == CC_OK);
+        TE_perfCloseEntry(cookie);
+    }
+
+    blobSize = sizeof(keyStoreBlob);
+    cookie = TE_perfOpenNewEntry("rsa", "priv-key-export");
+    TE_ASSERT(CC_RsaPrivKeyExport(&builtPrivateKey, macKey, sizeof(macKey),
+                                  keyStoreBlob, &blobSize) == CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT(blobSize == CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES);
+
+    /* later loads: the blob is only checked and deserialized */
+    /*--------------------------------------------------------*/
+    for (i = 0; i < TE_RSA_KEY_STORE_COUNT; i++) {
+        cookie = TE_perfOpenNewEntry("rsa", "priv-key-import");
+        TE_ASSERT(CC_RsaPrivKeyImport(&keyStoreKeys[i], macKey, sizeof(macKey),
+                                      keyStoreBlob, blobSize) == CC_OK);
+        TE_perfCloseEntry(cookie);
+        TE_ASSERT(keyStoreKeys[i].valid_tag == builtPrivateKey.valid_tag);
+        TE_ASSERT(memcmp(keyStoreKeys[i].PrivateKeyDbBuff, builtPrivateKey.PrivateKeyDbBuff,
+                         sizeof(CCRsaPrivKey_t)) == 0);
+    }
+
+    for (i = 0; i < TE_RSA_KEY_STORE_COUNT; i++) {
+        items[i].pBlob = keyStoreBlob;
+        items[i].blobSize = blobSize;
+        items[i].pUserPrivKey = &keyStoreKeys[i];
+    }
+    cookie = TE_perfOpenNewEntry("rsa", "priv-key-import-batch");
+    TE_ASSERT(CC_RsaPrivKeyImportBatch(macKey, sizeof(macKey), items, TE_RSA_KEY_STORE_COUNT) == CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    /* the imported key signs as the generated one */
+    /*---------------------------------------------*/
+    sigBuffSize = sizeof(sigBuff);
+    TE_ASSERT(CC_RsaSign(pRndFunc_proj, pRndState_proj, &privUserContext,
+                         &keyStoreKeys[TE_RSA_KEY_STORE_COUNT - 1], RSA_DEFAULT_HASH,
+                         CC_PKCS1_MGF1, 32, msgIn, sizeof(msgIn), sigBuff,
+                         &sigBuffSize, version) == CC_OK);
+    TE_ASSERT(CC_RsaVerify(&publUserContext, &userPublicKey,
+                           RSA_DEFAULT_HASH, CC_PKCS1_MGF1, 32, msgIn,
+                           sizeof(msgIn), sigBuff, version) == CC_OK);
+
+    /* a modified blob, a wrong key or a short blob are rejected */
+    /*-----------------------------------------------------------*/
+    memcpy(keyStoreBadBlob, keyStoreBlob, blobSize);
+    keyStoreBadBlob[CC_RSA_PRIV_KEY_BLOB_HEADER_SIZE_IN_BYTES + 1] ^= 0x01;
+    TE_ASSERT(CC_RsaPrivKeyImport(&keyStoreKeys[0], macKey, sizeof(macKey),
+                                  keyStoreBadBlob, blobSize) == CC_RSA_PRIV_KEY_BLOB_INTEGRITY_ERROR);
+    TE_ASSERT(CC_RsaPrivKeyImport(&keyStoreKeys[0], macKey, sizeof(macKey) - 1,
+                                  keyStoreBlob, blobSize) == CC_RSA_PRIV_KEY_BLOB_INTEGRITY_ERROR);
+    TE_ASSERT(CC_RsaPrivKeyImport(&keyStoreKeys[0], macKey, sizeof(macKey),
+                                  keyStoreBlob, blobSize - 1) == CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR);
+
+    items[1].pBlob = keyStoreBadBlob;
+    TE_ASSERT(CC_RsaPrivKeyImportBatch(macKey, sizeof(macKey), items,
+                                       TE_RSA_KEY_STORE_COUNT) == CC_RSA_PRIV_KEY_BLOB_BATCH_ERROR);
+    for (i = 0; i < TE_RSA_KEY_STORE_COUNT; i++) {
+        TE_ASSERT(items[i].result == ((i == 1) ? CC_RSA_PRIV_KEY_BLOB_INTEGRITY_ERROR : CC_OK));
+    }
+
 bail:
     return res;
 }
@@ -198,11 +773,31 @@ bail:
 int TE_init_rsa_test(void)
 {
     TE_rc_t res = TE_RC_SUCCESS;
+    uint32_t i, j;
+
 
     TE_perfEntryInit("rsa", "generate-rand-vec");
     TE_perfEntryInit("rsa", "key-pair-generate");
     TE_perfEntryInit("rsa", "encrypt");
     TE_perfEntryInit("rsa", "decrypt");
+    TE_perfEntryInit("rsa", "verify-batch");
+    TE_perfEntryInit("rsa", "multi-prime-key-pair-generate");
+    for (i = 0; i < TE_VEC_COUNT(multiPrimeBenchEntries); i++) {
+        for (j = 0; j < TE_VEC_COUNT(multiPrimeBenchEntries[i]); j++) {
+            TE_perfEntryInit("rsa", multiPrimeBenchEntries[i][j]);
+        }
+    }
+    TE_perfEntryInit("rsa", "key-pair-generate-crt-2048");
+    TE_perfEntryInit("rsa", "key-pair-generate-crt-3072");
+    TE_perfEntryInit("rsa", "priv-key-crt-build");
+    TE_perfEntryInit("rsa", "priv-key-export");
+    TE_perfEntryInit("rsa", "priv-key-import");
+    TE_perfEntryInit("rsa", "priv-key-import-batch");
+    for (i = 0; i < TE_VEC_COUNT(padBenchEntries); i++) {
+        for (j = 0; j < TE_VEC_COUNT(padBenchEntries[i]); j++) {
+            TE_perfEntryInit("rsa", padBenchEntries[i][j]);
+        }
+    }
 
     /* PKCS#1 Version 1.5 sign and verify */
     /*------------------------------------*/
@@ -247,6 +842,61 @@ int TE_init_rsa_test(void)
                               NULL,
                               NULL,
                               &encryptDecryptVer21) == TE_RC_SUCCESS);
+
+    /* PKCS#1 Version 2.1 batch verify */
+    /*---------------------------------*/
+    TE_ASSERT(TE_registerFlow("rsa pkcs#1-ver2.1",
+                              "batch verify",
+                              "sha-256",
+                              NULL,
+                              rsa_verify_batch,
+                              NULL,
+                              NULL,
+                              &verifyBatchVer21) == TE_RC_SUCCESS);
+
+    /* PKCS#1 Version 2.1 sign and verify with two and three primes keys */
+    /*-------------------------------------------------------------------*/
+    TE_ASSERT(TE_registerFlow("rsa pkcs#1-ver2.1",
+                              "multi-prime sign & verify",
+                              "sha-256",
+                              NULL,
+                              rsa_multi_prime_sign_verify,
+                              NULL,
+                              NULL,
+                              &signVerifyMultiPrimeVer21) == TE_RC_SUCCESS);
+
+    /* Key generation latency */
+    /*------------------------*/
+    TE_ASSERT(TE_registerFlow("rsa pkcs#1-ver2.1",
+                              "key generation latency",
+                              "crt",
+                              NULL,
+                              rsa_key_gen_bench,
+                              NULL,
+                              NULL,
+                              &keyGenBenchVer21) == TE_RC_SUCCESS);
+
+    /* PSS and OAEP latency on large keys */
+    /*------------------------------------*/
+    TE_ASSERT(TE_registerFlow("rsa pkcs#1-ver2.1",
+                              "pss & oaep latency",
+                              "sha-256",
+                              NULL,
+                              rsa_pss_oaep_bench,
+                              NULL,
+                              NULL,
+                              &padBenchVer21) == TE_RC_SUCCESS);
+
+    /* Private key export and import */
+    /*-------------------------------*/
+    TE_ASSERT(TE_registerFlow("rsa pkcs#1-ver2.1",
+                              "private key store",
+                              "crt",
+                              NULL,
+                              rsa_priv_key_store,
+                              NULL,
+                              NULL,
+                              &keyStoreVer21) == TE_RC_SUCCESS);
 bail:
 	return res;
 }
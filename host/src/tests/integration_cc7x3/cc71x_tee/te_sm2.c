@@ -16,6 +16,8 @@
 #include "cc_sm2.h"
 #include "cc_ecpki_domain_sm2.h"
 #include "cc_ecpki_build.h"
+#include "cc_ecpki_error.h"
+#include "cc_sm2_za_cache.h"
 #include "te_sm2.h"
 
 
@@ -24,6 +26,8 @@
  ******************************************************************/
 #define SM2_TV_MAX_DATA_SIZE    14
 #define SM2_TV_DIGEST_SIZE      32
+#define SM2_ZA_CACHE_ENTRIES_COUNT  4
+#define SM2_VERIFY_BATCH_COUNT      8
 
 /******************************************************************
  * Enums
@@ -127,6 +131,11 @@ static Sm2SignVector_t sm2_vector = {
     .dataRefSize = 2 * SM2_TV_DIGEST_SIZE,
 };
 
+static CCSm2ZaCache_t       sm2ZaCache;
+static CCSm2ZaCacheEntry_t  sm2ZaCacheEntries[SM2_ZA_CACHE_ENTRIES_COUNT];
+static CCSm2Signer_t        sm2Signer;
+static uint8_t              sm2BadSignature[2 * SM2_TV_DIGEST_SIZE];
+
 /******************************************************************
  * Static Prototypes
  ******************************************************************/
@@ -287,6 +296,129 @@ bail:
 
     return res;
 }
+static TE_rc_t sm2_execute_signer(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie;
+    Sm2SignVector_t *sm2_vec = (Sm2SignVector_t *)pContext;
+    uint32_t hitsCount = 0;
+    uint32_t missesCount = 0;
+    CCEcpkiUserPrivKey_t otherPrivKey;
+
+    TE_ASSERT_PASS( CC_Sm2ZaCacheInit(&sm2ZaCache, sm2ZaCacheEntries, SM2_ZA_CACHE_ENTRIES_COUNT), CC_OK);
+
+    /* The first signer computes ZA, the second one is served by the cache */
+    cookie = TE_perfOpenNewEntry("sm2", "signer-init");
+    TE_ASSERT_PASS( CC_Sm2SignerInit(&sm2ZaCache, &sm2_vec->pubKey,
+                                     sm2_vec->id, sm2_vec->idSize,
+                                     &sm2_vec->privKey,
+                                     &sm2Signer), CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    TE_ASSERT_PASS( CC_Sm2SignerInit(&sm2ZaCache, &sm2_vec->pubKey,
+                                     sm2_vec->id, sm2_vec->idSize,
+                                     &sm2_vec->privKey,
+                                     &sm2Signer), CC_OK);
+    TE_ASSERT_PASS( CC_Sm2ZaCacheStatsGet(&sm2ZaCache, &hitsCount, &missesCount), CC_OK);
+    TE_ASSERT(hitsCount == 1);
+    TE_ASSERT(missesCount == 1);
+
+    cookie = TE_perfOpenNewEntry("sm2", "sign-with-signer");
+    TE_ASSERT_PASS( CC_Sm2SignWithSigner(Tests_RndGenerateVectorConst,
+                                         (void *)sm2_vec->randomSeed,
+                                         &sm2Signer,
+                                         &sm2_vec->privKey,
+                                         sm2_vec->dataIn, sm2_vec->dataInSize,
+                                         sm2_vec->dataOut,
+                                         &sm2_vec->dataRefSize), CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    TE_ASSERT( memcmp((uint8_t *)&(sm2_vec->dataOut), (uint8_t *)&(sm2_vec->dataRef), sm2_vec->dataRefSize) == 0);
+
+    cookie = TE_perfOpenNewEntry("sm2", "verify-with-signer");
+    TE_ASSERT_PASS( CC_Sm2VerifyWithSigner(&sm2Signer,
+                                           sm2_vec->dataRef, sm2_vec->dataRefSize,
+                                           sm2_vec->dataIn, sm2_vec->dataInSize), CC_OK);
+    TE_perfCloseEntry(cookie);
+
+    /* The signer signs only with its own private key */
+    memcpy(&otherPrivKey, &sm2_vec->privKey, sizeof(otherPrivKey));
+    otherPrivKey.PrivKeyDbBuff[0] ^= 1;
+    TE_ASSERT( CC_Sm2SignWithSigner(Tests_RndGenerateVectorConst,
+                                    (void *)sm2_vec->randomSeed,
+                                    &sm2Signer,
+                                    &otherPrivKey,
+                                    sm2_vec->dataIn, sm2_vec->dataInSize,
+                                    sm2_vec->dataOut,
+                                    &sm2_vec->dataRefSize) == CC_ECPKI_SM2_SIGNER_KEY_MISMATCH);
+    TE_ASSERT( CC_Sm2SignerInit(NULL, &sm2_vec->pubKey,
+                                sm2_vec->id, sm2_vec->idSize,
+                                &otherPrivKey,
+                                &sm2Signer) == CC_ECPKI_SM2_SIGNER_KEY_MISMATCH);
+
+    /* A signer prepared without a private key only verifies */
+    TE_ASSERT_PASS( CC_Sm2SignerInit(NULL, &sm2_vec->pubKey,
+                                     sm2_vec->id, sm2_vec->idSize,
+                                     NULL,
+                                     &sm2Signer), CC_OK);
+    TE_ASSERT( CC_Sm2SignWithSigner(Tests_RndGenerateVectorConst,
+                                    (void *)sm2_vec->randomSeed,
+                                    &sm2Signer,
+                                    &sm2_vec->privKey,
+                                    sm2_vec->dataIn, sm2_vec->dataInSize,
+                                    sm2_vec->dataOut,
+                                    &sm2_vec->dataRefSize) == CC_ECPKI_SM2_SIGNER_KEY_MISMATCH);
+    TE_ASSERT_PASS( CC_Sm2VerifyWithSigner(&sm2Signer,
+                                           sm2_vec->dataRef, sm2_vec->dataRefSize,
+                                           sm2_vec->dataIn, sm2_vec->dataInSize), CC_OK);
+
+    /* The freed cache prepares no signer */
+    TE_ASSERT_PASS( CC_Sm2ZaCacheFree(&sm2ZaCache), CC_OK);
+    TE_ASSERT( CC_Sm2SignerInit(&sm2ZaCache, &sm2_vec->pubKey,
+                                sm2_vec->id, sm2_vec->idSize,
+                                NULL,
+                                &sm2Signer) == CC_ECPKI_SM2_INVALID_ZA_CACHE);
+
+bail:
+    return res;
+}
+
+static TE_rc_t sm2_execute_verify_batch(void *pContext)
+{
+    TE_rc_t res = TE_RC_SUCCESS;
+    TE_perfIndex_t cookie;
+    Sm2SignVector_t *sm2_vec = (Sm2SignVector_t *)pContext;
+    CCSm2VerifyBatchItem_t items[SM2_VERIFY_BATCH_COUNT];
+    CCError_t results[SM2_VERIFY_BATCH_COUNT];
+    size_t i;
+
+    /* The reference signature in every item, and a corrupted signature in the last item */
+    memcpy(sm2BadSignature, sm2_vec->dataRef, sm2_vec->dataRefSize);
+    sm2BadSignature[sm2_vec->dataRefSize - 1] ^= 1;
+    for (i = 0; i < SM2_VERIFY_BATCH_COUNT; i++) {
+        items[i].pUserPublKey = &sm2_vec->pubKey;
+        items[i].pSignatureIn = (i == SM2_VERIFY_BATCH_COUNT - 1) ? sm2BadSignature : sm2_vec->dataRef;
+        items[i].SignatureSizeBytes = sm2_vec->dataRefSize;
+        items[i].pHashInput = sm2_vec->msgDigestRef;
+        items[i].HashInputSize = sm2_vec->msgDigestRefSizeW;
+    }
+
+    cookie = TE_perfOpenNewEntry("sm2", "verify-batch");
+    TE_ASSERT( CC_Sm2VerifyBatch(items, SM2_VERIFY_BATCH_COUNT, results) == CC_ECPKI_SM2_BATCH_ITEM_FAILED);
+    TE_perfCloseEntry(cookie);
+
+    for (i = 0; i < SM2_VERIFY_BATCH_COUNT - 1; i++) {
+        TE_ASSERT( results[i] == CC_OK);
+    }
+    TE_ASSERT( results[SM2_VERIFY_BATCH_COUNT - 1] == CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR);
+
+    /* The valid items only */
+    TE_ASSERT_PASS( CC_Sm2VerifyBatch(items, SM2_VERIFY_BATCH_COUNT - 1, results), CC_OK);
+
+bail:
+    return res;
+}
+
 static TE_rc_t sm2_clean(void *pContext)
 {
     TE_rc_t res = TE_RC_SUCCESS;
@@ -306,6 +438,10 @@ int TE_init_sm2_test(void)
 
     TE_perfEntryInit("sm2", "sign");
     TE_perfEntryInit("sm2", "verify");
+    TE_perfEntryInit("sm2", "signer-init");
+    TE_perfEntryInit("sm2", "sign-with-signer");
+    TE_perfEntryInit("sm2", "verify-with-signer");
+    TE_perfEntryInit("sm2", "verify-batch");
 
     TE_ASSERT(TE_registerFlow("sm2",
                               "sign",
@@ -324,6 +460,24 @@ int TE_init_sm2_test(void)
                               sm2_clean, /* No results to verify */
                               sm2_clean,
                               &sm2_vector) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("sm2",
+                              "signer",
+                              "ZA cache",
+                              sm2_prepare,
+                              sm2_execute_signer,
+                              sm2_clean, /* Results are verified in the execution */
+                              sm2_clean,
+                              &sm2_vector) == TE_RC_SUCCESS);
+
+    TE_ASSERT(TE_registerFlow("sm2",
+                              "verify",
+                              "batch",
+                              sm2_prepare,
+                              sm2_execute_verify_batch,
+                              sm2_clean, /* Results are verified in the execution */
+                              sm2_clean,
+                              &sm2_vector) == TE_RC_SUCCESS);
     goto bail;
 
 bail:
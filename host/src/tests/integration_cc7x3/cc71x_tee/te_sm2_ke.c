@@ -16,6 +16,7 @@
 #include "cc_sm2.h"
 #include "cc_ecpki_domain_sm2.h"
 #include "cc_ecpki_build.h"
+#include "cc_ecpki_error.h"
 #include "te_sm2_ke.h"
 
 
@@ -24,6 +25,8 @@
  ******************************************************************/
 #define SM2_TV_RAND_SEED_SIZE           32
 #define SM2_TV_MAX_KEY_SIZE_IN_BYTES    16
+#define SM2_KE_BATCH_HANDSHAKES_COUNT   4
+#define SM2_KE_KEYSTREAM_SIZE_IN_BYTES  4096
 
 /******************************************************************
  * Enums
@@ -84,6 +87,8 @@ typedef struct Sm2KeyExchangeVector_t{
  * Globals
  ******************************************************************/
 
+static uint8_t sm2KeKeystream_UserA[SM2_KE_KEYSTREAM_SIZE_IN_BYTES];
+static uint8_t sm2KeKeystream_UserB[SM2_KE_KEYSTREAM_SIZE_IN_BYTES];
 
 static Sm2KeyExchangeVector_t sm2_vector = {
     /* Input - User A */
@@ -159,11 +164,18 @@ static Sm2KeyExchangeVector_t sm2_vector = {
     .referenceKeySize = SM2_TV_MAX_KEY_SIZE_IN_BYTES,
 };
 
+/* The contexts of the batch handshakes: party A and party B of each handshake */
+static CC_Sm2KeContext_t        sm2KeBatchContexts[2 * SM2_KE_BATCH_HANDSHAKES_COUNT];
+static CCEcpkiUserPublKey_t     sm2KeBatchRandomPoints[2 * SM2_KE_BATCH_HANDSHAKES_COUNT];
+static uint8_t                  sm2KeBatchConfValues[2 * SM2_KE_BATCH_HANDSHAKES_COUNT][CC_SM2_CONF_VALUE_LENGTH_IN_BYTES];
+static size_t                   sm2KeBatchConfValueSizes[2 * SM2_KE_BATCH_HANDSHAKES_COUNT];
+
 /******************************************************************
  * Static Prototypes
  ******************************************************************/
 static TE_rc_t sm2_ke_prepare(void *pContext);
 static TE_rc_t sm2_ke_execute_2_parties(void *pContext);
+static TE_rc_t sm2_ke_execute_batch(void *pContext);
 static TE_rc_t sm2_ke_verify(void *pContext);
 static TE_rc_t sm2_ke_clean(void *pContext);
 
@@ -256,6 +268,8 @@ static TE_rc_t sm2_ke_execute_2_parties(void *pContext)
     uint8_t outConfValue_UserB[CC_SM2_CONF_VALUE_LENGTH_IN_BYTES];
     size_t  outConfValueSize_UserA = CC_SM2_CONF_VALUE_LENGTH_IN_BYTES;
     size_t  outConfValueSize_UserB = CC_SM2_CONF_VALUE_LENGTH_IN_BYTES;
+    size_t  keystreamSize_UserA = 0;
+    size_t  keystreamSize_UserB = 0;
 
 
     /* Start performance measurement */
@@ -346,6 +360,22 @@ static TE_rc_t sm2_ke_execute_2_parties(void *pContext)
     /* Finish performance measurement */
     TE_perfCloseEntry(cookie);
 
+    /* A long derivation, e.g. a keystream, agrees on both sides and starts with the common key */
+    keystreamSize_UserA = sizeof(sm2KeKeystream_UserA);
+    keystreamSize_UserB = sizeof(sm2KeKeystream_UserB);
+    cookie = TE_perfOpenNewEntry("sm2", "kdf - 4096 bytes");
+    TE_ASSERT_PASS( CC_Sm2Kdf(&Sm2KeContext_a,
+                              SM2_KE_KEYSTREAM_SIZE_IN_BYTES * CC_BITS_IN_BYTE,
+                              sm2KeKeystream_UserA, &keystreamSize_UserA) , CC_OK);
+    TE_perfCloseEntry(cookie);
+    TE_ASSERT_PASS( CC_Sm2Kdf(&Sm2KeContext_b,
+                              SM2_KE_KEYSTREAM_SIZE_IN_BYTES * CC_BITS_IN_BYTE,
+                              sm2KeKeystream_UserB, &keystreamSize_UserB) , CC_OK);
+    TE_ASSERT( keystreamSize_UserA == SM2_KE_KEYSTREAM_SIZE_IN_BYTES);
+    TE_ASSERT( keystreamSize_UserB == SM2_KE_KEYSTREAM_SIZE_IN_BYTES);
+    TE_ASSERT( memcmp (sm2KeKeystream_UserA, sm2KeKeystream_UserB, SM2_KE_KEYSTREAM_SIZE_IN_BYTES) == 0);
+    TE_ASSERT( memcmp (sm2KeKeystream_UserA, sm2_vec->referenceKey, sm2_vec->referenceKeySize) == 0);
+
 bail:
     if (workBuff != NULL) {
         Test_PalFree(workBuff);
@@ -355,6 +385,122 @@ bail:
     return res;
 }
 
+static TE_rc_t sm2_ke_execute_batch(void *pContext)
+{
+    Sm2KeyExchangeVector_t  *sm2_vec = (Sm2KeyExchangeVector_t *)pContext;
+    TE_rc_t         res = TE_RC_SUCCESS;
+    TE_perfIndex_t  cookie;
+    uint8_t*        workBuff = NULL;
+    size_t          workBuffSize = 0;
+    size_t          largestIdSize = 0;
+    size_t          i;
+    CC_Sm2KeContext_t       *pCtxA, *pCtxB;
+    CCSm2KeBatchItem_t      items[2 * SM2_KE_BATCH_HANDSHAKES_COUNT];
+    CCError_t               results[2 * SM2_KE_BATCH_HANDSHAKES_COUNT];
+    uint8_t                 outputKey[SM2_TV_MAX_KEY_SIZE_IN_BYTES];
+    size_t                  outputKeySize;
+
+    /* Allocate working buffer */
+    largestIdSize = sm2_vec->idSize_UserA > sm2_vec->idSize_UserB ? sm2_vec->idSize_UserA : sm2_vec->idSize_UserB;
+    workBuffSize = 2 + CC_SM2_MODULE_LENGTH_IN_BYTES*4 + CC_SM2_ORDER_LENGTH_IN_BYTES*2 + largestIdSize;
+    workBuff = Test_PalMalloc(workBuffSize);
+    TE_ASSERT(workBuff);
+
+    /* Start performance measurement of all the handshakes */
+    cookie = TE_perfOpenNewEntry("sm2", "key exchange - batch of 4 handshakes");
+
+    /* Both parties of every handshake: the contexts and the random points */
+    for (i = 0; i < SM2_KE_BATCH_HANDSHAKES_COUNT; i++) {
+        pCtxA = &sm2KeBatchContexts[2 * i];
+        pCtxB = &sm2KeBatchContexts[2 * i + 1];
+
+        TE_ASSERT_PASS( CC_Sm2KeyExchangeContext_init (pCtxA,
+                                                       workBuff, workBuffSize,
+                                                       &sm2_vec->pubKey_UserA, &sm2_vec->privKey_UserA,
+                                                       &sm2_vec->pubKey_UserB,
+                                                       sm2_vec->id_UserA, sm2_vec->idSize_UserA,
+                                                       sm2_vec->id_UserB, sm2_vec->idSize_UserB,
+                                                       1U, /* initiator */
+                                                       sm2_vec->confirmationrequired_UserA) , CC_OK);
+        TE_ASSERT_PASS( CC_Sm2KeyExchangeContext_init (pCtxB,
+                                                       workBuff, workBuffSize,
+                                                       &sm2_vec->pubKey_UserB, &sm2_vec->privKey_UserB,
+                                                       &sm2_vec->pubKey_UserA,
+                                                       sm2_vec->id_UserB, sm2_vec->idSize_UserB,
+                                                       sm2_vec->id_UserA, sm2_vec->idSize_UserA,
+                                                       0U, /* not initiator */
+                                                       sm2_vec->confirmationrequired_UserB) , CC_OK);
+
+        TE_ASSERT_PASS( CC_Sm2CalculateECPoint (Tests_RndGenerateVectorConst,
+                                                (void *)sm2_vec->randomSeed_UserA,
+                                                pCtxA,
+                                                &sm2KeBatchRandomPoints[2 * i] ) , CC_OK);
+        TE_ASSERT_PASS( CC_Sm2CalculateECPoint (Tests_RndGenerateVectorConst,
+                                                (void *)sm2_vec->randomSeed_UserB,
+                                                pCtxB,
+                                                &sm2KeBatchRandomPoints[2 * i + 1] ) , CC_OK);
+
+        /* each party gets the random point of the other party */
+        items[2 * i].pCtx = pCtxA;
+        items[2 * i].pRandomPoint = &sm2KeBatchRandomPoints[2 * i + 1];
+        items[2 * i + 1].pCtx = pCtxB;
+        items[2 * i + 1].pRandomPoint = &sm2KeBatchRandomPoints[2 * i];
+    }
+    for (i = 0; i < 2 * SM2_KE_BATCH_HANDSHAKES_COUNT; i++) {
+        sm2KeBatchConfValueSizes[i] = CC_SM2_CONF_VALUE_LENGTH_IN_BYTES;
+        items[i].pConfirmationValueOut = sm2KeBatchConfValues[i];
+        items[i].pConfirmationValueOutSize = &sm2KeBatchConfValueSizes[i];
+    }
+
+    /* The shared secrets of all the handshakes in one PKA session */
+    TE_ASSERT_PASS( CC_Sm2CalculateSharedSecretBatch(items, 2 * SM2_KE_BATCH_HANDSHAKES_COUNT, results) , CC_OK);
+
+    for (i = 0; i < SM2_KE_BATCH_HANDSHAKES_COUNT; i++) {
+        TE_ASSERT( results[2 * i] == CC_OK);
+        TE_ASSERT( results[2 * i + 1] == CC_OK);
+
+        /* Verify the confirmation values and derive the common key of each party */
+        TE_ASSERT_PASS( CC_Sm2Confirmation (&sm2KeBatchContexts[2 * i],
+                                            sm2KeBatchConfValues[2 * i + 1], sm2KeBatchConfValueSizes[2 * i + 1]) , CC_OK);
+        TE_ASSERT_PASS( CC_Sm2Confirmation (&sm2KeBatchContexts[2 * i + 1],
+                                            sm2KeBatchConfValues[2 * i], sm2KeBatchConfValueSizes[2 * i]) , CC_OK);
+
+        outputKeySize = sizeof(outputKey);
+        TE_ASSERT_PASS( CC_Sm2Kdf(&sm2KeBatchContexts[2 * i],
+                                  sm2_vec->requiredKeySizeInBits,
+                                  outputKey, &outputKeySize) , CC_OK);
+        TE_ASSERT( outputKeySize == sm2_vec->referenceKeySize);
+        TE_ASSERT( memcmp (outputKey, sm2_vec->referenceKey, sm2_vec->referenceKeySize) == 0);
+
+        outputKeySize = sizeof(outputKey);
+        TE_ASSERT_PASS( CC_Sm2Kdf(&sm2KeBatchContexts[2 * i + 1],
+                                  sm2_vec->requiredKeySizeInBits,
+                                  outputKey, &outputKeySize) , CC_OK);
+        TE_ASSERT( outputKeySize == sm2_vec->referenceKeySize);
+        TE_ASSERT( memcmp (outputKey, sm2_vec->referenceKey, sm2_vec->referenceKeySize) == 0);
+    }
+
+    /* Finish performance measurement */
+    TE_perfCloseEntry(cookie);
+
+    /* A failed item does not affect the other items */
+    items[0].pRandomPoint = NULL;
+    TE_ASSERT( CC_Sm2CalculateSharedSecretBatch(items, 2, results) == CC_ECPKI_SM2_BATCH_ITEM_FAILED);
+    TE_ASSERT( results[0] == CC_ECPKI_SM2_INVALID_EPHEMERAL_PUB_IN_PTR);
+    TE_ASSERT( results[1] == CC_OK);
+
+bail:
+    for (i = 0; i < 2 * SM2_KE_BATCH_HANDSHAKES_COUNT; i++) {
+        CC_Sm2KeyExchangeContext_cleanup(&sm2KeBatchContexts[i]);
+    }
+    if (workBuff != NULL) {
+        Test_PalFree(workBuff);
+        workBuff = NULL;
+    }
+
+    return res;
+}
+
 static TE_rc_t sm2_ke_verify(void *pContext)
 {
     TE_rc_t res = TE_RC_SUCCESS;
@@ -392,6 +538,8 @@ int TE_init_sm2_ke_test(void)
     TE_rc_t res = TE_RC_SUCCESS;
 
     TE_perfEntryInit("sm2", "key exchange - 2 parties");
+    TE_perfEntryInit("sm2", "key exchange - batch of 4 handshakes");
+    TE_perfEntryInit("sm2", "kdf - 4096 bytes");
 
     TE_ASSERT(TE_registerFlow("sm2",
                               "key exchange",
@@ -402,6 +550,14 @@ int TE_init_sm2_ke_test(void)
                               sm2_ke_clean,
                               &sm2_vector) == TE_RC_SUCCESS);
 
+    TE_ASSERT(TE_registerFlow("sm2",
+                              "key exchange",
+                              "batch",
+                              sm2_ke_prepare,
+                              sm2_ke_execute_batch,
+                              sm2_ke_clean, /* Results are verified in the execution */
+                              sm2_ke_clean,
+                              &sm2_vector) == TE_RC_SUCCESS);
 
     goto bail;
 
@@ -11,6 +11,7 @@
 #include "test_pal_thread.h"
 #include "test_proj_common.h"
 #include "tests_log.h"
+#include "tests_thread.h"
 
 #define LINUX_MIN_THREAD_STACK_SIZE (1024 * 1024)
 /*
@@ -57,3 +58,66 @@ int Tests_Runthread(void *(*threadFunc)(void *), void *args)
 
     return rc;
 }
+
+/*
+ * Tests_RunthreadsConcurrent
+ * Run a function in several threads at the same time, and wait for all of them.
+ * numOfThreads [in]- number of threads to start, up to TESTS_MAX_CONCURRENT_THREADS
+ * threadFunc [in]- function to run
+ * argsList [in] - arguments to the function, one entry per thread
+ *
+ * return value is -1 if thread creation, join, or destruction didn't work,
+ * otherwise - the first non zero value returned from threadFunc, or 0.
+ *
+ * */
+int Tests_RunthreadsConcurrent(uint32_t numOfThreads, void *(*threadFunc)(void *), void **argsList)
+{
+    int threadRc;
+    ThreadHandle threadHandles[TESTS_MAX_CONCURRENT_THREADS];
+    void *pThreadRet = NULL;
+    uint32_t numOfStarted = 0;
+    uint32_t i;
+    int rc = 0;
+
+    if ((numOfThreads == 0) || (numOfThreads > TESTS_MAX_CONCURRENT_THREADS)) {
+        TEST_LOG_ERROR("invalid number of threads %u\n", numOfThreads);
+        return -1;
+    }
+
+    for (numOfStarted = 0; numOfStarted < numOfThreads; numOfStarted++) {
+        threadHandles[numOfStarted] = Test_PalThreadCreate(LINUX_MIN_THREAD_STACK_SIZE,
+                                                           threadFunc,
+                                                           Test_PalGetDefaultPriority(),
+                                                           argsList[numOfStarted],
+                                                           NULL,
+                                                           0,
+                                                           true);
+        if (threadHandles[numOfStarted] == NULL) {
+            TEST_LOG_ERROR("Test_PalThreadCreate failed\n");
+            rc = -1;
+            break;
+        }
+    }
+
+    /* join whatever was started, even if a later creation failed */
+    for (i = 0; i < numOfStarted; i++) {
+        pThreadRet = NULL;
+        threadRc = Test_PalThreadJoin(threadHandles[i], &pThreadRet);
+        if (threadRc != 0) {
+            TEST_LOG_ERROR("Test_PalThreadJoin failed\n");
+            rc = -1;
+        } else if ((rc == 0) && (pThreadRet != NULL)) {
+            rc = (int)(uintptr_t)pThreadRet;
+        }
+
+        threadRc = Test_PalThreadDestroy(threadHandles[i]);
+        if (threadRc != 0) {
+            TEST_LOG_ERROR("Test_PalThreadDestroy failed\n");
+            rc = -1;
+        }
+    }
+
+    TEST_LOG_TRACE("Finished running %u threads. Returned rc = %d\n", numOfStarted, rc);
+
+    return rc;
+}
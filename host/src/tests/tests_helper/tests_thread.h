@@ -5,5 +5,12 @@
  *
  */
 
+#include <stdint.h>
+
+/* Maximal number of threads started by Tests_RunthreadsConcurrent */
+#define TESTS_MAX_CONCURRENT_THREADS    16
+
 int Tests_Runthread(void *(*threadFunc)(void *), void *args);
 
+int Tests_RunthreadsConcurrent(uint32_t numOfThreads, void *(*threadFunc)(void *), void **argsList);
+
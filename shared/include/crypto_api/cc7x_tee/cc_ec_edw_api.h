@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_EC_EDW_API_H
+#define _CC_EC_EDW_API_H
+
+
+#include "cc_pal_types.h"
+#include "cc_rnd_common.h"
+#include "cc_ec_mont_edw_error.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*!
+@file
+@brief This file defines the Ed25519 APIs - the pure EdDSA signature on the twisted Edwards curve
+birationally equivalent to Curve25519, as defined in RFC 8032.
+
+The points are computed on the PKA in extended coordinates:
+<ul><li> The multiplications of the base point (key generation and signature) use a precomputed
+     fixed-base comb, with a fixed sequence of PKA operations and a full scan of the table.</li>
+<li> The verification computes S*B - k*A as one double scalar multiplication, with interleaved
+     width-5 NAF of both scalars, so the doublings are shared.</li></ul>
+
+The secret key is the 32 bytes seed followed by the public key, as in RFC 8032 test vectors.
+ */
+ /*!
+ @addtogroup cc_ec_edw
+ @{
+*/
+
+/************************ Defines ******************************/
+/*! The size of the field element of the encoded points in bytes. */
+#define CC_EC_EDW_MOD_SIZE_IN_BYTES         32
+/*! The size of the seed of the secret key in bytes. */
+#define CC_EC_EDW_SEED_BYTES                32
+/*! The size of the public key in bytes. */
+#define CC_EC_EDW_PUBL_KEY_BYTES            32
+/*! The size of the secret key in bytes - the seed and the public key. */
+#define CC_EC_EDW_SECR_KEY_BYTES            (CC_EC_EDW_SEED_BYTES + CC_EC_EDW_PUBL_KEY_BYTES)
+/*! The size of the signature in bytes - the encoded point R and the scalar S. */
+#define CC_EC_EDW_SIGNATURE_BYTES           (2*CC_EC_EDW_MOD_SIZE_IN_BYTES)
+/*! The size of the temporary buffer in words. */
+#define CC_EC_EDW_TEMP_BUFF_SIZE_IN_WORDS   640
+
+/************************ Typedefs  ****************************/
+/*! The temporary buffer of the Ed25519 APIs. */
+typedef struct CCEcEdwTempBuff_t
+{
+    uint32_t buff[CC_EC_EDW_TEMP_BUFF_SIZE_IN_WORDS];
+}CCEcEdwTempBuff_t;
+
+/************************ Public Functions **********************/
+
+/*!
+@brief This function computes the Ed25519 key pair of a seed.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ec_mont_edw_error.h or cc_hash_error.h.
+*/
+CIMPORT_C CCError_t CC_EcEdwSeedKeyPair(
+                    const uint8_t               *pSeed,           /*!< [in] Pointer to the seed. */
+                    size_t                      seedSize,         /*!< [in] The seed size in bytes - ::CC_EC_EDW_SEED_BYTES. */
+                    uint8_t                     *pSecrKey,        /*!< [out] Pointer to the secret key. */
+                    size_t                      *pSecrKeySize,    /*!< [in/out] The size of the secret key buffer (in), and the key size in bytes (out). */
+                    uint8_t                     *pPublKey,        /*!< [out] Pointer to the public key. */
+                    size_t                      *pPublKeySize,    /*!< [in/out] The size of the public key buffer (in), and the key size in bytes (out). */
+                    CCEcEdwTempBuff_t           *pTempBuff        /*!< [in] Temporary buffer for internal usage. */
+);
+
+/*!
+@brief This function generates a random Ed25519 key pair.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ec_mont_edw_error.h, cc_hash_error.h or cc_rnd_error.h.
+*/
+CIMPORT_C CCError_t CC_EcEdwKeyPair(
+                    uint8_t                     *pSecrKey,        /*!< [out] Pointer to the secret key. */
+                    size_t                      *pSecrKeySize,    /*!< [in/out] The size of the secret key buffer (in), and the key size in bytes (out). */
+                    uint8_t                     *pPublKey,        /*!< [out] Pointer to the public key. */
+                    size_t                      *pPublKeySize,    /*!< [in/out] The size of the public key buffer (in), and the key size in bytes (out). */
+                    CCRndGenerateVectWorkFunc_t f_rng,            /*!< [in] Pointer to DRBG function. */
+                    void                        *p_rng,           /*!< [in/out] Pointer to the random context - the input to f_rng. */
+                    CCEcEdwTempBuff_t           *pTempBuff        /*!< [in] Temporary buffer for internal usage. */
+);
+
+/*!
+@brief This function signs a message with Ed25519.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ec_mont_edw_error.h or cc_hash_error.h.
+*/
+CIMPORT_C CCError_t CC_EcEdwSign(
+                    uint8_t                     *pSign,           /*!< [out] Pointer to the signature. */
+                    size_t                      *pSignSize,       /*!< [in/out] The size of the signature buffer (in), and the signature size in bytes (out). */
+                    const uint8_t               *pMsg,            /*!< [in] Pointer to the message. */
+                    size_t                      msgSize,          /*!< [in] The message size in bytes. */
+                    const uint8_t               *pSecrKey,        /*!< [in] Pointer to the secret key. */
+                    size_t                      secrKeySize,      /*!< [in] The secret key size in bytes - ::CC_EC_EDW_SECR_KEY_BYTES. */
+                    CCEcEdwTempBuff_t           *pTempBuff        /*!< [in] Temporary buffer for internal usage. */
+);
+
+/*!
+@brief This function verifies an Ed25519 signature of a message.
+
+@return \c CC_OK on success.
+@return \c CC_EC_EDW_SIGN_VERIFY_FAILED_ERROR if the signature is not valid.
+@return A non-zero value on failure as defined in cc_ec_mont_edw_error.h or cc_hash_error.h.
+*/
+CIMPORT_C CCError_t CC_EcEdwVerify(
+                    const uint8_t               *pSign,           /*!< [in] Pointer to the signature. */
+                    size_t                      signSize,         /*!< [in] The signature size in bytes - ::CC_EC_EDW_SIGNATURE_BYTES. */
+                    const uint8_t               *pPublKey,        /*!< [in] Pointer to the public key. */
+                    size_t                      publKeySize,      /*!< [in] The public key size in bytes - ::CC_EC_EDW_PUBL_KEY_BYTES. */
+                    const uint8_t               *pMsg,            /*!< [in] Pointer to the message. */
+                    size_t                      msgSize,          /*!< [in] The message size in bytes. */
+                    CCEcEdwTempBuff_t           *pTempBuff        /*!< [in] Temporary buffer for internal usage. */
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+@}
+ */
+#endif
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_EC_MONT_API_H
+#define _CC_EC_MONT_API_H
+
+
+#include "cc_pal_types.h"
+#include "cc_rnd_common.h"
+#include "cc_ec_mont_edw_error.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*!
+@file
+@brief This file defines the X25519 APIs - the Diffie-Hellman function on Curve25519, as defined in RFC 7748.
+
+The scalar multiplication is a Montgomery ladder of the u-coordinate, run on the PKA: every bit of the scalar
+costs the same PKA operations, and the ladder registers are swapped by masked updates of the PKA registers
+mapping table, so the sequence of operations does not depend on the scalar.
+The public key of a secret key is computed on the birationally equivalent Ed25519 curve, with the
+precomputed fixed-base comb of its base point.
+
+The keys and the u-coordinates are 32 bytes strings, in little-endian order as defined in RFC 7748.
+ */
+ /*!
+ @addtogroup cc_ec_mont
+ @{
+*/
+
+/************************ Defines ******************************/
+/*! The size of the u-coordinate of a Curve25519 point in bytes. */
+#define CC_EC_MONT_MOD_SIZE_IN_BYTES        32
+/*! The size of the X25519 scalar (secret key) in bytes. */
+#define CC_EC_MONT_SCALAR_SIZE_IN_BYTES     32
+
+/************************ Public Functions **********************/
+
+/*!
+@brief This function computes the X25519 function of the scalar and the u-coordinate: the scalar is clamped,
+and the most significant bit of the u-coordinate is ignored, as defined in RFC 7748.
+
+@return \c CC_OK on success.
+@return \c CC_EC_MONT_SHARED_SECRET_IS_ZERO_ERROR if the result is zero (the input point is of small order).
+@return A non-zero value on failure as defined in cc_ec_mont_edw_error.h.
+*/
+CIMPORT_C CCError_t CC_EcMontScalarmult(
+                    uint8_t                     *pResPoint,       /*!< [out] Pointer to the u-coordinate of the result. */
+                    size_t                      *pResPointSize,   /*!< [in/out] The size of the result buffer (in), and the result size in bytes (out). */
+                    const uint8_t               *pScalar,         /*!< [in] Pointer to the scalar. */
+                    size_t                      scalarSize,       /*!< [in] The scalar size in bytes - ::CC_EC_MONT_SCALAR_SIZE_IN_BYTES. */
+                    const uint8_t               *pInPoint,        /*!< [in] Pointer to the u-coordinate of the input point. */
+                    size_t                      inPointSize       /*!< [in] The input point size in bytes - ::CC_EC_MONT_MOD_SIZE_IN_BYTES. */
+);
+
+/*!
+@brief This function computes the X25519 function of the scalar and the base point u = 9: the public key of the scalar.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ec_mont_edw_error.h.
+*/
+CIMPORT_C CCError_t CC_EcMontScalarmultBase(
+                    uint8_t                     *pResPoint,       /*!< [out] Pointer to the u-coordinate of the result. */
+                    size_t                      *pResPointSize,   /*!< [in/out] The size of the result buffer (in), and the result size in bytes (out). */
+                    const uint8_t               *pScalar,         /*!< [in] Pointer to the scalar. */
+                    size_t                      scalarSize        /*!< [in] The scalar size in bytes - ::CC_EC_MONT_SCALAR_SIZE_IN_BYTES. */
+);
+
+/*!
+@brief This function generates a random X25519 secret key and its public key.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ec_mont_edw_error.h or cc_rnd_error.h.
+*/
+CIMPORT_C CCError_t CC_EcMontKeyPair(
+                    uint8_t                     *pPublKey,        /*!< [out] Pointer to the public key. */
+                    size_t                      *pPublKeySize,    /*!< [in/out] The size of the public key buffer (in), and the key size in bytes (out). */
+                    uint8_t                     *pSecrKey,        /*!< [out] Pointer to the secret key. */
+                    size_t                      *pSecrKeySize,    /*!< [in/out] The size of the secret key buffer (in), and the key size in bytes (out). */
+                    CCRndGenerateVectWorkFunc_t f_rng,            /*!< [in] Pointer to DRBG function. */
+                    void                        *p_rng            /*!< [in/out] Pointer to the random context - the input to f_rng. */
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+@}
+ */
+#endif
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_ECPKI_ECIES_HYBRID_H
+#define _CC_ECPKI_ECIES_HYBRID_H
+
+/*!
+@file
+@brief This file defines the APIs of the hybrid ECIES - ECIES-KEM followed by a streaming data encapsulation (DEM).
+
+The encryption (or decryption) is initialized by the ECIES-KEM of ::EciesKemEncrypt (or ::CC_EciesKemDecrypt),
+and the secret keying data of the KEM keys the DEM:
+<ul><li> ::CC_ECIES_DEM_AES_CTR_HMAC - AES-CTR with a zero initial counter, and HMAC of the ciphertext.
+     The keying data is the AES key followed by the HMAC key, of the size of the KDF digest.</li>
+<li> ::CC_ECIES_DEM_AES_CBC_HMAC - AES-CBC with a zero IV and PKCS7 padding, and HMAC of the ciphertext.
+     The keying data is as for ::CC_ECIES_DEM_AES_CTR_HMAC.</li>
+<li> ::CC_ECIES_DEM_AES_GCM - AES-GCM. The keying data is the AES key followed by a 12 bytes IV.</li></ul>
+Each KEM output is a fresh key, so the fixed IV or initial counter is never reused with the same key.
+
+The message is processed by ::CC_EciesHybridUpdate in chunks of any size, and ::CC_EciesHybridFinish
+outputs the last part and produces (on encryption) or verifies (on decryption) the tag. The data passes
+the AES and the HMAC engines once, without intermediate copies of the message or of a keystream.
+
+\note On decryption, the output of ::CC_EciesHybridUpdate must not be used before ::CC_EciesHybridFinish
+      verifies the tag.
+ */
+
+/*!
+ @addtogroup cc_ecies_apis
+ @{
+  */
+
+#include "cc_ecpki_types.h"
+#include "cc_rnd_common.h"
+#include "cc_kdf.h"
+#include "cc_cert_ctx.h"
+#include "cc_aes_defs.h"
+#include "cc_aesgcm.h"
+#include "cc_hmac.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/************************ Defines ******************************/
+/*! The size of the AES-GCM IV taken from the keying data in bytes. */
+#define CC_ECIES_DEM_GCM_IV_SIZE_IN_BYTES       12
+/*! The maximal size of a tag in bytes (HMAC with SHA-512). */
+#define CC_ECIES_DEM_MAX_TAG_SIZE_IN_BYTES      CC_HASH_SHA512_DIGEST_SIZE_IN_BYTES
+
+/************************ Enums ********************************/
+/*! The DEM of the hybrid ECIES. */
+typedef enum {
+    /*! AES-CTR and HMAC of the ciphertext. */
+    CC_ECIES_DEM_AES_CTR_HMAC = 0,
+    /*! AES-CBC with PKCS7 padding and HMAC of the ciphertext. */
+    CC_ECIES_DEM_AES_CBC_HMAC = 1,
+    /*! AES-GCM. */
+    CC_ECIES_DEM_AES_GCM      = 2,
+    /*! The number of DEM modes. */
+    CC_ECIES_DEM_NumOfModes,
+    /*! Reserved. */
+    CC_ECIES_DEM_ModeLast     = 0x7FFFFFFF,
+}CCEciesDemMode_t;
+
+/************************ Typedefs  ****************************/
+/*! The context of the hybrid ECIES. The fields are internal and should not be accessed by the user. */
+typedef struct CCEciesHybridContext_t
+{
+    uint32_t                    validTag;
+    CCAesEncryptMode_t          encryptDecryptFlag;
+    CCEciesDemMode_t            demMode;
+    /* the cipher context of the DEM */
+    union {
+        CCAesUserContext_t      aes;
+        CCAesGcmUserContext_t   gcm;
+    }cipherCtx;
+    /* the MAC context of the HMAC modes */
+    CCHmacUserContext_t         hmacCtx;
+    uint32_t                    tagSize;
+    /* the text size, declared on init for the AES-GCM mode, and the size processed */
+    size_t                      textSize;
+    size_t                      processedSize;
+    /* the input that does not complete an AES block */
+    uint8_t                     remainingBuff[CC_AES_BLOCK_SIZE_IN_BYTES];
+    uint32_t                    remainingSize;
+}CCEciesHybridContext_t;
+
+/************************ Public Functions **********************/
+
+/*!
+@brief This function initializes the hybrid ECIES encryption: it runs the ECIES-KEM encryption as ::EciesKemEncrypt,
+outputs the KEM ciphertext C0 (the ephemeral public key), and keys the DEM with the secret keying data.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h, cc_kdf_error.h, cc_aes_error.h, cc_aesgcm_error.h or cc_hmac_error.h.
+*/
+CIMPORT_C CCError_t CC_EciesHybridEncryptInit(
+                    CCEciesHybridContext_t      *pContext,         /*!< [out] Pointer to the context. */
+                    CCEcpkiUserPublKey_t        *pRecipUzPublKey,  /*!< [in] A pointer to the public key of the recipient. */
+                    CCKdfDerivFuncMode_t        kdfDerivMode,      /*!< [in] The KDF function mode - KDF1 or KDF2. */
+                    CCKdfHashOpMode_t           kdfHashMode,       /*!< [in] The HASH function of the KDF and of the HMAC. */
+                    uint32_t                    isSingleHashMode,  /*!< [in] Specific ECIES mode definition 0,1 according to ISO/IEC 18033-2 - sec.10.2. */
+                    CCEciesDemMode_t            demMode,           /*!< [in] The DEM. */
+                    size_t                      demKeySize,        /*!< [in] The AES key size in bytes - 16, 24 or 32. */
+                    size_t                      textSize,          /*!< [in] The full size of the message in bytes. Used by the AES-GCM mode only. */
+                    uint8_t                     *pCipherData,      /*!< [out] A pointer to the KEM ciphertext C0. */
+                    size_t                      *pCipherDataSize,  /*!< [in/out] A pointer to the size of the C0 buffer (in) and its actual size in bytes (out). */
+                    CCEciesTempData_t           *pTempBuff,        /*!< [in] Temporary buffer for internal usage. */
+                    CCRndGenerateVectWorkFunc_t f_rng,             /*!< [in] Pointer to DRBG function. */
+                    void                        *p_rng,            /*!< [in/out] Pointer to the random context - the input to f_rng. */
+                    CCEcpkiKgCertContext_t      *pFipsCtx          /*!< [in] Pointer to temporary buffer used in case FIPS or Chinese certification is required (may be NULL). */
+);
+
+/*!
+@brief This function initializes the hybrid ECIES decryption: it runs the ECIES-KEM decryption of C0 as ::CC_EciesKemDecrypt,
+and keys the DEM with the secret keying data.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h, cc_kdf_error.h, cc_aes_error.h, cc_aesgcm_error.h or cc_hmac_error.h.
+*/
+CIMPORT_C CCError_t CC_EciesHybridDecryptInit(
+                    CCEciesHybridContext_t      *pContext,         /*!< [out] Pointer to the context. */
+                    CCEcpkiUserPrivKey_t        *pRecipUzPrivKey,  /*!< [in] A pointer to the private key of the recipient. */
+                    CCKdfDerivFuncMode_t        kdfDerivMode,      /*!< [in] The KDF function mode - KDF1 or KDF2. */
+                    CCKdfHashOpMode_t           kdfHashMode,       /*!< [in] The HASH function of the KDF and of the HMAC. */
+                    uint32_t                    isSingleHashMode,  /*!< [in] Specific ECIES mode definition 0,1 according to ISO/IEC 18033-2 - sec.10.2. */
+                    CCEciesDemMode_t            demMode,           /*!< [in] The DEM. */
+                    size_t                      demKeySize,        /*!< [in] The AES key size in bytes - 16, 24 or 32. */
+                    size_t                      textSize,          /*!< [in] The full size of the DEM ciphertext in bytes, without the tag. Used by the AES-GCM mode only. */
+                    uint8_t                     *pCipherData,      /*!< [in] A pointer to the KEM ciphertext C0. */
+                    size_t                      cipherDataSize,    /*!< [in] The size of C0 in bytes. */
+                    CCEciesTempData_t           *pTempBuff         /*!< [in] Temporary buffer for internal usage. */
+);
+
+/*!
+@brief This function encrypts or decrypts a chunk of the message. The chunks may be of any size: the input
+that does not complete an AES block is kept in the context, so the output size may differ from the input size.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h, cc_aes_error.h, cc_aesgcm_error.h or cc_hmac_error.h.
+*/
+CIMPORT_C CCError_t CC_EciesHybridUpdate(
+                    CCEciesHybridContext_t      *pContext,         /*!< [in/out] Pointer to the context. */
+                    uint8_t                     *pDataIn,          /*!< [in] Pointer to the input data. */
+                    size_t                      dataInSize,        /*!< [in] The size of the input data in bytes. */
+                    uint8_t                     *pDataOut,         /*!< [out] Pointer to the output data. */
+                    size_t                      *pDataOutSize      /*!< [in/out] The size of the output buffer (in) - at least dataInSize + 16 bytes,
+                                                                                 and the size of the output data in bytes (out). */
+);
+
+/*!
+@brief This function completes the hybrid ECIES: it processes the remaining data, and produces the tag on encryption,
+or verifies it on decryption. The context is zeroized.
+
+@return \c CC_OK on success.
+@return \c CC_ECIES_TAG_VERIFY_FAILED_ERROR if the decrypted message is not authentic.
+@return A non-zero value on failure as defined in cc_ecpki_error.h, cc_aes_error.h, cc_aesgcm_error.h or cc_hmac_error.h.
+*/
+CIMPORT_C CCError_t CC_EciesHybridFinish(
+                    CCEciesHybridContext_t      *pContext,         /*!< [in/out] Pointer to the context. */
+                    uint8_t                     *pDataOut,         /*!< [out] Pointer to the output of the last part of the data. */
+                    size_t                      *pDataOutSize,     /*!< [in/out] The size of the output buffer (in) - at least 16 bytes,
+                                                                                 and the size of the output data in bytes (out). */
+                    uint8_t                     *pTag,             /*!< [in/out] Pointer to the tag - output on encryption, input on decryption. */
+                    size_t                      *pTagSize          /*!< [in/out] The size of the tag buffer (in), and the tag size in bytes (out):
+                                                                                 the KDF digest size on HMAC modes, 16 bytes on AES-GCM mode. */
+);
+
+/*!
+@brief This function zeroizes the context of an operation that is not completed.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h.
+*/
+CIMPORT_C CCError_t CC_EciesHybridFree(
+                    CCEciesHybridContext_t      *pContext          /*!< [in/out] Pointer to the context. */
+);
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+ @}
+ */
+#endif
@@ -38,8 +38,10 @@
 #define CC_PKA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS
 /*! The maximal size of the PKA public-key in words. */
 #define CC_PKA_PUB_KEY_BUFF_SIZE_IN_WORDS (2*CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS)
+/*! The maximal count of prime factors of an RSA key on CRT mode (multi-prime keys). */
+#define CC_RSA_MAX_PRIMES_COUNT  3
 /*! The maximal size of the PKA private-key in words. */
-#define CC_PKA_PRIV_KEY_BUFF_SIZE_IN_WORDS (2*CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS)
+#define CC_PKA_PRIV_KEY_BUFF_SIZE_IN_WORDS (CC_RSA_MAX_PRIMES_COUNT*CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS)
 /*! The maximal size of the PKA KG buffer in words. */
 #define CC_PKA_KGDATA_BUFF_SIZE_IN_WORDS   (3*CC_PKA_BARRETT_MOD_TAG_BUFF_SIZE_IN_WORDS + 3*CC_PKA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS)
 
@@ -72,8 +74,10 @@
 #define CC_PKA_ECDH_BUFF_MAX_LENGTH_IN_WORDS (2*CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + CC_PKA_ECPKI_SCALAR_MUL_BUFF_MAX_LENGTH_IN_WORDS)
 /*! The size of the PKA KG temporary-buffer in words. */
 #define CC_PKA_KG_BUFF_MAX_LENGTH_IN_WORDS (2*CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + CC_PKA_ECPKI_SCALAR_MUL_BUFF_MAX_LENGTH_IN_WORDS)
+/*! The size of the buffer of the double scalar multiplication of the ECC verify in words. */
+#define CC_PKA_ECDSA_VERIFY_2MUL_BUFF_MAX_LENGTH_IN_WORDS (16*CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS + 18*CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + 3)
 /*! The size of the ECC verify temporary-buffer in words. */
-#define CC_PKA_ECDSA_VERIFY_BUFF_MAX_LENGTH_IN_WORDS (3*CC_ECPKI_MODUL_MAX_LENGTH_IN_WORDS)
+#define CC_PKA_ECDSA_VERIFY_BUFF_MAX_LENGTH_IN_WORDS (3*CC_ECPKI_ORDER_MAX_LENGTH_IN_WORDS + CC_PKA_ECDSA_VERIFY_2MUL_BUFF_MAX_LENGTH_IN_WORDS)
 
 /*!
  @}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_PKA_PROF_H_
+#define _CC_PKA_PROF_H_
+
+/*!
+ @file
+ @brief This file contains the PKA profiler APIs. The profiler is disabled by default.
+
+        The profiler counts and times every PKA operation, PKA register copy, wait on PKA done
+        and modular inversion, under the stack of the asymmetric API that issued it (ECDSA
+        sign/verify, RSA private key on CRT and non-CRT modes, RSA public key, DH).
+        The profile is dumped in the folded stacks format, one stack per line:
+        \code EcdsaSignFinish;PkaExecFullModInv;MODINV 51230 \endcode
+        which is the input of flamegraph.pl and of most flame graph viewers.
+
+        The profiler is compiled in with \c PKA_PROFILE (PKA_PROFILE=1), which requires LIB_PERF=1:
+        the times are taken with the backend of CC_PalPerf, so CC_PalPerfInit() must be called
+        before profiling. Every PKA operation is waited for before the next one is issued, so the
+        time of an operation is its own execution time, but the total time is longer than without
+        the profiler. The profiler is not thread safe, it is meant for single threaded tuning runs.
+ */
+
+#include "cc_pal_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*! Value dumped for each stack of the profile. */
+typedef enum {
+    /*! Self time of the stack, in the units of the perf backend. */
+    CC_PKA_PROF_VALUE_TIME,
+    /*! Number of times the stack was executed. */
+    CC_PKA_PROF_VALUE_COUNT,
+    CC_PKA_PROF_VALUE_RESERVE32 = 0x7FFFFFFF
+} CCPkaProfValue_t;
+
+#ifdef PKA_PROFILE
+
+#define CC_PKA_PROF_RESET()                     CC_PkaProfReset()
+#define CC_PKA_PROF_DUMP(value, fileName)       CC_PkaProfDumpToFile(value, fileName)
+
+/*!
+  @brief This function clears the profile.
+ */
+void CC_PkaProfReset(void);
+
+/*!
+  @brief This function writes the profile in the folded stacks format.
+         The count of frames that did not fit in the profile is written in a "[lost]" line.
+
+  @return \c 0 on success.
+  @return A non-zero value on failure.
+ */
+int CC_PkaProfDumpToFile(
+    /*! [in] The value dumped for each stack. */
+    CCPkaProfValue_t value,
+    /*! [in] The output file name, or NULL for stdout. */
+    const char *pFileName);
+
+#else  /* PKA_PROFILE */
+
+#define CC_PKA_PROF_RESET()                     do {} while (0)
+#define CC_PKA_PROF_DUMP(value, fileName)       (0)
+
+#endif /* PKA_PROFILE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_CC_PKA_PROF_H_*/
@@ -81,6 +81,8 @@ extern "C"
 /*! SM2-  Max size of input and ID -
  * chosen based on implementation of certification KAT tests.*/
 #define CERT_SM2_DEFAULT_INPUT_AND_ID_SIZE  32
+/*! SM2 - The maximal count of items of a batch. The PKA is held for the whole batch. */
+#define CC_SM2_BATCH_MAX_ITEMS_COUNT        32
 
 
 
@@ -155,6 +157,32 @@ typedef struct CC_Sm2KeContext_t {
     size_t                      Z_value_size;
 } CC_Sm2KeContext_t;
 
+/*! One signature of ::CC_Sm2VerifyBatch. The fields are the parameters of ::CC_Sm2Verify. */
+typedef struct CCSm2VerifyBatchItem_t {
+    /*! A pointer to a public key structure. */
+    const CCEcpkiUserPublKey_t      *pUserPublKey;
+    /*! A pointer to the signature to be verified. */
+    uint8_t                         *pSignatureIn;
+    /*! The size of the signature (in bytes). */
+    size_t                          SignatureSizeBytes;
+    /*! A pointer to the hash of the input data that was signed. */
+    const uint32_t                  *pHashInput;
+    /*! Size in words of the hash of the input data. */
+    size_t                          HashInputSize;
+} CCSm2VerifyBatchItem_t;
+
+/*! One key exchange of ::CC_Sm2CalculateSharedSecretBatch. The fields are the parameters of ::CC_Sm2CalculateSharedSecret. */
+typedef struct CCSm2KeBatchItem_t {
+    /*! A pointer to the key exchange context. */
+    CC_Sm2KeContext_t               *pCtx;
+    /*! A pointer to the random point from the second party. */
+    const CCEcpkiUserPublKey_t      *pRandomPoint;
+    /*! The output confirmation value. */
+    uint8_t                         *pConfirmationValueOut;
+    /*! A pointer to the output confirmation value size in bytes. */
+    size_t                          *pConfirmationValueOutSize;
+} CCSm2KeBatchItem_t;
+
 /**************************************************************************
  *                    CC_Sm2Sign
  **************************************************************************/
@@ -210,6 +238,28 @@ CIMPORT_C CCError_t CC_Sm2Verify (
 );
 
 
+/**************************************************************************
+ *                    CC_Sm2VerifyBatch
+ **************************************************************************/
+/*!
+@brief This function verifies a batch of SM2 signatures, as ::CC_Sm2Verify for each item.
+
+ @details All the signatures are verified in a single PKA session, so that the PKA initialization,
+ the asymmetric mutex and the PKA clearing are shared by the batch. The PKA is held until the whole
+ batch is verified.
+
+@return \c CC_OK if all the signatures are valid.
+@return \c CC_ECPKI_SM2_BATCH_ITEM_FAILED if any item failed; the result of each item is set in pResults.
+@return A non-zero value on failure as defined cc_ecpki_error.h.
+*/
+
+CIMPORT_C CCError_t CC_Sm2VerifyBatch (
+        const CCSm2VerifyBatchItem_t    *pItems,               /*!< [in]     A pointer to the signatures to be verified. */
+        const size_t                    itemsCount,            /*!< [in]     The count of items, up to ::CC_SM2_BATCH_MAX_ITEMS_COUNT. */
+        CCError_t                       *pResults              /*!< [out]    A pointer to the result of each item, as returned by ::CC_Sm2Verify. */
+);
+
+
 /******************************************************************************
  *                CC_Sm2ComputeMessageDigest
  ******************************************************************************/
@@ -230,7 +280,9 @@ CIMPORT_C CCError_t CC_Sm2ComputeMessageDigest (
         const size_t                msglen,         /*!< [in]       The size of the message in bytes. */
         uint8_t                     *pWorkingBuffer,/*!< [in]       The working buffer. */
         const size_t                wblen,          /*!< [in]       The working buffer size should be at least
-                                                                            2 + modSizeInBytes*4 + ordSizeInBytes*2 + idlen + msglen*/
+                                                                            2 + modSizeInBytes*4 + ordSizeInBytes*2 + idlen.
+                                                                            The message is hashed in place and is not copied
+                                                                            to the working buffer. */
 
         uint32_t                    *pOut,          /*!< [out]     A pointer to a buffer for the output. */
         size_t                      *pOutlen        /*!< [in/out]  A pointer to the output length in words. */
@@ -334,6 +386,32 @@ CIMPORT_C CCError_t CC_Sm2CalculateSharedSecret (
 
 
 
+/**************************************************************************
+ *                    CC_Sm2CalculateSharedSecretBatch
+ * *************************************************************************/
+/*!
+
+@brief Calculates the shared secrets and confirmation values of a batch of key exchanges,
+ as ::CC_Sm2CalculateSharedSecret for each item.
+
+@details The shared secrets of all the key exchanges are calculated in a single PKA session,
+ so that the PKA initialization, the asymmetric mutex and the PKA clearing are shared by the batch.
+ The confirmation values are calculated after the PKA is released. The context of a failed item
+ is cleared, as by ::CC_Sm2CalculateSharedSecret, and the other items are not affected.
+
+@return \c CC_OK if all the items succeeded.
+@return \c CC_ECPKI_SM2_BATCH_ITEM_FAILED if any item failed; the result of each item is set in pResults.
+@return A non-zero value on failure.
+ */
+
+CIMPORT_C CCError_t CC_Sm2CalculateSharedSecretBatch (
+        const CCSm2KeBatchItem_t    *pItems,                    /*!< [in/out]   A pointer to the key exchanges. */
+        const size_t                itemsCount,                 /*!< [in]       The count of items, up to ::CC_SM2_BATCH_MAX_ITEMS_COUNT. */
+        CCError_t                   *pResults                   /*!< [out]      A pointer to the result of each item, as returned by ::CC_Sm2CalculateSharedSecret. */
+);
+
+
+
 /**************************************************************************
  *                    CC_Sm2Confirmation
  * *************************************************************************/
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_SM2_ZA_CACHE_H
+#define _CC_SM2_ZA_CACHE_H
+
+
+#include "cc_error.h"
+#include "cc_pal_types.h"
+#include "cc_ecpki_types.h"
+#include "cc_rnd_common.h"
+#include "cc_sm3_defs.h"
+#include "cc_sm2.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*!
+@file
+@brief This file defines the SM2 ZA cache and the SM2 sign and verify APIs of a prepared signer.
+
+Every SM2 signature and verification hashes the message with the identity digest of the signer,
+ZA = SM3(ENTL || ID || a || b || xG || yG || xA || yA). A signer prepared by ::CC_Sm2SignerInit
+holds ZA, so ::CC_Sm2SignWithSigner and ::CC_Sm2VerifyWithSigner hash only ZA || M.
+
+The ZA cache keeps the identity digests of recently prepared signers, keyed by the public key and
+the ID, so that preparing a known signer again does not recompute ZA. The cache is direct-mapped:
+a new signer replaces the signer recorded in its entry.
+ */
+ /*!
+ @addtogroup cc_sm2
+ @{
+*/
+
+/************************ Defines ******************************/
+/*! Maximal size of an ID recorded by the ZA cache in bytes. The ZA of a longer ID is not cached. */
+#define CC_SM2_ZA_CACHE_ID_MAX_SIZE_IN_BYTES      32
+
+/************************ Typedefs  ****************************/
+/*! One entry of the ZA cache. The entries are provided by the caller. */
+typedef struct
+{
+    /*! Non zero if the entry records a signer. */
+    uint32_t                    isValid;
+    /*! The ID size in bytes. */
+    uint32_t                    idSize;
+    /*! The ID. */
+    uint8_t                     id[CC_SM2_ZA_CACHE_ID_MAX_SIZE_IN_BYTES];
+    /*! The public key coordinates, in little-endian words. */
+    uint32_t                    pubKeyX[CC_SM2_MODULE_LENGTH_IN_WORDS];
+    uint32_t                    pubKeyY[CC_SM2_MODULE_LENGTH_IN_WORDS];
+    /*! The identity digest ZA. */
+    uint8_t                     za[CC_SM3_RESULT_SIZE_IN_BYTES];
+}CCSm2ZaCacheEntry_t;
+
+/*! The ZA cache. The fields are internal and should not be accessed by the user. */
+typedef struct CCSm2ZaCache_t
+{
+    uint32_t                    validTag;
+    CCSm2ZaCacheEntry_t         *pEntries;
+    uint32_t                    entriesCount;
+    /* counters of the prepared signers */
+    uint32_t                    hitsCount;
+    uint32_t                    missesCount;
+}CCSm2ZaCache_t;
+
+/*! A prepared signer: the public key and the identity digest of a signer. */
+typedef struct CCSm2Signer_t
+{
+    uint32_t                    validTag;
+    /*! The public key of the signer. */
+    CCEcpkiUserPublKey_t        pubKey;
+    /*! The identity digest ZA of the signer. */
+    uint8_t                     za[CC_SM3_RESULT_SIZE_IN_BYTES];
+    /*! Non zero if the signer was prepared with the private key of its public key. */
+    uint32_t                    isPrivKeyBound;
+    /*! The SM3 digest of the private key bound to the signer. */
+    uint8_t                     privKeyDigest[CC_SM3_RESULT_SIZE_IN_BYTES];
+}CCSm2Signer_t;
+
+/************************ Public Functions **********************/
+
+/*!
+@brief This function initializes an empty ZA cache.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h.
+*/
+CIMPORT_C CCError_t CC_Sm2ZaCacheInit(
+                    CCSm2ZaCache_t          *pCache,          /*!< [out] Pointer to the cache. */
+                    CCSm2ZaCacheEntry_t     *pEntries,        /*!< [in] Pointer to the cache entries. */
+                    uint32_t                entriesCount      /*!< [in] The count of entries - the maximal count of cached signers. */
+);
+
+/*!
+@brief This function returns the counters of the cache: a hit is a signer prepared with the cached ZA,
+and a miss is a signer whose ZA was computed.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h.
+*/
+CIMPORT_C CCError_t CC_Sm2ZaCacheStatsGet(
+                    CCSm2ZaCache_t          *pCache,          /*!< [in] Pointer to the cache. */
+                    uint32_t                *pHitsCount,      /*!< [out] The count of hits. */
+                    uint32_t                *pMissesCount     /*!< [out] The count of misses. */
+);
+
+/*!
+@brief This function zeroizes the entries and the cache structure.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h.
+*/
+CIMPORT_C CCError_t CC_Sm2ZaCacheFree(
+                    CCSm2ZaCache_t          *pCache           /*!< [in/out] Pointer to the cache. */
+);
+
+/*!
+@brief This function prepares a signer: it copies the public key and sets the identity digest ZA,
+from the cache if the signer is cached, or by computing it.
+
+If the private key is given, the function checks that it is the private key of the public key,
+and binds it to the signer: only a signer prepared with its private key signs, and only with that key.
+A signer prepared without a private key only verifies.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h or cc_sm3_error.h.
+*/
+CIMPORT_C CCError_t CC_Sm2SignerInit(
+                    CCSm2ZaCache_t              *pCache,          /*!< [in/out] Pointer to the ZA cache, or NULL to compute ZA without a cache. */
+                    const CCEcpkiUserPublKey_t  *pUserPublKey,    /*!< [in] Pointer to the public key of the signer. */
+                    const char                  *pId,             /*!< [in] Pointer to the ID of the signer. */
+                    const size_t                idlen,            /*!< [in] The size of ID in bytes. */
+                    const CCEcpkiUserPrivKey_t  *pSm2PrivKey,     /*!< [in] Pointer to the private key of the signer, or NULL for a signer that only verifies. */
+                    CCSm2Signer_t               *pSigner          /*!< [out] Pointer to the signer. */
+);
+
+/*!
+@brief This function signs a message of a prepared signer, as ::CC_Sm2ComputeMessageDigest followed by ::CC_Sm2Sign.
+The private key must be the one the signer was prepared with by ::CC_Sm2SignerInit.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h, cc_sm3_error.h or cc_rnd_error.h.
+*/
+CIMPORT_C CCError_t CC_Sm2SignWithSigner(
+                    CCRndGenerateVectWorkFunc_t f_rng,             /*!< [in] A pointer to DRBG function.*/
+                    void                        *p_rng,            /*!< [in/out] A pointer to the random context - the input to f_rng.*/
+                    const CCSm2Signer_t         *pSigner,          /*!< [in] Pointer to the signer. */
+                    const CCEcpkiUserPrivKey_t  *pSm2PrivKey,      /*!< [in] A pointer to the private key bound to the signer. */
+                    const uint8_t               *pMsg,             /*!< [in] A pointer to the message. */
+                    const size_t                msglen,            /*!< [in] The size of the message in bytes. */
+                    uint8_t                     *pSignatureOut,    /*!< [out] Pointer to a buffer for output of signature. */
+                    size_t                      *pSignatureOutSize /*!< [in/out] A pointer to the signature size, as for ::CC_Sm2Sign. */
+);
+
+/*!
+@brief This function verifies a signature of a prepared signer, as ::CC_Sm2ComputeMessageDigest followed by ::CC_Sm2Verify.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_ecpki_error.h or cc_sm3_error.h.
+*/
+CIMPORT_C CCError_t CC_Sm2VerifyWithSigner(
+                    const CCSm2Signer_t         *pSigner,          /*!< [in] Pointer to the signer. */
+                    uint8_t                     *pSignatureIn,     /*!< [in] A pointer to the signature to be verified. */
+                    const size_t                SignatureSizeBytes,/*!< [in] The size of the signature in bytes. */
+                    const uint8_t               *pMsg,             /*!< [in] A pointer to the message. */
+                    const size_t                msglen             /*!< [in] The size of the message in bytes. */
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+@}
+ */
+#endif
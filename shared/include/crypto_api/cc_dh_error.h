@@ -102,6 +102,8 @@ extern "C"
 #define CC_DH_PRIME_Q_GENERATION_FAILURE_ERROR                	(CC_DH_MODULE_ERROR_BASE + 0x2FUL)
 /*! Internal PKI error */
 #define CC_DH_INTERNAL_ERROR                                 	(CC_DH_MODULE_ERROR_BASE + 0x30UL)
+/*! Illegal named group. */
+#define CC_DH_INVALID_NAMED_GROUP_ERROR                      	(CC_DH_MODULE_ERROR_BASE + 0x31UL)
 
 
 
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_DH_GROUPS_H
+#define _CC_DH_GROUPS_H
+
+#include "cc_pal_types.h"
+#include "cc_error.h"
+#include "cc_rnd_common.h"
+#include "cc_dh.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*!
+@file
+@brief This file defines the API of the Diffie-Hellman named groups: the safe-prime MODP groups of
+       RFC 3526 and the FFDHE groups of RFC 7919, all with generator 2.
+
+The private keys of a named group may be short: according to NIST SP 800-56A Rev.3, section 5.6.1.1.4,
+a private key of 2*s bits, where s is the security strength of the group, is sufficient.
+The public key of a short private key is calculated with a precomputed fixed-base comb table of the
+group generator, if the library is built with CC_CONFIG_SUPPORT_DH_FIXED_BASE_COMB; other private keys
+are exponentiated by the PKA.
+The shared secret is calculated by ::CC_DhGetSecretKey with the group prime.
+ */
+/*!
+ @addtogroup cc_dh_groups
+ @{
+*/
+
+/************************ Defines ******************************/
+/*! Value of prvKeySizeInBits of ::CC_DhNamedGroupGeneratePubPrv for a private key in full range [1, q-1]. */
+#define CC_DH_NAMED_GROUP_FULL_PRV_KEY      0
+/*! The generator of the named groups. */
+#define CC_DH_NAMED_GROUP_GENERATOR         2
+
+/************************ Enums ********************************/
+/*! DH named group identifiers. */
+typedef enum
+{
+    /*! RFC 3526 2048-bit MODP group. */
+    CC_DH_NAMED_GROUP_MODP2048     = 0,
+    /*! RFC 3526 3072-bit MODP group. */
+    CC_DH_NAMED_GROUP_MODP3072     = 1,
+    /*! RFC 3526 4096-bit MODP group. */
+    CC_DH_NAMED_GROUP_MODP4096     = 2,
+    /*! RFC 7919 ffdhe2048 group. */
+    CC_DH_NAMED_GROUP_FFDHE2048    = 3,
+    /*! RFC 7919 ffdhe3072 group. */
+    CC_DH_NAMED_GROUP_FFDHE3072    = 4,
+    /*! RFC 7919 ffdhe4096 group. */
+    CC_DH_NAMED_GROUP_FFDHE4096    = 5,
+    /*! Maximal number of named groups. */
+    CC_DH_NAMED_GROUP_NumOfGroups,
+    /*! Reserved. */
+    CC_DH_NAMED_GROUP_Last         = 0x7FFFFFFF,
+}CCDhNamedGroupId_t;
+
+/************************ Typedefs  ****************************/
+/*! DH named group. The prime p is a safe prime: the generator 2 generates the subgroup of order q = (p-1)/2. */
+typedef struct
+{
+    /*! The group identifier. */
+    CCDhNamedGroupId_t      groupId;
+    /*! Pointer to the prime p, MSByte first. */
+    const uint8_t           *pPrime;
+    /*! The prime size in bytes. */
+    size_t                  primeSizeInBytes;
+    /*! The security strength of the group in bits. */
+    uint32_t                securityStrengthBits;
+}CCDhNamedGroup_t;
+
+/************************ Public Functions **********************/
+
+/*!
+@brief This function returns the named group of the identifier.
+
+@return Pointer to the named group, or NULL if the identifier is illegal.
+*/
+CIMPORT_C const CCDhNamedGroup_t *CC_DhGetNamedGroup(
+                    CCDhNamedGroupId_t      groupId         /*!< [in] The group identifier. */
+);
+
+/*!
+@brief This function generates a DH key pair of a named group according to NIST SP 800-56A Rev.3,
+section 5.6.1.1.4: the private key x is random in range [1, M-1], M = min(2^N, q), and the public key
+is y = 2^x mod p.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_dh_error.h or cc_rnd_error.h.
+*/
+CIMPORT_C CCError_t CC_DhNamedGroupGeneratePubPrv(
+                    CCRndGenerateVectWorkFunc_t  f_rng,         /*!< [in] Pointer to DRBG function. */
+                    void                    *p_rng,             /*!< [in/out] Pointer to the random context - the input to f_rng. */
+                    const CCDhNamedGroup_t  *pGroup,            /*!< [in] Pointer to the named group, as returned by ::CC_DhGetNamedGroup. */
+                    size_t                  prvKeySizeInBits,   /*!< [in] The private key size N in bits, 2*s <= N <= len(q), where s is
+                                                                          the security strength of the group, or ::CC_DH_NAMED_GROUP_FULL_PRV_KEY. */
+                    CCDhTemp_t              *pTempBuff,         /*!< [in] Temporary buffers for internal use. */
+                    uint8_t                 *pPrvKey,           /*!< [out] Pointer to the private key, MSByte first. */
+                    size_t                  *pPrvKeySize,       /*!< [in/out] In: the private key buffer size, at least (N+7)/8 bytes.
+                                                                              Out: the private key size in bytes. */
+                    uint8_t                 *pPubKey,           /*!< [out] Pointer to the public key, MSByte first. */
+                    size_t                  *pPubKeySize        /*!< [in/out] In: the public key buffer size, at least the prime size.
+                                                                              Out: the public key size in bytes - the prime size. */
+);
+
+/*!
+@brief This function checks a public key of a named group according to NIST SP 800-56A Rev.3,
+section 5.6.2.3.1: 1 < y < p-1 and y^q = 1 mod p.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_dh_error.h.
+*/
+CIMPORT_C CCError_t CC_DhNamedGroupCheckPubKey(
+                    const CCDhNamedGroup_t  *pGroup,            /*!< [in] Pointer to the named group. */
+                    const uint8_t           *pPubKey,           /*!< [in] Pointer to the public key, MSByte first. */
+                    size_t                  pubKeySize,         /*!< [in] The public key size in bytes, not greater than the prime size. */
+                    CCDhTemp_t              *pTempBuff          /*!< [in] Temporary buffers for internal use. */
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+@}
+ */
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_EC_MONT_EDW_ERROR_H
+#define _CC_EC_MONT_EDW_ERROR_H
+
+#include "cc_error.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*!
+ @file
+ @brief This file contains the definitions of the CryptoCell X25519 and Ed25519 errors.
+ */
+
+ /*!
+ @addtogroup cc_ec_mont_edw_error
+ @{
+ */
+
+
+/************************ Defines *******************************/
+
+/*! CryptoCell X25519 and Ed25519 module errors / base address - 0x00F02300. */
+/*! Invalid input pointer. */
+#define CC_EC_MONT_INVALID_INPUT_POINTER_ERROR      \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x00UL)
+/*! Invalid input size. */
+#define CC_EC_MONT_INVALID_INPUT_SIZE_ERROR         \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x01UL)
+/*! Invalid output size. */
+#define CC_EC_MONT_INVALID_OUTPUT_SIZE_ERROR        \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x02UL)
+/*! The shared secret is zero: the peer public key is of small order. */
+#define CC_EC_MONT_SHARED_SECRET_IS_ZERO_ERROR      \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x03UL)
+/*! Invalid RND function pointer. */
+#define CC_EC_MONT_INVALID_RND_FUNC_PTR_ERROR       \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x04UL)
+/*! Invalid input pointer. */
+#define CC_EC_EDW_INVALID_INPUT_POINTER_ERROR       \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x10UL)
+/*! Invalid input size. */
+#define CC_EC_EDW_INVALID_INPUT_SIZE_ERROR          \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x11UL)
+/*! Invalid output size. */
+#define CC_EC_EDW_INVALID_OUTPUT_SIZE_ERROR         \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x12UL)
+/*! Invalid RND function pointer. */
+#define CC_EC_EDW_INVALID_RND_FUNC_PTR_ERROR        \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x13UL)
+/*! The public key is not an encoded point of the curve. */
+#define CC_EC_EDW_INVALID_PUBL_KEY_ERROR            \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x14UL)
+/*! Signature verification failed. */
+#define CC_EC_EDW_SIGN_VERIFY_FAILED_ERROR          \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0x15UL)
+/*! X25519 and Ed25519 not supported. */
+#define CC_EC_MONT_EDW_IS_NOT_SUPPORTED             \
+                                            (CC_EC_MONT_EDW_MODULE_ERROR_BASE + 0xFFUL)
+
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+@}
+ */
+#endif
@@ -103,6 +103,43 @@ CIMPORT_C CCError_t CC_EcdsaVerify (
                                         );
 
 
+/*! One item of a batch ECDSA verification. */
+typedef struct {
+	CCEcpkiUserPublKey_t *pUserPublKey;       /*!< [in] Pointer to the user public key structure. */
+	uint8_t              *pSignatureIn;       /*!< [in] Pointer to the signature to be verified. */
+	size_t               signatureSizeBytes;  /*!< [in] Size of the signature (in bytes). */
+	uint8_t              *pMessageDataIn;     /*!< [in] Pointer to the input data that was signed. */
+	size_t               messageSizeInBytes;  /*!< [in] Size of the input data (in bytes). */
+	CCError_t            result;              /*!< [out] \c CC_OK if the signature is valid, otherwise the error
+							     that ::CC_EcdsaVerify returns for the item. */
+} CCEcdsaVerifyBatchItem_t;
+
+/**************************************************************************
+ *	              CC_EcdsaVerifyBatch function
+ **************************************************************************/
+/*!
+@brief This function verifies a batch of ECDSA signatures on one EC domain.
+
+Each item is verified as by ::CC_EcdsaVerify, but all the items share one PKA session: the PKA is
+initialized and the domain constants are loaded once for the whole batch. The result of each item is
+returned in the item. All the public keys must be on the domain of the first valid key; other items are
+rejected with ::CC_ECDSA_VERIFY_INVALID_DOMAIN_ID_ERROR.
+
+\note The PKA is held by the calling thread for the whole batch.
+@return \c CC_OK if all the signatures are valid.
+@return ::CC_ECDSA_VERIFY_INCONSISTENT_VERIFY_ERROR if at least one item failed.
+@return Another non-zero value on failure of the batch, as defined in cc_ecpki_error.h.
+*/
+CIMPORT_C CCError_t CC_EcdsaVerifyBatch(
+					CCEcdsaVerifyUserContext_t *pVerifyUserContext, /*!< [in] Pointer to the user buffer for verifying the
+												  database, reused for each item. */
+					CCEcpkiHashOpMode_t         hashMode,           /*!< [in] One of the supported SHA-x HASH modes, as defined in
+												  ::CCEcpkiHashOpMode_t, for all the items. */
+					CCEcdsaVerifyBatchItem_t    *pItems,             /*!< [in/out] Pointer to the array of the items. */
+					size_t                      itemsCount           /*!< [in] Count of the items. */
+                                        );
+
+
 /**********************************************************************************************************/
 
 
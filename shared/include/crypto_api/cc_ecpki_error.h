@@ -221,6 +221,8 @@ extern "C"
 #define CC_ECDSA_VERIFY_FATAL_ERR_IS_LOCKED_ERR                 (CC_ECPKI_MODULE_ERROR_BASE + 0x86UL)
 /*! Secure Disable control is set. */
 #define CC_ECDSA_VERIFY_SD_ENABLED_ERR                          (CC_ECPKI_MODULE_ERROR_BASE + 0x87UL)
+/*! Illegal batch items pointer or count. */
+#define CC_ECDSA_VERIFY_INVALID_BATCH_ERROR                     (CC_ECPKI_MODULE_ERROR_BASE + 0x88UL)
 
 /************************************************************************************************************
  * CryptoCell ECPKI MODULE  COMMON ERRORS
@@ -283,6 +285,24 @@ extern "C"
 #define CC_ECPKI_SM2_FATAL_ERR_IS_LOCKED_ERR                  (CC_ECPKI_MODULE_ERROR_BASE + 0xAEUL)
 /*! Secure Disable control is set. */
 #define CC_ECPKI_SM2_SD_ENABLED_ERR                           (CC_ECPKI_MODULE_ERROR_BASE + 0xAFUL)
+/*! Illegal SM2 ZA cache pointer. */
+#define CC_ECPKI_SM2_INVALID_ZA_CACHE_PTR                     (CC_ECPKI_MODULE_ERROR_BASE + 0xB0UL)
+/*! Illegal SM2 ZA cache validation tag - the cache is not initialized. */
+#define CC_ECPKI_SM2_INVALID_ZA_CACHE                         (CC_ECPKI_MODULE_ERROR_BASE + 0xB1UL)
+/*! Illegal count of SM2 ZA cache entries. */
+#define CC_ECPKI_SM2_INVALID_ZA_CACHE_ENTRIES_COUNT           (CC_ECPKI_MODULE_ERROR_BASE + 0xB2UL)
+/*! Illegal SM2 signer pointer. */
+#define CC_ECPKI_SM2_INVALID_SIGNER_PTR                       (CC_ECPKI_MODULE_ERROR_BASE + 0xB3UL)
+/*! Illegal SM2 signer validation tag - the signer is not initialized. */
+#define CC_ECPKI_SM2_INVALID_SIGNER                           (CC_ECPKI_MODULE_ERROR_BASE + 0xB4UL)
+/*! Illegal SM2 batch pointer. */
+#define CC_ECPKI_SM2_INVALID_BATCH_PTR                        (CC_ECPKI_MODULE_ERROR_BASE + 0xB5UL)
+/*! Illegal count of SM2 batch items. */
+#define CC_ECPKI_SM2_INVALID_BATCH_ITEMS_COUNT                (CC_ECPKI_MODULE_ERROR_BASE + 0xB6UL)
+/*! At least one item of an SM2 batch failed. */
+#define CC_ECPKI_SM2_BATCH_ITEM_FAILED                        (CC_ECPKI_MODULE_ERROR_BASE + 0xB7UL)
+/*! The SM2 private key is not the private key of the signer. */
+#define CC_ECPKI_SM2_SIGNER_KEY_MISMATCH                      (CC_ECPKI_MODULE_ERROR_BASE + 0xB8UL)
 
 /************************************************************************************************************
  * CryptoCell ECIES MODULE ERRORS
@@ -323,6 +343,24 @@ extern "C"
 #define CC_ECIES_FATAL_ERR_IS_LOCKED_ERR                        (CC_ECPKI_MODULE_ERROR_BASE + 0xF0UL)
 /*! Secure Disable control is set. */
 #define CC_ECIES_SD_ENABLED_ERR                                 (CC_ECPKI_MODULE_ERROR_BASE + 0xF1UL)
+/*! Illegal hybrid ECIES context pointer. */
+#define CC_ECIES_INVALID_CONTEXT_PTR_ERROR                      (CC_ECPKI_MODULE_ERROR_BASE + 0xF2UL)
+/*! Hybrid ECIES context validation failed. */
+#define CC_ECIES_INVALID_CONTEXT_ERROR                          (CC_ECPKI_MODULE_ERROR_BASE + 0xF3UL)
+/*! Illegal DEM mode. */
+#define CC_ECIES_INVALID_DEM_MODE_ERROR                         (CC_ECPKI_MODULE_ERROR_BASE + 0xF4UL)
+/*! Illegal DEM key size. */
+#define CC_ECIES_INVALID_DEM_KEY_SIZE_ERROR                     (CC_ECPKI_MODULE_ERROR_BASE + 0xF5UL)
+/*! Illegal data pointer. */
+#define CC_ECIES_INVALID_DATA_PTR_ERROR                         (CC_ECPKI_MODULE_ERROR_BASE + 0xF6UL)
+/*! Illegal data size. */
+#define CC_ECIES_INVALID_DATA_SIZE_ERROR                        (CC_ECPKI_MODULE_ERROR_BASE + 0xF7UL)
+/*! Illegal tag pointer. */
+#define CC_ECIES_INVALID_TAG_PTR_ERROR                          (CC_ECPKI_MODULE_ERROR_BASE + 0xF8UL)
+/*! Illegal tag size. */
+#define CC_ECIES_INVALID_TAG_SIZE_ERROR                         (CC_ECPKI_MODULE_ERROR_BASE + 0xF9UL)
+/*! Tag verification failed. */
+#define CC_ECIES_TAG_VERIFY_FAILED_ERROR                        (CC_ECPKI_MODULE_ERROR_BASE + 0xFAUL)
 
 /************************ Enums ********************************/
 
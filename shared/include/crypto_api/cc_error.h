@@ -134,6 +134,12 @@ extern "C"
 /*! The Secure Boot runtime error index.*/
 #define SBRT_ERROR_IDX           0x34UL
 
+/*! The key pool error index.*/
+#define KEYPOOL_ERROR_IDX        0x35UL
+
+/*! The public key cache error index.*/
+#define PUBKEY_CACHE_ERROR_IDX   0x36UL
+
 /* .......... defining the error spaces for each module on each layer ........... */
 /* ------------------------------------------------------------------------------ */
 
@@ -310,6 +316,16 @@ extern "C"
                                          (CC_ERROR_LAYER_RANGE * CC_LAYER_ERROR_IDX) + \
                                          (CC_ERROR_MODULE_RANGE * SBRT_ERROR_IDX ) )
 
+/*! The error base address of the key pool module - 0x00F03500. */
+#define CC_KEYPOOL_MODULE_ERROR_BASE     (CC_ERROR_BASE + \
+                                         (CC_ERROR_LAYER_RANGE * CC_LAYER_ERROR_IDX) + \
+                                         (CC_ERROR_MODULE_RANGE * KEYPOOL_ERROR_IDX ) )
+
+/*! The error base address of the public key cache module - 0x00F03600. */
+#define CC_PUBKEY_CACHE_MODULE_ERROR_BASE (CC_ERROR_BASE + \
+                                         (CC_ERROR_LAYER_RANGE * CC_LAYER_ERROR_IDX) + \
+                                         (CC_ERROR_MODULE_RANGE * PUBKEY_CACHE_ERROR_IDX ) )
+
 
 /*! The generic error base address of the user - 0x00F50000 */
 #define GENERIC_ERROR_BASE ( CC_ERROR_BASE + (CC_ERROR_LAYER_RANGE * GENERIC_ERROR_IDX) )
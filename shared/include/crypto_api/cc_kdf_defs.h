@@ -25,8 +25,9 @@ extern "C"
 
 /************************ Defines ******************************/
 
-/*! Maximal size of keying data in bytes. */
-#define  CC_KDF_MAX_SIZE_OF_KEYING_DATA  2048
+/*! Maximal size of keying data in bytes. The hash of the data common to all output blocks is computed once,
+    so large keying data, for example a keystream, costs a single hash of the counter and OtherInfo per block. */
+#define  CC_KDF_MAX_SIZE_OF_KEYING_DATA  65536
 
 /************************ Enums ********************************/
 /*! HASH operation modes */
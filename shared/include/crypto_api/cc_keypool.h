@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_KEYPOOL_H
+#define _CC_KEYPOOL_H
+
+
+#include "cc_pal_types.h"
+#include "cc_error.h"
+#include "cc_rnd_common.h"
+#include "cc_rsa_types.h"
+#include "cc_ecpki_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*!
+@file
+@brief This file defines the API of the key-pair pool.
+
+The pool holds pre-generated RSA or EC key pairs of one key size or domain, so that
+a key pair can be served without waiting for the key generation.
+The pool is refilled by ::CC_KeyPoolRefill, that the integrator calls from a low
+priority task. The refill starts a key only while the PKA is not used by other
+operations; a PKA operation that starts during the key generation waits for its current
+PKA session, such as a prime search. Serving a key (::CC_KeyPoolGetRsa,
+::CC_KeyPoolGetEcpki) takes the same time regardless of the pool state.
+The keys left in the pools are zeroized by ::CC_KeyPoolFree and by CC_LibFini. CC_LibFini
+stops the running refills and waits for them to return; no pool function may be called
+after it.
+ */
+ /*!
+ @addtogroup cc_keypool
+ @{
+*/
+
+/************************ Defines ******************************/
+/*! Maximal size of the RSA public exponent of the pool keys in bytes. */
+#define CC_KEYPOOL_PUB_EXP_MAX_SIZE_IN_BYTES      4
+
+/************************ Enums ********************************/
+/*! Key algorithms of the pool. */
+typedef enum
+{
+    /*! RSA key pairs on non CRT mode. */
+    CC_KEYPOOL_ALG_RSA        = 0,
+    /*! RSA key pairs on CRT mode. */
+    CC_KEYPOOL_ALG_RSA_CRT    = 1,
+    /*! EC key pairs. */
+    CC_KEYPOOL_ALG_ECPKI      = 2,
+    /*! Maximal number of key algorithms. */
+    CC_KEYPOOL_ALG_NumOfAlgs,
+    /*! Reserved */
+    CC_KEYPOOL_ALG_Last       = 0x7FFFFFFF,
+}CCKeyPoolAlg_t;
+
+/************************ Typedefs  ****************************/
+/*! One key pair of the pool. The slots are provided by the caller and should reside in
+    secure memory. */
+typedef union
+{
+    /*! RSA key pair. */
+    struct {
+        CCRsaUserPrivKey_t      privKey;
+        CCRsaUserPubKey_t       pubKey;
+    } rsa;
+    /*! EC key pair. */
+    struct {
+        CCEcpkiUserPrivKey_t    privKey;
+        CCEcpkiUserPublKey_t    pubKey;
+    } ecpki;
+}CCKeyPoolSlot_t;
+
+/*! Temporary buffers of the key generation, used by ::CC_KeyPoolRefill. */
+typedef union
+{
+    /*! RSA key generation buffers. */
+    CCRsaKgData_t               rsaKgData;
+    /*! EC key generation buffers. */
+    CCEcpkiKgTempData_t         ecpkiKgData;
+}CCKeyPoolTempData_t;
+
+/*! The key pool. The fields are internal and should not be accessed by the user. */
+typedef struct CCKeyPool_t
+{
+    uint32_t                    validTag;
+    CCKeyPoolAlg_t              alg;
+    size_t                      keySizeInBits;
+    uint8_t                     pubExp[CC_KEYPOOL_PUB_EXP_MAX_SIZE_IN_BYTES];
+    size_t                      pubExpSizeInBytes;
+    const CCEcpkiDomain_t       *pDomain;
+    CCKeyPoolSlot_t             *pSlots;
+    uint32_t                    slotsCount;
+    /* index of the oldest key and count of keys in the slots ring */
+    uint32_t                    readIdx;
+    uint32_t                    keysCount;
+    /* set while a key is generated into the slot following the last key */
+    uint32_t                    isRefilling;
+    struct CCKeyPool_t          *pNext;
+}CCKeyPool_t;
+
+/************************ Public Functions **********************/
+
+/*!
+@brief This function initializes an empty key pool and registers it, so that its keys
+are zeroized by CC_LibFini.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_keypool_error.h.
+*/
+CIMPORT_C CCError_t CC_KeyPoolInit(
+                    CCKeyPool_t            *pPool,           /*!< [out] Pointer to the pool. */
+                    CCKeyPoolAlg_t         alg,              /*!< [in] The key algorithm. */
+                    const uint8_t          *pPubExp,         /*!< [in] RSA only: pointer to the public exponent, MSByte first. */
+                    size_t                 pubExpSizeInBytes,/*!< [in] RSA only: the public exponent size in bytes. */
+                    size_t                 keySizeInBits,    /*!< [in] RSA only: the key size in bits, as for ::CC_RsaKgKeyPairGenerate. */
+                    const CCEcpkiDomain_t  *pDomain,         /*!< [in] EC only: pointer to the EC domain. */
+                    CCKeyPoolSlot_t        *pSlots,          /*!< [in] Pointer to the key slots, in secure memory. */
+                    uint32_t               slotsCount        /*!< [in] The count of slots - the maximal count of pooled keys. */
+);
+
+/*!
+@brief This function generates keys into the free slots of the pool.
+
+It is intended to be called from a low priority task of the integrator. Before each key
+it checks that the PKA is idle, and it returns without generating when the PKA is used by
+another operation; the caller should call it again later. The check does not reserve the
+PKA: a PKA operation that starts during the key generation waits for its current PKA
+session to end.
+Only one refill of a pool may run at a time.
+
+@return \c CC_OK on success, also when no key was generated because the PKA was busy.
+@return \c CC_KEYPOOL_BUSY_ERROR if another refill of the pool is running.
+@return \c CC_KEYPOOL_INVALID_POOL_ERROR if the pool was terminated by CC_LibFini during the refill;
+the key being generated is zeroized, and CC_LibFini returns only after the refill returned.
+@return A non-zero value on failure as defined in cc_keypool_error.h, cc_rsa_error.h or
+cc_ecpki_error.h.
+*/
+CIMPORT_C CCError_t CC_KeyPoolRefill(
+                    CCKeyPool_t                  *pPool,         /*!< [in/out] Pointer to the pool. */
+                    CCRndGenerateVectWorkFunc_t  f_rng,          /*!< [in] Pointer to DRBG function. */
+                    void                         *p_rng,         /*!< [in/out] Pointer to the random context - the input to f_rng. */
+                    CCKeyPoolTempData_t          *pTempData,     /*!< [in] Temporary buffers for internal use. */
+                    uint32_t                     maxKeysCount,   /*!< [in] Maximal count of keys to generate. */
+                    uint32_t                     *pGeneratedCount/*!< [out] The count of generated keys. May be NULL. */
+);
+
+/*!
+@brief This function takes the oldest RSA key pair out of the pool.
+The slot of the key is zeroized.
+
+@return \c CC_OK on success.
+@return \c CC_KEYPOOL_EMPTY_ERROR if the pool holds no key.
+@return A non-zero value on failure as defined in cc_keypool_error.h.
+*/
+CIMPORT_C CCError_t CC_KeyPoolGetRsa(
+                    CCKeyPool_t            *pPool,           /*!< [in/out] Pointer to an RSA pool. */
+                    CCRsaUserPrivKey_t     *pUserPrivKey,    /*!< [out] Pointer to the private key structure. */
+                    CCRsaUserPubKey_t      *pUserPubKey      /*!< [out] Pointer to the public key structure. */
+);
+
+/*!
+@brief This function takes the oldest EC key pair out of the pool.
+The slot of the key is zeroized.
+
+@return \c CC_OK on success.
+@return \c CC_KEYPOOL_EMPTY_ERROR if the pool holds no key.
+@return A non-zero value on failure as defined in cc_keypool_error.h.
+*/
+CIMPORT_C CCError_t CC_KeyPoolGetEcpki(
+                    CCKeyPool_t            *pPool,           /*!< [in/out] Pointer to an EC pool. */
+                    CCEcpkiUserPrivKey_t   *pUserPrivKey,    /*!< [out] Pointer to the private key structure. */
+                    CCEcpkiUserPublKey_t   *pUserPublKey     /*!< [out] Pointer to the public key structure. */
+);
+
+/*!
+@brief This function returns the count of keys held by the pool.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_keypool_error.h.
+*/
+CIMPORT_C CCError_t CC_KeyPoolLevelGet(
+                    CCKeyPool_t            *pPool,           /*!< [in] Pointer to the pool. */
+                    uint32_t               *pKeysCount       /*!< [out] The count of keys in the pool. */
+);
+
+/*!
+@brief This function zeroizes the keys of the pool and unregisters it.
+
+@return \c CC_OK on success.
+@return \c CC_KEYPOOL_BUSY_ERROR if a refill of the pool is running.
+@return A non-zero value on failure as defined in cc_keypool_error.h.
+*/
+CIMPORT_C CCError_t CC_KeyPoolFree(
+                    CCKeyPool_t            *pPool            /*!< [in/out] Pointer to the pool. */
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+@}
+ */
+#endif
+
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_KEYPOOL_ERROR_H
+#define _CC_KEYPOOL_ERROR_H
+
+#include "cc_error.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*!
+ @file
+ @brief This file contains the definitions of the CryptoCell key pool errors.
+ */
+
+ /*!
+ @addtogroup cc_keypool_error
+ @{
+ */
+
+
+/************************ Defines *******************************/
+
+/*! CryptoCell key pool module errors / base address - 0x00F03500. */
+/*! Invalid pool pointer. */
+#define CC_KEYPOOL_INVALID_POOL_POINTER_ERROR      \
+                                            (CC_KEYPOOL_MODULE_ERROR_BASE + 0x0UL)
+/*! Invalid pool validation tag - the pool is not initialized. */
+#define CC_KEYPOOL_INVALID_POOL_ERROR              \
+                                            (CC_KEYPOOL_MODULE_ERROR_BASE + 0x1UL)
+/*! Invalid argument pointer. */
+#define CC_KEYPOOL_INVALID_ARGUMENT_POINTER_ERROR  \
+                                            (CC_KEYPOOL_MODULE_ERROR_BASE + 0x2UL)
+/*! Invalid count of pool slots. */
+#define CC_KEYPOOL_INVALID_SLOTS_COUNT_ERROR       \
+                                            (CC_KEYPOOL_MODULE_ERROR_BASE + 0x3UL)
+/*! Illegal key algorithm. */
+#define CC_KEYPOOL_INVALID_ALGORITHM_ERROR         \
+                                            (CC_KEYPOOL_MODULE_ERROR_BASE + 0x4UL)
+/*! The requested key algorithm does not match the pool algorithm. */
+#define CC_KEYPOOL_ALGORITHM_MISMATCH_ERROR        \
+                                            (CC_KEYPOOL_MODULE_ERROR_BASE + 0x5UL)
+/*! The pool holds no key. */
+#define CC_KEYPOOL_EMPTY_ERROR                     \
+                                            (CC_KEYPOOL_MODULE_ERROR_BASE + 0x6UL)
+/*! The pool is being refilled. */
+#define CC_KEYPOOL_BUSY_ERROR                      \
+                                            (CC_KEYPOOL_MODULE_ERROR_BASE + 0x7UL)
+/*! Invalid argument size. */
+#define CC_KEYPOOL_INVALID_ARGUMENT_SIZE_ERROR     \
+                                            (CC_KEYPOOL_MODULE_ERROR_BASE + 0x8UL)
+/*! Key pool not supported. */
+#define CC_KEYPOOL_IS_NOT_SUPPORTED                \
+                                           (CC_KEYPOOL_MODULE_ERROR_BASE + 0xFFUL)
+
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+@}
+ */
+#endif
+
+
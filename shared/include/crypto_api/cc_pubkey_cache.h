@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_PUBKEY_CACHE_H
+#define _CC_PUBKEY_CACHE_H
+
+
+#include "cc_pal_types.h"
+#include "cc_error.h"
+#include "cc_hash_defs.h"
+#include "cc_ecpki_types.h"
+#include "cc_dh.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*!
+@file
+@brief This file defines the API of the validated public key cache.
+
+The full validation of a public key takes a scalar multiplication (EC) or a modular
+exponentiation (DH) by the group order. A peer that presents the same key again, for example
+in repeated handshakes, does not need to be validated again: the cache records a SHA-256 digest
+of each key, together with its domain, that passed the full validation, and the cached check
+functions perform the full validation only for keys that are not in the cache.
+
+The cache is direct-mapped: a key has a single entry, selected by its digest, so the lookup
+takes the same time regardless of the cache contents. A new key replaces the key recorded in
+its entry. Only public data is recorded; ::CC_PubKeyCacheInvalidate and ::CC_PubKeyCacheFree
+clear the recorded keys, for example when the trust configuration changes.
+ */
+ /*!
+ @addtogroup cc_pubkey_cache
+ @{
+*/
+
+/************************ Defines ******************************/
+/*! Size of the digest of a cached key in words. */
+#define CC_PUBKEY_CACHE_DIGEST_SIZE_IN_WORDS      CC_HASH_SHA256_DIGEST_SIZE_IN_WORDS
+
+/************************ Typedefs  ****************************/
+/*! One entry of the cache. The entries are provided by the caller. */
+typedef struct
+{
+    /*! Non zero if the entry records a key. */
+    uint32_t                    isValid;
+    /*! The digest of the key and its domain. */
+    uint32_t                    digest[CC_PUBKEY_CACHE_DIGEST_SIZE_IN_WORDS];
+}CCPubKeyCacheEntry_t;
+
+/*! The public key cache. The fields are internal and should not be accessed by the user. */
+typedef struct CCPubKeyCache_t
+{
+    uint32_t                    validTag;
+    CCPubKeyCacheEntry_t        *pEntries;
+    uint32_t                    entriesCount;
+    /* counters of the cached checks */
+    uint32_t                    hitsCount;
+    uint32_t                    missesCount;
+    /* the count of invalidations: a validation that started before one records no key */
+    uint32_t                    generation;
+}CCPubKeyCache_t;
+
+/************************ Public Functions **********************/
+
+/*!
+@brief This function initializes an empty public key cache.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_pubkey_cache_error.h.
+*/
+CIMPORT_C CCError_t CC_PubKeyCacheInit(
+                    CCPubKeyCache_t        *pCache,          /*!< [out] Pointer to the cache. */
+                    CCPubKeyCacheEntry_t   *pEntries,        /*!< [in] Pointer to the cache entries. */
+                    uint32_t               entriesCount      /*!< [in] The count of entries - the maximal count of cached keys. */
+);
+
+/*!
+@brief This function builds an EC public key structure with full validation of the key [SEC1] - 3.2.2,
+as ::CC_EcpkiPubKeyBuildAndFullCheck. The full validation is skipped if the key of the domain is in the
+cache, and a key that passes it is recorded in the cache.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_pubkey_cache_error.h, cc_ecpki_error.h or cc_hash_error.h.
+*/
+CIMPORT_C CCError_t CC_EcpkiPubKeyBuildAndFullCheckCached(
+                    CCPubKeyCache_t        *pCache,          /*!< [in/out] Pointer to the cache. */
+                    const CCEcpkiDomain_t  *pDomain,         /*!< [in] The EC domain (curve). */
+                    uint8_t                *pPubKeyIn,       /*!< [in] Pointer to the input public key data, as for ::CC_EcpkiPublKeyBuildAndCheck. */
+                    size_t                 PublKeySizeInBytes,/*!< [in] The size of public key data in bytes. */
+                    CCEcpkiUserPublKey_t   *pUserPublKey,    /*!< [out] Pointer to the output public key structure. */
+                    CCEcpkiBuildTempData_t *pTempBuff        /*!< [in] Temporary buffers for internal use. */
+);
+
+/*!
+@brief This function validates a DH public key, as ::CC_DhCheckPubKey. The validation is skipped
+if the key of the domain is in the cache, and a key that passes it is recorded in the cache.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_pubkey_cache_error.h, cc_dh_error.h or cc_hash_error.h.
+*/
+CIMPORT_C CCError_t CC_DhCheckPubKeyCached(
+                    CCPubKeyCache_t        *pCache,          /*!< [in/out] Pointer to the cache. */
+                    uint8_t                *modP_ptr,        /*!< [in] The pointer to the modulus (prime) P. */
+                    size_t                 modPsizeBytes,    /*!< [in] The modulus size in bytes. */
+                    uint8_t                *orderQ_ptr,      /*!< [in] The pointer to the prime order Q of generator. */
+                    size_t                 orderQsizeBytes,  /*!< [in] The size of order of generator in bytes. */
+                    uint8_t                *pubKey_ptr,      /*!< [in] The pointer to the public key to be validated. */
+                    size_t                 pubKeySizeBytes,  /*!< [in] The public key size in bytes. */
+                    CCDhTemp_t             *tempBuff_ptr     /*!< [in] The temp buffer for internal calculations. */
+);
+
+/*!
+@brief This function returns the counters of the cached checks: a hit is a check skipped since the key
+was in the cache, and a miss is a check that performed the full validation.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_pubkey_cache_error.h.
+*/
+CIMPORT_C CCError_t CC_PubKeyCacheStatsGet(
+                    CCPubKeyCache_t        *pCache,          /*!< [in] Pointer to the cache. */
+                    uint32_t               *pHitsCount,      /*!< [out] The count of hits. */
+                    uint32_t               *pMissesCount     /*!< [out] The count of misses. */
+);
+
+/*!
+@brief This function zeroizes the entries of the cache, so that every key is validated again.
+The cache stays initialized and its counters are kept. A key whose validation is running
+during the invalidation is not recorded.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_pubkey_cache_error.h.
+*/
+CIMPORT_C CCError_t CC_PubKeyCacheInvalidate(
+                    CCPubKeyCache_t        *pCache           /*!< [in/out] Pointer to the cache. */
+);
+
+/*!
+@brief This function zeroizes the entries and the cache structure.
+
+@return \c CC_OK on success.
+@return A non-zero value on failure as defined in cc_pubkey_cache_error.h.
+*/
+CIMPORT_C CCError_t CC_PubKeyCacheFree(
+                    CCPubKeyCache_t        *pCache           /*!< [in/out] Pointer to the cache. */
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+@}
+ */
+#endif
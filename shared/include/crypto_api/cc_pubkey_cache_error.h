@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_PUBKEY_CACHE_ERROR_H
+#define _CC_PUBKEY_CACHE_ERROR_H
+
+#include "cc_error.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*!
+ @file
+ @brief This file contains the definitions of the CryptoCell public key cache errors.
+ */
+
+ /*!
+ @addtogroup cc_pubkey_cache_error
+ @{
+ */
+
+
+/************************ Defines *******************************/
+
+/*! CryptoCell public key cache module errors / base address - 0x00F03600. */
+/*! Invalid cache pointer. */
+#define CC_PUBKEY_CACHE_INVALID_CACHE_POINTER_ERROR     \
+                                            (CC_PUBKEY_CACHE_MODULE_ERROR_BASE + 0x0UL)
+/*! Invalid cache validation tag - the cache is not initialized. */
+#define CC_PUBKEY_CACHE_INVALID_CACHE_ERROR             \
+                                            (CC_PUBKEY_CACHE_MODULE_ERROR_BASE + 0x1UL)
+/*! Invalid argument pointer. */
+#define CC_PUBKEY_CACHE_INVALID_ARGUMENT_POINTER_ERROR  \
+                                            (CC_PUBKEY_CACHE_MODULE_ERROR_BASE + 0x2UL)
+/*! Invalid count of cache entries. */
+#define CC_PUBKEY_CACHE_INVALID_ENTRIES_COUNT_ERROR     \
+                                            (CC_PUBKEY_CACHE_MODULE_ERROR_BASE + 0x3UL)
+/*! Invalid argument size. */
+#define CC_PUBKEY_CACHE_INVALID_ARGUMENT_SIZE_ERROR     \
+                                            (CC_PUBKEY_CACHE_MODULE_ERROR_BASE + 0x4UL)
+/*! Public key cache not supported. */
+#define CC_PUBKEY_CACHE_IS_NOT_SUPPORTED                \
+                                           (CC_PUBKEY_CACHE_MODULE_ERROR_BASE + 0xFFUL)
+
+
+#ifdef __cplusplus
+}
+#endif
+/*!
+@}
+ */
+#endif
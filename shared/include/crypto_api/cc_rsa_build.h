@@ -89,6 +89,50 @@ CIMPORT_C CCError_t CC_RsaPrivKeyCrtBuild(
 );
 
 
+/*! Additional prime factor of a multi-prime key, as OtherPrimeInfo of Public-Key Cryptography Standards (PKCS) #1 v2.2.
+    All the buffers are big-endian byte streams. */
+typedef struct {
+        uint8_t *pPrime;        /*!< [in]  Pointer to the prime factor r_i. */
+        size_t   primeSize;     /*!< [in]  The size of the prime factor (in bytes). */
+        uint8_t *pExp;          /*!< [in]  Pointer to the CRT exponent d_i = d mod (r_i - 1). */
+        size_t   expSize;       /*!< [in]  The size of the CRT exponent (in bytes). */
+        uint8_t *pCoeff;        /*!< [in]  Pointer to the CRT coefficient t_i: the inverse modulo r_i of the product of the preceding factors. */
+        size_t   coeffSize;     /*!< [in]  The size of the CRT coefficient (in bytes). */
+} CCRsaOtherPrimeInfo_t;
+
+/******************************************************************************************/
+/*!
+@brief Builds a ::CCRsaUserPrivKey_t private-key structure of a multi-prime key on CRT mode (RFC 8017), with the parameters of
+the first two factors as ::CC_RsaPrivKeyCrtBuild and up to (::CC_RSA_MAX_PRIMES_COUNT - 2) additional factors.
+The factors are checked against the modulus and the private exponent: N must be the product of all the factors,
+d_i must be d mod (r_i - 1) and t_i must be the inverse modulo r_i of the product of the preceding factors.
+
+@return \c CC_OK on success.
+@return A non-zero value from cc_rsa_error.h on failure.
+*/
+CIMPORT_C CCError_t CC_RsaPrivKeyMultiPrimeCrtBuild(
+                                      CCRsaUserPrivKey_t *UserPrivKey_ptr,   /*!< [out] Pointer to the private key structure. */
+                                      uint8_t *P_ptr,                           /*!< [in]  Pointer to the first factor stream of bytes (big-endian format). */
+                                      size_t   PSize,                           /*!< [in]  The size of the first factor (in bytes). */
+                                      uint8_t *Q_ptr,                           /*!< [in]  Pointer to the second factor stream of bytes (big-endian format). */
+                                      size_t   QSize,                           /*!< [in]  The size of the second factor (in bytes). */
+                                      uint8_t *dP_ptr,                          /*!< [in]  Pointer to the first factor CRT exponent stream of bytes.
+											   (Big-Endian format). */
+                                      size_t   dPSize,                          /*!< [in]  The size of the first factor CRT exponent (in bytes). */
+                                      uint8_t *dQ_ptr,                          /*!< [in]  Pointer to the second factor CRT exponent stream of bytes.
+											   (Big-Endian format). */
+                                      size_t   dQSize,                          /*!< [in]  The size of the second factor CRT exponent (in bytes). */
+                                      uint8_t *qInv_ptr,                        /*!< [in]  Pointer to the first CRT coefficient stream of bytes (big-endian format). */
+                                      size_t   qInvSize,                        /*!< [in]  The size of the first CRT coefficient (in bytes). */
+                                      uint8_t *N_ptr,                           /*!< [in]  Pointer to the modulus stream of bytes (big-endian format). */
+                                      size_t   NSize,                           /*!< [in]  The size of the modulus (in bytes). */
+                                      uint8_t *d_ptr,                           /*!< [in]  Pointer to the private exponent stream of bytes (big-endian format). */
+                                      size_t   dSize,                           /*!< [in]  The size of the private exponent (in bytes). */
+                                      const CCRsaOtherPrimeInfo_t *pOtherPrimes, /*!< [in] Pointer to the array of the additional factors. */
+                                      size_t   otherPrimesCount                 /*!< [in]  The count of the additional factors: 1 - (::CC_RSA_MAX_PRIMES_COUNT - 2). */
+);
+
+
 /******************************************************************************************/
 /*!
 @brief The function gets the e,n public key parameters from the input
@@ -164,6 +208,82 @@ CEXPORT_C CCError_t CC_RsaGetPrivKeyCRT(CCRsaUserPrivKey_t *UserPrivKey_ptr /*!<
 										     actual size of the first CRT coefficient, in bytes.*/
 );
 
+
+/*! The size of the header of a private key blob, in bytes. */
+#define CC_RSA_PRIV_KEY_BLOB_HEADER_SIZE_IN_BYTES   16
+/*! The size of the integrity check (HMAC-SHA256) of a private key blob, in bytes. */
+#define CC_RSA_PRIV_KEY_BLOB_MAC_SIZE_IN_BYTES      CC_HASH_SHA256_DIGEST_SIZE_IN_BYTES
+/*! The size of a private key blob, in bytes. */
+#define CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES          (CC_RSA_PRIV_KEY_BLOB_HEADER_SIZE_IN_BYTES + sizeof(CCRsaPrivKey_t) + \
+						     CC_RSA_PRIV_KEY_BLOB_MAC_SIZE_IN_BYTES)
+
+/******************************************************************************************/
+/*!
+@brief Exports a private key built by ::CC_RsaPrivKeyBuild, ::CC_RsaPrivKeyCrtBuild, ::CC_RsaPrivKeyMultiPrimeCrtBuild or
+generated by the key generation APIs to a blob of ::CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES bytes.
+
+The blob holds the key together with the values derived from it when it was built and validated (modulus, Barrett
+tags), so that ::CC_RsaPrivKeyImport restores the key without any PKA operation. The blob is protected by an HMAC-SHA256
+under the caller's key, e.g. a key derived from the device root key with CC_UtilKeyDerivation.
+
+\note The blob holds the private key in the clear, as ::CCRsaUserPrivKey_t does, and must be kept in confidential storage.
+\note The blob is bound to the layout of the key structures of the library that exported it.
+
+@return \c CC_OK on success.
+@return A non-zero value from cc_rsa_error.h or cc_hmac_error.h on failure.
+*/
+CIMPORT_C CCError_t CC_RsaPrivKeyExport(
+                                    CCRsaUserPrivKey_t *UserPrivKey_ptr,   /*!< [in]  Pointer to the private key structure. */
+                                    uint8_t  *pMacKey,                        /*!< [in]  Pointer to the key of the integrity check. */
+                                    size_t    macKeySize,                     /*!< [in]  The size of the key of the integrity check (in bytes). */
+                                    uint8_t  *pBlob,                          /*!< [out] Pointer to the blob. */
+                                    size_t   *pBlobSize                       /*!< [in/out] The size of the blob buffer in bytes, updated to the
+											  size of the blob: ::CC_RSA_PRIV_KEY_BLOB_SIZE_IN_BYTES. */
+);
+
+/******************************************************************************************/
+/*!
+@brief Imports a private key from a blob exported by ::CC_RsaPrivKeyExport.
+
+The integrity check of the blob is verified and the key is restored as it was exported; the key is not validated
+again and no PKA operation is done.
+
+@return \c CC_OK on success.
+@return ::CC_RSA_PRIV_KEY_BLOB_INTEGRITY_ERROR if the integrity check fails.
+@return A non-zero value from cc_rsa_error.h or cc_hmac_error.h on failure.
+*/
+CIMPORT_C CCError_t CC_RsaPrivKeyImport(
+                                    CCRsaUserPrivKey_t *UserPrivKey_ptr,   /*!< [out] Pointer to the private key structure. */
+                                    uint8_t  *pMacKey,                        /*!< [in]  Pointer to the key of the integrity check. */
+                                    size_t    macKeySize,                     /*!< [in]  The size of the key of the integrity check (in bytes). */
+                                    uint8_t  *pBlob,                          /*!< [in]  Pointer to the blob. */
+                                    size_t    blobSize                        /*!< [in]  The size of the blob (in bytes). */
+);
+
+/*! One key of a batch imported by ::CC_RsaPrivKeyImportBatch. */
+typedef struct {
+        uint8_t            *pBlob;          /*!< [in]  Pointer to the blob exported by ::CC_RsaPrivKeyExport. */
+        size_t              blobSize;       /*!< [in]  The size of the blob (in bytes). */
+        CCRsaUserPrivKey_t *pUserPrivKey;   /*!< [out] Pointer to the private key structure. */
+        CCError_t           result;         /*!< [out] The result of the import of this item: CC_OK if imported. */
+} CCRsaPrivKeyImportItem_t;
+
+/******************************************************************************************/
+/*!
+@brief Imports a batch of private keys protected by the same key, as ::CC_RsaPrivKeyImport does for each of them.
+The result of each item is returned in the item.
+
+@return \c CC_OK if all the keys are imported.
+@return ::CC_RSA_PRIV_KEY_BLOB_BATCH_ERROR if at least one item failed; see the result of the items.
+@return A non-zero value from cc_rsa_error.h on other failures.
+*/
+CIMPORT_C CCError_t CC_RsaPrivKeyImportBatch(
+                                    uint8_t  *pMacKey,                        /*!< [in]  Pointer to the key of the integrity check. */
+                                    size_t    macKeySize,                     /*!< [in]  The size of the key of the integrity check (in bytes). */
+                                    CCRsaPrivKeyImportItem_t *pItems,         /*!< [in/out] Pointer to the array of the items. */
+                                    size_t    itemsCount                      /*!< [in]  The count of the items. */
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -223,6 +223,20 @@ extern "C"
 #define CC_RSA_DECRYPT_OUTPUT_SIZE_POINTER_ERROR        (CC_RSA_MODULE_ERROR_BASE+0x8AUL)
 /*! Illegal parameters. */
 #define CC_RSA_ILLEGAL_PARAMS_ACCORDING_TO_PRIV_ERROR   (CC_RSA_MODULE_ERROR_BASE + 0x93UL)
+/*! Illegal batch of items. */
+#define CC_RSA_INVALID_BATCH_ERROR                      (CC_RSA_MODULE_ERROR_BASE + 0x94UL)
+/*! Illegal count of prime factors. */
+#define CC_RSA_INVALID_PRIMES_COUNT_ERROR               (CC_RSA_MODULE_ERROR_BASE + 0x95UL)
+/*! Illegal additional prime factor of a multi-prime key. */
+#define CC_RSA_INVALID_CRT_OTHER_PRIME_ERROR            (CC_RSA_MODULE_ERROR_BASE + 0x96UL)
+/*! Illegal private key blob. */
+#define CC_RSA_INVALID_PRIV_KEY_BLOB_ERROR              (CC_RSA_MODULE_ERROR_BASE + 0x97UL)
+/*! Private key blob integrity check failure. */
+#define CC_RSA_PRIV_KEY_BLOB_INTEGRITY_ERROR            (CC_RSA_MODULE_ERROR_BASE + 0x98UL)
+/*! At least one key of a batch import failed. */
+#define CC_RSA_PRIV_KEY_BLOB_BATCH_ERROR                (CC_RSA_MODULE_ERROR_BASE + 0x99UL)
+/*! The CRT parameters of a multi-prime key are inconsistent with the modulus or the private exponent. */
+#define CC_RSA_INCONSISTENT_CRT_PARAMS_ERROR            (CC_RSA_MODULE_ERROR_BASE + 0x9AUL)
 /*! RSA is not supported. */
 #define CC_RSA_IS_NOT_SUPPORTED                         (CC_RSA_MODULE_ERROR_BASE+0xFFUL)
 
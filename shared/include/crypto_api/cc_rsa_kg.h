@@ -96,6 +96,31 @@ CIMPORT_C CCError_t CC_RsaKgKeyPairCrtGenerate(
 											  (may be NULL for all other cases). */
 );
 
+/***********************************************************************************************/
+/*!
+@brief Generates a pair of public and private keys on CRT mode with up to ::CC_RSA_MAX_PRIMES_COUNT prime factors (multi-prime RSA, RFC 8017).
+
+The factors are generated as by ::CC_RsaKgKeyPairCrtGenerate, each of about (keySize / primesCount) bits, so the private key
+operations run with smaller moduli. For primesCount = 2 the function is equivalent to ::CC_RsaKgKeyPairCrtGenerate.
+
+\note Multi-prime keys are not FIPS Publication 186-4: Digital Signature Standard (DSS) compliant.
+
+@return \c CC_OK on success.
+@return A non-zero value from cc_rsa_error.h or cc_rnd_error.h on failure.
+*/
+CIMPORT_C CCError_t CC_RsaKgKeyPairMultiPrimeGenerate(
+                                        CCRndGenerateVectWorkFunc_t f_rng, /*!< [in] Pointer to DRBG function*/
+                                        void *p_rng,                               /*!< [in/out] Pointer to the random context - the input to f_rng. */
+                                        uint8_t             *pubExp_ptr,           /*!< [in]  The pointer to the public exponent (public key). */
+                                        size_t               pubExpSizeInBytes,    /*!< [in]  The public exponent size in bytes. */
+                                        size_t               keySize,              /*!< [in]  The size of the key, in bits. Supported sizes are
+                                                                                              2048, 3072 and 4096 bit. */
+                                        uint32_t             primesCount,          /*!< [in]  The count of prime factors: 2 - ::CC_RSA_MAX_PRIMES_COUNT. */
+                                        CCRsaUserPrivKey_t *userPrivKey_ptr,    /*!< [out] Pointer to the private-key structure. */
+                                        CCRsaUserPubKey_t  *userPubKey_ptr,     /*!< [out] Pointer to the public-key structure. */
+                                        CCRsaKgData_t      *keyGenData_ptr      /*!< [in] Pointer to a temporary structure required for the KeyGen operation. */
+);
+
 
 #ifdef __cplusplus
 }
@@ -404,6 +404,37 @@ CIMPORT_C CCError_t CC_RsaVerify(
 										    Public-Key Cryptography Standards (PKCS) #1 RSA Cryptography Specifications Version
 										    2.1, according to the functionality required. */
 );
+
+/*! One signature of a batch verified by ::CC_RsaVerifyBatch. */
+typedef struct {
+        CCRsaUserPubKey_t *pUserPubKey;   /*!< [in]  Pointer to the public key data structure of the signer. */
+        uint8_t           *pDataIn;       /*!< [in]  Pointer to the input data to be verified. */
+        size_t             dataInSize;    /*!< [in]  The size (in bytes) of the data. */
+        uint8_t           *pSig;          /*!< [in]  Pointer to the signature, of the modulus size. */
+        CCError_t          result;        /*!< [out] The result of the verification of this item: CC_OK if valid. */
+} CCRsaVerifyBatchItem_t;
+
+/*!
+@brief Verifies a batch of signatures of one scheme, as ::CC_RsaVerify does for each of them.
+
+All the items share one PKA session: the PKA is initialized once for each run of items with the same modulus size,
+and the modulus of a key is loaded once for each run of items with the same key structure.
+The result of each item is returned in the item.
+
+@return CC_OK if all the signatures are valid.
+@return CC_RSA_ERROR_VER15_INCONSISTENT_VERIFY if at least one item failed; see the result of the items.
+@return A non-zero value from cc_rsa_error.h or cc_hash_error.h on other failures.
+*/
+CIMPORT_C CCError_t CC_RsaVerifyBatch(
+                            CCRsaPubUserContext_t *UserContext_ptr,   /*!< [in]  Pointer to a temporary context for internal use, reused for every item. */
+                            CCRsaHashOpMode_t rsaHashMode,               /*!< [in]  The HASH mode of all the items, as defined in ::CCRsaHashOpMode_t. */
+                            CCPkcs1Mgf_t MGF,                            /*!< [in]  The mask generation function, as for ::CC_RsaVerify. */
+                            size_t      SaltLen,                         /*!< [in]  The Length of the Salt buffer, as for ::CC_RsaVerify. */
+                            CCPkcs1Version_t PKCS1_ver,                  /*!< [in]  PKCS#1 version of all the items, as for ::CC_RsaVerify. */
+                            CCRsaVerifyBatchItem_t *pItems,              /*!< [in/out] The array of the items. */
+                            size_t      itemsCount                       /*!< [in]  The count of the items. */
+);
+
 /*!
 @brief CRYS_RSA_PKCS1v15_Verify implements the Public-Key Cryptography Standards (PKCS) #1: RSA Encryption
 Standard Version 1.5 Verify algorithm.
@@ -74,8 +74,9 @@ extern "C"
 #define CC_RSA_MIN_PRIV_EXP_VALUE 1
 
 /* The maximum buffer size for the 'H' value */
-/*! Temporary buffer size definition.*/
-#define CC_RSA_TMP_BUFF_SIZE (CC_RSA_OAEP_ENCODE_MAX_MASKDB_SIZE + CC_RSA_OAEP_ENCODE_MAX_SEEDMASK_SIZE + CC_PKA_RSA_HASH_CTX_SIZE_IN_WORDS*sizeof(uint32_t) + sizeof(CCHashResultBuf_t))
+/*! Temporary buffer size definition: the OAEP label hash context, which then holds the MGF1 hashed seed,
+    the MGF1 block hash context and a hash result. */
+#define CC_RSA_TMP_BUFF_SIZE (2*CC_PKA_RSA_HASH_CTX_SIZE_IN_WORDS*sizeof(uint32_t) + sizeof(CCHashResultBuf_t))
 
 /*! Hash structure definition.*/
 #define CCPkcs1HashFunc_t CCHashOperationMode_t
@@ -246,6 +247,24 @@ typedef struct
 
 }CCRsaPrivNonCrtKey_t;
 
+/*! Additional prime factor of a multi-prime key on CRT mode (used internally),
+    as OtherPrimeInfo of Public-Key Cryptography Standards (PKCS) #1 v2.2. */
+typedef struct
+{
+	/*! Prime factor buffer. */
+	uint32_t R[CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS/2];
+	/*! Prime factor size in bits. */
+	uint32_t RSizeInBits;
+	/*! CRT exponent buffer: d mod (R-1). */
+	uint32_t dR[CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS/2];
+	/*! CRT exponent size in bits. */
+	uint32_t dRSizeInBits;
+	/*! CRT coefficient buffer: the inverse modulo R of the product of the preceding factors. */
+	uint32_t tR[CC_RSA_MAXIMUM_MOD_BUFFER_SIZE_IN_WORDS/2];
+	/*! CRT coefficient size in bits. */
+	uint32_t tRSizeInBits;
+}CCRsaPrivCrtPrime_t;
+
 /*! Private key on CRT mode data structure (used internally). */
 /* use small CRT buffers */
 typedef struct
@@ -275,6 +294,15 @@ typedef struct
 	/*! First CRT coefficient size in bits. */
 	uint32_t qInvSizeInBits;
 
+	/*! Count of the prime factors. 0 or 2 for a two-prime key. */
+	uint32_t primesCount;
+	/*! Additional prime factors of a multi-prime key.
+	    \note This array (and the Barrett tags of the additional factors in the internal buffer of ::CCRsaPrivKey_t)
+	    enlarges ::CCRsaPrivCrtKey_t, ::CCRsaUserPrivKey_t and the private contexts ::RSAPrivContext_t and
+	    ::CCRsaPrivUserContext_t. This is an ABI break: callers that allocate these structures must be rebuilt
+	    against this header, and private keys saved in the old layout must be built again. */
+	CCRsaPrivCrtPrime_t otherPrimes[CC_RSA_MAX_PRIMES_COUNT - 2];
+
 }CCRsaPrivCrtKey_t;
 
 
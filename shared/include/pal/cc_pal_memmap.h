@@ -32,6 +32,48 @@ extern "C"
 #include "cc_pal_types.h"
 #include "cc_address_defs.h"
 
+/*! The number of windows kept by the mapping cache of each device. */
+#ifndef CC_PAL_MEMMAP_CACHE_ENTRIES
+#define CC_PAL_MEMMAP_CACHE_ENTRIES     16
+#endif
+
+/*! The number of unreferenced windows that are kept mapped for reuse. */
+#ifndef CC_PAL_MEMMAP_MAX_IDLE_ENTRIES
+#define CC_PAL_MEMMAP_MAX_IDLE_ENTRIES  8
+#endif
+
+/*! The mapped devices. */
+typedef enum {
+    /*! The device used by #CC_PalMemMap. */
+    CC_PAL_MEMMAP_DEV_MEM = 0,
+    /*! The device used by #CC_PalMemMapImage. */
+    CC_PAL_MEMMAP_DEV_IMAGE = 1,
+    /*! The number of devices. */
+    CC_PAL_MEMMAP_DEV_MAX,
+    /*! Reserved. */
+    CC_PAL_MEMMAP_DEV_RESERVE32 = 0x7FFFFFFF
+} CCPalMemMapDev_t;
+
+/*! The statistics of the mapping cache of a device. */
+typedef struct {
+    /*! The number of map requests. */
+    uint32_t mapCalls;
+    /*! The number of map requests served by an already mapped window. */
+    uint32_t cacheHits;
+    /*! The number of mmap system calls. */
+    uint32_t mmapCalls;
+    /*! The number of munmap system calls. */
+    uint32_t munmapCalls;
+    /*! The number of unreferenced windows that were unmapped to make room for new ones. */
+    uint32_t evictions;
+    /*! The number of mapped windows that are referenced. */
+    uint32_t activeWindows;
+    /*! The number of mapped windows that are not referenced. */
+    uint32_t idleWindows;
+    /*! The total size of the mapped windows, in bytes. */
+    uint64_t mappedBytes;
+} CCPalMemMapStats_t;
+
 
 /*----------------------------
       PUBLIC FUNCTIONS
@@ -79,6 +121,51 @@ uint32_t CC_PalMemUnMap(
     /*! [in] The number of bytes that were mapped. */
     uint32_t mapSize       );
 
+/*!
+  @brief This function replaces the file that is mapped for a device, for example with a regular
+         file that stands in for /dev/mem in tests. It may only be called when no window of the device is mapped.
+
+  @return \c 0 on success.
+  @return A non-zero value in case of failure.
+ */
+uint32_t CC_PalMemMapDevSet(
+    /*! [in] The device. */
+    CCPalMemMapDev_t dev,
+    /*! [in] The file name, or NULL to restore the default device. The string must remain valid while it is used. */
+    const char *pDevName);
+
+/*!
+  @brief This function unmaps all the windows that are no longer referenced, and closes the devices
+         that have no mapped windows.
+
+  @return \c 0 on success.
+  @return A non-zero value in case of failure.
+ */
+uint32_t CC_PalMemMapCacheFlush(void);
+
+/*!
+  @brief This function returns the statistics of the mapping cache of a device.
+
+  @return \c 0 on success.
+  @return A non-zero value in case of failure.
+ */
+uint32_t CC_PalMemMapStatsGet(
+    /*! [in] The device. */
+    CCPalMemMapDev_t dev,
+    /*! [out] The statistics. */
+    CCPalMemMapStats_t *pStats);
+
+/*!
+  @brief This function clears the counters of the mapping cache of a device.
+         The window counters and the mapped size are not cleared.
+
+  @return \c 0 on success.
+  @return A non-zero value in case of failure.
+ */
+uint32_t CC_PalMemMapStatsReset(
+    /*! [in] The device. */
+    CCPalMemMapDev_t dev);
+
 #ifdef __cplusplus
 }
 #endif
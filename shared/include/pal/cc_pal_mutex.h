@@ -70,6 +70,7 @@ CCError_t CC_PalMutexCreate(
          that the function will not return.
 
   @return \c 0 on success.
+  @return \c CC_PAL_SEM_WAIT_TIMEOUT if the mutex was not acquired within \p aTimeOut.
   @return A non-zero value on failure.
  */
 CCError_t CC_PalMutexLock(
@@ -90,6 +91,30 @@ CCError_t CC_PalMutexLock(
     CC_PalMutex *pMutexId);
 
 
+/*!
+  @brief This function returns a snapshot of the contention statistics of a mutex.
+
+  @return \c 0 on success.
+  @return A non-zero value on failure.
+ */
+CCError_t CC_PalMutexStatsGet(
+    /*! [in] A pointer to the handle of the mutex. */
+    CC_PalMutex *pMutexId,
+    /*! [out] A pointer to the statistics snapshot. */
+    CCPalMutexStats_t *pStats);
+
+
+/*!
+  @brief This function clears the contention statistics of a mutex.
+
+  @return \c 0 on success.
+  @return A non-zero value on failure.
+ */
+CCError_t CC_PalMutexStatsReset(
+    /*! [in] A pointer to the handle of the mutex. */
+    CC_PalMutex *pMutexId);
+
+
 
 #ifdef __cplusplus
 }
@@ -23,6 +23,11 @@ typedef enum
     PERF_TEST_TYPE_CC_AES_INIT,
     PERF_TEST_TYPE_CC_AES_BLOCK,
     PERF_TEST_TYPE_CC_AES_FIN,
+    PERF_TEST_TYPE_CC_AES_SET_IV,
+    PERF_TEST_TYPE_SM4_INIT,
+    PERF_TEST_TYPE_SM4_SET_KEY,
+    PERF_TEST_TYPE_SM4_BLOCK,
+    PERF_TEST_TYPE_SM4_FIN,
     PERF_TEST_TYPE_HW_CMPLT ,
     PERF_TEST_TYPE_PAL_MAP,
     PERF_TEST_TYPE_PAL_UNMAP,
@@ -52,6 +57,8 @@ typedef enum
     PERF_TEST_TYPE_PKA_SCALAR_MULT_SCA,
     PERF_TEST_TYPE_PKA_ECDSA_VERIFY,
     PERF_TEST_TYPE_PKA_ModExp = 0x30,
+    PERF_TEST_TYPE_PKA_REG_LOAD,
+    PERF_TEST_TYPE_PKA_REG_READ,
     PERF_TEST_TYPE_TEST_BASE = 0x100,
     PERF_TEST_TYPE_MAX,
     PERF_TEST_TYPE_RESERVE32 = 0x7FFFFFFF
@@ -59,7 +66,7 @@ typedef enum
 
 #ifdef LIB_PERF
 
-static char* CC_PalPerfTypeStr(CCPalPerfType_t type, char* pStr, uint32_t buffLen)
+static inline char* CC_PalPerfTypeStr(CCPalPerfType_t type, char* pStr, uint32_t buffLen)
 {
     #define CCPalPerfTypeStr_str(a) case a: strncpy(pStr, #a + strlen("PERF_TEST_TYPE_"), buffLen); break;
 
@@ -72,6 +79,11 @@ static char* CC_PalPerfTypeStr(CCPalPerfType_t type, char* pStr, uint32_t buffLe
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_CC_AES_INIT);
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_CC_AES_BLOCK);
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_CC_AES_FIN);
+        CCPalPerfTypeStr_str(PERF_TEST_TYPE_CC_AES_SET_IV);
+        CCPalPerfTypeStr_str(PERF_TEST_TYPE_SM4_INIT);
+        CCPalPerfTypeStr_str(PERF_TEST_TYPE_SM4_SET_KEY);
+        CCPalPerfTypeStr_str(PERF_TEST_TYPE_SM4_BLOCK);
+        CCPalPerfTypeStr_str(PERF_TEST_TYPE_SM4_FIN);
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_HW_CMPLT );
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_PAL_MAP);
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_PAL_UNMAP);
@@ -101,6 +113,8 @@ static char* CC_PalPerfTypeStr(CCPalPerfType_t type, char* pStr, uint32_t buffLe
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_PKA_SCALAR_MULT_SCA);
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_PKA_ECDSA_VERIFY);
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_PKA_ModExp);
+        CCPalPerfTypeStr_str(PERF_TEST_TYPE_PKA_REG_LOAD);
+        CCPalPerfTypeStr_str(PERF_TEST_TYPE_PKA_REG_READ);
         CCPalPerfTypeStr_str(PERF_TEST_TYPE_TEST_BASE);
         default: strncpy(pStr, "PERF_TEST_TYPE_UNKNOWN", buffLen);
     }
@@ -114,8 +128,17 @@ static char* CC_PalPerfTypeStr(CCPalPerfType_t type, char* pStr, uint32_t buffLe
 #define CC_PAL_PERF_DUMP                            CC_PalPerfDump
 #define CC_PAL_PERF_FIN                             CC_PalPerfFin
 
+/* Output formats of CC_PalPerfDumpToFile */
+typedef enum
+{
+    CC_PAL_PERF_DUMP_FORMAT_CSV,
+    CC_PAL_PERF_DUMP_FORMAT_JSON,
+    CC_PAL_PERF_DUMP_FORMAT_RESERVE32 = 0x7FFFFFFF
+} CCPalPerfDumpFormat_t;
+
 /**
- * @brief   initialize performance test mechanism
+ * @brief   initialize performance test mechanism; the statistics of a previous init are
+ *          released once the threads that record entries into them return
  *
  * @param[in]
  * *
@@ -146,7 +169,35 @@ void CC_PalPerfCloseEntry(CCPalPerfData_t idx, CCPalPerfType_t entryType);
 
 
 /**
- * @brief   dumps the performance buffer
+ * @brief   reads the time stamp of the perf backend, for measurements that keep their
+ *          own statistics
+ *
+ * @param[in] None
+ *
+ * @return The time stamp in backend ticks, or 0 if the perf is not initialized.
+ */
+CCPalPerfData_t CC_PalPerfGetTimestamp(void);
+
+/**
+ * @brief   converts a difference of two time stamps to the units of the perf backend
+ *
+ * @param[in] ticks -  difference of time stamps returned by CC_PalPerfGetTimestamp
+ *
+ * @return The difference in the units returned by CC_PalPerfUnitStr.
+ */
+CCPalPerfData_t CC_PalPerfTicksToUnits(CCPalPerfData_t ticks);
+
+/**
+ * @brief   returns the name of the units of the perf backend ("ns" or "cycles")
+ *
+ * @param[in] None
+ *
+ * @return The units name, or "" if the perf is not initialized.
+ */
+const char *CC_PalPerfUnitStr(void);
+
+/**
+ * @brief   dumps the performance buffer to stdout in CSV format
  *
  * @param[in] None
  *
@@ -156,7 +207,20 @@ void CC_PalPerfDump(void);
 
 
 /**
- * @brief   terminates resources used for performance tests
+ * @brief   dumps the performance buffer, merged over all threads, with count, min/avg/max
+ *          and p50/p99/p999 per entry type
+ *
+ * @param[in] format -  output format
+ * @param[in] pFileName -  output file name, or NULL for stdout
+ *
+ * @return A non-zero value in case of failure.
+ */
+int CC_PalPerfDumpToFile(CCPalPerfDumpFormat_t format, const char *pFileName);
+
+
+/**
+ * @brief   terminates resources used for performance tests; waits for the threads that
+ *          record entries or dump at that time
  *
  * @param[in]
  * *
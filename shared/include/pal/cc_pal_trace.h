@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_PAL_TRACE_H_
+#define _CC_PAL_TRACE_H_
+
+/*!
+ @file
+ @brief This file contains the PAL binary trace definitions. The trace is disabled by default.
+
+        Unlike the PAL log, a trace point only stores its identifier, a time stamp and its raw
+        arguments in a per-thread ring, without any formatting or locking. The rings are
+        written to a file by CC_PalTraceDump() and formatted offline.
+        The trace is compiled in with \c CC_PAL_TRACE (LIB_TRACE=1).
+ */
+
+#include "cc_pal_types.h"
+#include "cc_pal_trace_ids.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*! Maximal number of arguments of a trace point. */
+#define CC_PAL_TRACE_MAX_ARGS           6
+
+/*! Number of records in the ring of each thread. Must be a power of 2. */
+#ifndef CC_PAL_TRACE_RING_ENTRIES
+#define CC_PAL_TRACE_RING_ENTRIES       4096
+#endif
+
+/*! Magic number and version of the trace dump file. */
+#define CC_PAL_TRACE_FILE_MAGIC         0x52544343  /* "CCTR" */
+#define CC_PAL_TRACE_FILE_VERSION       1
+
+/*! A trace record. */
+typedef struct {
+    /*! Sequence number of the record in its ring, plus 1. Written last, so that a record
+        that was being overwritten during the dump can be detected. */
+    uint32_t seq;
+    /*! Trace point identifier, one of CCPalTraceId_t. */
+    uint16_t fmtId;
+    /*! Number of valid arguments. */
+    uint8_t numArgs;
+    uint8_t reserved;
+    /*! CLOCK_MONOTONIC time stamp in nSec. */
+    uint64_t timeNs;
+    /*! Raw arguments. */
+    uint64_t args[CC_PAL_TRACE_MAX_ARGS];
+} CCPalTraceRecord_t;
+
+/*! Dump file header. It is followed by \p numOfRings rings, each being a CCPalTraceRingHeader_t
+    followed by \p numOfEntries records. */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t numOfRings;
+} CCPalTraceFileHeader_t;
+
+/*! Dump file ring header. */
+typedef struct {
+    uint32_t threadId;
+    uint32_t numOfEntries;
+    /*! Total number of records written to the ring. */
+    uint64_t head;
+} CCPalTraceRingHeader_t;
+
+#ifdef CC_PAL_TRACE
+
+/*! Converts a pointer trace argument. */
+#define CC_PAL_TRACE_PTR(ptr)       ((uint64_t)(uintptr_t)(ptr))
+
+#define _CC_PAL_TRACE(id, n, a0, a1, a2, a3, a4, a5) \
+    CC_PalTraceRecord(CC_PAL_TRACE_ID_ ## id, n, (uint64_t)(a0), (uint64_t)(a1), (uint64_t)(a2), \
+                      (uint64_t)(a3), (uint64_t)(a4), (uint64_t)(a5))
+
+/*! Trace points with 0 to 6 arguments. Pointer arguments must be wrapped with CC_PAL_TRACE_PTR. */
+#define CC_PAL_TRACE0(id)                           _CC_PAL_TRACE(id, 0, 0, 0, 0, 0, 0, 0)
+#define CC_PAL_TRACE1(id, a0)                       _CC_PAL_TRACE(id, 1, a0, 0, 0, 0, 0, 0)
+#define CC_PAL_TRACE2(id, a0, a1)                   _CC_PAL_TRACE(id, 2, a0, a1, 0, 0, 0, 0)
+#define CC_PAL_TRACE3(id, a0, a1, a2)               _CC_PAL_TRACE(id, 3, a0, a1, a2, 0, 0, 0)
+#define CC_PAL_TRACE4(id, a0, a1, a2, a3)           _CC_PAL_TRACE(id, 4, a0, a1, a2, a3, 0, 0)
+#define CC_PAL_TRACE5(id, a0, a1, a2, a3, a4)       _CC_PAL_TRACE(id, 5, a0, a1, a2, a3, a4, 0)
+#define CC_PAL_TRACE6(id, a0, a1, a2, a3, a4, a5)   _CC_PAL_TRACE(id, 6, a0, a1, a2, a3, a4, a5)
+
+/*! Records the raw words of a HW descriptor, two words per argument. */
+#define CC_PAL_TRACE_HW_DESC(pDesc) \
+    CC_PAL_TRACE3(HW_DESC, \
+                  ((uint64_t)(pDesc)->word[1] << 32) | (pDesc)->word[0], \
+                  ((uint64_t)(pDesc)->word[3] << 32) | (pDesc)->word[2], \
+                  ((uint64_t)(pDesc)->word[5] << 32) | (pDesc)->word[4])
+
+#define CC_PAL_TRACE_ENABLE(enable)     CC_PalTraceEnable(enable)
+#define CC_PAL_TRACE_DUMP(fileName)     CC_PalTraceDump(fileName)
+#define CC_PAL_TRACE_FIN()              CC_PalTraceFin()
+
+/*!
+  @brief This function stores a trace record in the ring of the calling thread.
+         It is not to be called directly, but through the CC_PAL_TRACEn macros.
+ */
+void CC_PalTraceRecord(uint16_t fmtId, uint32_t numArgs,
+                       uint64_t a0, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5);
+
+/*!
+  @brief This function enables or disables the recording of trace points at runtime.
+         The trace is enabled by default.
+ */
+void CC_PalTraceEnable(
+    /*! [in] CC_TRUE to record trace points. */
+    CCBool enable);
+
+/*!
+  @brief This function writes the rings of all threads to a file, to be decoded offline.
+
+  @return \c 0 on success.
+  @return A non-zero value on failure.
+ */
+int CC_PalTraceDump(
+    /*! [in] The output file name. */
+    const char *pFileName);
+
+/*!
+  @brief This function releases the rings of all threads. It must be called when no trace
+         points are being recorded.
+ */
+void CC_PalTraceFin(void);
+
+#else  /* CC_PAL_TRACE */
+
+#define CC_PAL_TRACE_PTR(ptr)                       (0)
+#define CC_PAL_TRACE0(id)                           do {} while (0)
+#define CC_PAL_TRACE1(id, a0)                       do {} while (0)
+#define CC_PAL_TRACE2(id, a0, a1)                   do {} while (0)
+#define CC_PAL_TRACE3(id, a0, a1, a2)               do {} while (0)
+#define CC_PAL_TRACE4(id, a0, a1, a2, a3)           do {} while (0)
+#define CC_PAL_TRACE5(id, a0, a1, a2, a3, a4)       do {} while (0)
+#define CC_PAL_TRACE6(id, a0, a1, a2, a3, a4, a5)   do {} while (0)
+#define CC_PAL_TRACE_HW_DESC(pDesc)                 do {} while (0)
+#define CC_PAL_TRACE_ENABLE(enable)                 do {} while (0)
+#define CC_PAL_TRACE_DUMP(fileName)                 (0)
+#define CC_PAL_TRACE_FIN()                          do {} while (0)
+
+#endif /* CC_PAL_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_CC_PAL_TRACE_H_*/
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+#ifndef _CC_PAL_TRACE_IDS_H_
+#define _CC_PAL_TRACE_IDS_H_
+
+/*!
+ @file
+ @brief This file contains the list of binary trace points and their format strings.
+
+        The format strings are never evaluated on the target. They are used by the offline
+        decoder (utils/src/trace_decoder/cc_trace_decoder.py) which parses this file, so every
+        entry must stay on one line, and the arguments must use 64-bit conversions only
+        (%llu, %lld, %llx).
+        New entries must be appended at the end of the list, to keep previously recorded
+        traces decodable.
+ */
+
+#define CC_PAL_TRACE_FMT_LIST(CC_PAL_TRACE_FMT) \
+    CC_PAL_TRACE_FMT(NONE,                  "") \
+    CC_PAL_TRACE_FMT(HW_DESC,               "desc 0x%016llx 0x%016llx 0x%016llx") \
+    CC_PAL_TRACE_FMT(SYM_DRV_INIT,          "SymDriverAdaptorInit pCtx=0x%llx alg=%llu mode=%llu") \
+    CC_PAL_TRACE_FMT(SYM_DRV_PROCESS,       "SymDriverAdaptorProcess pCtx=0x%llx in=0x%llx out=0x%llx size=%llu alg=%llu") \
+    CC_PAL_TRACE_FMT(SYM_DRV_FINALIZE,      "SymDriverAdaptorFinalize pCtx=0x%llx in=0x%llx out=0x%llx size=%llu alg=%llu") \
+    CC_PAL_TRACE_FMT(SYM_DRV_DONE,          "SymDriverAdaptor done rc=0x%llx") \
+    CC_PAL_TRACE_FMT(BUILD_DMA,             "BuildDmaFromDataPtr in=0x%llx out=0x%llx size=%llu inplace=%llu") \
+    CC_PAL_TRACE_FMT(BUILD_DMA_DONE,        "BuildDmaFromDataPtr inType=%llu outType=%llu builtFlag=0x%llx rc=0x%llx") \
+    CC_PAL_TRACE_FMT(SEQ_COMPLETED,         "sequence completed") \
+    CC_PAL_TRACE_FMT(PKA_OP,                "PKA opcode=0x%llx lenId=%llu a=0x%llx b=0x%llx res=0x%llx tag=%llu")
+
+#define CC_PAL_TRACE_FMT_ID(id, fmt)    CC_PAL_TRACE_ID_ ## id,
+
+/* Trace point identifiers */
+typedef enum {
+    CC_PAL_TRACE_FMT_LIST(CC_PAL_TRACE_FMT_ID)
+    CC_PAL_TRACE_ID_MAX,
+    CC_PAL_TRACE_ID_RESERVE16 = 0x7FFF
+} CCPalTraceId_t;
+
+#undef CC_PAL_TRACE_FMT_ID
+
+#endif /*_CC_PAL_TRACE_IDS_H_*/
@@ -14,6 +14,7 @@ extern "C"
 {
 #endif
 #include <pthread.h>
+#include <stdint.h>
 /**
 * @brief File Description:
 *        This file contains functions for resource management (semaphor operations).
@@ -23,7 +24,35 @@ extern "C"
 *
 */
 
-typedef pthread_mutex_t CC_PalMutex;
+/* Number of log2(nSec) buckets in the wait/hold time histograms.
+   Bucket i counts durations in the range [2^i, 2^(i+1)) nSec, the last bucket is open ended. */
+#define CC_PAL_MUTEX_HIST_BUCKETS      32
+
+/* Maximal number of lock attempts done while spinning before blocking on the futex. */
+#ifndef CC_PAL_MUTEX_MAX_SPIN_COUNT
+#define CC_PAL_MUTEX_MAX_SPIN_COUNT    200
+#endif
+
+/* Contention statistics of a single mutex. */
+typedef struct {
+	uint64_t acquireCount;    /* Number of successful acquires */
+	uint64_t contendedCount;  /* Number of acquires that did not get the mutex on the first attempt */
+	uint64_t spinAcquireCount;/* Number of contended acquires that got the mutex while spinning */
+	uint64_t timeoutCount;    /* Number of lock requests that expired */
+	uint64_t totalWaitNs;     /* Accumulated wait time of contended acquires */
+	uint64_t maxWaitNs;       /* Maximal wait time */
+	uint64_t totalHoldNs;     /* Accumulated hold time */
+	uint64_t maxHoldNs;       /* Maximal hold time */
+	uint32_t waitHist[CC_PAL_MUTEX_HIST_BUCKETS]; /* Wait time histogram of contended acquires */
+	uint32_t holdHist[CC_PAL_MUTEX_HIST_BUCKETS]; /* Hold time histogram */
+} CCPalMutexStats_t;
+
+typedef struct {
+	pthread_mutex_t mutex;        /* The OS mutex */
+	uint32_t spinEstimate;        /* Adaptive estimate of the spin count needed to acquire */
+	uint64_t lockTimeNs;          /* Acquire time stamp of the current owner */
+	CCPalMutexStats_t stats;      /* Contention statistics, updated while holding the mutex */
+} CC_PalMutex;
 
 
 
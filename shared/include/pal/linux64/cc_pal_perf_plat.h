@@ -11,4 +11,27 @@
 
 typedef uint64_t CCPalPerfData_t;
 
+/* Time stamp sources of the performance statistics */
+#define CC_PAL_PERF_BACKEND_MONOTONIC_RAW   0   /* clock_gettime(CLOCK_MONOTONIC_RAW), nSec */
+#define CC_PAL_PERF_BACKEND_CNTVCT          1   /* AArch64 virtual counter (cntvct_el0), converted to nSec */
+#define CC_PAL_PERF_BACKEND_PERF_EVENT      2   /* perf_event CPU cycles of the calling thread */
+#define CC_PAL_PERF_BACKEND_ZYNQ_SCU        3   /* Zynq SCU global timer through /dev/mem, CPU cycles */
+
+/* Default backend. Can be overridden by the build with -DCC_PAL_PERF_BACKEND=<backend>.
+   If the selected backend cannot be initialized, CLOCK_MONOTONIC_RAW is used. */
+#ifndef CC_PAL_PERF_BACKEND
+#if defined(CC_PLAT_ZYNQ7000)
+#define CC_PAL_PERF_BACKEND     CC_PAL_PERF_BACKEND_ZYNQ_SCU
+#elif defined(__aarch64__)
+#define CC_PAL_PERF_BACKEND     CC_PAL_PERF_BACKEND_CNTVCT
+#else
+#define CC_PAL_PERF_BACKEND     CC_PAL_PERF_BACKEND_MONOTONIC_RAW
+#endif
+#endif
+
+/* Log-linear histogram: every power of two is split to 2^CC_PAL_PERF_HIST_SUB_BITS buckets */
+#define CC_PAL_PERF_HIST_SUB_BITS       2
+#define CC_PAL_PERF_HIST_MAX_EXP        48
+#define CC_PAL_PERF_HIST_BUCKETS        (CC_PAL_PERF_HIST_MAX_EXP << CC_PAL_PERF_HIST_SUB_BITS)
+
 #endif /*_CC_PAL_PERF_PLAT_H__*/
@@ -0,0 +1,131 @@
+#!/usr/local/bin/python3
+#
+# Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+#
+
+
+# This utility generates cc_dh_groups_comb.c: the fixed-base comb tables of the generator 2
+# of the DH named groups.
+# The group primes are parsed from cc_dh_groups.c, so the tables always match the groups
+# they are built for.
+#
+# The tables serve the short private keys of 2*s bits, where s is the security strength
+# of the group: the comb has W teeth spaced D = ceil(2*s/W) bits apart. Entry u-1
+# (1 <= u < 2^W) of the table holds
+#       T[u] = 2^(sum_{j=0..W-1} u_j * 2^(j*D)) mod p,  u_j = bit j of u.
+# See DhCombExp() for the matching evaluation of the exponent.
+#
+# usage: cc_dh_comb_tables_gen.py <path to cc_dh_groups.c> <output file>
+
+import sys
+import re
+
+COMB_TEETH = 4
+
+# (prime array suffix, group ID, security strength in bits)
+GROUPS = [
+    ("modp2048",  "CC_DH_NAMED_GROUP_MODP2048",  112),
+    ("modp3072",  "CC_DH_NAMED_GROUP_MODP3072",  128),
+    ("modp4096",  "CC_DH_NAMED_GROUP_MODP4096",  152),
+    ("ffdhe2048", "CC_DH_NAMED_GROUP_FFDHE2048", 112),
+    ("ffdhe3072", "CC_DH_NAMED_GROUP_FFDHE3072", 128),
+    ("ffdhe4096", "CC_DH_NAMED_GROUP_FFDHE4096", 152),
+]
+
+HEADER = """/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/* This file is generated by utils/src/dh_comb_tables/cc_dh_comb_tables_gen.py - do not edit. */
+
+#include "cc_pal_types.h"
+#include "cc_dh_groups.h"
+#include "cc_dh_groups_comb.h"
+
+"""
+
+
+def parse_primes(path):
+    """Returns the group primes of cc_dh_groups.c as integers, by array suffix."""
+    with open(path) as f:
+        text = f.read()
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    primes = {}
+    for name, body in re.findall(r"dh_group_prime_(\w+)\[\d+\]\s*=\s*\{([^}]*)\}", text):
+        primes[name] = int("".join("%02X" % int(b, 0) for b in body.split(",")), 16)
+    return primes
+
+
+def to_words(v, n):
+    return ["0x%08X" % ((v >> (32 * i)) & 0xFFFFFFFF) for i in range(n)]
+
+
+def emit_table(name, group_id, p, strength):
+    # the generator 2 must generate the subgroup of order q = (p-1)/2
+    q = (p - 1) // 2
+    if p % 8 != 7 or pow(2, q, p) != 1:
+        raise ValueError("%s: 2 does not generate the subgroup of order q" % name)
+    mod_words = (p.bit_length() + 31) // 32
+    spacing = (2 * strength + COMB_TEETH - 1) // COMB_TEETH
+    out = []
+    out.append("/* %s: %d teeth spaced %d bits apart */" % (name, COMB_TEETH, spacing))
+    out.append("static const uint32_t dh_comb_entries_%s[CC_DH_COMB_ENTRIES_COUNT*%d] = {" % (name, mod_words))
+    for u in range(1, 1 << COMB_TEETH):
+        k = 0
+        for j in range(COMB_TEETH):
+            k += ((u >> j) & 1) << (j * spacing)
+        words = to_words(pow(2, k, p), mod_words)
+        out.append("\t/* T[%d] */" % u)
+        for i in range(0, mod_words, 8):
+            out.append("\t" + ",".join(words[i:i + 8]) + ",")
+    out.append("};")
+    out.append("")
+    entry = "\t{%s, %d, %d, dh_comb_entries_%s}," % (group_id, mod_words, spacing, name)
+    return out, entry
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("usage: %s <path to cc_dh_groups.c> <output file>" % sys.argv[0])
+        sys.exit(1)
+    primes = parse_primes(sys.argv[1])
+    lines = [HEADER.rstrip("\n"), ""]
+    entries = []
+    for name, group_id, strength in GROUPS:
+        table, entry = emit_table(name, group_id, primes[name], strength)
+        lines += table
+        entries.append(entry)
+
+    lines.append("static const CCDhCombTable_t dh_comb_tables[] = {")
+    lines += entries
+    lines.append("};")
+    lines.append("")
+    lines.append("")
+    lines.append("""/**
+ @brief    the function returns the comb table of the generator of the named group,
+		or NULL if the group has no table
+ @return   return comb table pointer or NULL
+
+*/
+const CCDhCombTable_t *CC_DhGetCombTable(CCDhNamedGroupId_t groupId)
+{
+	uint32_t i;
+
+	for (i = 0; i < sizeof(dh_comb_tables)/sizeof(dh_comb_tables[0]); i++) {
+		if (dh_comb_tables[i].groupId == groupId) {
+			return &dh_comb_tables[i];
+		}
+	}
+	return NULL;
+}""")
+    with open(sys.argv[2], "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
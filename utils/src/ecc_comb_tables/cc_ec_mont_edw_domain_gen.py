@@ -0,0 +1,167 @@
+#!/usr/local/bin/python3
+#
+# Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+#
+
+
+# This utility generates ec_mont_edw_domain_25519.c: the Curve25519 (RFC 7748) and
+# Ed25519 (RFC 8032) domain, with the precomputed tables of the Ed25519 base point B.
+# All the values are derived from p = 2^255 - 19 and d = -121665/121666, and the
+# base point is checked against the one of RFC 8032.
+#
+# The tables hold points in the niels form (y+x, y-x, 2*d*x*y) of the affine point (x, y):
+#  - the fixed-base comb: W teeth spaced D = ceil(253/W) bits apart; entry u (0 <= u < 2^(W-1))
+#    holds T[u] = (1 + sum_{j=1..W-1} (2*u_j - 1) * 2^(j*D)) * B, u_j = bit (j-1) of u.
+#    See PkaEcEdwCombMult() for the matching signed comb recoding of the scalar.
+#  - the width-w NAF of the verification: the odd multiples B, 3B, .., (2^(w-1) - 1)B.
+#
+# usage: cc_ec_mont_edw_domain_gen.py <output file>
+
+import sys
+
+COMB_TEETH = 6
+WNAF_WIDTH = 5
+
+P = 2**255 - 19
+L = 2**252 + 27742317777372353535851937790883648493
+D = -121665 * pow(121666, P - 2, P) % P
+SQRT_M1 = pow(2, (P - 1) // 4, P)
+A24 = 121665
+BY = 4 * pow(5, P - 2, P) % P
+BX = 15112221349535400772501151409588531511454012693041857206046113283949847762202
+
+HEADER = """/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/* This file is generated by utils/src/ecc_comb_tables/cc_ec_mont_edw_domain_gen.py - do not edit. */
+
+#include "cc_pal_types.h"
+#include "cc_pka_defs_hw.h"
+#include "ec_mont_edw_domain.h"
+"""
+
+
+def edw_add(P1, P2):
+    x1, y1 = P1
+    x2, y2 = P2
+    t = D * x1 * x2 * y1 * y2 % P
+    x = (x1 * y2 + x2 * y1) * pow(1 + t, P - 2, P) % P
+    y = (y1 * y2 + x1 * x2) * pow(1 - t, P - 2, P) % P
+    return (x, y)
+
+
+def edw_mul(k, P1):
+    R = (0, 1)
+    while k:
+        if k & 1:
+            R = edw_add(R, P1)
+        P1 = edw_add(P1, P1)
+        k >>= 1
+    return R
+
+
+def barrett_tag(n, pka_word_bits):
+    """Np = floor(2^(N+A+X-1)/n), as PkiCalcNp() for the ECC sizes."""
+    return (1 << (n.bit_length() + pka_word_bits + 8 - 1)) // n
+
+
+def to_words(v, n):
+    return ["0x%08X" % ((v >> (32 * i)) & 0xFFFFFFFF) for i in range(n)]
+
+
+def niels(pt):
+    x, y = pt
+    return [(y + x) % P, (y - x) % P, 2 * D * x * y % P]
+
+
+def emit_points(out, name, count, points, label):
+    out.append("static const uint32_t %s[%s*EC_EDW_NIELS_POINT_SIZE_IN_WORDS] = {" % (name, count))
+    for i, pt in enumerate(points):
+        out.append("\t/* %s */" % label(i))
+        for v in niels(pt):
+            out.append("\t" + ",".join(to_words(v, 8)) + ",")
+    out.append("};")
+    out.append("")
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("usage: %s <output file>" % sys.argv[0])
+        sys.exit(1)
+    if (BY * BY - BX * BX - 1 - D * BX * BX * BY * BY) % P != 0 or edw_mul(L, (BX, BY)) != (0, 1):
+        raise ValueError("the base point is not of order L on the curve")
+    if SQRT_M1 * SQRT_M1 % P != P - 1:
+        raise ValueError("wrong sqrt(-1)")
+
+    spacing = (L.bit_length() + COMB_TEETH - 1) // COMB_TEETH
+    comb = []
+    for u in range(1 << (COMB_TEETH - 1)):
+        k = 1
+        for j in range(1, COMB_TEETH):
+            k += (2 * ((u >> (j - 1)) & 1) - 1) << (j * spacing)
+        comb.append(edw_mul(k % L, (BX, BY)))
+    wnaf = [edw_mul(2 * i + 1, (BX, BY)) for i in range(1 << (WNAF_WIDTH - 2))]
+
+    lines = [HEADER]
+    lines.append("/* Ed25519 base point: %d teeth spaced %d bits apart */" % (COMB_TEETH, spacing))
+    emit_points(lines, "ec_edw_comb_points_25519", "EC_EDW_COMB_POINTS_COUNT", comb,
+                lambda i: "T[%d]" % i)
+    lines.append("/* Ed25519 base point: odd multiples for the width-%d NAF */" % WNAF_WIDTH)
+    emit_points(lines, "ec_edw_wnaf_points_25519", "EC_EDW_WNAF_POINTS_COUNT", wnaf,
+                lambda i: "%dB" % (2 * i + 1))
+
+    lines.append("""/***********************************************************************************
+ *   Data base of Curve25519 and Ed25519: structure of type  EcMontEdwDomain_t      *
+ *       All data is given in little endian order of words in arrays               *
+ ***********************************************************************************/
+static const EcMontEdwDomain_t ec_mont_edw_domain_25519 = {""")
+    lines.append("\t/* Field modulus :  p = 2^255 - 19 */")
+    lines.append("\t{" + ",".join(to_words(P, 8)) + "},")
+    lines.append("\t/* Barrett tag of p */")
+    lines.append("\t#ifdef CC_SUPPORT_PKA_128_32")
+    lines.append("\t{" + ",".join(to_words(barrett_tag(P, 128), 5)) + "},")
+    lines.append("\t#else  // CC_SUPPORT_PKA_64_16")
+    lines.append("\t{" + ",".join(to_words(barrett_tag(P, 64), 5)) + "},")
+    lines.append("\t#endif")
+    lines.append("\t/* Order of the base point:  L = 2^252 + 27742317777372353535851937790883648493 */")
+    lines.append("\t{" + ",".join(to_words(L, 8)) + "},")
+    lines.append("\t/* Barrett tag of L */")
+    lines.append("\t#ifdef CC_SUPPORT_PKA_128_32")
+    lines.append("\t{" + ",".join(to_words(barrett_tag(L, 128), 5)) + "},")
+    lines.append("\t#else  // CC_SUPPORT_PKA_64_16")
+    lines.append("\t{" + ",".join(to_words(barrett_tag(L, 64), 5)) + "},")
+    lines.append("\t#endif")
+    lines.append("\t/* Montgomery curve:  (A - 2)/4 = %d */" % A24)
+    lines.append("\t%d," % A24)
+    lines.append("\t/* Edwards curve:  d = -121665/121666, 2*d and sqrt(-1) mod p */")
+    lines.append("\t{" + ",".join(to_words(D, 8)) + "},")
+    lines.append("\t{" + ",".join(to_words(2 * D % P, 8)) + "},")
+    lines.append("\t{" + ",".join(to_words(SQRT_M1, 8)) + "},")
+    lines.append("\t/* Tables of the base point */")
+    lines.append("\t%d," % spacing)
+    lines.append("\tec_edw_comb_points_25519,")
+    lines.append("\tec_edw_wnaf_points_25519")
+    lines.append("};")
+    lines.append("")
+    lines.append("")
+    lines.append("""/**
+ @brief    the function returns the domain of Curve25519 and Ed25519
+ @return   return domain pointer
+
+*/
+const EcMontEdwDomain_t *EcMontEdwGetDomain25519(void)
+{
+	return &ec_mont_edw_domain_25519;
+}""")
+    with open(sys.argv[1], "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
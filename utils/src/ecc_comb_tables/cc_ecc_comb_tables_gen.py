@@ -0,0 +1,177 @@
+#!/usr/local/bin/python3
+#
+# Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+#
+
+
+# This utility generates cc_ecpki_domain_comb.c: the fixed-base comb tables of the
+# generators of the library EC domains.
+# The domain parameters (P, A, order, Gx, Gy) are parsed from the domain source files,
+# so the tables always match the domains they are built for.
+#
+# For a domain with order size ordBits, the comb has W teeth spaced D = ceil(ordBits/W)
+# bits apart. Entry u (0 <= u < 2^(W-1)) of the table holds the affine point
+#       T[u] = (1 + sum_{j=1..W-1} (2*u_j - 1) * 2^(j*D)) * G,  u_j = bit (j-1) of u.
+# See PkaEcWrstScalarMultBase() for the matching signed comb recoding of the scalar.
+#
+# usage: cc_ecc_comb_tables_gen.py <path to ecc_domains directory> <output file>
+
+import sys
+import os
+import re
+
+COMB_TEETH = 5
+
+# (domain file suffix, domain ID)
+DOMAINS = [
+    ("secp192k1", "CC_ECPKI_DomainID_secp192k1"),
+    ("secp192r1", "CC_ECPKI_DomainID_secp192r1"),
+    ("secp224k1", "CC_ECPKI_DomainID_secp224k1"),
+    ("secp224r1", "CC_ECPKI_DomainID_secp224r1"),
+    ("secp256k1", "CC_ECPKI_DomainID_secp256k1"),
+    ("secp256r1", "CC_ECPKI_DomainID_secp256r1"),
+    ("secp384r1", "CC_ECPKI_DomainID_secp384r1"),
+    ("secp521r1", "CC_ECPKI_DomainID_secp521r1"),
+    ("bp256r1",   "CC_ECPKI_DomainID_bp256r1"),
+    ("sm2",       "CC_ECPKI_DomainID_sm2"),
+]
+
+HEADER = """/*
+ * Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+ *
+ */
+
+/* This file is generated by utils/src/ecc_comb_tables/cc_ecc_comb_tables_gen.py - do not edit. */
+
+#include "cc_pal_types.h"
+#include "cc_pal_mem.h"
+#include "cc_ecpki_types.h"
+#include "cc_ecpki_domain_comb.h"
+
+"""
+
+
+def parse_domain(path):
+    """Returns P, A, order, Gx, Gy of the domain as integers."""
+    with open(path) as f:
+        text = f.read()
+    # strip comments and take the first six word arrays of the structure
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    num = r"(?:0x[0-9A-Fa-f]+|[0-9]+)"
+    arrays = re.findall(r"\{\s*(%s(?:\s*,\s*%s)*)\s*,?\s*\}" % (num, num), text)
+    vals = []
+    for arr in arrays[:6]:
+        words = [int(w, 0) for w in arr.split(",")]
+        vals.append(sum(w << (32 * i) for i, w in enumerate(words)))
+    p, a, b, n, gx, gy = vals
+    if (gy * gy - gx * gx * gx - a * gx - b) % p != 0:
+        raise ValueError("%s: generator is not on the curve" % path)
+    return p, a, n, gx, gy
+
+
+def ec_add(p, a, P, Q):
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    if P[0] == Q[0]:
+        if (P[1] + Q[1]) % p == 0:
+            return None
+        l = (3 * P[0] * P[0] + a) * pow(2 * P[1], p - 2, p) % p
+    else:
+        l = (Q[1] - P[1]) * pow(Q[0] - P[0], p - 2, p) % p
+    x = (l * l - P[0] - Q[0]) % p
+    return (x, (l * (P[0] - x) - P[1]) % p)
+
+
+def ec_mul(p, a, k, P):
+    R = None
+    while k:
+        if k & 1:
+            R = ec_add(p, a, R, P)
+        P = ec_add(p, a, P, P)
+        k >>= 1
+    return R
+
+
+def to_words(v, n):
+    return ["0x%08X" % ((v >> (32 * i)) & 0xFFFFFFFF) for i in range(n)]
+
+
+def emit_table(name, domain_id, p, a, n, gx, gy):
+    mod_words = (p.bit_length() + 31) // 32
+    spacing = (n.bit_length() + COMB_TEETH - 1) // COMB_TEETH
+    out = []
+    out.append("/* %s: %d teeth spaced %d bits apart */" % (name, COMB_TEETH, spacing))
+    out.append("static const uint32_t ecpki_comb_points_%s[CC_ECPKI_COMB_POINTS_COUNT*2*%d] = {" % (name, mod_words))
+    for u in range(1 << (COMB_TEETH - 1)):
+        k = 1
+        for j in range(1, COMB_TEETH):
+            k += (2 * ((u >> (j - 1)) & 1) - 1) << (j * spacing)
+        x, y = ec_mul(p, a, k % n, (gx, gy))
+        out.append("\t/* T[%d] */" % u)
+        out.append("\t" + ",".join(to_words(x, mod_words)) + ",")
+        out.append("\t" + ",".join(to_words(y, mod_words)) + ",")
+    out.append("};")
+    out.append("static const uint32_t ecpki_comb_base_%s[2*%d] = {" % (name, mod_words))
+    out.append("\t" + ",".join(to_words(gx, mod_words)) + ",")
+    out.append("\t" + ",".join(to_words(gy, mod_words)))
+    out.append("};")
+    out.append("")
+    entry = "\t{%s, %d, %d, ecpki_comb_base_%s, ecpki_comb_points_%s}," % (domain_id, mod_words, spacing, name, name)
+    return out, entry
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("usage: %s <path to ecc_domains directory> <output file>" % sys.argv[0])
+        sys.exit(1)
+    lines = [HEADER.rstrip("\n"), ""]
+    entries = []
+    for name, domain_id in DOMAINS:
+        p, a, n, gx, gy = parse_domain(os.path.join(sys.argv[1], "cc_ecpki_domain_%s.c" % name))
+        table, entry = emit_table(name, domain_id, p, a, n, gx, gy)
+        lines += table
+        entries.append(entry)
+
+    lines.append("static const CCEcpkiCombTable_t ecpki_comb_tables[] = {")
+    lines += entries
+    lines.append("};")
+    lines.append("")
+    lines.append("")
+    lines.append("""/**
+ @brief    the function returns the comb table of the domain generator, if the domain is a
+		library domain with an unmodified generator; otherwise returns NULL
+ @return   return comb table pointer or NULL
+
+*/
+const CCEcpkiCombTable_t *CC_EcpkiGetCombTable(const CCEcpkiDomain_t *pDomain)
+{
+	uint32_t i;
+	const CCEcpkiCombTable_t *pTable;
+
+	for (i = 0; i < sizeof(ecpki_comb_tables)/sizeof(ecpki_comb_tables[0]); i++) {
+		pTable = &ecpki_comb_tables[i];
+		if (pTable->domainId != pDomain->DomainID) {
+			continue;
+		}
+		if ((CC_PalMemCmp(pTable->pBase, pDomain->ecGx, pTable->modSizeInWords*sizeof(uint32_t)) != 0) ||
+		    (CC_PalMemCmp(pTable->pBase + pTable->modSizeInWords, pDomain->ecGy,
+				  pTable->modSizeInWords*sizeof(uint32_t)) != 0)) {
+			return NULL;
+		}
+		return pTable;
+	}
+	return NULL;
+}""")
+    with open(sys.argv[2], "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
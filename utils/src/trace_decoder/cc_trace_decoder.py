@@ -0,0 +1,121 @@
+#!/usr/local/bin/python3
+#
+# Copyright (c) 2001-2019, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause OR Arm's non-OSI source license
+#
+
+
+# This utility decodes a binary trace file written by CC_PalTraceDump().
+# The file format is (little endian):
+#       file header: magic "CCTR", version, record size, number of rings
+#       per ring:    thread id, number of records, head (total records written)
+#                    records, oldest first: seq, format id, number of args, reserved,
+#                    time stamp (nSec), 6 args
+# The format strings are taken from cc_pal_trace_ids.h.
+#
+# usage: cc_trace_decoder.py <trace file> [<path to cc_pal_trace_ids.h>]
+
+import sys
+import os
+import re
+import struct
+
+CC_PAL_TRACE_FILE_MAGIC = 0x52544343
+CC_PAL_TRACE_FILE_VERSION = 1
+CC_PAL_TRACE_MAX_ARGS = 6
+
+FILE_HEADER_FORMAT = "<IIII"
+RING_HEADER_FORMAT = "<IIQ"
+RECORD_FORMAT = "<IHBBQ" + "Q" * CC_PAL_TRACE_MAX_ARGS
+
+DEFAULT_IDS_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                "..", "..", "..", "shared", "include", "pal", "cc_pal_trace_ids.h")
+
+
+# Parse the CC_PAL_TRACE_FMT list, the identifiers are numbered in order of appearance
+def parse_ids_file(idsFileName):
+    formats = []
+    fmtRe = re.compile(r'CC_PAL_TRACE_FMT\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+    with open(idsFileName, "r") as idsFile:
+        for line in idsFile:
+            match = fmtRe.search(line)
+            if match is not None:
+                formats.append((match.group(1), re.sub(r"(%[-#0 +]*\d*)ll", r"\1", match.group(2))))
+    return formats
+
+
+def read_struct(traceFile, fmt):
+    size = struct.calcsize(fmt)
+    data = traceFile.read(size)
+    if len(data) != size:
+        raise ValueError("truncated trace file")
+    return struct.unpack(fmt, data)
+
+
+# Returns a list of (time, thread id, format id, args) of all the valid records
+def read_trace_file(traceFileName):
+    records = []
+    dropped = 0
+    with open(traceFileName, "rb") as traceFile:
+        magic, version, recordSize, numOfRings = read_struct(traceFile, FILE_HEADER_FORMAT)
+        if magic != CC_PAL_TRACE_FILE_MAGIC or version != CC_PAL_TRACE_FILE_VERSION:
+            raise ValueError("not a trace file, or unsupported version")
+        if recordSize != struct.calcsize(RECORD_FORMAT):
+            raise ValueError("unexpected record size %d" % recordSize)
+
+        for ring in range(numOfRings):
+            threadId, numOfEntries, head = read_struct(traceFile, RING_HEADER_FORMAT)
+            seq = head - numOfEntries
+            for entry in range(numOfEntries):
+                fields = read_struct(traceFile, RECORD_FORMAT)
+                seq += 1
+                # records overwritten during the dump are zeroed or carry a later sequence number
+                if fields[0] != (seq & 0xFFFFFFFF):
+                    dropped += 1
+                    continue
+                numArgs = min(fields[2], CC_PAL_TRACE_MAX_ARGS)
+                records.append((fields[4], threadId, fields[1], fields[5:5 + numArgs]))
+
+    records.sort(key=lambda record: record[0])
+    return records, dropped
+
+
+def format_record(formats, fmtId, args):
+    if fmtId >= len(formats):
+        return "unknown id %d args %s" % (fmtId, " ".join("0x%x" % arg for arg in args))
+    name, fmt = formats[fmtId]
+    if name == "HW_DESC":
+        # two descriptor words per argument, print them as word[0]..word[5]
+        words = []
+        for arg in args:
+            words += [arg & 0xFFFFFFFF, arg >> 32]
+        return "HW_DESC " + " ".join("0x%08x" % word for word in words)
+    try:
+        return name + " " + (fmt % tuple(args))
+    except (TypeError, ValueError):
+        return name + " " + " ".join("0x%x" % arg for arg in args)
+
+
+def main(argv):
+    if len(argv) < 2:
+        print("usage: %s <trace file> [<cc_pal_trace_ids.h>]" % argv[0])
+        return 1
+
+    idsFileName = argv[2] if len(argv) > 2 else DEFAULT_IDS_FILE
+    formats = parse_ids_file(idsFileName)
+    records, dropped = read_trace_file(argv[1])
+    if len(records) == 0:
+        print("no records")
+        return 0
+
+    startTime = records[0][0]
+    for timeNs, threadId, fmtId, args in records:
+        print("%12.3f us [%6d] %s" % ((timeNs - startTime) / 1000.0, threadId, format_record(formats, fmtId, args)))
+    if dropped != 0:
+        print("%d records were dropped (overwritten during the dump)" % dropped)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))